@@ -0,0 +1,74 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: TLinear, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def TLinearSetControl(self, data):
+        '''Usage: returnCode = SetControl(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_TLinear_SetControl(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetControl()
+
+
+    @exception_wrapper
+    def TLinearGetControl(self):
+        '''Usage: returnCode, data = GetControl(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_TLinear_GetControl()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetControl()
+
+
+    @exception_wrapper
+    def TLinearGetLUT(self, mode, offset):
+        '''Usage: returnCode, a, b = GetLUT(self, mode, offset)
+            Input_01 mode FLR_BOSON_TABLETYPE_E <<FLR_BOSON_TABLETYPE_E>>
+            Input_02 offset <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 a[<class 'float'>] 16 <<FLOAT*16>>
+            Output_02 b[<class 'float'>] 16 <<FLOAT*16>>
+        '''
+        returnCode, a, b = self.CLIENT_pkg_TLinear_GetLUT(mode, offset)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, a, b)
+    # End of GetLUT()
+
+
+    @exception_wrapper
+    def TLinearRefreshLUT(self, mode):
+        '''Usage: returnCode = RefreshLUT(self, mode)
+            Input_01 mode FLR_BOSON_TABLETYPE_E <<FLR_BOSON_TABLETYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_TLinear_RefreshLUT(mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of RefreshLUT()
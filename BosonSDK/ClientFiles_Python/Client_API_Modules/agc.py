@@ -0,0 +1,845 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: agc, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def agcSetPercentPerBin(self, data):
+        '''Usage: returnCode = SetPercentPerBin(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetPercentPerBin(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetPercentPerBin()
+
+
+    @exception_wrapper
+    def agcGetPercentPerBin(self):
+        '''Usage: returnCode, data = GetPercentPerBin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetPercentPerBin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetPercentPerBin()
+
+
+    @exception_wrapper
+    def agcSetLinearPercent(self, data):
+        '''Usage: returnCode = SetLinearPercent(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetLinearPercent(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLinearPercent()
+
+
+    @exception_wrapper
+    def agcGetLinearPercent(self):
+        '''Usage: returnCode, data = GetLinearPercent(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetLinearPercent()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetLinearPercent()
+
+
+    @exception_wrapper
+    def agcSetOutlierCut(self, data):
+        '''Usage: returnCode = SetOutlierCut(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetOutlierCut(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutlierCut()
+
+
+    @exception_wrapper
+    def agcGetOutlierCut(self):
+        '''Usage: returnCode, data = GetOutlierCut(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetOutlierCut()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOutlierCut()
+
+
+    @exception_wrapper
+    def agcGetDrOut(self):
+        '''Usage: returnCode, data = GetDrOut(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetDrOut()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDrOut()
+
+
+    @exception_wrapper
+    def agcSetMaxGain(self, data):
+        '''Usage: returnCode = SetMaxGain(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetMaxGain(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxGain()
+
+
+    @exception_wrapper
+    def agcGetMaxGain(self):
+        '''Usage: returnCode, data = GetMaxGain(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetMaxGain()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxGain()
+
+
+    @exception_wrapper
+    def agcSetdf(self, data):
+        '''Usage: returnCode = Setdf(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_Setdf(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Setdf()
+
+
+    @exception_wrapper
+    def agcGetdf(self):
+        '''Usage: returnCode, data = Getdf(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_Getdf()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of Getdf()
+
+
+    @exception_wrapper
+    def agcSetGamma(self, data):
+        '''Usage: returnCode = SetGamma(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetGamma(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGamma()
+
+
+    @exception_wrapper
+    def agcGetGamma(self):
+        '''Usage: returnCode, data = GetGamma(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetGamma()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGamma()
+
+
+    @exception_wrapper
+    def agcGetFirstBin(self):
+        '''Usage: returnCode, data = GetFirstBin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetFirstBin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFirstBin()
+
+
+    @exception_wrapper
+    def agcGetLastBin(self):
+        '''Usage: returnCode, data = GetLastBin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetLastBin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetLastBin()
+
+
+    @exception_wrapper
+    def agcSetDetailHeadroom(self, data):
+        '''Usage: returnCode = SetDetailHeadroom(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetDetailHeadroom(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDetailHeadroom()
+
+
+    @exception_wrapper
+    def agcGetDetailHeadroom(self):
+        '''Usage: returnCode, data = GetDetailHeadroom(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetDetailHeadroom()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDetailHeadroom()
+
+
+    @exception_wrapper
+    def agcSetd2br(self, data):
+        '''Usage: returnCode = Setd2br(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_Setd2br(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Setd2br()
+
+
+    @exception_wrapper
+    def agcGetd2br(self):
+        '''Usage: returnCode, data = Getd2br(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_Getd2br()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of Getd2br()
+
+
+    @exception_wrapper
+    def agcSetSigmaR(self, data):
+        '''Usage: returnCode = SetSigmaR(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetSigmaR(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSigmaR()
+
+
+    @exception_wrapper
+    def agcGetSigmaR(self):
+        '''Usage: returnCode, data = GetSigmaR(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetSigmaR()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSigmaR()
+
+
+    @exception_wrapper
+    def agcSetUseEntropy(self, data):
+        '''Usage: returnCode = SetUseEntropy(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetUseEntropy(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetUseEntropy()
+
+
+    @exception_wrapper
+    def agcGetUseEntropy(self):
+        '''Usage: returnCode, data = GetUseEntropy(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetUseEntropy()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetUseEntropy()
+
+
+    @exception_wrapper
+    def agcSetROI(self, roi):
+        '''Usage: returnCode = SetROI(self, roi)
+            Input_01 roi FLR_ROI_T <<FLR_ROI_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetROI(roi)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetROI()
+
+
+    @exception_wrapper
+    def agcGetROI(self):
+        '''Usage: returnCode, roi = GetROI(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 roi FLR_ROI_T <<FLR_ROI_T>>
+        '''
+        returnCode, roi = self.CLIENT_pkg_agc_GetROI()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, roi)
+    # End of GetROI()
+
+
+    @exception_wrapper
+    def agcGetMaxGainApplied(self):
+        '''Usage: returnCode, data = GetMaxGainApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetMaxGainApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxGainApplied()
+
+
+    @exception_wrapper
+    def agcGetSigmaRApplied(self):
+        '''Usage: returnCode, data = GetSigmaRApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetSigmaRApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSigmaRApplied()
+
+
+    @exception_wrapper
+    def agcSetOutlierCutBalance(self, data):
+        '''Usage: returnCode = SetOutlierCutBalance(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetOutlierCutBalance(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutlierCutBalance()
+
+
+    @exception_wrapper
+    def agcGetOutlierCutBalance(self):
+        '''Usage: returnCode, data = GetOutlierCutBalance(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetOutlierCutBalance()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOutlierCutBalance()
+
+
+    @exception_wrapper
+    def agcGetOutlierCutApplied(self):
+        '''Usage: returnCode, percentHigh, percentLow = GetOutlierCutApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 percentHigh <class 'float'> <<FLOAT>>
+            Output_02 percentLow <class 'float'> <<FLOAT>>
+        '''
+        returnCode, percentHigh, percentLow = self.CLIENT_pkg_agc_GetOutlierCutApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, percentHigh, percentLow)
+    # End of GetOutlierCutApplied()
+
+
+    @exception_wrapper
+    def agcSetDetailHeadroomBalance(self, data):
+        '''Usage: returnCode = SetDetailHeadroomBalance(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetDetailHeadroomBalance(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDetailHeadroomBalance()
+
+
+    @exception_wrapper
+    def agcGetDetailHeadroomBalance(self):
+        '''Usage: returnCode, data = GetDetailHeadroomBalance(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetDetailHeadroomBalance()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDetailHeadroomBalance()
+
+
+    @exception_wrapper
+    def agcGetDetailHeadroomApplied(self):
+        '''Usage: returnCode, countsHigh, countsLow = GetDetailHeadroomApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 countsHigh <class 'float'> <<FLOAT>>
+            Output_02 countsLow <class 'float'> <<FLOAT>>
+        '''
+        returnCode, countsHigh, countsLow = self.CLIENT_pkg_agc_GetDetailHeadroomApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, countsHigh, countsLow)
+    # End of GetDetailHeadroomApplied()
+
+
+    @exception_wrapper
+    def agcGetTfThresholds(self):
+        '''Usage: returnCode, tf_thresholdMin, tf_thresholdMax = GetTfThresholds(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 tf_thresholdMin <class 'int'> <<UINT_16>>
+            Output_02 tf_thresholdMax <class 'int'> <<UINT_16>>
+        '''
+        returnCode, tf_thresholdMin, tf_thresholdMax = self.CLIENT_pkg_agc_GetTfThresholds()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, tf_thresholdMin, tf_thresholdMax)
+    # End of GetTfThresholds()
+
+
+    @exception_wrapper
+    def agcSetTfThresholds(self, tf_thresholdMin, tf_thresholdMax):
+        '''Usage: returnCode = SetTfThresholds(self, tf_thresholdMin, tf_thresholdMax)
+            Input_01 tf_thresholdMin <class 'int'> <<UINT_16>>
+            Input_02 tf_thresholdMax <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetTfThresholds(tf_thresholdMin, tf_thresholdMax)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTfThresholds()
+
+
+    @exception_wrapper
+    def agcGetMode(self):
+        '''Usage: returnCode, mode = GetMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mode FLR_AGC_MODE_E <<FLR_AGC_MODE_E>>
+        '''
+        returnCode, mode = self.CLIENT_pkg_agc_GetMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, mode)
+    # End of GetMode()
+
+
+    @exception_wrapper
+    def agcSetMode(self, mode):
+        '''Usage: returnCode = SetMode(self, mode)
+            Input_01 mode FLR_AGC_MODE_E <<FLR_AGC_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetMode(mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMode()
+
+
+    @exception_wrapper
+    def agcSetHighTempAlarmValues(self, lowGain, highGain, pixPopulation):
+        '''Usage: returnCode = SetHighTempAlarmValues(self, lowGain, highGain, pixPopulation)
+            Input_01 lowGain <class 'int'> <<UINT_32>>
+            Input_02 highGain <class 'int'> <<UINT_32>>
+            Input_03 pixPopulation <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetHighTempAlarmValues(lowGain, highGain, pixPopulation)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetHighTempAlarmValues()
+
+
+    @exception_wrapper
+    def agcGetContrast(self):
+        '''Usage: returnCode, contrast = GetContrast(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 contrast <class 'int'> <<INT_32>>
+        '''
+        returnCode, contrast = self.CLIENT_pkg_agc_GetContrast()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, contrast)
+    # End of GetContrast()
+
+
+    @exception_wrapper
+    def agcSetContrast(self, contrast):
+        '''Usage: returnCode = SetContrast(self, contrast)
+            Input_01 contrast <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetContrast(contrast)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetContrast()
+
+
+    @exception_wrapper
+    def agcGetBrightnessBias(self):
+        '''Usage: returnCode, brightnessBias = GetBrightnessBias(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 brightnessBias <class 'int'> <<INT_32>>
+        '''
+        returnCode, brightnessBias = self.CLIENT_pkg_agc_GetBrightnessBias()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, brightnessBias)
+    # End of GetBrightnessBias()
+
+
+    @exception_wrapper
+    def agcSetBrightnessBias(self, brightnessBias):
+        '''Usage: returnCode = SetBrightnessBias(self, brightnessBias)
+            Input_01 brightnessBias <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetBrightnessBias(brightnessBias)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetBrightnessBias()
+
+
+    @exception_wrapper
+    def agcGetBrightness(self):
+        '''Usage: returnCode, brightness = GetBrightness(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 brightness <class 'int'> <<INT_32>>
+        '''
+        returnCode, brightness = self.CLIENT_pkg_agc_GetBrightness()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, brightness)
+    # End of GetBrightness()
+
+
+    @exception_wrapper
+    def agcSetBrightness(self, brightness):
+        '''Usage: returnCode = SetBrightness(self, brightness)
+            Input_01 brightness <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetBrightness(brightness)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetBrightness()
+
+
+    @exception_wrapper
+    def agcSetMaxGainForLowGain(self, data):
+        '''Usage: returnCode = SetMaxGainForLowGain(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetMaxGainForLowGain(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxGainForLowGain()
+
+
+    @exception_wrapper
+    def agcGetMaxGainForLowGain(self):
+        '''Usage: returnCode, data = GetMaxGainForLowGain(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetMaxGainForLowGain()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxGainForLowGain()
+
+
+    @exception_wrapper
+    def agcSetRadius(self, data):
+        '''Usage: returnCode = SetRadius(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetRadius(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRadius()
+
+
+    @exception_wrapper
+    def agcGetRadius(self):
+        '''Usage: returnCode, data = GetRadius(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetRadius()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRadius()
+
+
+    @exception_wrapper
+    def agcSetGmax(self, data):
+        '''Usage: returnCode = SetGmax(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetGmax(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGmax()
+
+
+    @exception_wrapper
+    def agcGetGmax(self):
+        '''Usage: returnCode, data = GetGmax(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetGmax()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGmax()
+
+
+    @exception_wrapper
+    def agcSetGmin(self, data):
+        '''Usage: returnCode = SetGmin(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_agc_SetGmin(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGmin()
+
+
+    @exception_wrapper
+    def agcGetGmin(self):
+        '''Usage: returnCode, data = GetGmin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_agc_GetGmin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGmin()
@@ -0,0 +1,1954 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: boson, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def bosonGetCameraSN(self):
+        '''Usage: returnCode, data = GetCameraSN(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetCameraSN()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetCameraSN()
+
+
+    @exception_wrapper
+    def bosonGetCameraPN(self):
+        '''Usage: returnCode, data = GetCameraPN(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_BOSON_PARTNUMBER_T <<FLR_BOSON_PARTNUMBER_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetCameraPN()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetCameraPN()
+
+
+    @exception_wrapper
+    def bosonGetSensorSN(self):
+        '''Usage: returnCode, data = GetSensorSN(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetSensorSN()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSensorSN()
+
+
+    @exception_wrapper
+    def bosonRunFFC(self):
+        '''Usage: returnCode = RunFFC(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_RunFFC()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of RunFFC()
+
+
+    @exception_wrapper
+    def bosonSetFFCTempThreshold(self, data):
+        '''Usage: returnCode = SetFFCTempThreshold(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFFCTempThreshold(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFCTempThreshold()
+
+
+    @exception_wrapper
+    def bosonGetFFCTempThreshold(self):
+        '''Usage: returnCode, data = GetFFCTempThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFFCTempThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFFCTempThreshold()
+
+
+    @exception_wrapper
+    def bosonSetFFCFrameThreshold(self, data):
+        '''Usage: returnCode = SetFFCFrameThreshold(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFFCFrameThreshold(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFCFrameThreshold()
+
+
+    @exception_wrapper
+    def bosonGetFFCFrameThreshold(self):
+        '''Usage: returnCode, data = GetFFCFrameThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFFCFrameThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFFCFrameThreshold()
+
+
+    @exception_wrapper
+    def bosonGetFFCInProgress(self):
+        '''Usage: returnCode, data = GetFFCInProgress(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFFCInProgress()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFFCInProgress()
+
+
+    @exception_wrapper
+    def bosonReboot(self):
+        '''Usage: returnCode = Reboot(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_Reboot()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Reboot()
+
+
+    @exception_wrapper
+    def bosonSetFFCMode(self, ffcMode):
+        '''Usage: returnCode = SetFFCMode(self, ffcMode)
+            Input_01 ffcMode FLR_BOSON_FFCMODE_E <<FLR_BOSON_FFCMODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFFCMode(ffcMode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFCMode()
+
+
+    @exception_wrapper
+    def bosonGetFFCMode(self):
+        '''Usage: returnCode, ffcMode = GetFFCMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 ffcMode FLR_BOSON_FFCMODE_E <<FLR_BOSON_FFCMODE_E>>
+        '''
+        returnCode, ffcMode = self.CLIENT_pkg_boson_GetFFCMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, ffcMode)
+    # End of GetFFCMode()
+
+
+    @exception_wrapper
+    def bosonSetGainMode(self, gainMode):
+        '''Usage: returnCode = SetGainMode(self, gainMode)
+            Input_01 gainMode FLR_BOSON_GAINMODE_E <<FLR_BOSON_GAINMODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainMode(gainMode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainMode()
+
+
+    @exception_wrapper
+    def bosonGetGainMode(self):
+        '''Usage: returnCode, gainMode = GetGainMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 gainMode FLR_BOSON_GAINMODE_E <<FLR_BOSON_GAINMODE_E>>
+        '''
+        returnCode, gainMode = self.CLIENT_pkg_boson_GetGainMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, gainMode)
+    # End of GetGainMode()
+
+
+    @exception_wrapper
+    def bosonWriteDynamicHeaderToFlash(self):
+        '''Usage: returnCode = WriteDynamicHeaderToFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_WriteDynamicHeaderToFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteDynamicHeaderToFlash()
+
+
+    @exception_wrapper
+    def bosonReadDynamicHeaderFromFlash(self):
+        '''Usage: returnCode = ReadDynamicHeaderFromFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_ReadDynamicHeaderFromFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of ReadDynamicHeaderFromFlash()
+
+
+    @exception_wrapper
+    def bosonRestoreFactoryDefaultsFromFlash(self):
+        '''Usage: returnCode = RestoreFactoryDefaultsFromFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_RestoreFactoryDefaultsFromFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of RestoreFactoryDefaultsFromFlash()
+
+
+    @exception_wrapper
+    def bosonRestoreFactoryBadPixelsFromFlash(self):
+        '''Usage: returnCode = RestoreFactoryBadPixelsFromFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_RestoreFactoryBadPixelsFromFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of RestoreFactoryBadPixelsFromFlash()
+
+
+    @exception_wrapper
+    def bosonWriteBadPixelsToFlash(self):
+        '''Usage: returnCode = WriteBadPixelsToFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_WriteBadPixelsToFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteBadPixelsToFlash()
+
+
+    @exception_wrapper
+    def bosonGetSoftwareRev(self):
+        '''Usage: returnCode, major, minor, patch = GetSoftwareRev(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 major <class 'int'> <<UINT_32>>
+            Output_02 minor <class 'int'> <<UINT_32>>
+            Output_03 patch <class 'int'> <<UINT_32>>
+        '''
+        returnCode, major, minor, patch = self.CLIENT_pkg_boson_GetSoftwareRev()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, major, minor, patch)
+    # End of GetSoftwareRev()
+
+
+    @exception_wrapper
+    def bosonSetBadPixelLocation(self, row, col):
+        '''Usage: returnCode = SetBadPixelLocation(self, row, col)
+            Input_01 row <class 'int'> <<UINT_32>>
+            Input_02 col <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetBadPixelLocation(row, col)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetBadPixelLocation()
+
+
+    @exception_wrapper
+    def bosonlookupFPATempDegCx10(self):
+        '''Usage: returnCode, data = lookupFPATempDegCx10(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_lookupFPATempDegCx10()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of lookupFPATempDegCx10()
+
+
+    @exception_wrapper
+    def bosonlookupFPATempDegKx10(self):
+        '''Usage: returnCode, data = lookupFPATempDegKx10(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_lookupFPATempDegKx10()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of lookupFPATempDegKx10()
+
+
+    @exception_wrapper
+    def bosonWriteLensNvFfcToFlash(self):
+        '''Usage: returnCode = WriteLensNvFfcToFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_WriteLensNvFfcToFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteLensNvFfcToFlash()
+
+
+    @exception_wrapper
+    def bosonWriteLensGainToFlash(self):
+        '''Usage: returnCode = WriteLensGainToFlash(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_WriteLensGainToFlash()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteLensGainToFlash()
+
+
+    @exception_wrapper
+    def bosonSetLensNumber(self, lensNumber):
+        '''Usage: returnCode = SetLensNumber(self, lensNumber)
+            Input_01 lensNumber <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetLensNumber(lensNumber)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLensNumber()
+
+
+    @exception_wrapper
+    def bosonGetLensNumber(self):
+        '''Usage: returnCode, lensNumber = GetLensNumber(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 lensNumber <class 'int'> <<UINT_32>>
+        '''
+        returnCode, lensNumber = self.CLIENT_pkg_boson_GetLensNumber()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, lensNumber)
+    # End of GetLensNumber()
+
+
+    @exception_wrapper
+    def bosonSetTableNumber(self, tableNumber):
+        '''Usage: returnCode = SetTableNumber(self, tableNumber)
+            Input_01 tableNumber <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetTableNumber(tableNumber)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTableNumber()
+
+
+    @exception_wrapper
+    def bosonGetTableNumber(self):
+        '''Usage: returnCode, tableNumber = GetTableNumber(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 tableNumber <class 'int'> <<UINT_32>>
+        '''
+        returnCode, tableNumber = self.CLIENT_pkg_boson_GetTableNumber()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, tableNumber)
+    # End of GetTableNumber()
+
+
+    @exception_wrapper
+    def bosonGetSensorPN(self):
+        '''Usage: returnCode, sensorPN = GetSensorPN(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 sensorPN FLR_BOSON_SENSOR_PARTNUMBER_T <<FLR_BOSON_SENSOR_PARTNUMBER_T>>
+        '''
+        returnCode, sensorPN = self.CLIENT_pkg_boson_GetSensorPN()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, sensorPN)
+    # End of GetSensorPN()
+
+
+    @exception_wrapper
+    def bosonSetGainSwitchParams(self, parm_struct):
+        '''Usage: returnCode = SetGainSwitchParams(self, parm_struct)
+            Input_01 parm_struct FLR_BOSON_GAIN_SWITCH_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainSwitchParams(parm_struct)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainSwitchParams()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchParams(self):
+        '''Usage: returnCode, parm_struct = GetGainSwitchParams(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 parm_struct FLR_BOSON_GAIN_SWITCH_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_PARAMS_T>>
+        '''
+        returnCode, parm_struct = self.CLIENT_pkg_boson_GetGainSwitchParams()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, parm_struct)
+    # End of GetGainSwitchParams()
+
+
+    @exception_wrapper
+    def bosonGetSwitchToHighGainFlag(self):
+        '''Usage: returnCode, switchToHighGainFlag = GetSwitchToHighGainFlag(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 switchToHighGainFlag <class 'int'> <<UCHAR>>
+        '''
+        returnCode, switchToHighGainFlag = self.CLIENT_pkg_boson_GetSwitchToHighGainFlag()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, switchToHighGainFlag)
+    # End of GetSwitchToHighGainFlag()
+
+
+    @exception_wrapper
+    def bosonGetSwitchToLowGainFlag(self):
+        '''Usage: returnCode, switchToLowGainFlag = GetSwitchToLowGainFlag(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 switchToLowGainFlag <class 'int'> <<UCHAR>>
+        '''
+        returnCode, switchToLowGainFlag = self.CLIENT_pkg_boson_GetSwitchToLowGainFlag()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, switchToLowGainFlag)
+    # End of GetSwitchToLowGainFlag()
+
+
+    @exception_wrapper
+    def bosonGetCLowToHighPercent(self):
+        '''Usage: returnCode, cLowToHighPercent = GetCLowToHighPercent(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 cLowToHighPercent <class 'int'> <<UINT_32>>
+        '''
+        returnCode, cLowToHighPercent = self.CLIENT_pkg_boson_GetCLowToHighPercent()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, cLowToHighPercent)
+    # End of GetCLowToHighPercent()
+
+
+    @exception_wrapper
+    def bosonGetMaxNUCTables(self):
+        '''Usage: returnCode, maxNUCTables = GetMaxNUCTables(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 maxNUCTables <class 'int'> <<UINT_32>>
+        '''
+        returnCode, maxNUCTables = self.CLIENT_pkg_boson_GetMaxNUCTables()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, maxNUCTables)
+    # End of GetMaxNUCTables()
+
+
+    @exception_wrapper
+    def bosonGetMaxLensTables(self):
+        '''Usage: returnCode, maxLensTables = GetMaxLensTables(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 maxLensTables <class 'int'> <<UINT_32>>
+        '''
+        returnCode, maxLensTables = self.CLIENT_pkg_boson_GetMaxLensTables()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, maxLensTables)
+    # End of GetMaxLensTables()
+
+
+    @exception_wrapper
+    def bosonGetFfcWaitCloseFrames(self):
+        '''Usage: returnCode, data = GetFfcWaitCloseFrames(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFfcWaitCloseFrames()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcWaitCloseFrames()
+
+
+    @exception_wrapper
+    def bosonSetFfcWaitCloseFrames(self, data):
+        '''Usage: returnCode = SetFfcWaitCloseFrames(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFfcWaitCloseFrames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcWaitCloseFrames()
+
+
+    @exception_wrapper
+    def bosonCheckForTableSwitch(self):
+        '''Usage: returnCode = CheckForTableSwitch(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_CheckForTableSwitch()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CheckForTableSwitch()
+
+
+    @exception_wrapper
+    def bosonGetDesiredTableNumber(self):
+        '''Usage: returnCode, desiredTableNumber = GetDesiredTableNumber(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 desiredTableNumber <class 'int'> <<UINT_32>>
+        '''
+        returnCode, desiredTableNumber = self.CLIENT_pkg_boson_GetDesiredTableNumber()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, desiredTableNumber)
+    # End of GetDesiredTableNumber()
+
+
+    @exception_wrapper
+    def bosonGetFfcStatus(self):
+        '''Usage: returnCode, ffcStatus = GetFfcStatus(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 ffcStatus FLR_BOSON_FFCSTATUS_E <<FLR_BOSON_FFCSTATUS_E>>
+        '''
+        returnCode, ffcStatus = self.CLIENT_pkg_boson_GetFfcStatus()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, ffcStatus)
+    # End of GetFfcStatus()
+
+
+    @exception_wrapper
+    def bosonGetFfcDesired(self):
+        '''Usage: returnCode, ffcDesired = GetFfcDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 ffcDesired <class 'int'> <<UINT_32>>
+        '''
+        returnCode, ffcDesired = self.CLIENT_pkg_boson_GetFfcDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, ffcDesired)
+    # End of GetFfcDesired()
+
+
+    @exception_wrapper
+    def bosonGetSwRevInHeader(self):
+        '''Usage: returnCode, major, minor, patch = GetSwRevInHeader(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 major <class 'int'> <<UINT_32>>
+            Output_02 minor <class 'int'> <<UINT_32>>
+            Output_03 patch <class 'int'> <<UINT_32>>
+        '''
+        returnCode, major, minor, patch = self.CLIENT_pkg_boson_GetSwRevInHeader()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, major, minor, patch)
+    # End of GetSwRevInHeader()
+
+
+    @exception_wrapper
+    def bosonGetLastFFCFrameCount(self):
+        '''Usage: returnCode, frameCount = GetLastFFCFrameCount(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 frameCount <class 'int'> <<UINT_32>>
+        '''
+        returnCode, frameCount = self.CLIENT_pkg_boson_GetLastFFCFrameCount()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, frameCount)
+    # End of GetLastFFCFrameCount()
+
+
+    @exception_wrapper
+    def bosonGetLastFFCTempDegKx10(self):
+        '''Usage: returnCode, temp = GetLastFFCTempDegKx10(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 temp <class 'int'> <<UINT_16>>
+        '''
+        returnCode, temp = self.CLIENT_pkg_boson_GetLastFFCTempDegKx10()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, temp)
+    # End of GetLastFFCTempDegKx10()
+
+
+    @exception_wrapper
+    def bosonGetTableSwitchDesired(self):
+        '''Usage: returnCode, tableSwitchDesired = GetTableSwitchDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 tableSwitchDesired <class 'int'> <<UINT_16>>
+        '''
+        returnCode, tableSwitchDesired = self.CLIENT_pkg_boson_GetTableSwitchDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, tableSwitchDesired)
+    # End of GetTableSwitchDesired()
+
+
+    @exception_wrapper
+    def bosonGetOverTempThreshold(self):
+        '''Usage: returnCode, temperatureInC = GetOverTempThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 temperatureInC <class 'float'> <<FLOAT>>
+        '''
+        returnCode, temperatureInC = self.CLIENT_pkg_boson_GetOverTempThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, temperatureInC)
+    # End of GetOverTempThreshold()
+
+
+    @exception_wrapper
+    def bosonGetLowPowerMode(self):
+        '''Usage: returnCode, lowPowerMode = GetLowPowerMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 lowPowerMode <class 'int'> <<UINT_16>>
+        '''
+        returnCode, lowPowerMode = self.CLIENT_pkg_boson_GetLowPowerMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, lowPowerMode)
+    # End of GetLowPowerMode()
+
+
+    @exception_wrapper
+    def bosonGetOverTempEventOccurred(self):
+        '''Usage: returnCode, overTempEventOccurred = GetOverTempEventOccurred(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 overTempEventOccurred <class 'int'> <<UINT_16>>
+        '''
+        returnCode, overTempEventOccurred = self.CLIENT_pkg_boson_GetOverTempEventOccurred()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, overTempEventOccurred)
+    # End of GetOverTempEventOccurred()
+
+
+    @exception_wrapper
+    def bosonSetPermitThermalShutdownOverride(self, permitThermalShutdownOverride):
+        '''Usage: returnCode = SetPermitThermalShutdownOverride(self, permitThermalShutdownOverride)
+            Input_01 permitThermalShutdownOverride FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetPermitThermalShutdownOverride(permitThermalShutdownOverride)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetPermitThermalShutdownOverride()
+
+
+    @exception_wrapper
+    def bosonGetPermitThermalShutdownOverride(self):
+        '''Usage: returnCode, permitThermalShutdownOverride = GetPermitThermalShutdownOverride(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 permitThermalShutdownOverride FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, permitThermalShutdownOverride = self.CLIENT_pkg_boson_GetPermitThermalShutdownOverride()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, permitThermalShutdownOverride)
+    # End of GetPermitThermalShutdownOverride()
+
+
+    @exception_wrapper
+    def bosonGetMyriadTemp(self):
+        '''Usage: returnCode, myriadTemp = GetMyriadTemp(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 myriadTemp <class 'float'> <<FLOAT>>
+        '''
+        returnCode, myriadTemp = self.CLIENT_pkg_boson_GetMyriadTemp()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, myriadTemp)
+    # End of GetMyriadTemp()
+
+
+    @exception_wrapper
+    def bosonGetNvFFCNucTableNumberLens0(self):
+        '''Usage: returnCode, nvFFCNucTableNumberLens0 = GetNvFFCNucTableNumberLens0(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 nvFFCNucTableNumberLens0 <class 'int'> <<INT_32>>
+        '''
+        returnCode, nvFFCNucTableNumberLens0 = self.CLIENT_pkg_boson_GetNvFFCNucTableNumberLens0()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, nvFFCNucTableNumberLens0)
+    # End of GetNvFFCNucTableNumberLens0()
+
+
+    @exception_wrapper
+    def bosonGetNvFFCNucTableNumberLens1(self):
+        '''Usage: returnCode, nvFFCNucTableNumberLens1 = GetNvFFCNucTableNumberLens1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 nvFFCNucTableNumberLens1 <class 'int'> <<INT_32>>
+        '''
+        returnCode, nvFFCNucTableNumberLens1 = self.CLIENT_pkg_boson_GetNvFFCNucTableNumberLens1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, nvFFCNucTableNumberLens1)
+    # End of GetNvFFCNucTableNumberLens1()
+
+
+    @exception_wrapper
+    def bosonGetNvFFCFPATempDegKx10Lens0(self):
+        '''Usage: returnCode, nvFFCFPATempDegKx10Lens0 = GetNvFFCFPATempDegKx10Lens0(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 nvFFCFPATempDegKx10Lens0 <class 'int'> <<UINT_16>>
+        '''
+        returnCode, nvFFCFPATempDegKx10Lens0 = self.CLIENT_pkg_boson_GetNvFFCFPATempDegKx10Lens0()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, nvFFCFPATempDegKx10Lens0)
+    # End of GetNvFFCFPATempDegKx10Lens0()
+
+
+    @exception_wrapper
+    def bosonGetNvFFCFPATempDegKx10Lens1(self):
+        '''Usage: returnCode, nvFFCFPATempDegKx10Lens1 = GetNvFFCFPATempDegKx10Lens1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 nvFFCFPATempDegKx10Lens1 <class 'int'> <<UINT_16>>
+        '''
+        returnCode, nvFFCFPATempDegKx10Lens1 = self.CLIENT_pkg_boson_GetNvFFCFPATempDegKx10Lens1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, nvFFCFPATempDegKx10Lens1)
+    # End of GetNvFFCFPATempDegKx10Lens1()
+
+
+    @exception_wrapper
+    def bosonSetFFCWarnTimeInSecx10(self, ffcWarnTime):
+        '''Usage: returnCode = SetFFCWarnTimeInSecx10(self, ffcWarnTime)
+            Input_01 ffcWarnTime <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFFCWarnTimeInSecx10(ffcWarnTime)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFCWarnTimeInSecx10()
+
+
+    @exception_wrapper
+    def bosonGetFFCWarnTimeInSecx10(self):
+        '''Usage: returnCode, ffcWarnTime = GetFFCWarnTimeInSecx10(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 ffcWarnTime <class 'int'> <<UINT_16>>
+        '''
+        returnCode, ffcWarnTime = self.CLIENT_pkg_boson_GetFFCWarnTimeInSecx10()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, ffcWarnTime)
+    # End of GetFFCWarnTimeInSecx10()
+
+
+    @exception_wrapper
+    def bosonGetOverTempEventCounter(self):
+        '''Usage: returnCode, overTempEventCounter = GetOverTempEventCounter(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 overTempEventCounter <class 'int'> <<UINT_32>>
+        '''
+        returnCode, overTempEventCounter = self.CLIENT_pkg_boson_GetOverTempEventCounter()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, overTempEventCounter)
+    # End of GetOverTempEventCounter()
+
+
+    @exception_wrapper
+    def bosonSetOverTempTimerInSec(self, overTempTimerInSec):
+        '''Usage: returnCode = SetOverTempTimerInSec(self, overTempTimerInSec)
+            Input_01 overTempTimerInSec <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetOverTempTimerInSec(overTempTimerInSec)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOverTempTimerInSec()
+
+
+    @exception_wrapper
+    def bosonGetOverTempTimerInSec(self):
+        '''Usage: returnCode, overTempTimerInSec = GetOverTempTimerInSec(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 overTempTimerInSec <class 'int'> <<UINT_16>>
+        '''
+        returnCode, overTempTimerInSec = self.CLIENT_pkg_boson_GetOverTempTimerInSec()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, overTempTimerInSec)
+    # End of GetOverTempTimerInSec()
+
+
+    @exception_wrapper
+    def bosonUnloadCurrentLensCorrections(self):
+        '''Usage: returnCode = UnloadCurrentLensCorrections(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_UnloadCurrentLensCorrections()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of UnloadCurrentLensCorrections()
+
+
+    @exception_wrapper
+    def bosonSetTimeForQuickFFCsInSecs(self, timeForQuickFFCsInSecs):
+        '''Usage: returnCode = SetTimeForQuickFFCsInSecs(self, timeForQuickFFCsInSecs)
+            Input_01 timeForQuickFFCsInSecs <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetTimeForQuickFFCsInSecs(timeForQuickFFCsInSecs)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTimeForQuickFFCsInSecs()
+
+
+    @exception_wrapper
+    def bosonGetTimeForQuickFFCsInSecs(self):
+        '''Usage: returnCode, timeForQuickFFCsInSecs = GetTimeForQuickFFCsInSecs(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 timeForQuickFFCsInSecs <class 'int'> <<UINT_32>>
+        '''
+        returnCode, timeForQuickFFCsInSecs = self.CLIENT_pkg_boson_GetTimeForQuickFFCsInSecs()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, timeForQuickFFCsInSecs)
+    # End of GetTimeForQuickFFCsInSecs()
+
+
+    @exception_wrapper
+    def bosonReloadCurrentLensCorrections(self):
+        '''Usage: returnCode = ReloadCurrentLensCorrections(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_ReloadCurrentLensCorrections()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of ReloadCurrentLensCorrections()
+
+
+    @exception_wrapper
+    def bosonGetBootTimestamps(self):
+        '''Usage: returnCode, FirstLight, StartInit, BosonExecDone, Timestamp4 = GetBootTimestamps(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 FirstLight <class 'float'> <<FLOAT>>
+            Output_02 StartInit <class 'float'> <<FLOAT>>
+            Output_03 BosonExecDone <class 'float'> <<FLOAT>>
+            Output_04 Timestamp4 <class 'float'> <<FLOAT>>
+        '''
+        returnCode, FirstLight, StartInit, BosonExecDone, Timestamp4 = self.CLIENT_pkg_boson_GetBootTimestamps()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None)
+        
+        return ( returnCode, FirstLight, StartInit, BosonExecDone, Timestamp4)
+    # End of GetBootTimestamps()
+
+
+    @exception_wrapper
+    def bosonSetExtSyncMode(self, mode):
+        '''Usage: returnCode = SetExtSyncMode(self, mode)
+            Input_01 mode FLR_BOSON_EXT_SYNC_MODE_E <<FLR_BOSON_EXT_SYNC_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetExtSyncMode(mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetExtSyncMode()
+
+
+    @exception_wrapper
+    def bosonGetExtSyncMode(self):
+        '''Usage: returnCode, mode = GetExtSyncMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mode FLR_BOSON_EXT_SYNC_MODE_E <<FLR_BOSON_EXT_SYNC_MODE_E>>
+        '''
+        returnCode, mode = self.CLIENT_pkg_boson_GetExtSyncMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, mode)
+    # End of GetExtSyncMode()
+
+
+    @exception_wrapper
+    def bosonGetLastCommand(self):
+        '''Usage: returnCode, sequenceNum, cmdID = GetLastCommand(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 sequenceNum <class 'int'> <<UINT_32>>
+            Output_02 cmdID <class 'int'> <<UINT_32>>
+        '''
+        returnCode, sequenceNum, cmdID = self.CLIENT_pkg_boson_GetLastCommand()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, sequenceNum, cmdID)
+    # End of GetLastCommand()
+
+
+    @exception_wrapper
+    def bosonGetSensorHostCalVersion(self):
+        '''Usage: returnCode, version = GetSensorHostCalVersion(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 version <class 'int'> <<UINT_32>>
+        '''
+        returnCode, version = self.CLIENT_pkg_boson_GetSensorHostCalVersion()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, version)
+    # End of GetSensorHostCalVersion()
+
+
+    @exception_wrapper
+    def bosonSetDesiredStartupTableNumber(self, table):
+        '''Usage: returnCode = SetDesiredStartupTableNumber(self, table)
+            Input_01 table <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetDesiredStartupTableNumber(table)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDesiredStartupTableNumber()
+
+
+    @exception_wrapper
+    def bosonGetDesiredStartupTableNumber(self):
+        '''Usage: returnCode, table = GetDesiredStartupTableNumber(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 table <class 'int'> <<INT_32>>
+        '''
+        returnCode, table = self.CLIENT_pkg_boson_GetDesiredStartupTableNumber()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, table)
+    # End of GetDesiredStartupTableNumber()
+
+
+    @exception_wrapper
+    def bosonSetNvFFCMeanValueLens0(self, meanValue):
+        '''Usage: returnCode = SetNvFFCMeanValueLens0(self, meanValue)
+            Input_01 meanValue <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetNvFFCMeanValueLens0(meanValue)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNvFFCMeanValueLens0()
+
+
+    @exception_wrapper
+    def bosonGetNvFFCMeanValueLens0(self):
+        '''Usage: returnCode, meanValue = GetNvFFCMeanValueLens0(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 meanValue <class 'float'> <<FLOAT>>
+        '''
+        returnCode, meanValue = self.CLIENT_pkg_boson_GetNvFFCMeanValueLens0()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, meanValue)
+    # End of GetNvFFCMeanValueLens0()
+
+
+    @exception_wrapper
+    def bosonSetNvFFCMeanValueLens1(self, meanValue):
+        '''Usage: returnCode = SetNvFFCMeanValueLens1(self, meanValue)
+            Input_01 meanValue <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetNvFFCMeanValueLens1(meanValue)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNvFFCMeanValueLens1()
+
+
+    @exception_wrapper
+    def bosonGetNvFFCMeanValueLens1(self):
+        '''Usage: returnCode, meanValue = GetNvFFCMeanValueLens1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 meanValue <class 'float'> <<FLOAT>>
+        '''
+        returnCode, meanValue = self.CLIENT_pkg_boson_GetNvFFCMeanValueLens1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, meanValue)
+    # End of GetNvFFCMeanValueLens1()
+
+
+    @exception_wrapper
+    def bosonSetInvertImage(self, invertImage):
+        '''Usage: returnCode = SetInvertImage(self, invertImage)
+            Input_01 invertImage FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetInvertImage(invertImage)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetInvertImage()
+
+
+    @exception_wrapper
+    def bosonGetInvertImage(self):
+        '''Usage: returnCode, invertImage = GetInvertImage(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 invertImage FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, invertImage = self.CLIENT_pkg_boson_GetInvertImage()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, invertImage)
+    # End of GetInvertImage()
+
+
+    @exception_wrapper
+    def bosonSetRevertImage(self, revertImage):
+        '''Usage: returnCode = SetRevertImage(self, revertImage)
+            Input_01 revertImage FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetRevertImage(revertImage)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRevertImage()
+
+
+    @exception_wrapper
+    def bosonGetRevertImage(self):
+        '''Usage: returnCode, revertImage = GetRevertImage(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 revertImage FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, revertImage = self.CLIENT_pkg_boson_GetRevertImage()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, revertImage)
+    # End of GetRevertImage()
+
+
+    @exception_wrapper
+    def bosonGetTimeStamp(self, timeStampType):
+        '''Usage: returnCode, timeStamp = GetTimeStamp(self, timeStampType)
+            Input_01 timeStampType FLR_BOSON_TIMESTAMPTYPE_E <<FLR_BOSON_TIMESTAMPTYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 timeStamp <class 'float'> <<FLOAT>>
+        '''
+        returnCode, timeStamp = self.CLIENT_pkg_boson_GetTimeStamp(timeStampType)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, timeStamp)
+    # End of GetTimeStamp()
+
+
+    @exception_wrapper
+    def bosonGetISPFrameCount(self):
+        '''Usage: returnCode, ispFrameCount = GetISPFrameCount(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 ispFrameCount <class 'int'> <<UINT_32>>
+        '''
+        returnCode, ispFrameCount = self.CLIENT_pkg_boson_GetISPFrameCount()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, ispFrameCount)
+    # End of GetISPFrameCount()
+
+
+    @exception_wrapper
+    def bosonWriteUserBadPixelsToAllTables(self):
+        '''Usage: returnCode = WriteUserBadPixelsToAllTables(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_WriteUserBadPixelsToAllTables()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteUserBadPixelsToAllTables()
+
+
+    @exception_wrapper
+    def bosonWriteFactoryBadPixelsToAllTables(self):
+        '''Usage: returnCode = WriteFactoryBadPixelsToAllTables(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_WriteFactoryBadPixelsToAllTables()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteFactoryBadPixelsToAllTables()
+
+
+    @exception_wrapper
+    def bosonGetTempDiodeStatus(self):
+        '''Usage: returnCode, status = GetTempDiodeStatus(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 status FLR_BOSON_TEMP_DIODE_STATUS_E <<FLR_BOSON_TEMP_DIODE_STATUS_E>>
+        '''
+        returnCode, status = self.CLIENT_pkg_boson_GetTempDiodeStatus()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, status)
+    # End of GetTempDiodeStatus()
+
+
+    @exception_wrapper
+    def bosonClearFactoryBadPixelsInDDR(self):
+        '''Usage: returnCode = ClearFactoryBadPixelsInDDR(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_ClearFactoryBadPixelsInDDR()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of ClearFactoryBadPixelsInDDR()
+
+
+    @exception_wrapper
+    def bosonGetFfcWaitOpenFrames(self):
+        '''Usage: returnCode, data = GetFfcWaitOpenFrames(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFfcWaitOpenFrames()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcWaitOpenFrames()
+
+
+    @exception_wrapper
+    def bosonSetFfcWaitOpenFrames(self, data):
+        '''Usage: returnCode = SetFfcWaitOpenFrames(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFfcWaitOpenFrames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcWaitOpenFrames()
+
+
+    @exception_wrapper
+    def bosonGetFfcWaitOpenFlagSettleFrames(self):
+        '''Usage: returnCode, data = GetFfcWaitOpenFlagSettleFrames(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFfcWaitOpenFlagSettleFrames()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcWaitOpenFlagSettleFrames()
+
+
+    @exception_wrapper
+    def bosonSetFfcWaitOpenFlagSettleFrames(self, data):
+        '''Usage: returnCode = SetFfcWaitOpenFlagSettleFrames(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFfcWaitOpenFlagSettleFrames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcWaitOpenFlagSettleFrames()
+
+
+    @exception_wrapper
+    def bosonGetTauExtFfcCompatibilityMode(self):
+        '''Usage: returnCode, data = GetTauExtFfcCompatibilityMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetTauExtFfcCompatibilityMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTauExtFfcCompatibilityMode()
+
+
+    @exception_wrapper
+    def bosonSetTauExtFfcCompatibilityMode(self, data):
+        '''Usage: returnCode = SetTauExtFfcCompatibilityMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetTauExtFfcCompatibilityMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTauExtFfcCompatibilityMode()
+
+
+    @exception_wrapper
+    def bosonGetInitialTableSelectionTempOffset(self):
+        '''Usage: returnCode, data = GetInitialTableSelectionTempOffset(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetInitialTableSelectionTempOffset()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetInitialTableSelectionTempOffset()
+
+
+    @exception_wrapper
+    def bosonSetInitialTableSelectionTempOffset(self, data):
+        '''Usage: returnCode = SetInitialTableSelectionTempOffset(self, data)
+            Input_01 data <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetInitialTableSelectionTempOffset(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetInitialTableSelectionTempOffset()
+
+
+    @exception_wrapper
+    def bosonGetImageValid(self):
+        '''Usage: returnCode, data = GetImageValid(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetImageValid()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetImageValid()
+
+
+    @exception_wrapper
+    def bosonGetCurrentTableType(self):
+        '''Usage: returnCode, data = GetCurrentTableType(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_BOSON_TABLETYPE_E <<FLR_BOSON_TABLETYPE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetCurrentTableType()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetCurrentTableType()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchFrameThreshold(self):
+        '''Usage: returnCode, data = GetGainSwitchFrameThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetGainSwitchFrameThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGainSwitchFrameThreshold()
+
+
+    @exception_wrapper
+    def bosonSetGainSwitchFrameThreshold(self, data):
+        '''Usage: returnCode = SetGainSwitchFrameThreshold(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainSwitchFrameThreshold(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainSwitchFrameThreshold()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchHysteresisTime(self):
+        '''Usage: returnCode, data = GetGainSwitchHysteresisTime(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetGainSwitchHysteresisTime()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGainSwitchHysteresisTime()
+
+
+    @exception_wrapper
+    def bosonSetGainSwitchHysteresisTime(self, data):
+        '''Usage: returnCode = SetGainSwitchHysteresisTime(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainSwitchHysteresisTime(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainSwitchHysteresisTime()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchDesired(self):
+        '''Usage: returnCode, data = GetGainSwitchDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetGainSwitchDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGainSwitchDesired()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchRadiometricParams(self):
+        '''Usage: returnCode, parm_struct = GetGainSwitchRadiometricParams(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 parm_struct FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T>>
+        '''
+        returnCode, parm_struct = self.CLIENT_pkg_boson_GetGainSwitchRadiometricParams()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, parm_struct)
+    # End of GetGainSwitchRadiometricParams()
+
+
+    @exception_wrapper
+    def bosonSetGainSwitchRadiometricParams(self, parm_struct):
+        '''Usage: returnCode = SetGainSwitchRadiometricParams(self, parm_struct)
+            Input_01 parm_struct FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainSwitchRadiometricParams(parm_struct)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainSwitchRadiometricParams()
+
+
+    @exception_wrapper
+    def bosonSetSaturationOverrideMode(self, data):
+        '''Usage: returnCode = SetSaturationOverrideMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetSaturationOverrideMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSaturationOverrideMode()
+
+
+    @exception_wrapper
+    def bosonGetSaturationOverrideMode(self):
+        '''Usage: returnCode, data = GetSaturationOverrideMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetSaturationOverrideMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSaturationOverrideMode()
+
+
+    @exception_wrapper
+    def bosonSetSaturationOverrideValue(self, data):
+        '''Usage: returnCode = SetSaturationOverrideValue(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetSaturationOverrideValue(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSaturationOverrideValue()
+
+
+    @exception_wrapper
+    def bosonGetSaturationOverrideValue(self):
+        '''Usage: returnCode, data = GetSaturationOverrideValue(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetSaturationOverrideValue()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSaturationOverrideValue()
+
+
+    @exception_wrapper
+    def bosonSetffcHighLowGainThresholdMode(self, data):
+        '''Usage: returnCode = SetffcHighLowGainThresholdMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetffcHighLowGainThresholdMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetffcHighLowGainThresholdMode()
+
+
+    @exception_wrapper
+    def bosonGetffcHighLowGainThresholdMode(self):
+        '''Usage: returnCode, data = GetffcHighLowGainThresholdMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetffcHighLowGainThresholdMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetffcHighLowGainThresholdMode()
+
+
+    @exception_wrapper
+    def bosonSetFFCTempThresholdLowGain(self, data):
+        '''Usage: returnCode = SetFFCTempThresholdLowGain(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFFCTempThresholdLowGain(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFCTempThresholdLowGain()
+
+
+    @exception_wrapper
+    def bosonGetFFCTempThresholdLowGain(self):
+        '''Usage: returnCode, data = GetFFCTempThresholdLowGain(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFFCTempThresholdLowGain()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFFCTempThresholdLowGain()
+
+
+    @exception_wrapper
+    def bosonSetFFCFrameThresholdLowGain(self, data):
+        '''Usage: returnCode = SetFFCFrameThresholdLowGain(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetFFCFrameThresholdLowGain(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFCFrameThresholdLowGain()
+
+
+    @exception_wrapper
+    def bosonGetFFCFrameThresholdLowGain(self):
+        '''Usage: returnCode, data = GetFFCFrameThresholdLowGain(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetFFCFrameThresholdLowGain()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFFCFrameThresholdLowGain()
+
+
+    @exception_wrapper
+    def bosonGetBoardID(self):
+        '''Usage: returnCode, data = GetBoardID(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetBoardID()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetBoardID()
+
+
+    @exception_wrapper
+    def bosonSetAutoGainSwitchConditions(self, data):
+        '''Usage: returnCode = SetAutoGainSwitchConditions(self, data)
+            Input_01 data FLR_BOSON_AUTOGAIN_SWITCH_CONDITION_E <<FLR_BOSON_AUTOGAIN_SWITCH_CONDITION_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetAutoGainSwitchConditions(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAutoGainSwitchConditions()
+
+
+    @exception_wrapper
+    def bosonGetAutoGainSwitchConditions(self):
+        '''Usage: returnCode, data = GetAutoGainSwitchConditions(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_BOSON_AUTOGAIN_SWITCH_CONDITION_E <<FLR_BOSON_AUTOGAIN_SWITCH_CONDITION_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_boson_GetAutoGainSwitchConditions()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAutoGainSwitchConditions()
+
+
+    @exception_wrapper
+    def bosonSetGainSwitchParamsCATS(self, parm_struct):
+        '''Usage: returnCode = SetGainSwitchParamsCATS(self, parm_struct)
+            Input_01 parm_struct FLR_BOSON_GAIN_SWITCH_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainSwitchParamsCATS(parm_struct)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainSwitchParamsCATS()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchParamsCATS(self):
+        '''Usage: returnCode, parm_struct = GetGainSwitchParamsCATS(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 parm_struct FLR_BOSON_GAIN_SWITCH_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_PARAMS_T>>
+        '''
+        returnCode, parm_struct = self.CLIENT_pkg_boson_GetGainSwitchParamsCATS()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, parm_struct)
+    # End of GetGainSwitchParamsCATS()
+
+
+    @exception_wrapper
+    def bosonGetGainSwitchRadiometricParamsCATS(self):
+        '''Usage: returnCode, parm_struct = GetGainSwitchRadiometricParamsCATS(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 parm_struct FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T>>
+        '''
+        returnCode, parm_struct = self.CLIENT_pkg_boson_GetGainSwitchRadiometricParamsCATS()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, parm_struct)
+    # End of GetGainSwitchRadiometricParamsCATS()
+
+
+    @exception_wrapper
+    def bosonSetGainSwitchRadiometricParamsCATS(self, parm_struct):
+        '''Usage: returnCode = SetGainSwitchRadiometricParamsCATS(self, parm_struct)
+            Input_01 parm_struct FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T <<FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_boson_SetGainSwitchRadiometricParamsCATS(parm_struct)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainSwitchRadiometricParamsCATS()
+
+
+    @exception_wrapper
+    def bosonGetCLowToHighPercentCATS(self):
+        '''Usage: returnCode, cLowToHighPercent = GetCLowToHighPercentCATS(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 cLowToHighPercent <class 'int'> <<UINT_32>>
+        '''
+        returnCode, cLowToHighPercent = self.CLIENT_pkg_boson_GetCLowToHighPercentCATS()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, cLowToHighPercent)
+    # End of GetCLowToHighPercentCATS()
@@ -0,0 +1,207 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: bpr, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def bprGetState(self):
+        '''Usage: returnCode, data = GetState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_bpr_GetState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetState()
+
+
+    @exception_wrapper
+    def bprSetState(self, data):
+        '''Usage: returnCode = SetState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_bpr_SetState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetState()
+
+
+    @exception_wrapper
+    def bprGetStats(self):
+        '''Usage: returnCode, threeby, fiveby, rows, budget, used = GetStats(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 threeby <class 'int'> <<UINT_32>>
+            Output_02 fiveby <class 'int'> <<UINT_32>>
+            Output_03 rows <class 'int'> <<UINT_32>>
+            Output_04 budget <class 'int'> <<UINT_32>>
+            Output_05 used <class 'int'> <<UINT_32>>
+        '''
+        returnCode, threeby, fiveby, rows, budget, used = self.CLIENT_pkg_bpr_GetStats()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None, None)
+        
+        return ( returnCode, threeby, fiveby, rows, budget, used)
+    # End of GetStats()
+
+
+    @exception_wrapper
+    def bprGetDisplayMode(self):
+        '''Usage: returnCode, data = GetDisplayMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_BPR_DISPLAY_MODE_E <<FLR_BPR_DISPLAY_MODE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_bpr_GetDisplayMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDisplayMode()
+
+
+    @exception_wrapper
+    def bprSetDisplayMode(self, data):
+        '''Usage: returnCode = SetDisplayMode(self, data)
+            Input_01 data FLR_BPR_DISPLAY_MODE_E <<FLR_BPR_DISPLAY_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_bpr_SetDisplayMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDisplayMode()
+
+
+    @exception_wrapper
+    def bprGetDisplayModeMinValue(self):
+        '''Usage: returnCode, data = GetDisplayModeMinValue(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_bpr_GetDisplayModeMinValue()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDisplayModeMinValue()
+
+
+    @exception_wrapper
+    def bprSetDisplayModeMinValue(self, data):
+        '''Usage: returnCode = SetDisplayModeMinValue(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_bpr_SetDisplayModeMinValue(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDisplayModeMinValue()
+
+
+    @exception_wrapper
+    def bprGetDisplayModeMaxValue(self):
+        '''Usage: returnCode, data = GetDisplayModeMaxValue(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_bpr_GetDisplayModeMaxValue()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDisplayModeMaxValue()
+
+
+    @exception_wrapper
+    def bprSetDisplayModeMaxValue(self, data):
+        '''Usage: returnCode = SetDisplayModeMaxValue(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_bpr_SetDisplayModeMaxValue(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDisplayModeMaxValue()
+
+
+    @exception_wrapper
+    def bprGetWorkBufIndex(self):
+        '''Usage: returnCode, data = GetWorkBufIndex(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_bpr_GetWorkBufIndex()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetWorkBufIndex()
+
+
+    @exception_wrapper
+    def bprSetWorkBufIndex(self, data):
+        '''Usage: returnCode = SetWorkBufIndex(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_bpr_SetWorkBufIndex(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetWorkBufIndex()
+
+
+    @exception_wrapper
+    def bprGetWorkBufStats(self):
+        '''Usage: returnCode, threeby, fiveby, rows, budget, used = GetWorkBufStats(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 threeby <class 'int'> <<UINT_32>>
+            Output_02 fiveby <class 'int'> <<UINT_32>>
+            Output_03 rows <class 'int'> <<UINT_32>>
+            Output_04 budget <class 'int'> <<UINT_32>>
+            Output_05 used <class 'int'> <<UINT_32>>
+        '''
+        returnCode, threeby, fiveby, rows, budget, used = self.CLIENT_pkg_bpr_GetWorkBufStats()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None, None)
+        
+        return ( returnCode, threeby, fiveby, rows, budget, used)
+    # End of GetWorkBufStats()
@@ -0,0 +1,85 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: capture, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def captureSingleFrame(self):
+        '''Usage: returnCode = SingleFrame(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_capture_SingleFrame()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SingleFrame()
+
+
+    @exception_wrapper
+    def captureFrames(self, data):
+        '''Usage: returnCode = Frames(self, data)
+            Input_01 data FLR_CAPTURE_SETTINGS_T <<FLR_CAPTURE_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_capture_Frames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Frames()
+
+
+    @exception_wrapper
+    def captureSingleFrameWithSrc(self, data):
+        '''Usage: returnCode = SingleFrameWithSrc(self, data)
+            Input_01 data FLR_CAPTURE_SRC_E <<FLR_CAPTURE_SRC_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_capture_SingleFrameWithSrc(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SingleFrameWithSrc()
+
+
+    @exception_wrapper
+    def captureSingleFrameToFile(self):
+        '''Usage: returnCode = SingleFrameToFile(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_capture_SingleFrameToFile()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SingleFrameToFile()
+
+
+    @exception_wrapper
+    def captureGetStatus(self):
+        '''Usage: returnCode, status = GetStatus(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 status FLR_CAPTURE_STATUS_T <<FLR_CAPTURE_STATUS_T>>
+        '''
+        returnCode, status = self.CLIENT_pkg_capture_GetStatus()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, status)
+    # End of GetStatus()
@@ -0,0 +1,107 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: colorLut, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def colorLutSetControl(self, data):
+        '''Usage: returnCode = SetControl(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_colorLut_SetControl(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetControl()
+
+
+    @exception_wrapper
+    def colorLutGetControl(self):
+        '''Usage: returnCode, data = GetControl(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_colorLut_GetControl()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetControl()
+
+
+    @exception_wrapper
+    def colorLutSetId(self, data):
+        '''Usage: returnCode = SetId(self, data)
+            Input_01 data FLR_COLORLUT_ID_E <<FLR_COLORLUT_ID_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_colorLut_SetId(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetId()
+
+
+    @exception_wrapper
+    def colorLutGetId(self):
+        '''Usage: returnCode, data = GetId(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_COLORLUT_ID_E <<FLR_COLORLUT_ID_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_colorLut_GetId()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetId()
+
+
+    @exception_wrapper
+    def colorLutSetOutlineColor(self, red, green, blue):
+        '''Usage: returnCode = SetOutlineColor(self, red, green, blue)
+            Input_01 red <class 'int'> <<UCHAR>>
+            Input_02 green <class 'int'> <<UCHAR>>
+            Input_03 blue <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_colorLut_SetOutlineColor(red, green, blue)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutlineColor()
+
+
+    @exception_wrapper
+    def colorLutGetOutlineColor(self):
+        '''Usage: returnCode, red, green, blue = GetOutlineColor(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 red <class 'int'> <<UCHAR>>
+            Output_02 green <class 'int'> <<UCHAR>>
+            Output_03 blue <class 'int'> <<UCHAR>>
+        '''
+        returnCode, red, green, blue = self.CLIENT_pkg_colorLut_GetOutlineColor()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, red, green, blue)
+    # End of GetOutlineColor()
@@ -0,0 +1,22 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: dummy, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def dummyBadCommand(self):
+        '''Usage: returnCode = BadCommand(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dummy_BadCommand()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of BadCommand()
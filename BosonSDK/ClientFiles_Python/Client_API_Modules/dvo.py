@@ -0,0 +1,669 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: dvo, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def dvoSetAnalogVideoState(self, analogVideoState):
+        '''Usage: returnCode = SetAnalogVideoState(self, analogVideoState)
+            Input_01 analogVideoState FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetAnalogVideoState(analogVideoState)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAnalogVideoState()
+
+
+    @exception_wrapper
+    def dvoGetAnalogVideoState(self):
+        '''Usage: returnCode, analogVideoState = GetAnalogVideoState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 analogVideoState FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, analogVideoState = self.CLIENT_pkg_dvo_GetAnalogVideoState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, analogVideoState)
+    # End of GetAnalogVideoState()
+
+
+    @exception_wrapper
+    def dvoSetOutputFormat(self, format):
+        '''Usage: returnCode = SetOutputFormat(self, format)
+            Input_01 format FLR_DVO_OUTPUT_FORMAT_E <<FLR_DVO_OUTPUT_FORMAT_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetOutputFormat(format)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutputFormat()
+
+
+    @exception_wrapper
+    def dvoGetOutputFormat(self):
+        '''Usage: returnCode, format = GetOutputFormat(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 format FLR_DVO_OUTPUT_FORMAT_E <<FLR_DVO_OUTPUT_FORMAT_E>>
+        '''
+        returnCode, format = self.CLIENT_pkg_dvo_GetOutputFormat()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, format)
+    # End of GetOutputFormat()
+
+
+    @exception_wrapper
+    def dvoSetOutputYCbCrSettings(self, settings):
+        '''Usage: returnCode = SetOutputYCbCrSettings(self, settings)
+            Input_01 settings FLR_DVO_YCBCR_SETTINGS_T <<FLR_DVO_YCBCR_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetOutputYCbCrSettings(settings)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutputYCbCrSettings()
+
+
+    @exception_wrapper
+    def dvoGetOutputYCbCrSettings(self):
+        '''Usage: returnCode, settings = GetOutputYCbCrSettings(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 settings FLR_DVO_YCBCR_SETTINGS_T <<FLR_DVO_YCBCR_SETTINGS_T>>
+        '''
+        returnCode, settings = self.CLIENT_pkg_dvo_GetOutputYCbCrSettings()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, settings)
+    # End of GetOutputYCbCrSettings()
+
+
+    @exception_wrapper
+    def dvoSetOutputRGBSettings(self, settings):
+        '''Usage: returnCode = SetOutputRGBSettings(self, settings)
+            Input_01 settings FLR_DVO_RGB_SETTINGS_T <<FLR_DVO_RGB_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetOutputRGBSettings(settings)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutputRGBSettings()
+
+
+    @exception_wrapper
+    def dvoGetOutputRGBSettings(self):
+        '''Usage: returnCode, settings = GetOutputRGBSettings(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 settings FLR_DVO_RGB_SETTINGS_T <<FLR_DVO_RGB_SETTINGS_T>>
+        '''
+        returnCode, settings = self.CLIENT_pkg_dvo_GetOutputRGBSettings()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, settings)
+    # End of GetOutputRGBSettings()
+
+
+    @exception_wrapper
+    def dvoApplyCustomSettings(self):
+        '''Usage: returnCode = ApplyCustomSettings(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_ApplyCustomSettings()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of ApplyCustomSettings()
+
+
+    @exception_wrapper
+    def dvoSetDisplayMode(self, displayMode):
+        '''Usage: returnCode = SetDisplayMode(self, displayMode)
+            Input_01 displayMode FLR_DVO_DISPLAY_MODE_E <<FLR_DVO_DISPLAY_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetDisplayMode(displayMode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDisplayMode()
+
+
+    @exception_wrapper
+    def dvoGetDisplayMode(self):
+        '''Usage: returnCode, displayMode = GetDisplayMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 displayMode FLR_DVO_DISPLAY_MODE_E <<FLR_DVO_DISPLAY_MODE_E>>
+        '''
+        returnCode, displayMode = self.CLIENT_pkg_dvo_GetDisplayMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, displayMode)
+    # End of GetDisplayMode()
+
+
+    @exception_wrapper
+    def dvoSetType(self, tap):
+        '''Usage: returnCode = SetType(self, tap)
+            Input_01 tap FLR_DVO_TYPE_E <<FLR_DVO_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetType(tap)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetType()
+
+
+    @exception_wrapper
+    def dvoGetType(self):
+        '''Usage: returnCode, tap = GetType(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 tap FLR_DVO_TYPE_E <<FLR_DVO_TYPE_E>>
+        '''
+        returnCode, tap = self.CLIENT_pkg_dvo_GetType()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, tap)
+    # End of GetType()
+
+
+    @exception_wrapper
+    def dvoSetVideoStandard(self, videoStandard):
+        '''Usage: returnCode = SetVideoStandard(self, videoStandard)
+            Input_01 videoStandard FLR_DVO_VIDEO_STANDARD_E <<FLR_DVO_VIDEO_STANDARD_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetVideoStandard(videoStandard)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetVideoStandard()
+
+
+    @exception_wrapper
+    def dvoGetVideoStandard(self):
+        '''Usage: returnCode, videoStandard = GetVideoStandard(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 videoStandard FLR_DVO_VIDEO_STANDARD_E <<FLR_DVO_VIDEO_STANDARD_E>>
+        '''
+        returnCode, videoStandard = self.CLIENT_pkg_dvo_GetVideoStandard()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, videoStandard)
+    # End of GetVideoStandard()
+
+
+    @exception_wrapper
+    def dvoSetCheckVideoDacPresent(self, checkVideoDacPresent):
+        '''Usage: returnCode = SetCheckVideoDacPresent(self, checkVideoDacPresent)
+            Input_01 checkVideoDacPresent FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetCheckVideoDacPresent(checkVideoDacPresent)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetCheckVideoDacPresent()
+
+
+    @exception_wrapper
+    def dvoGetCheckVideoDacPresent(self):
+        '''Usage: returnCode, checkVideoDacPresent = GetCheckVideoDacPresent(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 checkVideoDacPresent FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, checkVideoDacPresent = self.CLIENT_pkg_dvo_GetCheckVideoDacPresent()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, checkVideoDacPresent)
+    # End of GetCheckVideoDacPresent()
+
+
+    @exception_wrapper
+    def dvoSetCustomLcdConfig(self, id, config):
+        '''Usage: returnCode = SetCustomLcdConfig(self, id, config)
+            Input_01 id FLR_DVO_LCD_CONFIG_ID_E <<FLR_DVO_LCD_CONFIG_ID_E>>
+            Input_02 config FLR_DVO_LCD_CONFIG_T <<FLR_DVO_LCD_CONFIG_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetCustomLcdConfig(id, config)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetCustomLcdConfig()
+
+
+    @exception_wrapper
+    def dvoGetCustomLcdConfig(self, id):
+        '''Usage: returnCode, config = GetCustomLcdConfig(self, id)
+            Input_01 id FLR_DVO_LCD_CONFIG_ID_E <<FLR_DVO_LCD_CONFIG_ID_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 config FLR_DVO_LCD_CONFIG_T <<FLR_DVO_LCD_CONFIG_T>>
+        '''
+        returnCode, config = self.CLIENT_pkg_dvo_GetCustomLcdConfig(id)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, config)
+    # End of GetCustomLcdConfig()
+
+
+    @exception_wrapper
+    def dvoSetLCDConfig(self, id):
+        '''Usage: returnCode = SetLCDConfig(self, id)
+            Input_01 id FLR_DVO_LCD_CONFIG_ID_E <<FLR_DVO_LCD_CONFIG_ID_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetLCDConfig(id)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLCDConfig()
+
+
+    @exception_wrapper
+    def dvoGetLCDConfig(self):
+        '''Usage: returnCode, id = GetLCDConfig(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 id FLR_DVO_LCD_CONFIG_ID_E <<FLR_DVO_LCD_CONFIG_ID_E>>
+        '''
+        returnCode, id = self.CLIENT_pkg_dvo_GetLCDConfig()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, id)
+    # End of GetLCDConfig()
+
+
+    @exception_wrapper
+    def dvoGetClockInfo(self):
+        '''Usage: returnCode, horizontalSyncWidth, verticalSyncWidth, clocksPerRowPeriod, horizontalFrontPorch, horizontalBackPorch, frontTelemetryPixels, rearTelemetryPixels, videoColumns, validColumns, telemetryRows, videoRows, validRows, verticalFrontPorch, verticalBackPorch, rowPeriodsPerFrame, clocksPerFrame, clockRateInMHz, frameRateInHz, validOnRisingEdge, dataWidthInBits = GetClockInfo(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 horizontalSyncWidth <class 'int'> <<UINT_32>>
+            Output_02 verticalSyncWidth <class 'int'> <<UINT_32>>
+            Output_03 clocksPerRowPeriod <class 'int'> <<UINT_32>>
+            Output_04 horizontalFrontPorch <class 'int'> <<UINT_32>>
+            Output_05 horizontalBackPorch <class 'int'> <<UINT_32>>
+            Output_06 frontTelemetryPixels <class 'int'> <<UINT_32>>
+            Output_07 rearTelemetryPixels <class 'int'> <<UINT_32>>
+            Output_08 videoColumns <class 'int'> <<UINT_32>>
+            Output_09 validColumns <class 'int'> <<UINT_32>>
+            Output_10 telemetryRows <class 'int'> <<UINT_32>>
+            Output_11 videoRows <class 'int'> <<UINT_32>>
+            Output_12 validRows <class 'int'> <<UINT_32>>
+            Output_13 verticalFrontPorch <class 'int'> <<UINT_32>>
+            Output_14 verticalBackPorch <class 'int'> <<UINT_32>>
+            Output_15 rowPeriodsPerFrame <class 'int'> <<UINT_32>>
+            Output_16 clocksPerFrame <class 'int'> <<UINT_32>>
+            Output_17 clockRateInMHz <class 'float'> <<FLOAT>>
+            Output_18 frameRateInHz <class 'float'> <<FLOAT>>
+            Output_19 validOnRisingEdge <class 'int'> <<UINT_32>>
+            Output_20 dataWidthInBits <class 'int'> <<UINT_32>>
+        '''
+        returnCode, horizontalSyncWidth, verticalSyncWidth, clocksPerRowPeriod, horizontalFrontPorch, horizontalBackPorch, frontTelemetryPixels, rearTelemetryPixels, videoColumns, validColumns, telemetryRows, videoRows, validRows, verticalFrontPorch, verticalBackPorch, rowPeriodsPerFrame, clocksPerFrame, clockRateInMHz, frameRateInHz, validOnRisingEdge, dataWidthInBits = self.CLIENT_pkg_dvo_GetClockInfo()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None)
+        
+        return ( returnCode, horizontalSyncWidth, verticalSyncWidth, clocksPerRowPeriod, horizontalFrontPorch, horizontalBackPorch, frontTelemetryPixels, rearTelemetryPixels, videoColumns, validColumns, telemetryRows, videoRows, validRows, verticalFrontPorch, verticalBackPorch, rowPeriodsPerFrame, clocksPerFrame, clockRateInMHz, frameRateInHz, validOnRisingEdge, dataWidthInBits)
+    # End of GetClockInfo()
+
+
+    @exception_wrapper
+    def dvoSetAllCustomLcdConfigs(self, config0, config1):
+        '''Usage: returnCode = SetAllCustomLcdConfigs(self, config0, config1)
+            Input_01 config0 FLR_DVO_LCD_CONFIG_T <<FLR_DVO_LCD_CONFIG_T>>
+            Input_02 config1 FLR_DVO_LCD_CONFIG_T <<FLR_DVO_LCD_CONFIG_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetAllCustomLcdConfigs(config0, config1)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAllCustomLcdConfigs()
+
+
+    @exception_wrapper
+    def dvoGetAllCustomLcdConfigs(self):
+        '''Usage: returnCode, config0, config1 = GetAllCustomLcdConfigs(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 config0 FLR_DVO_LCD_CONFIG_T <<FLR_DVO_LCD_CONFIG_T>>
+            Output_02 config1 FLR_DVO_LCD_CONFIG_T <<FLR_DVO_LCD_CONFIG_T>>
+        '''
+        returnCode, config0, config1 = self.CLIENT_pkg_dvo_GetAllCustomLcdConfigs()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, config0, config1)
+    # End of GetAllCustomLcdConfigs()
+
+
+    @exception_wrapper
+    def dvoSetOutputIr16Format(self, format):
+        '''Usage: returnCode = SetOutputIr16Format(self, format)
+            Input_01 format FLR_DVO_OUTPUT_IR16_FORMAT_E <<FLR_DVO_OUTPUT_IR16_FORMAT_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetOutputIr16Format(format)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutputIr16Format()
+
+
+    @exception_wrapper
+    def dvoGetOutputIr16Format(self):
+        '''Usage: returnCode, format = GetOutputIr16Format(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 format FLR_DVO_OUTPUT_IR16_FORMAT_E <<FLR_DVO_OUTPUT_IR16_FORMAT_E>>
+        '''
+        returnCode, format = self.CLIENT_pkg_dvo_GetOutputIr16Format()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, format)
+    # End of GetOutputIr16Format()
+
+
+    @exception_wrapper
+    def dvoSetLcdClockRate(self, clockRate):
+        '''Usage: returnCode = SetLcdClockRate(self, clockRate)
+            Input_01 clockRate FLR_DVO_LCD_CLOCK_RATE_E <<FLR_DVO_LCD_CLOCK_RATE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetLcdClockRate(clockRate)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLcdClockRate()
+
+
+    @exception_wrapper
+    def dvoGetLcdClockRate(self):
+        '''Usage: returnCode, clockRate = GetLcdClockRate(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 clockRate FLR_DVO_LCD_CLOCK_RATE_E <<FLR_DVO_LCD_CLOCK_RATE_E>>
+        '''
+        returnCode, clockRate = self.CLIENT_pkg_dvo_GetLcdClockRate()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, clockRate)
+    # End of GetLcdClockRate()
+
+
+    @exception_wrapper
+    def dvoSetLcdVideoFrameRate(self, framerate):
+        '''Usage: returnCode = SetLcdVideoFrameRate(self, framerate)
+            Input_01 framerate <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetLcdVideoFrameRate(framerate)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLcdVideoFrameRate()
+
+
+    @exception_wrapper
+    def dvoGetLcdVideoFrameRate(self):
+        '''Usage: returnCode, framerate = GetLcdVideoFrameRate(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 framerate <class 'int'> <<UINT_32>>
+        '''
+        returnCode, framerate = self.CLIENT_pkg_dvo_GetLcdVideoFrameRate()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, framerate)
+    # End of GetLcdVideoFrameRate()
+
+
+    @exception_wrapper
+    def dvoSetMipiStartState(self, state):
+        '''Usage: returnCode = SetMipiStartState(self, state)
+            Input_01 state FLR_DVO_MIPI_STATE_E <<FLR_DVO_MIPI_STATE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetMipiStartState(state)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMipiStartState()
+
+
+    @exception_wrapper
+    def dvoGetMipiStartState(self):
+        '''Usage: returnCode, state = GetMipiStartState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 state FLR_DVO_MIPI_STATE_E <<FLR_DVO_MIPI_STATE_E>>
+        '''
+        returnCode, state = self.CLIENT_pkg_dvo_GetMipiStartState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, state)
+    # End of GetMipiStartState()
+
+
+    @exception_wrapper
+    def dvoSetMipiState(self, state):
+        '''Usage: returnCode = SetMipiState(self, state)
+            Input_01 state FLR_DVO_MIPI_STATE_E <<FLR_DVO_MIPI_STATE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetMipiState(state)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMipiState()
+
+
+    @exception_wrapper
+    def dvoGetMipiState(self):
+        '''Usage: returnCode, state = GetMipiState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 state FLR_DVO_MIPI_STATE_E <<FLR_DVO_MIPI_STATE_E>>
+        '''
+        returnCode, state = self.CLIENT_pkg_dvo_GetMipiState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, state)
+    # End of GetMipiState()
+
+
+    @exception_wrapper
+    def dvoSetMipiClockLaneMode(self, mode):
+        '''Usage: returnCode = SetMipiClockLaneMode(self, mode)
+            Input_01 mode FLR_DVO_MIPI_CLOCK_LANE_MODE_E <<FLR_DVO_MIPI_CLOCK_LANE_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetMipiClockLaneMode(mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMipiClockLaneMode()
+
+
+    @exception_wrapper
+    def dvoGetMipiClockLaneMode(self):
+        '''Usage: returnCode, mode = GetMipiClockLaneMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mode FLR_DVO_MIPI_CLOCK_LANE_MODE_E <<FLR_DVO_MIPI_CLOCK_LANE_MODE_E>>
+        '''
+        returnCode, mode = self.CLIENT_pkg_dvo_GetMipiClockLaneMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, mode)
+    # End of GetMipiClockLaneMode()
+
+
+    @exception_wrapper
+    def dvoSetOutputInterface(self, format):
+        '''Usage: returnCode = SetOutputInterface(self, format)
+            Input_01 format FLR_DVO_OUTPUT_INTERFACE_E <<FLR_DVO_OUTPUT_INTERFACE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetOutputInterface(format)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutputInterface()
+
+
+    @exception_wrapper
+    def dvoGetOutputInterface(self):
+        '''Usage: returnCode, format = GetOutputInterface(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 format FLR_DVO_OUTPUT_INTERFACE_E <<FLR_DVO_OUTPUT_INTERFACE_E>>
+        '''
+        returnCode, format = self.CLIENT_pkg_dvo_GetOutputInterface()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, format)
+    # End of GetOutputInterface()
+
+
+    @exception_wrapper
+    def dvoSetOutputFormatVC1(self, format):
+        '''Usage: returnCode = SetOutputFormatVC1(self, format)
+            Input_01 format FLR_DVO_OUTPUT_FORMAT_E <<FLR_DVO_OUTPUT_FORMAT_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvo_SetOutputFormatVC1(format)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOutputFormatVC1()
+
+
+    @exception_wrapper
+    def dvoGetOutputFormatVC1(self):
+        '''Usage: returnCode, format = GetOutputFormatVC1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 format FLR_DVO_OUTPUT_FORMAT_E <<FLR_DVO_OUTPUT_FORMAT_E>>
+        '''
+        returnCode, format = self.CLIENT_pkg_dvo_GetOutputFormatVC1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, format)
+    # End of GetOutputFormatVC1()
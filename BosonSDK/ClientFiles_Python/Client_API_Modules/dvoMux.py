@@ -0,0 +1,43 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: dvoMux, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def dvoMuxSetType(self, output, source, type):
+        '''Usage: returnCode = SetType(self, output, source, type)
+            Input_01 output FLR_DVOMUX_OUTPUT_IF_E <<FLR_DVOMUX_OUTPUT_IF_E>>
+            Input_02 source FLR_DVOMUX_SOURCE_E <<FLR_DVOMUX_SOURCE_E>>
+            Input_03 type FLR_DVOMUX_TYPE_E <<FLR_DVOMUX_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_dvoMux_SetType(output, source, type)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetType()
+
+
+    @exception_wrapper
+    def dvoMuxGetType(self, output):
+        '''Usage: returnCode, source, type = GetType(self, output)
+            Input_01 output FLR_DVOMUX_OUTPUT_IF_E <<FLR_DVOMUX_OUTPUT_IF_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 source FLR_DVOMUX_SOURCE_E <<FLR_DVOMUX_SOURCE_E>>
+            Output_02 type FLR_DVOMUX_TYPE_E <<FLR_DVOMUX_TYPE_E>>
+        '''
+        returnCode, source, type = self.CLIENT_pkg_dvoMux_GetType(output)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, source, type)
+    # End of GetType()
@@ -0,0 +1,246 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: fileOps, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def fileOpsDir(self):
+        '''Usage: returnCode, dirent = Dir(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 dirent[<class 'int'>] 128 <<UCHAR*128>>
+        '''
+        returnCode, dirent = self.CLIENT_pkg_fileOps_Dir()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, dirent)
+    # End of Dir()
+
+
+    @exception_wrapper
+    def fileOpsCd(self, path):
+        '''Usage: returnCode, pwd = Cd(self, path)
+            Input_01 path[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 pwd[<class 'int'>] 128 <<UCHAR*128>>
+        '''
+        returnCode, pwd = self.CLIENT_pkg_fileOps_Cd(path)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, pwd)
+    # End of Cd()
+
+
+    @exception_wrapper
+    def fileOpsMd(self, path):
+        '''Usage: returnCode = Md(self, path)
+            Input_01 path[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Md(path)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Md()
+
+
+    @exception_wrapper
+    def fileOpsFopen(self, path, mode):
+        '''Usage: returnCode, id = Fopen(self, path, mode)
+            Input_01 path[<class 'int'>] 128 <<UCHAR*128>>
+            Input_02 mode[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 id <class 'int'> <<UINT_32>>
+        '''
+        returnCode, id = self.CLIENT_pkg_fileOps_Fopen(path, mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, id)
+    # End of Fopen()
+
+
+    @exception_wrapper
+    def fileOpsFclose(self, id):
+        '''Usage: returnCode = Fclose(self, id)
+            Input_01 id <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Fclose(id)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Fclose()
+
+
+    @exception_wrapper
+    def fileOpsFread(self, id, length):
+        '''Usage: returnCode, buf, ret = Fread(self, id, length)
+            Input_01 id <class 'int'> <<UINT_32>>
+            Input_02 length <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 buf[<class 'int'>] 128 <<UCHAR*128>>
+            Output_02 ret <class 'int'> <<UINT_32>>
+        '''
+        returnCode, buf, ret = self.CLIENT_pkg_fileOps_Fread(id, length)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, buf, ret)
+    # End of Fread()
+
+
+    @exception_wrapper
+    def fileOpsFwrite(self, id, length, buf):
+        '''Usage: returnCode, ret = Fwrite(self, id, length, buf)
+            Input_01 id <class 'int'> <<UINT_32>>
+            Input_02 length <class 'int'> <<UINT_32>>
+            Input_03 buf[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 ret <class 'int'> <<UINT_32>>
+        '''
+        returnCode, ret = self.CLIENT_pkg_fileOps_Fwrite(id, length, buf)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, ret)
+    # End of Fwrite()
+
+
+    @exception_wrapper
+    def fileOpsFtell(self, id):
+        '''Usage: returnCode, offset = Ftell(self, id)
+            Input_01 id <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 offset <class 'int'> <<UINT_32>>
+        '''
+        returnCode, offset = self.CLIENT_pkg_fileOps_Ftell(id)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, offset)
+    # End of Ftell()
+
+
+    @exception_wrapper
+    def fileOpsFseek(self, id, offset, origin):
+        '''Usage: returnCode = Fseek(self, id, offset, origin)
+            Input_01 id <class 'int'> <<UINT_32>>
+            Input_02 offset <class 'int'> <<UINT_32>>
+            Input_03 origin <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Fseek(id, offset, origin)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Fseek()
+
+
+    @exception_wrapper
+    def fileOpsFtruncate(self, id, length):
+        '''Usage: returnCode = Ftruncate(self, id, length)
+            Input_01 id <class 'int'> <<UINT_32>>
+            Input_02 length <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Ftruncate(id, length)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Ftruncate()
+
+
+    @exception_wrapper
+    def fileOpsRmdir(self, path):
+        '''Usage: returnCode = Rmdir(self, path)
+            Input_01 path[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Rmdir(path)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Rmdir()
+
+
+    @exception_wrapper
+    def fileOpsRm(self, path):
+        '''Usage: returnCode = Rm(self, path)
+            Input_01 path[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Rm(path)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Rm()
+
+
+    @exception_wrapper
+    def fileOpsRename(self, oldpath, newpath):
+        '''Usage: returnCode = Rename(self, oldpath, newpath)
+            Input_01 oldpath[<class 'int'>] 128 <<UCHAR*128>>
+            Input_02 newpath[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_fileOps_Rename(oldpath, newpath)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Rename()
+
+
+    @exception_wrapper
+    def fileOpsGetFileSize(self, path):
+        '''Usage: returnCode, fileLength = GetFileSize(self, path)
+            Input_01 path[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 fileLength <class 'int'> <<UINT_32>>
+        '''
+        returnCode, fileLength = self.CLIENT_pkg_fileOps_GetFileSize(path)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, fileLength)
+    # End of GetFileSize()
@@ -0,0 +1,39 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: flashIO, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def flashIOSetProtectionState(self, protectionState):
+        '''Usage: returnCode = SetProtectionState(self, protectionState)
+            Input_01 protectionState FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_flashIO_SetProtectionState(protectionState)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetProtectionState()
+
+
+    @exception_wrapper
+    def flashIOGetProtectionState(self):
+        '''Usage: returnCode, protectionState = GetProtectionState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 protectionState FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, protectionState = self.CLIENT_pkg_flashIO_GetProtectionState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, protectionState)
+    # End of GetProtectionState()
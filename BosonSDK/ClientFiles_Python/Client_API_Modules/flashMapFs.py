@@ -0,0 +1,25 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: flashMapFs, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def flashMapFsGetHeaderVersion(self):
+        '''Usage: returnCode, major, minor, patch = GetHeaderVersion(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 major <class 'int'> <<UINT_32>>
+            Output_02 minor <class 'int'> <<UINT_32>>
+            Output_03 patch <class 'int'> <<UINT_32>>
+        '''
+        returnCode, major, minor, patch = self.CLIENT_pkg_flashMapFs_GetHeaderVersion()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, major, minor, patch)
+    # End of GetHeaderVersion()
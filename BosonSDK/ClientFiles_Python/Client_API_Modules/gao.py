@@ -0,0 +1,583 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: gao, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def gaoSetGainState(self, data):
+        '''Usage: returnCode = SetGainState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetGainState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGainState()
+
+
+    @exception_wrapper
+    def gaoGetGainState(self):
+        '''Usage: returnCode, data = GetGainState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetGainState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGainState()
+
+
+    @exception_wrapper
+    def gaoSetFfcState(self, data):
+        '''Usage: returnCode = SetFfcState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetFfcState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcState()
+
+
+    @exception_wrapper
+    def gaoGetFfcState(self):
+        '''Usage: returnCode, data = GetFfcState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetFfcState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcState()
+
+
+    @exception_wrapper
+    def gaoSetTempCorrectionState(self, data):
+        '''Usage: returnCode = SetTempCorrectionState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetTempCorrectionState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempCorrectionState()
+
+
+    @exception_wrapper
+    def gaoGetTempCorrectionState(self):
+        '''Usage: returnCode, data = GetTempCorrectionState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetTempCorrectionState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempCorrectionState()
+
+
+    @exception_wrapper
+    def gaoSetIConstL(self, data):
+        '''Usage: returnCode = SetIConstL(self, data)
+            Input_01 data <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetIConstL(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIConstL()
+
+
+    @exception_wrapper
+    def gaoGetIConstL(self):
+        '''Usage: returnCode, data = GetIConstL(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetIConstL()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetIConstL()
+
+
+    @exception_wrapper
+    def gaoSetIConstM(self, data):
+        '''Usage: returnCode = SetIConstM(self, data)
+            Input_01 data <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetIConstM(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIConstM()
+
+
+    @exception_wrapper
+    def gaoGetIConstM(self):
+        '''Usage: returnCode, data = GetIConstM(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetIConstM()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetIConstM()
+
+
+    @exception_wrapper
+    def gaoSetAveragerState(self, data):
+        '''Usage: returnCode = SetAveragerState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetAveragerState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAveragerState()
+
+
+    @exception_wrapper
+    def gaoGetAveragerState(self):
+        '''Usage: returnCode, data = GetAveragerState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetAveragerState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAveragerState()
+
+
+    @exception_wrapper
+    def gaoSetNumFFCFrames(self, data):
+        '''Usage: returnCode = SetNumFFCFrames(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetNumFFCFrames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNumFFCFrames()
+
+
+    @exception_wrapper
+    def gaoGetNumFFCFrames(self):
+        '''Usage: returnCode, data = GetNumFFCFrames(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetNumFFCFrames()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetNumFFCFrames()
+
+
+    @exception_wrapper
+    def gaoGetAveragerThreshold(self):
+        '''Usage: returnCode, data = GetAveragerThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetAveragerThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAveragerThreshold()
+
+
+    @exception_wrapper
+    def gaoSetTestRampState(self, data):
+        '''Usage: returnCode = SetTestRampState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetTestRampState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTestRampState()
+
+
+    @exception_wrapper
+    def gaoGetTestRampState(self):
+        '''Usage: returnCode, data = GetTestRampState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetTestRampState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTestRampState()
+
+
+    @exception_wrapper
+    def gaoSetSffcState(self, data):
+        '''Usage: returnCode = SetSffcState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetSffcState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSffcState()
+
+
+    @exception_wrapper
+    def gaoGetSffcState(self):
+        '''Usage: returnCode, data = GetSffcState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetSffcState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSffcState()
+
+
+    @exception_wrapper
+    def gaoSetNucType(self, nucType):
+        '''Usage: returnCode = SetNucType(self, nucType)
+            Input_01 nucType FLR_GAO_NUC_TYPE_E <<FLR_GAO_NUC_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetNucType(nucType)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNucType()
+
+
+    @exception_wrapper
+    def gaoGetNucType(self):
+        '''Usage: returnCode, nucType = GetNucType(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 nucType FLR_GAO_NUC_TYPE_E <<FLR_GAO_NUC_TYPE_E>>
+        '''
+        returnCode, nucType = self.CLIENT_pkg_gao_GetNucType()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, nucType)
+    # End of GetNucType()
+
+
+    @exception_wrapper
+    def gaoSetFfcZeroMeanState(self, data):
+        '''Usage: returnCode = SetFfcZeroMeanState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetFfcZeroMeanState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcZeroMeanState()
+
+
+    @exception_wrapper
+    def gaoGetFfcZeroMeanState(self):
+        '''Usage: returnCode, data = GetFfcZeroMeanState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetFfcZeroMeanState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcZeroMeanState()
+
+
+    @exception_wrapper
+    def gaoGetAveragerDesiredState(self):
+        '''Usage: returnCode, data = GetAveragerDesiredState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetAveragerDesiredState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAveragerDesiredState()
+
+
+    @exception_wrapper
+    def gaoGetAppliedClip(self):
+        '''Usage: returnCode, data = GetAppliedClip(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetAppliedClip()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAppliedClip()
+
+
+    @exception_wrapper
+    def gaoSetAppliedClipEnable(self, data):
+        '''Usage: returnCode = SetAppliedClipEnable(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetAppliedClipEnable(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAppliedClipEnable()
+
+
+    @exception_wrapper
+    def gaoGetAppliedClipEnable(self):
+        '''Usage: returnCode, data = GetAppliedClipEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetAppliedClipEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAppliedClipEnable()
+
+
+    @exception_wrapper
+    def gaoSetFfcShutterSimulationState(self, data):
+        '''Usage: returnCode = SetFfcShutterSimulationState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetFfcShutterSimulationState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcShutterSimulationState()
+
+
+    @exception_wrapper
+    def gaoGetFfcShutterSimulationState(self):
+        '''Usage: returnCode, data = GetFfcShutterSimulationState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetFfcShutterSimulationState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcShutterSimulationState()
+
+
+    @exception_wrapper
+    def gaoSetFfcShutterSimulatorValue(self, value):
+        '''Usage: returnCode = SetFfcShutterSimulatorValue(self, value)
+            Input_01 value <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetFfcShutterSimulatorValue(value)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFfcShutterSimulatorValue()
+
+
+    @exception_wrapper
+    def gaoGetFfcShutterSimulatorValue(self):
+        '''Usage: returnCode, value = GetFfcShutterSimulatorValue(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 value <class 'int'> <<UINT_16>>
+        '''
+        returnCode, value = self.CLIENT_pkg_gao_GetFfcShutterSimulatorValue()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, value)
+    # End of GetFfcShutterSimulatorValue()
+
+
+    @exception_wrapper
+    def gaoSetBcnrState(self, data):
+        '''Usage: returnCode = SetBcnrState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetBcnrState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetBcnrState()
+
+
+    @exception_wrapper
+    def gaoGetBcnrState(self):
+        '''Usage: returnCode, data = GetBcnrState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetBcnrState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetBcnrState()
+
+
+    @exception_wrapper
+    def gaoGetAppliedSffcScaleFactor(self):
+        '''Usage: returnCode, data = GetAppliedSffcScaleFactor(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_gao_GetAppliedSffcScaleFactor()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAppliedSffcScaleFactor()
+
+
+    @exception_wrapper
+    def gaoSetSffcMode(self, mode):
+        '''Usage: returnCode = SetSffcMode(self, mode)
+            Input_01 mode FLR_GAO_SFFC_MODE_E <<FLR_GAO_SFFC_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_gao_SetSffcMode(mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSffcMode()
+
+
+    @exception_wrapper
+    def gaoGetSffcMode(self):
+        '''Usage: returnCode, mode = GetSffcMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mode FLR_GAO_SFFC_MODE_E <<FLR_GAO_SFFC_MODE_E>>
+        '''
+        returnCode, mode = self.CLIENT_pkg_gao_GetSffcMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, mode)
+    # End of GetSffcMode()
@@ -0,0 +1,249 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: imageStats, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def imageStatsGetTotalHistPixelsInROI(self):
+        '''Usage: returnCode, totalPixelsInROI = GetTotalHistPixelsInROI(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 totalPixelsInROI <class 'int'> <<UINT_32>>
+        '''
+        returnCode, totalPixelsInROI = self.CLIENT_pkg_imageStats_GetTotalHistPixelsInROI()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, totalPixelsInROI)
+    # End of GetTotalHistPixelsInROI()
+
+
+    @exception_wrapper
+    def imageStatsGetPopBelowLowToHighThresh(self):
+        '''Usage: returnCode, popBelowLowToHighThresh = GetPopBelowLowToHighThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 popBelowLowToHighThresh <class 'int'> <<UINT_32>>
+        '''
+        returnCode, popBelowLowToHighThresh = self.CLIENT_pkg_imageStats_GetPopBelowLowToHighThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, popBelowLowToHighThresh)
+    # End of GetPopBelowLowToHighThresh()
+
+
+    @exception_wrapper
+    def imageStatsGetPopAboveHighToLowThresh(self):
+        '''Usage: returnCode, popAboveHighToLowThresh = GetPopAboveHighToLowThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 popAboveHighToLowThresh <class 'int'> <<UINT_32>>
+        '''
+        returnCode, popAboveHighToLowThresh = self.CLIENT_pkg_imageStats_GetPopAboveHighToLowThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, popAboveHighToLowThresh)
+    # End of GetPopAboveHighToLowThresh()
+
+
+    @exception_wrapper
+    def imageStatsSetROI(self, roi):
+        '''Usage: returnCode = SetROI(self, roi)
+            Input_01 roi FLR_ROI_T <<FLR_ROI_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_imageStats_SetROI(roi)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetROI()
+
+
+    @exception_wrapper
+    def imageStatsGetROI(self):
+        '''Usage: returnCode, roi = GetROI(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 roi FLR_ROI_T <<FLR_ROI_T>>
+        '''
+        returnCode, roi = self.CLIENT_pkg_imageStats_GetROI()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, roi)
+    # End of GetROI()
+
+
+    @exception_wrapper
+    def imageStatsGetFirstBin(self):
+        '''Usage: returnCode, firstBin = GetFirstBin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 firstBin <class 'int'> <<UINT_16>>
+        '''
+        returnCode, firstBin = self.CLIENT_pkg_imageStats_GetFirstBin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, firstBin)
+    # End of GetFirstBin()
+
+
+    @exception_wrapper
+    def imageStatsGetLastBin(self):
+        '''Usage: returnCode, lastBin = GetLastBin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 lastBin <class 'int'> <<UINT_16>>
+        '''
+        returnCode, lastBin = self.CLIENT_pkg_imageStats_GetLastBin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, lastBin)
+    # End of GetLastBin()
+
+
+    @exception_wrapper
+    def imageStatsGetMean(self):
+        '''Usage: returnCode, mean = GetMean(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mean <class 'int'> <<UINT_16>>
+        '''
+        returnCode, mean = self.CLIENT_pkg_imageStats_GetMean()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, mean)
+    # End of GetMean()
+
+
+    @exception_wrapper
+    def imageStatsGetFirstBinInROI(self):
+        '''Usage: returnCode, firstBinInROI = GetFirstBinInROI(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 firstBinInROI <class 'int'> <<UINT_16>>
+        '''
+        returnCode, firstBinInROI = self.CLIENT_pkg_imageStats_GetFirstBinInROI()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, firstBinInROI)
+    # End of GetFirstBinInROI()
+
+
+    @exception_wrapper
+    def imageStatsGetLastBinInROI(self):
+        '''Usage: returnCode, lastBinInROI = GetLastBinInROI(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 lastBinInROI <class 'int'> <<UINT_16>>
+        '''
+        returnCode, lastBinInROI = self.CLIENT_pkg_imageStats_GetLastBinInROI()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, lastBinInROI)
+    # End of GetLastBinInROI()
+
+
+    @exception_wrapper
+    def imageStatsGetMeanInROI(self):
+        '''Usage: returnCode, meanInROI = GetMeanInROI(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 meanInROI <class 'int'> <<UINT_16>>
+        '''
+        returnCode, meanInROI = self.CLIENT_pkg_imageStats_GetMeanInROI()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, meanInROI)
+    # End of GetMeanInROI()
+
+
+    @exception_wrapper
+    def imageStatsGetImageStats(self):
+        '''Usage: returnCode, meanIntensity, peakIntensity, baseIntensity = GetImageStats(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 meanIntensity <class 'int'> <<UINT_16>>
+            Output_02 peakIntensity <class 'int'> <<UINT_16>>
+            Output_03 baseIntensity <class 'int'> <<UINT_16>>
+        '''
+        returnCode, meanIntensity, peakIntensity, baseIntensity = self.CLIENT_pkg_imageStats_GetImageStats()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, meanIntensity, peakIntensity, baseIntensity)
+    # End of GetImageStats()
+
+
+    @exception_wrapper
+    def imageStatsGetPopAboveLowToHighThreshCATS(self):
+        '''Usage: returnCode, popAboveLowToHighThresh = GetPopAboveLowToHighThreshCATS(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 popAboveLowToHighThresh <class 'int'> <<UINT_32>>
+        '''
+        returnCode, popAboveLowToHighThresh = self.CLIENT_pkg_imageStats_GetPopAboveLowToHighThreshCATS()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, popAboveLowToHighThresh)
+    # End of GetPopAboveLowToHighThreshCATS()
+
+
+    @exception_wrapper
+    def imageStatsGetPopBelowHighToLowThreshCATS(self):
+        '''Usage: returnCode, popBelowHighToLowThresh = GetPopBelowHighToLowThreshCATS(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 popBelowHighToLowThresh <class 'int'> <<UINT_32>>
+        '''
+        returnCode, popBelowHighToLowThresh = self.CLIENT_pkg_imageStats_GetPopBelowHighToLowThreshCATS()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, popBelowHighToLowThresh)
+    # End of GetPopBelowHighToLowThreshCATS()
+
+
+    @exception_wrapper
+    def imageStatsGetPopBetweenLthCATSAndLthSATS(self):
+        '''Usage: returnCode, popBetweenCatsAndSats = GetPopBetweenLthCATSAndLthSATS(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 popBetweenCatsAndSats <class 'int'> <<UINT_32>>
+        '''
+        returnCode, popBetweenCatsAndSats = self.CLIENT_pkg_imageStats_GetPopBetweenLthCATSAndLthSATS()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, popBetweenCatsAndSats)
+    # End of GetPopBetweenLthCATSAndLthSATS()
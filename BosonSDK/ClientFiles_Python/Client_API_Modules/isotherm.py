@@ -0,0 +1,299 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: isotherm, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def isothermGetEnable(self):
+        '''Usage: returnCode, isothermEnable = GetEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 isothermEnable FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, isothermEnable = self.CLIENT_pkg_isotherm_GetEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, isothermEnable)
+    # End of GetEnable()
+
+
+    @exception_wrapper
+    def isothermSetEnable(self, isothermEnable):
+        '''Usage: returnCode = SetEnable(self, isothermEnable)
+            Input_01 isothermEnable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetEnable(isothermEnable)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnable()
+
+
+    @exception_wrapper
+    def isothermSetTemps(self, table, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5):
+        '''Usage: returnCode = SetTemps(self, table, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5)
+            Input_01 table FLR_ISOTHERM_GAIN_E <<FLR_ISOTHERM_GAIN_E>>
+            Input_02 thIsoT1 <class 'int'> <<INT_32>>
+            Input_03 thIsoT2 <class 'int'> <<INT_32>>
+            Input_04 thIsoT3 <class 'int'> <<INT_32>>
+            Input_05 thIsoT4 <class 'int'> <<INT_32>>
+            Input_06 thIsoT5 <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetTemps(table, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTemps()
+
+
+    @exception_wrapper
+    def isothermGetTemps(self, table):
+        '''Usage: returnCode, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5 = GetTemps(self, table)
+            Input_01 table FLR_ISOTHERM_GAIN_E <<FLR_ISOTHERM_GAIN_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 thIsoT1 <class 'int'> <<INT_32>>
+            Output_02 thIsoT2 <class 'int'> <<INT_32>>
+            Output_03 thIsoT3 <class 'int'> <<INT_32>>
+            Output_04 thIsoT4 <class 'int'> <<INT_32>>
+            Output_05 thIsoT5 <class 'int'> <<INT_32>>
+        '''
+        returnCode, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5 = self.CLIENT_pkg_isotherm_GetTemps(table)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None, None)
+        
+        return ( returnCode, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5)
+    # End of GetTemps()
+
+
+    @exception_wrapper
+    def isothermSetIsoColorValues(self, table, region0, region1, region2, region3, region4, region5):
+        '''Usage: returnCode = SetIsoColorValues(self, table, region0, region1, region2, region3, region4, region5)
+            Input_01 table FLR_ISOTHERM_GAIN_E <<FLR_ISOTHERM_GAIN_E>>
+            Input_02 region0 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Input_03 region1 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Input_04 region2 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Input_05 region3 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Input_06 region4 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Input_07 region5 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetIsoColorValues(table, region0, region1, region2, region3, region4, region5)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIsoColorValues()
+
+
+    @exception_wrapper
+    def isothermGetIsoColorValues(self, table):
+        '''Usage: returnCode, region0, region1, region2, region3, region4, region5 = GetIsoColorValues(self, table)
+            Input_01 table FLR_ISOTHERM_GAIN_E <<FLR_ISOTHERM_GAIN_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 region0 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Output_02 region1 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Output_03 region2 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Output_04 region3 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Output_05 region4 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+            Output_06 region5 FLR_ISOTHERM_COLORS_T <<FLR_ISOTHERM_COLORS_T>>
+        '''
+        returnCode, region0, region1, region2, region3, region4, region5 = self.CLIENT_pkg_isotherm_GetIsoColorValues(table)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None, None, None)
+        
+        return ( returnCode, region0, region1, region2, region3, region4, region5)
+    # End of GetIsoColorValues()
+
+
+    @exception_wrapper
+    def isothermSetRegionMode(self, table, region0, region1, region2, region3, region4, region5):
+        '''Usage: returnCode = SetRegionMode(self, table, region0, region1, region2, region3, region4, region5)
+            Input_01 table FLR_ISOTHERM_GAIN_E <<FLR_ISOTHERM_GAIN_E>>
+            Input_02 region0 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Input_03 region1 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Input_04 region2 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Input_05 region3 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Input_06 region4 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Input_07 region5 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetRegionMode(table, region0, region1, region2, region3, region4, region5)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRegionMode()
+
+
+    @exception_wrapper
+    def isothermGetRegionMode(self, table):
+        '''Usage: returnCode, region0, region1, region2, region3, region4, region5 = GetRegionMode(self, table)
+            Input_01 table FLR_ISOTHERM_GAIN_E <<FLR_ISOTHERM_GAIN_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 region0 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Output_02 region1 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Output_03 region2 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Output_04 region3 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Output_05 region4 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+            Output_06 region5 FLR_ISOTHERM_REGION_E <<FLR_ISOTHERM_REGION_E>>
+        '''
+        returnCode, region0, region1, region2, region3, region4, region5 = self.CLIENT_pkg_isotherm_GetRegionMode(table)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None, None, None)
+        
+        return ( returnCode, region0, region1, region2, region3, region4, region5)
+    # End of GetRegionMode()
+
+
+    @exception_wrapper
+    def isothermGetUnit(self):
+        '''Usage: returnCode, unit = GetUnit(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 unit FLR_ISOTHERM_UNIT_E <<FLR_ISOTHERM_UNIT_E>>
+        '''
+        returnCode, unit = self.CLIENT_pkg_isotherm_GetUnit()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, unit)
+    # End of GetUnit()
+
+
+    @exception_wrapper
+    def isothermSetUnit(self, unit):
+        '''Usage: returnCode = SetUnit(self, unit)
+            Input_01 unit FLR_ISOTHERM_UNIT_E <<FLR_ISOTHERM_UNIT_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetUnit(unit)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetUnit()
+
+
+    @exception_wrapper
+    def isothermGetSettingsLowGain(self):
+        '''Usage: returnCode, settings = GetSettingsLowGain(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 settings FLR_ISOTHERM_SETTINGS_T <<FLR_ISOTHERM_SETTINGS_T>>
+        '''
+        returnCode, settings = self.CLIENT_pkg_isotherm_GetSettingsLowGain()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, settings)
+    # End of GetSettingsLowGain()
+
+
+    @exception_wrapper
+    def isothermSetSettingsLowGain(self, settings):
+        '''Usage: returnCode = SetSettingsLowGain(self, settings)
+            Input_01 settings FLR_ISOTHERM_SETTINGS_T <<FLR_ISOTHERM_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetSettingsLowGain(settings)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSettingsLowGain()
+
+
+    @exception_wrapper
+    def isothermGetSettingsHighGain(self):
+        '''Usage: returnCode, settings = GetSettingsHighGain(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 settings FLR_ISOTHERM_SETTINGS_T <<FLR_ISOTHERM_SETTINGS_T>>
+        '''
+        returnCode, settings = self.CLIENT_pkg_isotherm_GetSettingsHighGain()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, settings)
+    # End of GetSettingsHighGain()
+
+
+    @exception_wrapper
+    def isothermSetSettingsHighGain(self, settings):
+        '''Usage: returnCode = SetSettingsHighGain(self, settings)
+            Input_01 settings FLR_ISOTHERM_SETTINGS_T <<FLR_ISOTHERM_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetSettingsHighGain(settings)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSettingsHighGain()
+
+
+    @exception_wrapper
+    def isothermSetColorLutId(self, colorLutIdLowGain, colorLutIdHighGain):
+        '''Usage: returnCode = SetColorLutId(self, colorLutIdLowGain, colorLutIdHighGain)
+            Input_01 colorLutIdLowGain FLR_COLORLUT_ID_E <<FLR_COLORLUT_ID_E>>
+            Input_02 colorLutIdHighGain FLR_COLORLUT_ID_E <<FLR_COLORLUT_ID_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_isotherm_SetColorLutId(colorLutIdLowGain, colorLutIdHighGain)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetColorLutId()
+
+
+    @exception_wrapper
+    def isothermGetColorLutId(self):
+        '''Usage: returnCode, colorLutIdLowGain, colorLutIdHighGain = GetColorLutId(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 colorLutIdLowGain FLR_COLORLUT_ID_E <<FLR_COLORLUT_ID_E>>
+            Output_02 colorLutIdHighGain FLR_COLORLUT_ID_E <<FLR_COLORLUT_ID_E>>
+        '''
+        returnCode, colorLutIdLowGain, colorLutIdHighGain = self.CLIENT_pkg_isotherm_GetColorLutId()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, colorLutIdLowGain, colorLutIdHighGain)
+    # End of GetColorLutId()
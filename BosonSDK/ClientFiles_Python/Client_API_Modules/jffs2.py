@@ -0,0 +1,53 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: jffs2, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def jffs2Mount(self):
+        '''Usage: returnCode = Mount(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_jffs2_Mount()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Mount()
+
+
+    @exception_wrapper
+    def jffs2Unmount(self):
+        '''Usage: returnCode = Unmount(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_jffs2_Unmount()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Unmount()
+
+
+    @exception_wrapper
+    def jffs2GetState(self):
+        '''Usage: returnCode, state = GetState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 state FLR_JFFS2_STATE_E <<FLR_JFFS2_STATE_E>>
+        '''
+        returnCode, state = self.CLIENT_pkg_jffs2_GetState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, state)
+    # End of GetState()
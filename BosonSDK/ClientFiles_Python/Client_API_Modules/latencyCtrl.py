@@ -0,0 +1,154 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: latencyCtrl, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def latencyCtrlSetLowLatencyState(self, data):
+        '''Usage: returnCode = SetLowLatencyState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_latencyCtrl_SetLowLatencyState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLowLatencyState()
+
+
+    @exception_wrapper
+    def latencyCtrlGetLowLatencyState(self):
+        '''Usage: returnCode, data = GetLowLatencyState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_latencyCtrl_GetLowLatencyState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetLowLatencyState()
+
+
+    @exception_wrapper
+    def latencyCtrlSetJitterReduction(self, enable, line):
+        '''Usage: returnCode = SetJitterReduction(self, enable, line)
+            Input_01 enable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Input_02 line <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_latencyCtrl_SetJitterReduction(enable, line)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetJitterReduction()
+
+
+    @exception_wrapper
+    def latencyCtrlGetJitterReduction(self):
+        '''Usage: returnCode, enable, line = GetJitterReduction(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 enable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_02 line <class 'int'> <<INT_32>>
+        '''
+        returnCode, enable, line = self.CLIENT_pkg_latencyCtrl_GetJitterReduction()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, enable, line)
+    # End of GetJitterReduction()
+
+
+    @exception_wrapper
+    def latencyCtrlLatencyResetStats(self):
+        '''Usage: returnCode = LatencyResetStats(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_latencyCtrl_LatencyResetStats()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of LatencyResetStats()
+
+
+    @exception_wrapper
+    def latencyCtrlGetJitter(self):
+        '''Usage: returnCode, jitterMin, jitterMax = GetJitter(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 jitterMin <class 'float'> <<FLOAT>>
+            Output_02 jitterMax <class 'float'> <<FLOAT>>
+        '''
+        returnCode, jitterMin, jitterMax = self.CLIENT_pkg_latencyCtrl_GetJitter()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, jitterMin, jitterMax)
+    # End of GetJitter()
+
+
+    @exception_wrapper
+    def latencyCtrlGetLatency(self):
+        '''Usage: returnCode, latencyMin, latencyMax = GetLatency(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 latencyMin <class 'float'> <<FLOAT>>
+            Output_02 latencyMax <class 'float'> <<FLOAT>>
+        '''
+        returnCode, latencyMin, latencyMax = self.CLIENT_pkg_latencyCtrl_GetLatency()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, latencyMin, latencyMax)
+    # End of GetLatency()
+
+
+    @exception_wrapper
+    def latencyCtrlSetUsbVideoLatencyReduction(self, line):
+        '''Usage: returnCode = SetUsbVideoLatencyReduction(self, line)
+            Input_01 line <class 'int'> <<INT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_latencyCtrl_SetUsbVideoLatencyReduction(line)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetUsbVideoLatencyReduction()
+
+
+    @exception_wrapper
+    def latencyCtrlGetUsbVideoLatencyReduction(self):
+        '''Usage: returnCode, line = GetUsbVideoLatencyReduction(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 line <class 'int'> <<INT_32>>
+        '''
+        returnCode, line = self.CLIENT_pkg_latencyCtrl_GetUsbVideoLatencyReduction()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, line)
+    # End of GetUsbVideoLatencyReduction()
@@ -0,0 +1,391 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: lfsr, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def lfsrSetApplyOffsetEnableState(self, data):
+        '''Usage: returnCode = SetApplyOffsetEnableState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetApplyOffsetEnableState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetApplyOffsetEnableState()
+
+
+    @exception_wrapper
+    def lfsrGetApplyOffsetEnableState(self):
+        '''Usage: returnCode, data = GetApplyOffsetEnableState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetApplyOffsetEnableState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetApplyOffsetEnableState()
+
+
+    @exception_wrapper
+    def lfsrSetMaxIterations(self, data):
+        '''Usage: returnCode = SetMaxIterations(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetMaxIterations(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxIterations()
+
+
+    @exception_wrapper
+    def lfsrGetMaxIterations(self):
+        '''Usage: returnCode, data = GetMaxIterations(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetMaxIterations()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxIterations()
+
+
+    @exception_wrapper
+    def lfsrSetDf(self, data):
+        '''Usage: returnCode = SetDf(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetDf(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDf()
+
+
+    @exception_wrapper
+    def lfsrGetDf(self):
+        '''Usage: returnCode, data = GetDf(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetDf()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDf()
+
+
+    @exception_wrapper
+    def lfsrSetLambda1(self, data):
+        '''Usage: returnCode = SetLambda1(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetLambda1(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLambda1()
+
+
+    @exception_wrapper
+    def lfsrGetLambda1(self):
+        '''Usage: returnCode, data = GetLambda1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetLambda1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetLambda1()
+
+
+    @exception_wrapper
+    def lfsrSetLambda2(self, data):
+        '''Usage: returnCode = SetLambda2(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetLambda2(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLambda2()
+
+
+    @exception_wrapper
+    def lfsrGetLambda2(self):
+        '''Usage: returnCode, data = GetLambda2(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetLambda2()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetLambda2()
+
+
+    @exception_wrapper
+    def lfsrSetHaltEnable(self, data):
+        '''Usage: returnCode = SetHaltEnable(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetHaltEnable(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetHaltEnable()
+
+
+    @exception_wrapper
+    def lfsrGetHaltEnable(self):
+        '''Usage: returnCode, data = GetHaltEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetHaltEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetHaltEnable()
+
+
+    @exception_wrapper
+    def lfsrSetRandomMethod(self, data):
+        '''Usage: returnCode = SetRandomMethod(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetRandomMethod(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRandomMethod()
+
+
+    @exception_wrapper
+    def lfsrGetRandomMethod(self):
+        '''Usage: returnCode, data = GetRandomMethod(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetRandomMethod()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRandomMethod()
+
+
+    @exception_wrapper
+    def lfsrSetSingleStepEnable(self, data):
+        '''Usage: returnCode = SetSingleStepEnable(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetSingleStepEnable(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSingleStepEnable()
+
+
+    @exception_wrapper
+    def lfsrGetSingleStepEnable(self):
+        '''Usage: returnCode, data = GetSingleStepEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetSingleStepEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSingleStepEnable()
+
+
+    @exception_wrapper
+    def lfsrSetR_LocalBump(self, data):
+        '''Usage: returnCode = SetR_LocalBump(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetR_LocalBump(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetR_LocalBump()
+
+
+    @exception_wrapper
+    def lfsrGetR_LocalBump(self):
+        '''Usage: returnCode, data = GetR_LocalBump(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetR_LocalBump()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetR_LocalBump()
+
+
+    @exception_wrapper
+    def lfsrSetR_CornerBump(self, data):
+        '''Usage: returnCode = SetR_CornerBump(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetR_CornerBump(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetR_CornerBump()
+
+
+    @exception_wrapper
+    def lfsrGetR_CornerBump(self):
+        '''Usage: returnCode, data = GetR_CornerBump(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetR_CornerBump()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetR_CornerBump()
+
+
+    @exception_wrapper
+    def lfsrSetFFC_ResetEnable(self, data):
+        '''Usage: returnCode = SetFFC_ResetEnable(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetFFC_ResetEnable(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFFC_ResetEnable()
+
+
+    @exception_wrapper
+    def lfsrGetFFC_ResetEnable(self):
+        '''Usage: returnCode, data = GetFFC_ResetEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetFFC_ResetEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFFC_ResetEnable()
+
+
+    @exception_wrapper
+    def lfsrSetNormalizeAtCenterSpotState(self, data):
+        '''Usage: returnCode = SetNormalizeAtCenterSpotState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_lfsr_SetNormalizeAtCenterSpotState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNormalizeAtCenterSpotState()
+
+
+    @exception_wrapper
+    def lfsrGetNormalizeAtCenterSpotState(self):
+        '''Usage: returnCode, data = GetNormalizeAtCenterSpotState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_lfsr_GetNormalizeAtCenterSpotState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetNormalizeAtCenterSpotState()
@@ -0,0 +1,222 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: mem, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def memReadCapture(self, bufferNum, offset, sizeInBytes):
+        '''Usage: returnCode, data = ReadCapture(self, bufferNum, offset, sizeInBytes)
+            Input_01 bufferNum <class 'int'> <<UCHAR>>
+            Input_02 offset <class 'int'> <<UINT_32>>
+            Input_03 sizeInBytes <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'bytearray'> <<BYTEARRAY>>
+        '''
+        if(sizeInBytes > MaxMemoryChunk):
+            return FLR_RESULT.FLR_DATA_SIZE_ERROR, None
+        returnCode, data = self.CLIENT_pkg_mem_ReadCapture(bufferNum, offset, sizeInBytes)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of ReadCapture()
+
+
+    @exception_wrapper
+    def memGetCaptureSize(self):
+        '''Usage: returnCode, bytes, rows, columns = GetCaptureSize(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 bytes <class 'int'> <<UINT_32>>
+            Output_02 rows <class 'int'> <<UINT_16>>
+            Output_03 columns <class 'int'> <<UINT_16>>
+        '''
+        returnCode, bytes, rows, columns = self.CLIENT_pkg_mem_GetCaptureSize()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, bytes, rows, columns)
+    # End of GetCaptureSize()
+
+
+    @exception_wrapper
+    def memWriteFlash(self, location, index, offset, sizeInBytes, data):
+        '''Usage: returnCode = WriteFlash(self, location, index, offset, sizeInBytes, data)
+            Input_01 location FLR_MEM_LOCATION_E <<FLR_MEM_LOCATION_E>>
+            Input_02 index <class 'int'> <<UCHAR>>
+            Input_03 offset <class 'int'> <<UINT_32>>
+            Input_04 sizeInBytes <class 'int'> <<UINT_16>>
+            Input_05 data <class 'bytearray'> <<BYTEARRAY>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        if(sizeInBytes > MaxMemoryChunk):
+            return FLR_RESULT.FLR_DATA_SIZE_ERROR
+        returnCode = self.CLIENT_pkg_mem_WriteFlash(location, index, offset, sizeInBytes, data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of WriteFlash()
+
+
+    @exception_wrapper
+    def memReadFlash(self, location, index, offset, sizeInBytes):
+        '''Usage: returnCode, data = ReadFlash(self, location, index, offset, sizeInBytes)
+            Input_01 location FLR_MEM_LOCATION_E <<FLR_MEM_LOCATION_E>>
+            Input_02 index <class 'int'> <<UCHAR>>
+            Input_03 offset <class 'int'> <<UINT_32>>
+            Input_04 sizeInBytes <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'bytearray'> <<BYTEARRAY>>
+        '''
+        if(sizeInBytes > MaxMemoryChunk):
+            return FLR_RESULT.FLR_DATA_SIZE_ERROR, None
+        returnCode, data = self.CLIENT_pkg_mem_ReadFlash(location, index, offset, sizeInBytes)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of ReadFlash()
+
+
+    @exception_wrapper
+    def memGetFlashSize(self, location):
+        '''Usage: returnCode, bytes = GetFlashSize(self, location)
+            Input_01 location FLR_MEM_LOCATION_E <<FLR_MEM_LOCATION_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 bytes <class 'int'> <<UINT_32>>
+        '''
+        returnCode, bytes = self.CLIENT_pkg_mem_GetFlashSize(location)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, bytes)
+    # End of GetFlashSize()
+
+
+    @exception_wrapper
+    def memEraseFlash(self, location, index):
+        '''Usage: returnCode = EraseFlash(self, location, index)
+            Input_01 location FLR_MEM_LOCATION_E <<FLR_MEM_LOCATION_E>>
+            Input_02 index <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_mem_EraseFlash(location, index)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of EraseFlash()
+
+
+    @exception_wrapper
+    def memEraseFlashPartial(self, location, index, offset, length):
+        '''Usage: returnCode = EraseFlashPartial(self, location, index, offset, length)
+            Input_01 location FLR_MEM_LOCATION_E <<FLR_MEM_LOCATION_E>>
+            Input_02 index <class 'int'> <<UCHAR>>
+            Input_03 offset <class 'int'> <<UINT_32>>
+            Input_04 length <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_mem_EraseFlashPartial(location, index, offset, length)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of EraseFlashPartial()
+
+
+    @exception_wrapper
+    def memReadCurrentGain(self, offset, sizeInBytes):
+        '''Usage: returnCode, data = ReadCurrentGain(self, offset, sizeInBytes)
+            Input_01 offset <class 'int'> <<UINT_32>>
+            Input_02 sizeInBytes <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'bytearray'> <<BYTEARRAY>>
+        '''
+        if(sizeInBytes > MaxMemoryChunk):
+            return FLR_RESULT.FLR_DATA_SIZE_ERROR, None
+        returnCode, data = self.CLIENT_pkg_mem_ReadCurrentGain(offset, sizeInBytes)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of ReadCurrentGain()
+
+
+    @exception_wrapper
+    def memGetGainSize(self):
+        '''Usage: returnCode, bytes, rows, columns = GetGainSize(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 bytes <class 'int'> <<UINT_32>>
+            Output_02 rows <class 'int'> <<UINT_16>>
+            Output_03 columns <class 'int'> <<UINT_16>>
+        '''
+        returnCode, bytes, rows, columns = self.CLIENT_pkg_mem_GetGainSize()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, bytes, rows, columns)
+    # End of GetGainSize()
+
+
+    @exception_wrapper
+    def memGetCaptureSizeSrc(self, src):
+        '''Usage: returnCode, bytes, rows, columns = GetCaptureSizeSrc(self, src)
+            Input_01 src FLR_CAPTURE_SRC_E <<FLR_CAPTURE_SRC_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 bytes <class 'int'> <<UINT_32>>
+            Output_02 rows <class 'int'> <<UINT_16>>
+            Output_03 columns <class 'int'> <<UINT_16>>
+        '''
+        returnCode, bytes, rows, columns = self.CLIENT_pkg_mem_GetCaptureSizeSrc(src)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, bytes, rows, columns)
+    # End of GetCaptureSizeSrc()
+
+
+    @exception_wrapper
+    def memReadCaptureSrc(self, src, bufferNum, offset, sizeInBytes):
+        '''Usage: returnCode, data = ReadCaptureSrc(self, src, bufferNum, offset, sizeInBytes)
+            Input_01 src FLR_CAPTURE_SRC_E <<FLR_CAPTURE_SRC_E>>
+            Input_02 bufferNum <class 'int'> <<UCHAR>>
+            Input_03 offset <class 'int'> <<UINT_32>>
+            Input_04 sizeInBytes <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'bytearray'> <<BYTEARRAY>>
+        '''
+        if(sizeInBytes > MaxMemoryChunk):
+            return FLR_RESULT.FLR_DATA_SIZE_ERROR, None
+        returnCode, data = self.CLIENT_pkg_mem_ReadCaptureSrc(src, bufferNum, offset, sizeInBytes)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of ReadCaptureSrc()
@@ -0,0 +1,2987 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: radiometry, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def radiometrySetTempStableEnable(self, data):
+        '''Usage: returnCode = SetTempStableEnable(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempStableEnable(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempStableEnable()
+
+
+    @exception_wrapper
+    def radiometryGetTempStableEnable(self):
+        '''Usage: returnCode, data = GetTempStableEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempStableEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempStableEnable()
+
+
+    @exception_wrapper
+    def radiometrySetFNumberLens0(self, data):
+        '''Usage: returnCode = SetFNumberLens0(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetFNumberLens0(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFNumberLens0()
+
+
+    @exception_wrapper
+    def radiometryGetFNumberLens0(self):
+        '''Usage: returnCode, data = GetFNumberLens0(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetFNumberLens0()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFNumberLens0()
+
+
+    @exception_wrapper
+    def radiometrySetFNumberLens1(self, data):
+        '''Usage: returnCode = SetFNumberLens1(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetFNumberLens1(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFNumberLens1()
+
+
+    @exception_wrapper
+    def radiometryGetFNumberLens1(self):
+        '''Usage: returnCode, data = GetFNumberLens1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetFNumberLens1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFNumberLens1()
+
+
+    @exception_wrapper
+    def radiometrySetTauLens0(self, data):
+        '''Usage: returnCode = SetTauLens0(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTauLens0(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTauLens0()
+
+
+    @exception_wrapper
+    def radiometryGetTauLens0(self):
+        '''Usage: returnCode, data = GetTauLens0(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTauLens0()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTauLens0()
+
+
+    @exception_wrapper
+    def radiometrySetTauLens1(self, data):
+        '''Usage: returnCode = SetTauLens1(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTauLens1(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTauLens1()
+
+
+    @exception_wrapper
+    def radiometryGetTauLens1(self):
+        '''Usage: returnCode, data = GetTauLens1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTauLens1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTauLens1()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalGainDesired(self):
+        '''Usage: returnCode, data = GetGlobalGainDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalGainDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalGainDesired()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalOffsetDesired(self):
+        '''Usage: returnCode, data = GetGlobalOffsetDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalOffsetDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalOffsetDesired()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalGainApplied(self):
+        '''Usage: returnCode, data = GetGlobalGainApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalGainApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalGainApplied()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalOffsetApplied(self):
+        '''Usage: returnCode, data = GetGlobalOffsetApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalOffsetApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalOffsetApplied()
+
+
+    @exception_wrapper
+    def radiometrySetTComponentOverrideMode(self, data):
+        '''Usage: returnCode = SetTComponentOverrideMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTComponentOverrideMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTComponentOverrideMode()
+
+
+    @exception_wrapper
+    def radiometryGetTComponentOverrideMode(self):
+        '''Usage: returnCode, data = GetTComponentOverrideMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTComponentOverrideMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTComponentOverrideMode()
+
+
+    @exception_wrapper
+    def radiometrySetGlobalGainOverride(self, data):
+        '''Usage: returnCode = SetGlobalGainOverride(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetGlobalGainOverride(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGlobalGainOverride()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalGainOverride(self):
+        '''Usage: returnCode, data = GetGlobalGainOverride(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalGainOverride()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalGainOverride()
+
+
+    @exception_wrapper
+    def radiometrySetGlobalOffsetOverride(self, data):
+        '''Usage: returnCode = SetGlobalOffsetOverride(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetGlobalOffsetOverride(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGlobalOffsetOverride()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalOffsetOverride(self):
+        '''Usage: returnCode, data = GetGlobalOffsetOverride(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalOffsetOverride()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalOffsetOverride()
+
+
+    @exception_wrapper
+    def radiometrySetGlobalParamOverrideMode(self, data):
+        '''Usage: returnCode = SetGlobalParamOverrideMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetGlobalParamOverrideMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGlobalParamOverrideMode()
+
+
+    @exception_wrapper
+    def radiometryGetGlobalParamOverrideMode(self):
+        '''Usage: returnCode, data = GetGlobalParamOverrideMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGlobalParamOverrideMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGlobalParamOverrideMode()
+
+
+    @exception_wrapper
+    def radiometrySetRBFOHighGainDefault(self, data):
+        '''Usage: returnCode = SetRBFOHighGainDefault(self, data)
+            Input_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetRBFOHighGainDefault(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRBFOHighGainDefault()
+
+
+    @exception_wrapper
+    def radiometryGetRBFOHighGainDefault(self):
+        '''Usage: returnCode, data = GetRBFOHighGainDefault(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetRBFOHighGainDefault()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRBFOHighGainDefault()
+
+
+    @exception_wrapper
+    def radiometrySetRBFOLowGainDefault(self, data):
+        '''Usage: returnCode = SetRBFOLowGainDefault(self, data)
+            Input_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetRBFOLowGainDefault(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRBFOLowGainDefault()
+
+
+    @exception_wrapper
+    def radiometryGetRBFOLowGainDefault(self):
+        '''Usage: returnCode, data = GetRBFOLowGainDefault(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetRBFOLowGainDefault()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRBFOLowGainDefault()
+
+
+    @exception_wrapper
+    def radiometrySetRBFOHighGainFactory(self, data):
+        '''Usage: returnCode = SetRBFOHighGainFactory(self, data)
+            Input_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetRBFOHighGainFactory(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRBFOHighGainFactory()
+
+
+    @exception_wrapper
+    def radiometryGetRBFOHighGainFactory(self):
+        '''Usage: returnCode, data = GetRBFOHighGainFactory(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetRBFOHighGainFactory()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRBFOHighGainFactory()
+
+
+    @exception_wrapper
+    def radiometrySetRBFOLowGainFactory(self, data):
+        '''Usage: returnCode = SetRBFOLowGainFactory(self, data)
+            Input_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetRBFOLowGainFactory(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRBFOLowGainFactory()
+
+
+    @exception_wrapper
+    def radiometryGetRBFOLowGainFactory(self):
+        '''Usage: returnCode, data = GetRBFOLowGainFactory(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_RBFO_PARAMS_T <<FLR_RADIOMETRY_RBFO_PARAMS_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetRBFOLowGainFactory()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRBFOLowGainFactory()
+
+
+    @exception_wrapper
+    def radiometrySetDampingFactor(self, data):
+        '''Usage: returnCode = SetDampingFactor(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetDampingFactor(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDampingFactor()
+
+
+    @exception_wrapper
+    def radiometryGetDampingFactor(self):
+        '''Usage: returnCode, data = GetDampingFactor(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetDampingFactor()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDampingFactor()
+
+
+    @exception_wrapper
+    def radiometryGetGoMEQ(self):
+        '''Usage: returnCode, data = GetGoMEQ(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGoMEQ()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGoMEQ()
+
+
+    @exception_wrapper
+    def radiometryGetGoMShutter(self):
+        '''Usage: returnCode, data = GetGoMShutter(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGoMShutter()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGoMShutter()
+
+
+    @exception_wrapper
+    def radiometryGetGoMLens(self):
+        '''Usage: returnCode, data = GetGoMLens(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGoMLens()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGoMLens()
+
+
+    @exception_wrapper
+    def radiometryGetGoMLG(self):
+        '''Usage: returnCode, data = GetGoMLG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGoMLG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGoMLG()
+
+
+    @exception_wrapper
+    def radiometryGetGoMFFC(self):
+        '''Usage: returnCode, data = GetGoMFFC(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGoMFFC()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGoMFFC()
+
+
+    @exception_wrapper
+    def radiometryGetTempLensHousing(self):
+        '''Usage: returnCode, data = GetTempLensHousing(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempLensHousing()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempLensHousing()
+
+
+    @exception_wrapper
+    def radiometryGetTempShutterHousing(self):
+        '''Usage: returnCode, data = GetTempShutterHousing(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempShutterHousing()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempShutterHousing()
+
+
+    @exception_wrapper
+    def radiometryGetTempShutterPaddle(self):
+        '''Usage: returnCode, data = GetTempShutterPaddle(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempShutterPaddle()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempShutterPaddle()
+
+
+    @exception_wrapper
+    def radiometrySetFNumberShutterHousing(self, data):
+        '''Usage: returnCode = SetFNumberShutterHousing(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetFNumberShutterHousing(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFNumberShutterHousing()
+
+
+    @exception_wrapper
+    def radiometryGetFNumberShutterHousing(self):
+        '''Usage: returnCode, data = GetFNumberShutterHousing(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetFNumberShutterHousing()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFNumberShutterHousing()
+
+
+    @exception_wrapper
+    def radiometrySetEmissivityShutterHousing(self, data):
+        '''Usage: returnCode = SetEmissivityShutterHousing(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetEmissivityShutterHousing(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEmissivityShutterHousing()
+
+
+    @exception_wrapper
+    def radiometryGetEmissivityShutterHousing(self):
+        '''Usage: returnCode, data = GetEmissivityShutterHousing(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetEmissivityShutterHousing()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEmissivityShutterHousing()
+
+
+    @exception_wrapper
+    def radiometrySetM_DTfpa_Lens(self, data):
+        '''Usage: returnCode = SetM_DTfpa_Lens(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_DTfpa_Lens(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_DTfpa_Lens()
+
+
+    @exception_wrapper
+    def radiometryGetM_DTfpa_Lens(self):
+        '''Usage: returnCode, data = GetM_DTfpa_Lens(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_DTfpa_Lens()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_DTfpa_Lens()
+
+
+    @exception_wrapper
+    def radiometrySetOffset_Lens(self, data):
+        '''Usage: returnCode = SetOffset_Lens(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetOffset_Lens(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOffset_Lens()
+
+
+    @exception_wrapper
+    def radiometryGetOffset_Lens(self):
+        '''Usage: returnCode, data = GetOffset_Lens(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetOffset_Lens()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOffset_Lens()
+
+
+    @exception_wrapper
+    def radiometrySetM_Recursive_Lens(self, data):
+        '''Usage: returnCode = SetM_Recursive_Lens(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Recursive_Lens(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Recursive_Lens()
+
+
+    @exception_wrapper
+    def radiometryGetM_Recursive_Lens(self):
+        '''Usage: returnCode, data = GetM_Recursive_Lens(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Recursive_Lens()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Recursive_Lens()
+
+
+    @exception_wrapper
+    def radiometryGetGgFfc(self):
+        '''Usage: returnCode, data = GetGgFfc(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGgFfc()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGgFfc()
+
+
+    @exception_wrapper
+    def radiometryGetCountsFromTemp(self, rbfoType, temp):
+        '''Usage: returnCode, counts = GetCountsFromTemp(self, rbfoType, temp)
+            Input_01 rbfoType FLR_RADIOMETRY_RBFO_TYPE_E <<FLR_RADIOMETRY_RBFO_TYPE_E>>
+            Input_02 temp <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 counts <class 'int'> <<UINT_16>>
+        '''
+        returnCode, counts = self.CLIENT_pkg_radiometry_GetCountsFromTemp(rbfoType, temp)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, counts)
+    # End of GetCountsFromTemp()
+
+
+    @exception_wrapper
+    def radiometryGetTempFromCounts(self, rbfoType, counts):
+        '''Usage: returnCode, temp = GetTempFromCounts(self, rbfoType, counts)
+            Input_01 rbfoType FLR_RADIOMETRY_RBFO_TYPE_E <<FLR_RADIOMETRY_RBFO_TYPE_E>>
+            Input_02 counts <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 temp <class 'float'> <<FLOAT>>
+        '''
+        returnCode, temp = self.CLIENT_pkg_radiometry_GetTempFromCounts(rbfoType, counts)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, temp)
+    # End of GetTempFromCounts()
+
+
+    @exception_wrapper
+    def radiometrySetTempLensHousingOverride(self, data):
+        '''Usage: returnCode = SetTempLensHousingOverride(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempLensHousingOverride(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempLensHousingOverride()
+
+
+    @exception_wrapper
+    def radiometryGetTempLensHousingOverride(self):
+        '''Usage: returnCode, data = GetTempLensHousingOverride(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempLensHousingOverride()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempLensHousingOverride()
+
+
+    @exception_wrapper
+    def radiometrySetTempShutterHousingOverride(self, data):
+        '''Usage: returnCode = SetTempShutterHousingOverride(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempShutterHousingOverride(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempShutterHousingOverride()
+
+
+    @exception_wrapper
+    def radiometryGetTempShutterHousingOverride(self):
+        '''Usage: returnCode, data = GetTempShutterHousingOverride(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempShutterHousingOverride()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempShutterHousingOverride()
+
+
+    @exception_wrapper
+    def radiometrySetTempShutterPaddleOverride(self, data):
+        '''Usage: returnCode = SetTempShutterPaddleOverride(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempShutterPaddleOverride(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempShutterPaddleOverride()
+
+
+    @exception_wrapper
+    def radiometryGetTempShutterPaddleOverride(self):
+        '''Usage: returnCode, data = GetTempShutterPaddleOverride(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempShutterPaddleOverride()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempShutterPaddleOverride()
+
+
+    @exception_wrapper
+    def radiometrySetSignalFactorLut(self, data):
+        '''Usage: returnCode = SetSignalFactorLut(self, data)
+            Input_01 data FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T <<FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetSignalFactorLut(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSignalFactorLut()
+
+
+    @exception_wrapper
+    def radiometryGetSignalFactorLut(self):
+        '''Usage: returnCode, data = GetSignalFactorLut(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T <<FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetSignalFactorLut()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSignalFactorLut()
+
+
+    @exception_wrapper
+    def radiometrySetNoiseFactorLut(self, data):
+        '''Usage: returnCode = SetNoiseFactorLut(self, data)
+            Input_01 data FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T <<FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetNoiseFactorLut(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNoiseFactorLut()
+
+
+    @exception_wrapper
+    def radiometryGetNoiseFactorLut(self):
+        '''Usage: returnCode, data = GetNoiseFactorLut(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T <<FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetNoiseFactorLut()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetNoiseFactorLut()
+
+
+    @exception_wrapper
+    def radiometrySetM_tfpaK(self, data):
+        '''Usage: returnCode = SetM_tfpaK(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_tfpaK(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_tfpaK()
+
+
+    @exception_wrapper
+    def radiometryGetM_tfpaK(self):
+        '''Usage: returnCode, data = GetM_tfpaK(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_tfpaK()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_tfpaK()
+
+
+    @exception_wrapper
+    def radiometrySetB_tfpaK(self, data):
+        '''Usage: returnCode = SetB_tfpaK(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_tfpaK(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_tfpaK()
+
+
+    @exception_wrapper
+    def radiometryGetB_tfpaK(self):
+        '''Usage: returnCode, data = GetB_tfpaK(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_tfpaK()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_tfpaK()
+
+
+    @exception_wrapper
+    def radiometrySetTAuxParams(self, data):
+        '''Usage: returnCode = SetTAuxParams(self, data)
+            Input_01 data FLR_RADIOMETRY_TAUX_PARAMS_T <<FLR_RADIOMETRY_TAUX_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTAuxParams(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTAuxParams()
+
+
+    @exception_wrapper
+    def radiometryGetTAuxParams(self):
+        '''Usage: returnCode, data = GetTAuxParams(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_TAUX_PARAMS_T <<FLR_RADIOMETRY_TAUX_PARAMS_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTAuxParams()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTAuxParams()
+
+
+    @exception_wrapper
+    def radiometrySetM_tAux(self, data):
+        '''Usage: returnCode = SetM_tAux(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_tAux(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_tAux()
+
+
+    @exception_wrapper
+    def radiometryGetM_tAux(self):
+        '''Usage: returnCode, data = GetM_tAux(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_tAux()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_tAux()
+
+
+    @exception_wrapper
+    def radiometrySetB_tAux(self, data):
+        '''Usage: returnCode = SetB_tAux(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_tAux(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_tAux()
+
+
+    @exception_wrapper
+    def radiometryGetB_tAux(self):
+        '''Usage: returnCode, data = GetB_tAux(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_tAux()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_tAux()
+
+
+    @exception_wrapper
+    def radiometrySetTsource_FFC(self, data):
+        '''Usage: returnCode = SetTsource_FFC(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTsource_FFC(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTsource_FFC()
+
+
+    @exception_wrapper
+    def radiometryGetTsource_FFC(self):
+        '''Usage: returnCode, data = GetTsource_FFC(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTsource_FFC()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTsource_FFC()
+
+
+    @exception_wrapper
+    def radiometrySetM_DTfpa_Sh_h(self, data):
+        '''Usage: returnCode = SetM_DTfpa_Sh_h(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_DTfpa_Sh_h(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_DTfpa_Sh_h()
+
+
+    @exception_wrapper
+    def radiometryGetM_DTfpa_Sh_h(self):
+        '''Usage: returnCode, data = GetM_DTfpa_Sh_h(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_DTfpa_Sh_h()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_DTfpa_Sh_h()
+
+
+    @exception_wrapper
+    def radiometrySetOffset_Sh_h(self, data):
+        '''Usage: returnCode = SetOffset_Sh_h(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetOffset_Sh_h(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOffset_Sh_h()
+
+
+    @exception_wrapper
+    def radiometryGetOffset_Sh_h(self):
+        '''Usage: returnCode, data = GetOffset_Sh_h(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetOffset_Sh_h()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOffset_Sh_h()
+
+
+    @exception_wrapper
+    def radiometrySetM_Recursive_Sh_h(self, data):
+        '''Usage: returnCode = SetM_Recursive_Sh_h(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Recursive_Sh_h(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Recursive_Sh_h()
+
+
+    @exception_wrapper
+    def radiometryGetM_Recursive_Sh_h(self):
+        '''Usage: returnCode, data = GetM_Recursive_Sh_h(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Recursive_Sh_h()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Recursive_Sh_h()
+
+
+    @exception_wrapper
+    def radiometrySetM_DTfpa_Sh_p(self, data):
+        '''Usage: returnCode = SetM_DTfpa_Sh_p(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_DTfpa_Sh_p(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_DTfpa_Sh_p()
+
+
+    @exception_wrapper
+    def radiometryGetM_DTfpa_Sh_p(self):
+        '''Usage: returnCode, data = GetM_DTfpa_Sh_p(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_DTfpa_Sh_p()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_DTfpa_Sh_p()
+
+
+    @exception_wrapper
+    def radiometrySetOffset_Sh_p(self, data):
+        '''Usage: returnCode = SetOffset_Sh_p(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetOffset_Sh_p(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOffset_Sh_p()
+
+
+    @exception_wrapper
+    def radiometryGetOffset_Sh_p(self):
+        '''Usage: returnCode, data = GetOffset_Sh_p(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetOffset_Sh_p()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOffset_Sh_p()
+
+
+    @exception_wrapper
+    def radiometrySetM_Recursive_Sh_p(self, data):
+        '''Usage: returnCode = SetM_Recursive_Sh_p(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Recursive_Sh_p(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Recursive_Sh_p()
+
+
+    @exception_wrapper
+    def radiometryGetM_Recursive_Sh_p(self):
+        '''Usage: returnCode, data = GetM_Recursive_Sh_p(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Recursive_Sh_p()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Recursive_Sh_p()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Sh_p(self, data):
+        '''Usage: returnCode = SetM_Delta_Sh_p(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Sh_p(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Sh_p()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Sh_p(self):
+        '''Usage: returnCode, data = GetM_Delta_Sh_p(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Sh_p()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Sh_p()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Sh_p(self, data):
+        '''Usage: returnCode = SetB_Delta_Sh_p(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Sh_p(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Sh_p()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Sh_p(self):
+        '''Usage: returnCode, data = GetB_Delta_Sh_p(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Sh_p()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Sh_p()
+
+
+    @exception_wrapper
+    def radiometryGetDtTfpaK(self):
+        '''Usage: returnCode, data = GetDtTfpaK(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetDtTfpaK()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDtTfpaK()
+
+
+    @exception_wrapper
+    def radiometryGetDtTfpaK_Damp(self):
+        '''Usage: returnCode, data = GetDtTfpaK_Damp(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetDtTfpaK_Damp()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDtTfpaK_Damp()
+
+
+    @exception_wrapper
+    def radiometryGetTAuxK(self):
+        '''Usage: returnCode, data = GetTAuxK(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTAuxK()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTAuxK()
+
+
+    @exception_wrapper
+    def radiometrySetExternalFfcUpdateMode(self, data):
+        '''Usage: returnCode = SetExternalFfcUpdateMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetExternalFfcUpdateMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetExternalFfcUpdateMode()
+
+
+    @exception_wrapper
+    def radiometryGetExternalFfcUpdateMode(self):
+        '''Usage: returnCode, data = GetExternalFfcUpdateMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetExternalFfcUpdateMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetExternalFfcUpdateMode()
+
+
+    @exception_wrapper
+    def radiometryGetGG_scale(self):
+        '''Usage: returnCode, data = GetGG_scale(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGG_scale()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGG_scale()
+
+
+    @exception_wrapper
+    def radiometrySetTempWindow(self, data):
+        '''Usage: returnCode = SetTempWindow(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempWindow(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempWindow()
+
+
+    @exception_wrapper
+    def radiometryGetTempWindow(self):
+        '''Usage: returnCode, data = GetTempWindow(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempWindow()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempWindow()
+
+
+    @exception_wrapper
+    def radiometrySetTransmissionWindow(self, data):
+        '''Usage: returnCode = SetTransmissionWindow(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTransmissionWindow(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTransmissionWindow()
+
+
+    @exception_wrapper
+    def radiometryGetTransmissionWindow(self):
+        '''Usage: returnCode, data = GetTransmissionWindow(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTransmissionWindow()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTransmissionWindow()
+
+
+    @exception_wrapper
+    def radiometrySetReflectivityWindow(self, data):
+        '''Usage: returnCode = SetReflectivityWindow(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetReflectivityWindow(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetReflectivityWindow()
+
+
+    @exception_wrapper
+    def radiometryGetReflectivityWindow(self):
+        '''Usage: returnCode, data = GetReflectivityWindow(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetReflectivityWindow()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetReflectivityWindow()
+
+
+    @exception_wrapper
+    def radiometrySetTempWindowReflection(self, data):
+        '''Usage: returnCode = SetTempWindowReflection(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempWindowReflection(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempWindowReflection()
+
+
+    @exception_wrapper
+    def radiometryGetTempWindowReflection(self):
+        '''Usage: returnCode, data = GetTempWindowReflection(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempWindowReflection()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempWindowReflection()
+
+
+    @exception_wrapper
+    def radiometrySetTransmissionAtmosphere(self, data):
+        '''Usage: returnCode = SetTransmissionAtmosphere(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTransmissionAtmosphere(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTransmissionAtmosphere()
+
+
+    @exception_wrapper
+    def radiometryGetTransmissionAtmosphere(self):
+        '''Usage: returnCode, data = GetTransmissionAtmosphere(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTransmissionAtmosphere()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTransmissionAtmosphere()
+
+
+    @exception_wrapper
+    def radiometrySetTempAtmosphere(self, data):
+        '''Usage: returnCode = SetTempAtmosphere(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempAtmosphere(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempAtmosphere()
+
+
+    @exception_wrapper
+    def radiometryGetTempAtmosphere(self):
+        '''Usage: returnCode, data = GetTempAtmosphere(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempAtmosphere()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempAtmosphere()
+
+
+    @exception_wrapper
+    def radiometrySetEmissivityTarget(self, data):
+        '''Usage: returnCode = SetEmissivityTarget(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetEmissivityTarget(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEmissivityTarget()
+
+
+    @exception_wrapper
+    def radiometryGetEmissivityTarget(self):
+        '''Usage: returnCode, data = GetEmissivityTarget(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetEmissivityTarget()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEmissivityTarget()
+
+
+    @exception_wrapper
+    def radiometrySetTempBackground(self, data):
+        '''Usage: returnCode = SetTempBackground(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTempBackground(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempBackground()
+
+
+    @exception_wrapper
+    def radiometryGetTempBackground(self):
+        '''Usage: returnCode, data = GetTempBackground(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTempBackground()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempBackground()
+
+
+    @exception_wrapper
+    def radiometryGetRadiometryCapable(self):
+        '''Usage: returnCode, data = GetRadiometryCapable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetRadiometryCapable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRadiometryCapable()
+
+
+    @exception_wrapper
+    def radiometrySetdeltaTempDampingFactor(self, data):
+        '''Usage: returnCode = SetdeltaTempDampingFactor(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetdeltaTempDampingFactor(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetdeltaTempDampingFactor()
+
+
+    @exception_wrapper
+    def radiometryGetdeltaTempDampingFactor(self):
+        '''Usage: returnCode, data = GetdeltaTempDampingFactor(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetdeltaTempDampingFactor()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetdeltaTempDampingFactor()
+
+
+    @exception_wrapper
+    def radiometrySetdeltaTempIntervalTime(self, data):
+        '''Usage: returnCode = SetdeltaTempIntervalTime(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetdeltaTempIntervalTime(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetdeltaTempIntervalTime()
+
+
+    @exception_wrapper
+    def radiometryGetdeltaTempIntervalTime(self):
+        '''Usage: returnCode, data = GetdeltaTempIntervalTime(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetdeltaTempIntervalTime()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetdeltaTempIntervalTime()
+
+
+    @exception_wrapper
+    def radiometrySetdeltaTempMaxValue(self, data):
+        '''Usage: returnCode = SetdeltaTempMaxValue(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetdeltaTempMaxValue(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetdeltaTempMaxValue()
+
+
+    @exception_wrapper
+    def radiometryGetdeltaTempMaxValue(self):
+        '''Usage: returnCode, data = GetdeltaTempMaxValue(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetdeltaTempMaxValue()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetdeltaTempMaxValue()
+
+
+    @exception_wrapper
+    def radiometrySetdeltaTempMaxIncrement(self, data):
+        '''Usage: returnCode = SetdeltaTempMaxIncrement(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetdeltaTempMaxIncrement(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetdeltaTempMaxIncrement()
+
+
+    @exception_wrapper
+    def radiometryGetdeltaTempMaxIncrement(self):
+        '''Usage: returnCode, data = GetdeltaTempMaxIncrement(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetdeltaTempMaxIncrement()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetdeltaTempMaxIncrement()
+
+
+    @exception_wrapper
+    def radiometrySetdeltaTempDampingTime(self, data):
+        '''Usage: returnCode = SetdeltaTempDampingTime(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetdeltaTempDampingTime(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetdeltaTempDampingTime()
+
+
+    @exception_wrapper
+    def radiometryGetdeltaTempDampingTime(self):
+        '''Usage: returnCode, data = GetdeltaTempDampingTime(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetdeltaTempDampingTime()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetdeltaTempDampingTime()
+
+
+    @exception_wrapper
+    def radiometryGetResponsivityFpaTemp(self):
+        '''Usage: returnCode, data = GetResponsivityFpaTemp(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetResponsivityFpaTemp()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetResponsivityFpaTemp()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Lens(self, data):
+        '''Usage: returnCode = SetM_Delta_Lens(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Lens(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Lens()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Lens(self):
+        '''Usage: returnCode, data = GetM_Delta_Lens(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Lens()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Lens()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Lens(self, data):
+        '''Usage: returnCode = SetB_Delta_Lens(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Lens(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Lens()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Lens(self):
+        '''Usage: returnCode, data = GetB_Delta_Lens(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Lens()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Lens()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Sh_h(self, data):
+        '''Usage: returnCode = SetM_Delta_Sh_h(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Sh_h(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Sh_h()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Sh_h(self):
+        '''Usage: returnCode, data = GetM_Delta_Sh_h(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Sh_h()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Sh_h()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Sh_h(self, data):
+        '''Usage: returnCode = SetB_Delta_Sh_h(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Sh_h(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Sh_h()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Sh_h(self):
+        '''Usage: returnCode, data = GetB_Delta_Sh_h(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Sh_h()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Sh_h()
+
+
+    @exception_wrapper
+    def radiometrySetGG_Scale_HG(self, data):
+        '''Usage: returnCode = SetGG_Scale_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetGG_Scale_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGG_Scale_HG()
+
+
+    @exception_wrapper
+    def radiometryGetGG_Scale_HG(self):
+        '''Usage: returnCode, data = GetGG_Scale_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGG_Scale_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGG_Scale_HG()
+
+
+    @exception_wrapper
+    def radiometrySetGG_Scale_LG(self, data):
+        '''Usage: returnCode = SetGG_Scale_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetGG_Scale_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetGG_Scale_LG()
+
+
+    @exception_wrapper
+    def radiometryGetGG_Scale_LG(self):
+        '''Usage: returnCode, data = GetGG_Scale_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGG_Scale_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGG_Scale_LG()
+
+
+    @exception_wrapper
+    def radiometrySetRbfoScaledMode(self, data):
+        '''Usage: returnCode = SetRbfoScaledMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetRbfoScaledMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRbfoScaledMode()
+
+
+    @exception_wrapper
+    def radiometryGetRbfoScaledMode(self):
+        '''Usage: returnCode, data = GetRbfoScaledMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetRbfoScaledMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetRbfoScaledMode()
+
+
+    @exception_wrapper
+    def radiometryGetUncertaintyFactor(self):
+        '''Usage: returnCode, data = GetUncertaintyFactor(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_RADIOMETRY_UNCERTAINTY_FACTOR_E <<FLR_RADIOMETRY_UNCERTAINTY_FACTOR_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetUncertaintyFactor()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetUncertaintyFactor()
+
+
+    @exception_wrapper
+    def radiometryGetTRoomMinThresh(self):
+        '''Usage: returnCode, data = GetTRoomMinThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTRoomMinThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTRoomMinThresh()
+
+
+    @exception_wrapper
+    def radiometryGetTRoomMaxThresh(self):
+        '''Usage: returnCode, data = GetTRoomMaxThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTRoomMaxThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTRoomMaxThresh()
+
+
+    @exception_wrapper
+    def radiometryGetTOperatingMinThresh(self):
+        '''Usage: returnCode, data = GetTOperatingMinThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTOperatingMinThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTOperatingMinThresh()
+
+
+    @exception_wrapper
+    def radiometryGetTOperatingMaxThresh(self):
+        '''Usage: returnCode, data = GetTOperatingMaxThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTOperatingMaxThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTOperatingMaxThresh()
+
+
+    @exception_wrapper
+    def radiometryGetStableTempThresh(self):
+        '''Usage: returnCode, data = GetStableTempThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetStableTempThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetStableTempThresh()
+
+
+    @exception_wrapper
+    def radiometryGetSlowDriftThresh(self):
+        '''Usage: returnCode, data = GetSlowDriftThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetSlowDriftThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSlowDriftThresh()
+
+
+    @exception_wrapper
+    def radiometryGetFfcTempThresh(self):
+        '''Usage: returnCode, data = GetFfcTempThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetFfcTempThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFfcTempThresh()
+
+
+    @exception_wrapper
+    def radiometryGetTargetTempMinThreshLG(self):
+        '''Usage: returnCode, data = GetTargetTempMinThreshLG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTargetTempMinThreshLG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTargetTempMinThreshLG()
+
+
+    @exception_wrapper
+    def radiometryGetTargetTempMaxThreshLG(self):
+        '''Usage: returnCode, data = GetTargetTempMaxThreshLG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTargetTempMaxThreshLG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTargetTempMaxThreshLG()
+
+
+    @exception_wrapper
+    def radiometryGetMFactorThresh(self):
+        '''Usage: returnCode, data = GetMFactorThresh(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetMFactorThresh()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMFactorThresh()
+
+
+    @exception_wrapper
+    def radiometryGetTargetTempMinThreshHG(self):
+        '''Usage: returnCode, data = GetTargetTempMinThreshHG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTargetTempMinThreshHG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTargetTempMinThreshHG()
+
+
+    @exception_wrapper
+    def radiometryGetTargetTempMaxThreshHG(self):
+        '''Usage: returnCode, data = GetTargetTempMaxThreshHG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTargetTempMaxThreshHG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTargetTempMaxThreshHG()
+
+
+    @exception_wrapper
+    def radiometryGetUncertaintyStatusBits(self):
+        '''Usage: returnCode, data = GetUncertaintyStatusBits(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetUncertaintyStatusBits()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetUncertaintyStatusBits()
+
+
+    @exception_wrapper
+    def radiometrySetTemperatureOffset_HG(self, data):
+        '''Usage: returnCode = SetTemperatureOffset_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTemperatureOffset_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTemperatureOffset_HG()
+
+
+    @exception_wrapper
+    def radiometryGetTemperatureOffset_HG(self):
+        '''Usage: returnCode, data = GetTemperatureOffset_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTemperatureOffset_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTemperatureOffset_HG()
+
+
+    @exception_wrapper
+    def radiometrySetTemperatureOffset_LG(self, data):
+        '''Usage: returnCode = SetTemperatureOffset_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetTemperatureOffset_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTemperatureOffset_LG()
+
+
+    @exception_wrapper
+    def radiometryGetTemperatureOffset_LG(self):
+        '''Usage: returnCode, data = GetTemperatureOffset_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetTemperatureOffset_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTemperatureOffset_LG()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Lens_HG(self, data):
+        '''Usage: returnCode = SetM_Delta_Lens_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Lens_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Lens_HG()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Lens_HG(self):
+        '''Usage: returnCode, data = GetM_Delta_Lens_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Lens_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Lens_HG()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Lens_HG(self, data):
+        '''Usage: returnCode = SetB_Delta_Lens_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Lens_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Lens_HG()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Lens_HG(self):
+        '''Usage: returnCode, data = GetB_Delta_Lens_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Lens_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Lens_HG()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Lens_LG(self, data):
+        '''Usage: returnCode = SetM_Delta_Lens_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Lens_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Lens_LG()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Lens_LG(self):
+        '''Usage: returnCode, data = GetM_Delta_Lens_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Lens_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Lens_LG()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Lens_LG(self, data):
+        '''Usage: returnCode = SetB_Delta_Lens_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Lens_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Lens_LG()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Lens_LG(self):
+        '''Usage: returnCode, data = GetB_Delta_Lens_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Lens_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Lens_LG()
+
+
+    @exception_wrapper
+    def radiometrySetOffset_Lens_HG(self, data):
+        '''Usage: returnCode = SetOffset_Lens_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetOffset_Lens_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOffset_Lens_HG()
+
+
+    @exception_wrapper
+    def radiometryGetOffset_Lens_HG(self):
+        '''Usage: returnCode, data = GetOffset_Lens_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetOffset_Lens_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOffset_Lens_HG()
+
+
+    @exception_wrapper
+    def radiometrySetOffset_Lens_LG(self, data):
+        '''Usage: returnCode = SetOffset_Lens_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetOffset_Lens_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOffset_Lens_LG()
+
+
+    @exception_wrapper
+    def radiometryGetOffset_Lens_LG(self):
+        '''Usage: returnCode, data = GetOffset_Lens_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetOffset_Lens_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOffset_Lens_LG()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Sh_p_HG(self, data):
+        '''Usage: returnCode = SetM_Delta_Sh_p_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Sh_p_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Sh_p_HG()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Sh_p_HG(self):
+        '''Usage: returnCode, data = GetM_Delta_Sh_p_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Sh_p_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Sh_p_HG()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Sh_p_HG(self, data):
+        '''Usage: returnCode = SetB_Delta_Sh_p_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Sh_p_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Sh_p_HG()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Sh_p_HG(self):
+        '''Usage: returnCode, data = GetB_Delta_Sh_p_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Sh_p_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Sh_p_HG()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Sh_p_LG(self, data):
+        '''Usage: returnCode = SetM_Delta_Sh_p_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Sh_p_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Sh_p_LG()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Sh_p_LG(self):
+        '''Usage: returnCode, data = GetM_Delta_Sh_p_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Sh_p_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Sh_p_LG()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Sh_p_LG(self, data):
+        '''Usage: returnCode = SetB_Delta_Sh_p_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Sh_p_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Sh_p_LG()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Sh_p_LG(self):
+        '''Usage: returnCode, data = GetB_Delta_Sh_p_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Sh_p_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Sh_p_LG()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Sh_h_HG(self, data):
+        '''Usage: returnCode = SetM_Delta_Sh_h_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Sh_h_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Sh_h_HG()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Sh_h_HG(self):
+        '''Usage: returnCode, data = GetM_Delta_Sh_h_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Sh_h_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Sh_h_HG()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Sh_h_HG(self, data):
+        '''Usage: returnCode = SetB_Delta_Sh_h_HG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Sh_h_HG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Sh_h_HG()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Sh_h_HG(self):
+        '''Usage: returnCode, data = GetB_Delta_Sh_h_HG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Sh_h_HG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Sh_h_HG()
+
+
+    @exception_wrapper
+    def radiometrySetM_Delta_Sh_h_LG(self, data):
+        '''Usage: returnCode = SetM_Delta_Sh_h_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetM_Delta_Sh_h_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_Delta_Sh_h_LG()
+
+
+    @exception_wrapper
+    def radiometryGetM_Delta_Sh_h_LG(self):
+        '''Usage: returnCode, data = GetM_Delta_Sh_h_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetM_Delta_Sh_h_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_Delta_Sh_h_LG()
+
+
+    @exception_wrapper
+    def radiometrySetB_Delta_Sh_h_LG(self, data):
+        '''Usage: returnCode = SetB_Delta_Sh_h_LG(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_radiometry_SetB_Delta_Sh_h_LG(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetB_Delta_Sh_h_LG()
+
+
+    @exception_wrapper
+    def radiometryGetB_Delta_Sh_h_LG(self):
+        '''Usage: returnCode, data = GetB_Delta_Sh_h_LG(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetB_Delta_Sh_h_LG()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetB_Delta_Sh_h_LG()
+
+
+    @exception_wrapper
+    def radiometryGetGG_RoomTemp(self):
+        '''Usage: returnCode, data = GetGG_RoomTemp(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_radiometry_GetGG_RoomTemp()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetGG_RoomTemp()
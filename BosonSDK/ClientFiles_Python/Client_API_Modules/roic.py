@@ -0,0 +1,326 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: roic, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def roicGetFPATemp(self):
+        '''Usage: returnCode, data = GetFPATemp(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetFPATemp()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFPATemp()
+
+
+    @exception_wrapper
+    def roicGetFrameCount(self):
+        '''Usage: returnCode, data = GetFrameCount(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetFrameCount()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFrameCount()
+
+
+    @exception_wrapper
+    def roicGetActiveNormalizationTarget(self):
+        '''Usage: returnCode, data = GetActiveNormalizationTarget(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetActiveNormalizationTarget()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetActiveNormalizationTarget()
+
+
+    @exception_wrapper
+    def roicSetFPARampState(self, state):
+        '''Usage: returnCode = SetFPARampState(self, state)
+            Input_01 state FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_SetFPARampState(state)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFPARampState()
+
+
+    @exception_wrapper
+    def roicGetFPARampState(self):
+        '''Usage: returnCode, state = GetFPARampState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 state FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, state = self.CLIENT_pkg_roic_GetFPARampState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, state)
+    # End of GetFPARampState()
+
+
+    @exception_wrapper
+    def roicGetSensorADC1(self):
+        '''Usage: returnCode, data = GetSensorADC1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetSensorADC1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSensorADC1()
+
+
+    @exception_wrapper
+    def roicGetSensorADC2(self):
+        '''Usage: returnCode, data = GetSensorADC2(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetSensorADC2()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSensorADC2()
+
+
+    @exception_wrapper
+    def roicSetFPATempOffset(self, data):
+        '''Usage: returnCode = SetFPATempOffset(self, data)
+            Input_01 data <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_SetFPATempOffset(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFPATempOffset()
+
+
+    @exception_wrapper
+    def roicGetFPATempOffset(self):
+        '''Usage: returnCode, data = GetFPATempOffset(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<INT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetFPATempOffset()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFPATempOffset()
+
+
+    @exception_wrapper
+    def roicSetFPATempMode(self, data):
+        '''Usage: returnCode = SetFPATempMode(self, data)
+            Input_01 data FLR_ROIC_TEMP_MODE_E <<FLR_ROIC_TEMP_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_SetFPATempMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFPATempMode()
+
+
+    @exception_wrapper
+    def roicGetFPATempMode(self):
+        '''Usage: returnCode, data = GetFPATempMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ROIC_TEMP_MODE_E <<FLR_ROIC_TEMP_MODE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetFPATempMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFPATempMode()
+
+
+    @exception_wrapper
+    def roicGetFPATempTable(self):
+        '''Usage: returnCode, table = GetFPATempTable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 table FLR_ROIC_FPATEMP_TABLE_T <<FLR_ROIC_FPATEMP_TABLE_T>>
+        '''
+        returnCode, table = self.CLIENT_pkg_roic_GetFPATempTable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, table)
+    # End of GetFPATempTable()
+
+
+    @exception_wrapper
+    def roicSetFPATempValue(self, data):
+        '''Usage: returnCode = SetFPATempValue(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_SetFPATempValue(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFPATempValue()
+
+
+    @exception_wrapper
+    def roicGetFPATempValue(self):
+        '''Usage: returnCode, data = GetFPATempValue(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetFPATempValue()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFPATempValue()
+
+
+    @exception_wrapper
+    def roicGetPreambleError(self):
+        '''Usage: returnCode, preambleError = GetPreambleError(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 preambleError <class 'int'> <<UINT_32>>
+        '''
+        returnCode, preambleError = self.CLIENT_pkg_roic_GetPreambleError()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, preambleError)
+    # End of GetPreambleError()
+
+
+    @exception_wrapper
+    def roicInducePreambleError(self, everyNthFrame):
+        '''Usage: returnCode = InducePreambleError(self, everyNthFrame)
+            Input_01 everyNthFrame <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_InducePreambleError(everyNthFrame)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of InducePreambleError()
+
+
+    @exception_wrapper
+    def roicGetRoicStarted(self):
+        '''Usage: returnCode, roicStarted = GetRoicStarted(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 roicStarted FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, roicStarted = self.CLIENT_pkg_roic_GetRoicStarted()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, roicStarted)
+    # End of GetRoicStarted()
+
+
+    @exception_wrapper
+    def roicSetFrameSkip(self, data):
+        '''Usage: returnCode = SetFrameSkip(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_SetFrameSkip(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFrameSkip()
+
+
+    @exception_wrapper
+    def roicGetFrameSkip(self):
+        '''Usage: returnCode, data = GetFrameSkip(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_roic_GetFrameSkip()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFrameSkip()
+
+
+    @exception_wrapper
+    def roicSetFrameOneShot(self):
+        '''Usage: returnCode = SetFrameOneShot(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_roic_SetFrameOneShot()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFrameOneShot()
@@ -0,0 +1,100 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: scaler, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def scalerGetMaxZoom(self):
+        '''Usage: returnCode, zoom = GetMaxZoom(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 zoom <class 'int'> <<UINT_32>>
+        '''
+        returnCode, zoom = self.CLIENT_pkg_scaler_GetMaxZoom()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, zoom)
+    # End of GetMaxZoom()
+
+
+    @exception_wrapper
+    def scalerSetZoom(self, zoomParams):
+        '''Usage: returnCode = SetZoom(self, zoomParams)
+            Input_01 zoomParams FLR_SCALER_ZOOM_PARAMS_T <<FLR_SCALER_ZOOM_PARAMS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scaler_SetZoom(zoomParams)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetZoom()
+
+
+    @exception_wrapper
+    def scalerGetZoom(self):
+        '''Usage: returnCode, zoomParams = GetZoom(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 zoomParams FLR_SCALER_ZOOM_PARAMS_T <<FLR_SCALER_ZOOM_PARAMS_T>>
+        '''
+        returnCode, zoomParams = self.CLIENT_pkg_scaler_GetZoom()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, zoomParams)
+    # End of GetZoom()
+
+
+    @exception_wrapper
+    def scalerSetFractionalZoom(self, zoomNumerator, zoomDenominator, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable):
+        '''Usage: returnCode = SetFractionalZoom(self, zoomNumerator, zoomDenominator, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable)
+            Input_01 zoomNumerator <class 'int'> <<UINT_32>>
+            Input_02 zoomDenominator <class 'int'> <<UINT_32>>
+            Input_03 zoomXCenter <class 'int'> <<UINT_32>>
+            Input_04 zoomYCenter <class 'int'> <<UINT_32>>
+            Input_05 inChangeEnable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Input_06 zoomOutXCenter <class 'int'> <<UINT_32>>
+            Input_07 zoomOutYCenter <class 'int'> <<UINT_32>>
+            Input_08 outChangeEnable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scaler_SetFractionalZoom(zoomNumerator, zoomDenominator, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFractionalZoom()
+
+
+    @exception_wrapper
+    def scalerSetIndexZoom(self, zoomIndex, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable):
+        '''Usage: returnCode = SetIndexZoom(self, zoomIndex, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable)
+            Input_01 zoomIndex <class 'int'> <<UINT_32>>
+            Input_02 zoomXCenter <class 'int'> <<UINT_32>>
+            Input_03 zoomYCenter <class 'int'> <<UINT_32>>
+            Input_04 inChangeEnable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Input_05 zoomOutXCenter <class 'int'> <<UINT_32>>
+            Input_06 zoomOutYCenter <class 'int'> <<UINT_32>>
+            Input_07 outChangeEnable FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scaler_SetIndexZoom(zoomIndex, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIndexZoom()
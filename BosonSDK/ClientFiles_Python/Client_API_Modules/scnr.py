@@ -0,0 +1,631 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: scnr, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def scnrSetEnableState(self, data):
+        '''Usage: returnCode = SetEnableState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetEnableState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnableState()
+
+
+    @exception_wrapper
+    def scnrGetEnableState(self):
+        '''Usage: returnCode, data = GetEnableState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetEnableState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEnableState()
+
+
+    @exception_wrapper
+    def scnrSetThColSum(self, data):
+        '''Usage: returnCode = SetThColSum(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetThColSum(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThColSum()
+
+
+    @exception_wrapper
+    def scnrGetThColSum(self):
+        '''Usage: returnCode, data = GetThColSum(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetThColSum()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThColSum()
+
+
+    @exception_wrapper
+    def scnrSetThPixel(self, data):
+        '''Usage: returnCode = SetThPixel(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetThPixel(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThPixel()
+
+
+    @exception_wrapper
+    def scnrGetThPixel(self):
+        '''Usage: returnCode, data = GetThPixel(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetThPixel()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThPixel()
+
+
+    @exception_wrapper
+    def scnrSetMaxCorr(self, data):
+        '''Usage: returnCode = SetMaxCorr(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetMaxCorr(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxCorr()
+
+
+    @exception_wrapper
+    def scnrGetMaxCorr(self):
+        '''Usage: returnCode, data = GetMaxCorr(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetMaxCorr()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxCorr()
+
+
+    @exception_wrapper
+    def scnrGetThPixelApplied(self):
+        '''Usage: returnCode, data = GetThPixelApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetThPixelApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThPixelApplied()
+
+
+    @exception_wrapper
+    def scnrGetMaxCorrApplied(self):
+        '''Usage: returnCode, data = GetMaxCorrApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetMaxCorrApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxCorrApplied()
+
+
+    @exception_wrapper
+    def scnrSetThColSumSafe(self, data):
+        '''Usage: returnCode = SetThColSumSafe(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetThColSumSafe(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThColSumSafe()
+
+
+    @exception_wrapper
+    def scnrGetThColSumSafe(self):
+        '''Usage: returnCode, data = GetThColSumSafe(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetThColSumSafe()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThColSumSafe()
+
+
+    @exception_wrapper
+    def scnrSetThPixelSafe(self, data):
+        '''Usage: returnCode = SetThPixelSafe(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetThPixelSafe(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThPixelSafe()
+
+
+    @exception_wrapper
+    def scnrGetThPixelSafe(self):
+        '''Usage: returnCode, data = GetThPixelSafe(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetThPixelSafe()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThPixelSafe()
+
+
+    @exception_wrapper
+    def scnrSetMaxCorrSafe(self, data):
+        '''Usage: returnCode = SetMaxCorrSafe(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetMaxCorrSafe(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxCorrSafe()
+
+
+    @exception_wrapper
+    def scnrGetMaxCorrSafe(self):
+        '''Usage: returnCode, data = GetMaxCorrSafe(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetMaxCorrSafe()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxCorrSafe()
+
+
+    @exception_wrapper
+    def scnrSetCorrectionMethod(self, data):
+        '''Usage: returnCode = SetCorrectionMethod(self, data)
+            Input_01 data FLR_SCNR_CORR_SELECT_E <<FLR_SCNR_CORR_SELECT_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetCorrectionMethod(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetCorrectionMethod()
+
+
+    @exception_wrapper
+    def scnrGetCorrectionMethod(self):
+        '''Usage: returnCode, data = GetCorrectionMethod(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SCNR_CORR_SELECT_E <<FLR_SCNR_CORR_SELECT_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetCorrectionMethod()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetCorrectionMethod()
+
+
+    @exception_wrapper
+    def scnrSetStdThreshold(self, data):
+        '''Usage: returnCode = SetStdThreshold(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetStdThreshold(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetStdThreshold()
+
+
+    @exception_wrapper
+    def scnrGetStdThreshold(self):
+        '''Usage: returnCode, data = GetStdThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetStdThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetStdThreshold()
+
+
+    @exception_wrapper
+    def scnrSetNFrames(self, data):
+        '''Usage: returnCode = SetNFrames(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetNFrames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNFrames()
+
+
+    @exception_wrapper
+    def scnrGetNFrames(self):
+        '''Usage: returnCode, data = GetNFrames(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetNFrames()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetNFrames()
+
+
+    @exception_wrapper
+    def scnrSetResetDesired(self, data):
+        '''Usage: returnCode = SetResetDesired(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetResetDesired(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetResetDesired()
+
+
+    @exception_wrapper
+    def scnrGetResetDesired(self):
+        '''Usage: returnCode, data = GetResetDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetResetDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetResetDesired()
+
+
+    @exception_wrapper
+    def scnrSetM_modeOnly(self, data):
+        '''Usage: returnCode = SetM_modeOnly(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetM_modeOnly(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetM_modeOnly()
+
+
+    @exception_wrapper
+    def scnrGetM_modeOnly(self):
+        '''Usage: returnCode, data = GetM_modeOnly(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetM_modeOnly()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetM_modeOnly()
+
+
+    @exception_wrapper
+    def scnrGetMode(self):
+        '''Usage: returnCode, data = GetMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SCNR_MODE_E <<FLR_SCNR_MODE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMode()
+
+
+    @exception_wrapper
+    def scnrSetSpecklesEnableState(self, data):
+        '''Usage: returnCode = SetSpecklesEnableState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetSpecklesEnableState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpecklesEnableState()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesEnableState(self):
+        '''Usage: returnCode, data = GetSpecklesEnableState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesEnableState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesEnableState()
+
+
+    @exception_wrapper
+    def scnrSetSpecklesThreshold(self, data):
+        '''Usage: returnCode = SetSpecklesThreshold(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetSpecklesThreshold(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpecklesThreshold()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesThreshold(self):
+        '''Usage: returnCode, data = GetSpecklesThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesThreshold()
+
+
+    @exception_wrapper
+    def scnrSetSpecklesRatio(self, data):
+        '''Usage: returnCode = SetSpecklesRatio(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetSpecklesRatio(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpecklesRatio()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesRatio(self):
+        '''Usage: returnCode, data = GetSpecklesRatio(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesRatio()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesRatio()
+
+
+    @exception_wrapper
+    def scnrSetSpecklesDF(self, data):
+        '''Usage: returnCode = SetSpecklesDF(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetSpecklesDF(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpecklesDF()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesDF(self):
+        '''Usage: returnCode, data = GetSpecklesDF(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesDF()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesDF()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesDiffsBufferAddr(self):
+        '''Usage: returnCode, data = GetSpecklesDiffsBufferAddr(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesDiffsBufferAddr()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesDiffsBufferAddr()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesOffsBufferAddr(self):
+        '''Usage: returnCode, data = GetSpecklesOffsBufferAddr(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesOffsBufferAddr()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesOffsBufferAddr()
+
+
+    @exception_wrapper
+    def scnrSetSpecklesResetDesired(self, data):
+        '''Usage: returnCode = SetSpecklesResetDesired(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_scnr_SetSpecklesResetDesired(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpecklesResetDesired()
+
+
+    @exception_wrapper
+    def scnrGetSpecklesResetDesired(self):
+        '''Usage: returnCode, data = GetSpecklesResetDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_scnr_GetSpecklesResetDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSpecklesResetDesired()
@@ -0,0 +1,183 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: sffc, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def sffcGetScaleFactor(self):
+        '''Usage: returnCode, data = GetScaleFactor(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sffc_GetScaleFactor()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetScaleFactor()
+
+
+    @exception_wrapper
+    def sffcGetDeltaTempLinearCoeff(self):
+        '''Usage: returnCode, data = GetDeltaTempLinearCoeff(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sffc_GetDeltaTempLinearCoeff()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDeltaTempLinearCoeff()
+
+
+    @exception_wrapper
+    def sffcSetDeltaTempLinearCoeff(self, data):
+        '''Usage: returnCode = SetDeltaTempLinearCoeff(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sffc_SetDeltaTempLinearCoeff(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDeltaTempLinearCoeff()
+
+
+    @exception_wrapper
+    def sffcGetDeltaTempOffsetCoeff(self):
+        '''Usage: returnCode, data = GetDeltaTempOffsetCoeff(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sffc_GetDeltaTempOffsetCoeff()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDeltaTempOffsetCoeff()
+
+
+    @exception_wrapper
+    def sffcSetDeltaTempOffsetCoeff(self, data):
+        '''Usage: returnCode = SetDeltaTempOffsetCoeff(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sffc_SetDeltaTempOffsetCoeff(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDeltaTempOffsetCoeff()
+
+
+    @exception_wrapper
+    def sffcGetFpaTempLinearCoeff(self):
+        '''Usage: returnCode, data = GetFpaTempLinearCoeff(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sffc_GetFpaTempLinearCoeff()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFpaTempLinearCoeff()
+
+
+    @exception_wrapper
+    def sffcSetFpaTempLinearCoeff(self, data):
+        '''Usage: returnCode = SetFpaTempLinearCoeff(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sffc_SetFpaTempLinearCoeff(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFpaTempLinearCoeff()
+
+
+    @exception_wrapper
+    def sffcGetFpaTempOffsetCoeff(self):
+        '''Usage: returnCode, data = GetFpaTempOffsetCoeff(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sffc_GetFpaTempOffsetCoeff()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFpaTempOffsetCoeff()
+
+
+    @exception_wrapper
+    def sffcSetFpaTempOffsetCoeff(self, data):
+        '''Usage: returnCode = SetFpaTempOffsetCoeff(self, data)
+            Input_01 data <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sffc_SetFpaTempOffsetCoeff(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFpaTempOffsetCoeff()
+
+
+    @exception_wrapper
+    def sffcGetDeltaTempTimeLimitInSecs(self):
+        '''Usage: returnCode, data = GetDeltaTempTimeLimitInSecs(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sffc_GetDeltaTempTimeLimitInSecs()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDeltaTempTimeLimitInSecs()
+
+
+    @exception_wrapper
+    def sffcSetDeltaTempTimeLimitInSecs(self, data):
+        '''Usage: returnCode = SetDeltaTempTimeLimitInSecs(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sffc_SetDeltaTempTimeLimitInSecs(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDeltaTempTimeLimitInSecs()
@@ -0,0 +1,599 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: spnr, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def spnrSetEnableState(self, data):
+        '''Usage: returnCode = SetEnableState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetEnableState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnableState()
+
+
+    @exception_wrapper
+    def spnrGetEnableState(self):
+        '''Usage: returnCode, data = GetEnableState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spnr_GetEnableState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEnableState()
+
+
+    @exception_wrapper
+    def spnrGetState(self):
+        '''Usage: returnCode, data = GetState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SPNR_STATE_E <<FLR_SPNR_STATE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spnr_GetState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetState()
+
+
+    @exception_wrapper
+    def spnrSetFrameDelay(self, data):
+        '''Usage: returnCode = SetFrameDelay(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetFrameDelay(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFrameDelay()
+
+
+    @exception_wrapper
+    def spnrGetFrameDelay(self):
+        '''Usage: returnCode, data = GetFrameDelay(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spnr_GetFrameDelay()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFrameDelay()
+
+
+    @exception_wrapper
+    def spnrSetSF(self, sf):
+        '''Usage: returnCode = SetSF(self, sf)
+            Input_01 sf <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetSF(sf)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSF()
+
+
+    @exception_wrapper
+    def spnrGetSF(self):
+        '''Usage: returnCode, sf = GetSF(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 sf <class 'float'> <<FLOAT>>
+        '''
+        returnCode, sf = self.CLIENT_pkg_spnr_GetSF()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, sf)
+    # End of GetSF()
+
+
+    @exception_wrapper
+    def spnrGetSFApplied(self):
+        '''Usage: returnCode, sf = GetSFApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 sf <class 'float'> <<FLOAT>>
+        '''
+        returnCode, sf = self.CLIENT_pkg_spnr_GetSFApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, sf)
+    # End of GetSFApplied()
+
+
+    @exception_wrapper
+    def spnrSetPSDKernel(self, data):
+        '''Usage: returnCode = SetPSDKernel(self, data)
+            Input_01 data FLR_SPNR_PSD_KERNEL_T <<FLR_SPNR_PSD_KERNEL_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetPSDKernel(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetPSDKernel()
+
+
+    @exception_wrapper
+    def spnrGetPSDKernel(self):
+        '''Usage: returnCode, data = GetPSDKernel(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SPNR_PSD_KERNEL_T <<FLR_SPNR_PSD_KERNEL_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spnr_GetPSDKernel()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetPSDKernel()
+
+
+    @exception_wrapper
+    def spnrSetSFMin(self, sfmin):
+        '''Usage: returnCode = SetSFMin(self, sfmin)
+            Input_01 sfmin <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetSFMin(sfmin)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSFMin()
+
+
+    @exception_wrapper
+    def spnrGetSFMin(self):
+        '''Usage: returnCode, sfmin = GetSFMin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 sfmin <class 'float'> <<FLOAT>>
+        '''
+        returnCode, sfmin = self.CLIENT_pkg_spnr_GetSFMin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, sfmin)
+    # End of GetSFMin()
+
+
+    @exception_wrapper
+    def spnrSetSFMax(self, sfmax):
+        '''Usage: returnCode = SetSFMax(self, sfmax)
+            Input_01 sfmax <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetSFMax(sfmax)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSFMax()
+
+
+    @exception_wrapper
+    def spnrGetSFMax(self):
+        '''Usage: returnCode, sfmax = GetSFMax(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 sfmax <class 'float'> <<FLOAT>>
+        '''
+        returnCode, sfmax = self.CLIENT_pkg_spnr_GetSFMax()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, sfmax)
+    # End of GetSFMax()
+
+
+    @exception_wrapper
+    def spnrSetDFMin(self, dfmin):
+        '''Usage: returnCode = SetDFMin(self, dfmin)
+            Input_01 dfmin <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetDFMin(dfmin)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDFMin()
+
+
+    @exception_wrapper
+    def spnrGetDFMin(self):
+        '''Usage: returnCode, dfmin = GetDFMin(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 dfmin <class 'float'> <<FLOAT>>
+        '''
+        returnCode, dfmin = self.CLIENT_pkg_spnr_GetDFMin()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, dfmin)
+    # End of GetDFMin()
+
+
+    @exception_wrapper
+    def spnrSetDFMax(self, dfmax):
+        '''Usage: returnCode = SetDFMax(self, dfmax)
+            Input_01 dfmax <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetDFMax(dfmax)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDFMax()
+
+
+    @exception_wrapper
+    def spnrGetDFMax(self):
+        '''Usage: returnCode, dfmax = GetDFMax(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 dfmax <class 'float'> <<FLOAT>>
+        '''
+        returnCode, dfmax = self.CLIENT_pkg_spnr_GetDFMax()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, dfmax)
+    # End of GetDFMax()
+
+
+    @exception_wrapper
+    def spnrSetNormTarget(self, normTarget):
+        '''Usage: returnCode = SetNormTarget(self, normTarget)
+            Input_01 normTarget <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetNormTarget(normTarget)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetNormTarget()
+
+
+    @exception_wrapper
+    def spnrGetNormTarget(self):
+        '''Usage: returnCode, normTarget = GetNormTarget(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 normTarget <class 'float'> <<FLOAT>>
+        '''
+        returnCode, normTarget = self.CLIENT_pkg_spnr_GetNormTarget()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, normTarget)
+    # End of GetNormTarget()
+
+
+    @exception_wrapper
+    def spnrGetNormTargetApplied(self):
+        '''Usage: returnCode, normTargetApplied = GetNormTargetApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 normTargetApplied <class 'float'> <<FLOAT>>
+        '''
+        returnCode, normTargetApplied = self.CLIENT_pkg_spnr_GetNormTargetApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, normTargetApplied)
+    # End of GetNormTargetApplied()
+
+
+    @exception_wrapper
+    def spnrSetThPix(self, th_pix):
+        '''Usage: returnCode = SetThPix(self, th_pix)
+            Input_01 th_pix <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetThPix(th_pix)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThPix()
+
+
+    @exception_wrapper
+    def spnrGetThPix(self):
+        '''Usage: returnCode, th_pix = GetThPix(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 th_pix <class 'int'> <<UINT_16>>
+        '''
+        returnCode, th_pix = self.CLIENT_pkg_spnr_GetThPix()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, th_pix)
+    # End of GetThPix()
+
+
+    @exception_wrapper
+    def spnrSetThPixSum(self, th_pixSum):
+        '''Usage: returnCode = SetThPixSum(self, th_pixSum)
+            Input_01 th_pixSum <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetThPixSum(th_pixSum)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThPixSum()
+
+
+    @exception_wrapper
+    def spnrGetThPixSum(self):
+        '''Usage: returnCode, th_pixSum = GetThPixSum(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 th_pixSum <class 'int'> <<UINT_16>>
+        '''
+        returnCode, th_pixSum = self.CLIENT_pkg_spnr_GetThPixSum()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, th_pixSum)
+    # End of GetThPixSum()
+
+
+    @exception_wrapper
+    def spnrSetMaxcorr(self, maxcorr):
+        '''Usage: returnCode = SetMaxcorr(self, maxcorr)
+            Input_01 maxcorr <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetMaxcorr(maxcorr)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxcorr()
+
+
+    @exception_wrapper
+    def spnrGetMaxcorr(self):
+        '''Usage: returnCode, maxcorr = GetMaxcorr(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 maxcorr <class 'int'> <<UINT_16>>
+        '''
+        returnCode, maxcorr = self.CLIENT_pkg_spnr_GetMaxcorr()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, maxcorr)
+    # End of GetMaxcorr()
+
+
+    @exception_wrapper
+    def spnrGetAlgorithm(self):
+        '''Usage: returnCode, data = GetAlgorithm(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SPNR_ALGORITHM_E <<FLR_SPNR_ALGORITHM_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spnr_GetAlgorithm()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAlgorithm()
+
+
+    @exception_wrapper
+    def spnrSetAlgorithmDesired(self, data):
+        '''Usage: returnCode = SetAlgorithmDesired(self, data)
+            Input_01 data FLR_SPNR_ALGORITHM_E <<FLR_SPNR_ALGORITHM_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetAlgorithmDesired(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAlgorithmDesired()
+
+
+    @exception_wrapper
+    def spnrGetAlgorithmDesired(self):
+        '''Usage: returnCode, data = GetAlgorithmDesired(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SPNR_ALGORITHM_E <<FLR_SPNR_ALGORITHM_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spnr_GetAlgorithmDesired()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAlgorithmDesired()
+
+
+    @exception_wrapper
+    def spnrSetDFFast(self, dffast):
+        '''Usage: returnCode = SetDFFast(self, dffast)
+            Input_01 dffast <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetDFFast(dffast)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDFFast()
+
+
+    @exception_wrapper
+    def spnrGetDFFast(self):
+        '''Usage: returnCode, dffast = GetDFFast(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 dffast <class 'float'> <<FLOAT>>
+        '''
+        returnCode, dffast = self.CLIENT_pkg_spnr_GetDFFast()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, dffast)
+    # End of GetDFFast()
+
+
+    @exception_wrapper
+    def spnrSetDFSlow(self, dfslow):
+        '''Usage: returnCode = SetDFSlow(self, dfslow)
+            Input_01 dfslow <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetDFSlow(dfslow)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDFSlow()
+
+
+    @exception_wrapper
+    def spnrGetDFSlow(self):
+        '''Usage: returnCode, dfslow = GetDFSlow(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 dfslow <class 'float'> <<FLOAT>>
+        '''
+        returnCode, dfslow = self.CLIENT_pkg_spnr_GetDFSlow()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, dfslow)
+    # End of GetDFSlow()
+
+
+    @exception_wrapper
+    def spnrSetSensitivityThreshold(self, threshold):
+        '''Usage: returnCode = SetSensitivityThreshold(self, threshold)
+            Input_01 threshold <class 'float'> <<FLOAT>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetSensitivityThreshold(threshold)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSensitivityThreshold()
+
+
+    @exception_wrapper
+    def spnrGetSensitivityThreshold(self):
+        '''Usage: returnCode, threshold = GetSensitivityThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 threshold <class 'float'> <<FLOAT>>
+        '''
+        returnCode, threshold = self.CLIENT_pkg_spnr_GetSensitivityThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, threshold)
+    # End of GetSensitivityThreshold()
+
+
+    @exception_wrapper
+    def spnrSetReset(self, resetType):
+        '''Usage: returnCode = SetReset(self, resetType)
+            Input_01 resetType FLR_SPNR_RESET_E <<FLR_SPNR_RESET_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spnr_SetReset(resetType)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetReset()
@@ -0,0 +1,158 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: spotMeter, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def spotMeterSetEnable(self, data):
+        '''Usage: returnCode = SetEnable(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spotMeter_SetEnable(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnable()
+
+
+    @exception_wrapper
+    def spotMeterGetEnable(self):
+        '''Usage: returnCode, data = GetEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_spotMeter_GetEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEnable()
+
+
+    @exception_wrapper
+    def spotMeterGetRoiMaxSize(self):
+        '''Usage: returnCode, width, height = GetRoiMaxSize(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 width <class 'int'> <<UINT_16>>
+            Output_02 height <class 'int'> <<UINT_16>>
+        '''
+        returnCode, width, height = self.CLIENT_pkg_spotMeter_GetRoiMaxSize()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, width, height)
+    # End of GetRoiMaxSize()
+
+
+    @exception_wrapper
+    def spotMeterSetRoi(self, roi):
+        '''Usage: returnCode = SetRoi(self, roi)
+            Input_01 roi FLR_ROI_T <<FLR_ROI_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spotMeter_SetRoi(roi)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetRoi()
+
+
+    @exception_wrapper
+    def spotMeterGetRoi(self):
+        '''Usage: returnCode, roi = GetRoi(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 roi FLR_ROI_T <<FLR_ROI_T>>
+        '''
+        returnCode, roi = self.CLIENT_pkg_spotMeter_GetRoi()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, roi)
+    # End of GetRoi()
+
+
+    @exception_wrapper
+    def spotMeterGetSpotStats(self):
+        '''Usage: returnCode, mean, deviation, min, max = GetSpotStats(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mean <class 'int'> <<UINT_16>>
+            Output_02 deviation <class 'int'> <<UINT_16>>
+            Output_03 min FLR_SPOTMETER_SPOT_PARAM_T <<FLR_SPOTMETER_SPOT_PARAM_T>>
+            Output_04 max FLR_SPOTMETER_SPOT_PARAM_T <<FLR_SPOTMETER_SPOT_PARAM_T>>
+        '''
+        returnCode, mean, deviation, min, max = self.CLIENT_pkg_spotMeter_GetSpotStats()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None)
+        
+        return ( returnCode, mean, deviation, min, max)
+    # End of GetSpotStats()
+
+
+    @exception_wrapper
+    def spotMeterSetStatsMode(self, mode):
+        '''Usage: returnCode = SetStatsMode(self, mode)
+            Input_01 mode FLR_SPOTMETER_STATS_TEMP_MODE_E <<FLR_SPOTMETER_STATS_TEMP_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_spotMeter_SetStatsMode(mode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetStatsMode()
+
+
+    @exception_wrapper
+    def spotMeterGetStatsMode(self):
+        '''Usage: returnCode, mode = GetStatsMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mode FLR_SPOTMETER_STATS_TEMP_MODE_E <<FLR_SPOTMETER_STATS_TEMP_MODE_E>>
+        '''
+        returnCode, mode = self.CLIENT_pkg_spotMeter_GetStatsMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, mode)
+    # End of GetStatsMode()
+
+
+    @exception_wrapper
+    def spotMeterGetTempStats(self):
+        '''Usage: returnCode, mean, deviation, min, max = GetTempStats(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 mean <class 'float'> <<FLOAT>>
+            Output_02 deviation <class 'float'> <<FLOAT>>
+            Output_03 min FLR_SPOTMETER_STAT_PARAM_TEMP_T <<FLR_SPOTMETER_STAT_PARAM_TEMP_T>>
+            Output_04 max FLR_SPOTMETER_STAT_PARAM_TEMP_T <<FLR_SPOTMETER_STAT_PARAM_TEMP_T>>
+        '''
+        returnCode, mean, deviation, min, max = self.CLIENT_pkg_spotMeter_GetTempStats()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None, None)
+        
+        return ( returnCode, mean, deviation, min, max)
+    # End of GetTempStats()
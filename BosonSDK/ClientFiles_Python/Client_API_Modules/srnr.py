@@ -0,0 +1,167 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: srnr, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def srnrSetEnableState(self, data):
+        '''Usage: returnCode = SetEnableState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_srnr_SetEnableState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnableState()
+
+
+    @exception_wrapper
+    def srnrGetEnableState(self):
+        '''Usage: returnCode, data = GetEnableState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_srnr_GetEnableState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEnableState()
+
+
+    @exception_wrapper
+    def srnrSetThRowSum(self, data):
+        '''Usage: returnCode = SetThRowSum(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_srnr_SetThRowSum(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThRowSum()
+
+
+    @exception_wrapper
+    def srnrGetThRowSum(self):
+        '''Usage: returnCode, data = GetThRowSum(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_srnr_GetThRowSum()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThRowSum()
+
+
+    @exception_wrapper
+    def srnrSetThPixel(self, data):
+        '''Usage: returnCode = SetThPixel(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_srnr_SetThPixel(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetThPixel()
+
+
+    @exception_wrapper
+    def srnrGetThPixel(self):
+        '''Usage: returnCode, data = GetThPixel(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_srnr_GetThPixel()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThPixel()
+
+
+    @exception_wrapper
+    def srnrSetMaxCorr(self, data):
+        '''Usage: returnCode = SetMaxCorr(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_srnr_SetMaxCorr(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMaxCorr()
+
+
+    @exception_wrapper
+    def srnrGetMaxCorr(self):
+        '''Usage: returnCode, data = GetMaxCorr(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_srnr_GetMaxCorr()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxCorr()
+
+
+    @exception_wrapper
+    def srnrGetThPixelApplied(self):
+        '''Usage: returnCode, data = GetThPixelApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_srnr_GetThPixelApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetThPixelApplied()
+
+
+    @exception_wrapper
+    def srnrGetMaxCorrApplied(self):
+        '''Usage: returnCode, data = GetMaxCorrApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_srnr_GetMaxCorrApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxCorrApplied()
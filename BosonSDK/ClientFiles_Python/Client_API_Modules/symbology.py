@@ -0,0 +1,830 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: symbology, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def symbologySetEnable(self, draw_symbols):
+        '''Usage: returnCode = SetEnable(self, draw_symbols)
+            Input_01 draw_symbols FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SetEnable(draw_symbols)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnable()
+
+
+    @exception_wrapper
+    def symbologyCreateBitmap(self, ID, pos_X, pos_Y, width, height):
+        '''Usage: returnCode = CreateBitmap(self, ID, pos_X, pos_Y, width, height)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateBitmap(ID, pos_X, pos_Y, width, height)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateBitmap()
+
+
+    @exception_wrapper
+    def symbologySendData(self, ID, size, text):
+        '''Usage: returnCode = SendData(self, ID, size, text)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 size <class 'int'> <<INT_16>>
+            Input_03 text[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SendData(ID, size, text)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SendData()
+
+
+    @exception_wrapper
+    def symbologyCreateArc(self, ID, pos_X, pos_Y, width, height, start_angle, end_angle, color):
+        '''Usage: returnCode = CreateArc(self, ID, pos_X, pos_Y, width, height, start_angle, end_angle, color)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 start_angle <class 'float'> <<FLOAT>>
+            Input_07 end_angle <class 'float'> <<FLOAT>>
+            Input_08 color <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateArc(ID, pos_X, pos_Y, width, height, start_angle, end_angle, color)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateArc()
+
+
+    @exception_wrapper
+    def symbologyCreateText(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color, text):
+        '''Usage: returnCode = CreateText(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color, text)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 font <class 'int'> <<CHAR>>
+            Input_07 size <class 'int'> <<INT_16>>
+            Input_08 alignment FLR_SYMBOLOGY_TEXT_ALIGNMENT_E <<FLR_SYMBOLOGY_TEXT_ALIGNMENT_E>>
+            Input_09 color <class 'int'> <<UINT_32>>
+            Input_10 text[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateText(ID, pos_X, pos_Y, width, height, font, size, alignment, color, text)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateText()
+
+
+    @exception_wrapper
+    def symbologyMoveSprite(self, ID, pos_X, pos_Y):
+        '''Usage: returnCode = MoveSprite(self, ID, pos_X, pos_Y)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_MoveSprite(ID, pos_X, pos_Y)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of MoveSprite()
+
+
+    @exception_wrapper
+    def symbologyAddToGroup(self, ID, group_ID):
+        '''Usage: returnCode = AddToGroup(self, ID, group_ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 group_ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_AddToGroup(ID, group_ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of AddToGroup()
+
+
+    @exception_wrapper
+    def symbologyRemoveFromGroup(self, ID, group_ID):
+        '''Usage: returnCode = RemoveFromGroup(self, ID, group_ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 group_ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_RemoveFromGroup(ID, group_ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of RemoveFromGroup()
+
+
+    @exception_wrapper
+    def symbologyUpdateAndShow(self, ID, visible):
+        '''Usage: returnCode = UpdateAndShow(self, ID, visible)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 visible <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_UpdateAndShow(ID, visible)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of UpdateAndShow()
+
+
+    @exception_wrapper
+    def symbologyUpdateAndShowGroup(self, group_ID, visible):
+        '''Usage: returnCode = UpdateAndShowGroup(self, group_ID, visible)
+            Input_01 group_ID <class 'int'> <<UCHAR>>
+            Input_02 visible <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_UpdateAndShowGroup(group_ID, visible)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of UpdateAndShowGroup()
+
+
+    @exception_wrapper
+    def symbologyDelete(self, ID):
+        '''Usage: returnCode = Delete(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_Delete(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of Delete()
+
+
+    @exception_wrapper
+    def symbologyDeleteGroup(self, group_ID):
+        '''Usage: returnCode = DeleteGroup(self, group_ID)
+            Input_01 group_ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_DeleteGroup(group_ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of DeleteGroup()
+
+
+    @exception_wrapper
+    def symbologyCreateFilledRectangle(self, ID, pos_X, pos_Y, width, height, color):
+        '''Usage: returnCode = CreateFilledRectangle(self, ID, pos_X, pos_Y, width, height, color)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 color <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateFilledRectangle(ID, pos_X, pos_Y, width, height, color)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateFilledRectangle()
+
+
+    @exception_wrapper
+    def symbologyCreateOutlinedRectangle(self, ID, pos_X, pos_Y, width, height, color):
+        '''Usage: returnCode = CreateOutlinedRectangle(self, ID, pos_X, pos_Y, width, height, color)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 color <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateOutlinedRectangle(ID, pos_X, pos_Y, width, height, color)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateOutlinedRectangle()
+
+
+    @exception_wrapper
+    def symbologyCreateBitmapFromPng(self, ID, pos_X, pos_Y, size):
+        '''Usage: returnCode = CreateBitmapFromPng(self, ID, pos_X, pos_Y, size)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 size <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateBitmapFromPng(ID, pos_X, pos_Y, size)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateBitmapFromPng()
+
+
+    @exception_wrapper
+    def symbologyCreateCompressedBitmap(self, ID, pos_X, pos_Y, width, height):
+        '''Usage: returnCode = CreateCompressedBitmap(self, ID, pos_X, pos_Y, width, height)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateCompressedBitmap(ID, pos_X, pos_Y, width, height)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateCompressedBitmap()
+
+
+    @exception_wrapper
+    def symbologyCreateBitmapFromPngFile(self, ID, pos_X, pos_Y, path):
+        '''Usage: returnCode = CreateBitmapFromPngFile(self, ID, pos_X, pos_Y, path)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 path[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateBitmapFromPngFile(ID, pos_X, pos_Y, path)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateBitmapFromPngFile()
+
+
+    @exception_wrapper
+    def symbologyCreateBitmapFromFile(self, ID, pos_X, pos_Y, path, imageType):
+        '''Usage: returnCode = CreateBitmapFromFile(self, ID, pos_X, pos_Y, path, imageType)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 path[<class 'int'>] 128 <<UCHAR*128>>
+            Input_05 imageType FLR_SYMBOLOGY_IMAGE_TYPE_E <<FLR_SYMBOLOGY_IMAGE_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateBitmapFromFile(ID, pos_X, pos_Y, path, imageType)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateBitmapFromFile()
+
+
+    @exception_wrapper
+    def symbologyResetWritePosition(self, ID):
+        '''Usage: returnCode = ResetWritePosition(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_ResetWritePosition(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of ResetWritePosition()
+
+
+    @exception_wrapper
+    def symbologyMoveByOffset(self, ID, off_X, off_Y):
+        '''Usage: returnCode = MoveByOffset(self, ID, off_X, off_Y)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 off_X <class 'int'> <<INT_16>>
+            Input_03 off_Y <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_MoveByOffset(ID, off_X, off_Y)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of MoveByOffset()
+
+
+    @exception_wrapper
+    def symbologyMoveGroupByOffset(self, ID, off_X, off_Y):
+        '''Usage: returnCode = MoveGroupByOffset(self, ID, off_X, off_Y)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 off_X <class 'int'> <<INT_16>>
+            Input_03 off_Y <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_MoveGroupByOffset(ID, off_X, off_Y)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of MoveGroupByOffset()
+
+
+    @exception_wrapper
+    def symbologyCreateFilledEllipse(self, ID, pos_X, pos_Y, width, height, color):
+        '''Usage: returnCode = CreateFilledEllipse(self, ID, pos_X, pos_Y, width, height, color)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 color <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateFilledEllipse(ID, pos_X, pos_Y, width, height, color)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateFilledEllipse()
+
+
+    @exception_wrapper
+    def symbologyCreateLine(self, ID, pos_X, pos_Y, pos_X2, pos_Y2, color):
+        '''Usage: returnCode = CreateLine(self, ID, pos_X, pos_Y, pos_X2, pos_Y2, color)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 pos_X2 <class 'int'> <<INT_16>>
+            Input_05 pos_Y2 <class 'int'> <<INT_16>>
+            Input_06 color <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateLine(ID, pos_X, pos_Y, pos_X2, pos_Y2, color)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateLine()
+
+
+    @exception_wrapper
+    def symbologySetZorder(self, ID, zorder):
+        '''Usage: returnCode = SetZorder(self, ID, zorder)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 zorder <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SetZorder(ID, zorder)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetZorder()
+
+
+    @exception_wrapper
+    def symbologySaveConfiguration(self):
+        '''Usage: returnCode = SaveConfiguration(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SaveConfiguration()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SaveConfiguration()
+
+
+    @exception_wrapper
+    def symbologyReloadConfiguration(self):
+        '''Usage: returnCode = ReloadConfiguration(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_ReloadConfiguration()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of ReloadConfiguration()
+
+
+    @exception_wrapper
+    def symbologyGetEnable(self):
+        '''Usage: returnCode, draw_symbols = GetEnable(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 draw_symbols FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, draw_symbols = self.CLIENT_pkg_symbology_GetEnable()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, draw_symbols)
+    # End of GetEnable()
+
+
+    @exception_wrapper
+    def symbologySetClonesNumber(self, ID, numberOfClones):
+        '''Usage: returnCode = SetClonesNumber(self, ID, numberOfClones)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 numberOfClones <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SetClonesNumber(ID, numberOfClones)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetClonesNumber()
+
+
+    @exception_wrapper
+    def symbologyMoveCloneByOffset(self, ID, cloneID, pos_X, pos_Y):
+        '''Usage: returnCode = MoveCloneByOffset(self, ID, cloneID, pos_X, pos_Y)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 cloneID <class 'int'> <<UCHAR>>
+            Input_03 pos_X <class 'int'> <<INT_16>>
+            Input_04 pos_Y <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_MoveCloneByOffset(ID, cloneID, pos_X, pos_Y)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of MoveCloneByOffset()
+
+
+    @exception_wrapper
+    def symbologyMoveCloneSprite(self, ID, cloneID, pos_X, pos_Y):
+        '''Usage: returnCode = MoveCloneSprite(self, ID, cloneID, pos_X, pos_Y)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 cloneID <class 'int'> <<UCHAR>>
+            Input_03 pos_X <class 'int'> <<INT_16>>
+            Input_04 pos_Y <class 'int'> <<INT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_MoveCloneSprite(ID, cloneID, pos_X, pos_Y)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of MoveCloneSprite()
+
+
+    @exception_wrapper
+    def symbologySetTransformation(self, transformation):
+        '''Usage: returnCode = SetTransformation(self, transformation)
+            Input_01 transformation FLR_SYMBOLOGY_TRANSFORMATION_E <<FLR_SYMBOLOGY_TRANSFORMATION_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SetTransformation(transformation)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTransformation()
+
+
+    @exception_wrapper
+    def symbologyUpdateAllVisible(self):
+        '''Usage: returnCode = UpdateAllVisible(self)
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_UpdateAllVisible()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of UpdateAllVisible()
+
+
+    @exception_wrapper
+    def symbologySetSizeAndScalingMode(self, ID, width, height, scalingMode):
+        '''Usage: returnCode = SetSizeAndScalingMode(self, ID, width, height, scalingMode)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 width <class 'int'> <<INT_16>>
+            Input_03 height <class 'int'> <<INT_16>>
+            Input_04 scalingMode FLR_SYMBOLOGY_SCALING_MODE_E <<FLR_SYMBOLOGY_SCALING_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_SetSizeAndScalingMode(ID, width, height, scalingMode)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSizeAndScalingMode()
+
+
+    @exception_wrapper
+    def symbologyCreateLineHVT(self, ID, pos_X, pos_Y, pos_X2, pos_Y2, color1, color2, dashLen, thickness):
+        '''Usage: returnCode = CreateLineHVT(self, ID, pos_X, pos_Y, pos_X2, pos_Y2, color1, color2, dashLen, thickness)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 pos_X2 <class 'int'> <<INT_16>>
+            Input_05 pos_Y2 <class 'int'> <<INT_16>>
+            Input_06 color1 <class 'int'> <<UINT_32>>
+            Input_07 color2 <class 'int'> <<UINT_32>>
+            Input_08 dashLen <class 'int'> <<UINT_16>>
+            Input_09 thickness <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateLineHVT(ID, pos_X, pos_Y, pos_X2, pos_Y2, color1, color2, dashLen, thickness)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateLineHVT()
+
+
+    @exception_wrapper
+    def symbologyCreateTextHVT(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color1, color2, dashLen, text):
+        '''Usage: returnCode = CreateTextHVT(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color1, color2, dashLen, text)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 font <class 'int'> <<CHAR>>
+            Input_07 size <class 'int'> <<INT_16>>
+            Input_08 alignment FLR_SYMBOLOGY_TEXT_ALIGNMENT_E <<FLR_SYMBOLOGY_TEXT_ALIGNMENT_E>>
+            Input_09 color1 <class 'int'> <<UINT_32>>
+            Input_10 color2 <class 'int'> <<UINT_32>>
+            Input_11 dashLen <class 'int'> <<UCHAR>>
+            Input_12 text[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateTextHVT(ID, pos_X, pos_Y, width, height, font, size, alignment, color1, color2, dashLen, text)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateTextHVT()
+
+
+    @exception_wrapper
+    def symbologyCreateTextBg(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color, bgColor, text):
+        '''Usage: returnCode = CreateTextBg(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color, bgColor, text)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 font <class 'int'> <<CHAR>>
+            Input_07 size <class 'int'> <<INT_16>>
+            Input_08 alignment FLR_SYMBOLOGY_TEXT_ALIGNMENT_E <<FLR_SYMBOLOGY_TEXT_ALIGNMENT_E>>
+            Input_09 color <class 'int'> <<UINT_32>>
+            Input_10 bgColor <class 'int'> <<UINT_32>>
+            Input_11 text[<class 'int'>] 128 <<UCHAR*128>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateTextBg(ID, pos_X, pos_Y, width, height, font, size, alignment, color, bgColor, text)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateTextBg()
+
+
+    @exception_wrapper
+    def symbologyCreateScaledBitmapFromFile(self, ID, pos_X, pos_Y, width, height, scalingMode, path, imageType):
+        '''Usage: returnCode = CreateScaledBitmapFromFile(self, ID, pos_X, pos_Y, width, height, scalingMode, path, imageType)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Input_02 pos_X <class 'int'> <<INT_16>>
+            Input_03 pos_Y <class 'int'> <<INT_16>>
+            Input_04 width <class 'int'> <<INT_16>>
+            Input_05 height <class 'int'> <<INT_16>>
+            Input_06 scalingMode FLR_SYMBOLOGY_SCALING_MODE_E <<FLR_SYMBOLOGY_SCALING_MODE_E>>
+            Input_07 path[<class 'int'>] 128 <<UCHAR*128>>
+            Input_08 imageType FLR_SYMBOLOGY_IMAGE_TYPE_E <<FLR_SYMBOLOGY_IMAGE_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CreateScaledBitmapFromFile(ID, pos_X, pos_Y, width, height, scalingMode, path, imageType)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CreateScaledBitmapFromFile()
+
+
+    @exception_wrapper
+    def symbologyGetLocation(self, ID):
+        '''Usage: returnCode, pos_X, pos_Y = GetLocation(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 pos_X <class 'int'> <<INT_16>>
+            Output_02 pos_Y <class 'int'> <<INT_16>>
+        '''
+        returnCode, pos_X, pos_Y = self.CLIENT_pkg_symbology_GetLocation(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, pos_X, pos_Y)
+    # End of GetLocation()
+
+
+    @exception_wrapper
+    def symbologyGetSize(self, ID):
+        '''Usage: returnCode, width, height = GetSize(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 width <class 'int'> <<INT_16>>
+            Output_02 height <class 'int'> <<INT_16>>
+        '''
+        returnCode, width, height = self.CLIENT_pkg_symbology_GetSize(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, width, height)
+    # End of GetSize()
+
+
+    @exception_wrapper
+    def symbologyGetZorder(self, ID):
+        '''Usage: returnCode, zorder = GetZorder(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 zorder <class 'int'> <<UCHAR>>
+        '''
+        returnCode, zorder = self.CLIENT_pkg_symbology_GetZorder(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, zorder)
+    # End of GetZorder()
+
+
+    @exception_wrapper
+    def symbologyGetColor(self, ID):
+        '''Usage: returnCode, color = GetColor(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 color <class 'int'> <<UINT_32>>
+        '''
+        returnCode, color = self.CLIENT_pkg_symbology_GetColor(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, color)
+    # End of GetColor()
+
+
+    @exception_wrapper
+    def symbologyGetType(self, ID):
+        '''Usage: returnCode, type = GetType(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 type FLR_SYMBOLOGY_TYPE_E <<FLR_SYMBOLOGY_TYPE_E>>
+        '''
+        returnCode, type = self.CLIENT_pkg_symbology_GetType(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, type)
+    # End of GetType()
+
+
+    @exception_wrapper
+    def symbologyCopySymbol(self, source, destination):
+        '''Usage: returnCode = CopySymbol(self, source, destination)
+            Input_01 source <class 'int'> <<UCHAR>>
+            Input_02 destination <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_symbology_CopySymbol(source, destination)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of CopySymbol()
+
+
+    @exception_wrapper
+    def symbologyGetTextFontSize(self, ID):
+        '''Usage: returnCode, size = GetTextFontSize(self, ID)
+            Input_01 ID <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 size <class 'int'> <<INT_16>>
+        '''
+        returnCode, size = self.CLIENT_pkg_symbology_GetTextFontSize(ID)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, size)
+    # End of GetTextFontSize()
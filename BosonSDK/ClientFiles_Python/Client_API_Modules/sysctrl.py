@@ -0,0 +1,183 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: sysctrl, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def sysctrlSetFreezeState(self, data):
+        '''Usage: returnCode = SetFreezeState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sysctrl_SetFreezeState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFreezeState()
+
+
+    @exception_wrapper
+    def sysctrlGetFreezeState(self):
+        '''Usage: returnCode, data = GetFreezeState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sysctrl_GetFreezeState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFreezeState()
+
+
+    @exception_wrapper
+    def sysctrlGetCameraFrameRate(self):
+        '''Usage: returnCode, frameRate = GetCameraFrameRate(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 frameRate <class 'int'> <<UINT_32>>
+        '''
+        returnCode, frameRate = self.CLIENT_pkg_sysctrl_GetCameraFrameRate()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, frameRate)
+    # End of GetCameraFrameRate()
+
+
+    @exception_wrapper
+    def sysctrlGetUptimeSecs(self):
+        '''Usage: returnCode, uptime = GetUptimeSecs(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 uptime <class 'int'> <<UINT_32>>
+        '''
+        returnCode, uptime = self.CLIENT_pkg_sysctrl_GetUptimeSecs()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, uptime)
+    # End of GetUptimeSecs()
+
+
+    @exception_wrapper
+    def sysctrlSetUsbVideoIR16Mode(self, data):
+        '''Usage: returnCode = SetUsbVideoIR16Mode(self, data)
+            Input_01 data FLR_SYSCTRL_USBIR16_MODE_E <<FLR_SYSCTRL_USBIR16_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sysctrl_SetUsbVideoIR16Mode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetUsbVideoIR16Mode()
+
+
+    @exception_wrapper
+    def sysctrlGetUsbVideoIR16Mode(self):
+        '''Usage: returnCode, data = GetUsbVideoIR16Mode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SYSCTRL_USBIR16_MODE_E <<FLR_SYSCTRL_USBIR16_MODE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sysctrl_GetUsbVideoIR16Mode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetUsbVideoIR16Mode()
+
+
+    @exception_wrapper
+    def sysctrlSetOperatingMode(self, data):
+        '''Usage: returnCode = SetOperatingMode(self, data)
+            Input_01 data FLR_SYSCTRL_OPERATING_MODE_E <<FLR_SYSCTRL_OPERATING_MODE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sysctrl_SetOperatingMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOperatingMode()
+
+
+    @exception_wrapper
+    def sysctrlGetOperatingMode(self):
+        '''Usage: returnCode, data = GetOperatingMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_SYSCTRL_OPERATING_MODE_E <<FLR_SYSCTRL_OPERATING_MODE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sysctrl_GetOperatingMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOperatingMode()
+
+
+    @exception_wrapper
+    def sysctrlGetAvgFpaTempCounts(self):
+        '''Usage: returnCode, data = GetAvgFpaTempCounts(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'float'> <<FLOAT>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sysctrl_GetAvgFpaTempCounts()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetAvgFpaTempCounts()
+
+
+    @exception_wrapper
+    def sysctrlSetFpaTempFrames(self, data):
+        '''Usage: returnCode = SetFpaTempFrames(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_sysctrl_SetFpaTempFrames(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetFpaTempFrames()
+
+
+    @exception_wrapper
+    def sysctrlGetFpaTempFrames(self):
+        '''Usage: returnCode, data = GetFpaTempFrames(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_sysctrl_GetFpaTempFrames()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetFpaTempFrames()
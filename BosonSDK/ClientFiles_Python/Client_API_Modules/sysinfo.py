@@ -0,0 +1,253 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: sysinfo, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def sysinfoGetMonitorSoftwareRev(self):
+        '''Usage: returnCode, major, minor, patch = GetMonitorSoftwareRev(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 major <class 'int'> <<UINT_32>>
+            Output_02 minor <class 'int'> <<UINT_32>>
+            Output_03 patch <class 'int'> <<UINT_32>>
+        '''
+        returnCode, major, minor, patch = self.CLIENT_pkg_sysinfo_GetMonitorSoftwareRev()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, major, minor, patch)
+    # End of GetMonitorSoftwareRev()
+
+
+    @exception_wrapper
+    def sysinfoGetMonitorBuildVariant(self):
+        '''Usage: returnCode, monitorBuildVariant = GetMonitorBuildVariant(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 monitorBuildVariant FLR_SYSINFO_MONITOR_BUILD_VARIANT_T <<FLR_SYSINFO_MONITOR_BUILD_VARIANT_T>>
+        '''
+        returnCode, monitorBuildVariant = self.CLIENT_pkg_sysinfo_GetMonitorBuildVariant()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, monitorBuildVariant)
+    # End of GetMonitorBuildVariant()
+
+
+    @exception_wrapper
+    def sysinfoGetProductName(self):
+        '''Usage: returnCode, name = GetProductName(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 name[<class 'int'>] 128 <<UCHAR*128>>
+        '''
+        returnCode, name = self.CLIENT_pkg_sysinfo_GetProductName()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, name)
+    # End of GetProductName()
+
+
+    @exception_wrapper
+    def sysinfoGetCameraSN(self):
+        '''Usage: returnCode, number = GetCameraSN(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 number[<class 'int'>] 128 <<UCHAR*128>>
+        '''
+        returnCode, number = self.CLIENT_pkg_sysinfo_GetCameraSN()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, number)
+    # End of GetCameraSN()
+
+
+    @exception_wrapper
+    def sysinfoGetBootLocation(self):
+        '''Usage: returnCode, bootSwLocation = GetBootLocation(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 bootSwLocation <class 'int'> <<UINT_32>>
+        '''
+        returnCode, bootSwLocation = self.CLIENT_pkg_sysinfo_GetBootLocation()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, bootSwLocation)
+    # End of GetBootLocation()
+
+
+    @exception_wrapper
+    def sysinfoGetSwConfigID(self):
+        '''Usage: returnCode, swConfigID = GetSwConfigID(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 swConfigID FLR_SYSINFO_SW_CONFIG_ID_E <<FLR_SYSINFO_SW_CONFIG_ID_E>>
+        '''
+        returnCode, swConfigID = self.CLIENT_pkg_sysinfo_GetSwConfigID()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, swConfigID)
+    # End of GetSwConfigID()
+
+
+    @exception_wrapper
+    def sysinfoGetSwPermissions(self):
+        '''Usage: returnCode, swPermissions = GetSwPermissions(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 swPermissions FLR_SYSINFO_SW_PERMISSIONS_E <<FLR_SYSINFO_SW_PERMISSIONS_E>>
+        '''
+        returnCode, swPermissions = self.CLIENT_pkg_sysinfo_GetSwPermissions()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, swPermissions)
+    # End of GetSwPermissions()
+
+
+    @exception_wrapper
+    def sysinfoGetIs9HzBuild(self):
+        '''Usage: returnCode, is9HzBuild = GetIs9HzBuild(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 is9HzBuild <class 'int'> <<UINT_32>>
+        '''
+        returnCode, is9HzBuild = self.CLIENT_pkg_sysinfo_GetIs9HzBuild()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, is9HzBuild)
+    # End of GetIs9HzBuild()
+
+
+    @exception_wrapper
+    def sysinfoGetProductVersion(self):
+        '''Usage: returnCode, major, minor, patch = GetProductVersion(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 major <class 'int'> <<UINT_32>>
+            Output_02 minor <class 'int'> <<UINT_32>>
+            Output_03 patch <class 'int'> <<UINT_32>>
+        '''
+        returnCode, major, minor, patch = self.CLIENT_pkg_sysinfo_GetProductVersion()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, major, minor, patch)
+    # End of GetProductVersion()
+
+
+    @exception_wrapper
+    def sysinfoGetMonitorProductRev(self):
+        '''Usage: returnCode, major, minor, patch = GetMonitorProductRev(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 major <class 'int'> <<UINT_32>>
+            Output_02 minor <class 'int'> <<UINT_32>>
+            Output_03 patch <class 'int'> <<UINT_32>>
+        '''
+        returnCode, major, minor, patch = self.CLIENT_pkg_sysinfo_GetMonitorProductRev()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, major, minor, patch)
+    # End of GetMonitorProductRev()
+
+
+    @exception_wrapper
+    def sysinfoGetOpticalRevision(self):
+        '''Usage: returnCode, revision = GetOpticalRevision(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 revision <class 'int'> <<UINT_16>>
+        '''
+        returnCode, revision = self.CLIENT_pkg_sysinfo_GetOpticalRevision()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, revision)
+    # End of GetOpticalRevision()
+
+
+    @exception_wrapper
+    def sysinfoGetSensorRevision(self):
+        '''Usage: returnCode, revision = GetSensorRevision(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 revision <class 'int'> <<UINT_16>>
+        '''
+        returnCode, revision = self.CLIENT_pkg_sysinfo_GetSensorRevision()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, revision)
+    # End of GetSensorRevision()
+
+
+    @exception_wrapper
+    def sysinfoGetProbeTipSN(self):
+        '''Usage: returnCode, number = GetProbeTipSN(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 number[<class 'int'>] 128 <<UCHAR*128>>
+        '''
+        returnCode, number = self.CLIENT_pkg_sysinfo_GetProbeTipSN()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, number)
+    # End of GetProbeTipSN()
+
+
+    @exception_wrapper
+    def sysinfoGetMechanicalRevision(self):
+        '''Usage: returnCode, revision = GetMechanicalRevision(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 revision <class 'int'> <<UINT_16>>
+        '''
+        returnCode, revision = self.CLIENT_pkg_sysinfo_GetMechanicalRevision()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, revision)
+    # End of GetMechanicalRevision()
+
+
+    @exception_wrapper
+    def sysinfoGetProbeTipType(self):
+        '''Usage: returnCode, type = GetProbeTipType(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 type FLR_SYSINFO_PROBE_TIP_TYPE <<FLR_SYSINFO_PROBE_TIP_TYPE>>
+        '''
+        returnCode, type = self.CLIENT_pkg_sysinfo_GetProbeTipType()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, type)
+    # End of GetProbeTipType()
@@ -0,0 +1,241 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: systemSymbols, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def systemSymbolsGetID(self, symbol):
+        '''Usage: returnCode, id, id_type = GetID(self, symbol)
+            Input_01 symbol FLR_SYSTEMSYMBOLS_SYMBOL_E <<FLR_SYSTEMSYMBOLS_SYMBOL_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 id <class 'int'> <<UCHAR>>
+            Output_02 id_type FLR_SYSTEMSYMBOLS_ID_TYPE_E <<FLR_SYSTEMSYMBOLS_ID_TYPE_E>>
+        '''
+        returnCode, id, id_type = self.CLIENT_pkg_systemSymbols_GetID(symbol)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None)
+        
+        return ( returnCode, id, id_type)
+    # End of GetID()
+
+
+    @exception_wrapper
+    def systemSymbolsSetID(self, symbol, id, id_type):
+        '''Usage: returnCode = SetID(self, symbol, id, id_type)
+            Input_01 symbol FLR_SYSTEMSYMBOLS_SYMBOL_E <<FLR_SYSTEMSYMBOLS_SYMBOL_E>>
+            Input_02 id <class 'int'> <<UCHAR>>
+            Input_03 id_type FLR_SYSTEMSYMBOLS_ID_TYPE_E <<FLR_SYSTEMSYMBOLS_ID_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetID(symbol, id, id_type)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetID()
+
+
+    @exception_wrapper
+    def systemSymbolsGetEnable(self, symbol):
+        '''Usage: returnCode, enabled = GetEnable(self, symbol)
+            Input_01 symbol FLR_SYSTEMSYMBOLS_SYMBOL_E <<FLR_SYSTEMSYMBOLS_SYMBOL_E>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 enabled FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, enabled = self.CLIENT_pkg_systemSymbols_GetEnable(symbol)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, enabled)
+    # End of GetEnable()
+
+
+    @exception_wrapper
+    def systemSymbolsSetEnable(self, symbol, enabled):
+        '''Usage: returnCode = SetEnable(self, symbol, enabled)
+            Input_01 symbol FLR_SYSTEMSYMBOLS_SYMBOL_E <<FLR_SYSTEMSYMBOLS_SYMBOL_E>>
+            Input_02 enabled FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetEnable(symbol, enabled)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnable()
+
+
+    @exception_wrapper
+    def systemSymbolsGetSpotConfig(self):
+        '''Usage: returnCode, config = GetSpotConfig(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 config FLR_SYSTEMSYMBOLS_SPOTCONFIG_T <<FLR_SYSTEMSYMBOLS_SPOTCONFIG_T>>
+        '''
+        returnCode, config = self.CLIENT_pkg_systemSymbols_GetSpotConfig()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, config)
+    # End of GetSpotConfig()
+
+
+    @exception_wrapper
+    def systemSymbolsSetSpotConfig(self, config):
+        '''Usage: returnCode = SetSpotConfig(self, config)
+            Input_01 config FLR_SYSTEMSYMBOLS_SPOTCONFIG_T <<FLR_SYSTEMSYMBOLS_SPOTCONFIG_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetSpotConfig(config)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpotConfig()
+
+
+    @exception_wrapper
+    def systemSymbolsGetIsoConfig(self):
+        '''Usage: returnCode, config = GetIsoConfig(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 config FLR_SYSTEMSYMBOLS_ISOCONFIG_T <<FLR_SYSTEMSYMBOLS_ISOCONFIG_T>>
+        '''
+        returnCode, config = self.CLIENT_pkg_systemSymbols_GetIsoConfig()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, config)
+    # End of GetIsoConfig()
+
+
+    @exception_wrapper
+    def systemSymbolsSetIsoConfig(self, config):
+        '''Usage: returnCode = SetIsoConfig(self, config)
+            Input_01 config FLR_SYSTEMSYMBOLS_ISOCONFIG_T <<FLR_SYSTEMSYMBOLS_ISOCONFIG_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetIsoConfig(config)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIsoConfig()
+
+
+    @exception_wrapper
+    def systemSymbolsGetBarConfig(self):
+        '''Usage: returnCode, lowGainConfig, highGainConfig, unit = GetBarConfig(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 lowGainConfig FLR_SYSTEMSYMBOLS_BARCONFIG_T <<FLR_SYSTEMSYMBOLS_BARCONFIG_T>>
+            Output_02 highGainConfig FLR_SYSTEMSYMBOLS_BARCONFIG_T <<FLR_SYSTEMSYMBOLS_BARCONFIG_T>>
+            Output_03 unit FLR_TEMPERATURE_UNIT_E <<FLR_TEMPERATURE_UNIT_E>>
+        '''
+        returnCode, lowGainConfig, highGainConfig, unit = self.CLIENT_pkg_systemSymbols_GetBarConfig()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None, None, None)
+        
+        return ( returnCode, lowGainConfig, highGainConfig, unit)
+    # End of GetBarConfig()
+
+
+    @exception_wrapper
+    def systemSymbolsSetBarConfig(self, lowGainConfig, highGainConfig, unit):
+        '''Usage: returnCode = SetBarConfig(self, lowGainConfig, highGainConfig, unit)
+            Input_01 lowGainConfig FLR_SYSTEMSYMBOLS_BARCONFIG_T <<FLR_SYSTEMSYMBOLS_BARCONFIG_T>>
+            Input_02 highGainConfig FLR_SYSTEMSYMBOLS_BARCONFIG_T <<FLR_SYSTEMSYMBOLS_BARCONFIG_T>>
+            Input_03 unit FLR_TEMPERATURE_UNIT_E <<FLR_TEMPERATURE_UNIT_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetBarConfig(lowGainConfig, highGainConfig, unit)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetBarConfig()
+
+
+    @exception_wrapper
+    def systemSymbolsGetSpotConfigIds(self):
+        '''Usage: returnCode, config = GetSpotConfigIds(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 config FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T <<FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T>>
+        '''
+        returnCode, config = self.CLIENT_pkg_systemSymbols_GetSpotConfigIds()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, config)
+    # End of GetSpotConfigIds()
+
+
+    @exception_wrapper
+    def systemSymbolsSetSpotConfigIds(self, config):
+        '''Usage: returnCode = SetSpotConfigIds(self, config)
+            Input_01 config FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T <<FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetSpotConfigIds(config)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSpotConfigIds()
+
+
+    @exception_wrapper
+    def systemSymbolsGetIsoConfigIds(self):
+        '''Usage: returnCode, config = GetIsoConfigIds(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 config FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T <<FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T>>
+        '''
+        returnCode, config = self.CLIENT_pkg_systemSymbols_GetIsoConfigIds()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, config)
+    # End of GetIsoConfigIds()
+
+
+    @exception_wrapper
+    def systemSymbolsSetIsoConfigIds(self, config):
+        '''Usage: returnCode = SetIsoConfigIds(self, config)
+            Input_01 config FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T <<FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_systemSymbols_SetIsoConfigIds(config)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIsoConfigIds()
@@ -0,0 +1,199 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: telemetry, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def telemetrySetState(self, data):
+        '''Usage: returnCode = SetState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_telemetry_SetState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetState()
+
+
+    @exception_wrapper
+    def telemetryGetState(self):
+        '''Usage: returnCode, data = GetState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_telemetry_GetState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetState()
+
+
+    @exception_wrapper
+    def telemetrySetLocation(self, data):
+        '''Usage: returnCode = SetLocation(self, data)
+            Input_01 data FLR_TELEMETRY_LOC_E <<FLR_TELEMETRY_LOC_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_telemetry_SetLocation(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetLocation()
+
+
+    @exception_wrapper
+    def telemetryGetLocation(self):
+        '''Usage: returnCode, data = GetLocation(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TELEMETRY_LOC_E <<FLR_TELEMETRY_LOC_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_telemetry_GetLocation()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetLocation()
+
+
+    @exception_wrapper
+    def telemetrySetPacking(self, data):
+        '''Usage: returnCode = SetPacking(self, data)
+            Input_01 data FLR_TELEMETRY_PACKING_E <<FLR_TELEMETRY_PACKING_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_telemetry_SetPacking(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetPacking()
+
+
+    @exception_wrapper
+    def telemetryGetPacking(self):
+        '''Usage: returnCode, data = GetPacking(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TELEMETRY_PACKING_E <<FLR_TELEMETRY_PACKING_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_telemetry_GetPacking()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetPacking()
+
+
+    @exception_wrapper
+    def telemetrySetOrder(self, data):
+        '''Usage: returnCode = SetOrder(self, data)
+            Input_01 data FLR_TELEMETRY_ORDER_E <<FLR_TELEMETRY_ORDER_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_telemetry_SetOrder(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetOrder()
+
+
+    @exception_wrapper
+    def telemetryGetOrder(self):
+        '''Usage: returnCode, data = GetOrder(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TELEMETRY_ORDER_E <<FLR_TELEMETRY_ORDER_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_telemetry_GetOrder()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetOrder()
+
+
+    @exception_wrapper
+    def telemetrySetPackingVC1(self, data):
+        '''Usage: returnCode = SetPackingVC1(self, data)
+            Input_01 data FLR_TELEMETRY_PACKING_E <<FLR_TELEMETRY_PACKING_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_telemetry_SetPackingVC1(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetPackingVC1()
+
+
+    @exception_wrapper
+    def telemetryGetPackingVC1(self):
+        '''Usage: returnCode, data = GetPackingVC1(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TELEMETRY_PACKING_E <<FLR_TELEMETRY_PACKING_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_telemetry_GetPackingVC1()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetPackingVC1()
+
+
+    @exception_wrapper
+    def telemetrySetMipiEmbeddedDataTag(self, data):
+        '''Usage: returnCode = SetMipiEmbeddedDataTag(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_telemetry_SetMipiEmbeddedDataTag(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMipiEmbeddedDataTag()
+
+
+    @exception_wrapper
+    def telemetryGetMipiEmbeddedDataTag(self):
+        '''Usage: returnCode, data = GetMipiEmbeddedDataTag(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_telemetry_GetMipiEmbeddedDataTag()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMipiEmbeddedDataTag()
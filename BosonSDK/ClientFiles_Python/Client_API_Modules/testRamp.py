@@ -0,0 +1,219 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: testRamp, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def testRampSetType(self, index, data):
+        '''Usage: returnCode = SetType(self, index, data)
+            Input_01 index <class 'int'> <<UCHAR>>
+            Input_02 data FLR_TESTRAMP_TYPE_E <<FLR_TESTRAMP_TYPE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_testRamp_SetType(index, data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetType()
+
+
+    @exception_wrapper
+    def testRampGetType(self, index):
+        '''Usage: returnCode, data = GetType(self, index)
+            Input_01 index <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TESTRAMP_TYPE_E <<FLR_TESTRAMP_TYPE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_testRamp_GetType(index)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetType()
+
+
+    @exception_wrapper
+    def testRampSetSettings(self, index, data):
+        '''Usage: returnCode = SetSettings(self, index, data)
+            Input_01 index <class 'int'> <<UCHAR>>
+            Input_02 data FLR_TESTRAMP_SETTINGS_T <<FLR_TESTRAMP_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_testRamp_SetSettings(index, data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetSettings()
+
+
+    @exception_wrapper
+    def testRampGetSettings(self, index):
+        '''Usage: returnCode, data = GetSettings(self, index)
+            Input_01 index <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TESTRAMP_SETTINGS_T <<FLR_TESTRAMP_SETTINGS_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_testRamp_GetSettings(index)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetSettings()
+
+
+    @exception_wrapper
+    def testRampSetMotionState(self, data):
+        '''Usage: returnCode = SetMotionState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_testRamp_SetMotionState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMotionState()
+
+
+    @exception_wrapper
+    def testRampGetMotionState(self):
+        '''Usage: returnCode, data = GetMotionState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_testRamp_GetMotionState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMotionState()
+
+
+    @exception_wrapper
+    def testRampSetIndex(self, data):
+        '''Usage: returnCode = SetIndex(self, data)
+            Input_01 data <class 'int'> <<UCHAR>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_testRamp_SetIndex(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetIndex()
+
+
+    @exception_wrapper
+    def testRampGetIndex(self):
+        '''Usage: returnCode, data = GetIndex(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UCHAR>>
+        '''
+        returnCode, data = self.CLIENT_pkg_testRamp_GetIndex()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetIndex()
+
+
+    @exception_wrapper
+    def testRampGetMaxIndex(self):
+        '''Usage: returnCode, data = GetMaxIndex(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UCHAR>>
+        '''
+        returnCode, data = self.CLIENT_pkg_testRamp_GetMaxIndex()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMaxIndex()
+
+
+    @exception_wrapper
+    def testRampSetPN9ContinuousMode(self, data):
+        '''Usage: returnCode = SetPN9ContinuousMode(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_testRamp_SetPN9ContinuousMode(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetPN9ContinuousMode()
+
+
+    @exception_wrapper
+    def testRampGetPN9ContinuousMode(self):
+        '''Usage: returnCode, data = GetPN9ContinuousMode(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_testRamp_GetPN9ContinuousMode()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetPN9ContinuousMode()
+
+
+    @exception_wrapper
+    def testRampSetAnimationSettings(self, settings):
+        '''Usage: returnCode = SetAnimationSettings(self, settings)
+            Input_01 settings FLR_TESTRAMP_ANIMATION_SETTINGS_T <<FLR_TESTRAMP_ANIMATION_SETTINGS_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_testRamp_SetAnimationSettings(settings)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetAnimationSettings()
+
+
+    @exception_wrapper
+    def testRampGetAnimationSettings(self):
+        '''Usage: returnCode, settings = GetAnimationSettings(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 settings FLR_TESTRAMP_ANIMATION_SETTINGS_T <<FLR_TESTRAMP_ANIMATION_SETTINGS_T>>
+        '''
+        returnCode, settings = self.CLIENT_pkg_testRamp_GetAnimationSettings()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, settings)
+    # End of GetAnimationSettings()
@@ -0,0 +1,263 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: tf, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def tfSetEnableState(self, data):
+        '''Usage: returnCode = SetEnableState(self, data)
+            Input_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_tf_SetEnableState(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetEnableState()
+
+
+    @exception_wrapper
+    def tfGetEnableState(self):
+        '''Usage: returnCode, data = GetEnableState(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_ENABLE_E <<FLR_ENABLE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetEnableState()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetEnableState()
+
+
+    @exception_wrapper
+    def tfSetDelta_nf(self, data):
+        '''Usage: returnCode = SetDelta_nf(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_tf_SetDelta_nf(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetDelta_nf()
+
+
+    @exception_wrapper
+    def tfGetDelta_nf(self):
+        '''Usage: returnCode, data = GetDelta_nf(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetDelta_nf()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDelta_nf()
+
+
+    @exception_wrapper
+    def tfSetTHDeltaMotion(self, data):
+        '''Usage: returnCode = SetTHDeltaMotion(self, data)
+            Input_01 data <class 'int'> <<UINT_16>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_tf_SetTHDeltaMotion(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTHDeltaMotion()
+
+
+    @exception_wrapper
+    def tfGetTHDeltaMotion(self):
+        '''Usage: returnCode, data = GetTHDeltaMotion(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetTHDeltaMotion()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTHDeltaMotion()
+
+
+    @exception_wrapper
+    def tfSetWLut(self, data):
+        '''Usage: returnCode = SetWLut(self, data)
+            Input_01 data FLR_TF_WLUT_T <<FLR_TF_WLUT_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_tf_SetWLut(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetWLut()
+
+
+    @exception_wrapper
+    def tfGetWLut(self):
+        '''Usage: returnCode, data = GetWLut(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TF_WLUT_T <<FLR_TF_WLUT_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetWLut()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetWLut()
+
+
+    @exception_wrapper
+    def tfGetMotionCount(self):
+        '''Usage: returnCode, data = GetMotionCount(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetMotionCount()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMotionCount()
+
+
+    @exception_wrapper
+    def tfSetMotionThreshold(self, data):
+        '''Usage: returnCode = SetMotionThreshold(self, data)
+            Input_01 data <class 'int'> <<UINT_32>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_tf_SetMotionThreshold(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetMotionThreshold()
+
+
+    @exception_wrapper
+    def tfGetMotionThreshold(self):
+        '''Usage: returnCode, data = GetMotionThreshold(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_32>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetMotionThreshold()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetMotionThreshold()
+
+
+    @exception_wrapper
+    def tfGetDelta_nfApplied(self):
+        '''Usage: returnCode, data = GetDelta_nfApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetDelta_nfApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetDelta_nfApplied()
+
+
+    @exception_wrapper
+    def tfGetTHDeltaMotionApplied(self):
+        '''Usage: returnCode, data = GetTHDeltaMotionApplied(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data <class 'int'> <<UINT_16>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetTHDeltaMotionApplied()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTHDeltaMotionApplied()
+
+
+    @exception_wrapper
+    def tfSetTempSignalCompFactorLut(self, data):
+        '''Usage: returnCode = SetTempSignalCompFactorLut(self, data)
+            Input_01 data FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T <<FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_tf_SetTempSignalCompFactorLut(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetTempSignalCompFactorLut()
+
+
+    @exception_wrapper
+    def tfGetTempSignalCompFactorLut(self):
+        '''Usage: returnCode, data = GetTempSignalCompFactorLut(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T <<FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T>>
+        '''
+        returnCode, data = self.CLIENT_pkg_tf_GetTempSignalCompFactorLut()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetTempSignalCompFactorLut()
+
+
+    @exception_wrapper
+    def tfGetRnf(self):
+        '''Usage: returnCode, rnf = GetRnf(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 rnf <class 'int'> <<UINT_16>>
+        '''
+        returnCode, rnf = self.CLIENT_pkg_tf_GetRnf()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, rnf)
+    # End of GetRnf()
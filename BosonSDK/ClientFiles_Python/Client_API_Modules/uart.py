@@ -0,0 +1,39 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_API import exception_wrapper
+
+# Module: uart, loaded by pyClient on first use
+class pyClient():
+    @exception_wrapper
+    def uartSetStartupBaudRate(self, data):
+        '''Usage: returnCode = SetStartupBaudRate(self, data)
+            Input_01 data FLR_UART_STARTUP_BAUDRATE_E <<FLR_UART_STARTUP_BAUDRATE_E>>
+            Output_00 returnCode <FLR_RESULT>
+        '''
+        returnCode = self.CLIENT_pkg_uart_SetStartupBaudRate(data)
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode)
+        
+        return ( returnCode)
+    # End of SetStartupBaudRate()
+
+
+    @exception_wrapper
+    def uartGetStartupBaudRate(self):
+        '''Usage: returnCode, data = GetStartupBaudRate(self)
+            Output_00 returnCode <FLR_RESULT>
+            Output_01 data FLR_UART_STARTUP_BAUDRATE_E <<FLR_UART_STARTUP_BAUDRATE_E>>
+        '''
+        returnCode, data = self.CLIENT_pkg_uart_GetStartupBaudRate()
+        
+        # Check for any errorcode
+        if (returnCode.value):
+            return ( returnCode, None)
+        
+        return ( returnCode, data)
+    # End of GetStartupBaudRate()
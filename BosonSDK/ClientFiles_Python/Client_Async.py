@@ -0,0 +1,337 @@
+'''
+asyncio client: the pyClient API as coroutines.
+
+    async with AsyncClient(manualport=0) as cam:
+        returnCode, sn = await cam.bosonGetCameraSN()
+
+Each command gets its own sequence number and is matched to its reply by it,
+so several commands can be in flight on one camera (asyncio.gather) and any
+number of cameras can share one event loop. With the FSLP_64 library the port
+is watched by the event loop and drained with FSLP_pump(). On KernelFslp the
+commands issued in one pass of the loop go to the driver as one ioctl vector.
+The other ports (I2C, pyserial) run one command at a time on an executor
+thread.
+
+The methods are made from the same generated modules as pyClient, so the
+surface and the return values match pyClient's, ex=True included.
+'''
+
+import ast
+import asyncio
+import ctypes
+import importlib.util
+from functools import wraps
+
+from .Client_Packager import MODULE_GROUPS, ModuleGroups, fixSpecialBytes
+from .Client_API import exception_wrapper
+from .Client_Dispatcher import HEADER_CODEC
+from .Serializer_BuiltIn import byteToUINT_32
+from .ReturnCodes import FLR_RESULT
+from ..CommunicationFiles.CommonFslp import CommonFslp, FSLP_TYPE_E
+
+COMMAND_CHANNEL = 0x00
+HEADER_BYTES = 12
+DEFAULT_TIMEOUT = 1.0       # seconds to wait for a reply
+DEFAULT_MAX_IN_FLIGHT = 8   # commands sent but not answered, per camera
+POLL_INTERVAL = 0.002       # seconds between FSLP_pump() calls without a port fd
+
+FRAME_CALLBACK = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_uint8,
+                                  ctypes.POINTER(ctypes.c_uint8), ctypes.c_uint32)
+
+
+def commandPayload(seqNum, fnID, sendData, sendBytes):
+    # same header as CLIENT_dispatch: sequence, function, 0xFFFFFFFF
+    sendPayload = bytearray(sendBytes + HEADER_BYTES)
+    HEADER_CODEC.pack_into(sendPayload, 0, seqNum, fnID, 0xFFFFFFFF)
+    sendPayload[HEADER_BYTES:] = bytes(sendData[:sendBytes])
+    return sendPayload
+
+
+def replyResult(fnID, receivePayload, expectedReceiveBytes):
+    # returnCode, receiveData as CLIENT_dispatch gives them
+    if len(receivePayload) < HEADER_BYTES:
+        return FLR_RESULT.R_UART_RECEIVE_TIMEOUT, None
+    if byteToUINT_32(receivePayload, 4) != fnID:
+        return FLR_RESULT.R_SDK_DSPCH_ID_MISMATCH, None
+    try:
+        returnCode = FLR_RESULT(byteToUINT_32(receivePayload, 8))
+    except ValueError:
+        returnCode = FLR_RESULT.R_SDK_DSPCH_MALFORMED_STATUS
+    if returnCode.value:
+        return returnCode, None
+    return returnCode, receivePayload[HEADER_BYTES : HEADER_BYTES + expectedReceiveBytes]
+
+
+class PumpTransport():
+    '''FSLP_64 library port: replies come from FSLP_pump() whenever the port is
+    readable and complete the command with the same sequence number.'''
+
+    def __init__(self, fslp, maxInFlight):
+        self.fslp = fslp
+        self.port = fslp.port
+        self.maxInFlight = maxInFlight
+        self.loop = None
+        self.slots = None
+        self.pending = {}
+        self.fd = -1
+        self.poller = None
+        self.callback = FRAME_CALLBACK(self._onFrame)
+
+    def _start(self):
+        # bound to the loop of the first command
+        if self.loop is not None:
+            return
+        self.loop = asyncio.get_running_loop()
+        self.slots = asyncio.Semaphore(self.maxInFlight)
+        self.fd = self.port.port_fd(ctypes.c_int32(self.port.portID))
+        if self.fd >= 0:
+            self.loop.add_reader(self.fd, self._pump)
+
+    def _onFrame(self, context, channelID, payload, length):
+        if channelID != COMMAND_CHANNEL or length < 4:
+            return
+        receivePayload = bytearray(ctypes.string_at(payload, length))
+        future = self.pending.pop(byteToUINT_32(receivePayload, 0), None)
+        if future is not None and not future.done():
+            future.set_result(receivePayload)
+
+    def _pump(self):
+        self.poller = None
+        if self.port.pump(ctypes.c_int32(self.port.portID), self.callback, None) < 0:
+            for future in self.pending.values():
+                if not future.done():
+                    future.set_exception(IOError("Port #{:d} failed".format(self.port.portID)))
+            self.pending.clear()
+        self._poll()
+
+    def _poll(self):
+        # no fd to watch (Win32): pump on a timer while replies are due
+        if self.fd < 0 and self.pending and self.poller is None:
+            self.poller = self.loop.call_later(POLL_INTERVAL, self._pump)
+
+    async def command(self, seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, timeout):
+        self._start()
+        async with self.slots:
+            future = self.loop.create_future()
+            self.pending[seqNum] = future
+            try:
+                sendPayload = commandPayload(seqNum, fnID, sendData, sendBytes)
+                self.fslp.sendFrame(COMMAND_CHANNEL, sendPayload, len(sendPayload))
+                self._poll()
+                receivePayload = await asyncio.wait_for(future, timeout)
+            except asyncio.TimeoutError:
+                return FLR_RESULT.R_UART_RECEIVE_TIMEOUT, None
+            finally:
+                self.pending.pop(seqNum, None)
+        return replyResult(fnID, receivePayload, expectedReceiveBytes)
+
+    def close(self):
+        if self.loop is not None and self.fd >= 0:
+            self.loop.remove_reader(self.fd)
+        if self.poller is not None:
+            self.poller.cancel()
+        for future in self.pending.values():
+            future.cancel()
+        self.pending.clear()
+
+
+class BatchTransport():
+    '''KernelFslp: the commands queued in one pass of the event loop are sent
+    with one batch() call on an executor thread. The driver applies its own
+    command timeouts.'''
+
+    def __init__(self, fslp):
+        self.fslp = fslp
+        self.queue = []
+        self.lock = None
+
+    async def command(self, seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, timeout):
+        loop = asyncio.get_running_loop()
+        if self.lock is None:
+            self.lock = asyncio.Lock()
+        future = loop.create_future()
+        self.queue.append((fnID, bytes(sendData[:sendBytes]), expectedReceiveBytes, future))
+        if len(self.queue) == 1:
+            # runs after the other tasks of this pass have queued theirs
+            loop.call_soon(self._flush, loop)
+        result, receiveData = await future
+        receivePayload = bytearray(HEADER_CODEC.pack(seqNum, fnID, result)) + receiveData
+        return replyResult(fnID, receivePayload, expectedReceiveBytes)
+
+    def _flush(self, loop):
+        batch, self.queue = self.queue, []
+        loop.create_task(self._send(loop, batch))
+
+    async def _send(self, loop, batch):
+        async with self.lock:
+            try:
+                results = await loop.run_in_executor(
+                    None, self.fslp.batch, [(fnID, sendData, receiveBytes) for fnID, sendData, receiveBytes, _ in batch])
+            except Exception as e:
+                results = [e] * len(batch)
+        for (_, _, _, future), result in zip(batch, results):
+            if future.done():
+                continue
+            if isinstance(result, Exception):
+                future.set_exception(result)
+            else:
+                future.set_result(result)
+
+    def close(self):
+        for _, _, _, future in self.queue:
+            future.cancel()
+        self.queue = []
+
+
+class ThreadTransport():
+    '''Ports without FSLP_pump(): the blocking send and read run on an executor
+    thread, one command at a time.'''
+
+    def __init__(self, fslp):
+        self.fslp = fslp
+        self.lock = None
+
+    def _transact(self, sendPayload, expectedReceiveBytes):
+        self.fslp.sendFrame(COMMAND_CHANNEL, sendPayload, len(sendPayload))
+        return self.fslp.readFrame(COMMAND_CHANNEL, expectedReceiveBytes + HEADER_BYTES)
+
+    async def command(self, seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, timeout):
+        if self.lock is None:
+            self.lock = asyncio.Lock()
+        sendPayload = commandPayload(seqNum, fnID, sendData, sendBytes)
+        async with self.lock:
+            receivePayload = await asyncio.get_running_loop().run_in_executor(
+                None, self._transact, sendPayload, expectedReceiveBytes)
+        if len(receivePayload) >= 4 and byteToUINT_32(receivePayload, 0) != seqNum:
+            return FLR_RESULT.R_SDK_DSPCH_SEQUENCE_MISMATCH, None
+        return replyResult(fnID, receivePayload, expectedReceiveBytes)
+
+    def close(self):
+        pass
+
+
+def async_exception_wrapper(func):
+    # exception_wrapper's handling of ex, applied to the awaited response
+    @wraps(func)
+    async def wrapper(self, *args, **kwargs):
+        response = await func(self, *args, **kwargs)
+        return exception_wrapper(lambda _self: response)(self)
+    return wrapper
+
+
+class AsyncMethods(ast.NodeTransformer):
+    '''Rewrites a generated Packager / pyClient group module into coroutines:
+    CLIENT_dispatch(...) becomes await self._dispatch(...), which numbers the
+    command itself, the API's self.CLIENT_pkg_...() calls are awaited and
+    @exception_wrapper becomes its coroutine version.'''
+
+    def visit_FunctionDef(self, node):
+        self.generic_visit(node)
+        node.body = [stmt for stmt in node.body if not self._countsCommand(stmt)]
+        for decorator in node.decorator_list:
+            if isinstance(decorator, ast.Name) and decorator.id == "exception_wrapper":
+                decorator.id = "async_exception_wrapper"
+        return ast.copy_location(ast.AsyncFunctionDef(**{field: getattr(node, field) for field in node._fields}), node)
+
+    @staticmethod
+    def _countsCommand(stmt):
+        # self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        return (isinstance(stmt, ast.Assign) and len(stmt.targets) == 1
+                and isinstance(stmt.targets[0], ast.Attribute)
+                and stmt.targets[0].attr == "__commandCount")
+
+    def visit_Call(self, node):
+        self.generic_visit(node)
+        func = node.func
+        if isinstance(func, ast.Name) and func.id == "CLIENT_dispatch":
+            # drop the sequence number and fslp arguments
+            dispatch = ast.Attribute(value=ast.Name(id="self", ctx=ast.Load()), attr="_dispatch", ctx=ast.Load())
+            return ast.Await(value=ast.Call(func=dispatch, args=node.args[1:5], keywords=[]))
+        if (isinstance(func, ast.Attribute) and func.attr.startswith("CLIENT_pkg_")
+                and isinstance(func.value, ast.Name) and func.value.id == "self"):
+            return ast.Await(value=node)
+        return node
+
+
+def asyncGroupMethods(moduleName, className):
+    spec = importlib.util.find_spec("{:s}.{:s}".format(__package__, moduleName))
+    if spec is None:
+        return None
+    with open(spec.origin) as source:
+        tree = AsyncMethods().visit(ast.parse(source.read(), spec.origin))
+    namespace = {"__name__": spec.name, "__package__": spec.parent, "async_exception_wrapper": async_exception_wrapper}
+    exec(compile(ast.fix_missing_locations(tree), spec.origin, "exec"), namespace)
+    return vars(namespace[className])
+
+
+class AsyncClient(metaclass=ModuleGroups):
+    # methods come from _groupMethods, not a package of their own
+    _modulePackage = None
+
+    def __init__(self, manualport=None, manualbaud=None, useDll=True, useI2C=False, importPath=None, ex=False, fslp=None,
+                 maxInFlight=DEFAULT_MAX_IN_FLIGHT, timeout=DEFAULT_TIMEOUT, **kwargs):
+        if None == fslp:
+            if useI2C:
+                fslpType = FSLP_TYPE_E.FSLP_I2C
+            elif useDll:
+                fslpType = FSLP_TYPE_E.FSLP_DLL_SERIAL
+            else:
+                fslpType = FSLP_TYPE_E.FSLP_PY_SERIAL
+            fslp = CommonFslp.getFslp(manualport, manualbaud, fslpType, importPath, **kwargs)
+            fslp.port.open()
+
+        self.fslp = fslp
+        self.ex = ex
+        self.timeout = timeout
+        self._commandCount = 0
+        # KernelFslp has batch; only the FSLP_64 library port has pump, and
+        # only from the version that added it
+        if hasattr(fslp, "batch"):
+            self._transport = BatchTransport(fslp)
+        elif getattr(fslp.port, "pump", None) is not None:
+            self._transport = PumpTransport(fslp, maxInFlight)
+        else:
+            self._transport = ThreadTransport(fslp)
+
+    async def _dispatch(self, fnID, sendData, sendBytes, expectedReceiveBytes):
+        seqNum = self._commandCount
+        self._commandCount = fixSpecialBytes(seqNum + 1)
+        return await self._transport.command(seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, self.timeout)
+
+    @classmethod
+    def _groupMethods(cls, group):
+        methods = {}
+        for moduleName, className in (("Client_Packager_Modules." + group, "Packager"),
+                                      ("Client_API_Modules." + group, "pyClient")):
+            found = asyncGroupMethods(moduleName, className)
+            if found is not None:
+                methods.update(found)
+        return methods or None
+
+    @staticmethod
+    def _moduleGroup(name):
+        # API names start with their group, the longest one matching wins;
+        # CLIENT_pkg_<group>_... names belong to the same group
+        if name.startswith("CLIENT_pkg_"):
+            name = name[len("CLIENT_pkg_"):]
+        matches = [group for group in MODULE_GROUPS if name.startswith(group)]
+        if not matches:
+            return None
+        return AsyncClient, max(matches, key=len)
+
+    def __getattr__(self, name):
+        getattr(type(self), name)
+        return object.__getattribute__(self, name)
+
+    def __dir__(self):
+        return dir(type(self))
+
+    def Close(self):
+        self._transport.close()
+        self.fslp.port.close()
+
+    async def __aenter__(self):
+        return self
+
+    async def __aexit__(self, *args):
+        self.Close()
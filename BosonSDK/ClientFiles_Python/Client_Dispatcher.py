@@ -4,33 +4,37 @@
 
 
 from .Serializer_BuiltIn import UINT_32ToByte, byteToUINT_32
+from struct import Struct
 from .ReturnCodes import FLR_RESULT # , flr_result_to_string
 from .EnumTypes import *
 from time import sleep
 import os
 
+HEADER_CODEC = Struct(">III")
+
 
 def CLIENT_dispatch(seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, fslp):
+    # getters answered before, see BosonSDK/getter_cache.py
+    cache = getattr(fslp, "getterCache", None)
+    if cache is None:
+        return dispatchFrame(seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, fslp)
+    receiveData = cache.lookup(fnID, sendBytes)
+    if receiveData is not None:
+        return FLR_RESULT.R_SUCCESS, receiveData
+    returnCode, receiveData = dispatchFrame(seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, fslp)
+    cache.store(fnID, sendBytes, returnCode, receiveData)
+    return returnCode, receiveData
+
+
+def dispatchFrame(seqNum, fnID, sendData, sendBytes, expectedReceiveBytes, fslp):
     # Allocate buffer with extra space for payload header
     sendPayload = bytearray(sendBytes + 12)
-    pyldPtr = 0
-
-    # Write sequence number to first 4 bytes
-    UINT_32ToByte(seqNum, sendPayload, pyldPtr)
-    pyldPtr += 4
-
-    # Write function ID to second 4 bytes
-    UINT_32ToByte(fnID, sendPayload, pyldPtr)
-    pyldPtr += 4
 
-    # Write 0xFFFFFFFF to third 4 bytes
-    UINT_32ToByte(0xFFFFFFFF, sendPayload, pyldPtr)
-    pyldPtr += 4
+    # Sequence number, function ID and 0xFFFFFFFF in one pack
+    HEADER_CODEC.pack_into(sendPayload, 0, seqNum, fnID, 0xFFFFFFFF)
 
     # Copy sendData to payload buffer
-    for byte in sendData:
-        sendPayload[pyldPtr] = byte
-        pyldPtr += 1
+    sendPayload[12 : 12 + len(sendData)] = sendData
 
     SendToCamera = fslp.sendToCamera
     SendFrame = fslp.sendFrame
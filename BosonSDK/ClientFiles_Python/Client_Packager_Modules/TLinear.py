@@ -0,0 +1,133 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: TLinear, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_TLinear_SetControl(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003E0001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: TLinear
+
+    def CLIENT_pkg_TLinear_GetControl(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003E0002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: TLinear
+
+    def CLIENT_pkg_TLinear_GetLUT(self, mode, offset):
+        # Create bytearray object for inputs
+        sendBytes = 6
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 128
+        
+        # write mode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, a, b
+        INT_32ToByte(mode.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, a, b
+        UINT_16ToByte(offset,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003E0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read a from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        a = byteToFLOATArray(receiveData,inPtr,16)
+        inPtr+=64
+        # end of a handling
+        
+        # read b from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        b = byteToFLOATArray(receiveData,inPtr,16)
+        inPtr+=64
+        # end of b handling
+        
+        return returnCode, a, b
+        
+    #End of Module: TLinear
+
+    def CLIENT_pkg_TLinear_RefreshLUT(self, mode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write mode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(mode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003E0007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: TLinear
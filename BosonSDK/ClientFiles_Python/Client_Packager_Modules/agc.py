@@ -0,0 +1,1428 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: agc, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_agc_SetPercentPerBin(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetPercentPerBin(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetLinearPercent(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetLinearPercent(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetOutlierCut(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetOutlierCut(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetDrOut(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetMaxGain(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetMaxGain(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_Setdf(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_Getdf(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetGamma(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetGamma(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009000E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetFirstBin(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090010, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetLastBin(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090012, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetDetailHeadroom(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090013, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetDetailHeadroom(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090014, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_Setd2br(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090015, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_Getd2br(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090016, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetSigmaR(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090017, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetSigmaR(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090018, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetUseEntropy(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009001E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetUseEntropy(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009001F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetROI(self, roi):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write roi to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ROI_TToByte(roi,sendData,outPtr)
+        outPtr += 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090020, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetROI(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090021, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read roi from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        roi = byteToFLR_ROI_T(receiveData,inPtr)
+        inPtr+=8
+        # end of roi handling
+        
+        return returnCode, roi
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetMaxGainApplied(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090025, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetSigmaRApplied(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090026, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetOutlierCutBalance(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090027, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetOutlierCutBalance(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090028, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetOutlierCutApplied(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090029, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read percentHigh from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        percentHigh = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of percentHigh handling
+        
+        # read percentLow from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        percentLow = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of percentLow handling
+        
+        return returnCode, percentHigh, percentLow
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetDetailHeadroomBalance(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009002A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetDetailHeadroomBalance(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009002B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetDetailHeadroomApplied(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009002C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read countsHigh from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        countsHigh = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of countsHigh handling
+        
+        # read countsLow from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        countsLow = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of countsLow handling
+        
+        return returnCode, countsHigh, countsLow
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetTfThresholds(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090030, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read tf_thresholdMin from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        tf_thresholdMin = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of tf_thresholdMin handling
+        
+        # read tf_thresholdMax from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        tf_thresholdMax = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of tf_thresholdMax handling
+        
+        return returnCode, tf_thresholdMin, tf_thresholdMax
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetTfThresholds(self, tf_thresholdMin, tf_thresholdMax):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write tf_thresholdMin to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(tf_thresholdMin,sendData,outPtr)
+        outPtr += 2
+        
+        # write tf_thresholdMax to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(tf_thresholdMax,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090031, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090032, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read mode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        mode = FLR_AGC_MODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of mode handling
+        
+        return returnCode, mode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetMode(self, mode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write mode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(mode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090033, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetHighTempAlarmValues(self, lowGain, highGain, pixPopulation):
+        # Create bytearray object for inputs
+        sendBytes = 12
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write lowGain to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(lowGain,sendData,outPtr)
+        outPtr += 4
+        
+        # write highGain to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(highGain,sendData,outPtr)
+        outPtr += 4
+        
+        # write pixPopulation to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(pixPopulation,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090034, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetContrast(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090040, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read contrast from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        contrast = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of contrast handling
+        
+        return returnCode, contrast
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetContrast(self, contrast):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write contrast to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(contrast,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090041, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetBrightnessBias(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090042, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read brightnessBias from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        brightnessBias = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of brightnessBias handling
+        
+        return returnCode, brightnessBias
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetBrightnessBias(self, brightnessBias):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write brightnessBias to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(brightnessBias,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090043, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetBrightness(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090044, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read brightness from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        brightness = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of brightness handling
+        
+        return returnCode, brightness
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetBrightness(self, brightness):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write brightness to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(brightness,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090045, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetMaxGainForLowGain(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090046, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetMaxGainForLowGain(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00090047, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetRadius(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009004A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetRadius(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009004B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetGmax(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009004C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetGmax(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009004D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_SetGmin(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009004E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: agc
+
+    def CLIENT_pkg_agc_GetGmin(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0009004F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: agc
@@ -0,0 +1,3231 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: boson, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_boson_GetCameraSN(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetCameraPN(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 20
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLR_BOSON_PARTNUMBER_T(receiveData,inPtr)
+        inPtr+=20
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSensorSN(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_RunFFC(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFFCTempThreshold(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCTempThreshold(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFFCFrameThreshold(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCFrameThreshold(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCInProgress(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_Reboot(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050010, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFFCMode(self, ffcMode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ffcMode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(ffcMode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050012, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050013, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read ffcMode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        ffcMode = FLR_BOSON_FFCMODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of ffcMode handling
+        
+        return returnCode, ffcMode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainMode(self, gainMode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write gainMode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(gainMode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050014, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050015, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read gainMode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        gainMode = FLR_BOSON_GAINMODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of gainMode handling
+        
+        return returnCode, gainMode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_WriteDynamicHeaderToFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050018, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_ReadDynamicHeaderFromFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050019, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_RestoreFactoryDefaultsFromFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005001B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_RestoreFactoryBadPixelsFromFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050020, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_WriteBadPixelsToFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050021, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSoftwareRev(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050022, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read major from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        major = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of major handling
+        
+        # read minor from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        minor = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of minor handling
+        
+        # read patch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        patch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of patch handling
+        
+        return returnCode, major, minor, patch
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetBadPixelLocation(self, row, col):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write row to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(row,sendData,outPtr)
+        outPtr += 4
+        
+        # write col to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(col,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005002D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_lookupFPATempDegCx10(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050030, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_lookupFPATempDegKx10(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050031, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_WriteLensNvFfcToFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050033, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_WriteLensGainToFlash(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050035, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetLensNumber(self, lensNumber):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write lensNumber to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(lensNumber,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050038, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetLensNumber(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050039, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read lensNumber from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        lensNumber = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of lensNumber handling
+        
+        return returnCode, lensNumber
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetTableNumber(self, tableNumber):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write tableNumber to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(tableNumber,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005003A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetTableNumber(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005003B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read tableNumber from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        tableNumber = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of tableNumber handling
+        
+        return returnCode, tableNumber
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSensorPN(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 32
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005003F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read sensorPN from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        sensorPN = byteToFLR_BOSON_SENSOR_PARTNUMBER_T(receiveData,inPtr)
+        inPtr+=32
+        # end of sensorPN handling
+        
+        return returnCode, sensorPN
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainSwitchParams(self, parm_struct):
+        # Create bytearray object for inputs
+        sendBytes = 16
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write parm_struct to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_BOSON_GAIN_SWITCH_PARAMS_TToByte(parm_struct,sendData,outPtr)
+        outPtr += 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050040, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchParams(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050041, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read parm_struct from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        parm_struct = byteToFLR_BOSON_GAIN_SWITCH_PARAMS_T(receiveData,inPtr)
+        inPtr+=16
+        # end of parm_struct handling
+        
+        return returnCode, parm_struct
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSwitchToHighGainFlag(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050042, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read switchToHighGainFlag from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        switchToHighGainFlag = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of switchToHighGainFlag handling
+        
+        return returnCode, switchToHighGainFlag
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSwitchToLowGainFlag(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050043, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read switchToLowGainFlag from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        switchToLowGainFlag = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of switchToLowGainFlag handling
+        
+        return returnCode, switchToLowGainFlag
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetCLowToHighPercent(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050044, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read cLowToHighPercent from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        cLowToHighPercent = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of cLowToHighPercent handling
+        
+        return returnCode, cLowToHighPercent
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetMaxNUCTables(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050045, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read maxNUCTables from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        maxNUCTables = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of maxNUCTables handling
+        
+        return returnCode, maxNUCTables
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetMaxLensTables(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050046, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read maxLensTables from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        maxLensTables = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of maxLensTables handling
+        
+        return returnCode, maxLensTables
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFfcWaitCloseFrames(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005004E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFfcWaitCloseFrames(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005004F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_CheckForTableSwitch(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050050, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetDesiredTableNumber(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050052, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read desiredTableNumber from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        desiredTableNumber = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of desiredTableNumber handling
+        
+        return returnCode, desiredTableNumber
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFfcStatus(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050054, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read ffcStatus from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        ffcStatus = FLR_BOSON_FFCSTATUS_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of ffcStatus handling
+        
+        return returnCode, ffcStatus
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFfcDesired(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050055, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read ffcDesired from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        ffcDesired = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of ffcDesired handling
+        
+        return returnCode, ffcDesired
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSwRevInHeader(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050056, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read major from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        major = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of major handling
+        
+        # read minor from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        minor = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of minor handling
+        
+        # read patch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        patch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of patch handling
+        
+        return returnCode, major, minor, patch
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetLastFFCFrameCount(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005005D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read frameCount from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        frameCount = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of frameCount handling
+        
+        return returnCode, frameCount
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetLastFFCTempDegKx10(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005005E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read temp from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        temp = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of temp handling
+        
+        return returnCode, temp
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetTableSwitchDesired(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005005F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read tableSwitchDesired from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        tableSwitchDesired = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of tableSwitchDesired handling
+        
+        return returnCode, tableSwitchDesired
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetOverTempThreshold(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050061, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read temperatureInC from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        temperatureInC = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of temperatureInC handling
+        
+        return returnCode, temperatureInC
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetLowPowerMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050062, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read lowPowerMode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        lowPowerMode = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of lowPowerMode handling
+        
+        return returnCode, lowPowerMode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetOverTempEventOccurred(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050063, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read overTempEventOccurred from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        overTempEventOccurred = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of overTempEventOccurred handling
+        
+        return returnCode, overTempEventOccurred
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetPermitThermalShutdownOverride(self, permitThermalShutdownOverride):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write permitThermalShutdownOverride to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(permitThermalShutdownOverride.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050064, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetPermitThermalShutdownOverride(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050065, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read permitThermalShutdownOverride from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        permitThermalShutdownOverride = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of permitThermalShutdownOverride handling
+        
+        return returnCode, permitThermalShutdownOverride
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetMyriadTemp(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050068, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read myriadTemp from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        myriadTemp = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of myriadTemp handling
+        
+        return returnCode, myriadTemp
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetNvFFCNucTableNumberLens0(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005006D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read nvFFCNucTableNumberLens0 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        nvFFCNucTableNumberLens0 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of nvFFCNucTableNumberLens0 handling
+        
+        return returnCode, nvFFCNucTableNumberLens0
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetNvFFCNucTableNumberLens1(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005006F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read nvFFCNucTableNumberLens1 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        nvFFCNucTableNumberLens1 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of nvFFCNucTableNumberLens1 handling
+        
+        return returnCode, nvFFCNucTableNumberLens1
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetNvFFCFPATempDegKx10Lens0(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050071, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read nvFFCFPATempDegKx10Lens0 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        nvFFCFPATempDegKx10Lens0 = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of nvFFCFPATempDegKx10Lens0 handling
+        
+        return returnCode, nvFFCFPATempDegKx10Lens0
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetNvFFCFPATempDegKx10Lens1(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050073, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read nvFFCFPATempDegKx10Lens1 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        nvFFCFPATempDegKx10Lens1 = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of nvFFCFPATempDegKx10Lens1 handling
+        
+        return returnCode, nvFFCFPATempDegKx10Lens1
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFFCWarnTimeInSecx10(self, ffcWarnTime):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ffcWarnTime to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(ffcWarnTime,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050074, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCWarnTimeInSecx10(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050075, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read ffcWarnTime from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        ffcWarnTime = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of ffcWarnTime handling
+        
+        return returnCode, ffcWarnTime
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetOverTempEventCounter(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050076, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read overTempEventCounter from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        overTempEventCounter = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of overTempEventCounter handling
+        
+        return returnCode, overTempEventCounter
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetOverTempTimerInSec(self, overTempTimerInSec):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write overTempTimerInSec to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(overTempTimerInSec,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050077, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetOverTempTimerInSec(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050078, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read overTempTimerInSec from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        overTempTimerInSec = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of overTempTimerInSec handling
+        
+        return returnCode, overTempTimerInSec
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_UnloadCurrentLensCorrections(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050079, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetTimeForQuickFFCsInSecs(self, timeForQuickFFCsInSecs):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write timeForQuickFFCsInSecs to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(timeForQuickFFCsInSecs,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005007A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetTimeForQuickFFCsInSecs(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005007B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read timeForQuickFFCsInSecs from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        timeForQuickFFCsInSecs = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of timeForQuickFFCsInSecs handling
+        
+        return returnCode, timeForQuickFFCsInSecs
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_ReloadCurrentLensCorrections(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005007C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetBootTimestamps(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005007F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read FirstLight from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None
+        FirstLight = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of FirstLight handling
+        
+        # read StartInit from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None
+        StartInit = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of StartInit handling
+        
+        # read BosonExecDone from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None
+        BosonExecDone = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of BosonExecDone handling
+        
+        # read Timestamp4 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None
+        Timestamp4 = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of Timestamp4 handling
+        
+        return returnCode, FirstLight, StartInit, BosonExecDone, Timestamp4
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetExtSyncMode(self, mode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write mode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(mode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050098, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetExtSyncMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00050099, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read mode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        mode = FLR_BOSON_EXT_SYNC_MODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of mode handling
+        
+        return returnCode, mode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetLastCommand(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0005009A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read sequenceNum from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        sequenceNum = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of sequenceNum handling
+        
+        # read cmdID from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        cmdID = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of cmdID handling
+        
+        return returnCode, sequenceNum, cmdID
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSensorHostCalVersion(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A0, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read version from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        version = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of version handling
+        
+        return returnCode, version
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetDesiredStartupTableNumber(self, table):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(table,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A1, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetDesiredStartupTableNumber(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A2, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read table from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        table = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of table handling
+        
+        return returnCode, table
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetNvFFCMeanValueLens0(self, meanValue):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write meanValue to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(meanValue,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A3, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetNvFFCMeanValueLens0(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A4, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read meanValue from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        meanValue = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of meanValue handling
+        
+        return returnCode, meanValue
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetNvFFCMeanValueLens1(self, meanValue):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write meanValue to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(meanValue,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A5, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetNvFFCMeanValueLens1(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A6, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read meanValue from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        meanValue = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of meanValue handling
+        
+        return returnCode, meanValue
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetInvertImage(self, invertImage):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write invertImage to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(invertImage.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A7, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetInvertImage(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A8, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read invertImage from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        invertImage = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of invertImage handling
+        
+        return returnCode, invertImage
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetRevertImage(self, revertImage):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write revertImage to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(revertImage.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500A9, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetRevertImage(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500AA, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read revertImage from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        revertImage = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of revertImage handling
+        
+        return returnCode, revertImage
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetTimeStamp(self, timeStampType):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write timeStampType to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, timeStamp
+        INT_32ToByte(timeStampType.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500AB, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read timeStamp from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        timeStamp = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of timeStamp handling
+        
+        return returnCode, timeStamp
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetISPFrameCount(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500AC, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read ispFrameCount from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        ispFrameCount = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of ispFrameCount handling
+        
+        return returnCode, ispFrameCount
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_WriteUserBadPixelsToAllTables(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500AD, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_WriteFactoryBadPixelsToAllTables(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500AE, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetTempDiodeStatus(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500B1, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read status from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        status = FLR_BOSON_TEMP_DIODE_STATUS_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of status handling
+        
+        return returnCode, status
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_ClearFactoryBadPixelsInDDR(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500B2, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFfcWaitOpenFrames(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500B3, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFfcWaitOpenFrames(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500B4, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFfcWaitOpenFlagSettleFrames(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500B5, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFfcWaitOpenFlagSettleFrames(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500B6, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetTauExtFfcCompatibilityMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500BA, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetTauExtFfcCompatibilityMode(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500BB, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetInitialTableSelectionTempOffset(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500C7, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetInitialTableSelectionTempOffset(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500C8, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetImageValid(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500C9, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetCurrentTableType(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500CA, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_BOSON_TABLETYPE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchFrameThreshold(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500CB, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainSwitchFrameThreshold(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500CC, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchHysteresisTime(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500CD, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainSwitchHysteresisTime(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500CE, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchDesired(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500CF, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchRadiometricParams(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500D2, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read parm_struct from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        parm_struct = byteToFLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T(receiveData,inPtr)
+        inPtr+=16
+        # end of parm_struct handling
+        
+        return returnCode, parm_struct
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainSwitchRadiometricParams(self, parm_struct):
+        # Create bytearray object for inputs
+        sendBytes = 16
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write parm_struct to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_TToByte(parm_struct,sendData,outPtr)
+        outPtr += 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500D3, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetSaturationOverrideMode(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500D8, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSaturationOverrideMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500D9, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetSaturationOverrideValue(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500DA, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetSaturationOverrideValue(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500DB, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetffcHighLowGainThresholdMode(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500DC, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetffcHighLowGainThresholdMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500DD, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFFCTempThresholdLowGain(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500DE, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCTempThresholdLowGain(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500DF, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetFFCFrameThresholdLowGain(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E0, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetFFCFrameThresholdLowGain(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E1, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetBoardID(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E2, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetAutoGainSwitchConditions(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E3, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetAutoGainSwitchConditions(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E4, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_BOSON_AUTOGAIN_SWITCH_CONDITION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainSwitchParamsCATS(self, parm_struct):
+        # Create bytearray object for inputs
+        sendBytes = 16
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write parm_struct to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_BOSON_GAIN_SWITCH_PARAMS_TToByte(parm_struct,sendData,outPtr)
+        outPtr += 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E5, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchParamsCATS(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E6, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read parm_struct from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        parm_struct = byteToFLR_BOSON_GAIN_SWITCH_PARAMS_T(receiveData,inPtr)
+        inPtr+=16
+        # end of parm_struct handling
+        
+        return returnCode, parm_struct
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetGainSwitchRadiometricParamsCATS(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E7, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read parm_struct from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        parm_struct = byteToFLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T(receiveData,inPtr)
+        inPtr+=16
+        # end of parm_struct handling
+        
+        return returnCode, parm_struct
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_SetGainSwitchRadiometricParamsCATS(self, parm_struct):
+        # Create bytearray object for inputs
+        sendBytes = 16
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write parm_struct to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_TToByte(parm_struct,sendData,outPtr)
+        outPtr += 16
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E8, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: boson
+
+    def CLIENT_pkg_boson_GetCLowToHighPercentCATS(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000500E9, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read cLowToHighPercent from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        cLowToHighPercent = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of cLowToHighPercent handling
+        
+        return returnCode, cLowToHighPercent
+        
+    #End of Module: boson
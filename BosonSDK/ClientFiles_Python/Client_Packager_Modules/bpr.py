@@ -0,0 +1,383 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: bpr, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_bpr_GetState(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_SetState(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_GetStats(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 20
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read threeby from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        threeby = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of threeby handling
+        
+        # read fiveby from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        fiveby = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of fiveby handling
+        
+        # read rows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        rows = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of rows handling
+        
+        # read budget from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        budget = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of budget handling
+        
+        # read used from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        used = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of used handling
+        
+        return returnCode, threeby, fiveby, rows, budget, used
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_GetDisplayMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_BPR_DISPLAY_MODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_SetDisplayMode(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_GetDisplayModeMinValue(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_SetDisplayModeMinValue(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_GetDisplayModeMaxValue(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00030009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_SetDisplayModeMaxValue(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(data,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0003000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_GetWorkBufIndex(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0003000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_SetWorkBufIndex(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(data,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0003000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: bpr
+
+    def CLIENT_pkg_bpr_GetWorkBufStats(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 20
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0003000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read threeby from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        threeby = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of threeby handling
+        
+        # read fiveby from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        fiveby = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of fiveby handling
+        
+        # read rows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        rows = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of rows handling
+        
+        # read budget from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        budget = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of budget handling
+        
+        # read used from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        used = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of used handling
+        
+        return returnCode, threeby, fiveby, rows, budget, used
+        
+    #End of Module: bpr
@@ -0,0 +1,127 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: capture, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_capture_SingleFrame(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00070001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: capture
+
+    def CLIENT_pkg_capture_Frames(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 10
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_CAPTURE_SETTINGS_TToByte(data,sendData,outPtr)
+        outPtr += 10
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00070002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: capture
+
+    def CLIENT_pkg_capture_SingleFrameWithSrc(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00070003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: capture
+
+    def CLIENT_pkg_capture_SingleFrameToFile(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00070004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: capture
+
+    def CLIENT_pkg_capture_GetStatus(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 24
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00070005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read status from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        status = byteToFLR_CAPTURE_STATUS_T(receiveData,inPtr)
+        inPtr+=24
+        # end of status handling
+        
+        return returnCode, status
+        
+    #End of Module: capture
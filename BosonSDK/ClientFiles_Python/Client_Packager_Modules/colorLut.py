@@ -0,0 +1,193 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: colorLut, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_colorLut_SetControl(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000B0001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: colorLut
+
+    def CLIENT_pkg_colorLut_GetControl(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000B0002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: colorLut
+
+    def CLIENT_pkg_colorLut_SetId(self, data):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(data.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000B0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: colorLut
+
+    def CLIENT_pkg_colorLut_GetId(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000B0004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = FLR_COLORLUT_ID_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: colorLut
+
+    def CLIENT_pkg_colorLut_SetOutlineColor(self, red, green, blue):
+        # Create bytearray object for inputs
+        sendBytes = 3
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write red to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(red,sendData,outPtr)
+        outPtr += 1
+        
+        # write green to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(green,sendData,outPtr)
+        outPtr += 1
+        
+        # write blue to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(blue,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000B0005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: colorLut
+
+    def CLIENT_pkg_colorLut_GetOutlineColor(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 3
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000B0006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read red from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        red = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of red handling
+        
+        # read green from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        green = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of green handling
+        
+        # read blue from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        blue = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of blue handling
+        
+        return returnCode, red, green, blue
+        
+    #End of Module: colorLut
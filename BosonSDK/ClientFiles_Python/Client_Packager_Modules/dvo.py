@@ -0,0 +1,1220 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: dvo, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_dvo_SetAnalogVideoState(self, analogVideoState):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write analogVideoState to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(analogVideoState.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetAnalogVideoState(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read analogVideoState from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        analogVideoState = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of analogVideoState handling
+        
+        return returnCode, analogVideoState
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetOutputFormat(self, format):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write format to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(format.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetOutputFormat(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read format from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        format = FLR_DVO_OUTPUT_FORMAT_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of format handling
+        
+        return returnCode, format
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetOutputYCbCrSettings(self, settings):
+        # Create bytearray object for inputs
+        sendBytes = 12
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write settings to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_DVO_YCBCR_SETTINGS_TToByte(settings,sendData,outPtr)
+        outPtr += 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetOutputYCbCrSettings(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read settings from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        settings = byteToFLR_DVO_YCBCR_SETTINGS_T(receiveData,inPtr)
+        inPtr+=12
+        # end of settings handling
+        
+        return returnCode, settings
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetOutputRGBSettings(self, settings):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write settings to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_DVO_RGB_SETTINGS_TToByte(settings,sendData,outPtr)
+        outPtr += 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetOutputRGBSettings(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read settings from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        settings = byteToFLR_DVO_RGB_SETTINGS_T(receiveData,inPtr)
+        inPtr+=8
+        # end of settings handling
+        
+        return returnCode, settings
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_ApplyCustomSettings(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetDisplayMode(self, displayMode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write displayMode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(displayMode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetDisplayMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006000E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read displayMode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        displayMode = FLR_DVO_DISPLAY_MODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of displayMode handling
+        
+        return returnCode, displayMode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetType(self, tap):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write tap to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(tap.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006000F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetType(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060010, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read tap from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        tap = FLR_DVO_TYPE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of tap handling
+        
+        return returnCode, tap
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetVideoStandard(self, videoStandard):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write videoStandard to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(videoStandard.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060011, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetVideoStandard(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060012, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read videoStandard from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        videoStandard = FLR_DVO_VIDEO_STANDARD_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of videoStandard handling
+        
+        return returnCode, videoStandard
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetCheckVideoDacPresent(self, checkVideoDacPresent):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write checkVideoDacPresent to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(checkVideoDacPresent.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060013, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetCheckVideoDacPresent(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060014, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read checkVideoDacPresent from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        checkVideoDacPresent = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of checkVideoDacPresent handling
+        
+        return returnCode, checkVideoDacPresent
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetCustomLcdConfig(self, id, config):
+        # Create bytearray object for inputs
+        sendBytes = 52
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(id.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write config to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_DVO_LCD_CONFIG_TToByte(config,sendData,outPtr)
+        outPtr += 48
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060015, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetCustomLcdConfig(self, id):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 48
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, config
+        INT_32ToByte(id.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060016, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read config from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        config = byteToFLR_DVO_LCD_CONFIG_T(receiveData,inPtr)
+        inPtr+=48
+        # end of config handling
+        
+        return returnCode, config
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetLCDConfig(self, id):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(id.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060017, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetLCDConfig(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060018, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read id from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        id = FLR_DVO_LCD_CONFIG_ID_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of id handling
+        
+        return returnCode, id
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetClockInfo(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 80
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060019, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read horizontalSyncWidth from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        horizontalSyncWidth = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of horizontalSyncWidth handling
+        
+        # read verticalSyncWidth from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        verticalSyncWidth = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of verticalSyncWidth handling
+        
+        # read clocksPerRowPeriod from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        clocksPerRowPeriod = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of clocksPerRowPeriod handling
+        
+        # read horizontalFrontPorch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        horizontalFrontPorch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of horizontalFrontPorch handling
+        
+        # read horizontalBackPorch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        horizontalBackPorch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of horizontalBackPorch handling
+        
+        # read frontTelemetryPixels from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        frontTelemetryPixels = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of frontTelemetryPixels handling
+        
+        # read rearTelemetryPixels from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        rearTelemetryPixels = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of rearTelemetryPixels handling
+        
+        # read videoColumns from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        videoColumns = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of videoColumns handling
+        
+        # read validColumns from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        validColumns = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of validColumns handling
+        
+        # read telemetryRows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        telemetryRows = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of telemetryRows handling
+        
+        # read videoRows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        videoRows = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of videoRows handling
+        
+        # read validRows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        validRows = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of validRows handling
+        
+        # read verticalFrontPorch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        verticalFrontPorch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of verticalFrontPorch handling
+        
+        # read verticalBackPorch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        verticalBackPorch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of verticalBackPorch handling
+        
+        # read rowPeriodsPerFrame from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        rowPeriodsPerFrame = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of rowPeriodsPerFrame handling
+        
+        # read clocksPerFrame from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        clocksPerFrame = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of clocksPerFrame handling
+        
+        # read clockRateInMHz from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        clockRateInMHz = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of clockRateInMHz handling
+        
+        # read frameRateInHz from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        frameRateInHz = byteToFLOAT(receiveData,inPtr)
+        inPtr+=4
+        # end of frameRateInHz handling
+        
+        # read validOnRisingEdge from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        validOnRisingEdge = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of validOnRisingEdge handling
+        
+        # read dataWidthInBits from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None, None
+        dataWidthInBits = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of dataWidthInBits handling
+        
+        return returnCode, horizontalSyncWidth, verticalSyncWidth, clocksPerRowPeriod, horizontalFrontPorch, horizontalBackPorch, frontTelemetryPixels, rearTelemetryPixels, videoColumns, validColumns, telemetryRows, videoRows, validRows, verticalFrontPorch, verticalBackPorch, rowPeriodsPerFrame, clocksPerFrame, clockRateInMHz, frameRateInHz, validOnRisingEdge, dataWidthInBits
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetAllCustomLcdConfigs(self, config0, config1):
+        # Create bytearray object for inputs
+        sendBytes = 96
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write config0 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_DVO_LCD_CONFIG_TToByte(config0,sendData,outPtr)
+        outPtr += 48
+        
+        # write config1 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_DVO_LCD_CONFIG_TToByte(config1,sendData,outPtr)
+        outPtr += 48
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006001A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetAllCustomLcdConfigs(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 96
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006001B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read config0 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        config0 = byteToFLR_DVO_LCD_CONFIG_T(receiveData,inPtr)
+        inPtr+=48
+        # end of config0 handling
+        
+        # read config1 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        config1 = byteToFLR_DVO_LCD_CONFIG_T(receiveData,inPtr)
+        inPtr+=48
+        # end of config1 handling
+        
+        return returnCode, config0, config1
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetOutputIr16Format(self, format):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write format to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(format.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006001C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetOutputIr16Format(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006001D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read format from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        format = FLR_DVO_OUTPUT_IR16_FORMAT_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of format handling
+        
+        return returnCode, format
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetLcdClockRate(self, clockRate):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write clockRate to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(clockRate.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006001E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetLcdClockRate(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006001F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read clockRate from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        clockRate = FLR_DVO_LCD_CLOCK_RATE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of clockRate handling
+        
+        return returnCode, clockRate
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetLcdVideoFrameRate(self, framerate):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write framerate to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(framerate,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060020, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetLcdVideoFrameRate(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060021, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read framerate from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        framerate = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of framerate handling
+        
+        return returnCode, framerate
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetMipiStartState(self, state):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write state to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(state.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060022, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetMipiStartState(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060023, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read state from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        state = FLR_DVO_MIPI_STATE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of state handling
+        
+        return returnCode, state
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetMipiState(self, state):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write state to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(state.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060024, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetMipiState(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060025, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read state from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        state = FLR_DVO_MIPI_STATE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of state handling
+        
+        return returnCode, state
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetMipiClockLaneMode(self, mode):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write mode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(mode.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060026, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetMipiClockLaneMode(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060027, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read mode from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        mode = FLR_DVO_MIPI_CLOCK_LANE_MODE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of mode handling
+        
+        return returnCode, mode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetOutputInterface(self, format):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write format to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(format.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060028, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetOutputInterface(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00060029, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read format from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        format = FLR_DVO_OUTPUT_INTERFACE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of format handling
+        
+        return returnCode, format
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_SetOutputFormatVC1(self, format):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write format to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(format.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006002A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: dvo
+
+    def CLIENT_pkg_dvo_GetOutputFormatVC1(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0006002B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read format from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        format = FLR_DVO_OUTPUT_FORMAT_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of format handling
+        
+        return returnCode, format
+        
+    #End of Module: dvo
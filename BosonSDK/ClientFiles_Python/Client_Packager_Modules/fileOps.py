@@ -0,0 +1,470 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: fileOps, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_fileOps_Dir(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160000, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read dirent from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        dirent = byteToUCHARArray(receiveData,inPtr,128)
+        inPtr+=128
+        # end of dirent handling
+        
+        return returnCode, dirent
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Cd(self, path):
+        # Create bytearray object for inputs
+        sendBytes = 128
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 128
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, pwd
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read pwd from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        pwd = byteToUCHARArray(receiveData,inPtr,128)
+        inPtr+=128
+        # end of pwd handling
+        
+        return returnCode, pwd
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Md(self, path):
+        # Create bytearray object for inputs
+        sendBytes = 128
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Fopen(self, path, mode):
+        # Create bytearray object for inputs
+        sendBytes = 256
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, id
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        # write mode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, id
+        UCHARArrayToByte(mode,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read id from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        id = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of id handling
+        
+        return returnCode, id
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Fclose(self, id):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(id,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Fread(self, id, length):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 132
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, buf, ret
+        UINT_32ToByte(id,sendData,outPtr)
+        outPtr += 4
+        
+        # write length to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, buf, ret
+        UINT_32ToByte(length,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read buf from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        buf = byteToUCHARArray(receiveData,inPtr,128)
+        inPtr+=128
+        # end of buf handling
+        
+        # read ret from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        ret = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of ret handling
+        
+        return returnCode, buf, ret
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Fwrite(self, id, length, buf):
+        # Create bytearray object for inputs
+        sendBytes = 136
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, ret
+        UINT_32ToByte(id,sendData,outPtr)
+        outPtr += 4
+        
+        # write length to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, ret
+        UINT_32ToByte(length,sendData,outPtr)
+        outPtr += 4
+        
+        # write buf to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, ret
+        UCHARArrayToByte(buf,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read ret from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        ret = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of ret handling
+        
+        return returnCode, ret
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Ftell(self, id):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, offset
+        UINT_32ToByte(id,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read offset from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        offset = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of offset handling
+        
+        return returnCode, offset
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Fseek(self, id, offset, origin):
+        # Create bytearray object for inputs
+        sendBytes = 12
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(id,sendData,outPtr)
+        outPtr += 4
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write origin to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(origin,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Ftruncate(self, id, length):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(id,sendData,outPtr)
+        outPtr += 4
+        
+        # write length to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(length,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00160009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Rmdir(self, path):
+        # Create bytearray object for inputs
+        sendBytes = 128
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0016000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Rm(self, path):
+        # Create bytearray object for inputs
+        sendBytes = 128
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0016000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_Rename(self, oldpath, newpath):
+        # Create bytearray object for inputs
+        sendBytes = 256
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write oldpath to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(oldpath,128,sendData,outPtr)
+        outPtr += 128
+        
+        # write newpath to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(newpath,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0016000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: fileOps
+
+    def CLIENT_pkg_fileOps_GetFileSize(self, path):
+        # Create bytearray object for inputs
+        sendBytes = 128
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, fileLength
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0016000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read fileLength from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        fileLength = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of fileLength handling
+        
+        return returnCode, fileLength
+        
+    #End of Module: fileOps
@@ -0,0 +1,49 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: flashMapFs, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_flashMapFs_GetHeaderVersion(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00340005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read major from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        major = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of major handling
+        
+        # read minor from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        minor = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of minor handling
+        
+        # read patch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        patch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of patch handling
+        
+        return returnCode, major, minor, patch
+        
+    #End of Module: flashMapFs
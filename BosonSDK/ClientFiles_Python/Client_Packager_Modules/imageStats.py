@@ -0,0 +1,426 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: imageStats, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_imageStats_GetTotalHistPixelsInROI(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0000, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read totalPixelsInROI from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        totalPixelsInROI = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of totalPixelsInROI handling
+        
+        return returnCode, totalPixelsInROI
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetPopBelowLowToHighThresh(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read popBelowLowToHighThresh from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        popBelowLowToHighThresh = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of popBelowLowToHighThresh handling
+        
+        return returnCode, popBelowLowToHighThresh
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetPopAboveHighToLowThresh(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read popAboveHighToLowThresh from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        popAboveHighToLowThresh = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of popAboveHighToLowThresh handling
+        
+        return returnCode, popAboveHighToLowThresh
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_SetROI(self, roi):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write roi to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ROI_TToByte(roi,sendData,outPtr)
+        outPtr += 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetROI(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read roi from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        roi = byteToFLR_ROI_T(receiveData,inPtr)
+        inPtr+=8
+        # end of roi handling
+        
+        return returnCode, roi
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetFirstBin(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read firstBin from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        firstBin = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of firstBin handling
+        
+        return returnCode, firstBin
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetLastBin(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read lastBin from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        lastBin = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of lastBin handling
+        
+        return returnCode, lastBin
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetMean(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read mean from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        mean = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of mean handling
+        
+        return returnCode, mean
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetFirstBinInROI(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read firstBinInROI from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        firstBinInROI = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of firstBinInROI handling
+        
+        return returnCode, firstBinInROI
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetLastBinInROI(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D0009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read lastBinInROI from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        lastBinInROI = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of lastBinInROI handling
+        
+        return returnCode, lastBinInROI
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetMeanInROI(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read meanInROI from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        meanInROI = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of meanInROI handling
+        
+        return returnCode, meanInROI
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetImageStats(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 6
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read meanIntensity from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        meanIntensity = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of meanIntensity handling
+        
+        # read peakIntensity from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        peakIntensity = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of peakIntensity handling
+        
+        # read baseIntensity from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        baseIntensity = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of baseIntensity handling
+        
+        return returnCode, meanIntensity, peakIntensity, baseIntensity
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetPopAboveLowToHighThreshCATS(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read popAboveLowToHighThresh from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        popAboveLowToHighThresh = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of popAboveLowToHighThresh handling
+        
+        return returnCode, popAboveLowToHighThresh
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetPopBelowHighToLowThreshCATS(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read popBelowHighToLowThresh from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        popBelowHighToLowThresh = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of popBelowHighToLowThresh handling
+        
+        return returnCode, popBelowHighToLowThresh
+        
+    #End of Module: imageStats
+
+    def CLIENT_pkg_imageStats_GetPopBetweenLthCATSAndLthSATS(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001D000E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read popBetweenCatsAndSats from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        popBetweenCatsAndSats = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of popBetweenCatsAndSats handling
+        
+        return returnCode, popBetweenCatsAndSats
+        
+    #End of Module: imageStats
@@ -0,0 +1,663 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: isotherm, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_isotherm_GetEnable(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0046, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read isothermEnable from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        isothermEnable = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of isothermEnable handling
+        
+        return returnCode, isothermEnable
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetEnable(self, isothermEnable):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write isothermEnable to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(isothermEnable.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0047, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetTemps(self, table, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5):
+        # Create bytearray object for inputs
+        sendBytes = 24
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(table.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write thIsoT1 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(thIsoT1,sendData,outPtr)
+        outPtr += 4
+        
+        # write thIsoT2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(thIsoT2,sendData,outPtr)
+        outPtr += 4
+        
+        # write thIsoT3 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(thIsoT3,sendData,outPtr)
+        outPtr += 4
+        
+        # write thIsoT4 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(thIsoT4,sendData,outPtr)
+        outPtr += 4
+        
+        # write thIsoT5 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(thIsoT5,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0048, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetTemps(self, table):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 20
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5
+        INT_32ToByte(table.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0049, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read thIsoT1 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        thIsoT1 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of thIsoT1 handling
+        
+        # read thIsoT2 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        thIsoT2 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of thIsoT2 handling
+        
+        # read thIsoT3 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        thIsoT3 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of thIsoT3 handling
+        
+        # read thIsoT4 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        thIsoT4 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of thIsoT4 handling
+        
+        # read thIsoT5 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None
+        thIsoT5 = byteToINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of thIsoT5 handling
+        
+        return returnCode, thIsoT1, thIsoT2, thIsoT3, thIsoT4, thIsoT5
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetIsoColorValues(self, table, region0, region1, region2, region3, region4, region5):
+        # Create bytearray object for inputs
+        sendBytes = 124
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(table.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region0 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_COLORS_TToByte(region0,sendData,outPtr)
+        outPtr += 20
+        
+        # write region1 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_COLORS_TToByte(region1,sendData,outPtr)
+        outPtr += 20
+        
+        # write region2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_COLORS_TToByte(region2,sendData,outPtr)
+        outPtr += 20
+        
+        # write region3 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_COLORS_TToByte(region3,sendData,outPtr)
+        outPtr += 20
+        
+        # write region4 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_COLORS_TToByte(region4,sendData,outPtr)
+        outPtr += 20
+        
+        # write region5 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_COLORS_TToByte(region5,sendData,outPtr)
+        outPtr += 20
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F004A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetIsoColorValues(self, table):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 120
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, region0, region1, region2, region3, region4, region5
+        INT_32ToByte(table.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F004B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read region0 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region0 = byteToFLR_ISOTHERM_COLORS_T(receiveData,inPtr)
+        inPtr+=20
+        # end of region0 handling
+        
+        # read region1 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region1 = byteToFLR_ISOTHERM_COLORS_T(receiveData,inPtr)
+        inPtr+=20
+        # end of region1 handling
+        
+        # read region2 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region2 = byteToFLR_ISOTHERM_COLORS_T(receiveData,inPtr)
+        inPtr+=20
+        # end of region2 handling
+        
+        # read region3 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region3 = byteToFLR_ISOTHERM_COLORS_T(receiveData,inPtr)
+        inPtr+=20
+        # end of region3 handling
+        
+        # read region4 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region4 = byteToFLR_ISOTHERM_COLORS_T(receiveData,inPtr)
+        inPtr+=20
+        # end of region4 handling
+        
+        # read region5 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region5 = byteToFLR_ISOTHERM_COLORS_T(receiveData,inPtr)
+        inPtr+=20
+        # end of region5 handling
+        
+        return returnCode, region0, region1, region2, region3, region4, region5
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetRegionMode(self, table, region0, region1, region2, region3, region4, region5):
+        # Create bytearray object for inputs
+        sendBytes = 28
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(table.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region0 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(region0.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region1 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(region1.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(region2.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region3 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(region3.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region4 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(region4.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write region5 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(region5.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F004C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetRegionMode(self, table):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 24
+        
+        # write table to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, region0, region1, region2, region3, region4, region5
+        INT_32ToByte(table.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F004D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read region0 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region0 = FLR_ISOTHERM_REGION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of region0 handling
+        
+        # read region1 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region1 = FLR_ISOTHERM_REGION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of region1 handling
+        
+        # read region2 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region2 = FLR_ISOTHERM_REGION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of region2 handling
+        
+        # read region3 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region3 = FLR_ISOTHERM_REGION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of region3 handling
+        
+        # read region4 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region4 = FLR_ISOTHERM_REGION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of region4 handling
+        
+        # read region5 from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None, None, None, None
+        region5 = FLR_ISOTHERM_REGION_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of region5 handling
+        
+        return returnCode, region0, region1, region2, region3, region4, region5
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetUnit(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F004E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read unit from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        unit = FLR_ISOTHERM_UNIT_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of unit handling
+        
+        return returnCode, unit
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetUnit(self, unit):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write unit to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(unit.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F004F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetSettingsLowGain(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 164
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0050, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read settings from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        settings = byteToFLR_ISOTHERM_SETTINGS_T(receiveData,inPtr)
+        inPtr+=164
+        # end of settings handling
+        
+        return returnCode, settings
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetSettingsLowGain(self, settings):
+        # Create bytearray object for inputs
+        sendBytes = 164
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write settings to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_SETTINGS_TToByte(settings,sendData,outPtr)
+        outPtr += 164
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0051, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetSettingsHighGain(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 164
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0052, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read settings from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        settings = byteToFLR_ISOTHERM_SETTINGS_T(receiveData,inPtr)
+        inPtr+=164
+        # end of settings handling
+        
+        return returnCode, settings
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetSettingsHighGain(self, settings):
+        # Create bytearray object for inputs
+        sendBytes = 164
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write settings to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_ISOTHERM_SETTINGS_TToByte(settings,sendData,outPtr)
+        outPtr += 164
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0053, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_SetColorLutId(self, colorLutIdLowGain, colorLutIdHighGain):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write colorLutIdLowGain to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(colorLutIdLowGain.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write colorLutIdHighGain to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(colorLutIdHighGain.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0054, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: isotherm
+
+    def CLIENT_pkg_isotherm_GetColorLutId(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x003F0055, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read colorLutIdLowGain from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        colorLutIdLowGain = FLR_COLORLUT_ID_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of colorLutIdLowGain handling
+        
+        # read colorLutIdHighGain from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        colorLutIdHighGain = FLR_COLORLUT_ID_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of colorLutIdHighGain handling
+        
+        return returnCode, colorLutIdLowGain, colorLutIdHighGain
+        
+    #End of Module: isotherm
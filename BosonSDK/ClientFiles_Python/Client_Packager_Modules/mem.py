@@ -0,0 +1,482 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: mem, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_mem_ReadCapture(self, bufferNum, offset, sizeInBytes):
+        # Create bytearray object for inputs
+        sendBytes = 7
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 256
+        
+        # write bufferNum to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UCHARToByte(bufferNum,sendData,outPtr)
+        outPtr += 1
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write sizeInBytes to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_16ToByte(sizeInBytes,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUCHARArray(receiveData,inPtr,sizeInBytes)
+        inPtr+=sizeInBytes
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_GetCaptureSize(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read bytes from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        bytes = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of bytes handling
+        
+        # read rows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        rows = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of rows handling
+        
+        # read columns from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        columns = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of columns handling
+        
+        return returnCode, bytes, rows, columns
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_WriteFlash(self, location, index, offset, sizeInBytes, data):
+        # Create bytearray object for inputs
+        sendBytes = sizeInBytes + 11
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write location to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(location.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write index to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(index,sendData,outPtr)
+        outPtr += 1
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write sizeInBytes to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(sizeInBytes,sendData,outPtr)
+        outPtr += 2
+        
+        # write data to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(data,sizeInBytes,sendData,outPtr)
+        outPtr += sizeInBytes
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_ReadFlash(self, location, index, offset, sizeInBytes):
+        # Create bytearray object for inputs
+        sendBytes = 11
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 256
+        
+        # write location to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        INT_32ToByte(location.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write index to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UCHARToByte(index,sendData,outPtr)
+        outPtr += 1
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write sizeInBytes to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_16ToByte(sizeInBytes,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUCHARArray(receiveData,inPtr,sizeInBytes)
+        inPtr+=sizeInBytes
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_GetFlashSize(self, location):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write location to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, bytes
+        INT_32ToByte(location.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read bytes from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        bytes = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of bytes handling
+        
+        return returnCode, bytes
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_EraseFlash(self, location, index):
+        # Create bytearray object for inputs
+        sendBytes = 5
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write location to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(location.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write index to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(index,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_EraseFlashPartial(self, location, index, offset, length):
+        # Create bytearray object for inputs
+        sendBytes = 13
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write location to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(location.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write index to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(index,sendData,outPtr)
+        outPtr += 1
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write length to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(length,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF0009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_ReadCurrentGain(self, offset, sizeInBytes):
+        # Create bytearray object for inputs
+        sendBytes = 6
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 256
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write sizeInBytes to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_16ToByte(sizeInBytes,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUCHARArray(receiveData,inPtr,sizeInBytes)
+        inPtr+=sizeInBytes
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_GetGainSize(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read bytes from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        bytes = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of bytes handling
+        
+        # read rows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        rows = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of rows handling
+        
+        # read columns from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        columns = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of columns handling
+        
+        return returnCode, bytes, rows, columns
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_GetCaptureSizeSrc(self, src):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 8
+        
+        # write src to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, bytes, rows, columns
+        INT_32ToByte(src.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read bytes from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        bytes = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of bytes handling
+        
+        # read rows from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        rows = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of rows handling
+        
+        # read columns from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        columns = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of columns handling
+        
+        return returnCode, bytes, rows, columns
+        
+    #End of Module: mem
+
+    def CLIENT_pkg_mem_ReadCaptureSrc(self, src, bufferNum, offset, sizeInBytes):
+        # Create bytearray object for inputs
+        sendBytes = 11
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 256
+        
+        # write src to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        INT_32ToByte(src.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write bufferNum to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UCHARToByte(bufferNum,sendData,outPtr)
+        outPtr += 1
+        
+        # write offset to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_32ToByte(offset,sendData,outPtr)
+        outPtr += 4
+        
+        # write sizeInBytes to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, data
+        UINT_16ToByte(sizeInBytes,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0xFFFF000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read data from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        data = byteToUCHARArray(receiveData,inPtr,sizeInBytes)
+        inPtr+=sizeInBytes
+        # end of data handling
+        
+        return returnCode, data
+        
+    #End of Module: mem
@@ -0,0 +1,218 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: scaler, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_scaler_GetMaxZoom(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000D0001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read zoom from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        zoom = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of zoom handling
+        
+        return returnCode, zoom
+        
+    #End of Module: scaler
+
+    def CLIENT_pkg_scaler_SetZoom(self, zoomParams):
+        # Create bytearray object for inputs
+        sendBytes = 12
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write zoomParams to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SCALER_ZOOM_PARAMS_TToByte(zoomParams,sendData,outPtr)
+        outPtr += 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000D0002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: scaler
+
+    def CLIENT_pkg_scaler_GetZoom(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000D0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read zoomParams from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        zoomParams = byteToFLR_SCALER_ZOOM_PARAMS_T(receiveData,inPtr)
+        inPtr+=12
+        # end of zoomParams handling
+        
+        return returnCode, zoomParams
+        
+    #End of Module: scaler
+
+    def CLIENT_pkg_scaler_SetFractionalZoom(self, zoomNumerator, zoomDenominator, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable):
+        # Create bytearray object for inputs
+        sendBytes = 32
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write zoomNumerator to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomNumerator,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomDenominator to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomDenominator,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomXCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomXCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomYCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomYCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write inChangeEnable to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(inChangeEnable.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomOutXCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomOutXCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomOutYCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomOutYCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write outChangeEnable to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(outChangeEnable.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000D0007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: scaler
+
+    def CLIENT_pkg_scaler_SetIndexZoom(self, zoomIndex, zoomXCenter, zoomYCenter, inChangeEnable, zoomOutXCenter, zoomOutYCenter, outChangeEnable):
+        # Create bytearray object for inputs
+        sendBytes = 28
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write zoomIndex to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomIndex,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomXCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomXCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomYCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomYCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write inChangeEnable to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(inChangeEnable.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomOutXCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomOutXCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write zoomOutYCenter to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(zoomOutYCenter,sendData,outPtr)
+        outPtr += 4
+        
+        # write outChangeEnable to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(outChangeEnable.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x000D0008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: scaler
@@ -0,0 +1,1875 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: symbology, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_symbology_SetEnable(self, draw_symbols):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write draw_symbols to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(draw_symbols.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140000, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateBitmap(self, ID, pos_X, pos_Y, width, height):
+        # Create bytearray object for inputs
+        sendBytes = 9
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_SendData(self, ID, size, text):
+        # Create bytearray object for inputs
+        sendBytes = 131
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write size to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(size,sendData,outPtr)
+        outPtr += 2
+        
+        # write text to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(text,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateArc(self, ID, pos_X, pos_Y, width, height, start_angle, end_angle, color):
+        # Create bytearray object for inputs
+        sendBytes = 21
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write start_angle to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(start_angle,sendData,outPtr)
+        outPtr += 4
+        
+        # write end_angle to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLOATToByte(end_angle,sendData,outPtr)
+        outPtr += 4
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateText(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color, text):
+        # Create bytearray object for inputs
+        sendBytes = 146
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write font to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        CHARToByte(font,sendData,outPtr)
+        outPtr += 1
+        
+        # write size to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(size,sendData,outPtr)
+        outPtr += 2
+        
+        # write alignment to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(alignment.value,sendData,outPtr)
+        outPtr += 2
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        # write text to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(text,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_MoveSprite(self, ID, pos_X, pos_Y):
+        # Create bytearray object for inputs
+        sendBytes = 5
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_AddToGroup(self, ID, group_ID):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write group_ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(group_ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_RemoveFromGroup(self, ID, group_ID):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write group_ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(group_ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_UpdateAndShow(self, ID, visible):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write visible to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(visible,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_UpdateAndShowGroup(self, group_ID, visible):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write group_ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(group_ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write visible to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(visible,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_Delete(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_DeleteGroup(self, group_ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write group_ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(group_ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateFilledRectangle(self, ID, pos_X, pos_Y, width, height, color):
+        # Create bytearray object for inputs
+        sendBytes = 13
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014000E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateOutlinedRectangle(self, ID, pos_X, pos_Y, width, height, color):
+        # Create bytearray object for inputs
+        sendBytes = 13
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140010, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateBitmapFromPng(self, ID, pos_X, pos_Y, size):
+        # Create bytearray object for inputs
+        sendBytes = 7
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write size to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(size,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140012, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateCompressedBitmap(self, ID, pos_X, pos_Y, width, height):
+        # Create bytearray object for inputs
+        sendBytes = 9
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140014, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateBitmapFromPngFile(self, ID, pos_X, pos_Y, path):
+        # Create bytearray object for inputs
+        sendBytes = 133
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140016, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateBitmapFromFile(self, ID, pos_X, pos_Y, path, imageType):
+        # Create bytearray object for inputs
+        sendBytes = 135
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        # write imageType to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(imageType.value,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140017, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_ResetWritePosition(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140018, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_MoveByOffset(self, ID, off_X, off_Y):
+        # Create bytearray object for inputs
+        sendBytes = 5
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write off_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(off_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write off_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(off_Y,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140019, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_MoveGroupByOffset(self, ID, off_X, off_Y):
+        # Create bytearray object for inputs
+        sendBytes = 5
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write off_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(off_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write off_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(off_Y,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014001A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateFilledEllipse(self, ID, pos_X, pos_Y, width, height, color):
+        # Create bytearray object for inputs
+        sendBytes = 13
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014001B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateLine(self, ID, pos_X, pos_Y, pos_X2, pos_Y2, color):
+        # Create bytearray object for inputs
+        sendBytes = 13
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_X2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X2,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y2,sendData,outPtr)
+        outPtr += 2
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014001C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_SetZorder(self, ID, zorder):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write zorder to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(zorder,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014001D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_SaveConfiguration(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014001E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_ReloadConfiguration(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014001F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetEnable(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140020, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read draw_symbols from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        draw_symbols = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of draw_symbols handling
+        
+        return returnCode, draw_symbols
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_SetClonesNumber(self, ID, numberOfClones):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write numberOfClones to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(numberOfClones,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140021, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_MoveCloneByOffset(self, ID, cloneID, pos_X, pos_Y):
+        # Create bytearray object for inputs
+        sendBytes = 6
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write cloneID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(cloneID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140022, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_MoveCloneSprite(self, ID, cloneID, pos_X, pos_Y):
+        # Create bytearray object for inputs
+        sendBytes = 6
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write cloneID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(cloneID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140023, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_SetTransformation(self, transformation):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write transformation to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(transformation.value,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140024, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_UpdateAllVisible(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140025, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_SetSizeAndScalingMode(self, ID, width, height, scalingMode):
+        # Create bytearray object for inputs
+        sendBytes = 7
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write scalingMode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(scalingMode.value,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140026, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateLineHVT(self, ID, pos_X, pos_Y, pos_X2, pos_Y2, color1, color2, dashLen, thickness):
+        # Create bytearray object for inputs
+        sendBytes = 21
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_X2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X2,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y2,sendData,outPtr)
+        outPtr += 2
+        
+        # write color1 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color1,sendData,outPtr)
+        outPtr += 4
+        
+        # write color2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color2,sendData,outPtr)
+        outPtr += 4
+        
+        # write dashLen to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(dashLen,sendData,outPtr)
+        outPtr += 2
+        
+        # write thickness to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_16ToByte(thickness,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140027, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateTextHVT(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color1, color2, dashLen, text):
+        # Create bytearray object for inputs
+        sendBytes = 151
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write font to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        CHARToByte(font,sendData,outPtr)
+        outPtr += 1
+        
+        # write size to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(size,sendData,outPtr)
+        outPtr += 2
+        
+        # write alignment to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(alignment.value,sendData,outPtr)
+        outPtr += 2
+        
+        # write color1 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color1,sendData,outPtr)
+        outPtr += 4
+        
+        # write color2 to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color2,sendData,outPtr)
+        outPtr += 4
+        
+        # write dashLen to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(dashLen,sendData,outPtr)
+        outPtr += 1
+        
+        # write text to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(text,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140028, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateTextBg(self, ID, pos_X, pos_Y, width, height, font, size, alignment, color, bgColor, text):
+        # Create bytearray object for inputs
+        sendBytes = 150
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write font to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        CHARToByte(font,sendData,outPtr)
+        outPtr += 1
+        
+        # write size to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(size,sendData,outPtr)
+        outPtr += 2
+        
+        # write alignment to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(alignment.value,sendData,outPtr)
+        outPtr += 2
+        
+        # write color to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(color,sendData,outPtr)
+        outPtr += 4
+        
+        # write bgColor to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UINT_32ToByte(bgColor,sendData,outPtr)
+        outPtr += 4
+        
+        # write text to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(text,128,sendData,outPtr)
+        outPtr += 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140029, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CreateScaledBitmapFromFile(self, ID, pos_X, pos_Y, width, height, scalingMode, path, imageType):
+        # Create bytearray object for inputs
+        sendBytes = 141
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        # write pos_X to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_X,sendData,outPtr)
+        outPtr += 2
+        
+        # write pos_Y to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(pos_Y,sendData,outPtr)
+        outPtr += 2
+        
+        # write width to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(width,sendData,outPtr)
+        outPtr += 2
+        
+        # write height to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(height,sendData,outPtr)
+        outPtr += 2
+        
+        # write scalingMode to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(scalingMode.value,sendData,outPtr)
+        outPtr += 2
+        
+        # write path to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARArrayToByte(path,128,sendData,outPtr)
+        outPtr += 128
+        
+        # write imageType to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_16ToByte(imageType.value,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014002A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetLocation(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, pos_X, pos_Y
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014002B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read pos_X from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        pos_X = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of pos_X handling
+        
+        # read pos_Y from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        pos_Y = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of pos_Y handling
+        
+        return returnCode, pos_X, pos_Y
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetSize(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, width, height
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014002C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read width from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        width = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of width handling
+        
+        # read height from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        height = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of height handling
+        
+        return returnCode, width, height
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetZorder(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 1
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, zorder
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014002D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read zorder from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        zorder = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of zorder handling
+        
+        return returnCode, zorder
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetColor(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, color
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014002E, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read color from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        color = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of color handling
+        
+        return returnCode, color
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetType(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, type
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x0014002F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read type from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        type = FLR_SYMBOLOGY_TYPE_E(byteToINT_16(receiveData,inPtr))
+        inPtr+=2
+        # end of type handling
+        
+        return returnCode, type
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_CopySymbol(self, source, destination):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write source to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(source,sendData,outPtr)
+        outPtr += 1
+        
+        # write destination to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(destination,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140030, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: symbology
+
+    def CLIENT_pkg_symbology_GetTextFontSize(self, ID):
+        # Create bytearray object for inputs
+        sendBytes = 1
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        # write ID to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, size
+        UCHARToByte(ID,sendData,outPtr)
+        outPtr += 1
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x00140031, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read size from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        size = byteToINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of size handling
+        
+        return returnCode, size
+        
+    #End of Module: symbology
@@ -0,0 +1,455 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: sysinfo, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_sysinfo_GetMonitorSoftwareRev(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0001, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read major from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        major = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of major handling
+        
+        # read minor from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        minor = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of minor handling
+        
+        # read patch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        patch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of patch handling
+        
+        return returnCode, major, minor, patch
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetMonitorBuildVariant(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 50
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read monitorBuildVariant from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        monitorBuildVariant = byteToFLR_SYSINFO_MONITOR_BUILD_VARIANT_T(receiveData,inPtr)
+        inPtr+=50
+        # end of monitorBuildVariant handling
+        
+        return returnCode, monitorBuildVariant
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetProductName(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read name from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        name = byteToUCHARArray(receiveData,inPtr,128)
+        inPtr+=128
+        # end of name handling
+        
+        return returnCode, name
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetCameraSN(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read number from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        number = byteToUCHARArray(receiveData,inPtr,128)
+        inPtr+=128
+        # end of number handling
+        
+        return returnCode, number
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetBootLocation(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0006, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read bootSwLocation from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        bootSwLocation = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of bootSwLocation handling
+        
+        return returnCode, bootSwLocation
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetSwConfigID(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0007, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read swConfigID from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        swConfigID = FLR_SYSINFO_SW_CONFIG_ID_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of swConfigID handling
+        
+        return returnCode, swConfigID
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetSwPermissions(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read swPermissions from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        swPermissions = FLR_SYSINFO_SW_PERMISSIONS_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of swPermissions handling
+        
+        return returnCode, swPermissions
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetIs9HzBuild(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read is9HzBuild from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        is9HzBuild = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of is9HzBuild handling
+        
+        return returnCode, is9HzBuild
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetProductVersion(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read major from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        major = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of major handling
+        
+        # read minor from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        minor = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of minor handling
+        
+        # read patch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        patch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of patch handling
+        
+        return returnCode, major, minor, patch
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetMonitorProductRev(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 12
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F000F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read major from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        major = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of major handling
+        
+        # read minor from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        minor = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of minor handling
+        
+        # read patch from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        patch = byteToUINT_32(receiveData,inPtr)
+        inPtr+=4
+        # end of patch handling
+        
+        return returnCode, major, minor, patch
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetOpticalRevision(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0011, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read revision from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        revision = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of revision handling
+        
+        return returnCode, revision
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetSensorRevision(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0013, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read revision from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        revision = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of revision handling
+        
+        return returnCode, revision
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetProbeTipSN(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 128
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0015, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read number from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        number = byteToUCHARArray(receiveData,inPtr,128)
+        inPtr+=128
+        # end of number handling
+        
+        return returnCode, number
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetMechanicalRevision(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0017, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read revision from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        revision = byteToUINT_16(receiveData,inPtr)
+        inPtr+=2
+        # end of revision handling
+        
+        return returnCode, revision
+        
+    #End of Module: sysinfo
+
+    def CLIENT_pkg_sysinfo_GetProbeTipType(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 5
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x002F0018, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read type from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        type = byteToFLR_SYSINFO_PROBE_TIP_TYPE(receiveData,inPtr)
+        inPtr+=5
+        # end of type handling
+        
+        return returnCode, type
+        
+    #End of Module: sysinfo
@@ -0,0 +1,442 @@
+#  /////////////////////////////////////////////////////
+#  // DO NOT EDIT.  This is a machine generated file. //
+#  /////////////////////////////////////////////////////
+
+
+from ..Client_Packager import *
+
+# Module: systemSymbols, loaded by Packager on first use
+class Packager():
+    def CLIENT_pkg_systemSymbols_GetID(self, symbol):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 5
+        
+        # write symbol to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, id, id_type
+        INT_32ToByte(symbol.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0002, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read id from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        id = byteToUCHAR(receiveData,inPtr)
+        inPtr+=1
+        # end of id handling
+        
+        # read id_type from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None
+        id_type = FLR_SYSTEMSYMBOLS_ID_TYPE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of id_type handling
+        
+        return returnCode, id, id_type
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetID(self, symbol, id, id_type):
+        # Create bytearray object for inputs
+        sendBytes = 9
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write symbol to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(symbol.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write id to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        UCHARToByte(id,sendData,outPtr)
+        outPtr += 1
+        
+        # write id_type to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(id_type.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0003, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_GetEnable(self, symbol):
+        # Create bytearray object for inputs
+        sendBytes = 4
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 4
+        
+        # write symbol to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, enabled
+        INT_32ToByte(symbol.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0004, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read enabled from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        enabled = FLR_ENABLE_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of enabled handling
+        
+        return returnCode, enabled
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetEnable(self, symbol, enabled):
+        # Create bytearray object for inputs
+        sendBytes = 8
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write symbol to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(symbol.value,sendData,outPtr)
+        outPtr += 4
+        
+        # write enabled to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(enabled.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0005, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_GetSpotConfig(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 195
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0008, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read config from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        config = byteToFLR_SYSTEMSYMBOLS_SPOTCONFIG_T(receiveData,inPtr)
+        inPtr+=195
+        # end of config handling
+        
+        return returnCode, config
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetSpotConfig(self, config):
+        # Create bytearray object for inputs
+        sendBytes = 195
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write config to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SYSTEMSYMBOLS_SPOTCONFIG_TToByte(config,sendData,outPtr)
+        outPtr += 195
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0009, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_GetIsoConfig(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 30
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B000A, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read config from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        config = byteToFLR_SYSTEMSYMBOLS_ISOCONFIG_T(receiveData,inPtr)
+        inPtr+=30
+        # end of config handling
+        
+        return returnCode, config
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetIsoConfig(self, config):
+        # Create bytearray object for inputs
+        sendBytes = 30
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write config to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SYSTEMSYMBOLS_ISOCONFIG_TToByte(config,sendData,outPtr)
+        outPtr += 30
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B000B, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_GetBarConfig(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 24
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B000C, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None, None, None
+        
+        inPtr = 0 #simple array index
+        
+        # read lowGainConfig from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        lowGainConfig = byteToFLR_SYSTEMSYMBOLS_BARCONFIG_T(receiveData,inPtr)
+        inPtr+=10
+        # end of lowGainConfig handling
+        
+        # read highGainConfig from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        highGainConfig = byteToFLR_SYSTEMSYMBOLS_BARCONFIG_T(receiveData,inPtr)
+        inPtr+=10
+        # end of highGainConfig handling
+        
+        # read unit from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None, None, None
+        unit = FLR_TEMPERATURE_UNIT_E(byteToINT_32(receiveData,inPtr))
+        inPtr+=4
+        # end of unit handling
+        
+        return returnCode, lowGainConfig, highGainConfig, unit
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetBarConfig(self, lowGainConfig, highGainConfig, unit):
+        # Create bytearray object for inputs
+        sendBytes = 24
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write lowGainConfig to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SYSTEMSYMBOLS_BARCONFIG_TToByte(lowGainConfig,sendData,outPtr)
+        outPtr += 10
+        
+        # write highGainConfig to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SYSTEMSYMBOLS_BARCONFIG_TToByte(highGainConfig,sendData,outPtr)
+        outPtr += 10
+        
+        # write unit to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        INT_32ToByte(unit.value,sendData,outPtr)
+        outPtr += 4
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B000D, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_GetSpotConfigIds(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 13
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B000F, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read config from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        config = byteToFLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T(receiveData,inPtr)
+        inPtr+=13
+        # end of config handling
+        
+        return returnCode, config
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetSpotConfigIds(self, config):
+        # Create bytearray object for inputs
+        sendBytes = 13
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write config to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_TToByte(config,sendData,outPtr)
+        outPtr += 13
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0010, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_GetIsoConfigIds(self):
+        # Create bytearray object for inputs
+        sendBytes = 0
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0011, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode, None
+        
+        inPtr = 0 #simple array index
+        
+        # read config from receiveData buffer
+        if(inPtr >= expectedReceiveBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW, None
+        config = byteToFLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T(receiveData,inPtr)
+        inPtr+=2
+        # end of config handling
+        
+        return returnCode, config
+        
+    #End of Module: systemSymbols
+
+    def CLIENT_pkg_systemSymbols_SetIsoConfigIds(self, config):
+        # Create bytearray object for inputs
+        sendBytes = 2
+        sendData = bytearray(sendBytes)
+        outPtr = 0 #simple array index in python
+        expectedReceiveBytes = 0
+        
+        # write config to sendData buffer
+        if(outPtr >= sendBytes):
+            return FLR_RESULT.R_API_PKG_BUFFER_OVERFLOW
+        FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_TToByte(config,sendData,outPtr)
+        outPtr += 2
+        
+        returnCode, receiveData = CLIENT_dispatch(self.__commandCount, 0x001B0012, sendData, sendBytes, expectedReceiveBytes, self.fslp)
+        self.__commandCount = fixSpecialBytes(self.__commandCount+1)
+        
+        # Check for any errorcode
+        if(returnCode.value):
+            return returnCode
+        
+        inPtr = 0 #simple array index
+        
+        return returnCode
+        
+    #End of Module: systemSymbols
@@ -1,131 +1,134 @@
-from struct import unpack, pack_into
+from struct import Struct, unpack, pack_into
 from .ReturnCodes import FLR_RESULT
 
+# One precompiled codec per wire type; unpack_from/pack_into work on the
+# caller's buffer in place, without slicing or parsing a format per call.
+BOOL_CODEC = Struct('>?')
+CHAR_CODEC = Struct('>b')
+UCHAR_CODEC = Struct('>B')
+INT_16_CODEC = Struct('>h')
+UINT_16_CODEC = Struct('>H')
+INT_32_CODEC = Struct('>i')
+UINT_32_CODEC = Struct('>I')
+FLOAT_CODEC = Struct('>f')
+DOUBLE_CODEC = Struct('>d')
+
+# Array codecs, made on first use of a type and length
+ARRAY_CODECS = {}
+
+def arrayCodec(code, length):
+	codec = ARRAY_CODECS.get((code, length))
+	if codec is None:
+		codec = ARRAY_CODECS[(code, length)] = Struct('>{:d}{:s}'.format(length, code))
+	return codec
+
 def byteToBOOL(inBuff, inPtr):
-	return bool(unpack('>?',inBuff[inPtr:inPtr+1])[0])
+	return bool(BOOL_CODEC.unpack_from(inBuff, inPtr)[0])
 
 def byteToCHAR(inBuff, inPtr):
-	return unpack('>b',inBuff[inPtr:inPtr+1])[0]
+	return CHAR_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToUCHAR(inBuff, inPtr):
-	return unpack('>B',inBuff[inPtr:inPtr+1])[0]
+	return UCHAR_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToINT_16(inBuff, inPtr):
-	return unpack('>h',inBuff[inPtr:inPtr+2])[0]
+	return INT_16_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToUINT_16(inBuff, inPtr):
-	return unpack('>H',inBuff[inPtr:inPtr+2])[0]
+	return UINT_16_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToINT_32(inBuff, inPtr):
-	return unpack('>i',inBuff[inPtr:inPtr+4])[0]
+	return INT_32_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToUINT_32(inBuff, inPtr):
-	return unpack('>I',inBuff[inPtr:inPtr+4])[0]
+	return UINT_32_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToFLOAT(inBuff, inPtr):
-	return unpack('>f',inBuff[inPtr:inPtr+4])[0]
+	return FLOAT_CODEC.unpack_from(inBuff, inPtr)[0]
 
 def byteToDOUBLE(inBuff, inPtr):
-	return unpack('>d',inBuff[inPtr:inPtr+8])[0]
+	return DOUBLE_CODEC.unpack_from(inBuff, inPtr)[0]
 
 
 def BOOLToByte(inVal, outBuff, outPtr):
-	pack_into('>?',outBuff,outPtr,bool(inVal))
+	BOOL_CODEC.pack_into(outBuff,outPtr,bool(inVal))
 
 def CHARToByte(inVal, outBuff, outPtr):
-	pack_into('>b',outBuff,outPtr,int(inVal))
+	CHAR_CODEC.pack_into(outBuff,outPtr,int(inVal))
 
 def UCHARToByte(inVal, outBuff, outPtr):
-	pack_into('>B',outBuff,outPtr,int(inVal))
+	UCHAR_CODEC.pack_into(outBuff,outPtr,int(inVal))
 
 def INT_16ToByte(inVal, outBuff, outPtr):
-	pack_into('>h',outBuff,outPtr,int(inVal))
+	INT_16_CODEC.pack_into(outBuff,outPtr,int(inVal))
 
 def UINT_16ToByte(inVal, outBuff, outPtr):
-	pack_into('>H',outBuff,outPtr,int(inVal))
+	UINT_16_CODEC.pack_into(outBuff,outPtr,int(inVal))
 
 def INT_32ToByte(inVal, outBuff, outPtr):
-	pack_into('>i',outBuff,outPtr,int(inVal))
+	INT_32_CODEC.pack_into(outBuff,outPtr,int(inVal))
 
 def UINT_32ToByte(inVal, outBuff, outPtr):
-	pack_into('>I',outBuff,outPtr,int(inVal))
+	UINT_32_CODEC.pack_into(outBuff,outPtr,int(inVal))
 
 def FLOATToByte(inVal, outBuff, outPtr):
-	pack_into('>f',outBuff,outPtr,float(inVal))
+	FLOAT_CODEC.pack_into(outBuff,outPtr,float(inVal))
 
 def DOUBLEToByte(inVal, outBuff, outPtr):
-	pack_into('>d',outBuff,outPtr,float(inVal))
+	DOUBLE_CODEC.pack_into(outBuff,outPtr,float(inVal))
 
 
 def byteToBOOLArray(inBuff, inPtr, length):
-	codes = "?"*length
-	return list(bool(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+1*length])))
+	return [bool(value) for value in arrayCodec('?', length).unpack_from(inBuff, inPtr)]
 
 def byteToCHARArray(inBuff, inPtr, length):
-	codes = "b"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+1*length]))
+	return list(arrayCodec('b', length).unpack_from(inBuff, inPtr))
 
 def byteToUCHARArray(inBuff, inPtr, length):
-	codes = "B"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+1*length]))
+	return list(arrayCodec('B', length).unpack_from(inBuff, inPtr))
 
 def byteToINT_16Array(inBuff, inPtr, length):
-	codes = "h"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+2*length]))
+	return list(arrayCodec('h', length).unpack_from(inBuff, inPtr))
 
 def byteToUINT_16Array(inBuff, inPtr, length):
-	codes = "H"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+2*length]))
+	return list(arrayCodec('H', length).unpack_from(inBuff, inPtr))
 
 def byteToINT_32Array(inBuff, inPtr, length):
-	codes = "i"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+4*length]))
+	return list(arrayCodec('i', length).unpack_from(inBuff, inPtr))
 
 def byteToUINT_32Array(inBuff, inPtr, length):
-	codes = "I"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+4*length]))
+	return list(arrayCodec('I', length).unpack_from(inBuff, inPtr))
 
 def byteToFLOATArray(inBuff, inPtr, length):
-	codes = "f"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+4*length]))
+	return list(arrayCodec('f', length).unpack_from(inBuff, inPtr))
 
 def byteToDOUBLEArray(inBuff, inPtr, length):
-	codes = "d"*length
-	return list(unpack('>{:s}'.format(codes),inBuff[inPtr:inPtr+8*length]))
+	return list(arrayCodec('d', length).unpack_from(inBuff, inPtr))
 
 
 def BOOLArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "?"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('?', length).pack_into(outBuff,outPtr,*inVal)
 
 def CHARArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "b"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('b', length).pack_into(outBuff,outPtr,*inVal)
 
 def UCHARArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "B"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('B', length).pack_into(outBuff,outPtr,*inVal)
 
 def INT_16ArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "h"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('h', length).pack_into(outBuff,outPtr,*inVal)
 
 def UINT_16ArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "H"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('H', length).pack_into(outBuff,outPtr,*inVal)
 
 def INT_32ArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "i"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('i', length).pack_into(outBuff,outPtr,*inVal)
 
 def UINT_32ArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "I"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('I', length).pack_into(outBuff,outPtr,*inVal)
 
 def FLOATArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "f"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
+	arrayCodec('f', length).pack_into(outBuff,outPtr,*inVal)
 
 def DOUBLEArrayToByte(inVal, length, outBuff, outPtr):
-	codes = "d"*length
-	pack_into('>{:s}'.format(codes),outBuff,outPtr,*inVal)
\ No newline at end of file
+	arrayCodec('d', length).pack_into(outBuff,outPtr,*inVal)
\ No newline at end of file
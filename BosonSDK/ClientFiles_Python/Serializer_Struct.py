@@ -3,7 +3,7 @@
 #  /////////////////////////////////////////////////////
 
 
-from struct import unpack,pack_into
+from struct import Struct,unpack,pack_into
 from .ReturnCodes import FLR_RESULT
 
 # Garbage Variable to avoid ever having blank code
@@ -26,14 +26,16 @@ class FLR_BOSON_GAIN_SWITCH_PARAMS_T():
     
 # end of FLR_BOSON_GAIN_SWITCH_PARAMS_T()
 
+FLR_BOSON_GAIN_SWITCH_PARAMS_T_CODEC = Struct(">IIII")
+
 def byteToFLR_BOSON_GAIN_SWITCH_PARAMS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_BOSON_GAIN_SWITCH_PARAMS_T()
-    returnStruct.pHighToLowPercent, returnStruct.cHighToLowPercent, returnStruct.pLowToHighPercent, returnStruct.hysteresisPercent = unpack(endian+"IIII",inBuff[inPtr:inPtr+16])
+    returnStruct.pHighToLowPercent, returnStruct.cHighToLowPercent, returnStruct.pLowToHighPercent, returnStruct.hysteresisPercent = (FLR_BOSON_GAIN_SWITCH_PARAMS_T_CODEC if endian == ">" else Struct(endian+"IIII")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_BOSON_GAIN_SWITCH_PARAMS_T()
 
 def FLR_BOSON_GAIN_SWITCH_PARAMS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">IIII",outBuff,outPtr,inVal.pHighToLowPercent, inVal.cHighToLowPercent, inVal.pLowToHighPercent, inVal.hysteresisPercent)
+    FLR_BOSON_GAIN_SWITCH_PARAMS_T_CODEC.pack_into(outBuff,outPtr,inVal.pHighToLowPercent, inVal.cHighToLowPercent, inVal.pLowToHighPercent, inVal.hysteresisPercent)
 # end of FLR_BOSON_GAIN_SWITCH_PARAMS_TToByte()
 
 class FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T():
@@ -54,14 +56,16 @@ class FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T():
     
 # end of FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T()
 
+FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T_CODEC = Struct(">IfIf")
+
 def byteToFLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T()
-    returnStruct.pHighToLowPercent, returnStruct.TempHighToLowDegK, returnStruct.pLowToHighPercent, returnStruct.TempLowToHighDegK = unpack(endian+"IfIf",inBuff[inPtr:inPtr+16])
+    returnStruct.pHighToLowPercent, returnStruct.TempHighToLowDegK, returnStruct.pLowToHighPercent, returnStruct.TempLowToHighDegK = (FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T_CODEC if endian == ">" else Struct(endian+"IfIf")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T()
 
 def FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">IfIf",outBuff,outPtr,inVal.pHighToLowPercent, inVal.TempHighToLowDegK, inVal.pLowToHighPercent, inVal.TempLowToHighDegK)
+    FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_T_CODEC.pack_into(outBuff,outPtr,inVal.pHighToLowPercent, inVal.TempHighToLowDegK, inVal.pLowToHighPercent, inVal.TempLowToHighDegK)
 # end of FLR_BOSON_GAIN_SWITCH_RADIOMETRIC_PARAMS_TToByte()
 
 class FLR_BOSON_PARTNUMBER_T():
@@ -79,14 +83,16 @@ class FLR_BOSON_PARTNUMBER_T():
     
 # end of FLR_BOSON_PARTNUMBER_T()
 
+FLR_BOSON_PARTNUMBER_T_CODEC = Struct(">BBBBBBBBBBBBBBBBBBBB")
+
 def byteToFLR_BOSON_PARTNUMBER_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_BOSON_PARTNUMBER_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16], returnStruct.value[17], returnStruct.value[18], returnStruct.value[19] = unpack(endian+"BBBBBBBBBBBBBBBBBBBB",inBuff[inPtr:inPtr+20])
+    returnStruct.value[:] = (FLR_BOSON_PARTNUMBER_T_CODEC if endian == ">" else Struct(endian+"BBBBBBBBBBBBBBBBBBBB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_BOSON_PARTNUMBER_T()
 
 def FLR_BOSON_PARTNUMBER_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BBBBBBBBBBBBBBBBBBBB",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19])
+    FLR_BOSON_PARTNUMBER_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19])
 # end of FLR_BOSON_PARTNUMBER_TToByte()
 
 class FLR_BOSON_SATURATION_HEADER_LUT_T():
@@ -105,14 +111,16 @@ class FLR_BOSON_SATURATION_HEADER_LUT_T():
     
 # end of FLR_BOSON_SATURATION_HEADER_LUT_T()
 
+FLR_BOSON_SATURATION_HEADER_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHHH")
+
 def byteToFLR_BOSON_SATURATION_HEADER_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_BOSON_SATURATION_HEADER_LUT_T()
-    returnStruct.lut.value[0], returnStruct.lut.value[1], returnStruct.lut.value[2], returnStruct.lut.value[3], returnStruct.lut.value[4], returnStruct.lut.value[5], returnStruct.lut.value[6], returnStruct.lut.value[7], returnStruct.lut.value[8], returnStruct.lut.value[9], returnStruct.lut.value[10], returnStruct.lut.value[11], returnStruct.lut.value[12], returnStruct.lut.value[13], returnStruct.lut.value[14], returnStruct.lut.value[15], returnStruct.lut.value[16], returnStruct.tableIndex = unpack(endian+"HHHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+36])
+    returnStruct.lut.value[0], returnStruct.lut.value[1], returnStruct.lut.value[2], returnStruct.lut.value[3], returnStruct.lut.value[4], returnStruct.lut.value[5], returnStruct.lut.value[6], returnStruct.lut.value[7], returnStruct.lut.value[8], returnStruct.lut.value[9], returnStruct.lut.value[10], returnStruct.lut.value[11], returnStruct.lut.value[12], returnStruct.lut.value[13], returnStruct.lut.value[14], returnStruct.lut.value[15], returnStruct.lut.value[16], returnStruct.tableIndex = (FLR_BOSON_SATURATION_HEADER_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_BOSON_SATURATION_HEADER_LUT_T()
 
 def FLR_BOSON_SATURATION_HEADER_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.lut.value[0], inVal.lut.value[1], inVal.lut.value[2], inVal.lut.value[3], inVal.lut.value[4], inVal.lut.value[5], inVal.lut.value[6], inVal.lut.value[7], inVal.lut.value[8], inVal.lut.value[9], inVal.lut.value[10], inVal.lut.value[11], inVal.lut.value[12], inVal.lut.value[13], inVal.lut.value[14], inVal.lut.value[15], inVal.lut.value[16], inVal.tableIndex)
+    FLR_BOSON_SATURATION_HEADER_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.lut.value[0], inVal.lut.value[1], inVal.lut.value[2], inVal.lut.value[3], inVal.lut.value[4], inVal.lut.value[5], inVal.lut.value[6], inVal.lut.value[7], inVal.lut.value[8], inVal.lut.value[9], inVal.lut.value[10], inVal.lut.value[11], inVal.lut.value[12], inVal.lut.value[13], inVal.lut.value[14], inVal.lut.value[15], inVal.lut.value[16], inVal.tableIndex)
 # end of FLR_BOSON_SATURATION_HEADER_LUT_TToByte()
 
 class FLR_BOSON_SATURATION_LUT_T():
@@ -130,14 +138,16 @@ class FLR_BOSON_SATURATION_LUT_T():
     
 # end of FLR_BOSON_SATURATION_LUT_T()
 
+FLR_BOSON_SATURATION_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHH")
+
 def byteToFLR_BOSON_SATURATION_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_BOSON_SATURATION_LUT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16] = unpack(endian+"HHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+34])
+    returnStruct.value[:] = (FLR_BOSON_SATURATION_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_BOSON_SATURATION_LUT_T()
 
 def FLR_BOSON_SATURATION_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
+    FLR_BOSON_SATURATION_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
 # end of FLR_BOSON_SATURATION_LUT_TToByte()
 
 class FLR_BOSON_SENSOR_PARTNUMBER_T():
@@ -155,14 +165,16 @@ class FLR_BOSON_SENSOR_PARTNUMBER_T():
     
 # end of FLR_BOSON_SENSOR_PARTNUMBER_T()
 
+FLR_BOSON_SENSOR_PARTNUMBER_T_CODEC = Struct(">BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")
+
 def byteToFLR_BOSON_SENSOR_PARTNUMBER_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_BOSON_SENSOR_PARTNUMBER_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16], returnStruct.value[17], returnStruct.value[18], returnStruct.value[19], returnStruct.value[20], returnStruct.value[21], returnStruct.value[22], returnStruct.value[23], returnStruct.value[24], returnStruct.value[25], returnStruct.value[26], returnStruct.value[27], returnStruct.value[28], returnStruct.value[29], returnStruct.value[30], returnStruct.value[31] = unpack(endian+"BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",inBuff[inPtr:inPtr+32])
+    returnStruct.value[:] = (FLR_BOSON_SENSOR_PARTNUMBER_T_CODEC if endian == ">" else Struct(endian+"BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_BOSON_SENSOR_PARTNUMBER_T()
 
 def FLR_BOSON_SENSOR_PARTNUMBER_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31])
+    FLR_BOSON_SENSOR_PARTNUMBER_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31])
 # end of FLR_BOSON_SENSOR_PARTNUMBER_TToByte()
 
 class FLR_CAPTURE_FILE_SETTINGS_T():
@@ -181,14 +193,16 @@ class FLR_CAPTURE_FILE_SETTINGS_T():
     
 # end of FLR_CAPTURE_FILE_SETTINGS_T()
 
+FLR_CAPTURE_FILE_SETTINGS_T_CODEC = Struct(">iBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")
+
 def byteToFLR_CAPTURE_FILE_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_CAPTURE_FILE_SETTINGS_T()
-    returnStruct.captureFileType, returnStruct.filePath[0], returnStruct.filePath[1], returnStruct.filePath[2], returnStruct.filePath[3], returnStruct.filePath[4], returnStruct.filePath[5], returnStruct.filePath[6], returnStruct.filePath[7], returnStruct.filePath[8], returnStruct.filePath[9], returnStruct.filePath[10], returnStruct.filePath[11], returnStruct.filePath[12], returnStruct.filePath[13], returnStruct.filePath[14], returnStruct.filePath[15], returnStruct.filePath[16], returnStruct.filePath[17], returnStruct.filePath[18], returnStruct.filePath[19], returnStruct.filePath[20], returnStruct.filePath[21], returnStruct.filePath[22], returnStruct.filePath[23], returnStruct.filePath[24], returnStruct.filePath[25], returnStruct.filePath[26], returnStruct.filePath[27], returnStruct.filePath[28], returnStruct.filePath[29], returnStruct.filePath[30], returnStruct.filePath[31], returnStruct.filePath[32], returnStruct.filePath[33], returnStruct.filePath[34], returnStruct.filePath[35], returnStruct.filePath[36], returnStruct.filePath[37], returnStruct.filePath[38], returnStruct.filePath[39], returnStruct.filePath[40], returnStruct.filePath[41], returnStruct.filePath[42], returnStruct.filePath[43], returnStruct.filePath[44], returnStruct.filePath[45], returnStruct.filePath[46], returnStruct.filePath[47], returnStruct.filePath[48], returnStruct.filePath[49], returnStruct.filePath[50], returnStruct.filePath[51], returnStruct.filePath[52], returnStruct.filePath[53], returnStruct.filePath[54], returnStruct.filePath[55], returnStruct.filePath[56], returnStruct.filePath[57], returnStruct.filePath[58], returnStruct.filePath[59], returnStruct.filePath[60], returnStruct.filePath[61], returnStruct.filePath[62], returnStruct.filePath[63], returnStruct.filePath[64], returnStruct.filePath[65], returnStruct.filePath[66], returnStruct.filePath[67], returnStruct.filePath[68], returnStruct.filePath[69], returnStruct.filePath[70], returnStruct.filePath[71], returnStruct.filePath[72], returnStruct.filePath[73], returnStruct.filePath[74], returnStruct.filePath[75], returnStruct.filePath[76], returnStruct.filePath[77], returnStruct.filePath[78], returnStruct.filePath[79], returnStruct.filePath[80], returnStruct.filePath[81], returnStruct.filePath[82], returnStruct.filePath[83], returnStruct.filePath[84], returnStruct.filePath[85], returnStruct.filePath[86], returnStruct.filePath[87], returnStruct.filePath[88], returnStruct.filePath[89], returnStruct.filePath[90], returnStruct.filePath[91], returnStruct.filePath[92], returnStruct.filePath[93], returnStruct.filePath[94], returnStruct.filePath[95], returnStruct.filePath[96], returnStruct.filePath[97], returnStruct.filePath[98], returnStruct.filePath[99], returnStruct.filePath[100], returnStruct.filePath[101], returnStruct.filePath[102], returnStruct.filePath[103], returnStruct.filePath[104], returnStruct.filePath[105], returnStruct.filePath[106], returnStruct.filePath[107], returnStruct.filePath[108], returnStruct.filePath[109], returnStruct.filePath[110], returnStruct.filePath[111], returnStruct.filePath[112], returnStruct.filePath[113], returnStruct.filePath[114], returnStruct.filePath[115], returnStruct.filePath[116], returnStruct.filePath[117], returnStruct.filePath[118], returnStruct.filePath[119], returnStruct.filePath[120], returnStruct.filePath[121], returnStruct.filePath[122], returnStruct.filePath[123], returnStruct.filePath[124], returnStruct.filePath[125], returnStruct.filePath[126], returnStruct.filePath[127] = unpack(endian+"iBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",inBuff[inPtr:inPtr+132])
+    returnStruct.captureFileType, returnStruct.filePath[0], returnStruct.filePath[1], returnStruct.filePath[2], returnStruct.filePath[3], returnStruct.filePath[4], returnStruct.filePath[5], returnStruct.filePath[6], returnStruct.filePath[7], returnStruct.filePath[8], returnStruct.filePath[9], returnStruct.filePath[10], returnStruct.filePath[11], returnStruct.filePath[12], returnStruct.filePath[13], returnStruct.filePath[14], returnStruct.filePath[15], returnStruct.filePath[16], returnStruct.filePath[17], returnStruct.filePath[18], returnStruct.filePath[19], returnStruct.filePath[20], returnStruct.filePath[21], returnStruct.filePath[22], returnStruct.filePath[23], returnStruct.filePath[24], returnStruct.filePath[25], returnStruct.filePath[26], returnStruct.filePath[27], returnStruct.filePath[28], returnStruct.filePath[29], returnStruct.filePath[30], returnStruct.filePath[31], returnStruct.filePath[32], returnStruct.filePath[33], returnStruct.filePath[34], returnStruct.filePath[35], returnStruct.filePath[36], returnStruct.filePath[37], returnStruct.filePath[38], returnStruct.filePath[39], returnStruct.filePath[40], returnStruct.filePath[41], returnStruct.filePath[42], returnStruct.filePath[43], returnStruct.filePath[44], returnStruct.filePath[45], returnStruct.filePath[46], returnStruct.filePath[47], returnStruct.filePath[48], returnStruct.filePath[49], returnStruct.filePath[50], returnStruct.filePath[51], returnStruct.filePath[52], returnStruct.filePath[53], returnStruct.filePath[54], returnStruct.filePath[55], returnStruct.filePath[56], returnStruct.filePath[57], returnStruct.filePath[58], returnStruct.filePath[59], returnStruct.filePath[60], returnStruct.filePath[61], returnStruct.filePath[62], returnStruct.filePath[63], returnStruct.filePath[64], returnStruct.filePath[65], returnStruct.filePath[66], returnStruct.filePath[67], returnStruct.filePath[68], returnStruct.filePath[69], returnStruct.filePath[70], returnStruct.filePath[71], returnStruct.filePath[72], returnStruct.filePath[73], returnStruct.filePath[74], returnStruct.filePath[75], returnStruct.filePath[76], returnStruct.filePath[77], returnStruct.filePath[78], returnStruct.filePath[79], returnStruct.filePath[80], returnStruct.filePath[81], returnStruct.filePath[82], returnStruct.filePath[83], returnStruct.filePath[84], returnStruct.filePath[85], returnStruct.filePath[86], returnStruct.filePath[87], returnStruct.filePath[88], returnStruct.filePath[89], returnStruct.filePath[90], returnStruct.filePath[91], returnStruct.filePath[92], returnStruct.filePath[93], returnStruct.filePath[94], returnStruct.filePath[95], returnStruct.filePath[96], returnStruct.filePath[97], returnStruct.filePath[98], returnStruct.filePath[99], returnStruct.filePath[100], returnStruct.filePath[101], returnStruct.filePath[102], returnStruct.filePath[103], returnStruct.filePath[104], returnStruct.filePath[105], returnStruct.filePath[106], returnStruct.filePath[107], returnStruct.filePath[108], returnStruct.filePath[109], returnStruct.filePath[110], returnStruct.filePath[111], returnStruct.filePath[112], returnStruct.filePath[113], returnStruct.filePath[114], returnStruct.filePath[115], returnStruct.filePath[116], returnStruct.filePath[117], returnStruct.filePath[118], returnStruct.filePath[119], returnStruct.filePath[120], returnStruct.filePath[121], returnStruct.filePath[122], returnStruct.filePath[123], returnStruct.filePath[124], returnStruct.filePath[125], returnStruct.filePath[126], returnStruct.filePath[127] = (FLR_CAPTURE_FILE_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"iBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_CAPTURE_FILE_SETTINGS_T()
 
 def FLR_CAPTURE_FILE_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">iBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",outBuff,outPtr,inVal.captureFileType, inVal.filePath[0], inVal.filePath[1], inVal.filePath[2], inVal.filePath[3], inVal.filePath[4], inVal.filePath[5], inVal.filePath[6], inVal.filePath[7], inVal.filePath[8], inVal.filePath[9], inVal.filePath[10], inVal.filePath[11], inVal.filePath[12], inVal.filePath[13], inVal.filePath[14], inVal.filePath[15], inVal.filePath[16], inVal.filePath[17], inVal.filePath[18], inVal.filePath[19], inVal.filePath[20], inVal.filePath[21], inVal.filePath[22], inVal.filePath[23], inVal.filePath[24], inVal.filePath[25], inVal.filePath[26], inVal.filePath[27], inVal.filePath[28], inVal.filePath[29], inVal.filePath[30], inVal.filePath[31], inVal.filePath[32], inVal.filePath[33], inVal.filePath[34], inVal.filePath[35], inVal.filePath[36], inVal.filePath[37], inVal.filePath[38], inVal.filePath[39], inVal.filePath[40], inVal.filePath[41], inVal.filePath[42], inVal.filePath[43], inVal.filePath[44], inVal.filePath[45], inVal.filePath[46], inVal.filePath[47], inVal.filePath[48], inVal.filePath[49], inVal.filePath[50], inVal.filePath[51], inVal.filePath[52], inVal.filePath[53], inVal.filePath[54], inVal.filePath[55], inVal.filePath[56], inVal.filePath[57], inVal.filePath[58], inVal.filePath[59], inVal.filePath[60], inVal.filePath[61], inVal.filePath[62], inVal.filePath[63], inVal.filePath[64], inVal.filePath[65], inVal.filePath[66], inVal.filePath[67], inVal.filePath[68], inVal.filePath[69], inVal.filePath[70], inVal.filePath[71], inVal.filePath[72], inVal.filePath[73], inVal.filePath[74], inVal.filePath[75], inVal.filePath[76], inVal.filePath[77], inVal.filePath[78], inVal.filePath[79], inVal.filePath[80], inVal.filePath[81], inVal.filePath[82], inVal.filePath[83], inVal.filePath[84], inVal.filePath[85], inVal.filePath[86], inVal.filePath[87], inVal.filePath[88], inVal.filePath[89], inVal.filePath[90], inVal.filePath[91], inVal.filePath[92], inVal.filePath[93], inVal.filePath[94], inVal.filePath[95], inVal.filePath[96], inVal.filePath[97], inVal.filePath[98], inVal.filePath[99], inVal.filePath[100], inVal.filePath[101], inVal.filePath[102], inVal.filePath[103], inVal.filePath[104], inVal.filePath[105], inVal.filePath[106], inVal.filePath[107], inVal.filePath[108], inVal.filePath[109], inVal.filePath[110], inVal.filePath[111], inVal.filePath[112], inVal.filePath[113], inVal.filePath[114], inVal.filePath[115], inVal.filePath[116], inVal.filePath[117], inVal.filePath[118], inVal.filePath[119], inVal.filePath[120], inVal.filePath[121], inVal.filePath[122], inVal.filePath[123], inVal.filePath[124], inVal.filePath[125], inVal.filePath[126], inVal.filePath[127])
+    FLR_CAPTURE_FILE_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.captureFileType, inVal.filePath[0], inVal.filePath[1], inVal.filePath[2], inVal.filePath[3], inVal.filePath[4], inVal.filePath[5], inVal.filePath[6], inVal.filePath[7], inVal.filePath[8], inVal.filePath[9], inVal.filePath[10], inVal.filePath[11], inVal.filePath[12], inVal.filePath[13], inVal.filePath[14], inVal.filePath[15], inVal.filePath[16], inVal.filePath[17], inVal.filePath[18], inVal.filePath[19], inVal.filePath[20], inVal.filePath[21], inVal.filePath[22], inVal.filePath[23], inVal.filePath[24], inVal.filePath[25], inVal.filePath[26], inVal.filePath[27], inVal.filePath[28], inVal.filePath[29], inVal.filePath[30], inVal.filePath[31], inVal.filePath[32], inVal.filePath[33], inVal.filePath[34], inVal.filePath[35], inVal.filePath[36], inVal.filePath[37], inVal.filePath[38], inVal.filePath[39], inVal.filePath[40], inVal.filePath[41], inVal.filePath[42], inVal.filePath[43], inVal.filePath[44], inVal.filePath[45], inVal.filePath[46], inVal.filePath[47], inVal.filePath[48], inVal.filePath[49], inVal.filePath[50], inVal.filePath[51], inVal.filePath[52], inVal.filePath[53], inVal.filePath[54], inVal.filePath[55], inVal.filePath[56], inVal.filePath[57], inVal.filePath[58], inVal.filePath[59], inVal.filePath[60], inVal.filePath[61], inVal.filePath[62], inVal.filePath[63], inVal.filePath[64], inVal.filePath[65], inVal.filePath[66], inVal.filePath[67], inVal.filePath[68], inVal.filePath[69], inVal.filePath[70], inVal.filePath[71], inVal.filePath[72], inVal.filePath[73], inVal.filePath[74], inVal.filePath[75], inVal.filePath[76], inVal.filePath[77], inVal.filePath[78], inVal.filePath[79], inVal.filePath[80], inVal.filePath[81], inVal.filePath[82], inVal.filePath[83], inVal.filePath[84], inVal.filePath[85], inVal.filePath[86], inVal.filePath[87], inVal.filePath[88], inVal.filePath[89], inVal.filePath[90], inVal.filePath[91], inVal.filePath[92], inVal.filePath[93], inVal.filePath[94], inVal.filePath[95], inVal.filePath[96], inVal.filePath[97], inVal.filePath[98], inVal.filePath[99], inVal.filePath[100], inVal.filePath[101], inVal.filePath[102], inVal.filePath[103], inVal.filePath[104], inVal.filePath[105], inVal.filePath[106], inVal.filePath[107], inVal.filePath[108], inVal.filePath[109], inVal.filePath[110], inVal.filePath[111], inVal.filePath[112], inVal.filePath[113], inVal.filePath[114], inVal.filePath[115], inVal.filePath[116], inVal.filePath[117], inVal.filePath[118], inVal.filePath[119], inVal.filePath[120], inVal.filePath[121], inVal.filePath[122], inVal.filePath[123], inVal.filePath[124], inVal.filePath[125], inVal.filePath[126], inVal.filePath[127])
 # end of FLR_CAPTURE_FILE_SETTINGS_TToByte()
 
 class FLR_CAPTURE_SETTINGS_T():
@@ -208,14 +222,16 @@ class FLR_CAPTURE_SETTINGS_T():
     
 # end of FLR_CAPTURE_SETTINGS_T()
 
+FLR_CAPTURE_SETTINGS_T_CODEC = Struct(">iIH")
+
 def byteToFLR_CAPTURE_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_CAPTURE_SETTINGS_T()
-    returnStruct.dataSrc, returnStruct.numFrames, returnStruct.bufferIndex = unpack(endian+"iIH",inBuff[inPtr:inPtr+10])
+    returnStruct.dataSrc, returnStruct.numFrames, returnStruct.bufferIndex = (FLR_CAPTURE_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"iIH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_CAPTURE_SETTINGS_T()
 
 def FLR_CAPTURE_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">iIH",outBuff,outPtr,inVal.dataSrc, inVal.numFrames, inVal.bufferIndex)
+    FLR_CAPTURE_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.dataSrc, inVal.numFrames, inVal.bufferIndex)
 # end of FLR_CAPTURE_SETTINGS_TToByte()
 
 class FLR_CAPTURE_STATUS_T():
@@ -238,14 +254,16 @@ class FLR_CAPTURE_STATUS_T():
     
 # end of FLR_CAPTURE_STATUS_T()
 
+FLR_CAPTURE_STATUS_T_CODEC = Struct(">iIIIII")
+
 def byteToFLR_CAPTURE_STATUS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_CAPTURE_STATUS_T()
-    returnStruct.state, returnStruct.result, returnStruct.capturedFrames, returnStruct.missedFrames, returnStruct.savedFrames, returnStruct.unsyncFrames = unpack(endian+"iIIIII",inBuff[inPtr:inPtr+24])
+    returnStruct.state, returnStruct.result, returnStruct.capturedFrames, returnStruct.missedFrames, returnStruct.savedFrames, returnStruct.unsyncFrames = (FLR_CAPTURE_STATUS_T_CODEC if endian == ">" else Struct(endian+"iIIIII")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_CAPTURE_STATUS_T()
 
 def FLR_CAPTURE_STATUS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">iIIIII",outBuff,outPtr,inVal.state, inVal.result, inVal.capturedFrames, inVal.missedFrames, inVal.savedFrames, inVal.unsyncFrames)
+    FLR_CAPTURE_STATUS_T_CODEC.pack_into(outBuff,outPtr,inVal.state, inVal.result, inVal.capturedFrames, inVal.missedFrames, inVal.savedFrames, inVal.unsyncFrames)
 # end of FLR_CAPTURE_STATUS_TToByte()
 
 class FLR_DVO_LCD_CONFIG_T():
@@ -274,14 +292,16 @@ class FLR_DVO_LCD_CONFIG_T():
     
 # end of FLR_DVO_LCD_CONFIG_T()
 
+FLR_DVO_LCD_CONFIG_T_CODEC = Struct(">IIIIIIIIIIII")
+
 def byteToFLR_DVO_LCD_CONFIG_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_DVO_LCD_CONFIG_T()
-    returnStruct.width, returnStruct.hPulseWidth, returnStruct.hBackP, returnStruct.hFrontP, returnStruct.height, returnStruct.vPulseWidth, returnStruct.vBackP, returnStruct.vFrontP, returnStruct.outputFormat, returnStruct.control, returnStruct.rotation, returnStruct.pixelClockkHz = unpack(endian+"IIIIIIIIIIII",inBuff[inPtr:inPtr+48])
+    returnStruct.width, returnStruct.hPulseWidth, returnStruct.hBackP, returnStruct.hFrontP, returnStruct.height, returnStruct.vPulseWidth, returnStruct.vBackP, returnStruct.vFrontP, returnStruct.outputFormat, returnStruct.control, returnStruct.rotation, returnStruct.pixelClockkHz = (FLR_DVO_LCD_CONFIG_T_CODEC if endian == ">" else Struct(endian+"IIIIIIIIIIII")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_DVO_LCD_CONFIG_T()
 
 def FLR_DVO_LCD_CONFIG_TToByte(inVal, outBuff, outPtr):
-    pack_into(">IIIIIIIIIIII",outBuff,outPtr,inVal.width, inVal.hPulseWidth, inVal.hBackP, inVal.hFrontP, inVal.height, inVal.vPulseWidth, inVal.vBackP, inVal.vFrontP, inVal.outputFormat, inVal.control, inVal.rotation, inVal.pixelClockkHz)
+    FLR_DVO_LCD_CONFIG_T_CODEC.pack_into(outBuff,outPtr,inVal.width, inVal.hPulseWidth, inVal.hBackP, inVal.hFrontP, inVal.height, inVal.vPulseWidth, inVal.vBackP, inVal.vFrontP, inVal.outputFormat, inVal.control, inVal.rotation, inVal.pixelClockkHz)
 # end of FLR_DVO_LCD_CONFIG_TToByte()
 
 class FLR_DVO_RGB_SETTINGS_T():
@@ -300,14 +320,16 @@ class FLR_DVO_RGB_SETTINGS_T():
     
 # end of FLR_DVO_RGB_SETTINGS_T()
 
+FLR_DVO_RGB_SETTINGS_T_CODEC = Struct(">ii")
+
 def byteToFLR_DVO_RGB_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_DVO_RGB_SETTINGS_T()
-    returnStruct.rgbFormat, returnStruct.rgbOrder = unpack(endian+"ii",inBuff[inPtr:inPtr+8])
+    returnStruct.rgbFormat, returnStruct.rgbOrder = (FLR_DVO_RGB_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"ii")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_DVO_RGB_SETTINGS_T()
 
 def FLR_DVO_RGB_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">ii",outBuff,outPtr,inVal.rgbFormat, inVal.rgbOrder)
+    FLR_DVO_RGB_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.rgbFormat, inVal.rgbOrder)
 # end of FLR_DVO_RGB_SETTINGS_TToByte()
 
 class FLR_DVO_YCBCR_SETTINGS_T():
@@ -327,14 +349,16 @@ class FLR_DVO_YCBCR_SETTINGS_T():
     
 # end of FLR_DVO_YCBCR_SETTINGS_T()
 
+FLR_DVO_YCBCR_SETTINGS_T_CODEC = Struct(">iii")
+
 def byteToFLR_DVO_YCBCR_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_DVO_YCBCR_SETTINGS_T()
-    returnStruct.ycbcrFormat, returnStruct.cbcrOrder, returnStruct.yOrder = unpack(endian+"iii",inBuff[inPtr:inPtr+12])
+    returnStruct.ycbcrFormat, returnStruct.cbcrOrder, returnStruct.yOrder = (FLR_DVO_YCBCR_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"iii")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_DVO_YCBCR_SETTINGS_T()
 
 def FLR_DVO_YCBCR_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">iii",outBuff,outPtr,inVal.ycbcrFormat, inVal.cbcrOrder, inVal.yOrder)
+    FLR_DVO_YCBCR_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.ycbcrFormat, inVal.cbcrOrder, inVal.yOrder)
 # end of FLR_DVO_YCBCR_SETTINGS_TToByte()
 
 class FLR_GAO_RNS_COL_CORRECT_T():
@@ -352,14 +376,16 @@ class FLR_GAO_RNS_COL_CORRECT_T():
     
 # end of FLR_GAO_RNS_COL_CORRECT_T()
 
+FLR_GAO_RNS_COL_CORRECT_T_CODEC = Struct(">hhhhhhhhhhhhhhhhhhhh")
+
 def byteToFLR_GAO_RNS_COL_CORRECT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_GAO_RNS_COL_CORRECT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16], returnStruct.value[17], returnStruct.value[18], returnStruct.value[19] = unpack(endian+"hhhhhhhhhhhhhhhhhhhh",inBuff[inPtr:inPtr+40])
+    returnStruct.value[:] = (FLR_GAO_RNS_COL_CORRECT_T_CODEC if endian == ">" else Struct(endian+"hhhhhhhhhhhhhhhhhhhh")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_GAO_RNS_COL_CORRECT_T()
 
 def FLR_GAO_RNS_COL_CORRECT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">hhhhhhhhhhhhhhhhhhhh",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19])
+    FLR_GAO_RNS_COL_CORRECT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19])
 # end of FLR_GAO_RNS_COL_CORRECT_TToByte()
 
 class FLR_ISOTHERM_COLORS_T():
@@ -380,14 +406,16 @@ class FLR_ISOTHERM_COLORS_T():
     
 # end of FLR_ISOTHERM_COLORS_T()
 
+FLR_ISOTHERM_COLORS_T_CODEC = Struct(">HHHHHHHHHH")
+
 def byteToFLR_ISOTHERM_COLORS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_ISOTHERM_COLORS_T()
-    returnStruct.range1.r, returnStruct.range1.g, returnStruct.range1.b, returnStruct.range2.r, returnStruct.range2.g, returnStruct.range2.b, returnStruct.range3.r, returnStruct.range3.g, returnStruct.range3.b, returnStruct.num = unpack(endian+"HHHHHHHHHH",inBuff[inPtr:inPtr+20])
+    returnStruct.range1.r, returnStruct.range1.g, returnStruct.range1.b, returnStruct.range2.r, returnStruct.range2.g, returnStruct.range2.b, returnStruct.range3.r, returnStruct.range3.g, returnStruct.range3.b, returnStruct.num = (FLR_ISOTHERM_COLORS_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_ISOTHERM_COLORS_T()
 
 def FLR_ISOTHERM_COLORS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHH",outBuff,outPtr,inVal.range1.r, inVal.range1.g, inVal.range1.b, inVal.range2.r, inVal.range2.g, inVal.range2.b, inVal.range3.r, inVal.range3.g, inVal.range3.b, inVal.num)
+    FLR_ISOTHERM_COLORS_T_CODEC.pack_into(outBuff,outPtr,inVal.range1.r, inVal.range1.g, inVal.range1.b, inVal.range2.r, inVal.range2.g, inVal.range2.b, inVal.range3.r, inVal.range3.g, inVal.range3.b, inVal.num)
 # end of FLR_ISOTHERM_COLORS_TToByte()
 
 class FLR_ISOTHERM_COLOR_T():
@@ -407,14 +435,16 @@ class FLR_ISOTHERM_COLOR_T():
     
 # end of FLR_ISOTHERM_COLOR_T()
 
+FLR_ISOTHERM_COLOR_T_CODEC = Struct(">HHH")
+
 def byteToFLR_ISOTHERM_COLOR_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_ISOTHERM_COLOR_T()
-    returnStruct.r, returnStruct.g, returnStruct.b = unpack(endian+"HHH",inBuff[inPtr:inPtr+6])
+    returnStruct.r, returnStruct.g, returnStruct.b = (FLR_ISOTHERM_COLOR_T_CODEC if endian == ">" else Struct(endian+"HHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_ISOTHERM_COLOR_T()
 
 def FLR_ISOTHERM_COLOR_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHH",outBuff,outPtr,inVal.r, inVal.g, inVal.b)
+    FLR_ISOTHERM_COLOR_T_CODEC.pack_into(outBuff,outPtr,inVal.r, inVal.g, inVal.b)
 # end of FLR_ISOTHERM_COLOR_TToByte()
 
 class FLR_ISOTHERM_SETTINGS_T():
@@ -466,14 +496,16 @@ class FLR_ISOTHERM_SETTINGS_T():
     
 # end of FLR_ISOTHERM_SETTINGS_T()
 
+FLR_ISOTHERM_SETTINGS_T_CODEC = Struct(">iiiiiHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHiiiiii")
+
 def byteToFLR_ISOTHERM_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_ISOTHERM_SETTINGS_T()
-    returnStruct.thIsoT1, returnStruct.thIsoT2, returnStruct.thIsoT3, returnStruct.thIsoT4, returnStruct.thIsoT5, returnStruct.color0.range1.r, returnStruct.color0.range1.g, returnStruct.color0.range1.b, returnStruct.color0.range2.r, returnStruct.color0.range2.g, returnStruct.color0.range2.b, returnStruct.color0.range3.r, returnStruct.color0.range3.g, returnStruct.color0.range3.b, returnStruct.color0.num, returnStruct.color1.range1.r, returnStruct.color1.range1.g, returnStruct.color1.range1.b, returnStruct.color1.range2.r, returnStruct.color1.range2.g, returnStruct.color1.range2.b, returnStruct.color1.range3.r, returnStruct.color1.range3.g, returnStruct.color1.range3.b, returnStruct.color1.num, returnStruct.color2.range1.r, returnStruct.color2.range1.g, returnStruct.color2.range1.b, returnStruct.color2.range2.r, returnStruct.color2.range2.g, returnStruct.color2.range2.b, returnStruct.color2.range3.r, returnStruct.color2.range3.g, returnStruct.color2.range3.b, returnStruct.color2.num, returnStruct.color3.range1.r, returnStruct.color3.range1.g, returnStruct.color3.range1.b, returnStruct.color3.range2.r, returnStruct.color3.range2.g, returnStruct.color3.range2.b, returnStruct.color3.range3.r, returnStruct.color3.range3.g, returnStruct.color3.range3.b, returnStruct.color3.num, returnStruct.color4.range1.r, returnStruct.color4.range1.g, returnStruct.color4.range1.b, returnStruct.color4.range2.r, returnStruct.color4.range2.g, returnStruct.color4.range2.b, returnStruct.color4.range3.r, returnStruct.color4.range3.g, returnStruct.color4.range3.b, returnStruct.color4.num, returnStruct.color5.range1.r, returnStruct.color5.range1.g, returnStruct.color5.range1.b, returnStruct.color5.range2.r, returnStruct.color5.range2.g, returnStruct.color5.range2.b, returnStruct.color5.range3.r, returnStruct.color5.range3.g, returnStruct.color5.range3.b, returnStruct.color5.num, returnStruct.region0, returnStruct.region1, returnStruct.region2, returnStruct.region3, returnStruct.region4, returnStruct.region5 = unpack(endian+"iiiiiHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHiiiiii",inBuff[inPtr:inPtr+164])
+    returnStruct.thIsoT1, returnStruct.thIsoT2, returnStruct.thIsoT3, returnStruct.thIsoT4, returnStruct.thIsoT5, returnStruct.color0.range1.r, returnStruct.color0.range1.g, returnStruct.color0.range1.b, returnStruct.color0.range2.r, returnStruct.color0.range2.g, returnStruct.color0.range2.b, returnStruct.color0.range3.r, returnStruct.color0.range3.g, returnStruct.color0.range3.b, returnStruct.color0.num, returnStruct.color1.range1.r, returnStruct.color1.range1.g, returnStruct.color1.range1.b, returnStruct.color1.range2.r, returnStruct.color1.range2.g, returnStruct.color1.range2.b, returnStruct.color1.range3.r, returnStruct.color1.range3.g, returnStruct.color1.range3.b, returnStruct.color1.num, returnStruct.color2.range1.r, returnStruct.color2.range1.g, returnStruct.color2.range1.b, returnStruct.color2.range2.r, returnStruct.color2.range2.g, returnStruct.color2.range2.b, returnStruct.color2.range3.r, returnStruct.color2.range3.g, returnStruct.color2.range3.b, returnStruct.color2.num, returnStruct.color3.range1.r, returnStruct.color3.range1.g, returnStruct.color3.range1.b, returnStruct.color3.range2.r, returnStruct.color3.range2.g, returnStruct.color3.range2.b, returnStruct.color3.range3.r, returnStruct.color3.range3.g, returnStruct.color3.range3.b, returnStruct.color3.num, returnStruct.color4.range1.r, returnStruct.color4.range1.g, returnStruct.color4.range1.b, returnStruct.color4.range2.r, returnStruct.color4.range2.g, returnStruct.color4.range2.b, returnStruct.color4.range3.r, returnStruct.color4.range3.g, returnStruct.color4.range3.b, returnStruct.color4.num, returnStruct.color5.range1.r, returnStruct.color5.range1.g, returnStruct.color5.range1.b, returnStruct.color5.range2.r, returnStruct.color5.range2.g, returnStruct.color5.range2.b, returnStruct.color5.range3.r, returnStruct.color5.range3.g, returnStruct.color5.range3.b, returnStruct.color5.num, returnStruct.region0, returnStruct.region1, returnStruct.region2, returnStruct.region3, returnStruct.region4, returnStruct.region5 = (FLR_ISOTHERM_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"iiiiiHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHiiiiii")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_ISOTHERM_SETTINGS_T()
 
 def FLR_ISOTHERM_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">iiiiiHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHHiiiiii",outBuff,outPtr,inVal.thIsoT1, inVal.thIsoT2, inVal.thIsoT3, inVal.thIsoT4, inVal.thIsoT5, inVal.color0.range1.r, inVal.color0.range1.g, inVal.color0.range1.b, inVal.color0.range2.r, inVal.color0.range2.g, inVal.color0.range2.b, inVal.color0.range3.r, inVal.color0.range3.g, inVal.color0.range3.b, inVal.color0.num, inVal.color1.range1.r, inVal.color1.range1.g, inVal.color1.range1.b, inVal.color1.range2.r, inVal.color1.range2.g, inVal.color1.range2.b, inVal.color1.range3.r, inVal.color1.range3.g, inVal.color1.range3.b, inVal.color1.num, inVal.color2.range1.r, inVal.color2.range1.g, inVal.color2.range1.b, inVal.color2.range2.r, inVal.color2.range2.g, inVal.color2.range2.b, inVal.color2.range3.r, inVal.color2.range3.g, inVal.color2.range3.b, inVal.color2.num, inVal.color3.range1.r, inVal.color3.range1.g, inVal.color3.range1.b, inVal.color3.range2.r, inVal.color3.range2.g, inVal.color3.range2.b, inVal.color3.range3.r, inVal.color3.range3.g, inVal.color3.range3.b, inVal.color3.num, inVal.color4.range1.r, inVal.color4.range1.g, inVal.color4.range1.b, inVal.color4.range2.r, inVal.color4.range2.g, inVal.color4.range2.b, inVal.color4.range3.r, inVal.color4.range3.g, inVal.color4.range3.b, inVal.color4.num, inVal.color5.range1.r, inVal.color5.range1.g, inVal.color5.range1.b, inVal.color5.range2.r, inVal.color5.range2.g, inVal.color5.range2.b, inVal.color5.range3.r, inVal.color5.range3.g, inVal.color5.range3.b, inVal.color5.num, inVal.region0, inVal.region1, inVal.region2, inVal.region3, inVal.region4, inVal.region5)
+    FLR_ISOTHERM_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.thIsoT1, inVal.thIsoT2, inVal.thIsoT3, inVal.thIsoT4, inVal.thIsoT5, inVal.color0.range1.r, inVal.color0.range1.g, inVal.color0.range1.b, inVal.color0.range2.r, inVal.color0.range2.g, inVal.color0.range2.b, inVal.color0.range3.r, inVal.color0.range3.g, inVal.color0.range3.b, inVal.color0.num, inVal.color1.range1.r, inVal.color1.range1.g, inVal.color1.range1.b, inVal.color1.range2.r, inVal.color1.range2.g, inVal.color1.range2.b, inVal.color1.range3.r, inVal.color1.range3.g, inVal.color1.range3.b, inVal.color1.num, inVal.color2.range1.r, inVal.color2.range1.g, inVal.color2.range1.b, inVal.color2.range2.r, inVal.color2.range2.g, inVal.color2.range2.b, inVal.color2.range3.r, inVal.color2.range3.g, inVal.color2.range3.b, inVal.color2.num, inVal.color3.range1.r, inVal.color3.range1.g, inVal.color3.range1.b, inVal.color3.range2.r, inVal.color3.range2.g, inVal.color3.range2.b, inVal.color3.range3.r, inVal.color3.range3.g, inVal.color3.range3.b, inVal.color3.num, inVal.color4.range1.r, inVal.color4.range1.g, inVal.color4.range1.b, inVal.color4.range2.r, inVal.color4.range2.g, inVal.color4.range2.b, inVal.color4.range3.r, inVal.color4.range3.g, inVal.color4.range3.b, inVal.color4.num, inVal.color5.range1.r, inVal.color5.range1.g, inVal.color5.range1.b, inVal.color5.range2.r, inVal.color5.range2.g, inVal.color5.range2.b, inVal.color5.range3.r, inVal.color5.range3.g, inVal.color5.range3.b, inVal.color5.num, inVal.region0, inVal.region1, inVal.region2, inVal.region3, inVal.region4, inVal.region5)
 # end of FLR_ISOTHERM_SETTINGS_TToByte()
 
 class FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T():
@@ -492,14 +524,16 @@ class FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T():
     
 # end of FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T()
 
+FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHHH")
+
 def byteToFLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T()
-    returnStruct.lut.value[0], returnStruct.lut.value[1], returnStruct.lut.value[2], returnStruct.lut.value[3], returnStruct.lut.value[4], returnStruct.lut.value[5], returnStruct.lut.value[6], returnStruct.lut.value[7], returnStruct.lut.value[8], returnStruct.lut.value[9], returnStruct.lut.value[10], returnStruct.lut.value[11], returnStruct.lut.value[12], returnStruct.lut.value[13], returnStruct.lut.value[14], returnStruct.lut.value[15], returnStruct.lut.value[16], returnStruct.tableIndex = unpack(endian+"HHHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+36])
+    returnStruct.lut.value[0], returnStruct.lut.value[1], returnStruct.lut.value[2], returnStruct.lut.value[3], returnStruct.lut.value[4], returnStruct.lut.value[5], returnStruct.lut.value[6], returnStruct.lut.value[7], returnStruct.lut.value[8], returnStruct.lut.value[9], returnStruct.lut.value[10], returnStruct.lut.value[11], returnStruct.lut.value[12], returnStruct.lut.value[13], returnStruct.lut.value[14], returnStruct.lut.value[15], returnStruct.lut.value[16], returnStruct.tableIndex = (FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T()
 
 def FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.lut.value[0], inVal.lut.value[1], inVal.lut.value[2], inVal.lut.value[3], inVal.lut.value[4], inVal.lut.value[5], inVal.lut.value[6], inVal.lut.value[7], inVal.lut.value[8], inVal.lut.value[9], inVal.lut.value[10], inVal.lut.value[11], inVal.lut.value[12], inVal.lut.value[13], inVal.lut.value[14], inVal.lut.value[15], inVal.lut.value[16], inVal.tableIndex)
+    FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.lut.value[0], inVal.lut.value[1], inVal.lut.value[2], inVal.lut.value[3], inVal.lut.value[4], inVal.lut.value[5], inVal.lut.value[6], inVal.lut.value[7], inVal.lut.value[8], inVal.lut.value[9], inVal.lut.value[10], inVal.lut.value[11], inVal.lut.value[12], inVal.lut.value[13], inVal.lut.value[14], inVal.lut.value[15], inVal.lut.value[16], inVal.tableIndex)
 # end of FLR_RADIOMETRY_NOISE_COMP_FACTOR_HEADER_LUT_TToByte()
 
 class FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T():
@@ -517,14 +551,16 @@ class FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T():
     
 # end of FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T()
 
+FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHH")
+
 def byteToFLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16] = unpack(endian+"HHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+34])
+    returnStruct.value[:] = (FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T()
 
 def FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
+    FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
 # end of FLR_RADIOMETRY_NOISE_COMP_FACTOR_LUT_TToByte()
 
 class FLR_RADIOMETRY_RBFO_PARAMS_T():
@@ -545,14 +581,16 @@ class FLR_RADIOMETRY_RBFO_PARAMS_T():
     
 # end of FLR_RADIOMETRY_RBFO_PARAMS_T()
 
+FLR_RADIOMETRY_RBFO_PARAMS_T_CODEC = Struct(">ffff")
+
 def byteToFLR_RADIOMETRY_RBFO_PARAMS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_RADIOMETRY_RBFO_PARAMS_T()
-    returnStruct.RBFO_R, returnStruct.RBFO_B, returnStruct.RBFO_F, returnStruct.RBFO_O = unpack(endian+"ffff",inBuff[inPtr:inPtr+16])
+    returnStruct.RBFO_R, returnStruct.RBFO_B, returnStruct.RBFO_F, returnStruct.RBFO_O = (FLR_RADIOMETRY_RBFO_PARAMS_T_CODEC if endian == ">" else Struct(endian+"ffff")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_RADIOMETRY_RBFO_PARAMS_T()
 
 def FLR_RADIOMETRY_RBFO_PARAMS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">ffff",outBuff,outPtr,inVal.RBFO_R, inVal.RBFO_B, inVal.RBFO_F, inVal.RBFO_O)
+    FLR_RADIOMETRY_RBFO_PARAMS_T_CODEC.pack_into(outBuff,outPtr,inVal.RBFO_R, inVal.RBFO_B, inVal.RBFO_F, inVal.RBFO_O)
 # end of FLR_RADIOMETRY_RBFO_PARAMS_TToByte()
 
 class FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T():
@@ -571,14 +609,16 @@ class FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T():
     
 # end of FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T()
 
+FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHHH")
+
 def byteToFLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T()
-    returnStruct.lut.value[0], returnStruct.lut.value[1], returnStruct.lut.value[2], returnStruct.lut.value[3], returnStruct.lut.value[4], returnStruct.lut.value[5], returnStruct.lut.value[6], returnStruct.lut.value[7], returnStruct.lut.value[8], returnStruct.lut.value[9], returnStruct.lut.value[10], returnStruct.lut.value[11], returnStruct.lut.value[12], returnStruct.lut.value[13], returnStruct.lut.value[14], returnStruct.lut.value[15], returnStruct.lut.value[16], returnStruct.tableIndex = unpack(endian+"HHHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+36])
+    returnStruct.lut.value[0], returnStruct.lut.value[1], returnStruct.lut.value[2], returnStruct.lut.value[3], returnStruct.lut.value[4], returnStruct.lut.value[5], returnStruct.lut.value[6], returnStruct.lut.value[7], returnStruct.lut.value[8], returnStruct.lut.value[9], returnStruct.lut.value[10], returnStruct.lut.value[11], returnStruct.lut.value[12], returnStruct.lut.value[13], returnStruct.lut.value[14], returnStruct.lut.value[15], returnStruct.lut.value[16], returnStruct.tableIndex = (FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T()
 
 def FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.lut.value[0], inVal.lut.value[1], inVal.lut.value[2], inVal.lut.value[3], inVal.lut.value[4], inVal.lut.value[5], inVal.lut.value[6], inVal.lut.value[7], inVal.lut.value[8], inVal.lut.value[9], inVal.lut.value[10], inVal.lut.value[11], inVal.lut.value[12], inVal.lut.value[13], inVal.lut.value[14], inVal.lut.value[15], inVal.lut.value[16], inVal.tableIndex)
+    FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.lut.value[0], inVal.lut.value[1], inVal.lut.value[2], inVal.lut.value[3], inVal.lut.value[4], inVal.lut.value[5], inVal.lut.value[6], inVal.lut.value[7], inVal.lut.value[8], inVal.lut.value[9], inVal.lut.value[10], inVal.lut.value[11], inVal.lut.value[12], inVal.lut.value[13], inVal.lut.value[14], inVal.lut.value[15], inVal.lut.value[16], inVal.tableIndex)
 # end of FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_HEADER_LUT_TToByte()
 
 class FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T():
@@ -596,14 +636,16 @@ class FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T():
     
 # end of FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T()
 
+FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHH")
+
 def byteToFLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16] = unpack(endian+"HHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+34])
+    returnStruct.value[:] = (FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T()
 
 def FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
+    FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
 # end of FLR_RADIOMETRY_SIGNAL_COMP_FACTOR_LUT_TToByte()
 
 class FLR_RADIOMETRY_TAUX_PARAMS_T():
@@ -624,14 +666,16 @@ class FLR_RADIOMETRY_TAUX_PARAMS_T():
     
 # end of FLR_RADIOMETRY_TAUX_PARAMS_T()
 
+FLR_RADIOMETRY_TAUX_PARAMS_T_CODEC = Struct(">ffff")
+
 def byteToFLR_RADIOMETRY_TAUX_PARAMS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_RADIOMETRY_TAUX_PARAMS_T()
-    returnStruct.A3, returnStruct.A2, returnStruct.A1, returnStruct.A0 = unpack(endian+"ffff",inBuff[inPtr:inPtr+16])
+    returnStruct.A3, returnStruct.A2, returnStruct.A1, returnStruct.A0 = (FLR_RADIOMETRY_TAUX_PARAMS_T_CODEC if endian == ">" else Struct(endian+"ffff")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_RADIOMETRY_TAUX_PARAMS_T()
 
 def FLR_RADIOMETRY_TAUX_PARAMS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">ffff",outBuff,outPtr,inVal.A3, inVal.A2, inVal.A1, inVal.A0)
+    FLR_RADIOMETRY_TAUX_PARAMS_T_CODEC.pack_into(outBuff,outPtr,inVal.A3, inVal.A2, inVal.A1, inVal.A0)
 # end of FLR_RADIOMETRY_TAUX_PARAMS_TToByte()
 
 class FLR_ROIC_FPATEMP_TABLE_T():
@@ -649,14 +693,16 @@ class FLR_ROIC_FPATEMP_TABLE_T():
     
 # end of FLR_ROIC_FPATEMP_TABLE_T()
 
+FLR_ROIC_FPATEMP_TABLE_T_CODEC = Struct(">hhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhh")
+
 def byteToFLR_ROIC_FPATEMP_TABLE_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_ROIC_FPATEMP_TABLE_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16], returnStruct.value[17], returnStruct.value[18], returnStruct.value[19], returnStruct.value[20], returnStruct.value[21], returnStruct.value[22], returnStruct.value[23], returnStruct.value[24], returnStruct.value[25], returnStruct.value[26], returnStruct.value[27], returnStruct.value[28], returnStruct.value[29], returnStruct.value[30], returnStruct.value[31] = unpack(endian+"hhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhh",inBuff[inPtr:inPtr+64])
+    returnStruct.value[:] = (FLR_ROIC_FPATEMP_TABLE_T_CODEC if endian == ">" else Struct(endian+"hhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhh")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_ROIC_FPATEMP_TABLE_T()
 
 def FLR_ROIC_FPATEMP_TABLE_TToByte(inVal, outBuff, outPtr):
-    pack_into(">hhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhh",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31])
+    FLR_ROIC_FPATEMP_TABLE_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31])
 # end of FLR_ROIC_FPATEMP_TABLE_TToByte()
 
 class FLR_ROI_T():
@@ -677,14 +723,16 @@ class FLR_ROI_T():
     
 # end of FLR_ROI_T()
 
+FLR_ROI_T_CODEC = Struct(">HHHH")
+
 def byteToFLR_ROI_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_ROI_T()
-    returnStruct.rowStart, returnStruct.rowStop, returnStruct.colStart, returnStruct.colStop = unpack(endian+"HHHH",inBuff[inPtr:inPtr+8])
+    returnStruct.rowStart, returnStruct.rowStop, returnStruct.colStart, returnStruct.colStop = (FLR_ROI_T_CODEC if endian == ">" else Struct(endian+"HHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_ROI_T()
 
 def FLR_ROI_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHH",outBuff,outPtr,inVal.rowStart, inVal.rowStop, inVal.colStart, inVal.colStop)
+    FLR_ROI_T_CODEC.pack_into(outBuff,outPtr,inVal.rowStart, inVal.rowStop, inVal.colStart, inVal.colStop)
 # end of FLR_ROI_TToByte()
 
 class FLR_SCALER_ZOOM_PARAMS_T():
@@ -704,14 +752,16 @@ class FLR_SCALER_ZOOM_PARAMS_T():
     
 # end of FLR_SCALER_ZOOM_PARAMS_T()
 
+FLR_SCALER_ZOOM_PARAMS_T_CODEC = Struct(">III")
+
 def byteToFLR_SCALER_ZOOM_PARAMS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SCALER_ZOOM_PARAMS_T()
-    returnStruct.zoom, returnStruct.xCenter, returnStruct.yCenter = unpack(endian+"III",inBuff[inPtr:inPtr+12])
+    returnStruct.zoom, returnStruct.xCenter, returnStruct.yCenter = (FLR_SCALER_ZOOM_PARAMS_T_CODEC if endian == ">" else Struct(endian+"III")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SCALER_ZOOM_PARAMS_T()
 
 def FLR_SCALER_ZOOM_PARAMS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">III",outBuff,outPtr,inVal.zoom, inVal.xCenter, inVal.yCenter)
+    FLR_SCALER_ZOOM_PARAMS_T_CODEC.pack_into(outBuff,outPtr,inVal.zoom, inVal.xCenter, inVal.yCenter)
 # end of FLR_SCALER_ZOOM_PARAMS_TToByte()
 
 class FLR_SPNR_PSD_KERNEL_T():
@@ -729,14 +779,16 @@ class FLR_SPNR_PSD_KERNEL_T():
     
 # end of FLR_SPNR_PSD_KERNEL_T()
 
+FLR_SPNR_PSD_KERNEL_T_CODEC = Struct(">ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff")
+
 def byteToFLR_SPNR_PSD_KERNEL_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SPNR_PSD_KERNEL_T()
-    returnStruct.fvalue[0], returnStruct.fvalue[1], returnStruct.fvalue[2], returnStruct.fvalue[3], returnStruct.fvalue[4], returnStruct.fvalue[5], returnStruct.fvalue[6], returnStruct.fvalue[7], returnStruct.fvalue[8], returnStruct.fvalue[9], returnStruct.fvalue[10], returnStruct.fvalue[11], returnStruct.fvalue[12], returnStruct.fvalue[13], returnStruct.fvalue[14], returnStruct.fvalue[15], returnStruct.fvalue[16], returnStruct.fvalue[17], returnStruct.fvalue[18], returnStruct.fvalue[19], returnStruct.fvalue[20], returnStruct.fvalue[21], returnStruct.fvalue[22], returnStruct.fvalue[23], returnStruct.fvalue[24], returnStruct.fvalue[25], returnStruct.fvalue[26], returnStruct.fvalue[27], returnStruct.fvalue[28], returnStruct.fvalue[29], returnStruct.fvalue[30], returnStruct.fvalue[31], returnStruct.fvalue[32], returnStruct.fvalue[33], returnStruct.fvalue[34], returnStruct.fvalue[35], returnStruct.fvalue[36], returnStruct.fvalue[37], returnStruct.fvalue[38], returnStruct.fvalue[39], returnStruct.fvalue[40], returnStruct.fvalue[41], returnStruct.fvalue[42], returnStruct.fvalue[43], returnStruct.fvalue[44], returnStruct.fvalue[45], returnStruct.fvalue[46], returnStruct.fvalue[47], returnStruct.fvalue[48], returnStruct.fvalue[49], returnStruct.fvalue[50], returnStruct.fvalue[51], returnStruct.fvalue[52], returnStruct.fvalue[53], returnStruct.fvalue[54], returnStruct.fvalue[55], returnStruct.fvalue[56], returnStruct.fvalue[57], returnStruct.fvalue[58], returnStruct.fvalue[59], returnStruct.fvalue[60], returnStruct.fvalue[61], returnStruct.fvalue[62], returnStruct.fvalue[63] = unpack(endian+"ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",inBuff[inPtr:inPtr+256])
+    returnStruct.fvalue[0], returnStruct.fvalue[1], returnStruct.fvalue[2], returnStruct.fvalue[3], returnStruct.fvalue[4], returnStruct.fvalue[5], returnStruct.fvalue[6], returnStruct.fvalue[7], returnStruct.fvalue[8], returnStruct.fvalue[9], returnStruct.fvalue[10], returnStruct.fvalue[11], returnStruct.fvalue[12], returnStruct.fvalue[13], returnStruct.fvalue[14], returnStruct.fvalue[15], returnStruct.fvalue[16], returnStruct.fvalue[17], returnStruct.fvalue[18], returnStruct.fvalue[19], returnStruct.fvalue[20], returnStruct.fvalue[21], returnStruct.fvalue[22], returnStruct.fvalue[23], returnStruct.fvalue[24], returnStruct.fvalue[25], returnStruct.fvalue[26], returnStruct.fvalue[27], returnStruct.fvalue[28], returnStruct.fvalue[29], returnStruct.fvalue[30], returnStruct.fvalue[31], returnStruct.fvalue[32], returnStruct.fvalue[33], returnStruct.fvalue[34], returnStruct.fvalue[35], returnStruct.fvalue[36], returnStruct.fvalue[37], returnStruct.fvalue[38], returnStruct.fvalue[39], returnStruct.fvalue[40], returnStruct.fvalue[41], returnStruct.fvalue[42], returnStruct.fvalue[43], returnStruct.fvalue[44], returnStruct.fvalue[45], returnStruct.fvalue[46], returnStruct.fvalue[47], returnStruct.fvalue[48], returnStruct.fvalue[49], returnStruct.fvalue[50], returnStruct.fvalue[51], returnStruct.fvalue[52], returnStruct.fvalue[53], returnStruct.fvalue[54], returnStruct.fvalue[55], returnStruct.fvalue[56], returnStruct.fvalue[57], returnStruct.fvalue[58], returnStruct.fvalue[59], returnStruct.fvalue[60], returnStruct.fvalue[61], returnStruct.fvalue[62], returnStruct.fvalue[63] = (FLR_SPNR_PSD_KERNEL_T_CODEC if endian == ">" else Struct(endian+"ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SPNR_PSD_KERNEL_T()
 
 def FLR_SPNR_PSD_KERNEL_TToByte(inVal, outBuff, outPtr):
-    pack_into(">ffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",outBuff,outPtr,inVal.fvalue[0], inVal.fvalue[1], inVal.fvalue[2], inVal.fvalue[3], inVal.fvalue[4], inVal.fvalue[5], inVal.fvalue[6], inVal.fvalue[7], inVal.fvalue[8], inVal.fvalue[9], inVal.fvalue[10], inVal.fvalue[11], inVal.fvalue[12], inVal.fvalue[13], inVal.fvalue[14], inVal.fvalue[15], inVal.fvalue[16], inVal.fvalue[17], inVal.fvalue[18], inVal.fvalue[19], inVal.fvalue[20], inVal.fvalue[21], inVal.fvalue[22], inVal.fvalue[23], inVal.fvalue[24], inVal.fvalue[25], inVal.fvalue[26], inVal.fvalue[27], inVal.fvalue[28], inVal.fvalue[29], inVal.fvalue[30], inVal.fvalue[31], inVal.fvalue[32], inVal.fvalue[33], inVal.fvalue[34], inVal.fvalue[35], inVal.fvalue[36], inVal.fvalue[37], inVal.fvalue[38], inVal.fvalue[39], inVal.fvalue[40], inVal.fvalue[41], inVal.fvalue[42], inVal.fvalue[43], inVal.fvalue[44], inVal.fvalue[45], inVal.fvalue[46], inVal.fvalue[47], inVal.fvalue[48], inVal.fvalue[49], inVal.fvalue[50], inVal.fvalue[51], inVal.fvalue[52], inVal.fvalue[53], inVal.fvalue[54], inVal.fvalue[55], inVal.fvalue[56], inVal.fvalue[57], inVal.fvalue[58], inVal.fvalue[59], inVal.fvalue[60], inVal.fvalue[61], inVal.fvalue[62], inVal.fvalue[63])
+    FLR_SPNR_PSD_KERNEL_T_CODEC.pack_into(outBuff,outPtr,inVal.fvalue[0], inVal.fvalue[1], inVal.fvalue[2], inVal.fvalue[3], inVal.fvalue[4], inVal.fvalue[5], inVal.fvalue[6], inVal.fvalue[7], inVal.fvalue[8], inVal.fvalue[9], inVal.fvalue[10], inVal.fvalue[11], inVal.fvalue[12], inVal.fvalue[13], inVal.fvalue[14], inVal.fvalue[15], inVal.fvalue[16], inVal.fvalue[17], inVal.fvalue[18], inVal.fvalue[19], inVal.fvalue[20], inVal.fvalue[21], inVal.fvalue[22], inVal.fvalue[23], inVal.fvalue[24], inVal.fvalue[25], inVal.fvalue[26], inVal.fvalue[27], inVal.fvalue[28], inVal.fvalue[29], inVal.fvalue[30], inVal.fvalue[31], inVal.fvalue[32], inVal.fvalue[33], inVal.fvalue[34], inVal.fvalue[35], inVal.fvalue[36], inVal.fvalue[37], inVal.fvalue[38], inVal.fvalue[39], inVal.fvalue[40], inVal.fvalue[41], inVal.fvalue[42], inVal.fvalue[43], inVal.fvalue[44], inVal.fvalue[45], inVal.fvalue[46], inVal.fvalue[47], inVal.fvalue[48], inVal.fvalue[49], inVal.fvalue[50], inVal.fvalue[51], inVal.fvalue[52], inVal.fvalue[53], inVal.fvalue[54], inVal.fvalue[55], inVal.fvalue[56], inVal.fvalue[57], inVal.fvalue[58], inVal.fvalue[59], inVal.fvalue[60], inVal.fvalue[61], inVal.fvalue[62], inVal.fvalue[63])
 # end of FLR_SPNR_PSD_KERNEL_TToByte()
 
 class FLR_SPOTMETER_SPOT_PARAM_T():
@@ -756,14 +808,16 @@ class FLR_SPOTMETER_SPOT_PARAM_T():
     
 # end of FLR_SPOTMETER_SPOT_PARAM_T()
 
+FLR_SPOTMETER_SPOT_PARAM_T_CODEC = Struct(">HHH")
+
 def byteToFLR_SPOTMETER_SPOT_PARAM_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SPOTMETER_SPOT_PARAM_T()
-    returnStruct.row, returnStruct.column, returnStruct.value = unpack(endian+"HHH",inBuff[inPtr:inPtr+6])
+    returnStruct.row, returnStruct.column, returnStruct.value = (FLR_SPOTMETER_SPOT_PARAM_T_CODEC if endian == ">" else Struct(endian+"HHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SPOTMETER_SPOT_PARAM_T()
 
 def FLR_SPOTMETER_SPOT_PARAM_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHH",outBuff,outPtr,inVal.row, inVal.column, inVal.value)
+    FLR_SPOTMETER_SPOT_PARAM_T_CODEC.pack_into(outBuff,outPtr,inVal.row, inVal.column, inVal.value)
 # end of FLR_SPOTMETER_SPOT_PARAM_TToByte()
 
 class FLR_SPOTMETER_STAT_PARAM_TEMP_T():
@@ -783,14 +837,16 @@ class FLR_SPOTMETER_STAT_PARAM_TEMP_T():
     
 # end of FLR_SPOTMETER_STAT_PARAM_TEMP_T()
 
+FLR_SPOTMETER_STAT_PARAM_TEMP_T_CODEC = Struct(">HHf")
+
 def byteToFLR_SPOTMETER_STAT_PARAM_TEMP_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SPOTMETER_STAT_PARAM_TEMP_T()
-    returnStruct.row, returnStruct.column, returnStruct.value = unpack(endian+"HHf",inBuff[inPtr:inPtr+8])
+    returnStruct.row, returnStruct.column, returnStruct.value = (FLR_SPOTMETER_STAT_PARAM_TEMP_T_CODEC if endian == ">" else Struct(endian+"HHf")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SPOTMETER_STAT_PARAM_TEMP_T()
 
 def FLR_SPOTMETER_STAT_PARAM_TEMP_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHf",outBuff,outPtr,inVal.row, inVal.column, inVal.value)
+    FLR_SPOTMETER_STAT_PARAM_TEMP_T_CODEC.pack_into(outBuff,outPtr,inVal.row, inVal.column, inVal.value)
 # end of FLR_SPOTMETER_STAT_PARAM_TEMP_TToByte()
 
 class FLR_SYSINFO_MONITOR_BUILD_VARIANT_T():
@@ -808,14 +864,16 @@ class FLR_SYSINFO_MONITOR_BUILD_VARIANT_T():
     
 # end of FLR_SYSINFO_MONITOR_BUILD_VARIANT_T()
 
+FLR_SYSINFO_MONITOR_BUILD_VARIANT_T_CODEC = Struct(">BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")
+
 def byteToFLR_SYSINFO_MONITOR_BUILD_VARIANT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSINFO_MONITOR_BUILD_VARIANT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16], returnStruct.value[17], returnStruct.value[18], returnStruct.value[19], returnStruct.value[20], returnStruct.value[21], returnStruct.value[22], returnStruct.value[23], returnStruct.value[24], returnStruct.value[25], returnStruct.value[26], returnStruct.value[27], returnStruct.value[28], returnStruct.value[29], returnStruct.value[30], returnStruct.value[31], returnStruct.value[32], returnStruct.value[33], returnStruct.value[34], returnStruct.value[35], returnStruct.value[36], returnStruct.value[37], returnStruct.value[38], returnStruct.value[39], returnStruct.value[40], returnStruct.value[41], returnStruct.value[42], returnStruct.value[43], returnStruct.value[44], returnStruct.value[45], returnStruct.value[46], returnStruct.value[47], returnStruct.value[48], returnStruct.value[49] = unpack(endian+"BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",inBuff[inPtr:inPtr+50])
+    returnStruct.value[:] = (FLR_SYSINFO_MONITOR_BUILD_VARIANT_T_CODEC if endian == ">" else Struct(endian+"BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSINFO_MONITOR_BUILD_VARIANT_T()
 
 def FLR_SYSINFO_MONITOR_BUILD_VARIANT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31], inVal.value[32], inVal.value[33], inVal.value[34], inVal.value[35], inVal.value[36], inVal.value[37], inVal.value[38], inVal.value[39], inVal.value[40], inVal.value[41], inVal.value[42], inVal.value[43], inVal.value[44], inVal.value[45], inVal.value[46], inVal.value[47], inVal.value[48], inVal.value[49])
+    FLR_SYSINFO_MONITOR_BUILD_VARIANT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31], inVal.value[32], inVal.value[33], inVal.value[34], inVal.value[35], inVal.value[36], inVal.value[37], inVal.value[38], inVal.value[39], inVal.value[40], inVal.value[41], inVal.value[42], inVal.value[43], inVal.value[44], inVal.value[45], inVal.value[46], inVal.value[47], inVal.value[48], inVal.value[49])
 # end of FLR_SYSINFO_MONITOR_BUILD_VARIANT_TToByte()
 
 class FLR_SYSINFO_PROBE_TIP_TYPE():
@@ -834,14 +892,16 @@ class FLR_SYSINFO_PROBE_TIP_TYPE():
     
 # end of FLR_SYSINFO_PROBE_TIP_TYPE()
 
+FLR_SYSINFO_PROBE_TIP_TYPE_CODEC = Struct(">iB")
+
 def byteToFLR_SYSINFO_PROBE_TIP_TYPE(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSINFO_PROBE_TIP_TYPE()
-    returnStruct.model, returnStruct.hwRevision = unpack(endian+"iB",inBuff[inPtr:inPtr+5])
+    returnStruct.model, returnStruct.hwRevision = (FLR_SYSINFO_PROBE_TIP_TYPE_CODEC if endian == ">" else Struct(endian+"iB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSINFO_PROBE_TIP_TYPE()
 
 def FLR_SYSINFO_PROBE_TIP_TYPEToByte(inVal, outBuff, outPtr):
-    pack_into(">iB",outBuff,outPtr,inVal.model, inVal.hwRevision)
+    FLR_SYSINFO_PROBE_TIP_TYPE_CODEC.pack_into(outBuff,outPtr,inVal.model, inVal.hwRevision)
 # end of FLR_SYSINFO_PROBE_TIP_TYPEToByte()
 
 class FLR_SYSTEMSYMBOLS_BARCONFIG_T():
@@ -863,14 +923,16 @@ class FLR_SYSTEMSYMBOLS_BARCONFIG_T():
     
 # end of FLR_SYSTEMSYMBOLS_BARCONFIG_T()
 
+FLR_SYSTEMSYMBOLS_BARCONFIG_T_CODEC = Struct(">hhhhh")
+
 def byteToFLR_SYSTEMSYMBOLS_BARCONFIG_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSTEMSYMBOLS_BARCONFIG_T()
-    returnStruct.val0, returnStruct.val1, returnStruct.val2, returnStruct.val3, returnStruct.val4 = unpack(endian+"hhhhh",inBuff[inPtr:inPtr+10])
+    returnStruct.val0, returnStruct.val1, returnStruct.val2, returnStruct.val3, returnStruct.val4 = (FLR_SYSTEMSYMBOLS_BARCONFIG_T_CODEC if endian == ">" else Struct(endian+"hhhhh")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSTEMSYMBOLS_BARCONFIG_T()
 
 def FLR_SYSTEMSYMBOLS_BARCONFIG_TToByte(inVal, outBuff, outPtr):
-    pack_into(">hhhhh",outBuff,outPtr,inVal.val0, inVal.val1, inVal.val2, inVal.val3, inVal.val4)
+    FLR_SYSTEMSYMBOLS_BARCONFIG_T_CODEC.pack_into(outBuff,outPtr,inVal.val0, inVal.val1, inVal.val2, inVal.val3, inVal.val4)
 # end of FLR_SYSTEMSYMBOLS_BARCONFIG_TToByte()
 
 class FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T():
@@ -889,14 +951,16 @@ class FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T():
     
 # end of FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T()
 
+FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T_CODEC = Struct(">BB")
+
 def byteToFLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T()
-    returnStruct.colorBar, returnStruct.colorBarOutline = unpack(endian+"BB",inBuff[inPtr:inPtr+2])
+    returnStruct.colorBar, returnStruct.colorBarOutline = (FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T_CODEC if endian == ">" else Struct(endian+"BB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T()
 
 def FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BB",outBuff,outPtr,inVal.colorBar, inVal.colorBarOutline)
+    FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_T_CODEC.pack_into(outBuff,outPtr,inVal.colorBar, inVal.colorBarOutline)
 # end of FLR_SYSTEMSYMBOLS_ISOCONFIG_ID_TToByte()
 
 class FLR_SYSTEMSYMBOLS_ISOCONFIG_T():
@@ -915,14 +979,16 @@ class FLR_SYSTEMSYMBOLS_ISOCONFIG_T():
     
 # end of FLR_SYSTEMSYMBOLS_ISOCONFIG_T()
 
+FLR_SYSTEMSYMBOLS_ISOCONFIG_T_CODEC = Struct(">BhhhhIhBhhhhIh")
+
 def byteToFLR_SYSTEMSYMBOLS_ISOCONFIG_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSTEMSYMBOLS_ISOCONFIG_T()
-    returnStruct.colorBar.id, returnStruct.colorBar.x, returnStruct.colorBar.y, returnStruct.colorBar.width, returnStruct.colorBar.height, returnStruct.colorBar.color, returnStruct.colorBar.size, returnStruct.colorBarOutline.id, returnStruct.colorBarOutline.x, returnStruct.colorBarOutline.y, returnStruct.colorBarOutline.width, returnStruct.colorBarOutline.height, returnStruct.colorBarOutline.color, returnStruct.colorBarOutline.size = unpack(endian+"BhhhhIhBhhhhIh",inBuff[inPtr:inPtr+30])
+    returnStruct.colorBar.id, returnStruct.colorBar.x, returnStruct.colorBar.y, returnStruct.colorBar.width, returnStruct.colorBar.height, returnStruct.colorBar.color, returnStruct.colorBar.size, returnStruct.colorBarOutline.id, returnStruct.colorBarOutline.x, returnStruct.colorBarOutline.y, returnStruct.colorBarOutline.width, returnStruct.colorBarOutline.height, returnStruct.colorBarOutline.color, returnStruct.colorBarOutline.size = (FLR_SYSTEMSYMBOLS_ISOCONFIG_T_CODEC if endian == ">" else Struct(endian+"BhhhhIhBhhhhIh")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSTEMSYMBOLS_ISOCONFIG_T()
 
 def FLR_SYSTEMSYMBOLS_ISOCONFIG_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BhhhhIhBhhhhIh",outBuff,outPtr,inVal.colorBar.id, inVal.colorBar.x, inVal.colorBar.y, inVal.colorBar.width, inVal.colorBar.height, inVal.colorBar.color, inVal.colorBar.size, inVal.colorBarOutline.id, inVal.colorBarOutline.x, inVal.colorBarOutline.y, inVal.colorBarOutline.width, inVal.colorBarOutline.height, inVal.colorBarOutline.color, inVal.colorBarOutline.size)
+    FLR_SYSTEMSYMBOLS_ISOCONFIG_T_CODEC.pack_into(outBuff,outPtr,inVal.colorBar.id, inVal.colorBar.x, inVal.colorBar.y, inVal.colorBar.width, inVal.colorBar.height, inVal.colorBar.color, inVal.colorBar.size, inVal.colorBarOutline.id, inVal.colorBarOutline.x, inVal.colorBarOutline.y, inVal.colorBarOutline.width, inVal.colorBarOutline.height, inVal.colorBarOutline.color, inVal.colorBarOutline.size)
 # end of FLR_SYSTEMSYMBOLS_ISOCONFIG_TToByte()
 
 class FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T():
@@ -952,14 +1018,16 @@ class FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T():
     
 # end of FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T()
 
+FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T_CODEC = Struct(">BBBBBBBBBBBBB")
+
 def byteToFLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T()
-    returnStruct.symbol, returnStruct.area, returnStruct.min, returnStruct.max, returnStruct.mean, returnStruct.meanBar, returnStruct.greenBarOutline, returnStruct.greenBar, returnStruct.greenBarText1, returnStruct.greenBarText2, returnStruct.greenBarText3, returnStruct.greenBarText4, returnStruct.greenBarText5 = unpack(endian+"BBBBBBBBBBBBB",inBuff[inPtr:inPtr+13])
+    returnStruct.symbol, returnStruct.area, returnStruct.min, returnStruct.max, returnStruct.mean, returnStruct.meanBar, returnStruct.greenBarOutline, returnStruct.greenBar, returnStruct.greenBarText1, returnStruct.greenBarText2, returnStruct.greenBarText3, returnStruct.greenBarText4, returnStruct.greenBarText5 = (FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T_CODEC if endian == ">" else Struct(endian+"BBBBBBBBBBBBB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T()
 
 def FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BBBBBBBBBBBBB",outBuff,outPtr,inVal.symbol, inVal.area, inVal.min, inVal.max, inVal.mean, inVal.meanBar, inVal.greenBarOutline, inVal.greenBar, inVal.greenBarText1, inVal.greenBarText2, inVal.greenBarText3, inVal.greenBarText4, inVal.greenBarText5)
+    FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_T_CODEC.pack_into(outBuff,outPtr,inVal.symbol, inVal.area, inVal.min, inVal.max, inVal.mean, inVal.meanBar, inVal.greenBarOutline, inVal.greenBar, inVal.greenBarText1, inVal.greenBarText2, inVal.greenBarText3, inVal.greenBarText4, inVal.greenBarText5)
 # end of FLR_SYSTEMSYMBOLS_SPOTCONFIG_ID_TToByte()
 
 class FLR_SYSTEMSYMBOLS_SPOTCONFIG_T():
@@ -989,14 +1057,16 @@ class FLR_SYSTEMSYMBOLS_SPOTCONFIG_T():
     
 # end of FLR_SYSTEMSYMBOLS_SPOTCONFIG_T()
 
+FLR_SYSTEMSYMBOLS_SPOTCONFIG_T_CODEC = Struct(">BhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIh")
+
 def byteToFLR_SYSTEMSYMBOLS_SPOTCONFIG_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSTEMSYMBOLS_SPOTCONFIG_T()
-    returnStruct.symbol.id, returnStruct.symbol.x, returnStruct.symbol.y, returnStruct.symbol.width, returnStruct.symbol.height, returnStruct.symbol.color, returnStruct.symbol.size, returnStruct.area.id, returnStruct.area.x, returnStruct.area.y, returnStruct.area.width, returnStruct.area.height, returnStruct.area.color, returnStruct.area.size, returnStruct.min.id, returnStruct.min.x, returnStruct.min.y, returnStruct.min.width, returnStruct.min.height, returnStruct.min.color, returnStruct.min.size, returnStruct.max.id, returnStruct.max.x, returnStruct.max.y, returnStruct.max.width, returnStruct.max.height, returnStruct.max.color, returnStruct.max.size, returnStruct.mean.id, returnStruct.mean.x, returnStruct.mean.y, returnStruct.mean.width, returnStruct.mean.height, returnStruct.mean.color, returnStruct.mean.size, returnStruct.meanBar.id, returnStruct.meanBar.x, returnStruct.meanBar.y, returnStruct.meanBar.width, returnStruct.meanBar.height, returnStruct.meanBar.color, returnStruct.meanBar.size, returnStruct.greenBarOutline.id, returnStruct.greenBarOutline.x, returnStruct.greenBarOutline.y, returnStruct.greenBarOutline.width, returnStruct.greenBarOutline.height, returnStruct.greenBarOutline.color, returnStruct.greenBarOutline.size, returnStruct.greenBar.id, returnStruct.greenBar.x, returnStruct.greenBar.y, returnStruct.greenBar.width, returnStruct.greenBar.height, returnStruct.greenBar.color, returnStruct.greenBar.size, returnStruct.greenBarText1.id, returnStruct.greenBarText1.x, returnStruct.greenBarText1.y, returnStruct.greenBarText1.width, returnStruct.greenBarText1.height, returnStruct.greenBarText1.color, returnStruct.greenBarText1.size, returnStruct.greenBarText2.id, returnStruct.greenBarText2.x, returnStruct.greenBarText2.y, returnStruct.greenBarText2.width, returnStruct.greenBarText2.height, returnStruct.greenBarText2.color, returnStruct.greenBarText2.size, returnStruct.greenBarText3.id, returnStruct.greenBarText3.x, returnStruct.greenBarText3.y, returnStruct.greenBarText3.width, returnStruct.greenBarText3.height, returnStruct.greenBarText3.color, returnStruct.greenBarText3.size, returnStruct.greenBarText4.id, returnStruct.greenBarText4.x, returnStruct.greenBarText4.y, returnStruct.greenBarText4.width, returnStruct.greenBarText4.height, returnStruct.greenBarText4.color, returnStruct.greenBarText4.size, returnStruct.greenBarText5.id, returnStruct.greenBarText5.x, returnStruct.greenBarText5.y, returnStruct.greenBarText5.width, returnStruct.greenBarText5.height, returnStruct.greenBarText5.color, returnStruct.greenBarText5.size = unpack(endian+"BhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIh",inBuff[inPtr:inPtr+195])
+    returnStruct.symbol.id, returnStruct.symbol.x, returnStruct.symbol.y, returnStruct.symbol.width, returnStruct.symbol.height, returnStruct.symbol.color, returnStruct.symbol.size, returnStruct.area.id, returnStruct.area.x, returnStruct.area.y, returnStruct.area.width, returnStruct.area.height, returnStruct.area.color, returnStruct.area.size, returnStruct.min.id, returnStruct.min.x, returnStruct.min.y, returnStruct.min.width, returnStruct.min.height, returnStruct.min.color, returnStruct.min.size, returnStruct.max.id, returnStruct.max.x, returnStruct.max.y, returnStruct.max.width, returnStruct.max.height, returnStruct.max.color, returnStruct.max.size, returnStruct.mean.id, returnStruct.mean.x, returnStruct.mean.y, returnStruct.mean.width, returnStruct.mean.height, returnStruct.mean.color, returnStruct.mean.size, returnStruct.meanBar.id, returnStruct.meanBar.x, returnStruct.meanBar.y, returnStruct.meanBar.width, returnStruct.meanBar.height, returnStruct.meanBar.color, returnStruct.meanBar.size, returnStruct.greenBarOutline.id, returnStruct.greenBarOutline.x, returnStruct.greenBarOutline.y, returnStruct.greenBarOutline.width, returnStruct.greenBarOutline.height, returnStruct.greenBarOutline.color, returnStruct.greenBarOutline.size, returnStruct.greenBar.id, returnStruct.greenBar.x, returnStruct.greenBar.y, returnStruct.greenBar.width, returnStruct.greenBar.height, returnStruct.greenBar.color, returnStruct.greenBar.size, returnStruct.greenBarText1.id, returnStruct.greenBarText1.x, returnStruct.greenBarText1.y, returnStruct.greenBarText1.width, returnStruct.greenBarText1.height, returnStruct.greenBarText1.color, returnStruct.greenBarText1.size, returnStruct.greenBarText2.id, returnStruct.greenBarText2.x, returnStruct.greenBarText2.y, returnStruct.greenBarText2.width, returnStruct.greenBarText2.height, returnStruct.greenBarText2.color, returnStruct.greenBarText2.size, returnStruct.greenBarText3.id, returnStruct.greenBarText3.x, returnStruct.greenBarText3.y, returnStruct.greenBarText3.width, returnStruct.greenBarText3.height, returnStruct.greenBarText3.color, returnStruct.greenBarText3.size, returnStruct.greenBarText4.id, returnStruct.greenBarText4.x, returnStruct.greenBarText4.y, returnStruct.greenBarText4.width, returnStruct.greenBarText4.height, returnStruct.greenBarText4.color, returnStruct.greenBarText4.size, returnStruct.greenBarText5.id, returnStruct.greenBarText5.x, returnStruct.greenBarText5.y, returnStruct.greenBarText5.width, returnStruct.greenBarText5.height, returnStruct.greenBarText5.color, returnStruct.greenBarText5.size = (FLR_SYSTEMSYMBOLS_SPOTCONFIG_T_CODEC if endian == ">" else Struct(endian+"BhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIh")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSTEMSYMBOLS_SPOTCONFIG_T()
 
 def FLR_SYSTEMSYMBOLS_SPOTCONFIG_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIhBhhhhIh",outBuff,outPtr,inVal.symbol.id, inVal.symbol.x, inVal.symbol.y, inVal.symbol.width, inVal.symbol.height, inVal.symbol.color, inVal.symbol.size, inVal.area.id, inVal.area.x, inVal.area.y, inVal.area.width, inVal.area.height, inVal.area.color, inVal.area.size, inVal.min.id, inVal.min.x, inVal.min.y, inVal.min.width, inVal.min.height, inVal.min.color, inVal.min.size, inVal.max.id, inVal.max.x, inVal.max.y, inVal.max.width, inVal.max.height, inVal.max.color, inVal.max.size, inVal.mean.id, inVal.mean.x, inVal.mean.y, inVal.mean.width, inVal.mean.height, inVal.mean.color, inVal.mean.size, inVal.meanBar.id, inVal.meanBar.x, inVal.meanBar.y, inVal.meanBar.width, inVal.meanBar.height, inVal.meanBar.color, inVal.meanBar.size, inVal.greenBarOutline.id, inVal.greenBarOutline.x, inVal.greenBarOutline.y, inVal.greenBarOutline.width, inVal.greenBarOutline.height, inVal.greenBarOutline.color, inVal.greenBarOutline.size, inVal.greenBar.id, inVal.greenBar.x, inVal.greenBar.y, inVal.greenBar.width, inVal.greenBar.height, inVal.greenBar.color, inVal.greenBar.size, inVal.greenBarText1.id, inVal.greenBarText1.x, inVal.greenBarText1.y, inVal.greenBarText1.width, inVal.greenBarText1.height, inVal.greenBarText1.color, inVal.greenBarText1.size, inVal.greenBarText2.id, inVal.greenBarText2.x, inVal.greenBarText2.y, inVal.greenBarText2.width, inVal.greenBarText2.height, inVal.greenBarText2.color, inVal.greenBarText2.size, inVal.greenBarText3.id, inVal.greenBarText3.x, inVal.greenBarText3.y, inVal.greenBarText3.width, inVal.greenBarText3.height, inVal.greenBarText3.color, inVal.greenBarText3.size, inVal.greenBarText4.id, inVal.greenBarText4.x, inVal.greenBarText4.y, inVal.greenBarText4.width, inVal.greenBarText4.height, inVal.greenBarText4.color, inVal.greenBarText4.size, inVal.greenBarText5.id, inVal.greenBarText5.x, inVal.greenBarText5.y, inVal.greenBarText5.width, inVal.greenBarText5.height, inVal.greenBarText5.color, inVal.greenBarText5.size)
+    FLR_SYSTEMSYMBOLS_SPOTCONFIG_T_CODEC.pack_into(outBuff,outPtr,inVal.symbol.id, inVal.symbol.x, inVal.symbol.y, inVal.symbol.width, inVal.symbol.height, inVal.symbol.color, inVal.symbol.size, inVal.area.id, inVal.area.x, inVal.area.y, inVal.area.width, inVal.area.height, inVal.area.color, inVal.area.size, inVal.min.id, inVal.min.x, inVal.min.y, inVal.min.width, inVal.min.height, inVal.min.color, inVal.min.size, inVal.max.id, inVal.max.x, inVal.max.y, inVal.max.width, inVal.max.height, inVal.max.color, inVal.max.size, inVal.mean.id, inVal.mean.x, inVal.mean.y, inVal.mean.width, inVal.mean.height, inVal.mean.color, inVal.mean.size, inVal.meanBar.id, inVal.meanBar.x, inVal.meanBar.y, inVal.meanBar.width, inVal.meanBar.height, inVal.meanBar.color, inVal.meanBar.size, inVal.greenBarOutline.id, inVal.greenBarOutline.x, inVal.greenBarOutline.y, inVal.greenBarOutline.width, inVal.greenBarOutline.height, inVal.greenBarOutline.color, inVal.greenBarOutline.size, inVal.greenBar.id, inVal.greenBar.x, inVal.greenBar.y, inVal.greenBar.width, inVal.greenBar.height, inVal.greenBar.color, inVal.greenBar.size, inVal.greenBarText1.id, inVal.greenBarText1.x, inVal.greenBarText1.y, inVal.greenBarText1.width, inVal.greenBarText1.height, inVal.greenBarText1.color, inVal.greenBarText1.size, inVal.greenBarText2.id, inVal.greenBarText2.x, inVal.greenBarText2.y, inVal.greenBarText2.width, inVal.greenBarText2.height, inVal.greenBarText2.color, inVal.greenBarText2.size, inVal.greenBarText3.id, inVal.greenBarText3.x, inVal.greenBarText3.y, inVal.greenBarText3.width, inVal.greenBarText3.height, inVal.greenBarText3.color, inVal.greenBarText3.size, inVal.greenBarText4.id, inVal.greenBarText4.x, inVal.greenBarText4.y, inVal.greenBarText4.width, inVal.greenBarText4.height, inVal.greenBarText4.color, inVal.greenBarText4.size, inVal.greenBarText5.id, inVal.greenBarText5.x, inVal.greenBarText5.y, inVal.greenBarText5.width, inVal.greenBarText5.height, inVal.greenBarText5.color, inVal.greenBarText5.size)
 # end of FLR_SYSTEMSYMBOLS_SPOTCONFIG_TToByte()
 
 class FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T():
@@ -1020,14 +1090,16 @@ class FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T():
     
 # end of FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T()
 
+FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T_CODEC = Struct(">BhhhhIh")
+
 def byteToFLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T()
-    returnStruct.id, returnStruct.x, returnStruct.y, returnStruct.width, returnStruct.height, returnStruct.color, returnStruct.size = unpack(endian+"BhhhhIh",inBuff[inPtr:inPtr+15])
+    returnStruct.id, returnStruct.x, returnStruct.y, returnStruct.width, returnStruct.height, returnStruct.color, returnStruct.size = (FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T_CODEC if endian == ">" else Struct(endian+"BhhhhIh")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T()
 
 def FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BhhhhIh",outBuff,outPtr,inVal.id, inVal.x, inVal.y, inVal.width, inVal.height, inVal.color, inVal.size)
+    FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_T_CODEC.pack_into(outBuff,outPtr,inVal.id, inVal.x, inVal.y, inVal.width, inVal.height, inVal.color, inVal.size)
 # end of FLR_SYSTEMSYMBOLS_SPOT_ISO_ENTRY_TToByte()
 
 class FLR_TESTRAMP_ANIMATION_SETTINGS_T():
@@ -1046,14 +1118,16 @@ class FLR_TESTRAMP_ANIMATION_SETTINGS_T():
     
 # end of FLR_TESTRAMP_ANIMATION_SETTINGS_T()
 
+FLR_TESTRAMP_ANIMATION_SETTINGS_T_CODEC = Struct(">hH")
+
 def byteToFLR_TESTRAMP_ANIMATION_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_TESTRAMP_ANIMATION_SETTINGS_T()
-    returnStruct.moveLines, returnStruct.moveFrames = unpack(endian+"hH",inBuff[inPtr:inPtr+4])
+    returnStruct.moveLines, returnStruct.moveFrames = (FLR_TESTRAMP_ANIMATION_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"hH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_TESTRAMP_ANIMATION_SETTINGS_T()
 
 def FLR_TESTRAMP_ANIMATION_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">hH",outBuff,outPtr,inVal.moveLines, inVal.moveFrames)
+    FLR_TESTRAMP_ANIMATION_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.moveLines, inVal.moveFrames)
 # end of FLR_TESTRAMP_ANIMATION_SETTINGS_TToByte()
 
 class FLR_TESTRAMP_SETTINGS_T():
@@ -1073,14 +1147,16 @@ class FLR_TESTRAMP_SETTINGS_T():
     
 # end of FLR_TESTRAMP_SETTINGS_T()
 
+FLR_TESTRAMP_SETTINGS_T_CODEC = Struct(">HHH")
+
 def byteToFLR_TESTRAMP_SETTINGS_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_TESTRAMP_SETTINGS_T()
-    returnStruct.start, returnStruct.end, returnStruct.increment = unpack(endian+"HHH",inBuff[inPtr:inPtr+6])
+    returnStruct.start, returnStruct.end, returnStruct.increment = (FLR_TESTRAMP_SETTINGS_T_CODEC if endian == ">" else Struct(endian+"HHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_TESTRAMP_SETTINGS_T()
 
 def FLR_TESTRAMP_SETTINGS_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHH",outBuff,outPtr,inVal.start, inVal.end, inVal.increment)
+    FLR_TESTRAMP_SETTINGS_T_CODEC.pack_into(outBuff,outPtr,inVal.start, inVal.end, inVal.increment)
 # end of FLR_TESTRAMP_SETTINGS_TToByte()
 
 class FLR_TF_NF_LUT_T():
@@ -1098,14 +1174,16 @@ class FLR_TF_NF_LUT_T():
     
 # end of FLR_TF_NF_LUT_T()
 
+FLR_TF_NF_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHH")
+
 def byteToFLR_TF_NF_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_TF_NF_LUT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16] = unpack(endian+"HHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+34])
+    returnStruct.value[:] = (FLR_TF_NF_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_TF_NF_LUT_T()
 
 def FLR_TF_NF_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
+    FLR_TF_NF_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
 # end of FLR_TF_NF_LUT_TToByte()
 
 class FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T():
@@ -1123,14 +1201,16 @@ class FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T():
     
 # end of FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T()
 
+FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T_CODEC = Struct(">HHHHHHHHHHHHHHHHH")
+
 def byteToFLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16] = unpack(endian+"HHHHHHHHHHHHHHHHH",inBuff[inPtr:inPtr+34])
+    returnStruct.value[:] = (FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T_CODEC if endian == ">" else Struct(endian+"HHHHHHHHHHHHHHHHH")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T()
 
 def FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">HHHHHHHHHHHHHHHHH",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
+    FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16])
 # end of FLR_TF_TEMP_SIGNAL_COMP_FACTOR_LUT_TToByte()
 
 class FLR_TF_WLUT_T():
@@ -1148,13 +1228,15 @@ class FLR_TF_WLUT_T():
     
 # end of FLR_TF_WLUT_T()
 
+FLR_TF_WLUT_T_CODEC = Struct(">BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")
+
 def byteToFLR_TF_WLUT_T(inBuff,inPtr,endian=">"):
     returnStruct = FLR_TF_WLUT_T()
-    returnStruct.value[0], returnStruct.value[1], returnStruct.value[2], returnStruct.value[3], returnStruct.value[4], returnStruct.value[5], returnStruct.value[6], returnStruct.value[7], returnStruct.value[8], returnStruct.value[9], returnStruct.value[10], returnStruct.value[11], returnStruct.value[12], returnStruct.value[13], returnStruct.value[14], returnStruct.value[15], returnStruct.value[16], returnStruct.value[17], returnStruct.value[18], returnStruct.value[19], returnStruct.value[20], returnStruct.value[21], returnStruct.value[22], returnStruct.value[23], returnStruct.value[24], returnStruct.value[25], returnStruct.value[26], returnStruct.value[27], returnStruct.value[28], returnStruct.value[29], returnStruct.value[30], returnStruct.value[31] = unpack(endian+"BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",inBuff[inPtr:inPtr+32])
+    returnStruct.value[:] = (FLR_TF_WLUT_T_CODEC if endian == ">" else Struct(endian+"BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB")).unpack_from(inBuff,inPtr)
     return returnStruct
 # end of byteToFLR_TF_WLUT_T()
 
 def FLR_TF_WLUT_TToByte(inVal, outBuff, outPtr):
-    pack_into(">BBBBBBBBBBBBBBBBBBBBBBBBBBBBBBBB",outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31])
+    FLR_TF_WLUT_T_CODEC.pack_into(outBuff,outPtr,inVal.value[0], inVal.value[1], inVal.value[2], inVal.value[3], inVal.value[4], inVal.value[5], inVal.value[6], inVal.value[7], inVal.value[8], inVal.value[9], inVal.value[10], inVal.value[11], inVal.value[12], inVal.value[13], inVal.value[14], inVal.value[15], inVal.value[16], inVal.value[17], inVal.value[18], inVal.value[19], inVal.value[20], inVal.value[21], inVal.value[22], inVal.value[23], inVal.value[24], inVal.value[25], inVal.value[26], inVal.value[27], inVal.value[28], inVal.value[29], inVal.value[30], inVal.value[31])
 # end of FLR_TF_WLUT_TToByte()
 
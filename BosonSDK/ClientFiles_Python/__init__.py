@@ -0,0 +1,11 @@
+# The FLR_* enum and struct types, as BosonSDK.ClientFiles_Python.FLR_*,
+# imported on first use
+def __getattr__(name):
+    if name.startswith('FLR_'):
+        from . import EnumTypes, Serializer_Struct
+        for module in (EnumTypes, Serializer_Struct):
+            value = getattr(module, name, None)
+            if isinstance(value, type):
+                globals()[name] = value
+                return value
+    raise AttributeError("module {!r} has no attribute {!r}".format(__name__, name))
@@ -41,6 +41,13 @@ class CSerialPort(PortBase):
             self.port_open = self.__library.__getattr__("FSLP_open_port")
             self.port_close = self.__library.__getattr__("FSLP_close_port")
             self.lookup_port_name = self.__library.__getattr__("FSLP_lookup_port_id")
+            # event-loop support, for Client_Async; libraries before FSLP_pump lack it
+            try:
+                self.port_fd = self.__library.__getattr__("FSLP_get_port_fd")
+                self.pump = self.__library.__getattr__("FSLP_pump")
+            except AttributeError:
+                self.port_fd = None
+                self.pump = None
         except OSError as e:
             print("dllPath = {!s}".format(dllPath))
             print("filePath = {!s}".format(os.path.dirname(__file__)))
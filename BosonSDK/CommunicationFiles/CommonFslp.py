@@ -12,6 +12,7 @@ class FSLP_TYPE_E(IntEnum):
     FSLP_DLL_SERIAL = 0
     FSLP_PY_SERIAL = 1
     FSLP_I2C = 2
+    FSLP_KERNEL = 3
 
 class CommonFslp(object):
     @staticmethod
@@ -33,6 +34,12 @@ class CommonFslp(object):
             from .I2CFslp import I2CFslp
             fslp = I2CFslp(portName, baudrate, **portArgs)
             print("I2C FSLP load")
+        elif FSLP_TYPE_E.FSLP_KERNEL == fslpType:
+            from .KernelFslp import KernelFslp
+            fslp = KernelFslp(portName, baudrate)
+            print("Kernel FSLP load")
         else:
             raise Exception("Unknown FSLP type")
-        return fslp
+        # BOSON_FSLP_LOG=path records the session's frames (BosonSDK/fslp_log.py)
+        from ..fslp_log import wrapFromEnv
+        return wrapFromEnv(fslp)
@@ -4,7 +4,7 @@ FSLP communication by I2C port - custom library is used
 """
 
 from .FslpBase import FslpBase
-from .I2CPort import I2CAardvarkPort, I2CDriverPort, I2CSMBusPort
+from .I2CPort import I2CAardvarkPort, I2CDriverPort, I2CNativePort, I2CSMBusPort
 from struct import pack, unpack
 
 MAGIC_TOKEN = bytearray( [0x8E, 0xA1])
@@ -21,16 +21,28 @@ class I2CFslp(FslpBase):
             peripheralAddress=portargs['peripheralAddress']
         except KeyError:
             peripheralAddress=0x6A
-        if "SMBUS" in I2C_TYPE.upper():
+        self.native = "NATIVE" in I2C_TYPE.upper()
+        if self.native:
+            # FSLP_FRAME_BUF_SIZ bounds command frames too
+            self.maxFrameBytes = 2048
+            super().__init__(I2CNativePort(portID=portID, baudrate=baudrate, peripheralAddress=peripheralAddress,
+                                           dllPath=portargs.get('dllPath')))
+        elif "SMBUS" in I2C_TYPE.upper():
             super().__init__(I2CSMBusPort(portID=portID, baudrate=baudrate, peripheralAddress=peripheralAddress))
         elif "AARD" in I2C_TYPE:
             super().__init__(I2CAardvarkPort(portID=portID, baudrate=baudrate, peripheralAddress=peripheralAddress))
         else:
             super().__init__(I2CDriverPort(portID=portID, baudrate=baudrate, peripheralAddress=peripheralAddress))
+        # ports with transfer() send a command and read its reply in one bus call
+        self.combined = hasattr(self.port, "transfer")
+        self.pendingFrame = None
 
     def sendFrame(self, channelID, data, dataSize):
         if not self.port.isOpen():
             raise Exception("I2C port is not open")
+        if self.native:
+            self.port.writeFrame(data, dataSize)
+            return
         #I2C FSLP-like header
         # shallow copy token
         sendBuffer = MAGIC_TOKEN[:]
@@ -39,11 +51,50 @@ class I2CFslp(FslpBase):
         # add data
         sendBuffer.extend(data)
 
+        if self.combined and channelID == 0x00:
+            # commands are always followed by readFrame(), which sends this
+            self.flushPending()
+            self.pendingFrame = sendBuffer
+            return
         self.port.write(sendBuffer)
 
+    def flushPending(self):
+        if self.pendingFrame is not None:
+            sendBuffer, self.pendingFrame = self.pendingFrame, None
+            self.port.write(sendBuffer)
+
+    def transferFrame(self, expectedReceiveBytes):
+        # write, header read and payload read of the expected size in one call;
+        # a reply shorter than expected is followed by idle bytes, a longer one
+        # costs one more read for the rest
+        sendBuffer, self.pendingFrame = self.pendingFrame, None
+        sizes = [LEN_HEADER, expectedReceiveBytes] if expectedReceiveBytes else [LEN_HEADER]
+        frame = bytearray().join(self.port.transfer(sendBuffer, *sizes))
+        start = frame.find(MAGIC_TOKEN)
+        if start < 0:
+            print("WARNING: Did not receive MAGIC_TOKEN: ", frame[:2])
+            raise ValueError("Did not receive MAGIC_TOKEN: ", frame[:2])
+        if start + LEN_HEADER > len(frame):
+            frame.extend(self.port.read(start + LEN_HEADER - len(frame)))
+        toRead = unpack(">H", frame[start + 2:start + LEN_HEADER])[0]
+        if toRead != expectedReceiveBytes:
+            print("WARNING MSG declared {:d} bytes but {:d} expected)".format(toRead, expectedReceiveBytes))
+        missing = start + LEN_HEADER + toRead - len(frame)
+        if missing > 0:
+            frame.extend(self.port.read(missing))
+        return frame[start + LEN_HEADER:start + LEN_HEADER + toRead]
+
     def readFrame(self, channelID, expectedReceiveBytes):
         if not self.port.isOpen():
             raise Exception("Port is not open")
+        if self.native:
+            receiveBuffer = self.port.readFrame(max(expectedReceiveBytes, self.maxFrameBytes))
+            # nbytes: len is a local further down
+            if receiveBuffer.nbytes != expectedReceiveBytes:
+                print("WARNING MSG declared {:d} bytes but {:d} expected)".format(receiveBuffer.nbytes, expectedReceiveBytes))
+            return receiveBuffer
+        if self.pendingFrame is not None:
+            return self.transferFrame(expectedReceiveBytes)
         #I2C FSLP-like header
         try:
             r1 = self.port.read(1)
@@ -3,6 +3,7 @@
 I2C port supported by custom library
 """
 
+import ctypes, os
 from .PortBase import PortBase
 I2C_AARDVARK_AVAILABLE = False
 AARDVARK_ERROR_STRING = "TotalPhase Aardvark driver not available. (pip install aardvark-py)"
@@ -88,6 +89,127 @@ class I2CSMBusPort(PortBase):
         # print("i2cread: ", ":".join("{:02x}".format(c) for c in msg.buf[0:msg.len]))
         return bytearray(msg.buf[0:msg.len])
 
+    def transfer(self, data, *readSizes):
+        '''
+        Write data (None to skip), then read each of readSizes bytes, as one
+        i2c_rdwr call: one kernel entry, repeated starts instead of stop/start.
+        Returns the reads as bytearrays.
+        '''
+        msgs = [self.i2c_msg.write(self.peripheralAddress, data)] if data else []
+        reads = [self.i2c_msg.read(self.peripheralAddress, n) for n in readSizes]
+        self.port.i2c_rdwr(*(msgs + reads))
+        for msg, n in zip(reads, readSizes):
+            if msg.len != n:
+                raise IOError(f"Read incorrect number of bytes. Got {msg.len} instead of {n}")
+        return [bytearray(msg.buf[0:msg.len]) for msg in reads]
+
+    def __del__(self):
+        try:
+            self.close()
+        except Exception:
+            pass
+
+class I2CNativePort(PortBase):
+    '''
+    /dev/i2c-N through the compiled FSLP library (FSLP_i2c_* in FSLP_64.so):
+    framing and resync run in C, each frame costs one ioctl to send and two to read.
+    '''
+    def __init__(self, portID=2, baudrate=400000, peripheralAddress=0x6A, dllPath=None):
+        '''
+        portID = i2c bus number (e.g. 0 or 1) or an absolute file path (e.g. `/dev/i2c-42`).
+        dllPath = directory holding FSLP_64.so, default FSLP_Files next to this file.
+        '''
+        if portID is None:
+            portID = 2
+        if baudrate is None:
+            baudrate = 400000
+        super().__init__(portID, int(baudrate))
+        self.peripheralAddress = peripheralAddress
+        self.portOpen = False
+        self.handle = -1
+        if "posix" not in os.name:
+            raise ImportError("Native I2C FSLP needs Linux /dev/i2c-N")
+        if 400000 != baudrate:
+            print("Warning native I2C cannot directly change I2C clock rate, change device settings directly")
+        if dllPath:
+            loadpath = os.path.join(dllPath, "FSLP_64.so")
+        else:
+            loadpath = os.path.join(os.path.dirname(__file__), "FSLP_Files", "FSLP_64.so")
+        lib = ctypes.cdll.LoadLibrary(loadpath)
+        self.i2c_open = lib.FSLP_i2c_open
+        self.i2c_open.argtypes = [ctypes.c_char_p, ctypes.c_uint8]
+        self.i2c_close = lib.FSLP_i2c_close
+        self.i2c_close.argtypes = [ctypes.c_int32]
+        self.i2c_close.restype = None
+        self.i2c_write = lib.FSLP_i2c_write
+        self.i2c_read = lib.FSLP_i2c_read
+        self.i2c_write_frame = lib.FSLP_i2c_write_frame
+        for fn in (self.i2c_write, self.i2c_read, self.i2c_write_frame):
+            fn.argtypes = [ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint16]
+        self.i2c_read_frame = lib.FSLP_i2c_read_frame
+        self.i2c_read_frame.argtypes = [ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint16, ctypes.c_uint16]
+        self.library = lib
+
+    def open(self):
+        bus = self.portID if isinstance(self.portID, str) else "/dev/i2c-{:d}".format(int(self.portID))
+        self.handle = self.i2c_open(bus.encode(), self.peripheralAddress)
+        if self.handle < 0:
+            raise IOError("Failed to open I2C bus {!s}!".format(bus))
+        self.portOpen = True
+
+    def close(self):
+        try:
+            if self.isOpen():
+                self.i2c_close(self.handle)
+        finally:
+            self.portOpen = False
+            self.handle = -1
+
+    def isOpen(self):
+        return self.portOpen
+
+    def isAvailable(self):
+        return None
+
+    @staticmethod
+    def _buffer(data):
+        # bytes are immutable: ctypes can only borrow writable buffers
+        if not isinstance(data, bytearray):
+            data = bytearray(data)
+        return data, (ctypes.c_uint8 * len(data)).from_buffer(data) if len(data) else None
+
+    def write(self, data):
+        data, buf = self._buffer(data)
+        if self.i2c_write(self.handle, buf, len(data)):
+            raise IOError("I2C write of {:d} bytes failed".format(len(data)))
+
+    def read(self, numberOfBytes):
+        data = bytearray(numberOfBytes)
+        _, buf = self._buffer(data)
+        if self.i2c_read(self.handle, buf, numberOfBytes):
+            raise IOError("I2C read of {:d} bytes failed".format(numberOfBytes))
+        return data
+
+    def writeFrame(self, data, dataSize):
+        data, buf = self._buffer(data if len(data) == dataSize else data[:dataSize])
+        if self.i2c_write_frame(self.handle, buf, dataSize):
+            raise IOError("I2C write of a {:d} byte frame failed".format(dataSize))
+
+    def readFrame(self, maxBytes, timeout_ms=1000):
+        '''
+        One frame's payload as a memoryview over a buffer of its own.
+        '''
+        data = bytearray(maxBytes)
+        _, buf = self._buffer(data)
+        ret = self.i2c_read_frame(self.handle, buf, maxBytes, timeout_ms)
+        if ret == -2:
+            raise TimeoutError("No I2C frame within {:d} ms".format(timeout_ms))
+        if ret == -3:
+            raise ValueError("I2C frame longer than {:d} bytes".format(maxBytes))
+        if ret < 0:
+            raise IOError("I2C frame read failed")
+        return memoryview(data)[:ret]
+
     def __del__(self):
         try:
             self.close()
@@ -0,0 +1,143 @@
+# -*- coding: utf-8 -*-
+"""
+FSLP through the flir_boson driver - FLIR_BOSON_IOCTL_FSLP_FRAME on the sensor's
+/dev/v4l-subdevN, see flir_boson_v4l2/flir-boson-ioctl.h. The driver frames the
+commands and serializes them with its own bus traffic, so the SDK can run while
+the driver streams without a second master on the I2C bus.
+"""
+
+import ctypes
+import fcntl
+import os
+
+from .FslpBase import FslpBase
+from .PortBase import PortBase
+from struct import pack, unpack
+
+HEADER_BYTES = 12
+MAX_PAYLOAD = 756           # FLIR_BOSON_FSLP_MAX_PAYLOAD
+MAX_CMDS = 64               # FLIR_BOSON_FSLP_MAX_CMDS
+MAX_TIMEOUT_MS = 5000       # FLIR_BOSON_FSLP_MAX_TIMEOUT_MS, the driver rejects longer ones
+FLR_COMM_ERROR_READING_COMM = 0x026E
+
+
+class FLIR_BOSON_FSLP_CMD(ctypes.Structure):
+    _fields_ = [("fn_id", ctypes.c_uint32),
+                ("result", ctypes.c_uint32),
+                ("tx_bytes", ctypes.c_uint32),
+                ("rx_bytes", ctypes.c_uint32),
+                ("timeout_ms", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32),
+                ("tx_data", ctypes.c_uint64),
+                ("rx_data", ctypes.c_uint64)]
+
+
+class FLIR_BOSON_IOCTL_FSLP(ctypes.Structure):
+    _fields_ = [("count", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("cmds", ctypes.c_uint64)]
+
+
+def _IOWR(type, nr, size):
+    return (3 << 30) | (size << 16) | (ord(type) << 8) | nr
+
+FLIR_BOSON_IOCTL_FSLP_FRAME = _IOWR('F', 0x01, ctypes.sizeof(FLIR_BOSON_IOCTL_FSLP))
+
+
+class KernelPort(PortBase):
+    def __init__(self, portID=None, baudrate=None):
+        super().__init__(portID, baudrate)
+        self.fd = None
+        # one buffer pair per vector entry, reused across calls
+        self.txBuffers = (ctypes.c_uint8 * (MAX_PAYLOAD * MAX_CMDS))()
+        self.rxBuffers = (ctypes.c_uint8 * (MAX_PAYLOAD * MAX_CMDS))()
+        self.cmds = (FLIR_BOSON_FSLP_CMD * MAX_CMDS)()
+
+    def open(self):
+        if self.fd is None:
+            self.fd = os.open(self.portID, os.O_RDWR)
+
+    def close(self):
+        if self.fd is not None:
+            os.close(self.fd)
+            self.fd = None
+
+    def isOpen(self):
+        return self.fd is not None
+
+    def isAvailable(self):
+        return os.path.exists(self.portID)
+
+    def read(self, numBytes):
+        # nothing arrives outside a command; the dispatcher's drain ends at once
+        return bytearray(b"\xff" * numBytes)
+
+    def transfer(self, commands):
+        '''Run [(fnID, sendData, receiveBytes, timeout_ms), ...] in order, up to
+        MAX_CMDS per ioctl; returns [(FLR_RESULT value, response data), ...].
+        A failed ioctl fails its commands with FLR_COMM_ERROR_READING_COMM.'''
+        results = []
+        for first in range(0, len(commands), MAX_CMDS):
+            results += self._transferVector(commands[first:first + MAX_CMDS])
+        return results
+
+    def _transferVector(self, commands):
+        txBase = ctypes.addressof(self.txBuffers)
+        rxBase = ctypes.addressof(self.rxBuffers)
+        for i, (fnID, sendData, receiveBytes, timeout_ms) in enumerate(commands):
+            if len(sendData) > MAX_PAYLOAD or receiveBytes > MAX_PAYLOAD:
+                raise ValueError("SDK command data is limited to {:d} bytes".format(MAX_PAYLOAD))
+            ctypes.memmove(txBase + i * MAX_PAYLOAD, bytes(sendData), len(sendData))
+            self.cmds[i] = FLIR_BOSON_FSLP_CMD(fn_id=fnID, tx_bytes=len(sendData), rx_bytes=receiveBytes,
+                                               timeout_ms=timeout_ms, tx_data=txBase + i * MAX_PAYLOAD,
+                                               rx_data=rxBase + i * MAX_PAYLOAD)
+        req = FLIR_BOSON_IOCTL_FSLP(count=len(commands), cmds=ctypes.addressof(self.cmds))
+        try:
+            fcntl.ioctl(self.fd, FLIR_BOSON_IOCTL_FSLP_FRAME, req)
+        except OSError as e:
+            print("FLIR_BOSON_IOCTL_FSLP_FRAME failed: {}".format(e))
+            return [(FLR_COMM_ERROR_READING_COMM, bytearray())] * len(commands)
+        results = []
+        for i, (fnID, sendData, receiveBytes, timeout_ms) in enumerate(commands):
+            result = self.cmds[i].result
+            # rx_bytes comes back as the length the camera answered with
+            data = bytearray(ctypes.string_at(rxBase + i * MAX_PAYLOAD, self.cmds[i].rx_bytes)) if result == 0 else bytearray()
+            results.append((result, data))
+        return results
+
+
+class KernelFslp(FslpBase):
+    '''The driver does the framing, so a "frame" here is one ioctl: sendFrame
+    keeps the command and readFrame runs it and builds the reply header.
+    batch() sends many commands in one ioctl.'''
+
+    def __init__(self, portID=None, baudrate=None, **kwargs):
+        super().__init__(KernelPort(portID, baudrate))
+        self.pendingFrame = None
+        self.timeout_ms = 0
+
+    def sendFrame(self, channelID, data, dataSize):
+        if len(data) < HEADER_BYTES or dataSize - HEADER_BYTES > MAX_PAYLOAD:
+            raise ValueError("Not an SDK command of up to {:d} bytes".format(MAX_PAYLOAD))
+        self.pendingFrame = bytes(data[:dataSize])
+
+    def readFrame(self, channelID, expectedReceiveBytes):
+        if self.pendingFrame is None:
+            return bytearray()
+        frame, self.pendingFrame = self.pendingFrame, None
+        seqNum, fnID = unpack(">II", frame[:8])
+        receiveBytes = min(max(expectedReceiveBytes - HEADER_BYTES, 0), MAX_PAYLOAD)
+        (result, data), = self.port.transfer([(fnID, frame[HEADER_BYTES:], receiveBytes, self.timeout_ms)])
+        return bytearray(pack(">III", seqNum, fnID, result)) + data
+
+    def batch(self, commands):
+        '''[(fnID, sendData, receiveBytes), ...] -> [(FLR_RESULT value, data), ...],
+        run back to back under the driver's lock.'''
+        return self.port.transfer([(fnID, sendData, receiveBytes, self.timeout_ms)
+                                   for fnID, sendData, receiveBytes in commands])
+
+    def setTimeout(self, timeout):
+        self.timeout_ms = min(int(timeout), MAX_TIMEOUT_MS)
+
+    def unsetTimeout(self):
+        self.timeout_ms = 0
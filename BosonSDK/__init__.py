@@ -1,18 +1,37 @@
-from .ClientFiles_Python import EnumTypes as EE
-from .ClientFiles_Python import Client_API as CamAPI
-from .ClientFiles_Python import Serializer_Struct as SS
-from .ClientFiles_Python.EnumTypes import *
-from .ClientFiles_Python.Serializer_Struct import *
-from .ClientFiles_Python import __dict__
-
-__all__ = ['CamAPI','EE','SS']
-
-for item in EE.__dict__.items():
-    if "FLR_" in item[0] and isinstance(item[1],type):
-        __all__.append(item[0])
-        __dict__[item[0]] = item[1]
-        
-for item in SS.__dict__.items():
-    if "FLR_" in item[0] and isinstance(item[1],type):
-        __all__.append(item[0])
-        __dict__[item[0]] = item[1]
+# Everything below is imported on first use (PEP 562), so scripts that send
+# a few commands don't pay for loading the whole generated SDK up front.
+import importlib
+
+_MODULES = {
+    'CamAPI': '.ClientFiles_Python.Client_API',
+    'AsyncAPI': '.ClientFiles_Python.Client_Async',
+    'EE': '.ClientFiles_Python.EnumTypes',
+    'SS': '.ClientFiles_Python.Serializer_Struct',
+    'ClientFiles_Python': '.ClientFiles_Python',
+    'CommunicationFiles': '.CommunicationFiles',
+}
+
+def _flrTypes(module):
+    return [name for name, value in vars(module).items() if "FLR_" in name and isinstance(value, type)]
+
+def __getattr__(name):
+    if name in _MODULES:
+        value = importlib.import_module(_MODULES[name], __name__)
+    elif name == '__all__':
+        value = ['CamAPI', 'EE', 'SS'] + _flrTypes(__getattr__('EE')) + _flrTypes(__getattr__('SS'))
+    elif not name.startswith('_'):
+        # what "from EnumTypes import *" and "from Serializer_Struct import *" gave
+        for module in ('EE', 'SS'):
+            module = __getattr__(module)
+            if hasattr(module, name):
+                value = getattr(module, name)
+                break
+        else:
+            raise AttributeError("module {!r} has no attribute {!r}".format(__name__, name))
+    else:
+        raise AttributeError("module {!r} has no attribute {!r}".format(__name__, name))
+    globals()[name] = value
+    return value
+
+def __dir__():
+    return sorted(set(globals()) | set(__getattr__('__all__')))
@@ -0,0 +1,135 @@
+"""
+Host-side AGC: Y14 counts to an 8-bit display image.
+
+Stream RAW14 for radiometry and still have a picture, without switching the
+camera to RAW8 and back (each switch a format change and an FFC):
+
+    agc = AGC(640, 512, gamma=0.8)
+    for frame in Capture("/dev/video0", 640, 514, "Y16 "):
+        gray = agc.process(frame.image)         # uint8, 512 x 640
+        kelvin = lut.toKelvin(frame.image)
+
+The parameters are the camera's AGC controls as floats, the driver's
+V4L2_CID_FLIR_AGC_* values divided by 1000. The work is done by Agc_64.so
+(make Agc_64.so in BosonSDKC/ClientFiles_C, copied next to this file).
+"""
+
+import ctypes
+import os
+
+import numpy as np
+
+AGC_BINS = 16384            # CLIENT_AGC_BINS
+
+
+class CLIENT_AGC_PARAMS(ctypes.Structure):
+    _fields_ = [("plateau", ctypes.c_float),
+                ("linearPercent", ctypes.c_float),
+                ("maxGain", ctypes.c_float),
+                ("gamma", ctypes.c_float),
+                ("outlierCut", ctypes.c_float),
+                ("d2br", ctypes.c_float),
+                ("damping", ctypes.c_float)]
+
+
+def loadKernels(dllPath=None):
+    '''Agc_64.so from dllPath or next to this file, None when missing.'''
+    loadpath = os.path.join(dllPath or os.path.dirname(__file__), "Agc_64.so")
+    try:
+        lib = ctypes.cdll.LoadLibrary(loadpath)
+    except OSError:
+        return None
+    params = ctypes.POINTER(CLIENT_AGC_PARAMS)
+    lib.CLIENT_agcDefaultParams.argtypes = [params]
+    lib.CLIENT_agcDefaultParams.restype = None
+    lib.CLIENT_agcCreate.argtypes = [ctypes.c_uint32, ctypes.c_uint32, params]
+    lib.CLIENT_agcCreate.restype = ctypes.c_void_p
+    lib.CLIENT_agcDestroy.argtypes = [ctypes.c_void_p]
+    lib.CLIENT_agcDestroy.restype = None
+    lib.CLIENT_agcSetParams.argtypes = [ctypes.c_void_p, params]
+    lib.CLIENT_agcSetParams.restype = None
+    lib.CLIENT_agcProcess.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint16), ctypes.c_uint32,
+                                      ctypes.c_uint32, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint8),
+                                      ctypes.c_uint32]
+    lib.CLIENT_agcProcess.restype = ctypes.c_int32
+    lib.CLIENT_agcLut.argtypes = [ctypes.c_void_p]
+    lib.CLIENT_agcLut.restype = ctypes.POINTER(ctypes.c_uint8)
+    return lib
+
+_KERNELS = loadKernels()
+
+
+class AGC:
+    '''Plateau-equalisation AGC state for frames of up to width x height.
+    Keyword arguments override the driver's defaults by field name.'''
+
+    def __init__(self, width, height, dllPath=None, **params):
+        self._agc = None
+        self._lib = _KERNELS if dllPath is None else loadKernels(dllPath)
+        if self._lib is None:
+            raise OSError("Agc_64.so not found; build it with make Agc_64.so in BosonSDKC/ClientFiles_C")
+        self.width = width
+        self.height = height
+        self._params = CLIENT_AGC_PARAMS()
+        self._lib.CLIENT_agcDefaultParams(ctypes.byref(self._params))
+        self._update(params)
+        self._agc = self._lib.CLIENT_agcCreate(width, height, ctypes.byref(self._params))
+        if not self._agc:
+            raise MemoryError("CLIENT_agcCreate({:d}, {:d}) failed".format(width, height))
+
+    def _update(self, params):
+        names = [name for name, _ in CLIENT_AGC_PARAMS._fields_]
+        for name, value in params.items():
+            if name not in names:
+                raise TypeError("unknown AGC parameter {!r}".format(name))
+            setattr(self._params, name, value)
+
+    @property
+    def params(self):
+        return {name: getattr(self._params, name) for name, _ in CLIENT_AGC_PARAMS._fields_}
+
+    def setParams(self, **params):
+        self._update(params)
+        self._lib.CLIENT_agcSetParams(self._agc, ctypes.byref(self._params))
+
+    def setControls(self, controls):
+        '''The driver's milli-unit values, e.g. {"gamma": 900, "d2br": 1300}.'''
+        self.setParams(**{name: value / 1000.0 for name, value in controls.items()})
+
+    def process(self, counts, out=None):
+        '''uint8 image of a 2-D uint16 block of counts; rows may be strided,
+        as frame.image of v4l2_capture is.'''
+        counts = np.asanyarray(counts)
+        if counts.dtype != np.uint16 or counts.ndim != 2 or counts.strides[1] != 2 or counts.strides[0] % 2 \
+                or counts.strides[0] < 0:
+            counts = np.ascontiguousarray(counts, dtype=np.uint16)
+        height, width = counts.shape
+        if out is None:
+            out = np.empty((height, width), np.uint8)
+        if out.shape != counts.shape or out.dtype != np.uint8 or out.strides[1] != 1 or out.strides[0] < 0:
+            raise ValueError("out must be a uint8 array of shape {}".format(counts.shape))
+        if self._lib.CLIENT_agcProcess(self._agc, counts.ctypes.data_as(ctypes.POINTER(ctypes.c_uint16)),
+                                       counts.strides[0] // 2, width, height,
+                                       out.ctypes.data_as(ctypes.POINTER(ctypes.c_uint8)), out.strides[0]) < 0:
+            raise ValueError("a {:d}x{:d} frame is larger than this AGC's {:d}x{:d}".format(
+                width, height, self.width, self.height))
+        return out
+
+    @property
+    def lut(self):
+        '''The last frame's counts-to-8-bit table, AGC_BINS entries (a copy).'''
+        return np.ctypeslib.as_array(self._lib.CLIENT_agcLut(self._agc), (AGC_BINS,)).copy()
+
+    def close(self):
+        if self._agc:
+            self._lib.CLIENT_agcDestroy(self._agc)
+            self._agc = None
+
+    def __del__(self):
+        self.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
@@ -0,0 +1,359 @@
+#!/usr/bin/env python3
+"""
+boson-ctl - one long-running owner of a Boson connection, shared over a Unix socket
+
+    boson-ctl serve -p 1                        # I2C bus 1, smbus
+    boson-ctl serve --device /dev/v4l-subdev2   # through the flir_boson driver's ioctl
+    boson-ctl info -p 1
+    boson-ctl call -p 1 colorLutGetId
+    boson-ctl call -p 1 colorLutSetId FLR_COLORLUT_IRONBOW
+
+The daemon opens the camera once and runs the requests of all its clients one
+after the other, so tools neither collide on the bus nor pay the SDK import,
+port open and FSLP resync on every run. Read-mostly values (serial and part
+numbers, software revision) are read from the camera once; a getter asked for
+again within one round of requests, with no other command in between, is
+answered from the first read.
+
+Scripts call openCamera(), which connects to the daemon serving that camera
+when there is one and opens a pyClient of their own otherwise; either way the
+methods and return values are pyClient's.
+
+Wire format: one JSON object per line each way, {"calls": [[name, [args]], ...]}
+answered by {"results": [...]}. Enums, structs, tuples and bytes are tagged
+objects, see encode().
+"""
+
+import argparse
+import json
+import os
+import re
+import selectors
+import signal
+import socket
+import sys
+import tempfile
+from functools import partial
+
+# Read from the camera once per daemon
+CACHED_CALLS = frozenset((
+    "bosonGetCameraSN",
+    "bosonGetCameraPN",
+    "bosonGetSensorSN",
+    "bosonGetSensorPN",
+    "bosonGetSoftwareRev",
+    "bosonGetSensorHostCalVersion",
+))
+# <group>Get<Name>: no side effects, may be shared within a round
+GETTER = re.compile(r"^[a-z][A-Za-z0-9]*Get[A-Z0-9]")
+
+CLIENT_TIMEOUT = 5.0    # seconds a client may take to read its reply
+MAX_REQUEST = 1 << 20
+
+
+def socketPath(camera):
+    '''Default socket for a camera: its I2C bus number or subdev node.'''
+    if "BOSON_CTL_SOCKET" in os.environ:
+        return os.environ["BOSON_CTL_SOCKET"]
+    return os.path.join(tempfile.gettempdir(), "boson-ctl-{}.sock".format(os.path.basename(str(camera))))
+
+
+def encode(value):
+    '''JSON-able form of a pyClient argument or result.'''
+    from enum import Enum
+    if isinstance(value, Enum):
+        return {"__enum__": type(value).__name__, "value": value.value}
+    if isinstance(value, tuple):
+        return {"__tuple__": [encode(item) for item in value]}
+    if isinstance(value, list):
+        return [encode(item) for item in value]
+    if isinstance(value, (bytes, bytearray)):
+        return {"__bytes__": bytes(value).hex()}
+    if hasattr(value, "getPackSize"):
+        # Serializer_Struct types
+        return {"__struct__": type(value).__name__, "fields": {name: encode(item) for name, item in vars(value).items()}}
+    return value
+
+
+def decode(value):
+    if isinstance(value, list):
+        return [decode(item) for item in value]
+    if not isinstance(value, dict):
+        return value
+    if "__enum__" in value:
+        if value["__enum__"] == "FLR_RESULT":
+            from BosonSDK.ClientFiles_Python.ReturnCodes import FLR_RESULT
+            return FLR_RESULT(value["value"])
+        from BosonSDK import EE
+        return getattr(EE, value["__enum__"])(value["value"])
+    if "__tuple__" in value:
+        return tuple(decode(item) for item in value["__tuple__"])
+    if "__bytes__" in value:
+        return bytearray.fromhex(value["__bytes__"])
+    if "__struct__" in value:
+        from BosonSDK import SS
+        struct = getattr(SS, value["__struct__"])()
+        for name, item in value["fields"].items():
+            setattr(struct, name, decode(item))
+        return struct
+    if "__error__" in value:
+        raise RuntimeError(value["__error__"])
+    return value
+
+
+def succeeded(result):
+    first = result[0] if isinstance(result, tuple) else result
+    return getattr(first, "value", None) == 0
+
+
+class CtlClient():
+    '''pyClient stand-in that sends every call to a boson-ctl daemon.'''
+
+    def __init__(self, path, ex=False):
+        self.ex = ex
+        self.sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            self.sock.connect(path)
+        except OSError:
+            self.sock.close()
+            raise
+        self.reader = self.sock.makefile("rb")
+
+    def batch(self, calls):
+        '''Run [(name, args), ...] back to back; returns their results.
+        Raises RuntimeError for a call the daemon could not run.'''
+        request = {"calls": [[name, [encode(arg) for arg in args]] for name, args in calls]}
+        self.sock.sendall(json.dumps(request).encode() + b"\n")
+        line = self.reader.readline()
+        if not line:
+            raise IOError("boson-ctl daemon closed the connection")
+        results = [decode(result) for result in json.loads(line)["results"]]
+        if self.ex:
+            from BosonSDK.ClientFiles_Python.Client_API import exception_wrapper
+            results = [exception_wrapper(lambda _self, result=result: result)(self) for result in results]
+        return results
+
+    def call(self, name, *args):
+        return self.batch([(name, args)])[0]
+
+    def __getattr__(self, name):
+        if name.startswith("_"):
+            raise AttributeError(name)
+        return partial(self.call, name)
+
+    def Close(self):
+        self.reader.close()
+        self.sock.close()
+
+
+def openCamera(port=1, device=None, path=None, ex=False, peripheralAddress=0x6a, I2C_TYPE="smbus"):
+    '''A CtlClient when a daemon serves this camera, a pyClient of our own otherwise.'''
+    try:
+        return CtlClient(path or socketPath(device or port), ex=ex)
+    except OSError:
+        pass
+    return openDirect(port, device, ex, peripheralAddress, I2C_TYPE)
+
+
+def openDirect(port, device, ex, peripheralAddress, I2C_TYPE):
+    from BosonSDK import CamAPI
+    if device:
+        from BosonSDK.CommunicationFiles.CommonFslp import CommonFslp, FSLP_TYPE_E
+        fslp = CommonFslp.getFslp(device, None, FSLP_TYPE_E.FSLP_KERNEL)
+        fslp.port.open()
+        return CamAPI.pyClient(fslp=fslp, ex=ex)
+    return CamAPI.pyClient(manualport=port, useI2C=True, peripheralAddress=peripheralAddress, I2C_TYPE=I2C_TYPE, ex=ex)
+
+
+class CtlDaemon():
+    def __init__(self, cam, path):
+        self.cam = cam
+        self.path = path
+        self.cache = {}
+        self.selector = selectors.DefaultSelector()
+        self.buffers = {}
+        self.running = True
+
+    def listen(self):
+        probe = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            probe.connect(self.path)
+            raise RuntimeError("a boson-ctl daemon already serves {}".format(self.path))
+        except (FileNotFoundError, ConnectionRefusedError):
+            if os.path.exists(self.path):
+                os.unlink(self.path)    # left by a daemon that died
+        finally:
+            probe.close()
+        self.server = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.server.bind(self.path)
+        os.chmod(self.path, 0o660)
+        self.server.listen(16)
+        self.selector.register(self.server, selectors.EVENT_READ)
+
+    def run(self, name, args, memo):
+        method = getattr(self.cam, name, None) if not name.startswith(("_", "CLIENT_")) and name != "Close" else None
+        if not callable(method):
+            return {"__error__": "no API call {!r}".format(name)}
+        key = (name, json.dumps(args))
+        if key in self.cache:
+            return self.cache[key]
+        if key in memo:
+            return memo[key]
+        if not GETTER.match(name):
+            memo.clear()
+        try:
+            response = method(*[decode(arg) for arg in args])
+        except Exception as e:
+            return {"__error__": "{}: {}".format(type(e).__name__, e)}
+        result = encode(response)
+        if succeeded(response):
+            if name in CACHED_CALLS:
+                self.cache[key] = result
+            elif GETTER.match(name):
+                memo[key] = result
+        return result
+
+    def serveRound(self, events):
+        # every complete request that arrived, run in arrival order
+        requests = []
+        for key, mask in events:
+            if key.fileobj is self.server:
+                conn, _ = self.server.accept()
+                conn.settimeout(CLIENT_TIMEOUT)
+                self.buffers[conn] = b""
+                self.selector.register(conn, selectors.EVENT_READ)
+                continue
+            conn = key.fileobj
+            try:
+                data = conn.recv(65536)
+            except OSError:
+                data = b""
+            if not data or len(self.buffers[conn]) + len(data) > MAX_REQUEST:
+                self.drop(conn)
+                continue
+            lines = (self.buffers[conn] + data).split(b"\n")
+            self.buffers[conn] = lines.pop()
+            requests += [(conn, line) for line in lines if line.strip()]
+
+        memo = {}
+        for conn, line in requests:
+            if conn not in self.buffers:
+                continue
+            try:
+                calls = json.loads(line)["calls"]
+                results = [self.run(name, args, memo) for name, args in calls]
+            except (ValueError, KeyError, TypeError) as e:
+                results = [{"__error__": "bad request: {}".format(e)}]
+            try:
+                conn.sendall(json.dumps({"results": results}).encode() + b"\n")
+            except OSError:
+                self.drop(conn)
+
+    def drop(self, conn):
+        self.selector.unregister(conn)
+        del self.buffers[conn]
+        conn.close()
+
+    def serve(self):
+        self.listen()
+        try:
+            while self.running:
+                self.serveRound(self.selector.select(timeout=1.0))
+        finally:
+            for conn in list(self.buffers):
+                self.drop(conn)
+            self.server.close()
+            os.unlink(self.path)
+
+    def stop(self, *args):
+        self.running = False
+
+
+def parseArg(text):
+    '''CLI argument: a Python literal, ENUM_E.MEMBER or a bare enum member name.'''
+    import ast
+    try:
+        return ast.literal_eval(text)
+    except (ValueError, SyntaxError):
+        pass
+    from BosonSDK import EE
+    enumName, _, member = text.rpartition(".")
+    if enumName:
+        return getattr(getattr(EE, enumName), member)
+    for name in dir(EE):
+        enum = getattr(EE, name)
+        if name.startswith("FLR_") and isinstance(enum, type) and member in getattr(enum, "__members__", {}):
+            return enum[member]
+    raise ValueError("{!r} is neither a literal nor an enum member".format(text))
+
+
+def plain(value):
+    '''Printable form of a result.'''
+    from enum import Enum
+    if isinstance(value, Enum):
+        return value.name
+    if isinstance(value, (tuple, list)):
+        return [plain(item) for item in value]
+    if isinstance(value, (bytes, bytearray)):
+        return bytes(value).hex()
+    if hasattr(value, "getPackSize"):
+        return {name: plain(item) for name, item in vars(value).items()}
+    return value
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Share one FLIR Boson connection between tools")
+    parser.add_argument("-p", "--port", type=int, default=1, help="I2C bus of the camera (default: 1)")
+    parser.add_argument("--device", help="talk through the flir_boson driver on this /dev/v4l-subdevN instead of the bus")
+    parser.add_argument("--socket", help="daemon socket (default: $BOSON_CTL_SOCKET or boson-ctl-<port>.sock in the temp directory)")
+    subparsers = parser.add_subparsers(dest="action", required=True)
+
+    serve_parser = subparsers.add_parser("serve", help="run the daemon")
+    serve_parser.add_argument("--address", type=lambda text: int(text, 0), default=0x6a, help="I2C address (default: 0x6a)")
+    serve_parser.add_argument("--i2c-type", default="smbus", help="I2C_TYPE of the pyClient (default: smbus)")
+
+    call_parser = subparsers.add_parser("call", help="run one SDK call, e.g. colorLutSetId FLR_COLORLUT_IRONBOW")
+    call_parser.add_argument("name")
+    call_parser.add_argument("args", nargs="*")
+
+    subparsers.add_parser("info", help="serial and part numbers, software revision")
+
+    args = parser.parse_args()
+    path = args.socket or socketPath(args.device or args.port)
+
+    if args.action == "serve":
+        cam = openDirect(args.port, args.device, False, args.address, args.i2c_type)
+        daemon = CtlDaemon(cam, path)
+        signal.signal(signal.SIGTERM, daemon.stop)
+        signal.signal(signal.SIGINT, daemon.stop)
+        try:
+            daemon.serve()
+        finally:
+            cam.Close()
+        return 0
+
+    cam = openCamera(args.port, args.device, path)
+    try:
+        if args.action == "call":
+            print(json.dumps(plain(getattr(cam, args.name)(*[parseArg(arg) for arg in args.args]))))
+        else:
+            names = ("bosonGetCameraSN", "bosonGetSensorSN", "bosonGetCameraPN", "bosonGetSoftwareRev")
+            if isinstance(cam, CtlClient):
+                results = cam.batch([(name, ()) for name in names])
+            else:
+                results = [getattr(cam, name)() for name in names]
+            (_, cam_sernum), (_, sensor_sernum), (_, partnum), rev = results
+            print("Camera SN:    {}".format(hex(cam_sernum) if cam_sernum is not None else None))
+            print("Sensor SN:    {}".format(hex(sensor_sernum) if sensor_sernum is not None else None))
+            print("Part number:  {}".format("".join(chr(char) for char in partnum.value if char) if partnum else None))
+            print("Software rev: {}".format(".".join(str(part) for part in rev[1:]) if succeeded(rev) else rev[0]))
+    except (RuntimeError, ValueError, AttributeError) as e:
+        print("boson-ctl: {}".format(e), file=sys.stderr)
+        return 1
+    finally:
+        cam.Close()
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
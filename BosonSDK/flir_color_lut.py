@@ -5,7 +5,7 @@ import sys
 import argparse
 import traceback
 
-from BosonSDK import CamAPI
+from BosonSDK.boson_ctl import openCamera
 from BosonSDK.ClientFiles_Python import EnumTypes
 
 # LUT name to ID mapping
@@ -28,7 +28,7 @@ lut_names = {
 def set_color_lut(lut_id, port=1):
     """Set color lookup table for thermal imaging"""
 
-    cam = CamAPI.pyClient(manualport=port, useI2C=True, peripheralAddress=0x6a, I2C_TYPE="smbus")
+    cam = openCamera(port)
 
     try:
         # Convert string input to enum value
@@ -61,7 +61,7 @@ def set_color_lut(lut_id, port=1):
 
 def get_color_lut(port=1):
     """Get current color lookup table setting"""
-    cam = CamAPI.pyClient(manualport=port, useI2C=True, peripheralAddress=0x6a, I2C_TYPE="smbus")
+    cam = openCamera(port)
 
     try:
         ret, current_lut = cam.colorLutGetId()
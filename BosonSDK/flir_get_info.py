@@ -1,7 +1,7 @@
 #!/usr/bin/env python3
 import os
 import argparse
-from BosonSDK import CamAPI
+from BosonSDK.boson_ctl import openCamera
 
 def main():
     """Get FLIR Boson camera information including serial numbers and part number"""
@@ -9,7 +9,7 @@ def main():
     parser.add_argument('--port', '-p', type=int, default=1, help='I2C port number (default: 1)')
     args = parser.parse_args()
 
-    myCam = CamAPI.pyClient(manualport=args.port, useI2C=True, peripheralAddress=0x6a, I2C_TYPE="smbus")
+    myCam = openCamera(args.port)
 
     try:
         # myCam.fslp.port.read(100)
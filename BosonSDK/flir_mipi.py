@@ -5,7 +5,8 @@ import sys
 import time
 import argparse
 from functools import wraps
-from BosonSDK import EE, CamAPI, FLR_RESULT
+from BosonSDK import EE, FLR_RESULT
+from BosonSDK.boson_ctl import openCamera
 import traceback
 
 
@@ -29,9 +30,7 @@ def timing_wrapper(func_name):
 
 def start_mipi(pad=1):
     """Start MIPI streaming with YUV 4:2:2 configuration"""
-    cam = CamAPI.pyClient(
-        manualport=pad, useI2C=True, peripheralAddress=0x6A, I2C_TYPE="smbus"
-    )
+    cam = openCamera(pad)
     try:
         # Execute MIPI startup sequence
 
@@ -74,9 +73,7 @@ def start_mipi(pad=1):
 
 def stop_mipi(pad=1):
     """Stop MIPI streaming"""
-    cam = CamAPI.pyClient(
-        manualport=pad, useI2C=True, peripheralAddress=0x6A, I2C_TYPE="smbus"
-    )
+    cam = openCamera(pad)
 
     try:
         cam.dvoSetMipiStartState(EE.FLR_DVO_MIPI_STATE_E.FLR_DVO_MIPI_STATE_OFF)
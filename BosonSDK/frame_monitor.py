@@ -0,0 +1,160 @@
+"""
+Frame drop, duplicate, jitter and latency accounting from the telemetry line.
+
+The camera numbers its frames (frameCounter) and stamps them (frameTimestamp,
+ms since power-up) before they leave it; V4L2 numbers and stamps the buffers
+as they complete. Comparing the two per frame tells where frames go missing
+and how old they are:
+
+    monitor = FrameMonitor()
+    for frame in Capture("/dev/video0", 640, 514, "Y16 "):
+        tel = TelemetryLines(frame.telemetry[0])
+        monitor.update(frame.sequence, frame.timestamp, int(tel.frameCounter), int(tel.frameTimestamp))
+        if monitor.due(1.0):
+            print(monitor.report())
+
+    cameraDrops     frameCounter gaps: lost anywhere between sensor and here
+    pipelineDrops   V4L2 sequence gaps: lost by the receiver / driver
+    duplicates      a frameCounter seen again (repeated or stale buffers)
+    jitter          V4L2 frame interval minus the camera's, in ms
+    latency         buffer timestamp to update(), in ms: the wait in the queue
+    age             now to the camera timestamp, in ms, less the smallest seen
+                    so far, as the two clocks are unrelated: extra age over the
+                    quickest frame
+
+Timestamps are time.monotonic() seconds, which is what V4L2 (vb2) stamps
+buffers with.
+"""
+
+import bisect
+import math
+import time
+
+COUNTER_MOD = 1 << 32       # frameCounter and frameTimestamp are 32-bit
+LATENCY_EDGES_MS = (1, 2, 5, 10, 16, 20, 33, 50, 67, 100, 200, 500)
+JITTER_EDGES_MS = (-20, -10, -5, -2, -1, 1, 2, 5, 10, 20)
+
+
+class Histogram:
+    '''Counts of values within fixed edges, plus running min/max/mean/std.
+    counts[0] is below edges[0], counts[-1] at or above edges[-1].'''
+
+    def __init__(self, edges):
+        self.edges = tuple(edges)
+        self.reset()
+
+    def reset(self):
+        self.counts = [0] * (len(self.edges) + 1)
+        self.n = 0
+        self.mean = 0.0
+        self._m2 = 0.0
+        self.min = math.inf
+        self.max = -math.inf
+
+    def add(self, value):
+        self.counts[bisect.bisect_right(self.edges, value)] += 1
+        self.n += 1
+        delta = value - self.mean
+        self.mean += delta / self.n
+        self._m2 += delta * (value - self.mean)
+        self.min = min(self.min, value)
+        self.max = max(self.max, value)
+
+    @property
+    def std(self):
+        return math.sqrt(self._m2 / self.n) if self.n else 0.0
+
+    def percentile(self, p):
+        '''Upper edge of the bin holding the p-th percentile (max for the last).'''
+        if not self.n:
+            return None
+        target, seen = p / 100.0 * self.n, 0
+        for i, count in enumerate(self.counts):
+            seen += count
+            if seen >= target and count:
+                return self.edges[i] if i < len(self.edges) else self.max
+        return self.max
+
+    def snapshot(self):
+        return {"n": self.n, "min": self.min if self.n else None, "max": self.max if self.n else None,
+                "mean": round(self.mean, 3), "std": round(self.std, 3), "p50": self.percentile(50),
+                "p99": self.percentile(99), "edges": list(self.edges), "counts": list(self.counts)}
+
+
+class FrameMonitor:
+    '''Feed update() once per frame; counters accumulate until reset().
+    counterStep is how far frameCounter moves per delivered frame (2 when
+    the camera runs at twice the output rate).'''
+
+    def __init__(self, counterStep=1, latencyEdgesMs=LATENCY_EDGES_MS, jitterEdgesMs=JITTER_EDGES_MS):
+        self.counterStep = counterStep
+        self.latency = Histogram(latencyEdgesMs)
+        self.age = Histogram(latencyEdgesMs)
+        self.jitter = Histogram(jitterEdgesMs)
+        self._last = None           # (sequence, timestamp, frameCounter, frameTimestampMs)
+        self._minOffset = None      # smallest now - camera timestamp, seconds
+        self._reported = time.monotonic()
+        self.reset()
+
+    def reset(self):
+        '''Zero the counters and histograms; the previous frame is kept, so
+        nothing is counted twice or missed across a reset.'''
+        self.frames = 0
+        self.cameraDrops = 0
+        self.pipelineDrops = 0
+        self.duplicates = 0
+        self.latency.reset()
+        self.age.reset()
+        self.jitter.reset()
+        self.started = time.monotonic()
+
+    def update(self, sequence, timestamp, frameCounter, frameTimestampMs, now=None):
+        now = time.monotonic() if now is None else now
+        self.frames += 1
+        self.latency.add((now - timestamp) * 1e3)
+
+        offset = now - frameTimestampMs / 1e3
+        if self._minOffset is None or offset < self._minOffset:
+            self._minOffset = offset
+        self.age.add((offset - self._minOffset) * 1e3)
+
+        if self._last is not None:
+            lastSequence, lastTimestamp, lastCounter, lastCameraMs = self._last
+            step = (frameCounter - lastCounter) % COUNTER_MOD
+            if step == 0:
+                self.duplicates += 1
+            else:
+                self.cameraDrops += max(0, step // self.counterStep - 1)
+                self.pipelineDrops += max(0, sequence - lastSequence - 1)
+                cameraInterval = ((frameTimestampMs - lastCameraMs) % COUNTER_MOD) / 1e3
+                self.jitter.add((timestamp - lastTimestamp - cameraInterval) * 1e3)
+        self._last = (sequence, timestamp, frameCounter, frameTimestampMs)
+
+    def due(self, interval):
+        '''True once every interval seconds, for periodic reports.'''
+        now = time.monotonic()
+        if now - self._reported < interval:
+            return False
+        self._reported = now
+        return True
+
+    @property
+    def fps(self):
+        elapsed = time.monotonic() - self.started
+        return self.frames / elapsed if elapsed > 0 else 0.0
+
+    def snapshot(self):
+        '''Everything as a JSON-ready dict.'''
+        return {"frames": self.frames, "fps": round(self.fps, 2), "cameraDrops": self.cameraDrops,
+                "pipelineDrops": self.pipelineDrops, "duplicates": self.duplicates,
+                "latencyMs": self.latency.snapshot(), "ageMs": self.age.snapshot(),
+                "jitterMs": self.jitter.snapshot()}
+
+    def report(self):
+        '''One line for a console.'''
+        return ("{:d} frames {:.1f} fps, dropped {:d} camera / {:d} pipeline, {:d} duplicate, "
+                "latency p50 {} p99 {} max {:.1f} ms, age p99 {} ms, jitter std {:.2f} max {:.2f} ms").format(
+                    self.frames, self.fps, self.cameraDrops, self.pipelineDrops, self.duplicates,
+                    self.latency.percentile(50), self.latency.percentile(99), max(self.latency.max, 0.0),
+                    self.age.percentile(99), self.jitter.std,
+                    max(abs(self.jitter.min), abs(self.jitter.max)) if self.jitter.n else 0.0)
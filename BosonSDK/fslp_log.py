@@ -0,0 +1,210 @@
+"""
+Binary log of FSLP traffic: every command and response frame, timestamped.
+
+A log is the same for every source: the C SDK (CLIENT_fslpLogOpen(), see
+ClientFiles_C/Client_FslpLog.h), the Python SDK and the flir_boson driver's
+tracepoints after fromTrace(). Setting BOSON_FSLP_LOG=path logs every
+transport CommonFslp.getFslp() makes, so existing scripts need no change:
+
+    BOSON_FSLP_LOG=/tmp/session.fslog python3 flir_get_info.py
+    python3 -m BosonSDK.fslp_log dump /tmp/session.fslog
+
+Little-endian, a 16-byte file header then one record per frame:
+
+    file header     "FSLPLOG\\0", u16 version, u16 header bytes, u32 flags
+    record          u64 timestamp (ns, CLOCK_MONOTONIC or the trace clock),
+                    u32 sequence, u32 fn_id, u32 status (0xFFFFFFFF in a
+                    command, as on the wire), u16 data bytes, u8 direction
+                    (0 command, 1 response), u8 channel, the data
+
+The data is what follows the 12-byte sequence/fn_id/status header of the
+frame. Records are appended with one write each, so several processes can
+log to one file. flir_test/fslp_replay.py plays a log back against a
+transport.
+"""
+
+import collections
+import os
+import re
+import struct
+import sys
+import time
+
+MAGIC = b"FSLPLOG\0"
+VERSION = 1
+FILE_HEADER = struct.Struct("<8sHHI")
+RECORD_HEADER = struct.Struct("<QIIIHBB")
+FRAME_HEADER = struct.Struct(">III")        # sequence, fn_id, status of an FSLP payload
+COMMAND, RESPONSE = 0, 1
+COMMAND_CHANNEL = 0x00
+NO_STATUS = 0xFFFFFFFF
+
+FslpRecord = collections.namedtuple("FslpRecord", "timestampNs direction channel sequence fnId status data")
+
+
+class FslpLogWriter:
+    '''Appends records to path, writing the file header when it is new.'''
+
+    def __init__(self, path):
+        self.f = open(path, "ab", buffering=0)
+        if self.f.tell() == 0:
+            self.f.write(FILE_HEADER.pack(MAGIC, VERSION, FILE_HEADER.size, 0))
+        else:
+            with open(path, "rb") as f:
+                _checkHeader(f.read(FILE_HEADER.size), path)
+
+    def write(self, direction, sequence, fnId, status, data=b"", channel=COMMAND_CHANNEL, timestampNs=None):
+        data = bytes(data)
+        stamp = time.monotonic_ns() if timestampNs is None else timestampNs
+        self.f.write(RECORD_HEADER.pack(stamp, sequence, fnId, status, len(data), direction, channel) + data)
+
+    def frame(self, direction, payload, channel=COMMAND_CHANNEL, timestampNs=None):
+        '''One FSLP payload as sent or received: 12-byte header, then data.
+        Shorter payloads (timeouts, idle reads) are not logged.'''
+        if len(payload) < FRAME_HEADER.size:
+            return
+        sequence, fnId, status = FRAME_HEADER.unpack_from(payload)
+        self.write(direction, sequence, fnId, status, payload[FRAME_HEADER.size:], channel, timestampNs)
+
+    def close(self):
+        if not self.f.closed:
+            self.f.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+def _checkHeader(raw, path):
+    if len(raw) < FILE_HEADER.size:
+        raise ValueError("{} is not an FSLP log: too short".format(path))
+    magic, version, headerBytes, _ = FILE_HEADER.unpack(raw)
+    if magic != MAGIC or version != VERSION:
+        raise ValueError("{} is not a version {:d} FSLP log".format(path, VERSION))
+    return headerBytes
+
+
+def readLog(path):
+    '''The records of path, in file order; a partial last record is skipped.'''
+    with open(path, "rb") as f:
+        f.seek(_checkHeader(f.read(FILE_HEADER.size), path))
+        while True:
+            raw = f.read(RECORD_HEADER.size)
+            if len(raw) < RECORD_HEADER.size:
+                return
+            stamp, sequence, fnId, status, length, direction, channel = RECORD_HEADER.unpack(raw)
+            data = f.read(length)
+            if len(data) < length:
+                return
+            yield FslpRecord(stamp, direction, channel, sequence, fnId, status, data)
+
+
+def exchanges(records):
+    '''(command, response or None) pairs, matched on sequence and fn_id.'''
+    pending = collections.OrderedDict()
+    for record in records:
+        key = (record.sequence, record.fnId)
+        if record.direction == COMMAND:
+            if key in pending:
+                yield pending.pop(key), None
+            pending[key] = record
+        elif key in pending:
+            yield pending.pop(key), record
+    for command in pending.values():
+        yield command, None
+
+
+class LoggedFslp:
+    '''An FSLP transport that logs every frame it sends and reads; anything
+    else is the wrapped transport's.'''
+
+    def __init__(self, fslp, writer):
+        self.fslp = fslp
+        self.writer = writer
+        if hasattr(fslp, "batch"):
+            self.batch = self._batch
+
+    def sendFrame(self, channelID, data, dataSize):
+        self.writer.frame(COMMAND, bytes(data[:dataSize]), channelID)
+        return self.fslp.sendFrame(channelID, data, dataSize)
+
+    def readFrame(self, channelID, expectedReceiveBytes):
+        payload = self.fslp.readFrame(channelID, expectedReceiveBytes)
+        self.writer.frame(RESPONSE, bytes(payload), channelID)
+        return payload
+
+    def _batch(self, commands):
+        # KernelFslp's vector ioctl; the driver numbers these commands itself
+        for fnId, sendData, _ in commands:
+            self.writer.write(COMMAND, 0, fnId, NO_STATUS, sendData)
+        results = self.fslp.batch(commands)
+        for (fnId, _, _), (status, data) in zip(commands, results):
+            self.writer.write(RESPONSE, 0, fnId, status, data)
+        return results
+
+    def __getattr__(self, name):
+        return getattr(self.fslp, name)
+
+
+def wrapFromEnv(fslp):
+    '''fslp, logged to $BOSON_FSLP_LOG when that is set.'''
+    path = os.environ.get("BOSON_FSLP_LOG")
+    return LoggedFslp(fslp, FslpLogWriter(path)) if path else fslp
+
+
+TRACE_LINE = re.compile(r"\s(\d+\.\d+):\s+flir_fslp_(send_frame|read_payload):\s+(i2c-\S+)\s+len=(\d+)"
+                        r"(?:\s+ret=(-?\d+))?\s+payload=(.*)$")
+
+
+def fromTrace(lines, writer, camera=None):
+    '''Log the flir_fslp_send_frame and flir_fslp_read_payload events of a
+    trace (/sys/kernel/tracing/trace or trace-cmd report output); camera,
+    e.g. "i2c-2-006a", keeps one camera's. Returns the frames logged.'''
+    count = 0
+    for line in lines:
+        match = TRACE_LINE.search(line)
+        if match is None:
+            continue
+        seconds, event, who, length, ret, hexData = match.groups()
+        if (camera and who != camera) or (ret is not None and int(ret) != 0):
+            continue
+        payload = bytes.fromhex(re.sub(r"[^0-9a-fA-F]", "", hexData))[:int(length)]
+        writer.frame(COMMAND if event == "send_frame" else RESPONSE, payload,
+                     timestampNs=int(round(float(seconds) * 1e9)))
+        count += 1
+    return count
+
+
+def dump(path, out=sys.stdout):
+    first = None
+    for record in readLog(path):
+        first = record.timestampNs if first is None else first
+        print("{:12.6f} {} seq=0x{:08X} fn=0x{:08X} status=0x{:08X} len={:d} {}".format(
+            (record.timestampNs - first) / 1e9, "->" if record.direction == COMMAND else "<-", record.sequence,
+            record.fnId, record.status, len(record.data), record.data.hex()), file=out)
+
+
+def main():
+    import argparse
+
+    parser = argparse.ArgumentParser(description="FSLP traffic logs")
+    sub = parser.add_subparsers(dest="command", required=True)
+    sub.add_parser("dump", help="print a log").add_argument("log")
+    trace = sub.add_parser("from-trace", help="log the flir_boson tracepoints of a trace")
+    trace.add_argument("trace", help="trace text, - for stdin")
+    trace.add_argument("log")
+    trace.add_argument("--camera", help="only this camera, e.g. i2c-2-006a")
+    args = parser.parse_args()
+
+    if args.command == "dump":
+        dump(args.log)
+    else:
+        source = sys.stdin if args.trace == "-" else open(args.trace)
+        with source, FslpLogWriter(args.log) as writer:
+            print("{:d} frames".format(fromTrace(source, writer, args.camera)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+"""
+Response cache for getters whose value does not change while connected.
+
+The Python side of ClientFiles_C/Client_GetterCache.h. Attached to a
+transport, CLIENT_dispatch() answers the cached getters from their first
+successful response, so status screens and scripts that ask for the serial
+number on every refresh stop costing a round trip:
+
+    cam = pyClient(manualport="/dev/ttyACM0", useDll=False)
+    cache = enableGetterCache(cam)
+    cam.bosonGetCameraSN()          # sent
+    cam.bosonGetCameraSN()          # from the cache
+    print(cache.hits, cache.misses)
+
+Sending bosonReboot or bosonRestoreFactoryDefaultsFromFlash drops every
+kept response, a command with data in a clearOnModuleSet getter's module
+drops that getter (DVO_GETCLOCKINFO and the dvo setters), and
+pyClient.reopenComm() drops all. flush() after anything else that changes
+the camera: a power cycle, another host. The asyncio client
+(Client_Async) is not cached.
+"""
+
+MAX_DATA = 64                   # larger responses are never kept
+
+# FunctionCodes, as in Client_GetterCache.c
+BOSON_GETCAMERASN = 0x00050002
+BOSON_GETCAMERAPN = 0x00050004
+BOSON_GETSENSORSN = 0x00050006
+BOSON_REBOOT = 0x00050010
+BOSON_RESTOREFACTORYDEFAULTSFROMFLASH = 0x0005001B
+BOSON_GETSOFTWAREREV = 0x00050022
+BOSON_GETSENSORPN = 0x0005003F
+DVO_GETCLOCKINFO = 0x00060019
+SYSINFO_GETPRODUCTNAME = 0x002F0003
+SYSINFO_GETCAMERASN = 0x002F0005
+
+# fnID -> clearOnModuleSet: fixed for the life of the camera, but for the
+# clock info, which follows the dvo settings
+DEFAULT_GETTERS = {BOSON_GETCAMERASN: False, BOSON_GETCAMERAPN: False, BOSON_GETSENSORSN: False,
+                   BOSON_GETSENSORPN: False, BOSON_GETSOFTWAREREV: False, SYSINFO_GETCAMERASN: False,
+                   SYSINFO_GETPRODUCTNAME: False, DVO_GETCLOCKINFO: True}
+RESETS = (BOSON_REBOOT, BOSON_RESTOREFACTORYDEFAULTSFROMFLASH)
+
+
+class GetterCache:
+    '''Kept responses of a declared set of getters, for one connection.'''
+
+    def __init__(self, getters=DEFAULT_GETTERS):
+        self.getters = dict(getters)
+        self.responses = {}
+        self.hits = 0
+        self.misses = 0
+
+    def add(self, fnId, clearOnModuleSet=False):
+        self.getters[fnId] = clearOnModuleSet
+
+    def flush(self):
+        self.responses.clear()
+
+    def lookup(self, fnId, sendBytes):
+        '''The kept response data of fnId, None when it must be sent.'''
+        if sendBytes or fnId not in self.getters:
+            return None
+        data = self.responses.get(fnId)
+        if data is None:
+            self.misses += 1
+            return None
+        self.hits += 1
+        return bytearray(data)
+
+    def store(self, fnId, sendBytes, returnCode, receiveData):
+        '''After fnId went out; returnCode and receiveData as CLIENT_dispatch returns them.'''
+        # whether or not it answered, the camera may be starting over
+        if fnId in RESETS:
+            self.flush()
+        elif sendBytes:
+            module = fnId >> 16
+            for getter, clearOnModuleSet in self.getters.items():
+                if clearOnModuleSet and getter >> 16 == module:
+                    self.responses.pop(getter, None)
+        elif fnId in self.getters and not returnCode.value and len(receiveData) <= MAX_DATA:
+            self.responses[fnId] = bytes(receiveData)
+
+
+def enableGetterCache(target, getters=DEFAULT_GETTERS):
+    '''Cache on target, a pyClient or an FSLP transport; returns the cache
+    (the one already attached, if any).'''
+    fslp = getattr(target, "fslp", target)
+    cache = getattr(fslp, "getterCache", None)
+    if cache is None:
+        cache = GetterCache(getters)
+        fslp.getterCache = cache
+    return cache
+
+
+def disableGetterCache(target):
+    fslp = getattr(target, "fslp", target)
+    if getattr(fslp, "getterCache", None) is not None:
+        fslp.getterCache = None
@@ -0,0 +1,271 @@
+"""
+Find Boson cameras through the media controller, without opening a video node.
+
+Every /dev/mediaN describes its pipeline in one MEDIA_IOC_G_TOPOLOGY call:
+the flir_boson sensor entity, the CSI receiver and ISI entities after it and
+the device nodes of each. Following the sensor's enabled data links to the
+first V4L2 I/O entity gives the video node its frames reach; the I2C client
+behind the subdev node's sysfs device gives the bus and address; the current
+format is read from the subdev with VIDIOC_SUBDEV_G_FMT, which the driver
+answers from its format snapshot without talking to the camera:
+
+    for boson in findBosons():
+        print(boson.video, boson.subdev, boson.i2cBus, boson.format)
+        # /dev/video1 /dev/v4l-subdev2 2 {'width': 640, 'height': 514, 'code': 0x202d, 'name': 'RAW14'}
+
+Nothing is probed, so this takes milliseconds however many ISI nodes the
+board has.
+"""
+
+import ctypes
+import fcntl
+import glob
+import os
+
+ENTITY_NAME = "flir_boson"
+
+MEDIA_ENT_F_IO_V4L = 0x00010001
+MEDIA_INTF_T_V4L_VIDEO = 0x00000200
+MEDIA_INTF_T_V4L_SUBDEV = 0x00000203
+MEDIA_PAD_FL_SOURCE = 0x2
+MEDIA_LNK_FL_ENABLED = 0x1
+MEDIA_LNK_FL_LINK_TYPE = 0xf << 28
+MEDIA_LNK_FL_DATA_LINK = 0 << 28
+MEDIA_LNK_FL_INTERFACE_LINK = 1 << 28
+
+V4L2_SUBDEV_FORMAT_ACTIVE = 1
+
+# media bus code -> flir_boson format name (flir-boson-core.c)
+BUS_FORMATS = {
+    0x200f: "UYVY",     # MEDIA_BUS_FMT_UYVY8_1X16
+    0x202d: "RAW14",    # MEDIA_BUS_FMT_Y14_1X14
+    0x2001: "RAW8",     # MEDIA_BUS_FMT_Y8_1X8
+}
+
+
+class media_v2_topology(ctypes.Structure):
+    _fields_ = [("topology_version", ctypes.c_uint64),
+                ("num_entities", ctypes.c_uint32), ("reserved1", ctypes.c_uint32),
+                ("ptr_entities", ctypes.c_uint64),
+                ("num_interfaces", ctypes.c_uint32), ("reserved2", ctypes.c_uint32),
+                ("ptr_interfaces", ctypes.c_uint64),
+                ("num_pads", ctypes.c_uint32), ("reserved3", ctypes.c_uint32),
+                ("ptr_pads", ctypes.c_uint64),
+                ("num_links", ctypes.c_uint32), ("reserved4", ctypes.c_uint32),
+                ("ptr_links", ctypes.c_uint64)]
+
+
+class media_v2_entity(ctypes.Structure):
+    _fields_ = [("id", ctypes.c_uint32),
+                ("name", ctypes.c_char * 64),
+                ("function", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 5)]
+
+
+class media_v2_intf_devnode(ctypes.Structure):
+    _fields_ = [("major", ctypes.c_uint32), ("minor", ctypes.c_uint32)]
+
+
+class media_v2_interface_u(ctypes.Union):
+    _fields_ = [("devnode", media_v2_intf_devnode), ("raw", ctypes.c_uint32 * 16)]
+
+
+class media_v2_interface(ctypes.Structure):
+    _fields_ = [("id", ctypes.c_uint32),
+                ("intf_type", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 9),
+                ("u", media_v2_interface_u)]
+
+
+class media_v2_pad(ctypes.Structure):
+    _fields_ = [("id", ctypes.c_uint32),
+                ("entity_id", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("index", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 4)]
+
+
+class media_v2_link(ctypes.Structure):
+    _fields_ = [("id", ctypes.c_uint32),
+                ("source_id", ctypes.c_uint32),
+                ("sink_id", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 6)]
+
+
+class v4l2_mbus_framefmt(ctypes.Structure):
+    _fields_ = [("width", ctypes.c_uint32),
+                ("height", ctypes.c_uint32),
+                ("code", ctypes.c_uint32),
+                ("field", ctypes.c_uint32),
+                ("colorspace", ctypes.c_uint32),
+                ("ycbcr_enc", ctypes.c_uint16),
+                ("quantization", ctypes.c_uint16),
+                ("xfer_func", ctypes.c_uint16),
+                ("flags", ctypes.c_uint16),
+                ("reserved", ctypes.c_uint16 * 10)]
+
+
+class v4l2_subdev_format(ctypes.Structure):
+    _fields_ = [("which", ctypes.c_uint32),
+                ("pad", ctypes.c_uint32),
+                ("format", v4l2_mbus_framefmt),
+                ("stream", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 7)]
+
+
+def _IOWR(type, nr, struct):
+    return (3 << 30) | (ctypes.sizeof(struct) << 16) | (ord(type) << 8) | nr
+
+MEDIA_IOC_G_TOPOLOGY = _IOWR('|', 4, media_v2_topology)
+VIDIOC_SUBDEV_G_FMT = _IOWR('V', 4, v4l2_subdev_format)
+
+
+class Topology:
+    '''One media device's entities, interfaces, pads and links, read in one go
+    (twice if the graph changes between the count and the fill).'''
+
+    def __init__(self, media):
+        self.media = media
+        fd = os.open(media, os.O_RDONLY)
+        try:
+            while True:
+                topo = media_v2_topology()
+                fcntl.ioctl(fd, MEDIA_IOC_G_TOPOLOGY, topo)
+                version = topo.topology_version
+                self.entities = (media_v2_entity * topo.num_entities)()
+                self.interfaces = (media_v2_interface * topo.num_interfaces)()
+                self.pads = (media_v2_pad * topo.num_pads)()
+                self.links = (media_v2_link * topo.num_links)()
+                topo.ptr_entities = ctypes.addressof(self.entities)
+                topo.ptr_interfaces = ctypes.addressof(self.interfaces)
+                topo.ptr_pads = ctypes.addressof(self.pads)
+                topo.ptr_links = ctypes.addressof(self.links)
+                fcntl.ioctl(fd, MEDIA_IOC_G_TOPOLOGY, topo)
+                if topo.topology_version == version:
+                    break
+        finally:
+            os.close(fd)
+        self.padById = {pad.id: pad for pad in self.pads}
+
+    def named(self, prefix):
+        return [entity for entity in self.entities if entity.name.decode(errors="replace").startswith(prefix)]
+
+    def devnode(self, entity, intfType):
+        '''(major, minor) of the entity's intfType interface, or None.'''
+        for link in self.links:
+            if link.flags & MEDIA_LNK_FL_LINK_TYPE == MEDIA_LNK_FL_INTERFACE_LINK and link.sink_id == entity.id:
+                for intf in self.interfaces:
+                    if intf.id == link.source_id and intf.intf_type == intfType:
+                        return intf.u.devnode.major, intf.u.devnode.minor
+        return None
+
+    def downstream(self, entity, enabledOnly=True):
+        '''The first V4L2 I/O entity reached from entity's source pads.'''
+        entities = {e.id: e for e in self.entities}
+        seen, todo = {entity.id}, [entity.id]
+        while todo:
+            current = todo.pop(0)
+            for link in self.links:
+                if link.flags & MEDIA_LNK_FL_LINK_TYPE != MEDIA_LNK_FL_DATA_LINK:
+                    continue
+                if enabledOnly and not link.flags & MEDIA_LNK_FL_ENABLED:
+                    continue
+                source, sink = self.padById.get(link.source_id), self.padById.get(link.sink_id)
+                if source is None or sink is None or source.entity_id != current or sink.entity_id in seen:
+                    continue
+                if not source.flags & MEDIA_PAD_FL_SOURCE:
+                    continue
+                if entities[sink.entity_id].function == MEDIA_ENT_F_IO_V4L:
+                    return entities[sink.entity_id]
+                seen.add(sink.entity_id)
+                todo.append(sink.entity_id)
+        return None
+
+
+def charDevice(devnode):
+    '''/dev path of a (major, minor) character device, from sysfs.'''
+    if devnode is None:
+        return None
+    try:
+        with open("/sys/dev/char/{:d}:{:d}/uevent".format(*devnode)) as f:
+            for line in f:
+                if line.startswith("DEVNAME="):
+                    return "/dev/" + line.strip().split("=", 1)[1]
+    except OSError:
+        pass
+    return None
+
+
+def i2cClient(devnode):
+    '''(bus, address) of the I2C client behind a subdev node, or (None, None).'''
+    if devnode is None:
+        return None, None
+    name = os.path.basename(os.path.realpath("/sys/dev/char/{:d}:{:d}/device".format(*devnode)))
+    bus, _, address = name.partition("-")
+    try:
+        return int(bus), int(address, 16)
+    except ValueError:
+        return None, None
+
+
+def subdevFormat(subdev, pad=0):
+    '''The active format of a subdev pad as a dict, or None.'''
+    fmt = v4l2_subdev_format(which=V4L2_SUBDEV_FORMAT_ACTIVE, pad=pad)
+    try:
+        fd = os.open(subdev, os.O_RDWR)
+    except OSError:
+        return None
+    try:
+        fcntl.ioctl(fd, VIDIOC_SUBDEV_G_FMT, fmt)
+    except OSError:
+        return None
+    finally:
+        os.close(fd)
+    return {"width": fmt.format.width, "height": fmt.format.height, "code": fmt.format.code,
+            "name": BUS_FORMATS.get(fmt.format.code)}
+
+
+class BosonNode:
+    '''Where one camera is: media device, video and subdev nodes (None when
+    not found), I2C bus and address, and format when asked for. linked is
+    False when the video node was only reachable through disabled links.'''
+
+    def __init__(self, media, video, subdev, i2cBus, i2cAddress, format, linked):
+        self.media, self.video, self.subdev = media, video, subdev
+        self.i2cBus, self.i2cAddress = i2cBus, i2cAddress
+        self.format = format
+        self.linked = linked
+
+    def __repr__(self):
+        return "BosonNode(media={!r}, video={!r}, subdev={!r}, i2cBus={!r}, i2cAddress={}, format={!r})".format(
+            self.media, self.video, self.subdev, self.i2cBus,
+            None if self.i2cAddress is None else hex(self.i2cAddress), self.format)
+
+
+def findBosons(medias=None, readFormat=True):
+    '''Every flir_boson entity on the given media devices (all /dev/media* by
+    default), ordered by media device and I2C bus.'''
+    if medias is None:
+        medias = sorted(glob.glob("/dev/media*"), key=lambda path: (len(path), path))
+    found = []
+    for media in medias:
+        try:
+            topo = Topology(media)
+        except OSError:
+            continue
+        cameras = []
+        for entity in topo.named(ENTITY_NAME):
+            subdevNode = topo.devnode(entity, MEDIA_INTF_T_V4L_SUBDEV)
+            io, linked = topo.downstream(entity), True
+            if io is None:
+                io, linked = topo.downstream(entity, enabledOnly=False), False
+            video = charDevice(topo.devnode(io, MEDIA_INTF_T_V4L_VIDEO)) if io is not None else None
+            subdev = charDevice(subdevNode)
+            bus, address = i2cClient(subdevNode)
+            fmt = subdevFormat(subdev) if readFormat and subdev else None
+            cameras.append(BosonNode(media, video, subdev, bus, address, fmt, linked and io is not None))
+        found += sorted(cameras, key=lambda node: -1 if node.i2cBus is None else node.i2cBus)
+    return found
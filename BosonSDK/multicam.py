@@ -0,0 +1,286 @@
+"""
+Several Boson cameras captured as one: parallel setup, a common start, one
+I/O thread and a shared worker pool for all of them.
+
+    cams = [CameraSpec("cam0", "/dev/video0", port=1, calls=[("bosonRunFFC", ())]),
+            CameraSpec("cam1", "/dev/video1", port=2, calls=[("bosonRunFFC", ())], master=True)]
+    with MultiCapture(cams, pairBy="timestamp") as multi:
+        multi.configure()
+        multi.run(lambda frames: analyse(frames["cam0"].image, frames["cam1"].image))
+
+configure() sends each camera its SDK calls as one batch (boson-ctl's
+CtlClient.batch when a daemon serves the camera, call by call otherwise),
+all cameras at once. start() sets every video node up in parallel, then
+streams them on together. With external sync the master starts last: its
+slaves are already streaming when its first pulse comes, so no master frame
+goes out without partners.
+
+Frames are dequeued by a single thread polling every capture fd and handed
+to a ThreadPoolExecutor shared by all cameras: adding a camera adds an fd,
+not threads. With pairBy, frames are grouped across cameras before the
+handler sees them:
+
+    "timestamp"     V4L2 timestamps within tolerance seconds
+    "frameCounter"  telemetry frame counters (640x514); the counters of
+                    externally synced cameras move together, so their offset
+                    is learnt from the first timestamp-paired set
+    None            every frame on its own, handler(name, frame)
+
+A frame's buffer goes back to the driver when its handler returns. A frame
+left without partners beyond the tolerance, or waiting while its camera
+runs short of buffers, is dropped and counted in unpaired, so a stalled
+camera never starves the others.
+"""
+
+import collections
+import concurrent.futures
+import os
+import select
+import threading
+
+from .v4l2_capture import Capture
+
+
+class CameraSpec:
+    '''One camera: its video node and format, and optionally its control
+    connection (I2C port or subdev, as boson_ctl.openCamera() takes them)
+    with the SDK calls that configure it.'''
+
+    def __init__(self, name, device, width=640, height=512, fourcc="Y16 ", fps=None, buffers=6,
+                 port=None, subdev=None, calls=(), master=False):
+        self.name = name
+        self.device = device
+        self.width, self.height, self.fourcc, self.fps = width, height, fourcc, fps
+        self.buffers = buffers
+        self.port, self.subdev = port, subdev
+        self.calls = list(calls)
+        self.master = master
+
+
+def runBatch(cam, calls):
+    '''Results of [(name, args), ...] on a pyClient or CtlClient, in one
+    round trip when the client can batch.'''
+    if hasattr(cam, "batch"):
+        return cam.batch(calls)
+    return [getattr(cam, name)(*args) for name, args in calls]
+
+
+class FramePairer:
+    '''Collects frames per camera and emits {name: frame} sets, one frame
+    of every camera each.'''
+
+    def __init__(self, names, pairBy="timestamp", tolerance=0.008, counterOf=None, depth=None):
+        if pairBy not in ("timestamp", "frameCounter"):
+            raise ValueError("pairBy is 'timestamp' or 'frameCounter'")
+        self.names = list(names)
+        self.pairBy = pairBy
+        self.tolerance = tolerance
+        self.counterOf = counterOf
+        self.pending = {name: collections.deque() for name in self.names}
+        self.offsets = None         # frameCounter mode: counter offset per camera
+        self.depth = depth or {}    # most frames held per camera
+        self.unpaired = 0
+        self.lock = threading.Lock()
+
+    def _key(self, name, frame):
+        if self.pairBy == "frameCounter" and self.offsets is not None:
+            return (self.counterOf(frame) - self.offsets[name]) % (1 << 32)
+        return frame.timestamp
+
+    def add(self, name, frame):
+        '''(set or None, frames to release).'''
+        with self.lock:
+            stale = []
+            queue = self.pending[name]
+            queue.append(frame)
+            if len(queue) > self.depth.get(name, len(queue)):
+                stale.append(queue.popleft())
+                self.unpaired += 1
+            group, dropped = self._match()
+            return group, stale + dropped
+
+    def _match(self):
+        stale = []
+        while all(self.pending.values()):
+            heads = {name: queue[0] for name, queue in self.pending.items()}
+            if self.pairBy == "frameCounter" and self.offsets is None:
+                if max(f.timestamp for f in heads.values()) - min(f.timestamp for f in heads.values()) \
+                        <= self.tolerance:
+                    first = self.counterOf(heads[self.names[0]])
+                    self.offsets = {name: self.counterOf(f) - first for name, f in heads.items()}
+                    continue
+            elif self.pairBy == "frameCounter":
+                keys = {name: self._key(name, f) for name, f in heads.items()}
+                if len(set(keys.values())) == 1:
+                    return self._take(), stale
+                # counters wrap at 2**32; the oldest is the one furthest behind
+                newest = max(keys.values())
+                oldest = min(keys, key=lambda name: (keys[name] - newest) % (1 << 32))
+                stale.append(self.pending[oldest].popleft())
+                self.unpaired += 1
+                continue
+            else:
+                times = {name: f.timestamp for name, f in heads.items()}
+                if max(times.values()) - min(times.values()) <= self.tolerance:
+                    return self._take(), stale
+            # the oldest head has no partner within tolerance
+            oldest = min(heads, key=lambda name: heads[name].timestamp)
+            stale.append(self.pending[oldest].popleft())
+            self.unpaired += 1
+        return None, stale
+
+    def _take(self):
+        return {name: queue.popleft() for name, queue in self.pending.items()}
+
+    def drain(self):
+        with self.lock:
+            frames = [frame for queue in self.pending.values() for frame in queue]
+            for queue in self.pending.values():
+                queue.clear()
+            return frames
+
+
+class MultiCapture:
+    '''Captures every CameraSpec; see the module documentation.'''
+
+    def __init__(self, cameras, workers=None, pairBy=None, tolerance=0.008, telemetryCounter=None):
+        self.cameras = list(cameras)
+        if len({cam.name for cam in self.cameras}) != len(self.cameras):
+            raise ValueError("camera names must be unique")
+        self.workers = workers or min(32, (os.cpu_count() or 1) + len(self.cameras))
+        self.pairBy = pairBy
+        self.tolerance = tolerance
+        self.telemetryCounter = telemetryCounter or _frameCounter
+        self.captures = {}
+        self.pool = None
+        self.pairer = None
+        self.frames = collections.Counter()
+        self._stop = threading.Event()
+
+    def _parallel(self, fn, items):
+        with concurrent.futures.ThreadPoolExecutor(max_workers=max(1, len(items))) as setup:
+            return list(setup.map(fn, items))
+
+    def configure(self):
+        '''Run each camera's calls, all cameras at once; {name: results}.'''
+        from .boson_ctl import openCamera
+
+        def one(spec):
+            if not spec.calls:
+                return spec.name, []
+            cam = openCamera(port=spec.port or 1, device=spec.subdev)
+            try:
+                return spec.name, runBatch(cam, spec.calls)
+            finally:
+                cam.Close()
+        return dict(self._parallel(one, self.cameras))
+
+    def start(self):
+        '''Open every video node, then stream them on together.'''
+        def open_(spec):
+            return spec.name, Capture(spec.device, spec.width, spec.height, spec.fourcc, spec.fps, spec.buffers)
+        try:
+            for name, cap in self._parallel(open_, self.cameras):
+                self.captures[name] = cap
+        except Exception:
+            self.close()
+            raise
+        if len(self.captures) != len(self.cameras):
+            self.close()
+            raise RuntimeError("a camera failed to open")
+
+        slaves = [spec for spec in self.cameras if not spec.master]
+        masters = [spec for spec in self.cameras if spec.master]
+        barrier = threading.Barrier(len(slaves)) if slaves else None
+
+        def streamOn(spec):
+            barrier.wait()
+            self.captures[spec.name].start()
+        if slaves:
+            self._parallel(streamOn, slaves)
+        for spec in masters:
+            self.captures[spec.name].start()
+
+        self.pool = concurrent.futures.ThreadPoolExecutor(max_workers=self.workers, thread_name_prefix="boson")
+        if self.pairBy:
+            # one buffer per camera stays with the driver
+            depth = {spec.name: max(1, len(self.captures[spec.name].maps) - 1) for spec in self.cameras}
+            self.pairer = FramePairer([spec.name for spec in self.cameras], self.pairBy, self.tolerance,
+                                      self.telemetryCounter, depth)
+
+    def _release(self, frames):
+        for frame in frames:
+            frame.release()
+
+    def _work(self, handler, args, frames):
+        try:
+            handler(*args)
+        finally:
+            self._release(frames)
+
+    def run(self, handler, timeout=1.0):
+        '''Dispatch frames to handler until stop() or no camera delivers for
+        timeout seconds. handler(frames) with {name: frame} when pairing,
+        handler(name, frame) otherwise; exceptions end the run.'''
+        if not self.captures:
+            self.start()
+        byFd = {cap.fd: name for name, cap in self.captures.items()}
+        poller = select.poll()
+        for fd in byFd:
+            poller.register(fd, select.POLLIN)
+        futures = set()
+        try:
+            while not self._stop.is_set():
+                events = poller.poll(timeout * 1000)
+                if not events:
+                    break
+                for fd, _ in events:
+                    name = byFd[fd]
+                    frame = self.captures[name].read(timeout=0)
+                    if frame is None:
+                        continue
+                    self.frames[name] += 1
+                    if self.pairer is None:
+                        futures.add(self.pool.submit(self._work, handler, (name, frame), (frame,)))
+                        continue
+                    group, stale = self.pairer.add(name, frame)
+                    self._release(stale)
+                    if group is not None:
+                        futures.add(self.pool.submit(self._work, handler, (group,), list(group.values())))
+                done = {f for f in futures if f.done()}
+                for f in done:
+                    f.result()
+                futures -= done
+        finally:
+            for f in futures:
+                f.cancel()
+            concurrent.futures.wait(futures)
+            if self.pairer is not None:
+                self._release(self.pairer.drain())
+
+    def stop(self):
+        self._stop.set()
+
+    @property
+    def unpaired(self):
+        return self.pairer.unpaired if self.pairer else 0
+
+    def close(self):
+        self._stop.set()
+        if self.pool is not None:
+            self.pool.shutdown(wait=True)
+            self.pool = None
+        for cap in self.captures.values():
+            cap.close()
+        self.captures = {}
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+def _frameCounter(frame):
+    from .telemetry import TelemetryLines
+    return int(TelemetryLines(frame.telemetry[0]).frameCounter)
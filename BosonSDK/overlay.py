@@ -0,0 +1,189 @@
+"""
+Crosshairs, boxes and text drawn into the video by the camera's symbology
+engine, so the host does no per-frame drawing.
+
+    ov = Overlay(myCam)
+    ov.line(0, cx - 16, cy, cx + 16, cy, 0xFFFFFFFF)
+    ov.text(1, 4, 4, 200, 20, "REC", color=0xFF00FF00)
+    ov.commit()                 # once per frame or UI update
+    ov.move(0, x - 16, y)
+    ov.commit()                 # one MOVESPRITE and its UPDATEANDSHOW
+
+Like CLIENT_overlayCommit() in the C SDK, commit() sends only what changed
+since the last commit: a new or changed symbol is created again, a moved
+one gets a MOVESPRITE, a removed one a DELETE, each followed by its
+UPDATEANDSHOW. An unchanged overlay sends nothing. On KernelFslp the
+commands of one commit go to the driver as a single
+FLIR_BOSON_IOCTL_FSLP_FRAME vector; on the other ports they run one at a
+time. IDs 125..127 are drawn by the driver's V4L2_CID_FLIR_OVERLAY_*
+controls.
+"""
+
+from dataclasses import dataclass, replace
+import struct
+
+from .ClientFiles_Python.EnumTypes import FLR_ENABLE_E, FLR_SYMBOLOGY_TEXT_ALIGNMENT_E
+
+SYMBOLOGY_SETENABLE = 0x00140000
+SYMBOLOGY_CREATETEXT = 0x00140006
+SYMBOLOGY_MOVESPRITE = 0x00140007
+SYMBOLOGY_UPDATEANDSHOW = 0x0014000A
+SYMBOLOGY_DELETE = 0x0014000C
+SYMBOLOGY_CREATEFILLEDRECTANGLE = 0x0014000E
+SYMBOLOGY_CREATEOUTLINEDRECTANGLE = 0x00140010
+SYMBOLOGY_CREATEFILLEDELLIPSE = 0x0014001B
+SYMBOLOGY_CREATELINE = 0x0014001C
+
+MAX_SYMBOLS = 125           # IDs 0..124, as CLIENT_OVERLAY_SYMBOLS
+TEXT_MAX = 127              # characters, the camera's field holds 128 bytes
+BATCH_MAX = 64              # commands per FLIR_BOSON_IOCTL_FSLP_FRAME
+
+_LINE_SHAPES = {
+    "line": (SYMBOLOGY_CREATELINE, "symbologyCreateLine"),
+    "rectangle": (SYMBOLOGY_CREATEOUTLINEDRECTANGLE, "symbologyCreateOutlinedRectangle"),
+    "filled_rectangle": (SYMBOLOGY_CREATEFILLEDRECTANGLE, "symbologyCreateFilledRectangle"),
+    "ellipse": (SYMBOLOGY_CREATEFILLEDELLIPSE, "symbologyCreateFilledEllipse"),
+}
+
+
+class OverlayError(RuntimeError):
+    pass
+
+
+@dataclass(frozen=True)
+class Symbol:
+    shape: str
+    x: int
+    y: int
+    x2: int                 # end point of a line, width and height of the others
+    y2: int
+    color: int              # 0xAARRGGBB
+    visible: bool = True
+    size: int = 0           # text only
+    text: str = ""
+
+    def sameContent(self, other):
+        '''Equal up to the position: a line's end point moves with it.'''
+        if other is None or self.shape != other.shape or self.color != other.color:
+            return False
+        if self.shape == "line":
+            return (self.x2 - self.x, self.y2 - self.y) == (other.x2 - other.x, other.y2 - other.y)
+        return (self.x2, self.y2, self.size, self.text) == (other.x2, other.y2, other.size, other.text)
+
+
+class Overlay:
+    '''Wanted and shown symbols of one pyClient.'''
+
+    def __init__(self, cam):
+        self.cam = cam
+        self.want = {}
+        self.shown = {}
+        self.enabled = False
+        self.sent = 0           # commands sent by the last commit
+
+    def line(self, ID, x, y, x2, y2, color):
+        self._set(ID, Symbol("line", x, y, x2, y2, color))
+
+    def rectangle(self, ID, x, y, width, height, color, filled=False):
+        self._set(ID, Symbol("filled_rectangle" if filled else "rectangle", x, y, width, height, color))
+
+    def ellipse(self, ID, x, y, width, height, color):
+        self._set(ID, Symbol("ellipse", x, y, width, height, color))
+
+    def text(self, ID, x, y, width, height, text, size=14, color=0xFFFFFFFF):
+        if len(text.encode()) > TEXT_MAX:
+            raise ValueError("text longer than {:d} bytes".format(TEXT_MAX))
+        self._set(ID, Symbol("text", x, y, width, height, color, size=size, text=text))
+
+    def move(self, ID, x, y):
+        s = self.want[ID]
+        if s.shape == "line":
+            self.want[ID] = replace(s, x=x, y=y, x2=s.x2 + x - s.x, y2=s.y2 + y - s.y)
+        else:
+            self.want[ID] = replace(s, x=x, y=y)
+
+    def show(self, ID, visible=True):
+        self.want[ID] = replace(self.want[ID], visible=bool(visible))
+
+    def remove(self, ID):
+        self.want.pop(ID, None)
+
+    def reset(self):
+        '''Forget what the camera draws, e.g. after it rebooted.'''
+        self.shown.clear()
+        self.enabled = False
+
+    def commit(self):
+        '''Send what changed since the last commit.'''
+        commands = []               # (ID, fnID, sendData, fallback)
+        for ID in sorted(set(self.want) | set(self.shown)):
+            commands += self._diff(ID, self.want.get(ID), self.shown.get(ID))
+        self.sent = len(commands)
+        if not commands:
+            return
+
+        batch = getattr(getattr(self.cam, "fslp", None), "batch", None)
+        if batch is None:
+            results = [fallback() for ID, fnID, sendData, fallback in commands]
+        else:
+            results = []
+            for start in range(0, len(commands), BATCH_MAX):
+                chunk = commands[start:start + BATCH_MAX]
+                results += [result for result, data in batch([(fnID, sendData, 0) for ID, fnID, sendData, fallback in chunk])]
+
+        failed = {}
+        for (ID, fnID, sendData, fallback), result in zip(commands, results):
+            if getattr(result, "value", result):
+                failed.setdefault(ID, result)
+        # ID None is SYMBOLOGY_SETENABLE, every symbol of the commit depends on it
+        if None in failed:
+            self.enabled = False
+        for ID in {command[0] for command in commands if command[0] is not None}:
+            if ID in failed or None in failed:
+                self.shown[ID] = None       # drawn again, or deleted, next time
+            elif ID in self.want:
+                self.shown[ID] = self.want[ID]
+            else:
+                del self.shown[ID]
+        if failed:
+            ID, result = next(iter(failed.items()))
+            raise OverlayError("symbol {} failed: {}".format(ID, result))
+
+    def _set(self, ID, symbol):
+        if not 0 <= ID < MAX_SYMBOLS:
+            raise ValueError("symbol ID {:d} outside 0..{:d}".format(ID, MAX_SYMBOLS - 1))
+        self.want[ID] = symbol
+
+    def _diff(self, ID, w, s):
+        cam = self.cam
+        if w is None:
+            if ID not in self.shown:
+                return []
+            return [(ID, SYMBOLOGY_DELETE, struct.pack(">B", ID), lambda: cam.symbologyDelete(ID))]
+
+        commands = []
+        if not w.sameContent(s):
+            if not self.enabled:
+                self.enabled = True
+                commands.append((None, SYMBOLOGY_SETENABLE, struct.pack(">i", FLR_ENABLE_E.FLR_ENABLE),
+                                 lambda: cam.symbologySetEnable(FLR_ENABLE_E.FLR_ENABLE)))
+            commands.append(self._create(ID, w))
+        elif (w.x, w.y) != (s.x, s.y):
+            commands.append((ID, SYMBOLOGY_MOVESPRITE, struct.pack(">Bhh", ID, w.x, w.y),
+                             lambda: cam.symbologyMoveSprite(ID, w.x, w.y)))
+        elif w.visible == s.visible:
+            return []
+        commands.append((ID, SYMBOLOGY_UPDATEANDSHOW, struct.pack(">BB", ID, w.visible),
+                         lambda: cam.symbologyUpdateAndShow(ID, int(w.visible))))
+        return commands
+
+    def _create(self, ID, w):
+        cam = self.cam
+        if w.shape != "text":
+            fnID, method = _LINE_SHAPES[w.shape]
+            return (ID, fnID, struct.pack(">BhhhhI", ID, w.x, w.y, w.x2, w.y2, w.color),
+                    lambda: getattr(cam, method)(ID, w.x, w.y, w.x2, w.y2, w.color))
+        align = FLR_SYMBOLOGY_TEXT_ALIGNMENT_E.FLR_SYMBOLOGY_LEFT_TOP
+        text = w.text.encode().ljust(TEXT_MAX + 1, b"\0")
+        return (ID, SYMBOLOGY_CREATETEXT, struct.pack(">BhhhhbhhI", ID, w.x, w.y, w.x2, w.y2, 0, w.size, align, w.color) + text,
+                lambda: cam.symbologyCreateText(ID, w.x, w.y, w.x2, w.y2, 0, w.size, align, w.color, list(text)))
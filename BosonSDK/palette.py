@@ -0,0 +1,146 @@
+"""
+Color palettes applied on the host to the camera's RAW8 stream.
+
+Capturing COLOR (UYVY) moves two bytes per pixel over MIPI only to carry the
+palette; capturing GREY and coloring here moves one:
+
+    palette = Palette.fromCamera(myCam)         # the camera's COLORLUT ID
+    palette = Palette.byName("ironbow")         # or by flir_color_lut name
+    for frame in Capture("/dev/video0", 640, 512, "GREY"):
+        rgb = palette.toRgb(frame.image)        # (512, 640, 3) uint8
+        y, uv = palette.toNv12(frame.image)
+
+The camera reports its palette's ID but not the table, so the tables are
+Client_Palette.c's drawings of the named palettes, close to the camera's
+but not identical; Palette(rgb) takes an exact 256 x 3 table. The kernels
+are Palette_64.so (make Palette_64.so in BosonSDKC/ClientFiles_C, copied
+next to this file); toRgb falls back to numpy without it.
+"""
+
+import ctypes
+import os
+
+import numpy as np
+
+from .flir_color_lut import lut_names as PALETTE_NAMES
+
+PALETTE_ENTRIES = 256       # CLIENT_PALETTE_ENTRIES
+
+
+class CLIENT_PALETTE(ctypes.Structure):
+    _fields_ = [("rgba", ctypes.c_uint32 * PALETTE_ENTRIES),
+                ("y", ctypes.c_uint8 * PALETTE_ENTRIES),
+                ("u", ctypes.c_uint8 * PALETTE_ENTRIES),
+                ("v", ctypes.c_uint8 * PALETTE_ENTRIES)]
+
+
+def loadKernels(dllPath=None):
+    '''Palette_64.so from dllPath or next to this file, None when missing.'''
+    loadpath = os.path.join(dllPath or os.path.dirname(__file__), "Palette_64.so")
+    try:
+        lib = ctypes.cdll.LoadLibrary(loadpath)
+    except OSError:
+        return None
+    palette = ctypes.POINTER(CLIENT_PALETTE)
+    bytes_ = ctypes.POINTER(ctypes.c_uint8)
+    u32 = ctypes.c_uint32
+    lib.CLIENT_paletteBuild.argtypes = [u32, palette]
+    lib.CLIENT_paletteBuild.restype = ctypes.c_int32
+    lib.CLIENT_paletteFromRgb.argtypes = [bytes_, palette]
+    lib.CLIENT_paletteFromRgb.restype = None
+    for name in ("CLIENT_paletteToRgb", "CLIENT_paletteToRgba"):
+        getattr(lib, name).argtypes = [palette, bytes_, u32, u32, u32, bytes_, u32]
+        getattr(lib, name).restype = None
+    lib.CLIENT_paletteToNv12.argtypes = [palette, bytes_, u32, u32, u32, bytes_, u32, bytes_, u32]
+    lib.CLIENT_paletteToNv12.restype = None
+    return lib
+
+_KERNELS = loadKernels()
+
+
+def _rows(array, channels):
+    # (pointer, row stride in bytes) when the C kernels can take array as it is
+    if array.dtype != np.uint8 or array.ndim != (3 if channels > 1 else 2) or array.strides[0] < 0:
+        return None
+    if array.strides[1] != channels or (channels > 1 and (array.shape[2] != channels or array.strides[2] != 1)):
+        return None
+    return array.ctypes.data_as(ctypes.POINTER(ctypes.c_uint8)), array.strides[0]
+
+
+class Palette:
+    '''A 256-entry palette for Y8 frames; rgb is (256, 3) uint8.'''
+
+    def __init__(self, rgb):
+        rgb = np.ascontiguousarray(rgb, dtype=np.uint8)
+        if rgb.shape != (PALETTE_ENTRIES, 3):
+            raise ValueError("a palette is {:d} x 3 uint8".format(PALETTE_ENTRIES))
+        self.rgb = rgb
+        self._table = None
+        if _KERNELS is not None:
+            self._table = CLIENT_PALETTE()
+            _KERNELS.CLIENT_paletteFromRgb(rgb.ctypes.data_as(ctypes.POINTER(ctypes.c_uint8)),
+                                           ctypes.byref(self._table))
+
+    @classmethod
+    def fromId(cls, colorLutId):
+        '''The palette of an FLR_COLORLUT_ID_E value.'''
+        if _KERNELS is None:
+            raise OSError("Palette_64.so not found; build it with make Palette_64.so in BosonSDKC/ClientFiles_C")
+        table = CLIENT_PALETTE()
+        if _KERNELS.CLIENT_paletteBuild(int(colorLutId), ctypes.byref(table)) < 0:
+            raise ValueError("no palette for color LUT {}".format(colorLutId))
+        rgba = np.ctypeslib.as_array(table.rgba).view(np.uint8).reshape(PALETTE_ENTRIES, 4)
+        return cls(rgba[:, :3])
+
+    @classmethod
+    def byName(cls, name):
+        try:
+            return cls.fromId(PALETTE_NAMES[name.lower()])
+        except KeyError:
+            raise ValueError("unknown palette {!r}; one of {}".format(name, ", ".join(PALETTE_NAMES))) from None
+
+    @classmethod
+    def fromCamera(cls, cam):
+        '''The palette the camera is set to (colorLutGetId); cam is a pyClient
+        or anything with its methods (boson_ctl.openCamera()).'''
+        returnCode, colorLutId = cam.colorLutGetId()
+        if colorLutId is None:
+            raise RuntimeError("colorLutGetId failed: {}".format(returnCode))
+        return cls.fromId(colorLutId)
+
+    def toRgb(self, y8, out=None, alpha=False):
+        '''(h, w, 3) RGB, or (h, w, 4) RGBA with alpha=True, of a 2-D uint8
+        block; rows may be strided.'''
+        y8 = np.asanyarray(y8)
+        channels = 4 if alpha else 3
+        if out is None:
+            out = np.empty(y8.shape + (channels,), np.uint8)
+        if out.shape != y8.shape + (channels,):
+            raise ValueError("out must be of shape {}".format(y8.shape + (channels,)))
+        src, dst = _rows(y8, 1), _rows(out, channels)
+        if self._table is not None and src and dst:
+            kernel = _KERNELS.CLIENT_paletteToRgba if alpha else _KERNELS.CLIENT_paletteToRgb
+            kernel(ctypes.byref(self._table), src[0], src[1], y8.shape[1], y8.shape[0], dst[0], dst[1])
+        else:
+            out[..., :3] = self.rgb[y8]
+            if alpha:
+                out[..., 3] = 255
+        return out
+
+    def toNv12(self, y8):
+        '''(Y plane (h, w), interleaved UV plane (h/2, w/2, 2)), BT.601
+        limited range, of a 2-D uint8 block.'''
+        if self._table is None:
+            raise OSError("NV12 output needs Palette_64.so")
+        y8 = np.asanyarray(y8)
+        src = _rows(y8, 1)
+        if not src:
+            y8 = np.ascontiguousarray(y8, dtype=np.uint8)
+            src = _rows(y8, 1)
+        height, width = y8.shape
+        yPlane = np.empty((height, width), np.uint8)
+        uvPlane = np.empty(((height + 1) // 2, (width + 1) // 2, 2), np.uint8)
+        _KERNELS.CLIENT_paletteToNv12(ctypes.byref(self._table), src[0], src[1], width, height,
+                                      yPlane.ctypes.data_as(ctypes.POINTER(ctypes.c_uint8)), yPlane.strides[0],
+                                      uvPlane.ctypes.data_as(ctypes.POINTER(ctypes.c_uint8)), uvPlane.strides[0])
+        return yPlane, uvPlane
@@ -0,0 +1,122 @@
+"""
+Y14 counts to temperature through a 16384-entry lookup table.
+
+The table is built once - from the camera's RBFO curve, or linear for TLinear
+output - and every pixel afterwards costs one lookup:
+
+    lut = RadiometryLUT.fromCamera(myCam)       # 257 radiometryGetTempFromCounts calls
+    kelvin = lut.toKelvin(frame.image)          # float32, frame shape
+    stats = lut.roiStats(frame.image[200:300, 280:360])
+
+The lookups run in Radiometry_64.so (make Radiometry_64.so in
+BosonSDKC/ClientFiles_C, copied next to this file) when it is there and in
+numpy otherwise. Counts are taken modulo 16384, like the C kernels.
+"""
+
+import ctypes
+import os
+from collections import namedtuple
+
+import numpy as np
+
+LUT_ENTRIES = 16384         # RADIOMETRY_LUT_ENTRIES
+LUT_STEP = 64               # RADIOMETRY_LUT_STEP
+KELVIN_TO_CELSIUS = -273.15
+
+RoiStats = namedtuple("RoiStats", "min max mean pixels")
+
+
+class RADIOMETRY_ROI_STATS(ctypes.Structure):
+    _fields_ = [("minK", ctypes.c_float),
+                ("maxK", ctypes.c_float),
+                ("meanK", ctypes.c_float),
+                ("pixels", ctypes.c_uint32)]
+
+
+def loadKernels(dllPath=None):
+    '''Radiometry_64.so from dllPath or next to this file, None when missing.'''
+    loadpath = os.path.join(dllPath or os.path.dirname(__file__), "Radiometry_64.so")
+    try:
+        lib = ctypes.cdll.LoadLibrary(loadpath)
+    except OSError:
+        return None
+    floats = ctypes.POINTER(ctypes.c_float)
+    counts = ctypes.POINTER(ctypes.c_uint16)
+    lib.CLIENT_radiometryApplyLut.argtypes = [floats, counts, ctypes.c_uint32, floats]
+    lib.CLIENT_radiometryApplyLut.restype = None
+    lib.CLIENT_radiometryRoiStats.argtypes = [floats, counts, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32,
+                                              ctypes.POINTER(RADIOMETRY_ROI_STATS)]
+    lib.CLIENT_radiometryRoiStats.restype = None
+    return lib
+
+_KERNELS = loadKernels()
+
+
+class RadiometryLUT:
+    '''kelvin[counts] for every 14-bit count; celsius shares the lookups.'''
+
+    def __init__(self, kelvin):
+        kelvin = np.ascontiguousarray(kelvin, dtype=np.float32)
+        if kelvin.shape != (LUT_ENTRIES,):
+            raise ValueError("a radiometry table has {:d} entries".format(LUT_ENTRIES))
+        self.kelvin = kelvin
+        self.celsius = kelvin + np.float32(KELVIN_TO_CELSIUS)
+
+    @classmethod
+    def fromCamera(cls, cam, rbfoType=None, step=LUT_STEP):
+        '''Sample the camera's counts-to-degK curve every step counts and at
+        the last count, linear in between; cam is a pyClient or anything
+        with its methods (boson_ctl.openCamera()).'''
+        if rbfoType is None:
+            from .ClientFiles_Python.EnumTypes import FLR_RADIOMETRY_RBFO_TYPE_E
+            rbfoType = FLR_RADIOMETRY_RBFO_TYPE_E.FLR_RADIOMETRY_DEFAULT_RBFO
+        knots = list(range(0, LUT_ENTRIES - 1, step)) + [LUT_ENTRIES - 1]
+        temps = []
+        for counts in knots:
+            returnCode, temp = cam.radiometryGetTempFromCounts(rbfoType, counts)
+            if temp is None:
+                raise RuntimeError("radiometryGetTempFromCounts({:d}) failed: {}".format(counts, returnCode))
+            temps.append(temp)
+        return cls(np.interp(np.arange(LUT_ENTRIES), knots, temps))
+
+    @classmethod
+    def linear(cls, resolutionK, offsetK=0.0):
+        '''TLinear output: offsetK + counts * resolutionK.'''
+        return cls(offsetK + np.arange(LUT_ENTRIES, dtype=np.float64) * resolutionK)
+
+    def _lookup(self, table, counts, out):
+        counts = np.asanyarray(counts)
+        if out is None:
+            out = np.empty(counts.shape, np.float32)
+        if (_KERNELS is not None and counts.dtype == np.uint16 and counts.flags.c_contiguous
+                and out.dtype == np.float32 and out.flags.c_contiguous and out.shape == counts.shape):
+            _KERNELS.CLIENT_radiometryApplyLut(table.ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+                                               counts.ctypes.data_as(ctypes.POINTER(ctypes.c_uint16)),
+                                               counts.size, out.ctypes.data_as(ctypes.POINTER(ctypes.c_float)))
+        else:
+            np.take(table, counts, out=out, mode="wrap")
+        return out
+
+    def toKelvin(self, counts, out=None):
+        return self._lookup(self.kelvin, counts, out)
+
+    def toCelsius(self, counts, out=None):
+        return self._lookup(self.celsius, counts, out)
+
+    def roiStats(self, counts, celsius=False):
+        '''RoiStats(min, max, mean, pixels) over a 2-D block of counts, e.g. a
+        slice of a frame; no temperature map is made.'''
+        counts = np.asanyarray(counts)
+        table = self.celsius if celsius else self.kelvin
+        if (_KERNELS is not None and counts.dtype == np.uint16 and counts.ndim == 2
+                and counts.strides[1] == 2 and counts.strides[0] % 2 == 0 and counts.strides[0] >= 0):
+            stats = RADIOMETRY_ROI_STATS()
+            _KERNELS.CLIENT_radiometryRoiStats(table.ctypes.data_as(ctypes.POINTER(ctypes.c_float)),
+                                               counts.ctypes.data_as(ctypes.POINTER(ctypes.c_uint16)),
+                                               counts.strides[0] // 2, counts.shape[0], counts.shape[1],
+                                               ctypes.byref(stats))
+            return RoiStats(stats.minK, stats.maxK, stats.meanK, stats.pixels)
+        temps = np.take(table, counts, mode="wrap")
+        if temps.size == 0:
+            return RoiStats(0.0, 0.0, 0.0, 0)
+        return RoiStats(float(temps.min()), float(temps.max()), float(temps.mean()), temps.size)
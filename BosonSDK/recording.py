@@ -0,0 +1,218 @@
+"""
+Packed 14-bit radiometric recordings with random-access playback.
+
+RAW14 counts fit in 14 bits; storing them as Y16 wastes two per pixel and
+PNG spends CPU on every frame. A recording packs four pixels into seven
+bytes (12.5% smaller than Y16, no compression) and appends fixed-size
+records to one file:
+
+    header      HEADER_DTYPE: magic, version, width, height, telemetry bytes
+    record[i]   sequence, flags, timestamp, packed pixels, telemetry bytes
+
+Records being all the same size, the file is its own frame index: frame i is
+at a computed offset, a crash loses at most the record being written, and
+reopening for append drops that partial tail. Reading maps the file and
+unpacks only the frames asked for:
+
+    with Recorder("flight.b14", 640, 512, telemetryBytes=640) as rec:
+        for frame in Capture("/dev/video0", 640, 514, "Y16 "):
+            rec.write(frame.image, frame.telemetry[0], frame.sequence, frame.timestamp)
+
+    play = Playback("flight.b14")
+    frame = play[play.indexAt(play.timestamps[0] + 3600.0)]     # an hour in
+    frame.image                                 # (512, 640) uint16 counts
+    TelemetryLines(frame.telemetry)             # telemetry bytes, one per pixel
+
+Packing is little-endian: pixel k of a group occupies bits 14k..14k+13 of
+the group's 56-bit word. Both directions are whole-array numpy operations.
+"""
+
+import mmap
+import os
+
+import numpy as np
+
+MAGIC = b"BOSON14\0"
+VERSION = 1
+COUNTS_MASK = 0x3FFF
+
+HEADER_DTYPE = np.dtype([("magic", "S8"), ("version", "<u4"), ("width", "<u4"), ("height", "<u4"),
+                         ("telemetryBytes", "<u4"), ("reserved", "<u4", 4)])
+
+
+def packedSize(pixels):
+    if pixels % 4:
+        raise ValueError("packed 14-bit frames need a multiple of 4 pixels")
+    return pixels // 4 * 7
+
+
+def recordDtype(width, height, telemetryBytes):
+    return np.dtype([("sequence", "<u4"), ("flags", "<u4"), ("timestamp", "<f8"),
+                     ("pixels", "u1", (packedSize(width * height),)), ("telemetry", "u1", (telemetryBytes,))])
+
+
+def pack14(counts, out=None):
+    '''uint16 counts, any shape with a multiple of 4 elements, to packed bytes.'''
+    groups = np.ascontiguousarray(counts, dtype=np.uint16).reshape(-1, 4).astype(np.uint64)
+    groups &= COUNTS_MASK
+    words = groups[:, 0]
+    for k in range(1, 4):
+        words |= groups[:, k] << np.uint64(14 * k)
+    packed = words.astype("<u8").view(np.uint8).reshape(-1, 8)[:, :7]
+    if out is None:
+        return packed.reshape(-1).copy()
+    out.reshape(-1, 7)[...] = packed
+    return out
+
+
+def unpack14(packed, shape=None):
+    '''Packed bytes to uint16 counts, flat or in shape.'''
+    groups = np.asarray(packed, dtype=np.uint8).reshape(-1, 7)
+    wide = np.zeros((len(groups), 8), np.uint8)
+    wide[:, :7] = groups
+    words = wide.view("<u8").reshape(-1)
+    counts = np.empty((len(groups), 4), np.uint16)
+    for k in range(4):
+        counts[:, k] = (words >> np.uint64(14 * k)) & np.uint64(COUNTS_MASK)
+    counts = counts.reshape(-1)
+    return counts if shape is None else counts.reshape(shape)
+
+
+def _readHeader(f, path):
+    raw = f.read(HEADER_DTYPE.itemsize)
+    if len(raw) < HEADER_DTYPE.itemsize:
+        raise ValueError("{} is not a recording: too short".format(path))
+    header = np.frombuffer(raw, HEADER_DTYPE)[0]
+    if header["magic"] != MAGIC.rstrip(b"\0") or header["version"] != VERSION:
+        raise ValueError("{} is not a version {:d} recording".format(path, VERSION))
+    return int(header["width"]), int(header["height"]), int(header["telemetryBytes"])
+
+
+class Recorder:
+    '''Appends frames to path, creating it with width x height and
+    telemetryBytes per frame, or continuing an existing recording of the
+    same layout.'''
+
+    def __init__(self, path, width, height, telemetryBytes=0):
+        self.width, self.height, self.telemetryBytes = width, height, telemetryBytes
+        self.dtype = recordDtype(width, height, telemetryBytes)
+        self._record = np.zeros(1, self.dtype)
+        self.f = open(path, "r+b" if os.path.exists(path) and os.path.getsize(path) else "w+b")
+        try:
+            if os.fstat(self.f.fileno()).st_size:
+                if _readHeader(self.f, path) != (width, height, telemetryBytes):
+                    raise ValueError("{} holds a different frame layout".format(path))
+                self.frames = (os.fstat(self.f.fileno()).st_size - HEADER_DTYPE.itemsize) // self.dtype.itemsize
+                # a partial last record from an interrupted write goes
+                self.f.truncate(HEADER_DTYPE.itemsize + self.frames * self.dtype.itemsize)
+            else:
+                header = np.zeros(1, HEADER_DTYPE)
+                header["magic"], header["version"] = MAGIC, VERSION
+                header["width"], header["height"], header["telemetryBytes"] = width, height, telemetryBytes
+                self.f.write(header.tobytes())
+                self.frames = 0
+            self.f.seek(0, os.SEEK_END)
+        except Exception:
+            self.f.close()
+            raise
+
+    def write(self, image, telemetry=None, sequence=0, timestamp=0.0, flags=0):
+        '''One frame: image (height, width) of counts; telemetry one byte per
+        pixel (the low byte of each element is kept, so a Y16 telemetry row
+        can be passed as is), cut or zero-padded to telemetryBytes.'''
+        image = np.asanyarray(image)
+        if image.shape != (self.height, self.width):
+            raise ValueError("frames of this recording are {:d}x{:d}".format(self.width, self.height))
+        record = self._record
+        record["sequence"], record["flags"], record["timestamp"] = sequence, flags, timestamp
+        pack14(image, record["pixels"][0])
+        if self.telemetryBytes:
+            record["telemetry"] = 0
+            if telemetry is not None:
+                tel = (np.asarray(telemetry).reshape(-1) & 0xFF).astype(np.uint8)[:self.telemetryBytes]
+                record["telemetry"][0, :len(tel)] = tel
+        self.f.write(self._record.tobytes())
+        self.frames += 1
+
+    def flush(self):
+        self.f.flush()
+
+    def close(self):
+        if not self.f.closed:
+            self.f.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
+
+
+class RecordedFrame:
+    def __init__(self, record, shape):
+        self.sequence = int(record["sequence"])
+        self.flags = int(record["flags"])
+        self.timestamp = float(record["timestamp"])
+        self._packed = record["pixels"]
+        self._shape = shape
+        self.telemetry = record["telemetry"]     # view onto the mapping
+        self._image = None
+
+    @property
+    def image(self):
+        '''Counts, unpacked on first use.'''
+        if self._image is None:
+            self._image = unpack14(self._packed, self._shape)
+        return self._image
+
+
+class Playback:
+    '''Random access to a recording through a read-only mapping. len() is
+    the number of complete frames when opened; sequences, timestamps and
+    flags are arrays over all of them, read without unpacking a frame.'''
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.width, self.height, self.telemetryBytes = _readHeader(f, path)
+            self.dtype = recordDtype(self.width, self.height, self.telemetryBytes)
+            size = os.fstat(f.fileno()).st_size
+            count = (size - HEADER_DTYPE.itemsize) // self.dtype.itemsize
+            self._map = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ) if count else None
+        self.records = (np.frombuffer(self._map, self.dtype, count, HEADER_DTYPE.itemsize) if count
+                        else np.zeros(0, self.dtype))
+        self.sequences = self.records["sequence"]
+        self.timestamps = self.records["timestamp"]
+        self.flags = self.records["flags"]
+
+    def __len__(self):
+        return len(self.records)
+
+    def __getitem__(self, index):
+        return RecordedFrame(self.records[index], (self.height, self.width))
+
+    def __iter__(self):
+        return self.frames()
+
+    def frames(self, start=0, stop=None, step=1):
+        for index in range(*slice(start, stop, step).indices(len(self))):
+            yield self[index]
+
+    def indexAt(self, timestamp):
+        '''The first frame at or after timestamp (timestamps must rise).'''
+        return min(int(np.searchsorted(self.timestamps, timestamp)), len(self) - 1)
+
+    def close(self):
+        # views handed out keep the mapping alive until they go
+        self.records = self.sequences = self.timestamps = self.flags = None
+        if self._map is not None:
+            try:
+                self._map.close()
+            except BufferError:
+                pass
+            self._map = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
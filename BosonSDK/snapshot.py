@@ -0,0 +1,110 @@
+"""
+One pre-AGC radiometric frame while the video stream stays in RAW8.
+
+The camera copies a frame from the chosen point of its pipeline into capture
+buffer 0 (CAPTURE_SINGLEFRAMEWITHSRC) and the frame is downloaded with
+MEM_READCAPTURE, so the stream keeps its format: no set_fmt, no FFC, no MIPI
+restart.
+
+    snap = Snapshot(myCam)
+    image = snap.capture()                      # uint16, rows x columns
+    future = snap.captureAsync(FLR_CAPTURE_SRC_E.FLR_CAPTURE_SRC_TLINEAR)
+    ...
+    kelvin = lut.toKelvin(future.result())
+
+On KernelFslp the reads go to the driver as FLIR_BOSON_IOCTL_FSLP_FRAME
+vectors of up to 64 commands, so a 640x512 frame is about 40 ioctls; on the
+other ports they run one command at a time. captureAsync() runs the download
+on a worker thread and returns a concurrent.futures.Future.
+
+Applications that drive the sensor through V4L2 can press the subdev's
+V4L2_CID_FLIR_SNAPSHOT control instead, wait for V4L2_EVENT_FLIR_BOSON_SNAPSHOT
+and then call download().
+"""
+
+from concurrent.futures import ThreadPoolExecutor
+import struct
+import time
+
+import numpy as np
+
+from .ClientFiles_Python.EnumTypes import FLR_CAPTURE_SRC_E, FLR_CAPTURE_STATE_E
+
+MEM_READCAPTURE = 0xFFFF0003
+READ_CHUNK = 256            # MEM_READCAPTURE reply size, as CLIENT_TRANSFER_MEM_CHUNK
+POLL_INTERVAL = 0.01        # seconds between CAPTURE_GETSTATUS calls
+DEFAULT_TIMEOUT = 2.0       # FLIR_BOSON_SNAPSHOT_TIMEOUT_MS
+
+
+class SnapshotError(RuntimeError):
+    pass
+
+
+def _check(returnCode, what):
+    if getattr(returnCode, "value", returnCode):
+        raise SnapshotError("{} failed: {}".format(what, returnCode))
+
+
+class Snapshot:
+    '''Capture and download of single frames on one pyClient.'''
+
+    def __init__(self, cam):
+        self.cam = cam
+        self.executor = None
+
+    def capture(self, source=FLR_CAPTURE_SRC_E.FLR_CAPTURE_SRC_NUC, timeout=DEFAULT_TIMEOUT):
+        '''Capture one frame from source and return it, rows x columns.'''
+        _check(self.cam.captureSingleFrameWithSrc(source), "captureSingleFrameWithSrc")
+        deadline = time.monotonic() + timeout
+        while True:
+            returnCode, status = self.cam.captureGetStatus()
+            _check(returnCode, "captureGetStatus")
+            if status.state != FLR_CAPTURE_STATE_E.FLR_CAPTURE_IN_PROGRESS:
+                break
+            if time.monotonic() > deadline:
+                raise SnapshotError("capture still in progress after {:.1f} s".format(timeout))
+            time.sleep(POLL_INTERVAL)
+        _check(status.result, "capture")
+        return self.download()
+
+    def captureAsync(self, source=FLR_CAPTURE_SRC_E.FLR_CAPTURE_SRC_NUC, timeout=DEFAULT_TIMEOUT):
+        '''capture() on a worker thread. Don't send other commands on this
+        pyClient until the future is done.'''
+        if self.executor is None:
+            self.executor = ThreadPoolExecutor(max_workers=1, thread_name_prefix="boson-snapshot")
+        return self.executor.submit(self.capture, source, timeout)
+
+    def download(self):
+        '''The frame in capture buffer 0: uint16 for 14-bit sources, uint8
+        for 8-bit ones.'''
+        returnCode, size, rows, columns = self.cam.memGetCaptureSize()
+        _check(returnCode, "memGetCaptureSize")
+        if not rows or not columns or size % (rows * columns):
+            raise SnapshotError("capture size {:d} does not fit {:d}x{:d}".format(size, columns, rows))
+        data = self._read(size)
+        dtype = "<u2" if size // (rows * columns) == 2 else np.uint8
+        return np.frombuffer(data, dtype=dtype).reshape(rows, columns)
+
+    def close(self):
+        if self.executor is not None:
+            self.executor.shutdown()
+            self.executor = None
+
+    def _read(self, size):
+        data = bytearray(size)
+        batch = getattr(getattr(self.cam, "fslp", None), "batch", None)
+        if batch is None:
+            for offset in range(0, size, READ_CHUNK):
+                length = min(READ_CHUNK, size - offset)
+                returnCode, chunk = self.cam.memReadCapture(0, offset, length)
+                _check(returnCode, "memReadCapture at {:d}".format(offset))
+                data[offset:offset + length] = bytes(chunk[:length])
+            return data
+
+        commands = [(MEM_READCAPTURE, struct.pack(">BIH", 0, offset, min(READ_CHUNK, size - offset)),
+                     min(READ_CHUNK, size - offset)) for offset in range(0, size, READ_CHUNK)]
+        for (fnID, sendData, length), (result, chunk) in zip(commands, batch(commands)):
+            offset = struct.unpack_from(">I", sendData, 1)[0]
+            _check(result, "memReadCapture at {:d}".format(offset))
+            data[offset:offset + length] = chunk[:length]
+        return data
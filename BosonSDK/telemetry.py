@@ -0,0 +1,107 @@
+"""
+Boson telemetry line decoding with numpy.
+
+Every pixel of a telemetry row carries one telemetry byte in its low byte:
+the 640x514 Y16 frames of flir_test/boson_14_tele.py have it in the low byte
+of each uint16 pixel, 8-bit video has it in the pixel itself. TELEMETRY_FIELDS
+gives the fields by telemetry byte offset; telemetryDtype() turns that table
+into a structured dtype spanning one whole row, with every byte of a field at
+the offset of its pixel. A batch of rows, shape (..., width), is then decoded
+by a single view - no copy, no per-frame Python:
+
+    frames = np.stack(captured)                 # (N, 514, 640) uint16
+    tel = TelemetryLines(telemetryRows(frames))
+    tel.frameCounter, tel.fpaTemp               # (N,) arrays
+
+Multi-byte fields are little-endian (SWAP16B exchanges the two bytes of each
+16-bit word). fpaTemp at byte 96, in Kelvin x10, is what boson_14_tele.py has
+always printed as the camera temperature; the other offsets follow the Boson
+telemetry line table and should be checked against telemetryRevision for the
+camera's firmware - pass your own table as fields= if they differ.
+"""
+
+import numpy as np
+
+# name, telemetry byte offset, bytes
+TELEMETRY_FIELDS = (
+    ("telemetryRevision",   0,  2),
+    ("cameraSerial",        2,  4),
+    ("sensorSerial",        6,  4),
+    ("frameCounter",       42,  4),
+    ("frameTimestamp",     46,  4),     # ms since power-up
+    ("ffcFrameCounter",    50,  4),     # frameCounter at the last FFC
+    ("ffcTimestamp",       54,  4),     # frameTimestamp of the last FFC
+    ("ffcState",           88,  2),     # FLR_BOSON_FFCSTATUS_E
+    ("fpaTemp",            96,  2),     # Kelvin x10
+)
+
+_UINTS = {1: "u1", 2: "<u2", 4: "<u4", 8: "<u8"}
+
+
+def byteOffset(index, pixelBytes, swap16):
+    # telemetry byte -> byte offset in the row buffer
+    if swap16:
+        index ^= 1
+    return index * pixelBytes
+
+
+def telemetryDtype(width, pixelBytes=2, swap16=False, fields=TELEMETRY_FIELDS):
+    '''Structured dtype of one telemetry row of width pixels of pixelBytes
+    each. A field whose bytes sit next to each other in order is a plain
+    little-endian integer; otherwise it is a struct of its bytes, b0 lowest.'''
+    names, formats, offsets = [], [], []
+    for name, offset, size in fields:
+        if offset + size > width:
+            continue
+        at = [byteOffset(offset + i, pixelBytes, swap16) for i in range(size)]
+        if at == list(range(at[0], at[0] + size)):
+            formats.append(_UINTS[size])
+        else:
+            formats.append(np.dtype({"names": ["b{:d}".format(i) for i in range(size)],
+                                     "formats": ["u1"] * size,
+                                     "offsets": [a - min(at) for a in at]}))
+        names.append(name)
+        offsets.append(min(at))
+    return np.dtype({"names": names, "formats": formats, "offsets": offsets,
+                     "itemsize": width * pixelBytes})
+
+
+def telemetryRows(frames, rows=2, top=False):
+    '''The first telemetry row of each frame, (..., height, width) ->
+    (..., width); a view. rows is how many telemetry rows the frame carries.'''
+    return frames[..., 0 if top else -rows, :]
+
+
+class TelemetryLines:
+    '''Decoded view of a batch of telemetry rows. Attributes are the fields
+    of the table as (...,) integer arrays; fpaTempC is in degrees Celsius.'''
+
+    def __init__(self, rows, swap16=False, fields=TELEMETRY_FIELDS):
+        rows = np.asanyarray(rows)
+        if rows.ndim == 0 or rows.strides[-1] != rows.itemsize:
+            raise ValueError("telemetry rows need contiguous pixels")
+        self.dtype = telemetryDtype(rows.shape[-1], rows.itemsize, swap16, fields)
+        # one record per row; needs numpy >= 1.23 when the rows are strided,
+        # e.g. telemetryRows() of a frame batch
+        self.lines = rows.view(self.dtype)[..., 0]
+
+    def __getattr__(self, name):
+        if name.startswith("_") or name not in self.dtype.names:
+            raise AttributeError(name)
+        field = self.lines[name]
+        if field.dtype.names is None:
+            return field
+        value = np.zeros(field.shape, _UINTS[len(field.dtype.names)].lstrip("<"))
+        for shift, byte in enumerate(field.dtype.names):
+            value |= field[byte].astype(value.dtype) << (8 * shift)
+        return value
+
+    def __dir__(self):
+        return sorted(set(super().__dir__()) | set(self.dtype.names))
+
+    def __len__(self):
+        return len(self.lines)
+
+    @property
+    def fpaTempC(self):
+        return self.fpaTemp / 10.0 - 273.15
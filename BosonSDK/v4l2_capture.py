@@ -0,0 +1,356 @@
+"""
+V4L2 streaming capture straight into numpy, no OpenCV.
+
+The video node's MMAP buffers are mapped once; every frame is handed out as
+numpy views onto its buffer - the image and, for the 640x514 framesize, the
+telemetry rows split off below it - so nothing is converted or copied:
+
+    with Capture("/dev/video0", 640, 514, "Y16 ") as cap:
+        for frame in cap:
+            analyse(frame.image)                # (512, 640) uint16 view
+            tel = TelemetryLines(frame.telemetry[0])
+
+A frame's buffer goes back to the driver when the loop moves on (or on
+frame.release() when using read()), after which the views show the next
+frame written there; copy what has to outlive it. exportDmabuf() gives a
+buffer's dma-buf fd to hand the frames to other devices.
+
+Formats: GREY (uint8), Y16 and Y14 (uint16; the camera sends RAW14, so the
+values are right-aligned 14-bit unless the receiver shifts them up) and UYVY
+((h, w, 2) uint8, U/V then Y per pixel). Single-planar capture devices only.
+"""
+
+import ctypes
+import errno
+import fcntl
+import mmap
+import os
+import select
+
+import numpy as np
+
+V4L2_BUF_TYPE_VIDEO_CAPTURE = 1
+V4L2_MEMORY_MMAP = 1
+V4L2_FIELD_NONE = 1
+V4L2_CAP_VIDEO_CAPTURE = 0x00000001
+V4L2_CAP_STREAMING = 0x04000000
+V4L2_CAP_DEVICE_CAPS = 0x80000000
+
+TELEMETRY_ROWS = {514: 2}   # framesize height -> rows the driver adds (FLIR_BOSON_TELEMETRY_LINES)
+
+
+def fourccCode(fourcc):
+    return sum(ord(c) << (8 * i) for i, c in enumerate(fourcc.ljust(4)))
+
+# fourcc -> (pixel dtype, values per pixel)
+FORMATS = {
+    "GREY": (np.uint8, 1),
+    "Y16 ": (np.uint16, 1),
+    "Y14 ": (np.uint16, 1),
+    "UYVY": (np.uint8, 2),
+}
+
+
+class v4l2_capability(ctypes.Structure):
+    _fields_ = [("driver", ctypes.c_char * 16),
+                ("card", ctypes.c_char * 32),
+                ("bus_info", ctypes.c_char * 32),
+                ("version", ctypes.c_uint32),
+                ("capabilities", ctypes.c_uint32),
+                ("device_caps", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 3)]
+
+
+class v4l2_pix_format(ctypes.Structure):
+    _fields_ = [("width", ctypes.c_uint32),
+                ("height", ctypes.c_uint32),
+                ("pixelformat", ctypes.c_uint32),
+                ("field", ctypes.c_uint32),
+                ("bytesperline", ctypes.c_uint32),
+                ("sizeimage", ctypes.c_uint32),
+                ("colorspace", ctypes.c_uint32),
+                ("priv", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("ycbcr_enc", ctypes.c_uint32),
+                ("quantization", ctypes.c_uint32),
+                ("xfer_func", ctypes.c_uint32)]
+
+
+class v4l2_format_fmt(ctypes.Union):
+    # raw_data is 200 bytes; the v4l2_window member has pointers, hence the alignment
+    _fields_ = [("pix", v4l2_pix_format),
+                ("raw_data", ctypes.c_uint8 * 200),
+                ("align", ctypes.c_void_p)]
+
+
+class v4l2_format(ctypes.Structure):
+    _fields_ = [("type", ctypes.c_uint32),
+                ("fmt", v4l2_format_fmt)]
+
+
+class v4l2_fract(ctypes.Structure):
+    _fields_ = [("numerator", ctypes.c_uint32),
+                ("denominator", ctypes.c_uint32)]
+
+
+class v4l2_captureparm(ctypes.Structure):
+    _fields_ = [("capability", ctypes.c_uint32),
+                ("capturemode", ctypes.c_uint32),
+                ("timeperframe", v4l2_fract),
+                ("extendedmode", ctypes.c_uint32),
+                ("readbuffers", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32 * 4)]
+
+
+class v4l2_streamparm_parm(ctypes.Union):
+    _fields_ = [("capture", v4l2_captureparm),
+                ("raw_data", ctypes.c_uint8 * 200)]
+
+
+class v4l2_streamparm(ctypes.Structure):
+    _fields_ = [("type", ctypes.c_uint32),
+                ("parm", v4l2_streamparm_parm)]
+
+
+class v4l2_requestbuffers(ctypes.Structure):
+    _fields_ = [("count", ctypes.c_uint32),
+                ("type", ctypes.c_uint32),
+                ("memory", ctypes.c_uint32),
+                ("capabilities", ctypes.c_uint32),
+                ("reserved", ctypes.c_uint32)]
+
+
+class timeval(ctypes.Structure):
+    _fields_ = [("tv_sec", ctypes.c_long),
+                ("tv_usec", ctypes.c_long)]
+
+
+class v4l2_timecode(ctypes.Structure):
+    _fields_ = [("type", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("frames", ctypes.c_uint8),
+                ("seconds", ctypes.c_uint8),
+                ("minutes", ctypes.c_uint8),
+                ("hours", ctypes.c_uint8),
+                ("userbits", ctypes.c_uint8 * 4)]
+
+
+class v4l2_buffer_m(ctypes.Union):
+    _fields_ = [("offset", ctypes.c_uint32),
+                ("userptr", ctypes.c_ulong),
+                ("planes", ctypes.c_void_p),
+                ("fd", ctypes.c_int32)]
+
+
+class v4l2_buffer(ctypes.Structure):
+    _fields_ = [("index", ctypes.c_uint32),
+                ("type", ctypes.c_uint32),
+                ("bytesused", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("field", ctypes.c_uint32),
+                ("timestamp", timeval),
+                ("timecode", v4l2_timecode),
+                ("sequence", ctypes.c_uint32),
+                ("memory", ctypes.c_uint32),
+                ("m", v4l2_buffer_m),
+                ("length", ctypes.c_uint32),
+                ("reserved2", ctypes.c_uint32),
+                ("request_fd", ctypes.c_int32)]
+
+
+class v4l2_exportbuffer(ctypes.Structure):
+    _fields_ = [("type", ctypes.c_uint32),
+                ("index", ctypes.c_uint32),
+                ("plane", ctypes.c_uint32),
+                ("flags", ctypes.c_uint32),
+                ("fd", ctypes.c_int32),
+                ("reserved", ctypes.c_uint32 * 11)]
+
+
+def _IOC(dir, nr, struct):
+    return (dir << 30) | (ctypes.sizeof(struct) << 16) | (ord('V') << 8) | nr
+
+VIDIOC_QUERYCAP = _IOC(2, 0, v4l2_capability)
+VIDIOC_S_FMT = _IOC(3, 5, v4l2_format)
+VIDIOC_REQBUFS = _IOC(3, 8, v4l2_requestbuffers)
+VIDIOC_QUERYBUF = _IOC(3, 9, v4l2_buffer)
+VIDIOC_QBUF = _IOC(3, 15, v4l2_buffer)
+VIDIOC_EXPBUF = _IOC(3, 16, v4l2_exportbuffer)
+VIDIOC_DQBUF = _IOC(3, 17, v4l2_buffer)
+VIDIOC_STREAMON = _IOC(1, 18, ctypes.c_int)
+VIDIOC_STREAMOFF = _IOC(1, 19, ctypes.c_int)
+VIDIOC_S_PARM = _IOC(3, 22, v4l2_streamparm)
+
+
+class Frame:
+    '''One dequeued buffer. image and telemetry are views onto it, valid
+    until release().'''
+
+    def __init__(self, capture, buf, image, telemetry):
+        self.capture = capture
+        self.index = buf.index
+        self.sequence = buf.sequence
+        self.timestamp = buf.timestamp.tv_sec + buf.timestamp.tv_usec / 1e6
+        self.bytesused = buf.bytesused
+        self.image = image
+        self.telemetry = telemetry
+
+    def release(self):
+        # after stop(), start() queues every buffer again itself
+        if self.capture is not None and self.capture.streaming:
+            self.capture.queue(self.index)
+        self.capture = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.release()
+
+
+class Capture:
+    '''Streams fourcc frames of width x height from a V4L2 video node into
+    `buffers` mapped buffers. telemetryRows defaults to the driver's rows for
+    the framesize (2 for 640x514); they are split off the bottom, or the top
+    with telemetryTop=True.'''
+
+    def __init__(self, device="/dev/video0", width=640, height=512, fourcc="Y16 ", fps=None,
+                 buffers=4, telemetryRows=None, telemetryTop=False):
+        if fourcc not in FORMATS:
+            raise ValueError("{!r} is not one of {}".format(fourcc, ", ".join(map(repr, FORMATS))))
+        self.device = device
+        self.fourcc = fourcc
+        self.dtype, self.channels = FORMATS[fourcc]
+        self.telemetryRows = TELEMETRY_ROWS.get(height, 0) if telemetryRows is None else telemetryRows
+        self.telemetryTop = telemetryTop
+        self.maps = []
+        self.streaming = False
+        self.fd = os.open(device, os.O_RDWR | os.O_NONBLOCK)
+        try:
+            self._setup(width, height, fps, buffers)
+        except Exception:
+            self.close()
+            raise
+
+    def _ioctl(self, request, arg):
+        fcntl.ioctl(self.fd, request, arg)
+        return arg
+
+    def _setup(self, width, height, fps, buffers):
+        cap = self._ioctl(VIDIOC_QUERYCAP, v4l2_capability())
+        caps = cap.device_caps if cap.capabilities & V4L2_CAP_DEVICE_CAPS else cap.capabilities
+        if not caps & V4L2_CAP_VIDEO_CAPTURE or not caps & V4L2_CAP_STREAMING:
+            raise OSError(errno.ENODEV, "{} is not a single-planar streaming capture node".format(self.device))
+
+        fmt = v4l2_format(type=V4L2_BUF_TYPE_VIDEO_CAPTURE)
+        fmt.fmt.pix.width, fmt.fmt.pix.height = width, height
+        fmt.fmt.pix.pixelformat = fourccCode(self.fourcc)
+        fmt.fmt.pix.field = V4L2_FIELD_NONE
+        pix = self._ioctl(VIDIOC_S_FMT, fmt).fmt.pix
+        if (pix.width, pix.height, pix.pixelformat) != (width, height, fourccCode(self.fourcc)):
+            raise ValueError("{} does not capture {}x{} {!r}".format(self.device, width, height, self.fourcc))
+        self.width, self.height, self.bytesperline = pix.width, pix.height, pix.bytesperline
+
+        if fps:
+            parm = v4l2_streamparm(type=V4L2_BUF_TYPE_VIDEO_CAPTURE)
+            parm.parm.capture.timeperframe = v4l2_fract(1, fps)
+            self._ioctl(VIDIOC_S_PARM, parm)
+
+        req = self._ioctl(VIDIOC_REQBUFS, v4l2_requestbuffers(count=buffers, type=V4L2_BUF_TYPE_VIDEO_CAPTURE,
+                                                              memory=V4L2_MEMORY_MMAP))
+        for index in range(req.count):
+            buf = self._ioctl(VIDIOC_QUERYBUF, v4l2_buffer(index=index, type=V4L2_BUF_TYPE_VIDEO_CAPTURE,
+                                                           memory=V4L2_MEMORY_MMAP))
+            self.maps.append(mmap.mmap(self.fd, buf.length, mmap.MAP_SHARED,
+                                       mmap.PROT_READ | mmap.PROT_WRITE, offset=buf.m.offset))
+        self.views = [self._views(m) for m in self.maps]
+
+    def _views(self, buffer):
+        # (image, telemetry) of one mapped buffer, strided to bytesperline
+        itemsize = np.dtype(self.dtype).itemsize
+        rowShape = (self.width, self.channels) if self.channels > 1 else (self.width,)
+        rowStrides = (self.channels * itemsize, itemsize) if self.channels > 1 else (itemsize,)
+
+        def rows(first, count):
+            return np.ndarray((count,) + rowShape, self.dtype, buffer, first * self.bytesperline,
+                              (self.bytesperline,) + rowStrides)
+
+        imageRows = self.height - self.telemetryRows
+        imageFirst = self.telemetryRows if self.telemetryTop else 0
+        image = rows(imageFirst, imageRows)
+        # telemetry keeps one element per pixel, e.g. uint16 for UYVY
+        telDtype = np.dtype(self.dtype) if self.channels == 1 else np.dtype("u{:d}".format(self.channels * itemsize))
+        telemetry = np.ndarray((self.telemetryRows, self.width), telDtype, buffer,
+                               (0 if self.telemetryTop else imageRows) * self.bytesperline,
+                               (self.bytesperline, telDtype.itemsize))
+        return image, telemetry
+
+    def queue(self, index):
+        self._ioctl(VIDIOC_QBUF, v4l2_buffer(index=index, type=V4L2_BUF_TYPE_VIDEO_CAPTURE,
+                                             memory=V4L2_MEMORY_MMAP))
+
+    def start(self):
+        if not self.streaming:
+            for index in range(len(self.maps)):
+                self.queue(index)
+            self._ioctl(VIDIOC_STREAMON, ctypes.c_int(V4L2_BUF_TYPE_VIDEO_CAPTURE))
+            self.streaming = True
+
+    def stop(self):
+        if self.streaming:
+            # STREAMOFF also takes every buffer back from the driver
+            self._ioctl(VIDIOC_STREAMOFF, ctypes.c_int(V4L2_BUF_TYPE_VIDEO_CAPTURE))
+            self.streaming = False
+
+    def read(self, timeout=1.0):
+        '''The next frame, or None after timeout seconds. Release it (or use it
+        as a context manager) to give the buffer back.'''
+        self.start()
+        buf = v4l2_buffer(type=V4L2_BUF_TYPE_VIDEO_CAPTURE, memory=V4L2_MEMORY_MMAP)
+        while True:
+            try:
+                fcntl.ioctl(self.fd, VIDIOC_DQBUF, buf)
+                break
+            except BlockingIOError:
+                if not select.select([self.fd], [], [], timeout)[0]:
+                    return None
+        image, telemetry = self.views[buf.index]
+        return Frame(self, buf, image, telemetry)
+
+    def __iter__(self):
+        # each frame is released when the next one is asked for
+        while True:
+            frame = self.read()
+            if frame is None:
+                return
+            try:
+                yield frame
+            finally:
+                frame.release()
+
+    def exportDmabuf(self, index):
+        '''A dma-buf fd for buffer index; the caller closes it.'''
+        return self._ioctl(VIDIOC_EXPBUF, v4l2_exportbuffer(type=V4L2_BUF_TYPE_VIDEO_CAPTURE,
+                                                            index=index, flags=os.O_RDWR | os.O_CLOEXEC)).fd
+
+    def close(self):
+        if self.fd is None:
+            return
+        try:
+            self.stop()
+        finally:
+            self.views = []
+            for m in self.maps:
+                try:
+                    m.close()
+                except BufferError:
+                    pass    # frames still referenced; unmapped when they go
+            self.maps = []
+            os.close(self.fd)
+            self.fd = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.close()
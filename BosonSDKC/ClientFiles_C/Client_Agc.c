@@ -0,0 +1,237 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Client_Agc.h"
+
+#define COUNTS_MASK  (CLIENT_AGC_BINS - 1)
+#define SUB_HISTS    (4)
+#define DIV9_Q16     (7282u)    // ~65536 / 9; nine 14-bit counts still round to at most 16383
+
+#if defined(__GNUC__)
+#define RESTRICT __restrict__
+#else
+#define RESTRICT
+#endif
+
+struct boson_agc {
+    CLIENT_AGC_PARAMS params;
+    uint32_t width;
+    uint32_t height;
+    uint8_t primed;                             // table holds a previous frame
+    uint32_t hist[SUB_HISTS][CLIENT_AGC_BINS];
+    float table[CLIENT_AGC_BINS];               // damped output levels, 0..255
+    uint8_t lut[CLIENT_AGC_BINS];
+    uint32_t *colSums;                          // DDE: 3-row sums of one row
+};
+
+void CLIENT_agcDefaultParams(CLIENT_AGC_PARAMS *params)
+{
+    params->plateau = 7.0f;
+    params->linearPercent = 20.0f;
+    params->maxGain = 1.25f;
+    params->gamma = 0.9f;
+    params->outlierCut = 0.0f;
+    params->d2br = 1.3f;
+    params->damping = 0.0f;
+}
+
+CLIENT_AGC *CLIENT_agcCreate(uint32_t width, uint32_t height, const CLIENT_AGC_PARAMS *params)
+{
+    CLIENT_AGC *agc;
+
+    if (width == 0 || height == 0)
+        return NULL;
+    agc = calloc(1, sizeof(*agc));
+    if (!agc)
+        return NULL;
+    agc->colSums = calloc(width, sizeof(*agc->colSums));
+    if (!agc->colSums) {
+        free(agc);
+        return NULL;
+    }
+    agc->width = width;
+    agc->height = height;
+    if (params)
+        agc->params = *params;
+    else
+        CLIENT_agcDefaultParams(&agc->params);
+    return agc;
+}
+
+void CLIENT_agcDestroy(CLIENT_AGC *agc)
+{
+    if (!agc)
+        return;
+    free(agc->colSums);
+    free(agc);
+}
+
+void CLIENT_agcSetParams(CLIENT_AGC *agc, const CLIENT_AGC_PARAMS *params)
+{
+    agc->params = *params;
+}
+
+const uint8_t *CLIENT_agcLut(const CLIENT_AGC *agc)
+{
+    return agc->lut;
+}
+
+/*
+ * Four sub-histograms, so consecutive pixels of equal value don't wait on
+ * each other's increment; the merge vectorizes.
+ */
+static uint32_t *agcHistogram(CLIENT_AGC *agc, const uint16_t *counts, uint32_t rowStride,
+                              uint32_t width, uint32_t height)
+{
+    uint32_t *RESTRICT h0 = agc->hist[0];
+    uint32_t *RESTRICT h1 = agc->hist[1];
+    uint32_t *RESTRICT h2 = agc->hist[2];
+    uint32_t *RESTRICT h3 = agc->hist[3];
+    uint32_t x, y, i;
+
+    memset(agc->hist, 0, sizeof(agc->hist));
+    for (y = 0; y < height; y++, counts += rowStride) {
+        for (x = 0; x + 4 <= width; x += 4) {
+            h0[counts[x] & COUNTS_MASK]++;
+            h1[counts[x + 1] & COUNTS_MASK]++;
+            h2[counts[x + 2] & COUNTS_MASK]++;
+            h3[counts[x + 3] & COUNTS_MASK]++;
+        }
+        for (; x < width; x++)
+            h0[counts[x] & COUNTS_MASK]++;
+    }
+    for (i = 0; i < CLIENT_AGC_BINS; i++)
+        h0[i] += h1[i] + h2[i] + h3[i];
+    return h0;
+}
+
+static void agcBuildTable(CLIENT_AGC *agc, const uint32_t *hist, uint32_t total)
+{
+    const CLIENT_AGC_PARAMS *p = &agc->params;
+    float cut = (float)total * p->outlierCut / 100.0f;
+    float linear = p->linearPercent / 100.0f;
+    float damping = agc->primed ? p->damping : 0.0f;
+    float cap, range, sum = 0.0f, acc = 0.0f;
+    uint32_t lo, hi, i;
+    uint64_t tail;
+
+    for (lo = 0, tail = 0; lo < CLIENT_AGC_BINS - 1; lo++) {
+        tail += hist[lo];
+        if ((float)tail > cut)
+            break;
+    }
+    for (hi = CLIENT_AGC_BINS - 1, tail = 0; hi > lo; hi--) {
+        tail += hist[hi];
+        if ((float)tail > cut)
+            break;
+    }
+    range = (float)(hi - lo + 1);
+
+    // the plateau, and the slope limit: a bin of b pixels gets b/total of the
+    // output, maxGain times the 1/range of a linear stretch at most
+    cap = (float)total * p->plateau / 100.0f;
+    if (cap > p->maxGain * (float)total / range)
+        cap = p->maxGain * (float)total / range;
+    if (cap < 1.0f)
+        cap = 1.0f;
+
+    for (i = lo; i <= hi; i++)
+        sum += (float)hist[i] < cap ? (float)hist[i] : cap;
+    if (sum <= 0.0f)
+        sum = 1.0f;
+
+    for (i = 0; i < CLIENT_AGC_BINS; i++) {
+        float level;
+
+        if (i < lo) {
+            level = 0.0f;
+        } else if (i > hi) {
+            level = 255.0f;
+        } else {
+            float bin = (float)hist[i] < cap ? (float)hist[i] : cap;
+            float v = (1.0f - linear) * (acc + 0.5f * bin) / sum + linear * ((float)(i - lo) + 0.5f) / range;
+
+            acc += bin;
+            level = 255.0f * powf(v, p->gamma);
+        }
+        agc->table[i] = damping * agc->table[i] + (1.0f - damping) * level;
+    }
+    for (i = 0; i < CLIENT_AGC_BINS; i++)
+        agc->lut[i] = (uint8_t)(agc->table[i] + 0.5f);
+    agc->primed = 1;
+}
+
+static void agcApply(const uint8_t *RESTRICT lut, const uint16_t *RESTRICT counts, uint32_t rowStride,
+                     uint32_t width, uint32_t height, uint8_t *RESTRICT out, uint32_t outStride)
+{
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++, counts += rowStride, out += outStride)
+        for (x = 0; x < width; x++)
+            out[x] = lut[counts[x] & COUNTS_MASK];
+}
+
+/*
+ * Detail enhancement around a 3x3 mean. Column sums of three rows first,
+ * then three adjacent column sums per pixel: both passes are plain vector
+ * arithmetic, only the two table lookups per pixel stay scalar.
+ */
+static void agcApplyDde(CLIENT_AGC *agc, const uint16_t *counts, uint32_t rowStride,
+                        uint32_t width, uint32_t height, uint8_t *out, uint32_t outStride)
+{
+    const float *RESTRICT table = agc->table;
+    uint32_t *RESTRICT colSums = agc->colSums;
+    float d2br = agc->params.d2br;
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++, out += outStride) {
+        const uint16_t *RESTRICT above = counts + (y ? y - 1 : 0) * rowStride;
+        const uint16_t *RESTRICT row = counts + y * rowStride;
+        const uint16_t *RESTRICT below = counts + (y + 1 < height ? y + 1 : y) * rowStride;
+
+        for (x = 0; x < width; x++)
+            colSums[x] = (uint32_t)(above[x] & COUNTS_MASK) + (row[x] & COUNTS_MASK) + (below[x] & COUNTS_MASK);
+        for (x = 0; x < width; x++) {
+            uint32_t left = colSums[x ? x - 1 : 0];
+            uint32_t right = colSums[x + 1 < width ? x + 1 : x];
+            uint32_t background = ((left + colSums[x] + right) * DIV9_Q16 >> 16) & COUNTS_MASK;
+            float base = table[background];
+            float v = base + d2br * (table[row[x] & COUNTS_MASK] - base);
+
+            v = v < 0.0f ? 0.0f : (v > 255.0f ? 255.0f : v);
+            out[x] = (uint8_t)(v + 0.5f);
+        }
+    }
+}
+
+int32_t CLIENT_agcProcess(CLIENT_AGC *agc, const uint16_t *counts, uint32_t rowStride,
+                          uint32_t width, uint32_t height, uint8_t *out, uint32_t outStride)
+{
+    uint32_t *hist;
+
+    if (!agc || !counts || !out || width > agc->width || height > agc->height || width == 0 || height == 0)
+        return -1;
+    hist = agcHistogram(agc, counts, rowStride, width, height);
+    agcBuildTable(agc, hist, width * height);
+    if (fabsf(agc->params.d2br - 1.0f) < 0.001f)
+        agcApply(agc->lut, counts, rowStride, width, height, out, outStride);
+    else
+        agcApplyDde(agc, counts, rowStride, width, height, out, outStride);
+    return 0;
+}
@@ -0,0 +1,78 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef CLIENT_AGC_H
+#define CLIENT_AGC_H
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Host-side plateau-equalisation AGC, Y14 counts to 8 bits.
+ *
+ * Stream RAW14 once and make the display image on the host, instead of
+ * switching the camera to RAW8 (a format change with FFC). The parameters
+ * are the camera's AGC knobs, in the same units as the driver's controls
+ * divided by 1000:
+ *
+ *   histogram of the frame, outlierCut % dropped off each end
+ *   each bin clipped to plateau % of the pixels and to maxGain times
+ *     the slope of a linear stretch of the remaining range
+ *   table = linearPercent % linear stretch + the rest equalised, ^gamma
+ *   damping blends in the previous frame's table
+ *   DDE: out = T(background) + d2br * (T(pixel) - T(background)), the
+ *     background a 3x3 mean; d2br 1 leaves the detail as it is
+ *
+ * It follows the camera's controls, not its firmware bit for bit, and
+ * useEntropy has no counterpart. With no SDK dependencies, it builds on
+ * its own as "make Agc_64.so" for BosonSDK/agc.py.
+ */
+
+#define CLIENT_AGC_BINS  (16384)    // one per 14-bit count
+
+typedef struct {
+    float plateau;          // % of the pixels per bin, V4L2_CID_FLIR_AGC_PLATEAU / 1000
+    float linearPercent;    // V4L2_CID_FLIR_AGC_LINEAR_PERCENT / 1000
+    float maxGain;          // V4L2_CID_FLIR_AGC_MAX_GAIN / 1000
+    float gamma;            // V4L2_CID_FLIR_AGC_GAMMA / 1000
+    float outlierCut;       // % per end, V4L2_CID_FLIR_AGC_OUTLIER_CUT / 1000
+    float d2br;             // V4L2_CID_FLIR_AGC_D2BR / 1000
+    float damping;          // 0 new table every frame .. 1 frozen
+} CLIENT_AGC_PARAMS;
+
+typedef struct boson_agc CLIENT_AGC;
+
+// The driver's control defaults
+FLR_EXPORT void CLIENT_agcDefaultParams(CLIENT_AGC_PARAMS *params);
+
+// State for frames of up to width x height; NULL when out of memory
+FLR_EXPORT CLIENT_AGC *CLIENT_agcCreate(uint32_t width, uint32_t height, const CLIENT_AGC_PARAMS *params);
+FLR_EXPORT void CLIENT_agcDestroy(CLIENT_AGC *agc);
+FLR_EXPORT void CLIENT_agcSetParams(CLIENT_AGC *agc, const CLIENT_AGC_PARAMS *params);
+
+// One frame: histogram, table, 8-bit image. Strides are in pixels. Returns
+// -1 when the frame is larger than the one given to CLIENT_agcCreate()
+FLR_EXPORT int32_t CLIENT_agcProcess(CLIENT_AGC *agc, const uint16_t *counts, uint32_t rowStride,
+                                     uint32_t width, uint32_t height, uint8_t *out, uint32_t outStride);
+
+// The table of the last frame, CLIENT_AGC_BINS entries
+FLR_EXPORT const uint8_t *CLIENT_agcLut(const CLIENT_AGC *agc);
+
+#endif
@@ -0,0 +1,346 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "Client_Config.h"
+#include "Client_Pipeline.h"
+#include "FunctionCodes.h"
+#include "Serializer_BuiltIn.h"
+
+typedef struct {
+    FLR_FUNCTION getFn;
+    FLR_FUNCTION setFn;
+    uint16_t bytes;         // value size, same for the get response and the set command
+    uint8_t group;
+} CONFIG_ITEM;
+
+/* Every get/set pair of the groups whose get takes no argument and whose
+   set takes exactly what the get returns, in Client_Packager.c order.
+   Left out: DVO MIPI state (stream start/stop, owned by the video path)
+   and the factory RBFO calibration. */
+static const CONFIG_ITEM items[] = {
+    { AGC_GETPERCENTPERBIN, AGC_SETPERCENTPERBIN, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETLINEARPERCENT, AGC_SETLINEARPERCENT, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETOUTLIERCUT, AGC_SETOUTLIERCUT, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETMAXGAIN, AGC_SETMAXGAIN, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETDF, AGC_SETDF, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETGAMMA, AGC_SETGAMMA, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETDETAILHEADROOM, AGC_SETDETAILHEADROOM, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETD2BR, AGC_SETD2BR, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETSIGMAR, AGC_SETSIGMAR, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETUSEENTROPY, AGC_SETUSEENTROPY, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETROI, AGC_SETROI, 8, CLIENT_CONFIG_AGC },
+    { AGC_GETOUTLIERCUTBALANCE, AGC_SETOUTLIERCUTBALANCE, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETDETAILHEADROOMBALANCE, AGC_SETDETAILHEADROOMBALANCE, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETTFTHRESHOLDS, AGC_SETTFTHRESHOLDS, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETMODE, AGC_SETMODE, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETCONTRAST, AGC_SETCONTRAST, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETBRIGHTNESSBIAS, AGC_SETBRIGHTNESSBIAS, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETBRIGHTNESS, AGC_SETBRIGHTNESS, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETMAXGAINFORLOWGAIN, AGC_SETMAXGAINFORLOWGAIN, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETRADIUS, AGC_SETRADIUS, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETGMAX, AGC_SETGMAX, 4, CLIENT_CONFIG_AGC },
+    { AGC_GETGMIN, AGC_SETGMIN, 4, CLIENT_CONFIG_AGC },
+    { DVO_GETANALOGVIDEOSTATE, DVO_SETANALOGVIDEOSTATE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETOUTPUTFORMAT, DVO_SETOUTPUTFORMAT, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETOUTPUTYCBCRSETTINGS, DVO_SETOUTPUTYCBCRSETTINGS, 12, CLIENT_CONFIG_DVO },
+    { DVO_GETOUTPUTRGBSETTINGS, DVO_SETOUTPUTRGBSETTINGS, 8, CLIENT_CONFIG_DVO },
+    { DVO_GETDISPLAYMODE, DVO_SETDISPLAYMODE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETTYPE, DVO_SETTYPE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETVIDEOSTANDARD, DVO_SETVIDEOSTANDARD, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETCHECKVIDEODACPRESENT, DVO_SETCHECKVIDEODACPRESENT, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETLCDCONFIG, DVO_SETLCDCONFIG, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETALLCUSTOMLCDCONFIGS, DVO_SETALLCUSTOMLCDCONFIGS, 96, CLIENT_CONFIG_DVO },
+    { DVO_GETOUTPUTIR16FORMAT, DVO_SETOUTPUTIR16FORMAT, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETLCDCLOCKRATE, DVO_SETLCDCLOCKRATE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETLCDVIDEOFRAMERATE, DVO_SETLCDVIDEOFRAMERATE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETMIPISTARTSTATE, DVO_SETMIPISTARTSTATE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETMIPICLOCKLANEMODE, DVO_SETMIPICLOCKLANEMODE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETOUTPUTINTERFACE, DVO_SETOUTPUTINTERFACE, 4, CLIENT_CONFIG_DVO },
+    { DVO_GETOUTPUTFORMATVC1, DVO_SETOUTPUTFORMATVC1, 4, CLIENT_CONFIG_DVO },
+    { RADIOMETRY_GETTEMPSTABLEENABLE, RADIOMETRY_SETTEMPSTABLEENABLE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETFNUMBERLENS0, RADIOMETRY_SETFNUMBERLENS0, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETFNUMBERLENS1, RADIOMETRY_SETFNUMBERLENS1, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTAULENS0, RADIOMETRY_SETTAULENS0, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTAULENS1, RADIOMETRY_SETTAULENS1, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTCOMPONENTOVERRIDEMODE, RADIOMETRY_SETTCOMPONENTOVERRIDEMODE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETGLOBALGAINOVERRIDE, RADIOMETRY_SETGLOBALGAINOVERRIDE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETGLOBALOFFSETOVERRIDE, RADIOMETRY_SETGLOBALOFFSETOVERRIDE, 2, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETGLOBALPARAMOVERRIDEMODE, RADIOMETRY_SETGLOBALPARAMOVERRIDEMODE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETRBFOHIGHGAINDEFAULT, RADIOMETRY_SETRBFOHIGHGAINDEFAULT, 16, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETRBFOLOWGAINDEFAULT, RADIOMETRY_SETRBFOLOWGAINDEFAULT, 16, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETDAMPINGFACTOR, RADIOMETRY_SETDAMPINGFACTOR, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETFNUMBERSHUTTERHOUSING, RADIOMETRY_SETFNUMBERSHUTTERHOUSING, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETEMISSIVITYSHUTTERHOUSING, RADIOMETRY_SETEMISSIVITYSHUTTERHOUSING, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DTFPA_LENS, RADIOMETRY_SETM_DTFPA_LENS, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETOFFSET_LENS, RADIOMETRY_SETOFFSET_LENS, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_RECURSIVE_LENS, RADIOMETRY_SETM_RECURSIVE_LENS, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPLENSHOUSINGOVERRIDE, RADIOMETRY_SETTEMPLENSHOUSINGOVERRIDE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPSHUTTERHOUSINGOVERRIDE, RADIOMETRY_SETTEMPSHUTTERHOUSINGOVERRIDE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPSHUTTERPADDLEOVERRIDE, RADIOMETRY_SETTEMPSHUTTERPADDLEOVERRIDE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETSIGNALFACTORLUT, RADIOMETRY_SETSIGNALFACTORLUT, 34, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETNOISEFACTORLUT, RADIOMETRY_SETNOISEFACTORLUT, 34, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_TFPAK, RADIOMETRY_SETM_TFPAK, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_TFPAK, RADIOMETRY_SETB_TFPAK, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTAUXPARAMS, RADIOMETRY_SETTAUXPARAMS, 16, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_TAUX, RADIOMETRY_SETM_TAUX, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_TAUX, RADIOMETRY_SETB_TAUX, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTSOURCE_FFC, RADIOMETRY_SETTSOURCE_FFC, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DTFPA_SH_H, RADIOMETRY_SETM_DTFPA_SH_H, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETOFFSET_SH_H, RADIOMETRY_SETOFFSET_SH_H, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_RECURSIVE_SH_H, RADIOMETRY_SETM_RECURSIVE_SH_H, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DTFPA_SH_P, RADIOMETRY_SETM_DTFPA_SH_P, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETOFFSET_SH_P, RADIOMETRY_SETOFFSET_SH_P, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_RECURSIVE_SH_P, RADIOMETRY_SETM_RECURSIVE_SH_P, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_SH_P, RADIOMETRY_SETM_DELTA_SH_P, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_SH_P, RADIOMETRY_SETB_DELTA_SH_P, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETEXTERNALFFCUPDATEMODE, RADIOMETRY_SETEXTERNALFFCUPDATEMODE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPWINDOW, RADIOMETRY_SETTEMPWINDOW, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTRANSMISSIONWINDOW, RADIOMETRY_SETTRANSMISSIONWINDOW, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETREFLECTIVITYWINDOW, RADIOMETRY_SETREFLECTIVITYWINDOW, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPWINDOWREFLECTION, RADIOMETRY_SETTEMPWINDOWREFLECTION, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTRANSMISSIONATMOSPHERE, RADIOMETRY_SETTRANSMISSIONATMOSPHERE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPATMOSPHERE, RADIOMETRY_SETTEMPATMOSPHERE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETEMISSIVITYTARGET, RADIOMETRY_SETEMISSIVITYTARGET, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPBACKGROUND, RADIOMETRY_SETTEMPBACKGROUND, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETDELTATEMPDAMPINGFACTOR, RADIOMETRY_SETDELTATEMPDAMPINGFACTOR, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETDELTATEMPINTERVALTIME, RADIOMETRY_SETDELTATEMPINTERVALTIME, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETDELTATEMPMAXVALUE, RADIOMETRY_SETDELTATEMPMAXVALUE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETDELTATEMPMAXINCREMENT, RADIOMETRY_SETDELTATEMPMAXINCREMENT, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETDELTATEMPDAMPINGTIME, RADIOMETRY_SETDELTATEMPDAMPINGTIME, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_LENS, RADIOMETRY_SETM_DELTA_LENS, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_LENS, RADIOMETRY_SETB_DELTA_LENS, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_SH_H, RADIOMETRY_SETM_DELTA_SH_H, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_SH_H, RADIOMETRY_SETB_DELTA_SH_H, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETGG_SCALE_HG, RADIOMETRY_SETGG_SCALE_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETGG_SCALE_LG, RADIOMETRY_SETGG_SCALE_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETRBFOSCALEDMODE, RADIOMETRY_SETRBFOSCALEDMODE, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPERATUREOFFSET_HG, RADIOMETRY_SETTEMPERATUREOFFSET_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETTEMPERATUREOFFSET_LG, RADIOMETRY_SETTEMPERATUREOFFSET_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_LENS_HG, RADIOMETRY_SETM_DELTA_LENS_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_LENS_HG, RADIOMETRY_SETB_DELTA_LENS_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_LENS_LG, RADIOMETRY_SETM_DELTA_LENS_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_LENS_LG, RADIOMETRY_SETB_DELTA_LENS_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETOFFSET_LENS_HG, RADIOMETRY_SETOFFSET_LENS_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETOFFSET_LENS_LG, RADIOMETRY_SETOFFSET_LENS_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_SH_P_HG, RADIOMETRY_SETM_DELTA_SH_P_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_SH_P_HG, RADIOMETRY_SETB_DELTA_SH_P_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_SH_P_LG, RADIOMETRY_SETM_DELTA_SH_P_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_SH_P_LG, RADIOMETRY_SETB_DELTA_SH_P_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_SH_H_HG, RADIOMETRY_SETM_DELTA_SH_H_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_SH_H_HG, RADIOMETRY_SETB_DELTA_SH_H_HG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETM_DELTA_SH_H_LG, RADIOMETRY_SETM_DELTA_SH_H_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { RADIOMETRY_GETB_DELTA_SH_H_LG, RADIOMETRY_SETB_DELTA_SH_H_LG, 4, CLIENT_CONFIG_RADIOMETRY },
+    { TELEMETRY_GETSTATE, TELEMETRY_SETSTATE, 4, CLIENT_CONFIG_TELEMETRY },
+    { TELEMETRY_GETLOCATION, TELEMETRY_SETLOCATION, 4, CLIENT_CONFIG_TELEMETRY },
+    { TELEMETRY_GETPACKING, TELEMETRY_SETPACKING, 4, CLIENT_CONFIG_TELEMETRY },
+    { TELEMETRY_GETORDER, TELEMETRY_SETORDER, 4, CLIENT_CONFIG_TELEMETRY },
+    { TELEMETRY_GETPACKINGVC1, TELEMETRY_SETPACKINGVC1, 4, CLIENT_CONFIG_TELEMETRY },
+    { TELEMETRY_GETMIPIEMBEDDEDDATATAG, TELEMETRY_SETMIPIEMBEDDEDDATATAG, 4, CLIENT_CONFIG_TELEMETRY },
+};
+
+typedef char CONFIG_ITEMS_MATCH_HEADER[(sizeof(items) / sizeof(items[0]) == CLIENT_CONFIG_ITEMS) ? 1 : -1];
+
+#define BLOB_MAGIC          "BCFG"
+#define BLOB_VERSION        (1)
+#define BLOB_HEADER_BYTES   (8)     // magic, version, item count
+#define BLOB_ITEM_BYTES     (6)     // get function code, value length
+
+typedef struct {
+    CLIENT_CONFIG *cfg;
+    uint16_t index;
+    uint16_t offset;
+    FLR_RESULT *error;
+} READ_REQ;
+
+// The link or the dispatcher failed, as opposed to the camera declining the command
+static int isTransportError(FLR_RESULT res)
+{
+    return (res >= FLR_COMM_PORT_NOT_OPEN && res <= FLR_COMM_COUNT_ERROR) ||
+           (res >= R_SDK_DSPCH_UNSPECIFIED_FAILURE && res <= R_SDK_DSPCH_MALFORMED_STATUS);
+}
+
+static void readDone(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *receiveData, uint32_t receiveBytes)
+{
+    READ_REQ *req = (READ_REQ *) context;
+    uint16_t bytes = items[req->index].bytes;
+
+    if (result == R_SUCCESS && receiveBytes >= bytes) {
+        memcpy(req->cfg->data + req->offset, receiveData, bytes);
+        req->cfg->valid[req->index] = 1;
+    } else if (isTransportError(result) && *req->error == R_SUCCESS) {
+        *req->error = result;
+    }
+}
+
+static void writeDone(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *receiveData, uint32_t receiveBytes)
+{
+    FLR_RESULT *error = (FLR_RESULT *) context;
+
+    if (result != R_SUCCESS && *error == R_SUCCESS)
+        *error = result;
+}
+
+FLR_RESULT CLIENT_configRead(CLIENT_CONFIG *cfg, uint32_t groups)
+{
+    READ_REQ reqs[CLIENT_CONFIG_ITEMS];
+    FLR_RESULT error = R_SUCCESS;
+    FLR_RESULT res;
+    uint16_t offset = 0;
+    uint16_t i;
+
+    if (!cfg)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    memset(cfg, 0, sizeof(*cfg));
+    cfg->groups = groups & CLIENT_CONFIG_ALL;
+
+    for (i = 0; i < CLIENT_CONFIG_ITEMS; offset += items[i].bytes, i++) {
+        if (!(items[i].group & cfg->groups))
+            continue;
+
+        reqs[i].cfg = cfg;
+        reqs[i].index = i;
+        reqs[i].offset = offset;
+        reqs[i].error = &error;
+        res = CLIENT_pipelineSubmit(items[i].getFn, NULL, 0, readDone, &reqs[i], NULL);
+        if (res != R_SUCCESS) {
+            CLIENT_pipelineFlush();
+            return res;
+        }
+    }
+
+    CLIENT_pipelineFlush();
+    return error;
+}
+
+FLR_RESULT CLIENT_configApply(const CLIENT_CONFIG *cfg, uint32_t *written)
+{
+    CLIENT_CONFIG current;
+    FLR_RESULT error = R_SUCCESS;
+    FLR_RESULT res;
+    uint32_t sent = 0;
+    uint16_t offset = 0;
+    uint16_t i;
+
+    if (written)
+        *written = 0;
+    if (!cfg)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    res = CLIENT_configRead(&current, cfg->groups);
+    if (res != R_SUCCESS)
+        return res;
+
+    for (i = 0; i < CLIENT_CONFIG_ITEMS; offset += items[i].bytes, i++) {
+        if (!cfg->valid[i])
+            continue;
+        if (current.valid[i] && !memcmp(current.data + offset, cfg->data + offset, items[i].bytes))
+            continue;
+
+        res = CLIENT_pipelineSubmit(items[i].setFn, cfg->data + offset, items[i].bytes, writeDone, &error, NULL);
+        if (res != R_SUCCESS) {
+            CLIENT_pipelineFlush();
+            return res;
+        }
+        sent++;
+    }
+
+    CLIENT_pipelineFlush();
+    if (written)
+        *written = sent;
+    return error;
+}
+
+uint32_t CLIENT_configCount(const CLIENT_CONFIG *cfg)
+{
+    uint32_t count = 0;
+    uint16_t i;
+
+    for (i = 0; i < CLIENT_CONFIG_ITEMS; i++)
+        count += cfg->valid[i];
+    return count;
+}
+
+uint32_t CLIENT_configSerialize(const CLIENT_CONFIG *cfg, uint8_t *buf, uint32_t bufBytes)
+{
+    uint32_t needed = BLOB_HEADER_BYTES;
+    uint16_t offset = 0;
+    uint16_t i;
+
+    for (i = 0; i < CLIENT_CONFIG_ITEMS; i++)
+        if (cfg->valid[i])
+            needed += BLOB_ITEM_BYTES + items[i].bytes;
+    if (!buf || bufBytes < needed)
+        return needed;
+
+    memcpy(buf, BLOB_MAGIC, 4);
+    UINT_16ToByte(BLOB_VERSION, buf + 4);
+    UINT_16ToByte((uint16_t) CLIENT_configCount(cfg), buf + 6);
+    buf += BLOB_HEADER_BYTES;
+
+    for (i = 0; i < CLIENT_CONFIG_ITEMS; offset += items[i].bytes, i++) {
+        if (!cfg->valid[i])
+            continue;
+        UINT_32ToByte((uint32_t) items[i].getFn, buf);
+        UINT_16ToByte(items[i].bytes, buf + 4);
+        memcpy(buf + BLOB_ITEM_BYTES, cfg->data + offset, items[i].bytes);
+        buf += BLOB_ITEM_BYTES + items[i].bytes;
+    }
+    return needed;
+}
+
+FLR_RESULT CLIENT_configDeserialize(CLIENT_CONFIG *cfg, const uint8_t *buf, uint32_t bufBytes)
+{
+    const uint8_t *end = buf + bufBytes;
+    uint16_t version, count;
+
+    if (!cfg || !buf)
+        return FLR_BAD_ARG_POINTER_ERROR;
+    if (bufBytes < BLOB_HEADER_BYTES || memcmp(buf, BLOB_MAGIC, 4))
+        return FLR_DATA_SIZE_ERROR;
+
+    byteToUINT_16(buf + 4, &version);
+    byteToUINT_16(buf + 6, &count);
+    if (version != BLOB_VERSION)
+        return FLR_RANGE_ERROR;
+    buf += BLOB_HEADER_BYTES;
+
+    memset(cfg, 0, sizeof(*cfg));
+    while (count--) {
+        uint32_t fn;
+        uint16_t bytes, offset = 0;
+        uint16_t i;
+
+        if (end - buf < BLOB_ITEM_BYTES)
+            return FLR_DATA_SIZE_ERROR;
+        byteToUINT_32(buf, &fn);
+        byteToUINT_16(buf + 4, &bytes);
+        buf += BLOB_ITEM_BYTES;
+        if (end - buf < bytes)
+            return FLR_DATA_SIZE_ERROR;
+
+        for (i = 0; i < CLIENT_CONFIG_ITEMS; offset += items[i].bytes, i++) {
+            if ((uint32_t) items[i].getFn != fn || items[i].bytes != bytes)
+                continue;
+            memcpy(cfg->data + offset, buf, bytes);
+            cfg->valid[i] = 1;
+            cfg->groups |= items[i].group;
+            break;
+        }
+        buf += bytes;
+    }
+    return R_SUCCESS;
+}
@@ -0,0 +1,70 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CLIENT_CONFIG_H
+#define CLIENT_CONFIG_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Configuration snapshot: every plain get/set setting of the selected
+ * groups, read in one pipelined burst and written back diff-only.
+ *
+ * Settings a camera rejects (not present on the model) are left out of the
+ * snapshot and never written. Uses Client_Pipeline, so the same threading
+ * rules apply; the pipeline is flushed before every call returns.
+ */
+
+#define CLIENT_CONFIG_AGC           (1U << 0)
+#define CLIENT_CONFIG_DVO           (1U << 1)
+#define CLIENT_CONFIG_TELEMETRY     (1U << 2)
+#define CLIENT_CONFIG_RADIOMETRY    (1U << 3)
+#define CLIENT_CONFIG_ALL           (0x0000000FU)
+
+#define CLIENT_CONFIG_ITEMS         (118)
+#define CLIENT_CONFIG_DATA_BYTES    (674)   // wire size of all items
+
+typedef struct {
+    uint32_t groups;                            // CLIENT_CONFIG_* groups the snapshot covers
+    uint8_t valid[CLIENT_CONFIG_ITEMS];         // item holds a value
+    uint8_t data[CLIENT_CONFIG_DATA_BYTES];     // item values in wire format
+} CLIENT_CONFIG;
+
+// Read every setting of groups from the camera into cfg. Fails on a
+// transport error; settings the camera rejects are just left out.
+FLR_EXPORT FLR_RESULT CLIENT_configRead(CLIENT_CONFIG *cfg, uint32_t groups);
+
+// Read the camera's current settings and write those in cfg that differ.
+// written (optional) receives the number of settings sent.
+FLR_EXPORT FLR_RESULT CLIENT_configApply(const CLIENT_CONFIG *cfg, uint32_t *written);
+
+// Items held in cfg
+FLR_EXPORT uint32_t CLIENT_configCount(const CLIENT_CONFIG *cfg);
+
+// Compact big-endian blob: "BCFG", version, item count, then per item its
+// get function code, length and value. Returns the bytes needed, and only
+// writes buf if they fit in bufBytes.
+FLR_EXPORT uint32_t CLIENT_configSerialize(const CLIENT_CONFIG *cfg, uint8_t *buf, uint32_t bufBytes);
+
+// Load a blob from CLIENT_configSerialize; items this SDK doesn't know are skipped
+FLR_EXPORT FLR_RESULT CLIENT_configDeserialize(CLIENT_CONFIG *cfg, const uint8_t *buf, uint32_t bufBytes);
+
+#endif // CLIENT_CONFIG_H
@@ -0,0 +1,98 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#include <stdlib.h>
+
+#include "Client_Context.h"
+#include "UART_Connector.h"
+#include "Client_FslpLog.h"
+
+#if defined(_MSC_VER)
+#define BOSON_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define BOSON_THREAD_LOCAL __thread
+#else
+#define BOSON_THREAD_LOCAL   // no TLS: one binding for the whole process
+#endif
+
+/* Defaults to 1000ms, can be increased by the user for any commands that take
+   longer to respond... */
+#define DEFAULT_READ_TIMEOUT (1000)
+
+static boson_ctx_t defaultCtx = { 0, 0, DEFAULT_READ_TIMEOUT, 0, 0, NULL, NULL, NULL, NULL, NULL };
+static BOSON_THREAD_LOCAL boson_ctx_t *currentCtx = NULL;
+
+boson_ctx_t *bosonCtxCreate(void)
+{
+    boson_ctx_t *ctx = (boson_ctx_t *) calloc(1, sizeof(boson_ctx_t));
+    if (ctx)
+        ctx->readTimeout = DEFAULT_READ_TIMEOUT;
+    return ctx;
+}
+
+void bosonCtxDestroy(boson_ctx_t *ctx)
+{
+    if (!ctx || ctx == &defaultCtx)
+        return;
+
+    if (ctx->isInitialized)
+        bosonCtxClose(ctx);
+    if (ctx->fslpLog) {
+        boson_ctx_t *prev = bosonCtxBind(ctx);
+        CLIENT_fslpLogClose();
+        bosonCtxBind(prev);
+    }
+    if (currentCtx == ctx)
+        currentCtx = NULL;
+    free(ctx->events);
+    free(ctx->writeBehind);
+    free(ctx->getterCache);
+    free(ctx->hook);
+    free(ctx);
+}
+
+boson_ctx_t *bosonCtxBind(boson_ctx_t *ctx)
+{
+    boson_ctx_t *prev = bosonCtxCurrent();
+    currentCtx = ctx;
+    return prev;
+}
+
+boson_ctx_t *bosonCtxCurrent(void)
+{
+    return currentCtx ? currentCtx : &defaultCtx;
+}
+
+FLR_RESULT bosonCtxInitialize(boson_ctx_t *ctx, int32_t port_num, int32_t baud_rate)
+{
+    FLR_RESULT res;
+
+    if (!ctx)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    BOSON_CTX_CALL(res, ctx, Initialize(port_num, baud_rate));
+    return res;
+}
+
+void bosonCtxClose(boson_ctx_t *ctx)
+{
+    boson_ctx_t *prev;
+
+    if (!ctx)
+        return;
+
+    prev = bosonCtxBind(ctx);
+    Close();
+    bosonCtxBind(prev);
+}
@@ -0,0 +1,69 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CLIENT_CONTEXT_H
+#define CLIENT_CONTEXT_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Per-camera connection state.
+ *
+ * Every API call works on the calling thread's current context, so the
+ * existing functions drive one camera per thread without changes: create a
+ * context per camera, bind it in the thread that talks to that camera, then
+ * call Initialize() and the API as before. Threads that never bind share a
+ * default context, which is the old single-camera behaviour.
+ *
+ * A context must be used by one thread at a time.
+ */
+typedef struct boson_ctx {
+    int32_t port;
+    int32_t baudRate;         // host side rate the port runs at
+    int32_t readTimeout;      // ms to wait for the start of a response
+    uint8_t isInitialized;
+    uint32_t commandCount;    // sequence number of the next command
+    struct boson_events *events;  // Client_Event state, allocated on first use
+    struct boson_write_behind *writeBehind;  // Client_WriteBehind state, allocated on enable
+    struct boson_fslp_log *fslpLog;  // Client_FslpLog state, while logging
+    struct boson_getter_cache *getterCache;  // Client_GetterCache state, allocated on enable
+    struct boson_hook *hook;  // Client_Hooks callback, while set
+} boson_ctx_t;
+
+FLR_EXPORT boson_ctx_t *bosonCtxCreate(void);
+FLR_EXPORT void bosonCtxDestroy(boson_ctx_t *ctx);
+
+// Make ctx current for the calling thread, NULL for the default; returns the previous one
+FLR_EXPORT boson_ctx_t *bosonCtxBind(boson_ctx_t *ctx);
+FLR_EXPORT boson_ctx_t *bosonCtxCurrent(void);
+
+// Initialize() / Close() on ctx, without changing the thread's binding
+FLR_EXPORT FLR_RESULT bosonCtxInitialize(boson_ctx_t *ctx, int32_t port_num, int32_t baud_rate);
+FLR_EXPORT void bosonCtxClose(boson_ctx_t *ctx);
+
+// Run one API call against ctx, e.g. BOSON_CTX_CALL(res, cam[i], bosonGetCameraSN(&sn[i]));
+#define BOSON_CTX_CALL(ret, ctx, call) do { \
+        boson_ctx_t *bosonCtxPrev_ = bosonCtxBind(ctx); \
+        (ret) = (call); \
+        bosonCtxBind(bosonCtxPrev_); \
+    } while (0)
+
+#endif // CLIENT_CONTEXT_H
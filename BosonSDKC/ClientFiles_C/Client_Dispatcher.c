@@ -16,15 +16,23 @@
 /******************************************************************************/
 
 #include "Client_Dispatcher.h"
+#include "Client_WriteBehind.h"
+#include "Client_GetterCache.h"
+#include "Client_Hooks.h"
+#include "Client_FslpLog.h"
+#include "Client_Context.h"
 
 // Asynchronous (MultiService compatible) transmit part
 FLR_RESULT CLIENT_dispatcher_Tx(uint32_t seqNum, FLR_FUNCTION fnID, const uint8_t *sendData, const uint32_t sendBytes, const uint8_t *receiveData, uint32_t *receiveBytes) {
     
-    uint32_t i;
+    // Payload header; sendData follows it on the wire without being copied
+    uint8_t header[12] = {0};
+    uint8_t *pyldPtr = (uint8_t *)header;
+    CLIENT_SEGMENT segments[2];
     
-    // Allocated buffer with extra space for payload header
-    uint8_t sendPayload[530];
-    uint8_t *pyldPtr = (uint8_t *)sendPayload;
+    // Responses are collected by CLIENT_dispatcher_Rx
+    (void) receiveData;
+    (void) receiveBytes;
     
     // Write sequence number to first 4 bytes
     UINT_32ToByte(seqNum, (const uint8_t *)pyldPtr);
@@ -36,16 +44,15 @@ FLR_RESULT CLIENT_dispatcher_Tx(uint32_t seqNum, FLR_FUNCTION fnID, const uint8_
     
     // Write 0xFFFFFFFF to third 4 bytes
     UINT_32ToByte(0xFFFFFFFF, (const uint8_t *)pyldPtr);
-    pyldPtr += 4;
     
-    // Copy sendData to payload buffer
-    uint8_t *dataPtr = (uint8_t *)sendData;
-    for(i = 0;i<sendBytes;i++) {
-        *pyldPtr++ = *dataPtr++;
-    }
+    segments[0].data = header;
+    segments[0].len = sizeof(header);
+    segments[1].data = sendData;
+    segments[1].len = sendBytes;
     
-    if(CLIENT_interface_writeFrame(sendPayload, sendBytes + 12) != FLR_OK)
+    if(CLIENT_interface_writeFrameV(segments, 2) != FLR_OK)
         return FLR_COMM_ERROR_WRITING_COMM;
+    CLIENT_fslpLogFrame(bosonCtxCurrent(), CLIENT_FSLP_LOG_COMMAND, seqNum, (uint32_t) fnID, 0xFFFFFFFF, sendData, sendBytes);
     
     return R_SUCCESS;
 }
@@ -54,8 +61,12 @@ FLR_RESULT CLIENT_dispatcher_Rx(uint32_t *seqNum, uint32_t *fnID, const uint8_t
     
     uint32_t i;
     
+    // Kept for symmetry with CLIENT_dispatcher_Tx
+    (void) sendData;
+    (void) sendBytes;
+    
     // Allocated buffer with extra space for return data
-    uint8_t receivePayload[530];
+    uint8_t receivePayload[CLIENT_MAX_FRAME_BYTES];
     uint8_t *inPtr = (uint8_t *)receivePayload;
     
     *receiveBytes+=12;
@@ -94,6 +105,7 @@ FLR_RESULT CLIENT_dispatcher_Rx(uint32_t *seqNum, uint32_t *fnID, const uint8_t
     uint32_t pyldStatus;
     byteToUINT_32( (const uint8_t *) inPtr, &pyldStatus);
     inPtr += 4;
+    CLIENT_fslpLogFrame(bosonCtxCurrent(), CLIENT_FSLP_LOG_RESPONSE, returnSequence, cmdID, pyldStatus, inPtr, *receiveBytes - 12);
     
     const FLR_RESULT returncode = (FLR_RESULT) pyldStatus;
     // Check for any errorcode
@@ -119,20 +131,34 @@ FLR_RESULT CLIENT_dispatcher_Rx(uint32_t *seqNum, uint32_t *fnID, const uint8_t
 FLR_RESULT CLIENT_dispatcher(uint32_t seqNum, FLR_FUNCTION fnID, const uint8_t *sendData, const uint32_t sendBytes, const uint8_t *receiveData, uint32_t *receiveBytes)
 {    uint32_t returnSequence;
     uint32_t cmdID;
-    FLR_RESULT res = CLIENT_dispatcher_Tx(seqNum, fnID, sendData, sendBytes, receiveData, receiveBytes);
-    if (res)
-        return res;
-    res = CLIENT_dispatcher_Rx(&returnSequence, &cmdID, sendData, sendBytes, receiveData, receiveBytes);
-    if (res)
-        return res;
+    FLR_RESULT res;
+    boson_ctx_t *ctx = bosonCtxCurrent();
     
-    if (returnSequence ^ seqNum)
-        return R_SDK_DSPCH_SEQUENCE_MISMATCH;
+    // setter kept by Client_WriteBehind, it goes out later
+    if (CLIENT_writeBehindHold(fnID, sendData, sendBytes, &res)) {
+        *receiveBytes = 0;
+        return res;
+    }
     
-    if (cmdID ^ (uint32_t) fnID)
-        return R_SDK_DSPCH_ID_MISMATCH;
+    // immutable getter answered before by Client_GetterCache
+    if (CLIENT_getterCacheLookup(fnID, sendBytes, receiveData, receiveBytes))
+        return R_SUCCESS;
     
-    return R_SUCCESS;
+    CLIENT_HOOK(ctx, CLIENT_HOOK_PRE_SEND, seqNum, fnID, sendBytes, 0, R_SUCCESS, 0);
+    res = CLIENT_dispatcher_Tx(seqNum, fnID, sendData, sendBytes, receiveData, receiveBytes);
+    if (!res) {
+        CLIENT_HOOK(ctx, CLIENT_HOOK_POST_SEND, seqNum, fnID, sendBytes, 0, R_SUCCESS, 0);
+        res = CLIENT_dispatcher_Rx(&returnSequence, &cmdID, sendData, sendBytes, receiveData, receiveBytes);
+        CLIENT_HOOK(ctx, CLIENT_HOOK_FIRST_BYTE, seqNum, fnID, sendBytes, 0, R_SUCCESS, CLIENT_interface_startByteNs());
+    }
+    if (!res && (returnSequence ^ seqNum))
+        res = R_SDK_DSPCH_SEQUENCE_MISMATCH;
+    if (!res && (cmdID ^ (uint32_t) fnID))
+        res = R_SDK_DSPCH_ID_MISMATCH;
+    
+    CLIENT_getterCacheStore(fnID, sendBytes, res, receiveData, *receiveBytes);
+    CLIENT_HOOK(ctx, res ? CLIENT_HOOK_ERROR : CLIENT_HOOK_COMPLETE, seqNum, fnID, sendBytes, res ? 0 : *receiveBytes, res, 0);
+    return res;
 }
 
 FLR_RESULT CheckReadyDataCommandId(uint32_t receiveBytes, const uint8_t *receiveData, uint32_t *commandId)
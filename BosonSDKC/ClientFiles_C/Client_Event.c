@@ -0,0 +1,216 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "Client_Event.h"
+#include "Client_Dispatcher.h"
+#include "Client_FslpLog.h"
+#include "Serializer_BuiltIn.h"
+
+#define COMMAND_CHANNEL  (0x00)
+#define HEADER_BYTES     (12)
+
+typedef struct {
+    uint32_t seqNum;
+    FLR_FUNCTION fnID;
+    CLIENT_pipelineCallback_t *callback;
+    void *context;
+} EVENT_SLOT;
+
+// Commands in flight on one context, in send order
+struct boson_events {
+    EVENT_SLOT slots[CLIENT_EVENT_MAX_PENDING];
+    uint32_t head;
+    uint32_t count;
+    int64_t headDeadline;     // ms, when the oldest command times out
+    CLIENT_frameCallback_t *frameHandler;
+    void *frameContext;
+};
+
+static int64_t now_ms(void)
+{
+#ifdef _WIN32
+    return (int64_t) GetTickCount64();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (int64_t) t.tv_sec * 1000 + t.tv_nsec / 1000000;
+#endif
+}
+
+static struct boson_events *get_events(boson_ctx_t *ctx)
+{
+    if (!ctx->events)
+        ctx->events = (struct boson_events *) calloc(1, sizeof(struct boson_events));
+    return ctx->events;
+}
+
+static void completeHead(boson_ctx_t *ctx, FLR_RESULT result, const uint8_t *data, uint32_t bytes)
+{
+    struct boson_events *ev = ctx->events;
+    EVENT_SLOT done = ev->slots[ev->head];
+
+    // free the slot first, so the callback may submit again; the camera
+    // starts on the next command now
+    ev->head = (ev->head + 1) % CLIENT_EVENT_MAX_PENDING;
+    ev->count--;
+    ev->headDeadline = now_ms() + ctx->readTimeout;
+
+    if (done.callback)
+        done.callback(done.context, result, done.fnID, data, bytes);
+}
+
+static void onFrame(void *context, uint8_t channelID, const uint8_t *payload, uint32_t bytes)
+{
+    boson_ctx_t *ctx = (boson_ctx_t *) context;
+    struct boson_events *ev = ctx->events;
+    uint32_t seqNum, fnID, status;
+    uint32_t i;
+
+    if (channelID != COMMAND_CHANNEL) {
+        if (ev->frameHandler)
+            ev->frameHandler(ev->frameContext, channelID, payload, bytes);
+        return;
+    }
+    if (bytes < HEADER_BYTES)
+        return;
+
+    byteToUINT_32(payload, &seqNum);
+    byteToUINT_32(payload + 4, &fnID);
+    byteToUINT_32(payload + 8, &status);
+    CLIENT_fslpLogFrame(ctx, CLIENT_FSLP_LOG_RESPONSE, seqNum, fnID, status, payload + HEADER_BYTES, bytes - HEADER_BYTES);
+
+    for (i = 0; i < ev->count; i++) {
+        EVENT_SLOT *slot = &ev->slots[(ev->head + i) % CLIENT_EVENT_MAX_PENDING];
+        FLR_RESULT res = (FLR_RESULT) status;
+
+        if (slot->seqNum != seqNum)
+            continue;
+
+        // answers are in order, so anything older was dropped by the camera
+        while (i--)
+            completeHead(ctx, R_SDK_DSPCH_SEQUENCE_MISMATCH, NULL, 0);
+
+        if (res == R_SUCCESS && fnID != (uint32_t) ev->slots[ev->head].fnID)
+            res = R_SDK_DSPCH_ID_MISMATCH;
+        if (res == R_SUCCESS)
+            completeHead(ctx, res, payload + HEADER_BYTES, bytes - HEADER_BYTES);
+        else
+            completeHead(ctx, res, NULL, 0);
+        return;
+    }
+
+    // stale reply to something no longer in flight
+}
+
+int32_t bosonCtxFd(boson_ctx_t *ctx)
+{
+    int32_t fd;
+
+    if (!ctx)
+        return -1;
+    BOSON_CTX_CALL(fd, ctx, PortFdGet());
+    return fd;
+}
+
+FLR_RESULT bosonCtxSubmit(boson_ctx_t *ctx, FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes, CLIENT_pipelineCallback_t *callback, void *context)
+{
+    struct boson_events *ev;
+    EVENT_SLOT *slot;
+    uint32_t dummyBytes = 0;
+    FLR_RESULT res;
+
+    if (!ctx || sendBytes > CLIENT_PIPELINE_MAX_DATA || (sendBytes && !sendData))
+        return FLR_BAD_ARG_POINTER_ERROR;
+    if (!ctx->isInitialized)
+        return FLR_COMM_PORT_NOT_OPEN;
+    ev = get_events(ctx);
+    if (!ev)
+        return FLR_ERROR;
+    if (ev->count == CLIENT_EVENT_MAX_PENDING)
+        return FLR_NOT_READY;
+
+    slot = &ev->slots[(ev->head + ev->count) % CLIENT_EVENT_MAX_PENDING];
+    slot->seqNum = ctx->commandCount++;
+    slot->fnID = fnID;
+    slot->callback = callback;
+    slot->context = context;
+
+    BOSON_CTX_CALL(res, ctx, CLIENT_dispatcher_Tx(slot->seqNum, fnID, sendData, sendBytes, NULL, &dummyBytes));
+    if (res != R_SUCCESS)
+        return res;
+
+    if (ev->count == 0)
+        ev->headDeadline = now_ms() + ctx->readTimeout;
+    ev->count++;
+    return R_SUCCESS;
+}
+
+FLR_RESULT bosonCtxPump(boson_ctx_t *ctx)
+{
+    struct boson_events *ev;
+    int32_t frames;
+
+    if (!ctx)
+        return FLR_BAD_ARG_POINTER_ERROR;
+    if (!ctx->isInitialized)
+        return FLR_COMM_PORT_NOT_OPEN;
+    ev = get_events(ctx);
+    if (!ev)
+        return FLR_ERROR;
+
+    BOSON_CTX_CALL(frames, ctx, PumpFrames(onFrame, ctx));
+
+    // nothing came for the oldest command in time: the camera lost it
+    while (ev->count && now_ms() >= ev->headDeadline)
+        completeHead(ctx, FLR_COMM_TIMEOUT_ERROR, NULL, 0);
+
+    return (frames < 0) ? FLR_COMM_ERROR_READING_COMM : R_SUCCESS;
+}
+
+int32_t bosonCtxPumpTimeout(boson_ctx_t *ctx)
+{
+    int64_t left;
+
+    if (!ctx || !ctx->events || !ctx->events->count)
+        return -1;
+    left = ctx->events->headDeadline - now_ms();
+    return (left > 0) ? (int32_t) left : 0;
+}
+
+uint32_t bosonCtxInFlight(boson_ctx_t *ctx)
+{
+    return (ctx && ctx->events) ? ctx->events->count : 0;
+}
+
+void bosonCtxSetFrameHandler(boson_ctx_t *ctx, CLIENT_frameCallback_t *handler, void *context)
+{
+    struct boson_events *ev;
+
+    if (!ctx)
+        return;
+    ev = get_events(ctx);
+    if (!ev)
+        return;
+    ev->frameHandler = handler;
+    ev->frameContext = context;
+}
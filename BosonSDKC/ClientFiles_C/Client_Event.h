@@ -0,0 +1,68 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef CLIENT_EVENT_H
+#define CLIENT_EVENT_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+#include "FunctionCodes.h"
+#include "Client_Context.h"
+#include "Client_Pipeline.h"
+#include "UART_Connector.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Event-loop integration: several cameras driven from one thread, nothing
+ * ever blocks on a response.
+ *
+ * Register bosonCtxFd() with poll()/epoll/libuv (uv_poll_t) for reading,
+ * call bosonCtxPump() when it is readable, and use bosonCtxPumpTimeout() as
+ * the loop's timeout so unanswered commands still complete. Callbacks fire
+ * from inside bosonCtxPump() and may submit again. Commands time out after
+ * the context's read timeout, counted from when the camera starts on them.
+ *
+ * On Win32 there is no descriptor (-1): call bosonCtxPump() from a timer.
+ * A context with commands in flight must not be used for blocking calls.
+ */
+
+#ifndef CLIENT_EVENT_MAX_PENDING
+#define CLIENT_EVENT_MAX_PENDING     (32)
+#endif
+
+// Descriptor of ctx's open port to wait on for reading, -1 if there is none
+FLR_EXPORT int32_t bosonCtxFd(boson_ctx_t *ctx);
+
+// Send a command on ctx without waiting; callback fires from bosonCtxPump().
+// FLR_NOT_READY while CLIENT_EVENT_MAX_PENDING commands are in flight.
+FLR_EXPORT FLR_RESULT bosonCtxSubmit(boson_ctx_t *ctx, FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes, CLIENT_pipelineCallback_t *callback, void *context);
+
+// Process whatever ctx's port has received and expire overdue commands; never waits
+FLR_EXPORT FLR_RESULT bosonCtxPump(boson_ctx_t *ctx);
+
+// ms until ctx's oldest command times out, -1 with nothing in flight
+FLR_EXPORT int32_t bosonCtxPumpTimeout(boson_ctx_t *ctx);
+
+FLR_EXPORT uint32_t bosonCtxInFlight(boson_ctx_t *ctx);
+
+// Frames on channels other than the command channel (data services) go to handler
+FLR_EXPORT void bosonCtxSetFrameHandler(boson_ctx_t *ctx, CLIENT_frameCallback_t *handler, void *context);
+
+#endif // CLIENT_EVENT_H
@@ -0,0 +1,125 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "Client_FslpLog.h"
+#include "Client_Context.h"
+#include "Client_Interface.h"
+
+#define FILE_HEADER_BYTES   (16)
+#define RECORD_HEADER_BYTES (24)
+
+struct boson_fslp_log {
+    FILE *f;
+    uint8_t record[RECORD_HEADER_BYTES + CLIENT_MAX_FRAME_BYTES];
+};
+
+static uint64_t now_ns(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t) (count.QuadPart / freq.QuadPart) * 1000000000u
+        + (uint64_t) (count.QuadPart % freq.QuadPart) * 1000000000u / (uint64_t) freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000u + (uint64_t) t.tv_nsec;
+#endif
+}
+
+static uint8_t *put_le(uint8_t *p, uint64_t value, uint32_t bytes)
+{
+    uint32_t i;
+
+    for (i = 0; i < bytes; i++)
+        *p++ = (uint8_t) (value >> (8 * i));
+    return p;
+}
+
+FLR_RESULT CLIENT_fslpLogOpen(const char *path)
+{
+    boson_ctx_t *ctx = bosonCtxCurrent();
+    uint8_t header[FILE_HEADER_BYTES] = { 'F', 'S', 'L', 'P', 'L', 'O', 'G', 0 };
+    struct boson_fslp_log *log;
+
+    if (!path)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    CLIENT_fslpLogClose();
+    log = (struct boson_fslp_log *) calloc(1, sizeof(*log));
+    if (!log)
+        return FLR_ERROR;
+    log->f = fopen(path, "ab");
+    if (!log->f) {
+        free(log);
+        return FLR_ERROR;
+    }
+
+    fseek(log->f, 0, SEEK_END);
+    if (ftell(log->f) == 0) {
+        put_le(put_le(header + 8, CLIENT_FSLP_LOG_VERSION, 2), FILE_HEADER_BYTES, 2);
+        fwrite(header, 1, sizeof(header), log->f);
+        fflush(log->f);
+    }
+    ctx->fslpLog = log;
+    return R_SUCCESS;
+}
+
+void CLIENT_fslpLogClose(void)
+{
+    boson_ctx_t *ctx = bosonCtxCurrent();
+
+    if (!ctx->fslpLog)
+        return;
+    fclose(ctx->fslpLog->f);
+    free(ctx->fslpLog);
+    ctx->fslpLog = NULL;
+}
+
+void CLIENT_fslpLogFrame(struct boson_ctx *ctx, uint8_t direction, uint32_t seqNum, uint32_t fnID,
+                         uint32_t status, const uint8_t *data, uint32_t bytes)
+{
+    struct boson_fslp_log *log = ctx->fslpLog;
+    uint8_t *p;
+
+    if (!log)
+        return;
+    if (bytes > CLIENT_MAX_FRAME_BYTES)
+        bytes = CLIENT_MAX_FRAME_BYTES;
+
+    p = put_le(log->record, now_ns(), 8);
+    p = put_le(p, seqNum, 4);
+    p = put_le(p, fnID, 4);
+    p = put_le(p, status, 4);
+    p = put_le(p, bytes, 2);
+    *p++ = direction;
+    *p++ = 0;                 // command channel
+    if (bytes)
+        memcpy(p, data, bytes);
+
+    // the whole record in one write, so files shared by contexts stay whole
+    fwrite(log->record, 1, RECORD_HEADER_BYTES + bytes, log->f);
+    fflush(log->f);
+}
@@ -0,0 +1,60 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef CLIENT_FSLP_LOG_H
+#define CLIENT_FSLP_LOG_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Binary log of the FSLP frames a context sends and receives, for replay
+ * and transport profiling (BosonSDK/fslp_log.py reads and replays it).
+ *
+ * Little-endian: a 16-byte file header ("FSLPLOG\0", u16 version, u16
+ * header bytes, u32 flags), then per frame a 24-byte record header (u64
+ * CLOCK_MONOTONIC ns, u32 sequence, u32 fn_id, u32 status, u16 data bytes,
+ * u8 direction, u8 channel) and the data after the frame's 12-byte header.
+ * Commands carry status 0xFFFFFFFF, as on the wire.
+ *
+ * Logging is per context (Client_Context.h). Initialize() opens the file
+ * named by BOSON_FSLP_LOG on its own, so existing programs can be logged
+ * without changes; a file is appended to, one write per record, so several
+ * contexts or processes can share it.
+ */
+
+#define CLIENT_FSLP_LOG_VERSION  (1)
+#define CLIENT_FSLP_LOG_COMMAND  (0)
+#define CLIENT_FSLP_LOG_RESPONSE (1)
+
+// Log the current context's frames to path (appended to if it exists)
+FLR_EXPORT FLR_RESULT CLIENT_fslpLogOpen(const char *path);
+
+// Stop logging the current context
+FLR_EXPORT void CLIENT_fslpLogClose(void);
+
+// Called by the dispatcher and the event loop: one frame of ctx, a no-op
+// when it is not logging
+struct boson_ctx;
+void CLIENT_fslpLogFrame(struct boson_ctx *ctx, uint8_t direction, uint32_t seqNum, uint32_t fnID,
+                         uint32_t status, const uint8_t *data, uint32_t bytes);
+
+#endif // CLIENT_FSLP_LOG_H
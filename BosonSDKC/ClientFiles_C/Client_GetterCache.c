@@ -0,0 +1,184 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "Client_GetterCache.h"
+#include "Client_Context.h"
+
+typedef struct {
+    FLR_FUNCTION getFn;
+    uint8_t clearOnModuleSet;
+    uint8_t valid;
+    uint32_t bytes;
+    uint8_t data[CLIENT_GETTER_CACHE_MAX_DATA];
+} GETTER_CACHE_ENTRY;
+
+struct boson_getter_cache {
+    GETTER_CACHE_ENTRY entries[CLIENT_GETTER_CACHE_MAX_GETTERS];
+    uint32_t count;
+    uint32_t hits;
+    uint32_t misses;
+};
+
+// Fixed for the life of the camera, but for the clock info, which follows
+// the dvo settings
+static const struct {
+    FLR_FUNCTION getFn;
+    uint8_t clearOnModuleSet;
+} defaultGetters[] = {
+    { BOSON_GETCAMERASN, 0 },
+    { BOSON_GETCAMERAPN, 0 },
+    { BOSON_GETSENSORSN, 0 },
+    { BOSON_GETSENSORPN, 0 },
+    { BOSON_GETSOFTWAREREV, 0 },
+    { SYSINFO_GETCAMERASN, 0 },
+    { SYSINFO_GETPRODUCTNAME, 0 },
+    { DVO_GETCLOCKINFO, 1 },
+};
+
+static GETTER_CACHE_ENTRY *find_entry(struct boson_getter_cache *gc, FLR_FUNCTION getFn)
+{
+    uint32_t i;
+
+    for (i = 0; i < gc->count; i++) {
+        if (gc->entries[i].getFn == getFn)
+            return &gc->entries[i];
+    }
+    return NULL;
+}
+
+FLR_RESULT CLIENT_getterCacheEnable(void)
+{
+    FLR_RESULT res;
+    uint32_t i;
+
+    for (i = 0; i < sizeof(defaultGetters) / sizeof(defaultGetters[0]); i++) {
+        res = CLIENT_getterCacheAdd(defaultGetters[i].getFn, defaultGetters[i].clearOnModuleSet);
+        if (res != R_SUCCESS)
+            return res;
+    }
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_getterCacheAdd(FLR_FUNCTION getFn, uint8_t clearOnModuleSet)
+{
+    boson_ctx_t *ctx = bosonCtxCurrent();
+    struct boson_getter_cache *gc = ctx->getterCache;
+    GETTER_CACHE_ENTRY *e;
+
+    if (!gc) {
+        gc = (struct boson_getter_cache *) calloc(1, sizeof(*gc));
+        if (!gc)
+            return FLR_ERROR;
+        ctx->getterCache = gc;
+    }
+
+    e = find_entry(gc, getFn);
+    if (!e) {
+        if (gc->count == CLIENT_GETTER_CACHE_MAX_GETTERS)
+            return FLR_RANGE_ERROR;
+        e = &gc->entries[gc->count++];
+        e->getFn = getFn;
+        e->valid = 0;
+    }
+    e->clearOnModuleSet = clearOnModuleSet;
+    return R_SUCCESS;
+}
+
+void CLIENT_getterCacheFlush(void)
+{
+    struct boson_getter_cache *gc = bosonCtxCurrent()->getterCache;
+    uint32_t i;
+
+    if (!gc)
+        return;
+    for (i = 0; i < gc->count; i++)
+        gc->entries[i].valid = 0;
+}
+
+void CLIENT_getterCacheDisable(void)
+{
+    boson_ctx_t *ctx = bosonCtxCurrent();
+
+    free(ctx->getterCache);
+    ctx->getterCache = NULL;
+}
+
+void CLIENT_getterCacheStats(uint32_t *hits, uint32_t *misses)
+{
+    struct boson_getter_cache *gc = bosonCtxCurrent()->getterCache;
+
+    if (hits)
+        *hits = gc ? gc->hits : 0;
+    if (misses)
+        *misses = gc ? gc->misses : 0;
+}
+
+int CLIENT_getterCacheLookup(FLR_FUNCTION fnID, uint32_t sendBytes, const uint8_t *receiveData, uint32_t *receiveBytes)
+{
+    struct boson_getter_cache *gc = bosonCtxCurrent()->getterCache;
+    GETTER_CACHE_ENTRY *e;
+
+    if (!gc || sendBytes)
+        return 0;
+    e = find_entry(gc, fnID);
+    if (!e)
+        return 0;
+    if (!e->valid || e->bytes > *receiveBytes) {
+        gc->misses++;
+        return 0;
+    }
+
+    memcpy((uint8_t *) receiveData, e->data, e->bytes);
+    *receiveBytes = e->bytes;
+    gc->hits++;
+    return 1;
+}
+
+void CLIENT_getterCacheStore(FLR_FUNCTION fnID, uint32_t sendBytes, FLR_RESULT res, const uint8_t *receiveData,
+                             uint32_t receiveBytes)
+{
+    struct boson_getter_cache *gc = bosonCtxCurrent()->getterCache;
+    GETTER_CACHE_ENTRY *e;
+    uint32_t i;
+
+    if (!gc)
+        return;
+
+    // whether or not it answered, the camera may be starting over
+    if (fnID == BOSON_REBOOT || fnID == BOSON_RESTOREFACTORYDEFAULTSFROMFLASH) {
+        CLIENT_getterCacheFlush();
+        return;
+    }
+
+    if (sendBytes) {
+        for (i = 0; i < gc->count; i++) {
+            e = &gc->entries[i];
+            if (e->clearOnModuleSet && ((uint32_t) e->getFn >> 16) == ((uint32_t) fnID >> 16))
+                e->valid = 0;
+        }
+        return;
+    }
+
+    e = find_entry(gc, fnID);
+    if (!e || res != R_SUCCESS || receiveBytes > CLIENT_GETTER_CACHE_MAX_DATA)
+        return;
+    memcpy(e->data, receiveData, receiveBytes);
+    e->bytes = receiveBytes;
+    e->valid = 1;
+}
@@ -0,0 +1,77 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+
+#ifndef CLIENT_GETTER_CACHE_H
+#define CLIENT_GETTER_CACHE_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+#include "FunctionCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Response cache for getters whose value does not change while connected.
+ *
+ * Once enabled, the first synchronous call of a cached getter (bosonGet-
+ * CameraSN etc.) goes to the camera as before; its response is kept and
+ * later calls return it without a round trip. Only successful responses of
+ * commands without data are kept.
+ *
+ * Everything is dropped by CLIENT_getterCacheFlush(), Initialize(), Close()
+ * and by sending bosonReboot or bosonRestoreFactoryDefaultsFromFlash. A
+ * getter added with clearOnModuleSet is also dropped by any command with
+ * data in its module (DVO_GETCLOCKINFO by the dvo setters). Flush after
+ * anything else that changes the camera behind the SDK's back, e.g. a
+ * power cycle or another host.
+ *
+ * State is per context (Client_Context.h). Pipelined and event-loop
+ * commands bypass the cache.
+ */
+
+#define CLIENT_GETTER_CACHE_MAX_GETTERS  (16)
+#define CLIENT_GETTER_CACHE_MAX_DATA     (64)   // larger responses are never kept
+
+// Cache the default set: camera and sensor serial and part numbers, software
+// revision, product name and DVO clock info
+FLR_EXPORT FLR_RESULT CLIENT_getterCacheEnable(void);
+
+// Also cache getFn; clearOnModuleSet nonzero drops it on commands with data
+// in the same module (fnID >> 16)
+FLR_EXPORT FLR_RESULT CLIENT_getterCacheAdd(FLR_FUNCTION getFn, uint8_t clearOnModuleSet);
+
+// Drop all kept responses; the next call of each getter goes to the camera
+FLR_EXPORT void CLIENT_getterCacheFlush(void);
+
+// Stop caching and forget the getters
+FLR_EXPORT void CLIENT_getterCacheDisable(void);
+
+// hits: calls answered from the cache; misses: cached getters sent. Either may be NULL.
+FLR_EXPORT void CLIENT_getterCacheStats(uint32_t *hits, uint32_t *misses);
+
+// Called by CLIENT_dispatcher(): nonzero when fnID was answered from the
+// cache, receiveData and *receiveBytes then hold the response
+int CLIENT_getterCacheLookup(FLR_FUNCTION fnID, uint32_t sendBytes, const uint8_t *receiveData, uint32_t *receiveBytes);
+
+// Called by CLIENT_dispatcher() after a command went out (res its result)
+void CLIENT_getterCacheStore(FLR_FUNCTION fnID, uint32_t sendBytes, FLR_RESULT res, const uint8_t *receiveData,
+                             uint32_t receiveBytes);
+
+#endif // CLIENT_GETTER_CACHE_H
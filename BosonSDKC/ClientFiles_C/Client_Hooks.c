@@ -0,0 +1,233 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "Client_Hooks.h"
+#include "Client_Context.h"
+
+struct boson_hook {
+    CLIENT_hook_t *fn;
+    void *context;
+};
+
+struct boson_latency_stats {
+    CLIENT_LATENCY_COMMAND commands[CLIENT_LATENCY_MAX_COMMANDS];
+    uint32_t count;
+    uint64_t started;           // PRE_SEND of the command in progress
+};
+
+// 250 us .. 1 s; a GetCameraSN over UART is about 1 ms, a flash write 100s of ms
+const uint32_t CLIENT_latencyBucketsUs[CLIENT_LATENCY_BUCKETS] = {
+    250, 500, 1000, 2000, 5000, 10000, 20000, 50000, 100000, 200000, 500000, 1000000
+};
+
+static uint64_t now_ns(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    return (uint64_t) (count.QuadPart / freq.QuadPart) * 1000000000u
+        + (uint64_t) (count.QuadPart % freq.QuadPart) * 1000000000u / (uint64_t) freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t) t.tv_sec * 1000000000u + (uint64_t) t.tv_nsec;
+#endif
+}
+
+FLR_RESULT CLIENT_hookSet(CLIENT_hook_t *hook, void *context)
+{
+#ifdef CLIENT_HOOKS
+    boson_ctx_t *ctx = bosonCtxCurrent();
+
+    if (!hook) {
+        free(ctx->hook);
+        ctx->hook = NULL;
+        return R_SUCCESS;
+    }
+    if (!ctx->hook) {
+        ctx->hook = (struct boson_hook *) calloc(1, sizeof(*ctx->hook));
+        if (!ctx->hook)
+            return FLR_ERROR;
+    }
+    ctx->hook->fn = hook;
+    ctx->hook->context = context;
+    return R_SUCCESS;
+#else
+    (void) hook;
+    (void) context;
+    return R_SDK_API_NOT_DEFINED;
+#endif
+}
+
+void CLIENT_hookEmit(struct boson_ctx *ctx, CLIENT_HOOK_POINT point, uint32_t seqNum, uint32_t fnID,
+                     uint32_t sendBytes, uint32_t receiveBytes, FLR_RESULT result, uint64_t timestampNs)
+{
+    CLIENT_HOOK_EVENT event;
+
+    if (!ctx->hook)
+        return;
+    if (!timestampNs) {
+        if (point == CLIENT_HOOK_FIRST_BYTE)
+            return;
+        timestampNs = now_ns();
+    }
+
+    event.point = point;
+    event.timestampNs = timestampNs;
+    event.seqNum = seqNum;
+    event.fnID = fnID;
+    event.sendBytes = sendBytes;
+    event.receiveBytes = receiveBytes;
+    event.result = result;
+    ctx->hook->fn(ctx->hook->context, &event);
+}
+
+CLIENT_LATENCY_STATS *CLIENT_latencyStatsCreate(void)
+{
+    return (CLIENT_LATENCY_STATS *) calloc(1, sizeof(CLIENT_LATENCY_STATS));
+}
+
+void CLIENT_latencyStatsDestroy(CLIENT_LATENCY_STATS *stats)
+{
+    free(stats);
+}
+
+void CLIENT_latencyStatsReset(CLIENT_LATENCY_STATS *stats)
+{
+    if (stats)
+        memset(stats, 0, sizeof(*stats));
+}
+
+static CLIENT_LATENCY_COMMAND *find_command(CLIENT_LATENCY_STATS *stats, uint32_t fnID)
+{
+    uint32_t i;
+
+    for (i = 0; i < stats->count; i++) {
+        if (stats->commands[i].fnID == fnID)
+            return &stats->commands[i];
+    }
+    if (stats->count < CLIENT_LATENCY_MAX_COMMANDS - 1) {
+        stats->commands[stats->count].fnID = fnID;
+        return &stats->commands[stats->count++];
+    }
+    // table full: the rest share the last entry, as fn_id 0
+    if (stats->count < CLIENT_LATENCY_MAX_COMMANDS)
+        stats->commands[stats->count++].fnID = 0;
+    return &stats->commands[CLIENT_LATENCY_MAX_COMMANDS - 1];
+}
+
+void CLIENT_latencyStatsHook(void *context, const CLIENT_HOOK_EVENT *event)
+{
+    CLIENT_LATENCY_STATS *stats = (CLIENT_LATENCY_STATS *) context;
+    CLIENT_LATENCY_COMMAND *c;
+    uint64_t ns;
+    uint32_t i;
+
+    if (event->point == CLIENT_HOOK_PRE_SEND) {
+        stats->started = event->timestampNs;
+        return;
+    }
+    if ((event->point != CLIENT_HOOK_COMPLETE && event->point != CLIENT_HOOK_ERROR) || !stats->started)
+        return;
+
+    ns = event->timestampNs - stats->started;
+    stats->started = 0;
+    c = find_command(stats, event->fnID);
+    c->count++;
+    c->errors += event->point == CLIENT_HOOK_ERROR;
+    c->sumNs += ns;
+    for (i = 0; i < CLIENT_LATENCY_BUCKETS; i++) {
+        if (ns <= (uint64_t) CLIENT_latencyBucketsUs[i] * 1000u)
+            c->buckets[i]++;
+    }
+}
+
+uint32_t CLIENT_latencyStatsCount(const CLIENT_LATENCY_STATS *stats)
+{
+    return stats ? stats->count : 0;
+}
+
+FLR_RESULT CLIENT_latencyStatsGet(const CLIENT_LATENCY_STATS *stats, uint32_t i, CLIENT_LATENCY_COMMAND *command)
+{
+    if (!stats || !command)
+        return FLR_BAD_ARG_POINTER_ERROR;
+    if (i >= stats->count)
+        return FLR_RANGE_ERROR;
+    *command = stats->commands[i];
+    return R_SUCCESS;
+}
+
+// snprintf() onto buf at *len, counting what did not fit
+static void append(char *buf, uint32_t size, uint32_t *len, const char *fmt, ...)
+{
+    va_list args;
+    int n;
+
+    va_start(args, fmt);
+    n = vsnprintf(*len < size ? buf + *len : NULL, *len < size ? size - *len : 0, fmt, args);
+    va_end(args);
+    if (n > 0)
+        *len += (uint32_t) n;
+}
+
+uint32_t CLIENT_latencyStatsFormat(const CLIENT_LATENCY_STATS *stats, const char *labels, char *buf, uint32_t size)
+{
+    const char *sep = labels && *labels ? "," : "";
+    uint32_t len = 0;
+    uint32_t i, b;
+
+    if (!labels)
+        labels = "";
+    if (buf && size)
+        buf[0] = '\0';
+    else
+        size = 0;
+    if (!stats)
+        return 0;
+
+    append(buf, size, &len, "# HELP boson_command_seconds Camera command latency, send to response.\n"
+                            "# TYPE boson_command_seconds histogram\n");
+    for (i = 0; i < stats->count; i++) {
+        const CLIENT_LATENCY_COMMAND *c = &stats->commands[i];
+
+        for (b = 0; b < CLIENT_LATENCY_BUCKETS; b++)
+            append(buf, size, &len, "boson_command_seconds_bucket{%s%sfn_id=\"0x%08X\",le=\"%g\"} %llu\n",
+                   labels, sep, c->fnID, CLIENT_latencyBucketsUs[b] / 1e6, (unsigned long long) c->buckets[b]);
+        append(buf, size, &len, "boson_command_seconds_bucket{%s%sfn_id=\"0x%08X\",le=\"+Inf\"} %llu\n",
+               labels, sep, c->fnID, (unsigned long long) c->count);
+        append(buf, size, &len, "boson_command_seconds_sum{%s%sfn_id=\"0x%08X\"} %.9f\n",
+               labels, sep, c->fnID, c->sumNs / 1e9);
+        append(buf, size, &len, "boson_command_seconds_count{%s%sfn_id=\"0x%08X\"} %llu\n",
+               labels, sep, c->fnID, (unsigned long long) c->count);
+    }
+    append(buf, size, &len, "# HELP boson_command_errors_total Camera commands that failed.\n"
+                            "# TYPE boson_command_errors_total counter\n");
+    for (i = 0; i < stats->count; i++)
+        append(buf, size, &len, "boson_command_errors_total{%s%sfn_id=\"0x%08X\"} %llu\n",
+               labels, sep, stats->commands[i].fnID, (unsigned long long) stats->commands[i].errors);
+    return len;
+}
@@ -0,0 +1,120 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+
+#ifndef CLIENT_HOOKS_H
+#define CLIENT_HOOKS_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Instrumentation hooks: where the time of each synchronous command goes.
+ *
+ * A hook set on a context is called from CLIENT_dispatcher() at each point
+ * of every command it sends: PRE_SEND, POST_SEND, FIRST_BYTE (when the
+ * start of the response arrived, UART only) and then COMPLETE or ERROR.
+ * Timestamps are monotonic ns, the clock of Client_FslpLog. Hooks run on
+ * the calling thread, inside the API call: keep them short and don't call
+ * the API from them.
+ *
+ * Built with WITH_HOOKS=0 the dispatcher has no hook code at all and
+ * CLIENT_hookSet() returns R_SDK_API_NOT_DEFINED. Responses from
+ * Client_GetterCache and setters kept by Client_WriteBehind are not
+ * commands sent, so they are not reported; pipelined and event-loop
+ * commands are not hooked.
+ *
+ * CLIENT_latencyStatsHook is a ready-made hook: per-command latency
+ * histograms, PRE_SEND to COMPLETE or ERROR, written in the Prometheus
+ * text format by CLIENT_latencyStatsFormat().
+ */
+
+typedef enum {
+    CLIENT_HOOK_PRE_SEND = 0,   // before the command is written
+    CLIENT_HOOK_POST_SEND,      // written to the transport
+    CLIENT_HOOK_FIRST_BYTE,     // start of the response read
+    CLIENT_HOOK_COMPLETE,       // R_SUCCESS, receiveBytes of response data
+    CLIENT_HOOK_ERROR,          // failed with result: transport, mismatch or camera status
+} CLIENT_HOOK_POINT;
+
+typedef struct {
+    CLIENT_HOOK_POINT point;
+    uint64_t timestampNs;
+    uint32_t seqNum;
+    uint32_t fnID;
+    uint32_t sendBytes;         // command data, without the 12-byte header
+    uint32_t receiveBytes;      // response data, COMPLETE only
+    FLR_RESULT result;          // COMPLETE and ERROR
+} CLIENT_HOOK_EVENT;
+
+typedef void CLIENT_hook_t(void *context, const CLIENT_HOOK_EVENT *event);
+
+// Call hook for the current context's commands, NULL to stop
+FLR_EXPORT FLR_RESULT CLIENT_hookSet(CLIENT_hook_t *hook, void *context);
+
+#define CLIENT_LATENCY_MAX_COMMANDS  (64)   // later function codes are counted as fn_id 0
+#define CLIENT_LATENCY_BUCKETS       (12)   // upper bounds, +Inf is the count
+
+extern FLR_EXPORT const uint32_t CLIENT_latencyBucketsUs[CLIENT_LATENCY_BUCKETS];
+
+typedef struct {
+    uint32_t fnID;
+    uint64_t count;
+    uint64_t errors;            // of count, ended in ERROR
+    uint64_t sumNs;
+    uint64_t buckets[CLIENT_LATENCY_BUCKETS];   // cumulative, as Prometheus has them
+} CLIENT_LATENCY_COMMAND;
+
+typedef struct boson_latency_stats CLIENT_LATENCY_STATS;
+
+FLR_EXPORT CLIENT_LATENCY_STATS *CLIENT_latencyStatsCreate(void);
+FLR_EXPORT void CLIENT_latencyStatsDestroy(CLIENT_LATENCY_STATS *stats);
+FLR_EXPORT void CLIENT_latencyStatsReset(CLIENT_LATENCY_STATS *stats);
+
+// The hook, with the stats as its context: CLIENT_hookSet(CLIENT_latencyStatsHook, stats)
+FLR_EXPORT void CLIENT_latencyStatsHook(void *context, const CLIENT_HOOK_EVENT *event);
+
+// Number of function codes seen; command i (0..n-1) is copied to *command
+FLR_EXPORT uint32_t CLIENT_latencyStatsCount(const CLIENT_LATENCY_STATS *stats);
+FLR_EXPORT FLR_RESULT CLIENT_latencyStatsGet(const CLIENT_LATENCY_STATS *stats, uint32_t i, CLIENT_LATENCY_COMMAND *command);
+
+// Prometheus text format of boson_command_seconds (histogram) and
+// boson_command_errors_total, per fn_id; labels, e.g. "camera=\"cam0\"",
+// are added to every sample if not NULL. Returns the length of the whole
+// text, as snprintf(): it was cut short if that is size or more.
+FLR_EXPORT uint32_t CLIENT_latencyStatsFormat(const CLIENT_LATENCY_STATS *stats, const char *labels, char *buf, uint32_t size);
+
+// Called by CLIENT_dispatcher() through CLIENT_HOOK
+struct boson_ctx;
+void CLIENT_hookEmit(struct boson_ctx *ctx, CLIENT_HOOK_POINT point, uint32_t seqNum, uint32_t fnID,
+                     uint32_t sendBytes, uint32_t receiveBytes, FLR_RESULT result, uint64_t timestampNs);
+
+#ifdef CLIENT_HOOKS
+// timestampNs 0 for now; a FIRST_BYTE without a timestamp is not reported
+#define CLIENT_HOOK(ctx, point, seqNum, fnID, sendBytes, receiveBytes, result, timestampNs) do { \
+        if ((ctx)->hook) \
+            CLIENT_hookEmit((ctx), (point), (seqNum), (fnID), (sendBytes), (receiveBytes), (result), (timestampNs)); \
+    } while (0)
+#else
+#define CLIENT_HOOK(ctx, point, seqNum, fnID, sendBytes, receiveBytes, result, timestampNs) do { (void) (ctx); } while (0)
+#endif
+
+#endif // CLIENT_HOOKS_H
@@ -18,6 +18,7 @@
 #include "Client_Interface.h"
 
 #ifdef USE_I2C_SLAVE_CP
+#include <string.h>
 #include "I2C_Connector.h"
 #else
 #include "UART_Connector.h"
@@ -51,3 +52,37 @@ FLR_RESULT CLIENT_interface_writeFrame(uint8_t *writeData, uint32_t writeBytes)
 #endif
     return FLR_OK;
 }
+
+FLR_RESULT CLIENT_interface_writeFrameV(const CLIENT_SEGMENT *segments, uint32_t numSegments)
+{
+    if(segments == NULL)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+#ifdef USE_I2C_SLAVE_CP
+    uint32_t i, writeBytes = 0;
+    for(i = 0; i < numSegments; i++)
+        writeBytes += segments[i].len;
+
+    // the I2C frame header goes in front, so gather here
+    uint8_t writeData[writeBytes ? writeBytes : 1];
+    uint8_t *ptr = writeData;
+    for(i = 0; i < numSegments; i++) {
+        memcpy(ptr, segments[i].data, segments[i].len);
+        ptr += segments[i].len;
+    }
+    if(I2C_writeFrame(writeData, writeBytes) != FLR_OK)
+        return FLR_COMM_ERROR_WRITING_COMM;
+#else
+    SendToCameraV(CommandChannel, segments, numSegments);
+#endif
+    return FLR_OK;
+}
+
+uint64_t CLIENT_interface_startByteNs(void)
+{
+#ifdef USE_I2C_SLAVE_CP
+    return 0;
+#else
+    return (uint64_t) StartByteNs();
+#endif
+}
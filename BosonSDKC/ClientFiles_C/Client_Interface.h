@@ -22,7 +22,27 @@
 #include <stdlib.h>
 #include "ReturnCodes.h"
 
+// Largest command payload handled, 12-byte header included; every
+// synchronous call keeps a receive buffer this big on its stack. Small
+// targets can lower it with -DCLIENT_MAX_FRAME_BYTES=..., as long as the
+// largest reply they use still fits and FSLP_FRAME_BUF_SIZ matches.
+#ifndef CLIENT_MAX_FRAME_BYTES
+#define CLIENT_MAX_FRAME_BYTES  (530)
+#endif
+
 FLR_RESULT CLIENT_interface_readFrame(uint8_t *readData, uint32_t *readBytes);
 FLR_RESULT CLIENT_interface_writeFrame(uint8_t *writeData, uint32_t writeBytes);
 
+// Monotonic ns at which the last read frame started arriving, 0 if unknown (I2C)
+uint64_t CLIENT_interface_startByteNs(void);
+
+// One piece of a frame for CLIENT_interface_writeFrameV, same layout as FSLP_SEGMENT
+typedef struct {
+    const uint8_t *data;
+    uint32_t len;
+} CLIENT_SEGMENT;
+
+// Write the concatenation of the segments as one frame
+FLR_RESULT CLIENT_interface_writeFrameV(const CLIENT_SEGMENT *segments, uint32_t numSegments);
+
 #endif
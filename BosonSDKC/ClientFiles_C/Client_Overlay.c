@@ -0,0 +1,287 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include <string.h>
+
+#include "Client_Overlay.h"
+#include "Client_Pipeline.h"
+#include "EnumTypes.h"
+#include "FunctionCodes.h"
+#include "Serializer_BuiltIn.h"
+
+#define TEXT_BYTES  (18 + CLIENT_OVERLAY_TEXT_MAX)   // SYMBOLOGY_CREATETEXT payload
+
+typedef struct {
+    CLIENT_OVERLAY *ov;
+    uint8_t id;                                 // symbol being sent
+    uint8_t touched[CLIENT_OVERLAY_SYMBOLS];
+    FLR_RESULT error[CLIENT_OVERLAY_SYMBOLS];   // first failure of each symbol's commands
+    FLR_RESULT enableError;
+} COMMIT_STATE;
+
+// context is the FLR_RESULT slot of the command's symbol
+static void commandDone(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *data, uint32_t bytes)
+{
+    FLR_RESULT *error = (FLR_RESULT *) context;
+
+    (void) fnID;
+    (void) data;
+    (void) bytes;
+    if (result != R_SUCCESS && *error == R_SUCCESS)
+        *error = result;
+}
+
+static FLR_RESULT submit(COMMIT_STATE *st, FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes)
+{
+    FLR_RESULT *error = fnID == SYMBOLOGY_SETENABLE ? &st->enableError : &st->error[st->id];
+
+    st->ov->sent++;
+    st->touched[st->id] = 1;
+    return CLIENT_pipelineSubmit(fnID, sendData, sendBytes, commandDone, error, NULL);
+}
+
+static FLR_RESULT sendCreate(COMMIT_STATE *st, const CLIENT_OVERLAY_SYMBOL *s)
+{
+    static const FLR_FUNCTION fnIDs[] = {
+        [CLIENT_OVERLAY_LINE]             = SYMBOLOGY_CREATELINE,
+        [CLIENT_OVERLAY_RECTANGLE]        = SYMBOLOGY_CREATEOUTLINEDRECTANGLE,
+        [CLIENT_OVERLAY_FILLED_RECTANGLE] = SYMBOLOGY_CREATEFILLEDRECTANGLE,
+        [CLIENT_OVERLAY_FILLED_ELLIPSE]   = SYMBOLOGY_CREATEFILLEDELLIPSE,
+        [CLIENT_OVERLAY_TEXT]             = SYMBOLOGY_CREATETEXT,
+    };
+    uint8_t sendData[TEXT_BYTES] = {0};
+
+    UCHARToByte(st->id, sendData);
+    INT_16ToByte(s->x, sendData + 1);
+    INT_16ToByte(s->y, sendData + 3);
+    INT_16ToByte(s->x2, sendData + 5);
+    INT_16ToByte(s->y2, sendData + 7);
+    if (s->shape != CLIENT_OVERLAY_TEXT) {
+        UINT_32ToByte(s->color, sendData + 9);
+        return submit(st, fnIDs[s->shape], sendData, 13);
+    }
+
+    memset(sendData + 9, 0, sizeof(sendData) - 9);
+    CHARToByte(0, sendData + 9);    // font
+    INT_16ToByte(s->size, sendData + 10);
+    INT_16ToByte(FLR_SYMBOLOGY_LEFT_TOP, sendData + 12);
+    UINT_32ToByte(s->color, sendData + 14);
+    memcpy(sendData + 18, s->text, strlen(s->text));
+    return submit(st, SYMBOLOGY_CREATETEXT, sendData, TEXT_BYTES);
+}
+
+static FLR_RESULT sendMove(COMMIT_STATE *st, int16_t x, int16_t y)
+{
+    uint8_t sendData[5] = {0};
+
+    UCHARToByte(st->id, sendData);
+    INT_16ToByte(x, sendData + 1);
+    INT_16ToByte(y, sendData + 3);
+    return submit(st, SYMBOLOGY_MOVESPRITE, sendData, sizeof(sendData));
+}
+
+static FLR_RESULT sendId(COMMIT_STATE *st, FLR_FUNCTION fnID, int32_t visible)
+{
+    uint8_t sendData[2] = {0};
+
+    UCHARToByte(st->id, sendData);
+    if (visible < 0)
+        return submit(st, fnID, sendData, 1);
+    UCHARToByte((uint8_t) visible, sendData + 1);
+    return submit(st, fnID, sendData, 2);
+}
+
+// Same symbol up to its position: a line's end point moves with it
+static int sameContent(const CLIENT_OVERLAY_SYMBOL *a, const CLIENT_OVERLAY_SYMBOL *b)
+{
+    if (a->shape != b->shape || a->color != b->color)
+        return 0;
+    if (a->shape == CLIENT_OVERLAY_LINE)
+        return a->x2 - a->x == b->x2 - b->x && a->y2 - a->y == b->y2 - b->y;
+    if (a->x2 != b->x2 || a->y2 != b->y2)
+        return 0;
+    return a->shape != CLIENT_OVERLAY_TEXT || (a->size == b->size && !strcmp(a->text, b->text));
+}
+
+static FLR_RESULT commitSymbol(COMMIT_STATE *st)
+{
+    CLIENT_OVERLAY *ov = st->ov;
+    const CLIENT_OVERLAY_SYMBOL *w = &ov->want[st->id];
+    const CLIENT_OVERLAY_SYMBOL *s = &ov->shown[st->id];
+    FLR_RESULT res;
+
+    if (w->shape == CLIENT_OVERLAY_NONE) {
+        if (s->shape == CLIENT_OVERLAY_NONE)
+            return R_SUCCESS;
+        return sendId(st, SYMBOLOGY_DELETE, -1);
+    }
+
+    if (!sameContent(w, s)) {
+        if (!ov->enabled) {
+            uint8_t sendData[4] = {0};
+
+            INT_32ToByte(FLR_ENABLE, sendData);
+            res = submit(st, SYMBOLOGY_SETENABLE, sendData, sizeof(sendData));
+            if (res != R_SUCCESS)
+                return res;
+            ov->enabled = 1;
+        }
+        res = sendCreate(st, w);
+    } else if (w->x != s->x || w->y != s->y) {
+        res = sendMove(st, w->x, w->y);
+    } else if (w->visible != s->visible) {
+        res = R_SUCCESS;
+    } else {
+        return R_SUCCESS;
+    }
+    // Draws the created or moved symbol, or shows/hides it
+    if (res == R_SUCCESS)
+        res = sendId(st, SYMBOLOGY_UPDATEANDSHOW, w->visible);
+    return res;
+}
+
+static CLIENT_OVERLAY_SYMBOL *setShape(CLIENT_OVERLAY *ov, uint8_t id, uint8_t shape, int16_t x, int16_t y, int16_t x2, int16_t y2,
+                                       uint32_t color)
+{
+    CLIENT_OVERLAY_SYMBOL *w;
+
+    if (!ov || id >= CLIENT_OVERLAY_SYMBOLS)
+        return NULL;
+    w = &ov->want[id];
+    memset(w, 0, sizeof(*w));
+    w->shape = shape;
+    w->visible = 1;
+    w->x = x;
+    w->y = y;
+    w->x2 = x2;
+    w->y2 = y2;
+    w->color = color;
+    return w;
+}
+
+FLR_RESULT CLIENT_overlayLine(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t x2, int16_t y2, uint32_t color)
+{
+    return setShape(ov, id, CLIENT_OVERLAY_LINE, x, y, x2, y2, color) ? R_SUCCESS : FLR_RANGE_ERROR;
+}
+
+FLR_RESULT CLIENT_overlayRectangle(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t width, int16_t height,
+                                   uint32_t color, uint8_t filled)
+{
+    uint8_t shape = filled ? CLIENT_OVERLAY_FILLED_RECTANGLE : CLIENT_OVERLAY_RECTANGLE;
+
+    return setShape(ov, id, shape, x, y, width, height, color) ? R_SUCCESS : FLR_RANGE_ERROR;
+}
+
+FLR_RESULT CLIENT_overlayEllipse(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t width, int16_t height, uint32_t color)
+{
+    return setShape(ov, id, CLIENT_OVERLAY_FILLED_ELLIPSE, x, y, width, height, color) ? R_SUCCESS : FLR_RANGE_ERROR;
+}
+
+FLR_RESULT CLIENT_overlayText(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t width, int16_t height,
+                              int16_t size, uint32_t color, const char *text)
+{
+    CLIENT_OVERLAY_SYMBOL *w;
+
+    if (!text)
+        return FLR_BAD_ARG_POINTER_ERROR;
+    if (strlen(text) >= CLIENT_OVERLAY_TEXT_MAX)
+        return FLR_RANGE_ERROR;
+    w = setShape(ov, id, CLIENT_OVERLAY_TEXT, x, y, width, height, color);
+    if (!w)
+        return FLR_RANGE_ERROR;
+    w->size = size;
+    strcpy(w->text, text);
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_overlayMove(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y)
+{
+    CLIENT_OVERLAY_SYMBOL *w;
+
+    if (!ov || id >= CLIENT_OVERLAY_SYMBOLS || ov->want[id].shape == CLIENT_OVERLAY_NONE)
+        return FLR_RANGE_ERROR;
+    w = &ov->want[id];
+    if (w->shape == CLIENT_OVERLAY_LINE) {
+        w->x2 += x - w->x;
+        w->y2 += y - w->y;
+    }
+    w->x = x;
+    w->y = y;
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_overlayShow(CLIENT_OVERLAY *ov, uint8_t id, uint8_t visible)
+{
+    if (!ov || id >= CLIENT_OVERLAY_SYMBOLS || ov->want[id].shape == CLIENT_OVERLAY_NONE)
+        return FLR_RANGE_ERROR;
+    ov->want[id].visible = visible ? 1 : 0;
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_overlayRemove(CLIENT_OVERLAY *ov, uint8_t id)
+{
+    if (!ov || id >= CLIENT_OVERLAY_SYMBOLS)
+        return FLR_RANGE_ERROR;
+    memset(&ov->want[id], 0, sizeof(ov->want[id]));
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_overlayCommit(CLIENT_OVERLAY *ov)
+{
+    COMMIT_STATE st;
+    FLR_RESULT res = R_SUCCESS;
+    uint32_t i;
+
+    if (!ov)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    memset(&st, 0, sizeof(st));
+    st.ov = ov;
+    ov->sent = 0;
+    for (i = 0; i < CLIENT_OVERLAY_SYMBOLS && res == R_SUCCESS; i++) {
+        st.id = (uint8_t) i;
+        res = commitSymbol(&st);
+    }
+    // A link error stops the commit; the symbols not sent yet go next time
+    if (res != R_SUCCESS) {
+        st.touched[st.id] = 1;
+        st.error[st.id] = res;
+    }
+    CLIENT_pipelineFlush();
+
+    if (st.enableError != R_SUCCESS)
+        ov->enabled = 0;
+    for (i = 0; i < CLIENT_OVERLAY_SYMBOLS; i++) {
+        if (!st.touched[i])
+            continue;
+        if (st.error[i] == R_SUCCESS && st.enableError == R_SUCCESS) {
+            ov->shown[i] = ov->want[i];
+            continue;
+        }
+        // Drawn again, or deleted, at the next commit
+        ov->shown[i].shape = CLIENT_OVERLAY_UNKNOWN;
+        if (res == R_SUCCESS)
+            res = st.error[i] != R_SUCCESS ? st.error[i] : st.enableError;
+    }
+    return res;
+}
+
+void CLIENT_overlayReset(CLIENT_OVERLAY *ov)
+{
+    if (!ov)
+        return;
+    memset(ov->shown, 0, sizeof(ov->shown));
+    ov->enabled = 0;
+}
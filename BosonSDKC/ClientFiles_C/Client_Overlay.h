@@ -0,0 +1,96 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef CLIENT_OVERLAY_H
+#define CLIENT_OVERLAY_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Crosshairs, boxes and text drawn into the video by the camera's
+ * symbology engine, so the host does no per-frame drawing.
+ *
+ * The calls below only describe the overlay wanted; CLIENT_overlayCommit()
+ * compares it with what the camera shows and sends just the difference
+ * through Client_Pipeline: a new or changed symbol is created again, one
+ * that only moved gets a MOVESPRITE, one that was removed a DELETE. Each is
+ * followed by its UPDATEANDSHOW. A commit with nothing changed sends
+ * nothing, so commit once per frame or per UI update at no bus cost.
+ *
+ * Zero the CLIENT_OVERLAY to start; it is about 36 KB, keep it off small
+ * stacks. Same threading rules as Client_Pipeline. IDs at and above
+ * CLIENT_OVERLAY_SYMBOLS belong to the V4L2 driver's overlay controls.
+ */
+
+#define CLIENT_OVERLAY_SYMBOLS   (125)  // IDs 0..124
+#define CLIENT_OVERLAY_TEXT_MAX  (128)  // SYMBOLOGY_CREATETEXT text, terminator included
+
+typedef enum {
+    CLIENT_OVERLAY_NONE = 0,
+    CLIENT_OVERLAY_LINE,                // from x, y to x2, y2
+    CLIENT_OVERLAY_RECTANGLE,           // outline, at x, y, x2 wide and y2 high
+    CLIENT_OVERLAY_FILLED_RECTANGLE,
+    CLIENT_OVERLAY_FILLED_ELLIPSE,      // inside the x, y, x2, y2 box
+    CLIENT_OVERLAY_TEXT,                // left-top aligned in the x, y, x2, y2 box
+    CLIENT_OVERLAY_UNKNOWN = 0xff       // camera state lost by a failed command
+} CLIENT_OVERLAY_SHAPE_E;
+
+typedef struct {
+    uint8_t shape;                      // CLIENT_OVERLAY_SHAPE_E
+    uint8_t visible;
+    int16_t x, y;
+    int16_t x2, y2;
+    int16_t size;                       // text only
+    uint32_t color;                     // 0xAARRGGBB
+    char text[CLIENT_OVERLAY_TEXT_MAX];
+} CLIENT_OVERLAY_SYMBOL;
+
+typedef struct {
+    CLIENT_OVERLAY_SYMBOL want[CLIENT_OVERLAY_SYMBOLS];   // set by the calls below
+    CLIENT_OVERLAY_SYMBOL shown[CLIENT_OVERLAY_SYMBOLS];  // what the camera draws
+    uint8_t enabled;                    // SYMBOLOGY_SETENABLE sent
+    uint32_t sent;                      // commands sent by the last commit
+} CLIENT_OVERLAY;
+
+// Shapes are visible once created; a changed shape, size or color recreates the symbol
+FLR_EXPORT FLR_RESULT CLIENT_overlayLine(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t x2, int16_t y2, uint32_t color);
+FLR_EXPORT FLR_RESULT CLIENT_overlayRectangle(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t width, int16_t height,
+                                              uint32_t color, uint8_t filled);
+FLR_EXPORT FLR_RESULT CLIENT_overlayEllipse(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t width, int16_t height, uint32_t color);
+FLR_EXPORT FLR_RESULT CLIENT_overlayText(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y, int16_t width, int16_t height,
+                                         int16_t size, uint32_t color, const char *text);
+
+// New position of the symbol's x, y; a line keeps its length and direction
+FLR_EXPORT FLR_RESULT CLIENT_overlayMove(CLIENT_OVERLAY *ov, uint8_t id, int16_t x, int16_t y);
+
+FLR_EXPORT FLR_RESULT CLIENT_overlayShow(CLIENT_OVERLAY *ov, uint8_t id, uint8_t visible);
+
+// Deleted from the camera at the next commit
+FLR_EXPORT FLR_RESULT CLIENT_overlayRemove(CLIENT_OVERLAY *ov, uint8_t id);
+
+// Send what changed since the last commit and flush the pipeline
+FLR_EXPORT FLR_RESULT CLIENT_overlayCommit(CLIENT_OVERLAY *ov);
+
+// Forget what the camera draws, e.g. after it rebooted: the next commit draws everything again
+FLR_EXPORT void CLIENT_overlayReset(CLIENT_OVERLAY *ov);
+
+#endif // CLIENT_OVERLAY_H
@@ -17,7 +17,7 @@
 
 #include "Client_Packager.h"
 
-static uint32_t commandCount = 0;
+#include "Client_Context.h"
 
 // Begin Module: TLinear
 // Synchronous (potentially MultiService incompatible) transmit+receive variant
@@ -39,7 +39,7 @@ FLR_RESULT CLIENT_pkgTlinearSetControl(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TLINEAR_SETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TLINEAR_SETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -61,7 +61,7 @@ FLR_RESULT CLIENT_pkgTlinearGetControl(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TLINEAR_GETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TLINEAR_GETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -114,7 +114,7 @@ FLR_RESULT CLIENT_pkgTlinearGetLUT(const FLR_BOSON_TABLETYPE_E mode, const uint1
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TLINEAR_GETLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TLINEAR_GETLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -198,7 +198,7 @@ FLR_RESULT CLIENT_pkgTlinearRefreshLUT(const FLR_BOSON_TABLETYPE_E mode) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TLINEAR_REFRESHLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TLINEAR_REFRESHLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -232,7 +232,7 @@ FLR_RESULT CLIENT_pkgAgcSetPercentPerBin(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETPERCENTPERBIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETPERCENTPERBIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -254,7 +254,7 @@ FLR_RESULT CLIENT_pkgAgcGetPercentPerBin(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETPERCENTPERBIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETPERCENTPERBIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -297,7 +297,7 @@ FLR_RESULT CLIENT_pkgAgcSetLinearPercent(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETLINEARPERCENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETLINEARPERCENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -319,7 +319,7 @@ FLR_RESULT CLIENT_pkgAgcGetLinearPercent(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETLINEARPERCENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETLINEARPERCENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -362,7 +362,7 @@ FLR_RESULT CLIENT_pkgAgcSetOutlierCut(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETOUTLIERCUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETOUTLIERCUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -384,7 +384,7 @@ FLR_RESULT CLIENT_pkgAgcGetOutlierCut(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETOUTLIERCUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETOUTLIERCUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -417,7 +417,7 @@ FLR_RESULT CLIENT_pkgAgcGetDrOut(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETDROUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETDROUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -460,7 +460,7 @@ FLR_RESULT CLIENT_pkgAgcSetMaxGain(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETMAXGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETMAXGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -482,7 +482,7 @@ FLR_RESULT CLIENT_pkgAgcGetMaxGain(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETMAXGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETMAXGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -525,7 +525,7 @@ FLR_RESULT CLIENT_pkgAgcSetdf(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETDF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETDF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -547,7 +547,7 @@ FLR_RESULT CLIENT_pkgAgcGetdf(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETDF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETDF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -590,7 +590,7 @@ FLR_RESULT CLIENT_pkgAgcSetGamma(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETGAMMA, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETGAMMA, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -612,7 +612,7 @@ FLR_RESULT CLIENT_pkgAgcGetGamma(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETGAMMA, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETGAMMA, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -645,7 +645,7 @@ FLR_RESULT CLIENT_pkgAgcGetFirstBin(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETFIRSTBIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETFIRSTBIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -678,7 +678,7 @@ FLR_RESULT CLIENT_pkgAgcGetLastBin(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETLASTBIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETLASTBIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -721,7 +721,7 @@ FLR_RESULT CLIENT_pkgAgcSetDetailHeadroom(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETDETAILHEADROOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETDETAILHEADROOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -743,7 +743,7 @@ FLR_RESULT CLIENT_pkgAgcGetDetailHeadroom(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETDETAILHEADROOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETDETAILHEADROOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -786,7 +786,7 @@ FLR_RESULT CLIENT_pkgAgcSetd2br(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETD2BR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETD2BR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -808,7 +808,7 @@ FLR_RESULT CLIENT_pkgAgcGetd2br(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETD2BR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETD2BR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -851,7 +851,7 @@ FLR_RESULT CLIENT_pkgAgcSetSigmaR(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETSIGMAR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETSIGMAR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -873,7 +873,7 @@ FLR_RESULT CLIENT_pkgAgcGetSigmaR(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETSIGMAR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETSIGMAR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -916,7 +916,7 @@ FLR_RESULT CLIENT_pkgAgcSetUseEntropy(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETUSEENTROPY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETUSEENTROPY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -938,7 +938,7 @@ FLR_RESULT CLIENT_pkgAgcGetUseEntropy(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETUSEENTROPY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETUSEENTROPY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -981,7 +981,7 @@ FLR_RESULT CLIENT_pkgAgcSetROI(const FLR_ROI_T roi) {
         outPtr += 8;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1003,7 +1003,7 @@ FLR_RESULT CLIENT_pkgAgcGetROI(FLR_ROI_T *roi) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1036,7 +1036,7 @@ FLR_RESULT CLIENT_pkgAgcGetMaxGainApplied(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETMAXGAINAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETMAXGAINAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1069,7 +1069,7 @@ FLR_RESULT CLIENT_pkgAgcGetSigmaRApplied(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETSIGMARAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETSIGMARAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1112,7 +1112,7 @@ FLR_RESULT CLIENT_pkgAgcSetOutlierCutBalance(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETOUTLIERCUTBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETOUTLIERCUTBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1134,7 +1134,7 @@ FLR_RESULT CLIENT_pkgAgcGetOutlierCutBalance(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETOUTLIERCUTBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETOUTLIERCUTBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1167,7 +1167,7 @@ FLR_RESULT CLIENT_pkgAgcGetOutlierCutApplied(float *percentHigh, float *percentL
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETOUTLIERCUTAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETOUTLIERCUTAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1221,7 +1221,7 @@ FLR_RESULT CLIENT_pkgAgcSetDetailHeadroomBalance(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETDETAILHEADROOMBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETDETAILHEADROOMBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1243,7 +1243,7 @@ FLR_RESULT CLIENT_pkgAgcGetDetailHeadroomBalance(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETDETAILHEADROOMBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETDETAILHEADROOMBALANCE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1276,7 +1276,7 @@ FLR_RESULT CLIENT_pkgAgcGetDetailHeadroomApplied(float *countsHigh, float *count
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETDETAILHEADROOMAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETDETAILHEADROOMAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1320,7 +1320,7 @@ FLR_RESULT CLIENT_pkgAgcGetTfThresholds(uint16_t *tf_thresholdMin, uint16_t *tf_
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETTFTHRESHOLDS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETTFTHRESHOLDS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1384,7 +1384,7 @@ FLR_RESULT CLIENT_pkgAgcSetTfThresholds(const uint16_t tf_thresholdMin, const ui
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETTFTHRESHOLDS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETTFTHRESHOLDS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1406,7 +1406,7 @@ FLR_RESULT CLIENT_pkgAgcGetMode(FLR_AGC_MODE_E *mode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1449,7 +1449,7 @@ FLR_RESULT CLIENT_pkgAgcSetMode(const FLR_AGC_MODE_E mode) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1501,7 +1501,7 @@ FLR_RESULT CLIENT_pkgAgcSetHighTempAlarmValues(const uint32_t lowGain, const uin
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETHIGHTEMPALARMVALUES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETHIGHTEMPALARMVALUES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1523,7 +1523,7 @@ FLR_RESULT CLIENT_pkgAgcGetContrast(int32_t *contrast) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETCONTRAST, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETCONTRAST, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1566,7 +1566,7 @@ FLR_RESULT CLIENT_pkgAgcSetContrast(const int32_t contrast) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETCONTRAST, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETCONTRAST, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1588,7 +1588,7 @@ FLR_RESULT CLIENT_pkgAgcGetBrightnessBias(int32_t *brightnessBias) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETBRIGHTNESSBIAS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETBRIGHTNESSBIAS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1631,7 +1631,7 @@ FLR_RESULT CLIENT_pkgAgcSetBrightnessBias(const int32_t brightnessBias) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETBRIGHTNESSBIAS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETBRIGHTNESSBIAS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1653,7 +1653,7 @@ FLR_RESULT CLIENT_pkgAgcGetBrightness(int32_t *brightness) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETBRIGHTNESS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETBRIGHTNESS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1696,7 +1696,7 @@ FLR_RESULT CLIENT_pkgAgcSetBrightness(const int32_t brightness) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETBRIGHTNESS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETBRIGHTNESS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1728,7 +1728,7 @@ FLR_RESULT CLIENT_pkgAgcSetMaxGainForLowGain(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETMAXGAINFORLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETMAXGAINFORLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1750,7 +1750,7 @@ FLR_RESULT CLIENT_pkgAgcGetMaxGainForLowGain(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETMAXGAINFORLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETMAXGAINFORLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1793,7 +1793,7 @@ FLR_RESULT CLIENT_pkgAgcSetRadius(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETRADIUS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETRADIUS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1815,7 +1815,7 @@ FLR_RESULT CLIENT_pkgAgcGetRadius(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETRADIUS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETRADIUS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1858,7 +1858,7 @@ FLR_RESULT CLIENT_pkgAgcSetGmax(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETGMAX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETGMAX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1880,7 +1880,7 @@ FLR_RESULT CLIENT_pkgAgcGetGmax(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETGMAX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETGMAX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1923,7 +1923,7 @@ FLR_RESULT CLIENT_pkgAgcSetGmin(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_SETGMIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_SETGMIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1945,7 +1945,7 @@ FLR_RESULT CLIENT_pkgAgcGetGmin(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, AGC_GETGMIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, AGC_GETGMIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -1980,7 +1980,7 @@ FLR_RESULT CLIENT_pkgBosonGetCameraSN(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETCAMERASN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETCAMERASN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2013,7 +2013,7 @@ FLR_RESULT CLIENT_pkgBosonGetCameraPN(FLR_BOSON_PARTNUMBER_T *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETCAMERAPN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETCAMERAPN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2046,7 +2046,7 @@ FLR_RESULT CLIENT_pkgBosonGetSensorSN(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSENSORSN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSENSORSN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2079,7 +2079,7 @@ FLR_RESULT CLIENT_pkgBosonRunFFC() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_RUNFFC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_RUNFFC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2111,7 +2111,7 @@ FLR_RESULT CLIENT_pkgBosonSetFFCTempThreshold(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCTEMPTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCTEMPTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2133,7 +2133,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCTempThreshold(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCTEMPTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCTEMPTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2176,7 +2176,7 @@ FLR_RESULT CLIENT_pkgBosonSetFFCFrameThreshold(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2198,7 +2198,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCFrameThreshold(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2231,7 +2231,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCInProgress(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCINPROGRESS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCINPROGRESS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2264,7 +2264,7 @@ FLR_RESULT CLIENT_pkgBosonReboot() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_REBOOT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_REBOOT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2296,7 +2296,7 @@ FLR_RESULT CLIENT_pkgBosonSetFFCMode(const FLR_BOSON_FFCMODE_E ffcMode) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2318,7 +2318,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCMode(FLR_BOSON_FFCMODE_E *ffcMode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2361,7 +2361,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainMode(const FLR_BOSON_GAINMODE_E gainMode) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2383,7 +2383,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainMode(FLR_BOSON_GAINMODE_E *gainMode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2416,7 +2416,7 @@ FLR_RESULT CLIENT_pkgBosonWriteDynamicHeaderToFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_WRITEDYNAMICHEADERTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_WRITEDYNAMICHEADERTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2438,7 +2438,7 @@ FLR_RESULT CLIENT_pkgBosonReadDynamicHeaderFromFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_READDYNAMICHEADERFROMFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_READDYNAMICHEADERFROMFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2460,7 +2460,7 @@ FLR_RESULT CLIENT_pkgBosonRestoreFactoryDefaultsFromFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_RESTOREFACTORYDEFAULTSFROMFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_RESTOREFACTORYDEFAULTSFROMFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2482,7 +2482,7 @@ FLR_RESULT CLIENT_pkgBosonRestoreFactoryBadPixelsFromFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_RESTOREFACTORYBADPIXELSFROMFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_RESTOREFACTORYBADPIXELSFROMFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2504,7 +2504,7 @@ FLR_RESULT CLIENT_pkgBosonWriteBadPixelsToFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_WRITEBADPIXELSTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_WRITEBADPIXELSTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2526,7 +2526,7 @@ FLR_RESULT CLIENT_pkgBosonGetSoftwareRev(uint32_t *major, uint32_t *minor, uint3
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSOFTWAREREV, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSOFTWAREREV, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2601,7 +2601,7 @@ FLR_RESULT CLIENT_pkgBosonSetBadPixelLocation(const uint32_t row, const uint32_t
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETBADPIXELLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETBADPIXELLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2623,7 +2623,7 @@ FLR_RESULT CLIENT_pkgBosonlookupFPATempDegCx10(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_LOOKUPFPATEMPDEGCX10, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_LOOKUPFPATEMPDEGCX10, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2656,7 +2656,7 @@ FLR_RESULT CLIENT_pkgBosonlookupFPATempDegKx10(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_LOOKUPFPATEMPDEGKX10, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_LOOKUPFPATEMPDEGKX10, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2689,7 +2689,7 @@ FLR_RESULT CLIENT_pkgBosonWriteLensNvFfcToFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_WRITELENSNVFFCTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_WRITELENSNVFFCTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2711,7 +2711,7 @@ FLR_RESULT CLIENT_pkgBosonWriteLensGainToFlash() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_WRITELENSGAINTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_WRITELENSGAINTOFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2743,7 +2743,7 @@ FLR_RESULT CLIENT_pkgBosonSetLensNumber(const uint32_t lensNumber) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETLENSNUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETLENSNUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2765,7 +2765,7 @@ FLR_RESULT CLIENT_pkgBosonGetLensNumber(uint32_t *lensNumber) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETLENSNUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETLENSNUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2808,7 +2808,7 @@ FLR_RESULT CLIENT_pkgBosonSetTableNumber(const uint32_t tableNumber) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2830,7 +2830,7 @@ FLR_RESULT CLIENT_pkgBosonGetTableNumber(uint32_t *tableNumber) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2863,7 +2863,7 @@ FLR_RESULT CLIENT_pkgBosonGetSensorPN(FLR_BOSON_SENSOR_PARTNUMBER_T *sensorPN) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSENSORPN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSENSORPN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2906,7 +2906,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainSwitchParams(const FLR_BOSON_GAIN_SWITCH_PARAMS
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINSWITCHPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINSWITCHPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2928,7 +2928,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchParams(FLR_BOSON_GAIN_SWITCH_PARAMS_T *pa
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2961,7 +2961,7 @@ FLR_RESULT CLIENT_pkgBosonGetSwitchToHighGainFlag(uint8_t *switchToHighGainFlag)
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSWITCHTOHIGHGAINFLAG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSWITCHTOHIGHGAINFLAG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -2994,7 +2994,7 @@ FLR_RESULT CLIENT_pkgBosonGetSwitchToLowGainFlag(uint8_t *switchToLowGainFlag) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSWITCHTOLOWGAINFLAG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSWITCHTOLOWGAINFLAG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3027,7 +3027,7 @@ FLR_RESULT CLIENT_pkgBosonGetCLowToHighPercent(uint32_t *cLowToHighPercent) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETCLOWTOHIGHPERCENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETCLOWTOHIGHPERCENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3060,7 +3060,7 @@ FLR_RESULT CLIENT_pkgBosonGetMaxNUCTables(uint32_t *maxNUCTables) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETMAXNUCTABLES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETMAXNUCTABLES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3093,7 +3093,7 @@ FLR_RESULT CLIENT_pkgBosonGetMaxLensTables(uint32_t *maxLensTables) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETMAXLENSTABLES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETMAXLENSTABLES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3126,7 +3126,7 @@ FLR_RESULT CLIENT_pkgBosonGetFfcWaitCloseFrames(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCWAITCLOSEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCWAITCLOSEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3169,7 +3169,7 @@ FLR_RESULT CLIENT_pkgBosonSetFfcWaitCloseFrames(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCWAITCLOSEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCWAITCLOSEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3191,7 +3191,7 @@ FLR_RESULT CLIENT_pkgBosonCheckForTableSwitch() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_CHECKFORTABLESWITCH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_CHECKFORTABLESWITCH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3213,7 +3213,7 @@ FLR_RESULT CLIENT_pkgBosonGetDesiredTableNumber(uint32_t *desiredTableNumber) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETDESIREDTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETDESIREDTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3246,7 +3246,7 @@ FLR_RESULT CLIENT_pkgBosonGetFfcStatus(FLR_BOSON_FFCSTATUS_E *ffcStatus) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCSTATUS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCSTATUS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3279,7 +3279,7 @@ FLR_RESULT CLIENT_pkgBosonGetFfcDesired(uint32_t *ffcDesired) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3312,7 +3312,7 @@ FLR_RESULT CLIENT_pkgBosonGetSwRevInHeader(uint32_t *major, uint32_t *minor, uin
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSWREVINHEADER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSWREVINHEADER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3367,7 +3367,7 @@ FLR_RESULT CLIENT_pkgBosonGetLastFFCFrameCount(uint32_t *frameCount) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETLASTFFCFRAMECOUNT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETLASTFFCFRAMECOUNT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3400,7 +3400,7 @@ FLR_RESULT CLIENT_pkgBosonGetLastFFCTempDegKx10(uint16_t *temp) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETLASTFFCTEMPDEGKX10, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETLASTFFCTEMPDEGKX10, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3433,7 +3433,7 @@ FLR_RESULT CLIENT_pkgBosonGetTableSwitchDesired(uint16_t *tableSwitchDesired) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETTABLESWITCHDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETTABLESWITCHDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3466,7 +3466,7 @@ FLR_RESULT CLIENT_pkgBosonGetOverTempThreshold(float *temperatureInC) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETOVERTEMPTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETOVERTEMPTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3499,7 +3499,7 @@ FLR_RESULT CLIENT_pkgBosonGetLowPowerMode(uint16_t *lowPowerMode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETLOWPOWERMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETLOWPOWERMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3532,7 +3532,7 @@ FLR_RESULT CLIENT_pkgBosonGetOverTempEventOccurred(uint16_t *overTempEventOccurr
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETOVERTEMPEVENTOCCURRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETOVERTEMPEVENTOCCURRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3575,7 +3575,7 @@ FLR_RESULT CLIENT_pkgBosonSetPermitThermalShutdownOverride(const FLR_ENABLE_E pe
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETPERMITTHERMALSHUTDOWNOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETPERMITTHERMALSHUTDOWNOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3597,7 +3597,7 @@ FLR_RESULT CLIENT_pkgBosonGetPermitThermalShutdownOverride(FLR_ENABLE_E *permitT
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETPERMITTHERMALSHUTDOWNOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETPERMITTHERMALSHUTDOWNOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3630,7 +3630,7 @@ FLR_RESULT CLIENT_pkgBosonGetMyriadTemp(float *myriadTemp) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETMYRIADTEMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETMYRIADTEMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3663,7 +3663,7 @@ FLR_RESULT CLIENT_pkgBosonGetNvFFCNucTableNumberLens0(int32_t *nvFFCNucTableNumb
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETNVFFCNUCTABLENUMBERLENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETNVFFCNUCTABLENUMBERLENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3696,7 +3696,7 @@ FLR_RESULT CLIENT_pkgBosonGetNvFFCNucTableNumberLens1(int32_t *nvFFCNucTableNumb
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETNVFFCNUCTABLENUMBERLENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETNVFFCNUCTABLENUMBERLENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3729,7 +3729,7 @@ FLR_RESULT CLIENT_pkgBosonGetNvFFCFPATempDegKx10Lens0(uint16_t *nvFFCFPATempDegK
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETNVFFCFPATEMPDEGKX10LENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETNVFFCFPATEMPDEGKX10LENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3762,7 +3762,7 @@ FLR_RESULT CLIENT_pkgBosonGetNvFFCFPATempDegKx10Lens1(uint16_t *nvFFCFPATempDegK
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETNVFFCFPATEMPDEGKX10LENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETNVFFCFPATEMPDEGKX10LENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3805,7 +3805,7 @@ FLR_RESULT CLIENT_pkgBosonSetFFCWarnTimeInSecx10(const uint16_t ffcWarnTime) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCWARNTIMEINSECX10, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCWARNTIMEINSECX10, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3827,7 +3827,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCWarnTimeInSecx10(uint16_t *ffcWarnTime) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCWARNTIMEINSECX10, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCWARNTIMEINSECX10, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3860,7 +3860,7 @@ FLR_RESULT CLIENT_pkgBosonGetOverTempEventCounter(uint32_t *overTempEventCounter
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETOVERTEMPEVENTCOUNTER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETOVERTEMPEVENTCOUNTER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3903,7 +3903,7 @@ FLR_RESULT CLIENT_pkgBosonSetOverTempTimerInSec(const uint16_t overTempTimerInSe
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETOVERTEMPTIMERINSEC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETOVERTEMPTIMERINSEC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3925,7 +3925,7 @@ FLR_RESULT CLIENT_pkgBosonGetOverTempTimerInSec(uint16_t *overTempTimerInSec) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETOVERTEMPTIMERINSEC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETOVERTEMPTIMERINSEC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3958,7 +3958,7 @@ FLR_RESULT CLIENT_pkgBosonUnloadCurrentLensCorrections() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_UNLOADCURRENTLENSCORRECTIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_UNLOADCURRENTLENSCORRECTIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -3990,7 +3990,7 @@ FLR_RESULT CLIENT_pkgBosonSetTimeForQuickFFCsInSecs(const uint32_t timeForQuickF
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETTIMEFORQUICKFFCSINSECS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETTIMEFORQUICKFFCSINSECS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4012,7 +4012,7 @@ FLR_RESULT CLIENT_pkgBosonGetTimeForQuickFFCsInSecs(uint32_t *timeForQuickFFCsIn
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETTIMEFORQUICKFFCSINSECS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETTIMEFORQUICKFFCSINSECS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4045,7 +4045,7 @@ FLR_RESULT CLIENT_pkgBosonReloadCurrentLensCorrections() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_RELOADCURRENTLENSCORRECTIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_RELOADCURRENTLENSCORRECTIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4067,7 +4067,7 @@ FLR_RESULT CLIENT_pkgBosonGetBootTimestamps(float *FirstLight, float *StartInit,
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETBOOTTIMESTAMPS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETBOOTTIMESTAMPS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4143,7 +4143,7 @@ FLR_RESULT CLIENT_pkgBosonSetExtSyncMode(const FLR_BOSON_EXT_SYNC_MODE_E mode) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETEXTSYNCMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETEXTSYNCMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4165,7 +4165,7 @@ FLR_RESULT CLIENT_pkgBosonGetExtSyncMode(FLR_BOSON_EXT_SYNC_MODE_E *mode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETEXTSYNCMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETEXTSYNCMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4198,7 +4198,7 @@ FLR_RESULT CLIENT_pkgBosonGetLastCommand(uint32_t *sequenceNum, uint32_t *cmdID)
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETLASTCOMMAND, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETLASTCOMMAND, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4242,7 +4242,7 @@ FLR_RESULT CLIENT_pkgBosonGetSensorHostCalVersion(uint32_t *version) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSENSORHOSTCALVERSION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSENSORHOSTCALVERSION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4285,7 +4285,7 @@ FLR_RESULT CLIENT_pkgBosonSetDesiredStartupTableNumber(const int32_t table) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETDESIREDSTARTUPTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETDESIREDSTARTUPTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4307,7 +4307,7 @@ FLR_RESULT CLIENT_pkgBosonGetDesiredStartupTableNumber(int32_t *table) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETDESIREDSTARTUPTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETDESIREDSTARTUPTABLENUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4350,7 +4350,7 @@ FLR_RESULT CLIENT_pkgBosonSetNvFFCMeanValueLens0(const float meanValue) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETNVFFCMEANVALUELENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETNVFFCMEANVALUELENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4372,7 +4372,7 @@ FLR_RESULT CLIENT_pkgBosonGetNvFFCMeanValueLens0(float *meanValue) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETNVFFCMEANVALUELENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETNVFFCMEANVALUELENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4415,7 +4415,7 @@ FLR_RESULT CLIENT_pkgBosonSetNvFFCMeanValueLens1(const float meanValue) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETNVFFCMEANVALUELENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETNVFFCMEANVALUELENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4437,7 +4437,7 @@ FLR_RESULT CLIENT_pkgBosonGetNvFFCMeanValueLens1(float *meanValue) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETNVFFCMEANVALUELENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETNVFFCMEANVALUELENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4480,7 +4480,7 @@ FLR_RESULT CLIENT_pkgBosonSetInvertImage(const FLR_ENABLE_E invertImage) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETINVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETINVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4502,7 +4502,7 @@ FLR_RESULT CLIENT_pkgBosonGetInvertImage(FLR_ENABLE_E *invertImage) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETINVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETINVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4545,7 +4545,7 @@ FLR_RESULT CLIENT_pkgBosonSetRevertImage(const FLR_ENABLE_E revertImage) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETREVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETREVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4567,7 +4567,7 @@ FLR_RESULT CLIENT_pkgBosonGetRevertImage(FLR_ENABLE_E *revertImage) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETREVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETREVERTIMAGE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4610,7 +4610,7 @@ FLR_RESULT CLIENT_pkgBosonGetTimeStamp(const FLR_BOSON_TIMESTAMPTYPE_E timeStamp
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETTIMESTAMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETTIMESTAMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4643,7 +4643,7 @@ FLR_RESULT CLIENT_pkgBosonGetISPFrameCount(uint32_t *ispFrameCount) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETISPFRAMECOUNT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETISPFRAMECOUNT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4676,7 +4676,7 @@ FLR_RESULT CLIENT_pkgBosonWriteUserBadPixelsToAllTables() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_WRITEUSERBADPIXELSTOALLTABLES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_WRITEUSERBADPIXELSTOALLTABLES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4698,7 +4698,7 @@ FLR_RESULT CLIENT_pkgBosonWriteFactoryBadPixelsToAllTables() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_WRITEFACTORYBADPIXELSTOALLTABLES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_WRITEFACTORYBADPIXELSTOALLTABLES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4720,7 +4720,7 @@ FLR_RESULT CLIENT_pkgBosonGetTempDiodeStatus(FLR_BOSON_TEMP_DIODE_STATUS_E *stat
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETTEMPDIODESTATUS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETTEMPDIODESTATUS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4753,7 +4753,7 @@ FLR_RESULT CLIENT_pkgBosonClearFactoryBadPixelsInDDR() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_CLEARFACTORYBADPIXELSINDDR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_CLEARFACTORYBADPIXELSINDDR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4775,7 +4775,7 @@ FLR_RESULT CLIENT_pkgBosonGetFfcWaitOpenFrames(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCWAITOPENFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCWAITOPENFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4818,7 +4818,7 @@ FLR_RESULT CLIENT_pkgBosonSetFfcWaitOpenFrames(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCWAITOPENFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCWAITOPENFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4840,7 +4840,7 @@ FLR_RESULT CLIENT_pkgBosonGetFfcWaitOpenFlagSettleFrames(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCWAITOPENFLAGSETTLEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCWAITOPENFLAGSETTLEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4883,7 +4883,7 @@ FLR_RESULT CLIENT_pkgBosonSetFfcWaitOpenFlagSettleFrames(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCWAITOPENFLAGSETTLEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCWAITOPENFLAGSETTLEFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4905,7 +4905,7 @@ FLR_RESULT CLIENT_pkgBosonGetTauExtFfcCompatibilityMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETTAUEXTFFCCOMPATIBILITYMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETTAUEXTFFCCOMPATIBILITYMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4948,7 +4948,7 @@ FLR_RESULT CLIENT_pkgBosonSetTauExtFfcCompatibilityMode(const FLR_ENABLE_E data)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETTAUEXTFFCCOMPATIBILITYMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETTAUEXTFFCCOMPATIBILITYMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -4970,7 +4970,7 @@ FLR_RESULT CLIENT_pkgBosonGetInitialTableSelectionTempOffset(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETINITIALTABLESELECTIONTEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETINITIALTABLESELECTIONTEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5013,7 +5013,7 @@ FLR_RESULT CLIENT_pkgBosonSetInitialTableSelectionTempOffset(const int16_t data)
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETINITIALTABLESELECTIONTEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETINITIALTABLESELECTIONTEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5035,7 +5035,7 @@ FLR_RESULT CLIENT_pkgBosonGetImageValid(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETIMAGEVALID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETIMAGEVALID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5068,7 +5068,7 @@ FLR_RESULT CLIENT_pkgBosonGetCurrentTableType(FLR_BOSON_TABLETYPE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETCURRENTTABLETYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETCURRENTTABLETYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5101,7 +5101,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchFrameThreshold(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5144,7 +5144,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainSwitchFrameThreshold(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINSWITCHFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINSWITCHFRAMETHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5166,7 +5166,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchHysteresisTime(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHHYSTERESISTIME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHHYSTERESISTIME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5209,7 +5209,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainSwitchHysteresisTime(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINSWITCHHYSTERESISTIME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINSWITCHHYSTERESISTIME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5231,7 +5231,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchDesired(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5264,7 +5264,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchRadiometricParams(FLR_BOSON_GAIN_SWITCH_R
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHRADIOMETRICPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHRADIOMETRICPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5307,7 +5307,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainSwitchRadiometricParams(const FLR_BOSON_GAIN_SW
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINSWITCHRADIOMETRICPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINSWITCHRADIOMETRICPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5339,7 +5339,7 @@ FLR_RESULT CLIENT_pkgBosonSetSaturationOverrideMode(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETSATURATIONOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETSATURATIONOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5361,7 +5361,7 @@ FLR_RESULT CLIENT_pkgBosonGetSaturationOverrideMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSATURATIONOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSATURATIONOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5404,7 +5404,7 @@ FLR_RESULT CLIENT_pkgBosonSetSaturationOverrideValue(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETSATURATIONOVERRIDEVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETSATURATIONOVERRIDEVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5426,7 +5426,7 @@ FLR_RESULT CLIENT_pkgBosonGetSaturationOverrideValue(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETSATURATIONOVERRIDEVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETSATURATIONOVERRIDEVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5469,7 +5469,7 @@ FLR_RESULT CLIENT_pkgBosonSetffcHighLowGainThresholdMode(const FLR_ENABLE_E data
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCHIGHLOWGAINTHRESHOLDMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCHIGHLOWGAINTHRESHOLDMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5491,7 +5491,7 @@ FLR_RESULT CLIENT_pkgBosonGetffcHighLowGainThresholdMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCHIGHLOWGAINTHRESHOLDMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCHIGHLOWGAINTHRESHOLDMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5534,7 +5534,7 @@ FLR_RESULT CLIENT_pkgBosonSetFFCTempThresholdLowGain(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCTEMPTHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCTEMPTHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5556,7 +5556,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCTempThresholdLowGain(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCTEMPTHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCTEMPTHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5599,7 +5599,7 @@ FLR_RESULT CLIENT_pkgBosonSetFFCFrameThresholdLowGain(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETFFCFRAMETHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETFFCFRAMETHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5621,7 +5621,7 @@ FLR_RESULT CLIENT_pkgBosonGetFFCFrameThresholdLowGain(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETFFCFRAMETHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETFFCFRAMETHRESHOLDLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5654,7 +5654,7 @@ FLR_RESULT CLIENT_pkgBosonGetBoardID(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETBOARDID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETBOARDID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5697,7 +5697,7 @@ FLR_RESULT CLIENT_pkgBosonSetAutoGainSwitchConditions(const FLR_BOSON_AUTOGAIN_S
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETAUTOGAINSWITCHCONDITIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETAUTOGAINSWITCHCONDITIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5719,7 +5719,7 @@ FLR_RESULT CLIENT_pkgBosonGetAutoGainSwitchConditions(FLR_BOSON_AUTOGAIN_SWITCH_
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETAUTOGAINSWITCHCONDITIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETAUTOGAINSWITCHCONDITIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5762,7 +5762,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainSwitchParamsCATS(const FLR_BOSON_GAIN_SWITCH_PA
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINSWITCHPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINSWITCHPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5784,7 +5784,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchParamsCATS(FLR_BOSON_GAIN_SWITCH_PARAMS_T
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5817,7 +5817,7 @@ FLR_RESULT CLIENT_pkgBosonGetGainSwitchRadiometricParamsCATS(FLR_BOSON_GAIN_SWIT
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETGAINSWITCHRADIOMETRICPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETGAINSWITCHRADIOMETRICPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5860,7 +5860,7 @@ FLR_RESULT CLIENT_pkgBosonSetGainSwitchRadiometricParamsCATS(const FLR_BOSON_GAI
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_SETGAINSWITCHRADIOMETRICPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_SETGAINSWITCHRADIOMETRICPARAMSCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5882,7 +5882,7 @@ FLR_RESULT CLIENT_pkgBosonGetCLowToHighPercentCATS(uint32_t *cLowToHighPercent)
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BOSON_GETCLOWTOHIGHPERCENTCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BOSON_GETCLOWTOHIGHPERCENTCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5917,7 +5917,7 @@ FLR_RESULT CLIENT_pkgBprGetState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5960,7 +5960,7 @@ FLR_RESULT CLIENT_pkgBprSetState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_SETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_SETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -5982,7 +5982,7 @@ FLR_RESULT CLIENT_pkgBprGetStats(uint32_t *threeby, uint32_t *fiveby, uint32_t *
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETSTATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETSTATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6059,7 +6059,7 @@ FLR_RESULT CLIENT_pkgBprGetDisplayMode(FLR_BPR_DISPLAY_MODE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6102,7 +6102,7 @@ FLR_RESULT CLIENT_pkgBprSetDisplayMode(const FLR_BPR_DISPLAY_MODE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_SETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_SETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6124,7 +6124,7 @@ FLR_RESULT CLIENT_pkgBprGetDisplayModeMinValue(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETDISPLAYMODEMINVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETDISPLAYMODEMINVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6167,7 +6167,7 @@ FLR_RESULT CLIENT_pkgBprSetDisplayModeMinValue(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_SETDISPLAYMODEMINVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_SETDISPLAYMODEMINVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6189,7 +6189,7 @@ FLR_RESULT CLIENT_pkgBprGetDisplayModeMaxValue(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETDISPLAYMODEMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETDISPLAYMODEMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6232,7 +6232,7 @@ FLR_RESULT CLIENT_pkgBprSetDisplayModeMaxValue(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_SETDISPLAYMODEMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_SETDISPLAYMODEMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6254,7 +6254,7 @@ FLR_RESULT CLIENT_pkgBprGetWorkBufIndex(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETWORKBUFINDEX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETWORKBUFINDEX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6297,7 +6297,7 @@ FLR_RESULT CLIENT_pkgBprSetWorkBufIndex(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_SETWORKBUFINDEX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_SETWORKBUFINDEX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6319,7 +6319,7 @@ FLR_RESULT CLIENT_pkgBprGetWorkBufStats(uint32_t *threeby, uint32_t *fiveby, uin
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, BPR_GETWORKBUFSTATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, BPR_GETWORKBUFSTATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6398,7 +6398,7 @@ FLR_RESULT CLIENT_pkgCaptureSingleFrame() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, CAPTURE_SINGLEFRAME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, CAPTURE_SINGLEFRAME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6430,7 +6430,7 @@ FLR_RESULT CLIENT_pkgCaptureFrames(const FLR_CAPTURE_SETTINGS_T data) {
         outPtr += 10;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, CAPTURE_FRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, CAPTURE_FRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6462,7 +6462,7 @@ FLR_RESULT CLIENT_pkgCaptureSingleFrameWithSrc(const FLR_CAPTURE_SRC_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, CAPTURE_SINGLEFRAMEWITHSRC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, CAPTURE_SINGLEFRAMEWITHSRC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6484,7 +6484,7 @@ FLR_RESULT CLIENT_pkgCaptureSingleFrameToFile() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, CAPTURE_SINGLEFRAMETOFILE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, CAPTURE_SINGLEFRAMETOFILE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6506,7 +6506,7 @@ FLR_RESULT CLIENT_pkgCaptureGetStatus(FLR_CAPTURE_STATUS_T *status) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, CAPTURE_GETSTATUS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, CAPTURE_GETSTATUS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6551,7 +6551,7 @@ FLR_RESULT CLIENT_pkgColorlutSetControl(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, COLORLUT_SETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, COLORLUT_SETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6573,7 +6573,7 @@ FLR_RESULT CLIENT_pkgColorlutGetControl(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, COLORLUT_GETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, COLORLUT_GETCONTROL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6616,7 +6616,7 @@ FLR_RESULT CLIENT_pkgColorlutSetId(const FLR_COLORLUT_ID_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, COLORLUT_SETID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, COLORLUT_SETID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6638,7 +6638,7 @@ FLR_RESULT CLIENT_pkgColorlutGetId(FLR_COLORLUT_ID_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, COLORLUT_GETID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, COLORLUT_GETID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6701,7 +6701,7 @@ FLR_RESULT CLIENT_pkgColorlutSetOutlineColor(const uint8_t red, const uint8_t gr
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, COLORLUT_SETOUTLINECOLOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, COLORLUT_SETOUTLINECOLOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6723,7 +6723,7 @@ FLR_RESULT CLIENT_pkgColorlutGetOutlineColor(uint8_t *red, uint8_t *green, uint8
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, COLORLUT_GETOUTLINECOLOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, COLORLUT_GETOUTLINECOLOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6780,7 +6780,7 @@ FLR_RESULT CLIENT_pkgDummyBadCommand() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DUMMY_BADCOMMAND, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DUMMY_BADCOMMAND, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6814,7 +6814,7 @@ FLR_RESULT CLIENT_pkgDvoSetAnalogVideoState(const FLR_ENABLE_E analogVideoState)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETANALOGVIDEOSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETANALOGVIDEOSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6836,7 +6836,7 @@ FLR_RESULT CLIENT_pkgDvoGetAnalogVideoState(FLR_ENABLE_E *analogVideoState) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETANALOGVIDEOSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETANALOGVIDEOSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6879,7 +6879,7 @@ FLR_RESULT CLIENT_pkgDvoSetOutputFormat(const FLR_DVO_OUTPUT_FORMAT_E format) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETOUTPUTFORMAT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETOUTPUTFORMAT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6901,7 +6901,7 @@ FLR_RESULT CLIENT_pkgDvoGetOutputFormat(FLR_DVO_OUTPUT_FORMAT_E *format) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETOUTPUTFORMAT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETOUTPUTFORMAT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6944,7 +6944,7 @@ FLR_RESULT CLIENT_pkgDvoSetOutputYCbCrSettings(const FLR_DVO_YCBCR_SETTINGS_T se
         outPtr += 12;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETOUTPUTYCBCRSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETOUTPUTYCBCRSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -6966,7 +6966,7 @@ FLR_RESULT CLIENT_pkgDvoGetOutputYCbCrSettings(FLR_DVO_YCBCR_SETTINGS_T *setting
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETOUTPUTYCBCRSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETOUTPUTYCBCRSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7009,7 +7009,7 @@ FLR_RESULT CLIENT_pkgDvoSetOutputRGBSettings(const FLR_DVO_RGB_SETTINGS_T settin
         outPtr += 8;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETOUTPUTRGBSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETOUTPUTRGBSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7031,7 +7031,7 @@ FLR_RESULT CLIENT_pkgDvoGetOutputRGBSettings(FLR_DVO_RGB_SETTINGS_T *settings) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETOUTPUTRGBSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETOUTPUTRGBSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7064,7 +7064,7 @@ FLR_RESULT CLIENT_pkgDvoApplyCustomSettings() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_APPLYCUSTOMSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_APPLYCUSTOMSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7096,7 +7096,7 @@ FLR_RESULT CLIENT_pkgDvoSetDisplayMode(const FLR_DVO_DISPLAY_MODE_E displayMode)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7118,7 +7118,7 @@ FLR_RESULT CLIENT_pkgDvoGetDisplayMode(FLR_DVO_DISPLAY_MODE_E *displayMode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETDISPLAYMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7161,7 +7161,7 @@ FLR_RESULT CLIENT_pkgDvoSetType(const FLR_DVO_TYPE_E tap) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7183,7 +7183,7 @@ FLR_RESULT CLIENT_pkgDvoGetType(FLR_DVO_TYPE_E *tap) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7226,7 +7226,7 @@ FLR_RESULT CLIENT_pkgDvoSetVideoStandard(const FLR_DVO_VIDEO_STANDARD_E videoSta
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETVIDEOSTANDARD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETVIDEOSTANDARD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7248,7 +7248,7 @@ FLR_RESULT CLIENT_pkgDvoGetVideoStandard(FLR_DVO_VIDEO_STANDARD_E *videoStandard
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETVIDEOSTANDARD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETVIDEOSTANDARD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7291,7 +7291,7 @@ FLR_RESULT CLIENT_pkgDvoSetCheckVideoDacPresent(const FLR_ENABLE_E checkVideoDac
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETCHECKVIDEODACPRESENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETCHECKVIDEODACPRESENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7313,7 +7313,7 @@ FLR_RESULT CLIENT_pkgDvoGetCheckVideoDacPresent(FLR_ENABLE_E *checkVideoDacPrese
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETCHECKVIDEODACPRESENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETCHECKVIDEODACPRESENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7366,7 +7366,7 @@ FLR_RESULT CLIENT_pkgDvoSetCustomLcdConfig(const FLR_DVO_LCD_CONFIG_ID_E id, con
         outPtr += 48;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETCUSTOMLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETCUSTOMLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7398,7 +7398,7 @@ FLR_RESULT CLIENT_pkgDvoGetCustomLcdConfig(const FLR_DVO_LCD_CONFIG_ID_E id, FLR
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETCUSTOMLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETCUSTOMLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7441,7 +7441,7 @@ FLR_RESULT CLIENT_pkgDvoSetLCDConfig(const FLR_DVO_LCD_CONFIG_ID_E id) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7463,7 +7463,7 @@ FLR_RESULT CLIENT_pkgDvoGetLCDConfig(FLR_DVO_LCD_CONFIG_ID_E *id) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETLCDCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7496,7 +7496,7 @@ FLR_RESULT CLIENT_pkgDvoGetClockInfo(uint32_t *horizontalSyncWidth, uint32_t *ve
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETCLOCKINFO, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETCLOCKINFO, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7758,7 +7758,7 @@ FLR_RESULT CLIENT_pkgDvoSetAllCustomLcdConfigs(const FLR_DVO_LCD_CONFIG_T config
         outPtr += 48;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETALLCUSTOMLCDCONFIGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETALLCUSTOMLCDCONFIGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7780,7 +7780,7 @@ FLR_RESULT CLIENT_pkgDvoGetAllCustomLcdConfigs(FLR_DVO_LCD_CONFIG_T *config0, FL
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETALLCUSTOMLCDCONFIGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETALLCUSTOMLCDCONFIGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7834,7 +7834,7 @@ FLR_RESULT CLIENT_pkgDvoSetOutputIr16Format(const FLR_DVO_OUTPUT_IR16_FORMAT_E f
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETOUTPUTIR16FORMAT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETOUTPUTIR16FORMAT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7856,7 +7856,7 @@ FLR_RESULT CLIENT_pkgDvoGetOutputIr16Format(FLR_DVO_OUTPUT_IR16_FORMAT_E *format
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETOUTPUTIR16FORMAT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETOUTPUTIR16FORMAT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7899,7 +7899,7 @@ FLR_RESULT CLIENT_pkgDvoSetLcdClockRate(const FLR_DVO_LCD_CLOCK_RATE_E clockRate
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETLCDCLOCKRATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETLCDCLOCKRATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7921,7 +7921,7 @@ FLR_RESULT CLIENT_pkgDvoGetLcdClockRate(FLR_DVO_LCD_CLOCK_RATE_E *clockRate) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETLCDCLOCKRATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETLCDCLOCKRATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7964,7 +7964,7 @@ FLR_RESULT CLIENT_pkgDvoSetLcdVideoFrameRate(const uint32_t framerate) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETLCDVIDEOFRAMERATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETLCDVIDEOFRAMERATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -7986,7 +7986,7 @@ FLR_RESULT CLIENT_pkgDvoGetLcdVideoFrameRate(uint32_t *framerate) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETLCDVIDEOFRAMERATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETLCDVIDEOFRAMERATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8029,7 +8029,7 @@ FLR_RESULT CLIENT_pkgDvoSetMipiStartState(const FLR_DVO_MIPI_STATE_E state) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETMIPISTARTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETMIPISTARTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8051,7 +8051,7 @@ FLR_RESULT CLIENT_pkgDvoGetMipiStartState(FLR_DVO_MIPI_STATE_E *state) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETMIPISTARTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETMIPISTARTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8094,7 +8094,7 @@ FLR_RESULT CLIENT_pkgDvoSetMipiState(const FLR_DVO_MIPI_STATE_E state) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETMIPISTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETMIPISTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8116,7 +8116,7 @@ FLR_RESULT CLIENT_pkgDvoGetMipiState(FLR_DVO_MIPI_STATE_E *state) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETMIPISTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETMIPISTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8159,7 +8159,7 @@ FLR_RESULT CLIENT_pkgDvoSetMipiClockLaneMode(const FLR_DVO_MIPI_CLOCK_LANE_MODE_
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETMIPICLOCKLANEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETMIPICLOCKLANEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8181,7 +8181,7 @@ FLR_RESULT CLIENT_pkgDvoGetMipiClockLaneMode(FLR_DVO_MIPI_CLOCK_LANE_MODE_E *mod
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETMIPICLOCKLANEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETMIPICLOCKLANEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8224,7 +8224,7 @@ FLR_RESULT CLIENT_pkgDvoSetOutputInterface(const FLR_DVO_OUTPUT_INTERFACE_E form
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETOUTPUTINTERFACE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETOUTPUTINTERFACE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8246,7 +8246,7 @@ FLR_RESULT CLIENT_pkgDvoGetOutputInterface(FLR_DVO_OUTPUT_INTERFACE_E *format) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETOUTPUTINTERFACE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETOUTPUTINTERFACE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8289,7 +8289,7 @@ FLR_RESULT CLIENT_pkgDvoSetOutputFormatVC1(const FLR_DVO_OUTPUT_FORMAT_E format)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_SETOUTPUTFORMATVC1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_SETOUTPUTFORMATVC1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8311,7 +8311,7 @@ FLR_RESULT CLIENT_pkgDvoGetOutputFormatVC1(FLR_DVO_OUTPUT_FORMAT_E *format) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVO_GETOUTPUTFORMATVC1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVO_GETOUTPUTFORMATVC1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8376,7 +8376,7 @@ FLR_RESULT CLIENT_pkgDvomuxSetType(const FLR_DVOMUX_OUTPUT_IF_E output, const FL
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVOMUX_SETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVOMUX_SETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8408,7 +8408,7 @@ FLR_RESULT CLIENT_pkgDvomuxGetType(const FLR_DVOMUX_OUTPUT_IF_E output, FLR_DVOM
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, DVOMUX_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, DVOMUX_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8454,7 +8454,7 @@ FLR_RESULT CLIENT_pkgFileopsDir(uint8_t *dirent) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_DIR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_DIR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8624,7 +8624,7 @@ FLR_RESULT CLIENT_pkgFileopsCd(const uint8_t path[], uint8_t *pwd) {
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_CD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_CD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8794,7 +8794,7 @@ FLR_RESULT CLIENT_pkgFileopsMd(const uint8_t path[]) {
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_MD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_MD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8836,7 +8836,7 @@ FLR_RESULT CLIENT_pkgFileopsFopen(const uint8_t path[], const uint8_t mode[], ui
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FOPEN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FOPEN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8879,7 +8879,7 @@ FLR_RESULT CLIENT_pkgFileopsFclose(const uint32_t id) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FCLOSE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FCLOSE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -8921,7 +8921,7 @@ FLR_RESULT CLIENT_pkgFileopsFread(const uint32_t id, const uint32_t length, uint
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FREAD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FREAD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9122,7 +9122,7 @@ FLR_RESULT CLIENT_pkgFileopsFwrite(const uint32_t id, const uint32_t length, con
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FWRITE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FWRITE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9165,7 +9165,7 @@ FLR_RESULT CLIENT_pkgFileopsFtell(const uint32_t id, uint32_t *offset) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FTELL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FTELL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9228,7 +9228,7 @@ FLR_RESULT CLIENT_pkgFileopsFseek(const uint32_t id, const uint32_t offset, cons
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FSEEK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FSEEK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9270,7 +9270,7 @@ FLR_RESULT CLIENT_pkgFileopsFtruncate(const uint32_t id, const uint32_t length)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_FTRUNCATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_FTRUNCATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9302,7 +9302,7 @@ FLR_RESULT CLIENT_pkgFileopsRmdir(const uint8_t path[]) {
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_RMDIR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_RMDIR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9334,7 +9334,7 @@ FLR_RESULT CLIENT_pkgFileopsRm(const uint8_t path[]) {
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_RM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_RM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9376,7 +9376,7 @@ FLR_RESULT CLIENT_pkgFileopsRename(const uint8_t oldpath[], const uint8_t newpat
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_RENAME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_RENAME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9408,7 +9408,7 @@ FLR_RESULT CLIENT_pkgFileopsGetFileSize(const uint8_t path[], uint32_t *fileLeng
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FILEOPS_GETFILESIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FILEOPS_GETFILESIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9453,7 +9453,7 @@ FLR_RESULT CLIENT_pkgFlashioSetProtectionState(const FLR_ENABLE_E protectionStat
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FLASHIO_SETPROTECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FLASHIO_SETPROTECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9475,7 +9475,7 @@ FLR_RESULT CLIENT_pkgFlashioGetProtectionState(FLR_ENABLE_E *protectionState) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FLASHIO_GETPROTECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FLASHIO_GETPROTECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9510,7 +9510,7 @@ FLR_RESULT CLIENT_pkgFlashmapfsGetHeaderVersion(uint32_t *major, uint32_t *minor
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, FLASHMAPFS_GETHEADERVERSION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, FLASHMAPFS_GETHEADERVERSION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9577,7 +9577,7 @@ FLR_RESULT CLIENT_pkgGaoSetGainState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETGAINSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETGAINSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9599,7 +9599,7 @@ FLR_RESULT CLIENT_pkgGaoGetGainState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETGAINSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETGAINSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9642,7 +9642,7 @@ FLR_RESULT CLIENT_pkgGaoSetFfcState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9664,7 +9664,7 @@ FLR_RESULT CLIENT_pkgGaoGetFfcState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9707,7 +9707,7 @@ FLR_RESULT CLIENT_pkgGaoSetTempCorrectionState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETTEMPCORRECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETTEMPCORRECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9729,7 +9729,7 @@ FLR_RESULT CLIENT_pkgGaoGetTempCorrectionState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETTEMPCORRECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETTEMPCORRECTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9772,7 +9772,7 @@ FLR_RESULT CLIENT_pkgGaoSetIConstL(const int16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETICONSTL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETICONSTL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9794,7 +9794,7 @@ FLR_RESULT CLIENT_pkgGaoGetIConstL(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETICONSTL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETICONSTL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9837,7 +9837,7 @@ FLR_RESULT CLIENT_pkgGaoSetIConstM(const int16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETICONSTM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETICONSTM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9859,7 +9859,7 @@ FLR_RESULT CLIENT_pkgGaoGetIConstM(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETICONSTM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETICONSTM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9902,7 +9902,7 @@ FLR_RESULT CLIENT_pkgGaoSetAveragerState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETAVERAGERSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETAVERAGERSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9924,7 +9924,7 @@ FLR_RESULT CLIENT_pkgGaoGetAveragerState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETAVERAGERSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETAVERAGERSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9967,7 +9967,7 @@ FLR_RESULT CLIENT_pkgGaoSetNumFFCFrames(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETNUMFFCFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETNUMFFCFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -9989,7 +9989,7 @@ FLR_RESULT CLIENT_pkgGaoGetNumFFCFrames(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETNUMFFCFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETNUMFFCFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10022,7 +10022,7 @@ FLR_RESULT CLIENT_pkgGaoGetAveragerThreshold(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETAVERAGERTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETAVERAGERTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10065,7 +10065,7 @@ FLR_RESULT CLIENT_pkgGaoSetTestRampState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETTESTRAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETTESTRAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10087,7 +10087,7 @@ FLR_RESULT CLIENT_pkgGaoGetTestRampState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETTESTRAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETTESTRAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10130,7 +10130,7 @@ FLR_RESULT CLIENT_pkgGaoSetSffcState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETSFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETSFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10152,7 +10152,7 @@ FLR_RESULT CLIENT_pkgGaoGetSffcState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETSFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETSFFCSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10195,7 +10195,7 @@ FLR_RESULT CLIENT_pkgGaoSetNucType(const FLR_GAO_NUC_TYPE_E nucType) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETNUCTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETNUCTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10217,7 +10217,7 @@ FLR_RESULT CLIENT_pkgGaoGetNucType(FLR_GAO_NUC_TYPE_E *nucType) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETNUCTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETNUCTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10260,7 +10260,7 @@ FLR_RESULT CLIENT_pkgGaoSetFfcZeroMeanState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETFFCZEROMEANSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETFFCZEROMEANSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10282,7 +10282,7 @@ FLR_RESULT CLIENT_pkgGaoGetFfcZeroMeanState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETFFCZEROMEANSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETFFCZEROMEANSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10315,7 +10315,7 @@ FLR_RESULT CLIENT_pkgGaoGetAveragerDesiredState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETAVERAGERDESIREDSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETAVERAGERDESIREDSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10348,7 +10348,7 @@ FLR_RESULT CLIENT_pkgGaoGetAppliedClip(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETAPPLIEDCLIP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETAPPLIEDCLIP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10391,7 +10391,7 @@ FLR_RESULT CLIENT_pkgGaoSetAppliedClipEnable(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETAPPLIEDCLIPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETAPPLIEDCLIPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10413,7 +10413,7 @@ FLR_RESULT CLIENT_pkgGaoGetAppliedClipEnable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETAPPLIEDCLIPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETAPPLIEDCLIPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10456,7 +10456,7 @@ FLR_RESULT CLIENT_pkgGaoSetFfcShutterSimulationState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETFFCSHUTTERSIMULATIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETFFCSHUTTERSIMULATIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10478,7 +10478,7 @@ FLR_RESULT CLIENT_pkgGaoGetFfcShutterSimulationState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETFFCSHUTTERSIMULATIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETFFCSHUTTERSIMULATIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10521,7 +10521,7 @@ FLR_RESULT CLIENT_pkgGaoSetFfcShutterSimulatorValue(const uint16_t value) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETFFCSHUTTERSIMULATORVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETFFCSHUTTERSIMULATORVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10543,7 +10543,7 @@ FLR_RESULT CLIENT_pkgGaoGetFfcShutterSimulatorValue(uint16_t *value) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETFFCSHUTTERSIMULATORVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETFFCSHUTTERSIMULATORVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10586,7 +10586,7 @@ FLR_RESULT CLIENT_pkgGaoSetBcnrState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETBCNRSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETBCNRSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10608,7 +10608,7 @@ FLR_RESULT CLIENT_pkgGaoGetBcnrState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETBCNRSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETBCNRSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10641,7 +10641,7 @@ FLR_RESULT CLIENT_pkgGaoGetAppliedSffcScaleFactor(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETAPPLIEDSFFCSCALEFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETAPPLIEDSFFCSCALEFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10684,7 +10684,7 @@ FLR_RESULT CLIENT_pkgGaoSetSffcMode(const FLR_GAO_SFFC_MODE_E mode) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_SETSFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_SETSFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10706,7 +10706,7 @@ FLR_RESULT CLIENT_pkgGaoGetSffcMode(FLR_GAO_SFFC_MODE_E *mode) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, GAO_GETSFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, GAO_GETSFFCMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10741,7 +10741,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetTotalHistPixelsInROI(uint32_t *totalPixelsInRO
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETTOTALHISTPIXELSINROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETTOTALHISTPIXELSINROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10774,7 +10774,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetPopBelowLowToHighThresh(uint32_t *popBelowLowT
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETPOPBELOWLOWTOHIGHTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETPOPBELOWLOWTOHIGHTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10807,7 +10807,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetPopAboveHighToLowThresh(uint32_t *popAboveHigh
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETPOPABOVEHIGHTOLOWTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETPOPABOVEHIGHTOLOWTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10850,7 +10850,7 @@ FLR_RESULT CLIENT_pkgImagestatsSetROI(const FLR_ROI_T roi) {
         outPtr += 8;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_SETROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_SETROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10872,7 +10872,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetROI(FLR_ROI_T *roi) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10905,7 +10905,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetFirstBin(uint16_t *firstBin) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETFIRSTBIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETFIRSTBIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10938,7 +10938,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetLastBin(uint16_t *lastBin) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETLASTBIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETLASTBIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -10971,7 +10971,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetMean(uint16_t *mean) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETMEAN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETMEAN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11004,7 +11004,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetFirstBinInROI(uint16_t *firstBinInROI) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETFIRSTBININROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETFIRSTBININROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11037,7 +11037,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetLastBinInROI(uint16_t *lastBinInROI) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETLASTBININROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETLASTBININROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11070,7 +11070,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetMeanInROI(uint16_t *meanInROI) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETMEANINROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETMEANINROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11103,7 +11103,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetImageStats(uint16_t *meanIntensity, uint16_t *
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETIMAGESTATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETIMAGESTATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11158,7 +11158,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetPopAboveLowToHighThreshCATS(uint32_t *popAbove
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETPOPABOVELOWTOHIGHTHRESHCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETPOPABOVELOWTOHIGHTHRESHCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11191,7 +11191,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetPopBelowHighToLowThreshCATS(uint32_t *popBelow
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETPOPBELOWHIGHTOLOWTHRESHCATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETPOPBELOWHIGHTOLOWTHRESHCATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11224,7 +11224,7 @@ FLR_RESULT CLIENT_pkgImagestatsGetPopBetweenLthCATSAndLthSATS(uint32_t *popBetwe
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, IMAGESTATS_GETPOPBETWEENLTHCATSANDLTHSATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, IMAGESTATS_GETPOPBETWEENLTHCATSANDLTHSATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11259,7 +11259,7 @@ FLR_RESULT CLIENT_pkgIsothermGetEnable(FLR_ENABLE_E *isothermEnable) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11302,7 +11302,7 @@ FLR_RESULT CLIENT_pkgIsothermSetEnable(const FLR_ENABLE_E isothermEnable) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11384,7 +11384,7 @@ FLR_RESULT CLIENT_pkgIsothermSetTemps(const FLR_ISOTHERM_GAIN_E table, const int
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETTEMPS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETTEMPS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11416,7 +11416,7 @@ FLR_RESULT CLIENT_pkgIsothermGetTemps(const FLR_ISOTHERM_GAIN_E table, int32_t *
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETTEMPS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETTEMPS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11563,7 +11563,7 @@ FLR_RESULT CLIENT_pkgIsothermSetIsoColorValues(const FLR_ISOTHERM_GAIN_E table,
         outPtr += 20;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETISOCOLORVALUES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETISOCOLORVALUES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11595,7 +11595,7 @@ FLR_RESULT CLIENT_pkgIsothermGetIsoColorValues(const FLR_ISOTHERM_GAIN_E table,
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETISOCOLORVALUES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETISOCOLORVALUES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11753,7 +11753,7 @@ FLR_RESULT CLIENT_pkgIsothermSetRegionMode(const FLR_ISOTHERM_GAIN_E table, cons
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETREGIONMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETREGIONMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11785,7 +11785,7 @@ FLR_RESULT CLIENT_pkgIsothermGetRegionMode(const FLR_ISOTHERM_GAIN_E table, FLR_
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETREGIONMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETREGIONMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11873,7 +11873,7 @@ FLR_RESULT CLIENT_pkgIsothermGetUnit(FLR_ISOTHERM_UNIT_E *unit) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETUNIT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETUNIT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11916,7 +11916,7 @@ FLR_RESULT CLIENT_pkgIsothermSetUnit(const FLR_ISOTHERM_UNIT_E unit) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETUNIT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETUNIT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11938,7 +11938,7 @@ FLR_RESULT CLIENT_pkgIsothermGetSettingsLowGain(FLR_ISOTHERM_SETTINGS_T *setting
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETSETTINGSLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETSETTINGSLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -11981,7 +11981,7 @@ FLR_RESULT CLIENT_pkgIsothermSetSettingsLowGain(const FLR_ISOTHERM_SETTINGS_T se
         outPtr += 164;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETSETTINGSLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETSETTINGSLOWGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12003,7 +12003,7 @@ FLR_RESULT CLIENT_pkgIsothermGetSettingsHighGain(FLR_ISOTHERM_SETTINGS_T *settin
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETSETTINGSHIGHGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETSETTINGSHIGHGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12046,7 +12046,7 @@ FLR_RESULT CLIENT_pkgIsothermSetSettingsHighGain(const FLR_ISOTHERM_SETTINGS_T s
         outPtr += 164;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETSETTINGSHIGHGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETSETTINGSHIGHGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12088,7 +12088,7 @@ FLR_RESULT CLIENT_pkgIsothermSetColorLutId(const FLR_COLORLUT_ID_E colorLutIdLow
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_SETCOLORLUTID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_SETCOLORLUTID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12110,7 +12110,7 @@ FLR_RESULT CLIENT_pkgIsothermGetColorLutId(FLR_COLORLUT_ID_E *colorLutIdLowGain,
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ISOTHERM_GETCOLORLUTID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ISOTHERM_GETCOLORLUTID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12156,7 +12156,7 @@ FLR_RESULT CLIENT_pkgJffs2Mount() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, JFFS2_MOUNT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, JFFS2_MOUNT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12178,7 +12178,7 @@ FLR_RESULT CLIENT_pkgJffs2Unmount() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, JFFS2_UNMOUNT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, JFFS2_UNMOUNT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12200,7 +12200,7 @@ FLR_RESULT CLIENT_pkgJffs2GetState(FLR_JFFS2_STATE_E *state) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, JFFS2_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, JFFS2_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12247,7 +12247,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlSetLowLatencyState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_SETLOWLATENCYSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_SETLOWLATENCYSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12269,7 +12269,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlGetLowLatencyState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_GETLOWLATENCYSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_GETLOWLATENCYSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12322,7 +12322,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlSetJitterReduction(const FLR_ENABLE_E enable, co
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_SETJITTERREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_SETJITTERREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12344,7 +12344,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlGetJitterReduction(FLR_ENABLE_E *enable, int32_t
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_GETJITTERREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_GETJITTERREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12388,7 +12388,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlLatencyResetStats() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_LATENCYRESETSTATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_LATENCYRESETSTATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12410,7 +12410,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlGetJitter(float *jitterMin, float *jitterMax) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_GETJITTER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_GETJITTER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12454,7 +12454,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlGetLatency(float *latencyMin, float *latencyMax)
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_GETLATENCY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_GETLATENCY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12508,7 +12508,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlSetUsbVideoLatencyReduction(const int32_t line)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_SETUSBVIDEOLATENCYREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_SETUSBVIDEOLATENCYREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12530,7 +12530,7 @@ FLR_RESULT CLIENT_pkgLatencyctrlGetUsbVideoLatencyReduction(int32_t *line) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LATENCYCTRL_GETUSBVIDEOLATENCYREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LATENCYCTRL_GETUSBVIDEOLATENCYREDUCTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12575,7 +12575,7 @@ FLR_RESULT CLIENT_pkgLfsrSetApplyOffsetEnableState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETAPPLYOFFSETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETAPPLYOFFSETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12597,7 +12597,7 @@ FLR_RESULT CLIENT_pkgLfsrGetApplyOffsetEnableState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETAPPLYOFFSETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETAPPLYOFFSETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12640,7 +12640,7 @@ FLR_RESULT CLIENT_pkgLfsrSetMaxIterations(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETMAXITERATIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETMAXITERATIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12662,7 +12662,7 @@ FLR_RESULT CLIENT_pkgLfsrGetMaxIterations(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETMAXITERATIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETMAXITERATIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12705,7 +12705,7 @@ FLR_RESULT CLIENT_pkgLfsrSetDf(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETDF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETDF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12727,7 +12727,7 @@ FLR_RESULT CLIENT_pkgLfsrGetDf(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETDF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETDF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12770,7 +12770,7 @@ FLR_RESULT CLIENT_pkgLfsrSetLambda1(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETLAMBDA1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETLAMBDA1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12792,7 +12792,7 @@ FLR_RESULT CLIENT_pkgLfsrGetLambda1(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETLAMBDA1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETLAMBDA1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12835,7 +12835,7 @@ FLR_RESULT CLIENT_pkgLfsrSetLambda2(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETLAMBDA2, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETLAMBDA2, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12857,7 +12857,7 @@ FLR_RESULT CLIENT_pkgLfsrGetLambda2(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETLAMBDA2, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETLAMBDA2, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12900,7 +12900,7 @@ FLR_RESULT CLIENT_pkgLfsrSetHaltEnable(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETHALTENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETHALTENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12922,7 +12922,7 @@ FLR_RESULT CLIENT_pkgLfsrGetHaltEnable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETHALTENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETHALTENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12965,7 +12965,7 @@ FLR_RESULT CLIENT_pkgLfsrSetRandomMethod(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETRANDOMMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETRANDOMMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -12987,7 +12987,7 @@ FLR_RESULT CLIENT_pkgLfsrGetRandomMethod(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETRANDOMMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETRANDOMMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13030,7 +13030,7 @@ FLR_RESULT CLIENT_pkgLfsrSetSingleStepEnable(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETSINGLESTEPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETSINGLESTEPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13052,7 +13052,7 @@ FLR_RESULT CLIENT_pkgLfsrGetSingleStepEnable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETSINGLESTEPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETSINGLESTEPENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13095,7 +13095,7 @@ FLR_RESULT CLIENT_pkgLfsrSetR_LocalBump(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETR_LOCALBUMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETR_LOCALBUMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13117,7 +13117,7 @@ FLR_RESULT CLIENT_pkgLfsrGetR_LocalBump(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETR_LOCALBUMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETR_LOCALBUMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13160,7 +13160,7 @@ FLR_RESULT CLIENT_pkgLfsrSetR_CornerBump(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETR_CORNERBUMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETR_CORNERBUMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13182,7 +13182,7 @@ FLR_RESULT CLIENT_pkgLfsrGetR_CornerBump(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETR_CORNERBUMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETR_CORNERBUMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13225,7 +13225,7 @@ FLR_RESULT CLIENT_pkgLfsrSetFFC_ResetEnable(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETFFC_RESETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETFFC_RESETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13247,7 +13247,7 @@ FLR_RESULT CLIENT_pkgLfsrGetFFC_ResetEnable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETFFC_RESETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETFFC_RESETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13290,7 +13290,7 @@ FLR_RESULT CLIENT_pkgLfsrSetNormalizeAtCenterSpotState(const FLR_ENABLE_E data)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_SETNORMALIZEATCENTERSPOTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_SETNORMALIZEATCENTERSPOTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13312,7 +13312,7 @@ FLR_RESULT CLIENT_pkgLfsrGetNormalizeAtCenterSpotState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, LFSR_GETNORMALIZEATCENTERSPOTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, LFSR_GETNORMALIZEATCENTERSPOTSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13377,7 +13377,7 @@ FLR_RESULT CLIENT_pkgMemReadCapture(const uint8_t bufferNum, const uint32_t offs
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_READCAPTURE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_READCAPTURE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13408,7 +13408,7 @@ FLR_RESULT CLIENT_pkgMemGetCaptureSize(uint32_t *bytes, uint16_t *rows, uint16_t
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_GETCAPTURESIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_GETCAPTURESIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13512,7 +13512,7 @@ FLR_RESULT CLIENT_pkgMemWriteFlash(const FLR_MEM_LOCATION_E location, const uint
         outPtr += sizeInBytes;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_WRITEFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_WRITEFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13574,7 +13574,7 @@ FLR_RESULT CLIENT_pkgMemReadFlash(const FLR_MEM_LOCATION_E location, const uint8
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_READFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_READFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13615,7 +13615,7 @@ FLR_RESULT CLIENT_pkgMemGetFlashSize(const FLR_MEM_LOCATION_E location, uint32_t
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_GETFLASHSIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_GETFLASHSIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13668,7 +13668,7 @@ FLR_RESULT CLIENT_pkgMemEraseFlash(const FLR_MEM_LOCATION_E location, const uint
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_ERASEFLASH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_ERASEFLASH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13730,7 +13730,7 @@ FLR_RESULT CLIENT_pkgMemEraseFlashPartial(const FLR_MEM_LOCATION_E location, con
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_ERASEFLASHPARTIAL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_ERASEFLASHPARTIAL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13772,7 +13772,7 @@ FLR_RESULT CLIENT_pkgMemReadCurrentGain(const uint32_t offset, const uint16_t si
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_READCURRENTGAIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_READCURRENTGAIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13803,7 +13803,7 @@ FLR_RESULT CLIENT_pkgMemGetGainSize(uint32_t *bytes, uint16_t *rows, uint16_t *c
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_GETGAINSIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_GETGAINSIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13868,7 +13868,7 @@ FLR_RESULT CLIENT_pkgMemGetCaptureSizeSrc(const FLR_CAPTURE_SRC_E src, uint32_t
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_GETCAPTURESIZESRC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_GETCAPTURESIZESRC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -13963,7 +13963,7 @@ FLR_RESULT CLIENT_pkgMemReadCaptureSrc(const FLR_CAPTURE_SRC_E src, const uint8_
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, MEM_READCAPTURESRC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, MEM_READCAPTURESRC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14008,7 +14008,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempStableEnable(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPSTABLEENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPSTABLEENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14030,7 +14030,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempStableEnable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPSTABLEENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPSTABLEENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14073,7 +14073,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetFNumberLens0(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETFNUMBERLENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETFNUMBERLENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14095,7 +14095,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetFNumberLens0(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETFNUMBERLENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETFNUMBERLENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14138,7 +14138,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetFNumberLens1(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETFNUMBERLENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETFNUMBERLENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14160,7 +14160,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetFNumberLens1(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETFNUMBERLENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETFNUMBERLENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14203,7 +14203,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTauLens0(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTAULENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTAULENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14225,7 +14225,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTauLens0(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTAULENS0, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTAULENS0, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14268,7 +14268,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTauLens1(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTAULENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTAULENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14290,7 +14290,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTauLens1(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTAULENS1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTAULENS1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14323,7 +14323,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalGainDesired(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALGAINDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALGAINDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14356,7 +14356,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalOffsetDesired(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALOFFSETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALOFFSETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14389,7 +14389,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalGainApplied(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALGAINAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALGAINAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14422,7 +14422,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalOffsetApplied(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALOFFSETAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALOFFSETAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14465,7 +14465,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTComponentOverrideMode(const FLR_ENABLE_E data
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTCOMPONENTOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTCOMPONENTOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14487,7 +14487,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTComponentOverrideMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTCOMPONENTOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTCOMPONENTOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14530,7 +14530,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetGlobalGainOverride(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETGLOBALGAINOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETGLOBALGAINOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14552,7 +14552,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalGainOverride(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALGAINOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALGAINOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14595,7 +14595,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetGlobalOffsetOverride(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETGLOBALOFFSETOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETGLOBALOFFSETOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14617,7 +14617,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalOffsetOverride(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALOFFSETOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALOFFSETOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14660,7 +14660,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetGlobalParamOverrideMode(const FLR_ENABLE_E dat
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETGLOBALPARAMOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETGLOBALPARAMOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14682,7 +14682,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGlobalParamOverrideMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGLOBALPARAMOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGLOBALPARAMOVERRIDEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14725,7 +14725,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetRBFOHighGainDefault(const FLR_RADIOMETRY_RBFO_
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETRBFOHIGHGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETRBFOHIGHGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14747,7 +14747,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetRBFOHighGainDefault(FLR_RADIOMETRY_RBFO_PARAMS
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRBFOHIGHGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRBFOHIGHGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14790,7 +14790,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetRBFOLowGainDefault(const FLR_RADIOMETRY_RBFO_P
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETRBFOLOWGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETRBFOLOWGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14812,7 +14812,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetRBFOLowGainDefault(FLR_RADIOMETRY_RBFO_PARAMS_
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRBFOLOWGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRBFOLOWGAINDEFAULT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14855,7 +14855,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetRBFOHighGainFactory(const FLR_RADIOMETRY_RBFO_
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETRBFOHIGHGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETRBFOHIGHGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14877,7 +14877,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetRBFOHighGainFactory(FLR_RADIOMETRY_RBFO_PARAMS
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRBFOHIGHGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRBFOHIGHGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14920,7 +14920,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetRBFOLowGainFactory(const FLR_RADIOMETRY_RBFO_P
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETRBFOLOWGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETRBFOLOWGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14942,7 +14942,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetRBFOLowGainFactory(FLR_RADIOMETRY_RBFO_PARAMS_
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRBFOLOWGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRBFOLOWGAINFACTORY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -14985,7 +14985,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetDampingFactor(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15007,7 +15007,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetDampingFactor(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15040,7 +15040,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGoMEQ(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGOMEQ, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGOMEQ, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15073,7 +15073,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGoMShutter(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGOMSHUTTER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGOMSHUTTER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15106,7 +15106,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGoMLens(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGOMLENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGOMLENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15139,7 +15139,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGoMLG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGOMLG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGOMLG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15172,7 +15172,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGoMFFC(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGOMFFC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGOMFFC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15205,7 +15205,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempLensHousing(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPLENSHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPLENSHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15238,7 +15238,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempShutterHousing(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15271,7 +15271,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempShutterPaddle(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPSHUTTERPADDLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPSHUTTERPADDLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15314,7 +15314,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetFNumberShutterHousing(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETFNUMBERSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETFNUMBERSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15336,7 +15336,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetFNumberShutterHousing(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETFNUMBERSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETFNUMBERSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15379,7 +15379,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetEmissivityShutterHousing(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETEMISSIVITYSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETEMISSIVITYSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15401,7 +15401,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetEmissivityShutterHousing(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETEMISSIVITYSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETEMISSIVITYSHUTTERHOUSING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15444,7 +15444,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_DTfpa_Lens(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DTFPA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DTFPA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15466,7 +15466,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_DTfpa_Lens(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DTFPA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DTFPA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15509,7 +15509,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetOffset_Lens(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETOFFSET_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETOFFSET_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15531,7 +15531,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetOffset_Lens(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETOFFSET_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETOFFSET_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15574,7 +15574,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Recursive_Lens(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_RECURSIVE_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_RECURSIVE_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15596,7 +15596,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Recursive_Lens(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_RECURSIVE_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_RECURSIVE_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15629,7 +15629,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGgFfc(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGGFFC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGGFFC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15682,7 +15682,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetCountsFromTemp(const FLR_RADIOMETRY_RBFO_TYPE_
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETCOUNTSFROMTEMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETCOUNTSFROMTEMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15735,7 +15735,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempFromCounts(const FLR_RADIOMETRY_RBFO_TYPE_
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPFROMCOUNTS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPFROMCOUNTS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15778,7 +15778,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempLensHousingOverride(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPLENSHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPLENSHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15800,7 +15800,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempLensHousingOverride(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPLENSHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPLENSHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15843,7 +15843,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempShutterHousingOverride(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPSHUTTERHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPSHUTTERHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15865,7 +15865,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempShutterHousingOverride(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPSHUTTERHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPSHUTTERHOUSINGOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15908,7 +15908,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempShutterPaddleOverride(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPSHUTTERPADDLEOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPSHUTTERPADDLEOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15930,7 +15930,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempShutterPaddleOverride(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPSHUTTERPADDLEOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPSHUTTERPADDLEOVERRIDE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15973,7 +15973,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetSignalFactorLut(const FLR_RADIOMETRY_SIGNAL_CO
         outPtr += 34;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETSIGNALFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETSIGNALFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -15995,7 +15995,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetSignalFactorLut(FLR_RADIOMETRY_SIGNAL_COMP_FAC
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETSIGNALFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETSIGNALFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16038,7 +16038,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetNoiseFactorLut(const FLR_RADIOMETRY_NOISE_COMP
         outPtr += 34;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETNOISEFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETNOISEFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16060,7 +16060,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetNoiseFactorLut(FLR_RADIOMETRY_NOISE_COMP_FACTO
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETNOISEFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETNOISEFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16103,7 +16103,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_tfpaK(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16125,7 +16125,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_tfpaK(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16168,7 +16168,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_tfpaK(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16190,7 +16190,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_tfpaK(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_TFPAK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16233,7 +16233,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTAuxParams(const FLR_RADIOMETRY_TAUX_PARAMS_T
         outPtr += 16;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTAUXPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTAUXPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16255,7 +16255,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTAuxParams(FLR_RADIOMETRY_TAUX_PARAMS_T *data)
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTAUXPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTAUXPARAMS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16298,7 +16298,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_tAux(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16320,7 +16320,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_tAux(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16363,7 +16363,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_tAux(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16385,7 +16385,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_tAux(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_TAUX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16428,7 +16428,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTsource_FFC(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTSOURCE_FFC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTSOURCE_FFC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16450,7 +16450,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTsource_FFC(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTSOURCE_FFC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTSOURCE_FFC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16493,7 +16493,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_DTfpa_Sh_h(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DTFPA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DTFPA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16515,7 +16515,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_DTfpa_Sh_h(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DTFPA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DTFPA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16558,7 +16558,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetOffset_Sh_h(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETOFFSET_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETOFFSET_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16580,7 +16580,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetOffset_Sh_h(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETOFFSET_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETOFFSET_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16623,7 +16623,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Recursive_Sh_h(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_RECURSIVE_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_RECURSIVE_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16645,7 +16645,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Recursive_Sh_h(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_RECURSIVE_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_RECURSIVE_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16688,7 +16688,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_DTfpa_Sh_p(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DTFPA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DTFPA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16710,7 +16710,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_DTfpa_Sh_p(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DTFPA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DTFPA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16753,7 +16753,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetOffset_Sh_p(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETOFFSET_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETOFFSET_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16775,7 +16775,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetOffset_Sh_p(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETOFFSET_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETOFFSET_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16818,7 +16818,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Recursive_Sh_p(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_RECURSIVE_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_RECURSIVE_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16840,7 +16840,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Recursive_Sh_p(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_RECURSIVE_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_RECURSIVE_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16883,7 +16883,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Sh_p(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16905,7 +16905,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Sh_p(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16948,7 +16948,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Sh_p(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -16970,7 +16970,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Sh_p(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_SH_P, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17003,7 +17003,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetDtTfpaK(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDTTFPAK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDTTFPAK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17036,7 +17036,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetDtTfpaK_Damp(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDTTFPAK_DAMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDTTFPAK_DAMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17069,7 +17069,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTAuxK(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTAUXK, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTAUXK, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17112,7 +17112,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetExternalFfcUpdateMode(const FLR_ENABLE_E data)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETEXTERNALFFCUPDATEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETEXTERNALFFCUPDATEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17134,7 +17134,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetExternalFfcUpdateMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETEXTERNALFFCUPDATEMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETEXTERNALFFCUPDATEMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17167,7 +17167,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGG_scale(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGG_SCALE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGG_SCALE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17210,7 +17210,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempWindow(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17232,7 +17232,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempWindow(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17275,7 +17275,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTransmissionWindow(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTRANSMISSIONWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTRANSMISSIONWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17297,7 +17297,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTransmissionWindow(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTRANSMISSIONWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTRANSMISSIONWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17340,7 +17340,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetReflectivityWindow(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETREFLECTIVITYWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETREFLECTIVITYWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17362,7 +17362,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetReflectivityWindow(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETREFLECTIVITYWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETREFLECTIVITYWINDOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17405,7 +17405,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempWindowReflection(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPWINDOWREFLECTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPWINDOWREFLECTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17427,7 +17427,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempWindowReflection(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPWINDOWREFLECTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPWINDOWREFLECTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17470,7 +17470,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTransmissionAtmosphere(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTRANSMISSIONATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTRANSMISSIONATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17492,7 +17492,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTransmissionAtmosphere(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTRANSMISSIONATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTRANSMISSIONATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17535,7 +17535,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempAtmosphere(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17557,7 +17557,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempAtmosphere(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPATMOSPHERE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17600,7 +17600,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetEmissivityTarget(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETEMISSIVITYTARGET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETEMISSIVITYTARGET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17622,7 +17622,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetEmissivityTarget(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETEMISSIVITYTARGET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETEMISSIVITYTARGET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17665,7 +17665,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTempBackground(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPBACKGROUND, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPBACKGROUND, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17687,7 +17687,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTempBackground(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPBACKGROUND, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPBACKGROUND, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17720,7 +17720,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetRadiometryCapable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRADIOMETRYCAPABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRADIOMETRYCAPABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17763,7 +17763,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetdeltaTempDampingFactor(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETDELTATEMPDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETDELTATEMPDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17785,7 +17785,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetdeltaTempDampingFactor(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDELTATEMPDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDELTATEMPDAMPINGFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17828,7 +17828,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetdeltaTempIntervalTime(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETDELTATEMPINTERVALTIME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETDELTATEMPINTERVALTIME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17850,7 +17850,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetdeltaTempIntervalTime(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDELTATEMPINTERVALTIME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDELTATEMPINTERVALTIME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17893,7 +17893,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetdeltaTempMaxValue(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETDELTATEMPMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETDELTATEMPMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17915,7 +17915,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetdeltaTempMaxValue(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDELTATEMPMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDELTATEMPMAXVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17958,7 +17958,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetdeltaTempMaxIncrement(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETDELTATEMPMAXINCREMENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETDELTATEMPMAXINCREMENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -17980,7 +17980,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetdeltaTempMaxIncrement(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDELTATEMPMAXINCREMENT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDELTATEMPMAXINCREMENT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18023,7 +18023,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetdeltaTempDampingTime(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETDELTATEMPDAMPINGTIME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETDELTATEMPDAMPINGTIME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18045,7 +18045,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetdeltaTempDampingTime(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETDELTATEMPDAMPINGTIME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETDELTATEMPDAMPINGTIME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18078,7 +18078,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetResponsivityFpaTemp(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRESPONSIVITYFPATEMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRESPONSIVITYFPATEMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18121,7 +18121,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Lens(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18143,7 +18143,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Lens(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18186,7 +18186,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Lens(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18208,7 +18208,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Lens(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_LENS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18251,7 +18251,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Sh_h(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18273,7 +18273,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Sh_h(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18316,7 +18316,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Sh_h(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18338,7 +18338,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Sh_h(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_SH_H, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18381,7 +18381,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetGG_Scale_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETGG_SCALE_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETGG_SCALE_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18403,7 +18403,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGG_Scale_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGG_SCALE_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGG_SCALE_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18446,7 +18446,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetGG_Scale_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETGG_SCALE_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETGG_SCALE_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18468,7 +18468,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGG_Scale_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGG_SCALE_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGG_SCALE_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18511,7 +18511,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetRbfoScaledMode(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETRBFOSCALEDMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETRBFOSCALEDMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18533,7 +18533,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetRbfoScaledMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETRBFOSCALEDMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETRBFOSCALEDMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18566,7 +18566,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetUncertaintyFactor(FLR_RADIOMETRY_UNCERTAINTY_F
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETUNCERTAINTYFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETUNCERTAINTYFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18599,7 +18599,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTRoomMinThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTROOMMINTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTROOMMINTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18632,7 +18632,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTRoomMaxThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTROOMMAXTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTROOMMAXTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18665,7 +18665,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTOperatingMinThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTOPERATINGMINTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTOPERATINGMINTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18698,7 +18698,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTOperatingMaxThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTOPERATINGMAXTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTOPERATINGMAXTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18731,7 +18731,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetStableTempThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETSTABLETEMPTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETSTABLETEMPTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18764,7 +18764,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetSlowDriftThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETSLOWDRIFTTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETSLOWDRIFTTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18797,7 +18797,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetFfcTempThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETFFCTEMPTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETFFCTEMPTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18830,7 +18830,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTargetTempMinThreshLG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTARGETTEMPMINTHRESHLG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTARGETTEMPMINTHRESHLG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18863,7 +18863,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTargetTempMaxThreshLG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTARGETTEMPMAXTHRESHLG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTARGETTEMPMAXTHRESHLG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18896,7 +18896,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetMFactorThresh(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETMFACTORTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETMFACTORTHRESH, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18929,7 +18929,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTargetTempMinThreshHG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTARGETTEMPMINTHRESHHG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTARGETTEMPMINTHRESHHG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18962,7 +18962,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTargetTempMaxThreshHG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTARGETTEMPMAXTHRESHHG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTARGETTEMPMAXTHRESHHG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -18995,7 +18995,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetUncertaintyStatusBits(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETUNCERTAINTYSTATUSBITS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETUNCERTAINTYSTATUSBITS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19038,7 +19038,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTemperatureOffset_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPERATUREOFFSET_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPERATUREOFFSET_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19060,7 +19060,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTemperatureOffset_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPERATUREOFFSET_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPERATUREOFFSET_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19103,7 +19103,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetTemperatureOffset_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETTEMPERATUREOFFSET_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETTEMPERATUREOFFSET_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19125,7 +19125,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetTemperatureOffset_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETTEMPERATUREOFFSET_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETTEMPERATUREOFFSET_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19168,7 +19168,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Lens_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19190,7 +19190,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Lens_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19233,7 +19233,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Lens_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19255,7 +19255,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Lens_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19298,7 +19298,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Lens_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19320,7 +19320,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Lens_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19363,7 +19363,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Lens_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19385,7 +19385,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Lens_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19428,7 +19428,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetOffset_Lens_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETOFFSET_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETOFFSET_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19450,7 +19450,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetOffset_Lens_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETOFFSET_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETOFFSET_LENS_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19493,7 +19493,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetOffset_Lens_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETOFFSET_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETOFFSET_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19515,7 +19515,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetOffset_Lens_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETOFFSET_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETOFFSET_LENS_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19558,7 +19558,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Sh_p_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19580,7 +19580,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Sh_p_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19623,7 +19623,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Sh_p_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19645,7 +19645,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Sh_p_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_SH_P_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19688,7 +19688,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Sh_p_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19710,7 +19710,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Sh_p_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19753,7 +19753,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Sh_p_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19775,7 +19775,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Sh_p_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_SH_P_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19818,7 +19818,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Sh_h_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19840,7 +19840,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Sh_h_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19883,7 +19883,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Sh_h_HG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19905,7 +19905,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Sh_h_HG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_SH_H_HG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19948,7 +19948,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetM_Delta_Sh_h_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETM_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETM_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -19970,7 +19970,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetM_Delta_Sh_h_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETM_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETM_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20013,7 +20013,7 @@ FLR_RESULT CLIENT_pkgRadiometrySetB_Delta_Sh_h_LG(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_SETB_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_SETB_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20035,7 +20035,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetB_Delta_Sh_h_LG(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETB_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETB_DELTA_SH_H_LG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20068,7 +20068,7 @@ FLR_RESULT CLIENT_pkgRadiometryGetGG_RoomTemp(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, RADIOMETRY_GETGG_ROOMTEMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, RADIOMETRY_GETGG_ROOMTEMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20103,7 +20103,7 @@ FLR_RESULT CLIENT_pkgRoicGetFPATemp(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFPATEMP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFPATEMP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20136,7 +20136,7 @@ FLR_RESULT CLIENT_pkgRoicGetFrameCount(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFRAMECOUNT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFRAMECOUNT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20169,7 +20169,7 @@ FLR_RESULT CLIENT_pkgRoicGetActiveNormalizationTarget(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETACTIVENORMALIZATIONTARGET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETACTIVENORMALIZATIONTARGET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20212,7 +20212,7 @@ FLR_RESULT CLIENT_pkgRoicSetFPARampState(const FLR_ENABLE_E state) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_SETFPARAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_SETFPARAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20234,7 +20234,7 @@ FLR_RESULT CLIENT_pkgRoicGetFPARampState(FLR_ENABLE_E *state) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFPARAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFPARAMPSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20267,7 +20267,7 @@ FLR_RESULT CLIENT_pkgRoicGetSensorADC1(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETSENSORADC1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETSENSORADC1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20300,7 +20300,7 @@ FLR_RESULT CLIENT_pkgRoicGetSensorADC2(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETSENSORADC2, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETSENSORADC2, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20343,7 +20343,7 @@ FLR_RESULT CLIENT_pkgRoicSetFPATempOffset(const int16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_SETFPATEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_SETFPATEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20365,7 +20365,7 @@ FLR_RESULT CLIENT_pkgRoicGetFPATempOffset(int16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFPATEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFPATEMPOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20408,7 +20408,7 @@ FLR_RESULT CLIENT_pkgRoicSetFPATempMode(const FLR_ROIC_TEMP_MODE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_SETFPATEMPMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_SETFPATEMPMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20430,7 +20430,7 @@ FLR_RESULT CLIENT_pkgRoicGetFPATempMode(FLR_ROIC_TEMP_MODE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFPATEMPMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFPATEMPMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20463,7 +20463,7 @@ FLR_RESULT CLIENT_pkgRoicGetFPATempTable(FLR_ROIC_FPATEMP_TABLE_T *table) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFPATEMPTABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFPATEMPTABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20506,7 +20506,7 @@ FLR_RESULT CLIENT_pkgRoicSetFPATempValue(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_SETFPATEMPVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_SETFPATEMPVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20528,7 +20528,7 @@ FLR_RESULT CLIENT_pkgRoicGetFPATempValue(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFPATEMPVALUE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFPATEMPVALUE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20561,7 +20561,7 @@ FLR_RESULT CLIENT_pkgRoicGetPreambleError(uint32_t *preambleError) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETPREAMBLEERROR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETPREAMBLEERROR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20604,7 +20604,7 @@ FLR_RESULT CLIENT_pkgRoicInducePreambleError(const uint32_t everyNthFrame) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_INDUCEPREAMBLEERROR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_INDUCEPREAMBLEERROR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20626,7 +20626,7 @@ FLR_RESULT CLIENT_pkgRoicGetRoicStarted(FLR_ENABLE_E *roicStarted) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETROICSTARTED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETROICSTARTED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20669,7 +20669,7 @@ FLR_RESULT CLIENT_pkgRoicSetFrameSkip(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_SETFRAMESKIP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_SETFRAMESKIP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20691,7 +20691,7 @@ FLR_RESULT CLIENT_pkgRoicGetFrameSkip(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_GETFRAMESKIP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_GETFRAMESKIP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20724,7 +20724,7 @@ FLR_RESULT CLIENT_pkgRoicSetFrameOneShot() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, ROIC_SETFRAMEONESHOT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, ROIC_SETFRAMEONESHOT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20748,7 +20748,7 @@ FLR_RESULT CLIENT_pkgScalerGetMaxZoom(uint32_t *zoom) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCALER_GETMAXZOOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCALER_GETMAXZOOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20791,7 +20791,7 @@ FLR_RESULT CLIENT_pkgScalerSetZoom(const FLR_SCALER_ZOOM_PARAMS_T zoomParams) {
         outPtr += 12;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCALER_SETZOOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCALER_SETZOOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20813,7 +20813,7 @@ FLR_RESULT CLIENT_pkgScalerGetZoom(FLR_SCALER_ZOOM_PARAMS_T *zoomParams) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCALER_GETZOOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCALER_GETZOOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -20926,7 +20926,7 @@ FLR_RESULT CLIENT_pkgScalerSetFractionalZoom(const uint32_t zoomNumerator, const
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCALER_SETFRACTIONALZOOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCALER_SETFRACTIONALZOOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21018,7 +21018,7 @@ FLR_RESULT CLIENT_pkgScalerSetIndexZoom(const uint32_t zoomIndex, const uint32_t
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCALER_SETINDEXZOOM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCALER_SETINDEXZOOM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21052,7 +21052,7 @@ FLR_RESULT CLIENT_pkgScnrSetEnableState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21074,7 +21074,7 @@ FLR_RESULT CLIENT_pkgScnrGetEnableState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21117,7 +21117,7 @@ FLR_RESULT CLIENT_pkgScnrSetThColSum(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETTHCOLSUM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETTHCOLSUM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21139,7 +21139,7 @@ FLR_RESULT CLIENT_pkgScnrGetThColSum(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETTHCOLSUM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETTHCOLSUM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21182,7 +21182,7 @@ FLR_RESULT CLIENT_pkgScnrSetThPixel(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21204,7 +21204,7 @@ FLR_RESULT CLIENT_pkgScnrGetThPixel(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21247,7 +21247,7 @@ FLR_RESULT CLIENT_pkgScnrSetMaxCorr(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21269,7 +21269,7 @@ FLR_RESULT CLIENT_pkgScnrGetMaxCorr(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21302,7 +21302,7 @@ FLR_RESULT CLIENT_pkgScnrGetThPixelApplied(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETTHPIXELAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETTHPIXELAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21335,7 +21335,7 @@ FLR_RESULT CLIENT_pkgScnrGetMaxCorrApplied(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETMAXCORRAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETMAXCORRAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21378,7 +21378,7 @@ FLR_RESULT CLIENT_pkgScnrSetThColSumSafe(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETTHCOLSUMSAFE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETTHCOLSUMSAFE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21400,7 +21400,7 @@ FLR_RESULT CLIENT_pkgScnrGetThColSumSafe(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETTHCOLSUMSAFE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETTHCOLSUMSAFE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21443,7 +21443,7 @@ FLR_RESULT CLIENT_pkgScnrSetThPixelSafe(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETTHPIXELSAFE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETTHPIXELSAFE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21465,7 +21465,7 @@ FLR_RESULT CLIENT_pkgScnrGetThPixelSafe(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETTHPIXELSAFE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETTHPIXELSAFE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21508,7 +21508,7 @@ FLR_RESULT CLIENT_pkgScnrSetMaxCorrSafe(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETMAXCORRSAFE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETMAXCORRSAFE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21530,7 +21530,7 @@ FLR_RESULT CLIENT_pkgScnrGetMaxCorrSafe(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETMAXCORRSAFE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETMAXCORRSAFE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21573,7 +21573,7 @@ FLR_RESULT CLIENT_pkgScnrSetCorrectionMethod(const FLR_SCNR_CORR_SELECT_E data)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETCORRECTIONMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETCORRECTIONMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21595,7 +21595,7 @@ FLR_RESULT CLIENT_pkgScnrGetCorrectionMethod(FLR_SCNR_CORR_SELECT_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETCORRECTIONMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETCORRECTIONMETHOD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21638,7 +21638,7 @@ FLR_RESULT CLIENT_pkgScnrSetStdThreshold(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETSTDTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETSTDTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21660,7 +21660,7 @@ FLR_RESULT CLIENT_pkgScnrGetStdThreshold(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSTDTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSTDTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21703,7 +21703,7 @@ FLR_RESULT CLIENT_pkgScnrSetNFrames(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETNFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETNFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21725,7 +21725,7 @@ FLR_RESULT CLIENT_pkgScnrGetNFrames(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETNFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETNFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21768,7 +21768,7 @@ FLR_RESULT CLIENT_pkgScnrSetResetDesired(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21790,7 +21790,7 @@ FLR_RESULT CLIENT_pkgScnrGetResetDesired(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21833,7 +21833,7 @@ FLR_RESULT CLIENT_pkgScnrSetM_modeOnly(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETM_MODEONLY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETM_MODEONLY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21855,7 +21855,7 @@ FLR_RESULT CLIENT_pkgScnrGetM_modeOnly(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETM_MODEONLY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETM_MODEONLY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21888,7 +21888,7 @@ FLR_RESULT CLIENT_pkgScnrGetMode(FLR_SCNR_MODE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21931,7 +21931,7 @@ FLR_RESULT CLIENT_pkgScnrSetSpecklesEnableState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETSPECKLESENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETSPECKLESENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21953,7 +21953,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesEnableState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -21996,7 +21996,7 @@ FLR_RESULT CLIENT_pkgScnrSetSpecklesThreshold(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETSPECKLESTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETSPECKLESTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22018,7 +22018,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesThreshold(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22061,7 +22061,7 @@ FLR_RESULT CLIENT_pkgScnrSetSpecklesRatio(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETSPECKLESRATIO, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETSPECKLESRATIO, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22083,7 +22083,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesRatio(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESRATIO, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESRATIO, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22126,7 +22126,7 @@ FLR_RESULT CLIENT_pkgScnrSetSpecklesDF(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETSPECKLESDF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETSPECKLESDF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22148,7 +22148,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesDF(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESDF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESDF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22181,7 +22181,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesDiffsBufferAddr(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESDIFFSBUFFERADDR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESDIFFSBUFFERADDR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22214,7 +22214,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesOffsBufferAddr(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESOFFSBUFFERADDR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESOFFSBUFFERADDR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22257,7 +22257,7 @@ FLR_RESULT CLIENT_pkgScnrSetSpecklesResetDesired(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_SETSPECKLESRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_SETSPECKLESRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22279,7 +22279,7 @@ FLR_RESULT CLIENT_pkgScnrGetSpecklesResetDesired(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SCNR_GETSPECKLESRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SCNR_GETSPECKLESRESETDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22314,7 +22314,7 @@ FLR_RESULT CLIENT_pkgSffcGetScaleFactor(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_GETSCALEFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_GETSCALEFACTOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22347,7 +22347,7 @@ FLR_RESULT CLIENT_pkgSffcGetDeltaTempLinearCoeff(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_GETDELTATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_GETDELTATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22390,7 +22390,7 @@ FLR_RESULT CLIENT_pkgSffcSetDeltaTempLinearCoeff(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_SETDELTATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_SETDELTATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22412,7 +22412,7 @@ FLR_RESULT CLIENT_pkgSffcGetDeltaTempOffsetCoeff(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_GETDELTATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_GETDELTATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22455,7 +22455,7 @@ FLR_RESULT CLIENT_pkgSffcSetDeltaTempOffsetCoeff(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_SETDELTATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_SETDELTATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22477,7 +22477,7 @@ FLR_RESULT CLIENT_pkgSffcGetFpaTempLinearCoeff(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_GETFPATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_GETFPATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22520,7 +22520,7 @@ FLR_RESULT CLIENT_pkgSffcSetFpaTempLinearCoeff(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_SETFPATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_SETFPATEMPLINEARCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22542,7 +22542,7 @@ FLR_RESULT CLIENT_pkgSffcGetFpaTempOffsetCoeff(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_GETFPATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_GETFPATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22585,7 +22585,7 @@ FLR_RESULT CLIENT_pkgSffcSetFpaTempOffsetCoeff(const float data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_SETFPATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_SETFPATEMPOFFSETCOEFF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22607,7 +22607,7 @@ FLR_RESULT CLIENT_pkgSffcGetDeltaTempTimeLimitInSecs(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_GETDELTATEMPTIMELIMITINSECS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_GETDELTATEMPTIMELIMITINSECS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22650,7 +22650,7 @@ FLR_RESULT CLIENT_pkgSffcSetDeltaTempTimeLimitInSecs(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SFFC_SETDELTATEMPTIMELIMITINSECS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SFFC_SETDELTATEMPTIMELIMITINSECS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22684,7 +22684,7 @@ FLR_RESULT CLIENT_pkgSpnrSetEnableState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22706,7 +22706,7 @@ FLR_RESULT CLIENT_pkgSpnrGetEnableState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22739,7 +22739,7 @@ FLR_RESULT CLIENT_pkgSpnrGetState(FLR_SPNR_STATE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22782,7 +22782,7 @@ FLR_RESULT CLIENT_pkgSpnrSetFrameDelay(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETFRAMEDELAY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETFRAMEDELAY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22804,7 +22804,7 @@ FLR_RESULT CLIENT_pkgSpnrGetFrameDelay(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETFRAMEDELAY, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETFRAMEDELAY, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22847,7 +22847,7 @@ FLR_RESULT CLIENT_pkgSpnrSetSF(const float sf) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETSF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETSF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22869,7 +22869,7 @@ FLR_RESULT CLIENT_pkgSpnrGetSF(float *sf) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETSF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETSF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22902,7 +22902,7 @@ FLR_RESULT CLIENT_pkgSpnrGetSFApplied(float *sf) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETSFAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETSFAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22945,7 +22945,7 @@ FLR_RESULT CLIENT_pkgSpnrSetPSDKernel(const FLR_SPNR_PSD_KERNEL_T data) {
         outPtr += 256;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETPSDKERNEL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETPSDKERNEL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -22967,7 +22967,7 @@ FLR_RESULT CLIENT_pkgSpnrGetPSDKernel(FLR_SPNR_PSD_KERNEL_T *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETPSDKERNEL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETPSDKERNEL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23010,7 +23010,7 @@ FLR_RESULT CLIENT_pkgSpnrSetSFMin(const float sfmin) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETSFMIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETSFMIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23032,7 +23032,7 @@ FLR_RESULT CLIENT_pkgSpnrGetSFMin(float *sfmin) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETSFMIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETSFMIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23075,7 +23075,7 @@ FLR_RESULT CLIENT_pkgSpnrSetSFMax(const float sfmax) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETSFMAX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETSFMAX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23097,7 +23097,7 @@ FLR_RESULT CLIENT_pkgSpnrGetSFMax(float *sfmax) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETSFMAX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETSFMAX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23140,7 +23140,7 @@ FLR_RESULT CLIENT_pkgSpnrSetDFMin(const float dfmin) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETDFMIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETDFMIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23162,7 +23162,7 @@ FLR_RESULT CLIENT_pkgSpnrGetDFMin(float *dfmin) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETDFMIN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETDFMIN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23205,7 +23205,7 @@ FLR_RESULT CLIENT_pkgSpnrSetDFMax(const float dfmax) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETDFMAX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETDFMAX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23227,7 +23227,7 @@ FLR_RESULT CLIENT_pkgSpnrGetDFMax(float *dfmax) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETDFMAX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETDFMAX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23270,7 +23270,7 @@ FLR_RESULT CLIENT_pkgSpnrSetNormTarget(const float normTarget) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETNORMTARGET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETNORMTARGET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23292,7 +23292,7 @@ FLR_RESULT CLIENT_pkgSpnrGetNormTarget(float *normTarget) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETNORMTARGET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETNORMTARGET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23325,7 +23325,7 @@ FLR_RESULT CLIENT_pkgSpnrGetNormTargetApplied(float *normTargetApplied) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETNORMTARGETAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETNORMTARGETAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23368,7 +23368,7 @@ FLR_RESULT CLIENT_pkgSpnrSetThPix(const uint16_t th_pix) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETTHPIX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETTHPIX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23390,7 +23390,7 @@ FLR_RESULT CLIENT_pkgSpnrGetThPix(uint16_t *th_pix) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETTHPIX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETTHPIX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23433,7 +23433,7 @@ FLR_RESULT CLIENT_pkgSpnrSetThPixSum(const uint16_t th_pixSum) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETTHPIXSUM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETTHPIXSUM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23455,7 +23455,7 @@ FLR_RESULT CLIENT_pkgSpnrGetThPixSum(uint16_t *th_pixSum) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETTHPIXSUM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETTHPIXSUM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23498,7 +23498,7 @@ FLR_RESULT CLIENT_pkgSpnrSetMaxcorr(const uint16_t maxcorr) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23520,7 +23520,7 @@ FLR_RESULT CLIENT_pkgSpnrGetMaxcorr(uint16_t *maxcorr) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23553,7 +23553,7 @@ FLR_RESULT CLIENT_pkgSpnrGetAlgorithm(FLR_SPNR_ALGORITHM_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETALGORITHM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETALGORITHM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23596,7 +23596,7 @@ FLR_RESULT CLIENT_pkgSpnrSetAlgorithmDesired(const FLR_SPNR_ALGORITHM_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETALGORITHMDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETALGORITHMDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23618,7 +23618,7 @@ FLR_RESULT CLIENT_pkgSpnrGetAlgorithmDesired(FLR_SPNR_ALGORITHM_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETALGORITHMDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETALGORITHMDESIRED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23661,7 +23661,7 @@ FLR_RESULT CLIENT_pkgSpnrSetDFFast(const float dffast) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETDFFAST, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETDFFAST, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23683,7 +23683,7 @@ FLR_RESULT CLIENT_pkgSpnrGetDFFast(float *dffast) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETDFFAST, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETDFFAST, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23726,7 +23726,7 @@ FLR_RESULT CLIENT_pkgSpnrSetDFSlow(const float dfslow) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETDFSLOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETDFSLOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23748,7 +23748,7 @@ FLR_RESULT CLIENT_pkgSpnrGetDFSlow(float *dfslow) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETDFSLOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETDFSLOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23791,7 +23791,7 @@ FLR_RESULT CLIENT_pkgSpnrSetSensitivityThreshold(const float threshold) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETSENSITIVITYTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETSENSITIVITYTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23813,7 +23813,7 @@ FLR_RESULT CLIENT_pkgSpnrGetSensitivityThreshold(float *threshold) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_GETSENSITIVITYTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_GETSENSITIVITYTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23856,7 +23856,7 @@ FLR_RESULT CLIENT_pkgSpnrSetReset(const FLR_SPNR_RESET_E resetType) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPNR_SETRESET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPNR_SETRESET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23890,7 +23890,7 @@ FLR_RESULT CLIENT_pkgSpotmeterSetEnable(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23912,7 +23912,7 @@ FLR_RESULT CLIENT_pkgSpotmeterGetEnable(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23945,7 +23945,7 @@ FLR_RESULT CLIENT_pkgSpotmeterGetRoiMaxSize(uint16_t *width, uint16_t *height) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_GETROIMAXSIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_GETROIMAXSIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -23999,7 +23999,7 @@ FLR_RESULT CLIENT_pkgSpotmeterSetRoi(const FLR_ROI_T roi) {
         outPtr += 8;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_SETROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_SETROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24021,7 +24021,7 @@ FLR_RESULT CLIENT_pkgSpotmeterGetRoi(FLR_ROI_T *roi) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_GETROI, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_GETROI, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24054,7 +24054,7 @@ FLR_RESULT CLIENT_pkgSpotmeterGetSpotStats(uint16_t *mean, uint16_t *deviation,
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_GETSPOTSTATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_GETSPOTSTATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24130,7 +24130,7 @@ FLR_RESULT CLIENT_pkgSpotmeterSetStatsMode(const FLR_SPOTMETER_STATS_TEMP_MODE_E
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_SETSTATSMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_SETSTATSMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24152,7 +24152,7 @@ FLR_RESULT CLIENT_pkgSpotmeterGetStatsMode(FLR_SPOTMETER_STATS_TEMP_MODE_E *mode
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_GETSTATSMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_GETSTATSMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24185,7 +24185,7 @@ FLR_RESULT CLIENT_pkgSpotmeterGetTempStats(float *mean, float *deviation, FLR_SP
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SPOTMETER_GETTEMPSTATS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SPOTMETER_GETTEMPSTATS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24263,7 +24263,7 @@ FLR_RESULT CLIENT_pkgSrnrSetEnableState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24285,7 +24285,7 @@ FLR_RESULT CLIENT_pkgSrnrGetEnableState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24328,7 +24328,7 @@ FLR_RESULT CLIENT_pkgSrnrSetThRowSum(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_SETTHROWSUM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_SETTHROWSUM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24350,7 +24350,7 @@ FLR_RESULT CLIENT_pkgSrnrGetThRowSum(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_GETTHROWSUM, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_GETTHROWSUM, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24393,7 +24393,7 @@ FLR_RESULT CLIENT_pkgSrnrSetThPixel(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_SETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_SETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24415,7 +24415,7 @@ FLR_RESULT CLIENT_pkgSrnrGetThPixel(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_GETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_GETTHPIXEL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24458,7 +24458,7 @@ FLR_RESULT CLIENT_pkgSrnrSetMaxCorr(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_SETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_SETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24480,7 +24480,7 @@ FLR_RESULT CLIENT_pkgSrnrGetMaxCorr(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_GETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_GETMAXCORR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24513,7 +24513,7 @@ FLR_RESULT CLIENT_pkgSrnrGetThPixelApplied(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_GETTHPIXELAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_GETTHPIXELAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24546,7 +24546,7 @@ FLR_RESULT CLIENT_pkgSrnrGetMaxCorrApplied(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SRNR_GETMAXCORRAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SRNR_GETMAXCORRAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24591,7 +24591,7 @@ FLR_RESULT CLIENT_pkgSymbologySetEnable(const FLR_ENABLE_E draw_symbols) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24663,7 +24663,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateBitmap(const uint8_t ID, const int16_t pos_X
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEBITMAP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEBITMAP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24715,7 +24715,7 @@ FLR_RESULT CLIENT_pkgSymbologySendData(const uint8_t ID, const int16_t size, con
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SENDDATA, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SENDDATA, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24817,7 +24817,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateArc(const uint8_t ID, const int16_t pos_X, c
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEARC, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEARC, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24939,7 +24939,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateText(const uint8_t ID, const int16_t pos_X,
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATETEXT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATETEXT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -24991,7 +24991,7 @@ FLR_RESULT CLIENT_pkgSymbologyMoveSprite(const uint8_t ID, const int16_t pos_X,
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_MOVESPRITE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_MOVESPRITE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25033,7 +25033,7 @@ FLR_RESULT CLIENT_pkgSymbologyAddToGroup(const uint8_t ID, const uint8_t group_I
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_ADDTOGROUP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_ADDTOGROUP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25075,7 +25075,7 @@ FLR_RESULT CLIENT_pkgSymbologyRemoveFromGroup(const uint8_t ID, const uint8_t gr
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_REMOVEFROMGROUP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_REMOVEFROMGROUP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25117,7 +25117,7 @@ FLR_RESULT CLIENT_pkgSymbologyUpdateAndShow(const uint8_t ID, const uint8_t visi
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_UPDATEANDSHOW, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_UPDATEANDSHOW, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25159,7 +25159,7 @@ FLR_RESULT CLIENT_pkgSymbologyUpdateAndShowGroup(const uint8_t group_ID, const u
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_UPDATEANDSHOWGROUP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_UPDATEANDSHOWGROUP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25191,7 +25191,7 @@ FLR_RESULT CLIENT_pkgSymbologyDelete(const uint8_t ID) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_DELETE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_DELETE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25223,7 +25223,7 @@ FLR_RESULT CLIENT_pkgSymbologyDeleteGroup(const uint8_t group_ID) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_DELETEGROUP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_DELETEGROUP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25305,7 +25305,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateFilledRectangle(const uint8_t ID, const int1
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEFILLEDRECTANGLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEFILLEDRECTANGLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25387,7 +25387,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateOutlinedRectangle(const uint8_t ID, const in
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEOUTLINEDRECTANGLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEOUTLINEDRECTANGLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25449,7 +25449,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateBitmapFromPng(const uint8_t ID, const int16_
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEBITMAPFROMPNG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEBITMAPFROMPNG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25521,7 +25521,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateCompressedBitmap(const uint8_t ID, const int
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATECOMPRESSEDBITMAP, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATECOMPRESSEDBITMAP, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25583,7 +25583,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateBitmapFromPngFile(const uint8_t ID, const in
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEBITMAPFROMPNGFILE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEBITMAPFROMPNGFILE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25655,7 +25655,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateBitmapFromFile(const uint8_t ID, const int16
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEBITMAPFROMFILE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEBITMAPFROMFILE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25687,7 +25687,7 @@ FLR_RESULT CLIENT_pkgSymbologyResetWritePosition(const uint8_t ID) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_RESETWRITEPOSITION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_RESETWRITEPOSITION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25739,7 +25739,7 @@ FLR_RESULT CLIENT_pkgSymbologyMoveByOffset(const uint8_t ID, const int16_t off_X
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_MOVEBYOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_MOVEBYOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25791,7 +25791,7 @@ FLR_RESULT CLIENT_pkgSymbologyMoveGroupByOffset(const uint8_t ID, const int16_t
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_MOVEGROUPBYOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_MOVEGROUPBYOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25873,7 +25873,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateFilledEllipse(const uint8_t ID, const int16_
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATEFILLEDELLIPSE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATEFILLEDELLIPSE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25955,7 +25955,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateLine(const uint8_t ID, const int16_t pos_X,
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATELINE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATELINE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -25997,7 +25997,7 @@ FLR_RESULT CLIENT_pkgSymbologySetZorder(const uint8_t ID, const uint8_t zorder)
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SETZORDER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SETZORDER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26019,7 +26019,7 @@ FLR_RESULT CLIENT_pkgSymbologySaveConfiguration() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SAVECONFIGURATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SAVECONFIGURATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26041,7 +26041,7 @@ FLR_RESULT CLIENT_pkgSymbologyReloadConfiguration() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_RELOADCONFIGURATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_RELOADCONFIGURATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26063,7 +26063,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetEnable(FLR_ENABLE_E *draw_symbols) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26116,7 +26116,7 @@ FLR_RESULT CLIENT_pkgSymbologySetClonesNumber(const uint8_t ID, const uint8_t nu
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SETCLONESNUMBER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SETCLONESNUMBER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26178,7 +26178,7 @@ FLR_RESULT CLIENT_pkgSymbologyMoveCloneByOffset(const uint8_t ID, const uint8_t
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_MOVECLONEBYOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_MOVECLONEBYOFFSET, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26240,7 +26240,7 @@ FLR_RESULT CLIENT_pkgSymbologyMoveCloneSprite(const uint8_t ID, const uint8_t cl
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_MOVECLONESPRITE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_MOVECLONESPRITE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26272,7 +26272,7 @@ FLR_RESULT CLIENT_pkgSymbologySetTransformation(const FLR_SYMBOLOGY_TRANSFORMATI
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SETTRANSFORMATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SETTRANSFORMATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26294,7 +26294,7 @@ FLR_RESULT CLIENT_pkgSymbologyUpdateAllVisible() {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_UPDATEALLVISIBLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_UPDATEALLVISIBLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26356,7 +26356,7 @@ FLR_RESULT CLIENT_pkgSymbologySetSizeAndScalingMode(const uint8_t ID, const int1
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_SETSIZEANDSCALINGMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_SETSIZEANDSCALINGMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26468,7 +26468,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateLineHVT(const uint8_t ID, const int16_t pos_
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATELINEHVT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATELINEHVT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26610,7 +26610,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateTextHVT(const uint8_t ID, const int16_t pos_
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATETEXTHVT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATETEXTHVT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26742,7 +26742,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateTextBg(const uint8_t ID, const int16_t pos_X
         outPtr += 128;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATETEXTBG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATETEXTBG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26844,7 +26844,7 @@ FLR_RESULT CLIENT_pkgSymbologyCreateScaledBitmapFromFile(const uint8_t ID, const
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_CREATESCALEDBITMAPFROMFILE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_CREATESCALEDBITMAPFROMFILE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26876,7 +26876,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetLocation(const uint8_t ID, int16_t *pos_X, int1
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26930,7 +26930,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetSize(const uint8_t ID, int16_t *width, int16_t
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETSIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETSIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -26984,7 +26984,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetZorder(const uint8_t ID, uint8_t *zorder) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETZORDER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETZORDER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27027,7 +27027,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetColor(const uint8_t ID, uint32_t *color) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETCOLOR, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETCOLOR, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27070,7 +27070,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetType(const uint8_t ID, FLR_SYMBOLOGY_TYPE_E *ty
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27123,7 +27123,7 @@ FLR_RESULT CLIENT_pkgSymbologyCopySymbol(const uint8_t source, const uint8_t des
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_COPYSYMBOL, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_COPYSYMBOL, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27155,7 +27155,7 @@ FLR_RESULT CLIENT_pkgSymbologyGetTextFontSize(const uint8_t ID, int16_t *size) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYMBOLOGY_GETTEXTFONTSIZE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYMBOLOGY_GETTEXTFONTSIZE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27200,7 +27200,7 @@ FLR_RESULT CLIENT_pkgSysctrlSetFreezeState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_SETFREEZESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_SETFREEZESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27222,7 +27222,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetFreezeState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETFREEZESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETFREEZESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27255,7 +27255,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetCameraFrameRate(uint32_t *frameRate) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETCAMERAFRAMERATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETCAMERAFRAMERATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27288,7 +27288,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetUptimeSecs(uint32_t *uptime) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETUPTIMESECS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETUPTIMESECS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27331,7 +27331,7 @@ FLR_RESULT CLIENT_pkgSysctrlSetUsbVideoIR16Mode(const FLR_SYSCTRL_USBIR16_MODE_E
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_SETUSBVIDEOIR16MODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_SETUSBVIDEOIR16MODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27353,7 +27353,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetUsbVideoIR16Mode(FLR_SYSCTRL_USBIR16_MODE_E *data
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETUSBVIDEOIR16MODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETUSBVIDEOIR16MODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27396,7 +27396,7 @@ FLR_RESULT CLIENT_pkgSysctrlSetOperatingMode(const FLR_SYSCTRL_OPERATING_MODE_E
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_SETOPERATINGMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_SETOPERATINGMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27418,7 +27418,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetOperatingMode(FLR_SYSCTRL_OPERATING_MODE_E *data)
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETOPERATINGMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETOPERATINGMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27451,7 +27451,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetAvgFpaTempCounts(float *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETAVGFPATEMPCOUNTS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETAVGFPATEMPCOUNTS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27494,7 +27494,7 @@ FLR_RESULT CLIENT_pkgSysctrlSetFpaTempFrames(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_SETFPATEMPFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_SETFPATEMPFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27516,7 +27516,7 @@ FLR_RESULT CLIENT_pkgSysctrlGetFpaTempFrames(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSCTRL_GETFPATEMPFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSCTRL_GETFPATEMPFRAMES, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27551,7 +27551,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetMonitorSoftwareRev(uint32_t *major, uint32_t *min
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETMONITORSOFTWAREREV, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETMONITORSOFTWAREREV, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27606,7 +27606,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetMonitorBuildVariant(FLR_SYSINFO_MONITOR_BUILD_VAR
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETMONITORBUILDVARIANT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETMONITORBUILDVARIANT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27639,7 +27639,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetProductName(uint8_t *name) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETPRODUCTNAME, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETPRODUCTNAME, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27799,7 +27799,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetCameraSN(uint8_t *number) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETCAMERASN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETCAMERASN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27959,7 +27959,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetBootLocation(uint32_t *bootSwLocation) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETBOOTLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETBOOTLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -27992,7 +27992,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetSwConfigID(FLR_SYSINFO_SW_CONFIG_ID_E *swConfigID
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETSWCONFIGID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETSWCONFIGID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28025,7 +28025,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetSwPermissions(FLR_SYSINFO_SW_PERMISSIONS_E *swPer
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETSWPERMISSIONS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETSWPERMISSIONS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28058,7 +28058,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetIs9HzBuild(uint32_t *is9HzBuild) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETIS9HZBUILD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETIS9HZBUILD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28091,7 +28091,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetProductVersion(uint32_t *major, uint32_t *minor,
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETPRODUCTVERSION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETPRODUCTVERSION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28146,7 +28146,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetMonitorProductRev(uint32_t *major, uint32_t *mino
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETMONITORPRODUCTREV, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETMONITORPRODUCTREV, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28201,7 +28201,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetOpticalRevision(uint16_t *revision) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETOPTICALREVISION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETOPTICALREVISION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28234,7 +28234,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetSensorRevision(uint16_t *revision) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETSENSORREVISION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETSENSORREVISION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28267,7 +28267,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetProbeTipSN(uint8_t *number) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETPROBETIPSN, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETPROBETIPSN, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28427,7 +28427,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetMechanicalRevision(uint16_t *revision) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETMECHANICALREVISION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETMECHANICALREVISION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28460,7 +28460,7 @@ FLR_RESULT CLIENT_pkgSysinfoGetProbeTipType(FLR_SYSINFO_PROBE_TIP_TYPE *type) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSINFO_GETPROBETIPTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSINFO_GETPROBETIPTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28505,7 +28505,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetID(const FLR_SYSTEMSYMBOLS_SYMBOL_E symbol,
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28579,7 +28579,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetID(const FLR_SYSTEMSYMBOLS_SYMBOL_E symbol,
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETID, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETID, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28611,7 +28611,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetEnable(const FLR_SYSTEMSYMBOLS_SYMBOL_E sym
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28664,7 +28664,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetEnable(const FLR_SYSTEMSYMBOLS_SYMBOL_E sym
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETENABLE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28686,7 +28686,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetSpotConfig(FLR_SYSTEMSYMBOLS_SPOTCONFIG_T *
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETSPOTCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETSPOTCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28729,7 +28729,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetSpotConfig(const FLR_SYSTEMSYMBOLS_SPOTCONF
         outPtr += 195;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETSPOTCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETSPOTCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28751,7 +28751,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetIsoConfig(FLR_SYSTEMSYMBOLS_ISOCONFIG_T *co
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETISOCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETISOCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28794,7 +28794,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetIsoConfig(const FLR_SYSTEMSYMBOLS_ISOCONFIG
         outPtr += 30;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETISOCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETISOCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28816,7 +28816,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetBarConfig(FLR_SYSTEMSYMBOLS_BARCONFIG_T *lo
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETBARCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETBARCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28901,7 +28901,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetBarConfig(const FLR_SYSTEMSYMBOLS_BARCONFIG
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETBARCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETBARCONFIG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28923,7 +28923,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetSpotConfigIds(FLR_SYSTEMSYMBOLS_SPOTCONFIG_
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETSPOTCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETSPOTCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28966,7 +28966,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetSpotConfigIds(const FLR_SYSTEMSYMBOLS_SPOTC
         outPtr += 13;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETSPOTCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETSPOTCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -28988,7 +28988,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsGetIsoConfigIds(FLR_SYSTEMSYMBOLS_ISOCONFIG_ID
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_GETISOCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_GETISOCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29031,7 +29031,7 @@ FLR_RESULT CLIENT_pkgSystemsymbolsSetIsoConfigIds(const FLR_SYSTEMSYMBOLS_ISOCON
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, SYSTEMSYMBOLS_SETISOCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, SYSTEMSYMBOLS_SETISOCONFIGIDS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29065,7 +29065,7 @@ FLR_RESULT CLIENT_pkgTelemetrySetState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_SETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_SETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29087,7 +29087,7 @@ FLR_RESULT CLIENT_pkgTelemetryGetState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_GETSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29130,7 +29130,7 @@ FLR_RESULT CLIENT_pkgTelemetrySetLocation(const FLR_TELEMETRY_LOC_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_SETLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_SETLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29152,7 +29152,7 @@ FLR_RESULT CLIENT_pkgTelemetryGetLocation(FLR_TELEMETRY_LOC_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_GETLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_GETLOCATION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29195,7 +29195,7 @@ FLR_RESULT CLIENT_pkgTelemetrySetPacking(const FLR_TELEMETRY_PACKING_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_SETPACKING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_SETPACKING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29217,7 +29217,7 @@ FLR_RESULT CLIENT_pkgTelemetryGetPacking(FLR_TELEMETRY_PACKING_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_GETPACKING, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_GETPACKING, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29260,7 +29260,7 @@ FLR_RESULT CLIENT_pkgTelemetrySetOrder(const FLR_TELEMETRY_ORDER_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_SETORDER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_SETORDER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29282,7 +29282,7 @@ FLR_RESULT CLIENT_pkgTelemetryGetOrder(FLR_TELEMETRY_ORDER_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_GETORDER, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_GETORDER, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29325,7 +29325,7 @@ FLR_RESULT CLIENT_pkgTelemetrySetPackingVC1(const FLR_TELEMETRY_PACKING_E data)
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_SETPACKINGVC1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_SETPACKINGVC1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29347,7 +29347,7 @@ FLR_RESULT CLIENT_pkgTelemetryGetPackingVC1(FLR_TELEMETRY_PACKING_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_GETPACKINGVC1, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_GETPACKINGVC1, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29390,7 +29390,7 @@ FLR_RESULT CLIENT_pkgTelemetrySetMipiEmbeddedDataTag(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_SETMIPIEMBEDDEDDATATAG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_SETMIPIEMBEDDEDDATATAG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29412,7 +29412,7 @@ FLR_RESULT CLIENT_pkgTelemetryGetMipiEmbeddedDataTag(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TELEMETRY_GETMIPIEMBEDDEDDATATAG, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TELEMETRY_GETMIPIEMBEDDEDDATATAG, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29467,7 +29467,7 @@ FLR_RESULT CLIENT_pkgTestrampSetType(const uint8_t index, const FLR_TESTRAMP_TYP
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_SETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_SETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29499,7 +29499,7 @@ FLR_RESULT CLIENT_pkgTestrampGetType(const uint8_t index, FLR_TESTRAMP_TYPE_E *d
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29552,7 +29552,7 @@ FLR_RESULT CLIENT_pkgTestrampSetSettings(const uint8_t index, const FLR_TESTRAMP
         outPtr += 6;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_SETSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_SETSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29584,7 +29584,7 @@ FLR_RESULT CLIENT_pkgTestrampGetSettings(const uint8_t index, FLR_TESTRAMP_SETTI
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29627,7 +29627,7 @@ FLR_RESULT CLIENT_pkgTestrampSetMotionState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_SETMOTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_SETMOTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29649,7 +29649,7 @@ FLR_RESULT CLIENT_pkgTestrampGetMotionState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETMOTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETMOTIONSTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29692,7 +29692,7 @@ FLR_RESULT CLIENT_pkgTestrampSetIndex(const uint8_t data) {
         outPtr += 1;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_SETINDEX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_SETINDEX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29714,7 +29714,7 @@ FLR_RESULT CLIENT_pkgTestrampGetIndex(uint8_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETINDEX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETINDEX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29747,7 +29747,7 @@ FLR_RESULT CLIENT_pkgTestrampGetMaxIndex(uint8_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETMAXINDEX, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETMAXINDEX, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29790,7 +29790,7 @@ FLR_RESULT CLIENT_pkgTestrampSetPN9ContinuousMode(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_SETPN9CONTINUOUSMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_SETPN9CONTINUOUSMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29812,7 +29812,7 @@ FLR_RESULT CLIENT_pkgTestrampGetPN9ContinuousMode(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETPN9CONTINUOUSMODE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETPN9CONTINUOUSMODE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29855,7 +29855,7 @@ FLR_RESULT CLIENT_pkgTestrampSetAnimationSettings(const FLR_TESTRAMP_ANIMATION_S
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_SETANIMATIONSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_SETANIMATIONSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29877,7 +29877,7 @@ FLR_RESULT CLIENT_pkgTestrampGetAnimationSettings(FLR_TESTRAMP_ANIMATION_SETTING
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TESTRAMP_GETANIMATIONSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TESTRAMP_GETANIMATIONSETTINGS, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29922,7 +29922,7 @@ FLR_RESULT CLIENT_pkgTfSetEnableState(const FLR_ENABLE_E data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_SETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29944,7 +29944,7 @@ FLR_RESULT CLIENT_pkgTfGetEnableState(FLR_ENABLE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETENABLESTATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -29987,7 +29987,7 @@ FLR_RESULT CLIENT_pkgTfSetDelta_nf(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_SETDELTA_NF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_SETDELTA_NF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30009,7 +30009,7 @@ FLR_RESULT CLIENT_pkgTfGetDelta_nf(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETDELTA_NF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETDELTA_NF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30052,7 +30052,7 @@ FLR_RESULT CLIENT_pkgTfSetTHDeltaMotion(const uint16_t data) {
         outPtr += 2;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_SETTHDELTAMOTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_SETTHDELTAMOTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30074,7 +30074,7 @@ FLR_RESULT CLIENT_pkgTfGetTHDeltaMotion(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETTHDELTAMOTION, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETTHDELTAMOTION, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30117,7 +30117,7 @@ FLR_RESULT CLIENT_pkgTfSetWLut(const FLR_TF_WLUT_T data) {
         outPtr += 32;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_SETWLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_SETWLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30139,7 +30139,7 @@ FLR_RESULT CLIENT_pkgTfGetWLut(FLR_TF_WLUT_T *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETWLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETWLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30172,7 +30172,7 @@ FLR_RESULT CLIENT_pkgTfGetMotionCount(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETMOTIONCOUNT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETMOTIONCOUNT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30215,7 +30215,7 @@ FLR_RESULT CLIENT_pkgTfSetMotionThreshold(const uint32_t data) {
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_SETMOTIONTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_SETMOTIONTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30237,7 +30237,7 @@ FLR_RESULT CLIENT_pkgTfGetMotionThreshold(uint32_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETMOTIONTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETMOTIONTHRESHOLD, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30270,7 +30270,7 @@ FLR_RESULT CLIENT_pkgTfGetDelta_nfApplied(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETDELTA_NFAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETDELTA_NFAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30303,7 +30303,7 @@ FLR_RESULT CLIENT_pkgTfGetTHDeltaMotionApplied(uint16_t *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETTHDELTAMOTIONAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETTHDELTAMOTIONAPPLIED, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30346,7 +30346,7 @@ FLR_RESULT CLIENT_pkgTfSetTempSignalCompFactorLut(const FLR_TF_TEMP_SIGNAL_COMP_
         outPtr += 34;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_SETTEMPSIGNALCOMPFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_SETTEMPSIGNALCOMPFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30368,7 +30368,7 @@ FLR_RESULT CLIENT_pkgTfGetTempSignalCompFactorLut(FLR_TF_TEMP_SIGNAL_COMP_FACTOR
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETTEMPSIGNALCOMPFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETTEMPSIGNALCOMPFACTORLUT, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30401,7 +30401,7 @@ FLR_RESULT CLIENT_pkgTfGetRnf(uint16_t *rnf) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, TF_GETRNF, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, TF_GETRNF, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30446,7 +30446,7 @@ FLR_RESULT CLIENT_pkgUartSetStartupBaudRate(const FLR_UART_STARTUP_BAUDRATE_E da
         outPtr += 4;
     }
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, UART_SETSTARTUPBAUDRATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, UART_SETSTARTUPBAUDRATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
@@ -30468,7 +30468,7 @@ FLR_RESULT CLIENT_pkgUartGetStartupBaudRate(FLR_UART_STARTUP_BAUDRATE_E *data) {
     uint8_t receiveData[receiveBytes];
     uint8_t *outPtr = (uint8_t *)sendData;
     
-    FLR_RESULT returncode = CLIENT_dispatcher(commandCount++, UART_GETSTARTUPBAUDRATE, sendData, sendBytes, receiveData, &receiveBytes);
+    FLR_RESULT returncode = CLIENT_dispatcher(bosonCtxCurrent()->commandCount++, UART_GETSTARTUPBAUDRATE, sendData, sendBytes, receiveData, &receiveBytes);
     
     // Check for any errorcode
     if((uint32_t) returncode){
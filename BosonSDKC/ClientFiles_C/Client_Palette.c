@@ -0,0 +1,237 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+
+#include <string.h>
+
+#include "Client_Palette.h"
+
+#if defined(__GNUC__)
+#define RESTRICT __restrict__
+#else
+#define RESTRICT
+#endif
+
+typedef struct {
+    uint8_t at;     // table index, rising; the first stop is at 0, the last at 255
+    uint8_t r, g, b;
+} PALETTE_STOP;
+
+// FLR_COLORLUT_WHITEHOT
+static const PALETTE_STOP stopsWhitehot[] = {
+    { 0, 0, 0, 0 }, { 255, 255, 255, 255 }
+};
+
+// FLR_COLORLUT_BLACKHOT
+static const PALETTE_STOP stopsBlackhot[] = {
+    { 0, 255, 255, 255 }, { 255, 0, 0, 0 }
+};
+
+// FLR_COLORLUT_RAINBOW
+static const PALETTE_STOP stopsRainbow[] = {
+    { 0, 0, 0, 128 }, { 48, 0, 0, 255 }, { 96, 0, 255, 255 }, { 144, 0, 255, 0 },
+    { 192, 255, 255, 0 }, { 240, 255, 0, 0 }, { 255, 255, 0, 128 }
+};
+
+// FLR_COLORLUT_RAINBOW_HC: the same hues twice over
+static const PALETTE_STOP stopsRainbowHc[] = {
+    { 0, 0, 0, 64 }, { 24, 0, 0, 255 }, { 48, 0, 255, 255 }, { 72, 0, 255, 0 },
+    { 96, 255, 255, 0 }, { 120, 255, 0, 0 }, { 136, 0, 0, 255 }, { 160, 0, 255, 255 },
+    { 184, 0, 255, 0 }, { 208, 255, 255, 0 }, { 232, 255, 0, 0 }, { 255, 255, 255, 255 }
+};
+
+// FLR_COLORLUT_IRONBOW
+static const PALETTE_STOP stopsIronbow[] = {
+    { 0, 0, 0, 0 }, { 32, 32, 0, 140 }, { 80, 145, 0, 155 }, { 128, 225, 50, 60 },
+    { 176, 250, 140, 0 }, { 224, 255, 215, 40 }, { 255, 255, 255, 245 }
+};
+
+// FLR_COLORLUT_LAVA
+static const PALETTE_STOP stopsLava[] = {
+    { 0, 0, 0, 0 }, { 40, 10, 40, 120 }, { 80, 0, 130, 140 }, { 120, 90, 90, 90 },
+    { 160, 200, 30, 30 }, { 208, 255, 160, 0 }, { 255, 255, 255, 220 }
+};
+
+// FLR_COLORLUT_ARCTIC
+static const PALETTE_STOP stopsArctic[] = {
+    { 0, 0, 0, 40 }, { 64, 0, 60, 190 }, { 128, 60, 170, 240 }, { 176, 190, 90, 150 },
+    { 224, 250, 170, 30 }, { 255, 255, 240, 120 }
+};
+
+// FLR_COLORLUT_GLOBOW
+static const PALETTE_STOP stopsGlobow[] = {
+    { 0, 0, 0, 0 }, { 48, 70, 0, 90 }, { 104, 190, 30, 60 }, { 160, 240, 120, 20 },
+    { 216, 250, 220, 90 }, { 255, 210, 255, 210 }
+};
+
+// FLR_COLORLUT_GRADEDFIRE
+static const PALETTE_STOP stopsGradedfire[] = {
+    { 0, 0, 0, 0 }, { 64, 110, 0, 0 }, { 128, 220, 50, 0 }, { 192, 255, 170, 0 },
+    { 255, 255, 255, 230 }
+};
+
+// FLR_COLORLUT_HOTTEST: white hot, the top of the range in red to yellow
+static const PALETTE_STOP stopsHottest[] = {
+    { 0, 0, 0, 0 }, { 216, 216, 216, 216 }, { 217, 200, 0, 0 }, { 255, 255, 255, 0 }
+};
+
+// FLR_COLORLUT_EMBERGLOW
+static const PALETTE_STOP stopsEmberglow[] = {
+    { 0, 0, 0, 0 }, { 64, 80, 0, 10 }, { 128, 190, 20, 0 }, { 192, 250, 120, 0 },
+    { 232, 255, 210, 80 }, { 255, 255, 255, 255 }
+};
+
+// FLR_COLORLUT_AURORA
+static const PALETTE_STOP stopsAurora[] = {
+    { 0, 0, 0, 0 }, { 48, 20, 0, 90 }, { 96, 0, 90, 170 }, { 144, 0, 190, 120 },
+    { 192, 150, 230, 40 }, { 232, 250, 230, 140 }, { 255, 255, 255, 255 }
+};
+
+#define PALETTE(stops)  { stops, sizeof(stops) / sizeof(stops[0]) }
+
+// Indexed by FLR_COLORLUT_ID_E
+static const struct {
+    const PALETTE_STOP *stops;
+    uint32_t count;
+} paletteStops[] = {
+    PALETTE(stopsWhitehot),
+    PALETTE(stopsBlackhot),
+    PALETTE(stopsRainbow),
+    PALETTE(stopsRainbowHc),
+    PALETTE(stopsIronbow),
+    PALETTE(stopsLava),
+    PALETTE(stopsArctic),
+    PALETTE(stopsGlobow),
+    PALETTE(stopsGradedfire),
+    PALETTE(stopsHottest),
+    PALETTE(stopsEmberglow),
+    PALETTE(stopsAurora),
+};
+
+static uint8_t paletteClamp(int32_t v)
+{
+    return (uint8_t)(v < 0 ? 0 : (v > 255 ? 255 : v));
+}
+
+static void paletteSet(CLIENT_PALETTE *palette, uint32_t i, int32_t r, int32_t g, int32_t b)
+{
+    palette->rgba[i] = (uint32_t)r | (uint32_t)g << 8 | (uint32_t)b << 16 | 0xFF000000u;
+    // BT.601, limited range, like the camera's UYVY
+    palette->y[i] = paletteClamp(16 + ((66 * r + 129 * g + 25 * b + 128) >> 8));
+    palette->u[i] = paletteClamp(128 + ((-38 * r - 74 * g + 112 * b + 128) >> 8));
+    palette->v[i] = paletteClamp(128 + ((112 * r - 94 * g - 18 * b + 128) >> 8));
+}
+
+void CLIENT_paletteFromRgb(const uint8_t *rgb, CLIENT_PALETTE *palette)
+{
+    uint32_t i;
+
+    for (i = 0; i < CLIENT_PALETTE_ENTRIES; i++, rgb += 3)
+        paletteSet(palette, i, rgb[0], rgb[1], rgb[2]);
+}
+
+int32_t CLIENT_paletteBuild(uint32_t colorLutId, CLIENT_PALETTE *palette)
+{
+    const PALETTE_STOP *stops;
+    uint32_t i, s = 0;
+
+    if (colorLutId >= sizeof(paletteStops) / sizeof(paletteStops[0]))
+        return -1;
+    stops = paletteStops[colorLutId].stops;
+    for (i = 0; i < CLIENT_PALETTE_ENTRIES; i++) {
+        const PALETTE_STOP *a, *b;
+        int32_t span, t;
+
+        while (s + 2 < paletteStops[colorLutId].count && i > stops[s + 1].at)
+            s++;
+        a = &stops[s];
+        b = &stops[s + 1];
+        // t/span of the way from a to b, in 1/256ths so rounding is one shift
+        span = b->at - a->at;
+        t = span ? (((int32_t)i - a->at) * 256 + span / 2) / span : 0;
+        paletteSet(palette, i, a->r + (((b->r - a->r) * t + 128) >> 8), a->g + (((b->g - a->g) * t + 128) >> 8),
+                   a->b + (((b->b - a->b) * t + 128) >> 8));
+    }
+    return 0;
+}
+
+void CLIENT_paletteToRgb(const CLIENT_PALETTE *palette, const uint8_t *y8, uint32_t stride,
+                         uint32_t width, uint32_t height, uint8_t *rgb, uint32_t rgbStride)
+{
+    const uint32_t *RESTRICT rgba = palette->rgba;
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++, y8 += stride, rgb += rgbStride) {
+        const uint8_t *RESTRICT in = y8;
+        uint8_t *RESTRICT out = rgb;
+
+        for (x = 0; x < width; x++) {
+            uint32_t c = rgba[in[x]];
+
+            out[3 * x] = (uint8_t)c;
+            out[3 * x + 1] = (uint8_t)(c >> 8);
+            out[3 * x + 2] = (uint8_t)(c >> 16);
+        }
+    }
+}
+
+void CLIENT_paletteToRgba(const CLIENT_PALETTE *palette, const uint8_t *y8, uint32_t stride,
+                          uint32_t width, uint32_t height, uint8_t *rgba, uint32_t rgbaStride)
+{
+    const uint32_t *RESTRICT table = palette->rgba;
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++, y8 += stride, rgba += rgbaStride) {
+        const uint8_t *RESTRICT in = y8;
+        uint8_t *RESTRICT out = rgba;
+
+        // one word per pixel; memcpy keeps unaligned rows legal
+        for (x = 0; x < width; x++)
+            memcpy(out + 4 * x, &table[in[x]], 4);
+    }
+}
+
+void CLIENT_paletteToNv12(const CLIENT_PALETTE *palette, const uint8_t *y8, uint32_t stride,
+                          uint32_t width, uint32_t height, uint8_t *yPlane, uint32_t yStride,
+                          uint8_t *uvPlane, uint32_t uvStride)
+{
+    const uint8_t *RESTRICT ty = palette->y;
+    const uint8_t *RESTRICT tu = palette->u;
+    const uint8_t *RESTRICT tv = palette->v;
+    uint32_t x, y;
+
+    for (y = 0; y < height; y++) {
+        const uint8_t *RESTRICT in = y8 + y * stride;
+        uint8_t *RESTRICT out = yPlane + y * yStride;
+
+        for (x = 0; x < width; x++)
+            out[x] = ty[in[x]];
+    }
+
+    // odd sizes repeat the last row or column
+    for (y = 0; y < height; y += 2) {
+        const uint8_t *RESTRICT top = y8 + y * stride;
+        const uint8_t *RESTRICT bottom = y + 1 < height ? top + stride : top;
+        uint8_t *RESTRICT uv = uvPlane + (y / 2) * uvStride;
+
+        for (x = 0; x < width; x += 2) {
+            uint32_t x1 = x + 1 < width ? x + 1 : x;
+            uint8_t a = top[x], b = top[x1], c = bottom[x], d = bottom[x1];
+
+            uv[x] = (uint8_t)((tu[a] + tu[b] + tu[c] + tu[d] + 2) >> 2);
+            uv[x + 1] = (uint8_t)((tv[a] + tv[b] + tv[c] + tv[d] + 2) >> 2);
+        }
+    }
+}
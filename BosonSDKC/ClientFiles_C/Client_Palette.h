@@ -0,0 +1,71 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+
+#ifndef CLIENT_PALETTE_H
+#define CLIENT_PALETTE_H
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Color palettes applied on the host to the camera's 8-bit stream.
+ *
+ * COLOR (UYVY) carries two bytes per pixel over MIPI only to deliver the
+ * palette; RAW8 with the palette applied here costs half the bandwidth.
+ * Each palette is a 256-entry table, kept as packed RGBA and as BT.601
+ * limited-range Y/U/V, so RGB, RGBA and NV12 output are all lookups.
+ *
+ * The SDK reads back the camera's palette ID (colorLutGetId) but not the
+ * table itself, so CLIENT_paletteBuild() draws each FLR_COLORLUT_ID_E
+ * palette from its color stops: close to the camera's, not identical.
+ * CLIENT_paletteFromRgb() takes an exact table where one is known. With no
+ * SDK dependencies, it builds on its own as "make Palette_64.so" for
+ * BosonSDK/palette.py and the GStreamer bosonpalette element.
+ */
+
+#define CLIENT_PALETTE_ENTRIES  (256)
+
+typedef struct {
+    uint32_t rgba[CLIENT_PALETTE_ENTRIES];  // R in the low byte, alpha 255
+    uint8_t y[CLIENT_PALETTE_ENTRIES];
+    uint8_t u[CLIENT_PALETTE_ENTRIES];
+    uint8_t v[CLIENT_PALETTE_ENTRIES];
+} CLIENT_PALETTE;
+
+// The palette of an FLR_COLORLUT_ID_E value; -1 for an unknown ID
+FLR_EXPORT int32_t CLIENT_paletteBuild(uint32_t colorLutId, CLIENT_PALETTE *palette);
+
+// A palette from 256 R, G, B triplets
+FLR_EXPORT void CLIENT_paletteFromRgb(const uint8_t *rgb, CLIENT_PALETTE *palette);
+
+// Y8 frames to packed RGB (3 bytes per pixel) or RGBA (4). Strides are in bytes
+FLR_EXPORT void CLIENT_paletteToRgb(const CLIENT_PALETTE *palette, const uint8_t *y8, uint32_t stride,
+                                    uint32_t width, uint32_t height, uint8_t *rgb, uint32_t rgbStride);
+FLR_EXPORT void CLIENT_paletteToRgba(const CLIENT_PALETTE *palette, const uint8_t *y8, uint32_t stride,
+                                     uint32_t width, uint32_t height, uint8_t *rgba, uint32_t rgbaStride);
+
+// Y8 frames to NV12: a Y plane and an interleaved U/V plane at half
+// resolution, each chroma sample the mean of its 2x2 pixels
+FLR_EXPORT void CLIENT_paletteToNv12(const CLIENT_PALETTE *palette, const uint8_t *y8, uint32_t stride,
+                                     uint32_t width, uint32_t height, uint8_t *yPlane, uint32_t yStride,
+                                     uint8_t *uvPlane, uint32_t uvStride);
+
+#endif
@@ -0,0 +1,161 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "Client_Pipeline.h"
+#include "Client_Dispatcher.h"
+
+typedef struct {
+    uint32_t seqNum;
+    FLR_FUNCTION fnID;
+    CLIENT_pipelineCallback_t *callback;
+    void *context;
+} PIPELINE_SLOT;
+
+// In-flight commands in send order; the camera answers in the same order
+static PIPELINE_SLOT slots[CLIENT_PIPELINE_MAX_DEPTH];
+static uint32_t slotHead = 0;
+static uint32_t slotCount = 0;
+static uint32_t depthLimit = 4;
+
+// Own range, so stale replies to synchronous CLIENT_pkg* calls never match
+static uint32_t pipelineSeq = 0x80000000;
+
+static uint8_t receiveData[CLIENT_PIPELINE_MAX_DATA];
+
+static void completeSlot(PIPELINE_SLOT *slot, FLR_RESULT result, const uint8_t *data, uint32_t bytes)
+{
+    PIPELINE_SLOT done = *slot;
+
+    // free the slot first, so the callback may submit again
+    slotHead = (slotHead + 1) % CLIENT_PIPELINE_MAX_DEPTH;
+    slotCount--;
+
+    if (done.callback)
+        done.callback(done.context, result, done.fnID, data, bytes);
+}
+
+FLR_RESULT CLIENT_pipelineSetDepth(uint32_t depth)
+{
+    if (depth < 1 || depth > CLIENT_PIPELINE_MAX_DEPTH)
+        return FLR_RANGE_ERROR;
+
+    depthLimit = depth;
+    return R_SUCCESS;
+}
+
+uint32_t CLIENT_pipelineInFlight(void)
+{
+    return slotCount;
+}
+
+FLR_RESULT CLIENT_pipelinePoll(void)
+{
+    uint32_t seqNum = 0;
+    uint32_t fnID = 0;
+    uint32_t receiveBytes = CLIENT_PIPELINE_MAX_DATA;
+    FLR_RESULT res;
+    uint32_t i;
+
+    if (slotCount == 0)
+        return R_SUCCESS;
+
+    res = CLIENT_dispatcher_Rx(&seqNum, &fnID, NULL, 0, receiveData, &receiveBytes);
+
+    if (res == FLR_COMM_ERROR_READING_COMM) {
+        // nothing usable arrived in time: the oldest command is lost
+        completeSlot(&slots[slotHead], FLR_COMM_TIMEOUT_ERROR, NULL, 0);
+        return FLR_COMM_TIMEOUT_ERROR;
+    }
+
+    for (i = 0; i < slotCount; i++) {
+        PIPELINE_SLOT *slot = &slots[(slotHead + i) % CLIENT_PIPELINE_MAX_DEPTH];
+        if (slot->seqNum != seqNum)
+            continue;
+
+        // answers are in order, so anything older was dropped by the camera
+        while (slot != &slots[slotHead])
+            completeSlot(&slots[slotHead], R_SDK_DSPCH_SEQUENCE_MISMATCH, NULL, 0);
+
+        if (res == R_SUCCESS && fnID != (uint32_t) slot->fnID)
+            res = R_SDK_DSPCH_ID_MISMATCH;
+        completeSlot(slot, res, (res == R_SUCCESS) ? receiveData : NULL, (res == R_SUCCESS) ? receiveBytes : 0);
+        return R_SUCCESS;
+    }
+
+    // stale reply to something no longer in flight
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_pipelineSubmit(FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes, CLIENT_pipelineCallback_t *callback, void *context, uint32_t *seqNum)
+{
+    PIPELINE_SLOT *slot;
+    uint32_t dummyBytes = 0;
+    FLR_RESULT res;
+
+    if (sendBytes > CLIENT_PIPELINE_MAX_DATA || (sendBytes && !sendData))
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    while (slotCount >= depthLimit)
+        CLIENT_pipelinePoll();
+
+    slot = &slots[(slotHead + slotCount) % CLIENT_PIPELINE_MAX_DEPTH];
+    slot->seqNum = pipelineSeq++;
+    slot->fnID = fnID;
+    slot->callback = callback;
+    slot->context = context;
+    if (pipelineSeq == 0)
+        pipelineSeq = 0x80000000;
+
+    res = CLIENT_dispatcher_Tx(slot->seqNum, fnID, sendData, sendBytes, NULL, &dummyBytes);
+    if (res != R_SUCCESS)
+        return res;
+
+    if (seqNum)
+        *seqNum = slot->seqNum;
+    slotCount++;
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_pipelineFlush(void)
+{
+    FLR_RESULT first = R_SUCCESS;
+
+    while (slotCount) {
+        FLR_RESULT res = CLIENT_pipelinePoll();
+        if (first == R_SUCCESS)
+            first = res;
+    }
+    return first;
+}
+
+void CLIENT_pipelineFutureCallback(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *data, uint32_t bytes)
+{
+    CLIENT_PIPELINE_FUTURE *future = (CLIENT_PIPELINE_FUTURE *) context;
+
+    future->result = result;
+    future->receiveBytes = bytes;
+    if (bytes)
+        memcpy(future->receiveData, data, bytes);
+    future->done = 1;
+}
+
+FLR_RESULT CLIENT_pipelineWait(CLIENT_PIPELINE_FUTURE *future)
+{
+    while (!future->done && slotCount)
+        CLIENT_pipelinePoll();
+
+    return future->done ? future->result : FLR_ERROR;
+}
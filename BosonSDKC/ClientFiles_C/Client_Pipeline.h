@@ -0,0 +1,71 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CLIENT_PIPELINE_H
+#define CLIENT_PIPELINE_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+#include "FunctionCodes.h"
+#include "Client_Interface.h"
+
+/*
+ * Pipelined command engine on top of CLIENT_dispatcher_Tx/Rx.
+ *
+ * Up to CLIENT_pipelineSetDepth() commands are sent before the first
+ * response is read, so the link never idles waiting for a round trip.
+ * Responses are matched by sequence number and completed through the
+ * submitter's callback. Like CheckServiceDataReady(), all calls belong to
+ * one thread, which must be the only one reading the port. Run
+ * CLIENT_pipelineFlush() before mixing in synchronous CLIENT_pkg* calls.
+ */
+
+#ifndef CLIENT_PIPELINE_MAX_DEPTH
+#define CLIENT_PIPELINE_MAX_DEPTH    (16)
+#endif
+#define CLIENT_PIPELINE_MAX_DATA     (CLIENT_MAX_FRAME_BYTES - 12)  // frame minus 12-byte header
+
+// Called once per command with the camera's result and response data
+typedef void CLIENT_pipelineCallback_t(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *receiveData, uint32_t receiveBytes);
+
+// Completion record for CLIENT_pipelineFutureCallback, zero it before submitting
+typedef struct {
+    volatile uint8_t done;
+    FLR_RESULT result;
+    uint32_t receiveBytes;
+    uint8_t receiveData[CLIENT_PIPELINE_MAX_DATA];
+} CLIENT_PIPELINE_FUTURE;
+
+// Commands in flight before CLIENT_pipelineSubmit waits for a response, 1..CLIENT_PIPELINE_MAX_DEPTH
+FLR_RESULT CLIENT_pipelineSetDepth(uint32_t depth);
+
+// Send a command, completing the oldest one first if the pipeline is full.
+// seqNum (optional) receives the sequence number the command was sent with.
+FLR_RESULT CLIENT_pipelineSubmit(FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes, CLIENT_pipelineCallback_t *callback, void *context, uint32_t *seqNum);
+
+// Read one response and complete its command; R_SUCCESS with nothing in flight is a no-op
+FLR_RESULT CLIENT_pipelinePoll(void);
+
+// Complete every command in flight
+FLR_RESULT CLIENT_pipelineFlush(void);
+
+uint32_t CLIENT_pipelineInFlight(void);
+
+// Callback filling the CLIENT_PIPELINE_FUTURE passed as context
+void CLIENT_pipelineFutureCallback(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *receiveData, uint32_t receiveBytes);
+
+// Poll until the future completes, returns its result
+FLR_RESULT CLIENT_pipelineWait(CLIENT_PIPELINE_FUTURE *future);
+
+#endif // CLIENT_PIPELINE_H
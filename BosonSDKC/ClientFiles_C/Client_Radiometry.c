@@ -0,0 +1,117 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include "Client_Radiometry.h"
+#ifndef RADIOMETRY_KERNEL_ONLY
+#include "Client_API.h"
+#endif
+
+#define COUNTS_MASK  (RADIOMETRY_LUT_ENTRIES - 1)
+
+#if defined(__GNUC__)
+#define RESTRICT __restrict__
+#else
+#define RESTRICT
+#endif
+
+#ifndef RADIOMETRY_KERNEL_ONLY
+FLR_RESULT CLIENT_radiometryBuildLut(FLR_RADIOMETRY_RBFO_TYPE_E rbfoType, uint16_t step, float *lut)
+{
+    uint32_t first, last, i;
+    float tFirst, tLast;
+    FLR_RESULT ret;
+
+    if (!lut)
+        return R_CAM_API_INVALID_INPUT;
+    if (step == 0 || step >= RADIOMETRY_LUT_ENTRIES)
+        step = RADIOMETRY_LUT_STEP;
+
+    ret = radiometryGetTempFromCounts(rbfoType, 0, &tFirst);
+    if (ret != R_SUCCESS)
+        return ret;
+    lut[0] = tFirst;
+    for (first = 0; first < RADIOMETRY_LUT_ENTRIES - 1; first = last, tFirst = tLast) {
+        last = first + step;
+        if (last > RADIOMETRY_LUT_ENTRIES - 1)
+            last = RADIOMETRY_LUT_ENTRIES - 1;
+        ret = radiometryGetTempFromCounts(rbfoType, (uint16_t)last, &tLast);
+        if (ret != R_SUCCESS)
+            return ret;
+        for (i = first + 1; i <= last; i++)
+            lut[i] = tFirst + (tLast - tFirst) * (float)(i - first) / (float)(last - first);
+    }
+    return R_SUCCESS;
+}
+#endif
+
+void CLIENT_radiometryLinearLut(float resolutionK, float offsetK, float *lut)
+{
+    uint32_t i;
+
+    for (i = 0; i < RADIOMETRY_LUT_ENTRIES; i++)
+        lut[i] = offsetK + (float)i * resolutionK;
+}
+
+/*
+ * The gathers themselves stay scalar (NEON has no gather); masking the index
+ * keeps the loop free of bounds branches, and with restrict the index
+ * computation and stores vectorize.
+ */
+void CLIENT_radiometryApplyLut(const float *RESTRICT lut, const uint16_t *RESTRICT counts, uint32_t n,
+                               float *RESTRICT out)
+{
+    uint32_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        out[i] = lut[counts[i] & COUNTS_MASK];
+        out[i + 1] = lut[counts[i + 1] & COUNTS_MASK];
+        out[i + 2] = lut[counts[i + 2] & COUNTS_MASK];
+        out[i + 3] = lut[counts[i + 3] & COUNTS_MASK];
+    }
+    for (; i < n; i++)
+        out[i] = lut[counts[i] & COUNTS_MASK];
+}
+
+void CLIENT_radiometryRoiStats(const float *RESTRICT lut, const uint16_t *RESTRICT counts, uint32_t rowStride,
+                               uint32_t rows, uint32_t cols, RADIOMETRY_ROI_STATS *stats)
+{
+    uint32_t row, col;
+    double sum = 0.0;
+    float minK, maxK;
+
+    if (!stats)
+        return;
+    if (rows == 0 || cols == 0) {
+        stats->minK = stats->maxK = stats->meanK = 0.0f;
+        stats->pixels = 0;
+        return;
+    }
+    minK = maxK = lut[counts[0] & COUNTS_MASK];
+    for (row = 0; row < rows; row++, counts += rowStride) {
+        // a row's sum in float stays exact enough at 640 pixels; rows add up in double
+        float rowSum = 0.0f;
+        for (col = 0; col < cols; col++) {
+            float t = lut[counts[col] & COUNTS_MASK];
+            rowSum += t;
+            minK = t < minK ? t : minK;
+            maxK = t > maxK ? t : maxK;
+        }
+        sum += rowSum;
+    }
+    stats->minK = minK;
+    stats->maxK = maxK;
+    stats->pixels = rows * cols;
+    stats->meanK = (float)(sum / stats->pixels);
+}
@@ -0,0 +1,66 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef CLIENT_RADIOMETRY_H
+#define CLIENT_RADIOMETRY_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+#include "EnumTypes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Counts to temperature through a table with one entry per 14-bit count.
+ *
+ * Build the table once (from the camera's RBFO curve, or linear for TLinear
+ * output), then every pixel costs one lookup. Counts are masked to 14 bits,
+ * so any uint16 frame is safe to pass. Subtract 273.15 from every entry for
+ * a Celsius table. The kernels have no SDK dependencies; with
+ * -DRADIOMETRY_KERNEL_ONLY this file builds on its own (make Radiometry_64.so)
+ * for the Python module BosonSDK/radiometry.py.
+ */
+
+#define RADIOMETRY_LUT_ENTRIES   (16384)
+#define RADIOMETRY_LUT_STEP      (64)   // default counts between camera samples
+
+typedef struct {
+    float minK;
+    float maxK;
+    float meanK;
+    uint32_t pixels;
+} RADIOMETRY_ROI_STATS;
+
+#ifndef RADIOMETRY_KERNEL_ONLY
+// Sample radiometryGetTempFromCounts every step counts (and at the last count)
+// and interpolate linearly in between: 257 camera calls at the default step
+FLR_EXPORT FLR_RESULT CLIENT_radiometryBuildLut(FLR_RADIOMETRY_RBFO_TYPE_E rbfoType, uint16_t step, float *lut);
+#endif
+
+// TLinear output: offsetK + counts * resolutionK
+FLR_EXPORT void CLIENT_radiometryLinearLut(float resolutionK, float offsetK, float *lut);
+
+// out[i] = lut[counts[i]] for n pixels
+FLR_EXPORT void CLIENT_radiometryApplyLut(const float *lut, const uint16_t *counts, uint32_t n, float *out);
+
+// Temperature min/max/mean over rows x cols pixels, rowStride counts apart
+FLR_EXPORT void CLIENT_radiometryRoiStats(const float *lut, const uint16_t *counts, uint32_t rowStride,
+                                          uint32_t rows, uint32_t cols, RADIOMETRY_ROI_STATS *stats);
+
+#endif
@@ -0,0 +1,284 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#include <string.h>
+#ifdef _WIN32
+#include <io.h>
+#include <windows.h>
+#define write _write
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include "Client_Transfer.h"
+#include "Client_Pipeline.h"
+#include "Client_API.h"
+#include "FunctionCodes.h"
+#include "Serializer_BuiltIn.h"
+
+#define MAX_REQUEST_BYTES   (11)
+
+typedef struct {
+    CLIENT_TRANSFER *xfer;
+    FLR_FUNCTION fnID;
+    uint8_t request[MAX_REQUEST_BYTES];     // fixed arguments in front of offset and size
+    uint32_t requestBytes;
+    uint32_t offset;                        // source position of transfer byte 0
+    uint32_t total;
+    uint32_t chunk;
+    uint8_t isFile;                         // fread: no offset argument, reply carries a length
+    uint8_t eof;
+    FLR_RESULT error;
+} TRANSFER_STATE;
+
+static int64_t now_ms(void)
+{
+#ifdef _WIN32
+    return (int64_t) GetTickCount64();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (int64_t) t.tv_sec * 1000 + t.tv_nsec / 1000000;
+#endif
+}
+
+static FLR_RESULT store(CLIENT_TRANSFER *xfer, const uint8_t *data, uint32_t len)
+{
+    if (xfer->buf) {
+        memcpy(xfer->buf + xfer->done, data, len);
+        return R_SUCCESS;
+    }
+
+    while (len) {
+        int n = (int) write(xfer->fd, data, len);
+        if (n <= 0)
+            return FLR_ERROR;
+        data += n;
+        len -= (uint32_t) n;
+    }
+    return R_SUCCESS;
+}
+
+// Replies complete in send order, so each one is the chunk at xfer->done
+static void chunkDone(void *context, FLR_RESULT result, FLR_FUNCTION fnID, const uint8_t *data, uint32_t bytes)
+{
+    TRANSFER_STATE *st = (TRANSFER_STATE *) context;
+    CLIENT_TRANSFER *xfer = st->xfer;
+    uint32_t len = st->total - xfer->done;
+
+    if (st->error != R_SUCCESS || st->eof)
+        return;
+    if (result != R_SUCCESS) {
+        st->error = result;
+        return;
+    }
+
+    if (len > st->chunk)
+        len = st->chunk;
+    if (st->isFile) {
+        uint32_t ret;
+
+        if (bytes < CLIENT_TRANSFER_FILE_CHUNK + 4) {
+            st->error = R_SDK_PKG_BUFFER_OVERFLOW;
+            return;
+        }
+        byteToUINT_32(data + CLIENT_TRANSFER_FILE_CHUNK, &ret);
+        if (ret < len) {
+            len = ret;
+            st->eof = 1;
+        }
+    } else if (bytes < len) {
+        st->error = R_SDK_PKG_BUFFER_OVERFLOW;
+        return;
+    }
+
+    st->error = store(xfer, data, len);
+    if (st->error != R_SUCCESS)
+        return;
+
+    xfer->done += len;
+    if (xfer->progress)
+        xfer->progress(xfer->context, xfer->done, st->total);
+}
+
+static FLR_RESULT run(TRANSFER_STATE *st)
+{
+    uint8_t sendData[MAX_REQUEST_BYTES + 6];
+    uint32_t pos = st->xfer->done;
+    FLR_RESULT res;
+
+    while (pos < st->total && st->error == R_SUCCESS && !st->eof) {
+        uint32_t len = st->total - pos;
+        uint32_t sendBytes = st->requestBytes;
+
+        if (len > st->chunk)
+            len = st->chunk;
+
+        memcpy(sendData, st->request, st->requestBytes);
+        if (st->isFile) {
+            UINT_32ToByte(len, sendData + sendBytes);
+            sendBytes += 4;
+        } else {
+            UINT_32ToByte(st->offset + pos, sendData + sendBytes);
+            UINT_16ToByte((uint16_t) len, sendData + sendBytes + 4);
+            sendBytes += 6;
+        }
+
+        res = CLIENT_pipelineSubmit(st->fnID, sendData, sendBytes, chunkDone, st, NULL);
+        if (res != R_SUCCESS) {
+            CLIENT_pipelineFlush();
+            return res;
+        }
+        pos += len;
+    }
+
+    CLIENT_pipelineFlush();
+    return st->error;
+}
+
+static FLR_RESULT begin(TRANSFER_STATE *st, CLIENT_TRANSFER *xfer, FLR_FUNCTION fnID, uint32_t offset, uint32_t bytes, uint32_t chunk)
+{
+    if (!xfer || (!xfer->buf && xfer->fd < 0))
+        return FLR_BAD_ARG_POINTER_ERROR;
+    if (xfer->done > bytes)
+        return FLR_RANGE_ERROR;
+
+    memset(st, 0, sizeof(*st));
+    st->xfer = xfer;
+    st->fnID = fnID;
+    st->offset = offset;
+    st->total = bytes;
+    st->chunk = chunk;
+    st->error = R_SUCCESS;
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_transferCapture(CLIENT_TRANSFER *xfer, uint8_t bufferNum, uint32_t offset, uint32_t bytes)
+{
+    TRANSFER_STATE st;
+    FLR_RESULT res = begin(&st, xfer, MEM_READCAPTURE, offset, bytes, CLIENT_TRANSFER_MEM_CHUNK);
+
+    if (res != R_SUCCESS)
+        return res;
+
+    UCHARToByte(bufferNum, st.request);
+    st.requestBytes = 1;
+    return run(&st);
+}
+
+FLR_RESULT CLIENT_transferFlash(CLIENT_TRANSFER *xfer, FLR_MEM_LOCATION_E location, uint8_t index, uint32_t offset, uint32_t bytes)
+{
+    TRANSFER_STATE st;
+    FLR_RESULT res = begin(&st, xfer, MEM_READFLASH, offset, bytes, CLIENT_TRANSFER_MEM_CHUNK);
+
+    if (res != R_SUCCESS)
+        return res;
+
+    INT_32ToByte((int32_t) location, st.request);
+    UCHARToByte(index, st.request + 4);
+    st.requestBytes = 5;
+    return run(&st);
+}
+
+FLR_RESULT CLIENT_transferFile(CLIENT_TRANSFER *xfer, uint32_t id, uint32_t offset, uint32_t bytes)
+{
+    TRANSFER_STATE st;
+    FLR_RESULT res = begin(&st, xfer, FILEOPS_FREAD, offset, bytes, CLIENT_TRANSFER_FILE_CHUNK);
+
+    if (res != R_SUCCESS)
+        return res;
+
+    // freads run back to back from the file position, so resume by seeking
+    CLIENT_pipelineFlush();
+    res = fileOpsFseek(id, offset + xfer->done, 0);
+    if (res != R_SUCCESS)
+        return res;
+
+    UINT_32ToByte(id, st.request);
+    st.requestBytes = 4;
+    st.isFile = 1;
+    return run(&st);
+}
+
+FLR_RESULT CLIENT_transferSingleFrame(CLIENT_TRANSFER *xfer, uint32_t bufBytes, uint32_t *bytes)
+{
+    uint32_t size;
+    uint16_t rows, columns;
+    FLR_RESULT res;
+
+    if (!xfer)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    CLIENT_pipelineFlush();
+    if (!xfer->done) {
+        res = captureSingleFrame();
+        if (res != R_SUCCESS)
+            return res;
+    }
+    res = memGetCaptureSize(&size, &rows, &columns);
+    if (res != R_SUCCESS)
+        return res;
+    if (bytes)
+        *bytes = size;
+    if (xfer->buf && size > bufBytes)
+        return FLR_RANGE_ERROR;
+
+    return CLIENT_transferCapture(xfer, 0, 0, size);
+}
+
+FLR_RESULT CLIENT_transferSnapshot(CLIENT_TRANSFER *xfer, FLR_CAPTURE_SRC_E src, uint32_t bufBytes, uint32_t *bytes,
+                                   uint16_t *rows, uint16_t *columns)
+{
+    FLR_CAPTURE_STATUS_T status;
+    uint32_t size;
+    uint16_t r, c;
+    int64_t deadline;
+    FLR_RESULT res;
+
+    if (!xfer)
+        return FLR_BAD_ARG_POINTER_ERROR;
+
+    CLIENT_pipelineFlush();
+    if (!xfer->done) {
+        res = captureSingleFrameWithSrc(src);
+        if (res != R_SUCCESS)
+            return res;
+
+        // Each poll is a round trip, so the camera is not hammered
+        deadline = now_ms() + CLIENT_TRANSFER_SNAPSHOT_TIMEOUT_MS;
+        do {
+            res = captureGetStatus(&status);
+            if (res != R_SUCCESS)
+                return res;
+        } while (status.state == FLR_CAPTURE_IN_PROGRESS && now_ms() < deadline);
+        if (status.state == FLR_CAPTURE_IN_PROGRESS)
+            return FLR_COMM_TIMEOUT_ERROR;
+        if (status.result != R_SUCCESS)
+            return (FLR_RESULT) status.result;
+    }
+    res = memGetCaptureSize(&size, &r, &c);
+    if (res != R_SUCCESS)
+        return res;
+    if (bytes)
+        *bytes = size;
+    if (rows)
+        *rows = r;
+    if (columns)
+        *columns = c;
+    if (xfer->buf && size > bufBytes)
+        return FLR_RANGE_ERROR;
+
+    return CLIENT_transferCapture(xfer, 0, 0, size);
+}
@@ -0,0 +1,79 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CLIENT_TRANSFER_H
+#define CLIENT_TRANSFER_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+#include "EnumTypes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Streaming downloads of capture buffers, flash regions and camera files.
+ *
+ * The transfer is cut into the largest chunk the command allows and the
+ * requests are kept in flight through Client_Pipeline, so the next chunk is
+ * on its way while the previous one is stored. Same threading rules as
+ * Client_Pipeline; the pipeline is flushed before every call returns.
+ *
+ * xfer->done is the resume point: zero it to start. After a link error it
+ * holds the bytes stored so far, and calling again with the same arguments
+ * continues from there.
+ */
+
+#define CLIENT_TRANSFER_MEM_CHUNK   (256)   // bytes per MEM_READCAPTURE / MEM_READFLASH
+#define CLIENT_TRANSFER_FILE_CHUNK  (128)   // bytes per FILEOPS_FREAD
+
+// Called after every stored chunk
+typedef void CLIENT_transferProgress_t(void *context, uint32_t done, uint32_t total);
+
+typedef struct {
+    uint8_t *buf;                           // destination, byte n of the transfer lands in buf[n]
+    int fd;                                 // written sequentially when buf is NULL
+    CLIENT_transferProgress_t *progress;    // optional
+    void *context;                          // passed to progress
+    uint32_t done;                          // bytes stored, resume point
+} CLIENT_TRANSFER;
+
+// bytes of capture buffer bufferNum, starting at offset
+FLR_EXPORT FLR_RESULT CLIENT_transferCapture(CLIENT_TRANSFER *xfer, uint8_t bufferNum, uint32_t offset, uint32_t bytes);
+
+// bytes of flash region location/index, starting at offset
+FLR_EXPORT FLR_RESULT CLIENT_transferFlash(CLIENT_TRANSFER *xfer, FLR_MEM_LOCATION_E location, uint8_t index, uint32_t offset, uint32_t bytes);
+
+// Up to bytes of open camera file id, starting at offset; a short file ends
+// the transfer early with R_SUCCESS, xfer->done tells how much there was
+FLR_EXPORT FLR_RESULT CLIENT_transferFile(CLIENT_TRANSFER *xfer, uint32_t id, uint32_t offset, uint32_t bytes);
+
+// Capture one frame into buffer 0 and download all of it, bufBytes limits
+// xfer->buf (ignored for fd). A resumed call (xfer->done != 0) doesn't
+// capture again. bytes (optional) receives the capture size.
+FLR_EXPORT FLR_RESULT CLIENT_transferSingleFrame(CLIENT_TRANSFER *xfer, uint32_t bufBytes, uint32_t *bytes);
+
+#define CLIENT_TRANSFER_SNAPSHOT_TIMEOUT_MS (2000)  // capture still in progress after this fails
+
+// CLIENT_transferSingleFrame() for one frame taken from src, e.g.
+// FLR_CAPTURE_SRC_NUC for pre-AGC 14-bit counts while the video stays 8-bit.
+// The video output keeps its format; CAPTURE_GETSTATUS is polled until the
+// camera has the frame. rows and columns are optional.
+FLR_EXPORT FLR_RESULT CLIENT_transferSnapshot(CLIENT_TRANSFER *xfer, FLR_CAPTURE_SRC_E src, uint32_t bufBytes, uint32_t *bytes,
+                                              uint16_t *rows, uint16_t *columns);
+
+#endif // CLIENT_TRANSFER_H
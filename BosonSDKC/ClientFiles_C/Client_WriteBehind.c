@@ -0,0 +1,245 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#include <stdlib.h>
+#include <string.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "Client_WriteBehind.h"
+#include "Client_Context.h"
+#include "Client_Dispatcher.h"
+
+typedef struct {
+    FLR_FUNCTION setFn;
+    FLR_FUNCTION getFn;
+    uint8_t held;
+    uint32_t bytes;
+    uint8_t data[CLIENT_WRITE_BEHIND_MAX_DATA];
+    int64_t lastSent;         // ms
+} WRITE_BEHIND_SETTER;
+
+struct boson_write_behind {
+    WRITE_BEHIND_SETTER setters[CLIENT_WRITE_BEHIND_MAX_SETTERS];
+    uint32_t count;
+    uint32_t held;            // setters with a kept value
+    uint32_t periodMs;
+    uint8_t sending;          // kept values are on their way, don't hold them again
+    uint32_t coalesced;
+    uint32_t deferred;
+    FLR_RESULT lastError;
+};
+
+static int64_t now_ms(void)
+{
+#ifdef _WIN32
+    return (int64_t) GetTickCount64();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (int64_t) t.tv_sec * 1000 + t.tv_nsec / 1000000;
+#endif
+}
+
+static WRITE_BEHIND_SETTER *find_setter(struct boson_write_behind *wb, FLR_FUNCTION setFn)
+{
+    uint32_t i;
+
+    for (i = 0; i < wb->count; i++) {
+        if (wb->setters[i].setFn == setFn)
+            return &wb->setters[i];
+    }
+    return NULL;
+}
+
+static FLR_RESULT send_held(struct boson_write_behind *wb, WRITE_BEHIND_SETTER *s)
+{
+    boson_ctx_t *ctx = bosonCtxCurrent();
+    uint8_t receiveData[1];
+    uint32_t receiveBytes = 1;
+    FLR_RESULT res;
+
+    s->held = 0;
+    wb->held--;
+    s->lastSent = now_ms();
+
+    wb->sending = 1;
+    res = CLIENT_dispatcher(ctx->commandCount++, s->setFn, s->data, s->bytes, receiveData, &receiveBytes);
+    wb->sending = 0;
+
+    wb->deferred++;
+    if (res != R_SUCCESS)
+        wb->lastError = res;
+    return res;
+}
+
+// Send kept values, only those that are due unless all is set
+static FLR_RESULT send_due(struct boson_write_behind *wb, int all)
+{
+    FLR_RESULT ret = R_SUCCESS;
+    int64_t now;
+    uint32_t i;
+
+    if (!wb->held)
+        return R_SUCCESS;
+
+    now = now_ms();
+    for (i = 0; i < wb->count; i++) {
+        WRITE_BEHIND_SETTER *s = &wb->setters[i];
+        FLR_RESULT res;
+
+        if (!s->held || (!all && now < s->lastSent + wb->periodMs))
+            continue;
+        res = send_held(wb, s);
+        if (res != R_SUCCESS && ret == R_SUCCESS)
+            ret = res;
+    }
+    return ret;
+}
+
+FLR_RESULT CLIENT_writeBehindEnable(FLR_FUNCTION setFn, FLR_FUNCTION getFn)
+{
+    boson_ctx_t *ctx = bosonCtxCurrent();
+    struct boson_write_behind *wb;
+    WRITE_BEHIND_SETTER *s;
+
+    if (!ctx->writeBehind) {
+        ctx->writeBehind = (struct boson_write_behind *) calloc(1, sizeof(struct boson_write_behind));
+        if (!ctx->writeBehind)
+            return FLR_ERROR;
+        ctx->writeBehind->periodMs = CLIENT_WRITE_BEHIND_PERIOD;
+    }
+    wb = ctx->writeBehind;
+
+    s = find_setter(wb, setFn);
+    if (!s) {
+        if (wb->count == CLIENT_WRITE_BEHIND_MAX_SETTERS)
+            return FLR_RANGE_ERROR;
+        s = &wb->setters[wb->count++];
+        memset(s, 0, sizeof(*s));
+        s->setFn = setFn;
+    }
+    s->getFn = getFn;
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_writeBehindDisable(FLR_FUNCTION setFn)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+    WRITE_BEHIND_SETTER *s;
+    FLR_RESULT res = R_SUCCESS;
+
+    if (!wb || !(s = find_setter(wb, setFn)))
+        return R_SUCCESS;
+
+    if (s->held)
+        res = send_held(wb, s);
+    *s = wb->setters[--wb->count];
+    return res;
+}
+
+FLR_RESULT CLIENT_writeBehindSetPeriod(uint32_t periodMs)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+
+    if (!wb)
+        return FLR_ERROR;   // enable a setter first
+    wb->periodMs = periodMs;
+    return R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_writeBehindPoll(void)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+
+    return wb ? send_due(wb, 0) : R_SUCCESS;
+}
+
+FLR_RESULT CLIENT_writeBehindFlush(void)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+
+    return wb ? send_due(wb, 1) : R_SUCCESS;
+}
+
+int32_t CLIENT_writeBehindTimeout(void)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+    int64_t next = INT64_MAX, left;
+    uint32_t i;
+
+    if (!wb || !wb->held)
+        return -1;
+    for (i = 0; i < wb->count; i++) {
+        if (wb->setters[i].held && wb->setters[i].lastSent + wb->periodMs < next)
+            next = wb->setters[i].lastSent + wb->periodMs;
+    }
+    left = next - now_ms();
+    return (left > 0) ? (int32_t) left : 0;
+}
+
+void CLIENT_writeBehindStats(uint32_t *coalesced, uint32_t *deferred, FLR_RESULT *lastError)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+
+    if (coalesced)
+        *coalesced = wb ? wb->coalesced : 0;
+    if (deferred)
+        *deferred = wb ? wb->deferred : 0;
+    if (lastError)
+        *lastError = wb ? wb->lastError : R_SUCCESS;
+}
+
+int CLIENT_writeBehindHold(FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes, FLR_RESULT *res)
+{
+    struct boson_write_behind *wb = bosonCtxCurrent()->writeBehind;
+    WRITE_BEHIND_SETTER *s;
+    uint32_t i;
+
+    if (!wb || wb->sending)
+        return 0;
+
+    s = find_setter(wb, fnID);
+    if (s && sendBytes <= CLIENT_WRITE_BEHIND_MAX_DATA) {
+        if (s->held || now_ms() < s->lastSent + wb->periodMs) {
+            if (s->held)
+                wb->coalesced++;
+            else
+                wb->held++;
+            s->held = 1;
+            s->bytes = sendBytes;
+            memcpy(s->data, sendData, sendBytes);
+            *res = R_SUCCESS;
+            send_due(wb, 0);
+            return 1;
+        }
+        // quiet long enough: this one goes out now and starts the period
+        s->lastSent = now_ms();
+    } else if (s && s->held) {
+        // too big to keep, but must not be overtaken by the older value
+        send_held(wb, s);
+    }
+
+    // a read of a held setting must see the kept value
+    for (i = 0; i < wb->count; i++) {
+        if (wb->setters[i].held && wb->setters[i].getFn == fnID)
+            send_held(wb, &wb->setters[i]);
+    }
+    send_due(wb, 0);
+    return 0;
+}
@@ -0,0 +1,76 @@
+/******************************************************************************/
+/*                                                                            */
+/*  Copyright (C) 2018, FLIR Systems                                          */
+/*  All rights reserved.                                                      */
+/*                                                                            */
+/*  This document is controlled to FLIR Technology Level 2. The information   */
+/*  contained in this document pertains to a dual use product controlled for  */
+/*  export by the Export Administration Regulations (EAR). Diversion contrary */
+/*  to US law is prohibited. US Department of Commerce authorization is not   */
+/*  required prior to export or transfer to foreign persons or parties unless */
+/*  otherwise prohibited.                                                     */
+/*                                                                            */
+/******************************************************************************/
+
+
+#ifndef CLIENT_WRITE_BEHIND_H
+#define CLIENT_WRITE_BEHIND_H
+
+#include <stdint.h>
+#include "ReturnCodes.h"
+#include "FunctionCodes.h"
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * Write-behind for setters driven at high rates, e.g. from a slider.
+ *
+ * Once a setter is enabled, the synchronous call (CLIENT_pkgAgcSetBrightness
+ * etc.) goes straight out if that setter was not sent within the last
+ * period; otherwise its value is kept and the call returns R_SUCCESS at once.
+ * A later call replaces the kept value, so only the newest one is sent when
+ * the period is up. Kept values go out from any later API call on the same
+ * context, from CLIENT_writeBehindPoll() and CLIENT_writeBehindFlush(), and
+ * before a call to the setter's get function, so reads see what was set.
+ *
+ * Only use it for setters where the last value is all that matters. Errors
+ * of deferred writes come back from Poll/Flush and CLIENT_writeBehindStats().
+ * State is per context (Client_Context.h); flush before Close(). Pipelined
+ * and event-loop commands are never held.
+ */
+
+#define CLIENT_WRITE_BEHIND_MAX_SETTERS  (16)
+#define CLIENT_WRITE_BEHIND_MAX_DATA     (32)   // larger values are always sent directly
+#define CLIENT_WRITE_BEHIND_PERIOD       (50)   // default ms between writes of one setter
+
+// Hold writes of setFn; getFn (0 for none) flushes it before reading
+FLR_EXPORT FLR_RESULT CLIENT_writeBehindEnable(FLR_FUNCTION setFn, FLR_FUNCTION getFn);
+
+// Send setFn's kept value, if any, and stop holding it
+FLR_EXPORT FLR_RESULT CLIENT_writeBehindDisable(FLR_FUNCTION setFn);
+
+// Least ms between two writes of one setter; 0 sends every write
+FLR_EXPORT FLR_RESULT CLIENT_writeBehindSetPeriod(uint32_t periodMs);
+
+// Send kept values whose period is up
+FLR_EXPORT FLR_RESULT CLIENT_writeBehindPoll(void);
+
+// Send all kept values now
+FLR_EXPORT FLR_RESULT CLIENT_writeBehindFlush(void);
+
+// ms until CLIENT_writeBehindPoll() has something to send, -1 with nothing kept
+FLR_EXPORT int32_t CLIENT_writeBehindTimeout(void);
+
+// coalesced: writes replaced before they were sent; deferred: kept writes
+// sent later; lastError: of the last deferred write that failed. Any may be NULL.
+FLR_EXPORT void CLIENT_writeBehindStats(uint32_t *coalesced, uint32_t *deferred, FLR_RESULT *lastError);
+
+// Called by CLIENT_dispatcher(): nonzero when the command was kept instead
+// of sent, *res then holds the call's result
+int CLIENT_writeBehindHold(FLR_FUNCTION fnID, const uint8_t *sendData, uint32_t sendBytes, FLR_RESULT *res);
+
+#endif // CLIENT_WRITE_BEHIND_H
@@ -22,54 +22,58 @@ extern FLR_RESULT I2C_write(uint8_t* writeData, uint32_t writeBytes);
 
 static uint8_t frameHead[I2C_SLAVE_CP_FRAME_HEAD_SIZE] = {0x8E, 0xA1};
 
-static void addToShiftBuffer(uint8_t* buffer, uint32_t bufferSize, uint8_t value)
+// Offset of the first byte that can start a frame head: a full head, or
+// its first byte at the very end of buffer
+static uint32_t findFrameHead(const uint8_t* buffer, uint32_t bufferSize)
 {
-    for(uint32_t index = 0; index < (bufferSize - 1); ++index)
+    uint32_t index;
+
+    for(index = 0; index < bufferSize; ++index)
     {
-        buffer[index] = buffer[index + 1];
+        if(buffer[index] == frameHead[0] &&
+           (index + 1 == bufferSize || buffer[index + 1] == frameHead[1]))
+        {
+            break;
+        }
     }
-    buffer[bufferSize - 1] = value;
+    return index;
 }
 
 FLR_RESULT I2C_readFrame(uint8_t* readData, uint32_t* readBytes)
 {
-    bool frameNotReady = true, headerFound = false;
-    uint8_t retByte;
-    uint8_t* readBuffer;
-    uint32_t bytesNumber, readSize;
     uint8_t headerBuffer[I2C_SLAVE_CP_FRAME_HEADER_SIZE];
+    uint32_t bytesNumber, haveBytes = 0, headOffset;
 
     if(readData == NULL || readBytes == NULL)
     {
         return FLR_BAD_ARG_POINTER_ERROR;
     }
 
-    readBuffer = &retByte;
-    readSize = 1;
+    // Whole header in one read; after a desync keep the bytes from the
+    // first possible frame head on and read only what is missing
     do
     {
-        if(I2C_read(readBuffer, readSize) != FLR_OK)
+        if(I2C_read(&headerBuffer[haveBytes], I2C_SLAVE_CP_FRAME_HEADER_SIZE - haveBytes) != FLR_OK)
         {
             return FLR_COMM_ERROR_READING_COMM;
         }
 
-        if(headerFound)
-        {
-            *readBytes = readSize;
-            frameNotReady = false;
-        }
-        else
+        headOffset = findFrameHead(headerBuffer, I2C_SLAVE_CP_FRAME_HEADER_SIZE);
+        haveBytes = I2C_SLAVE_CP_FRAME_HEADER_SIZE - headOffset;
+        if(headOffset > 0)
         {
-            addToShiftBuffer(headerBuffer, I2C_SLAVE_CP_FRAME_HEADER_SIZE, retByte);
-            if(memcmp(headerBuffer, frameHead, I2C_SLAVE_CP_FRAME_HEAD_SIZE) == 0)
-            {
-                bytesNumber = ((uint32_t)headerBuffer[I2C_SLAVE_CP_FRAME_HEAD_SIZE]) << 8 | (uint32_t)headerBuffer[I2C_SLAVE_CP_FRAME_HEAD_SIZE + 1];
-                readSize = bytesNumber;
-                readBuffer = readData;
-                headerFound = true;
-            }
+            memmove(headerBuffer, &headerBuffer[headOffset], haveBytes);
         }
-    } while(frameNotReady);
+    } while(headOffset > 0);
+
+    bytesNumber = ((uint32_t)headerBuffer[I2C_SLAVE_CP_FRAME_HEAD_SIZE]) << 8 | (uint32_t)headerBuffer[I2C_SLAVE_CP_FRAME_HEAD_SIZE + 1];
+
+    // Payload in one more
+    if(bytesNumber > 0 && I2C_read(readData, bytesNumber) != FLR_OK)
+    {
+        return FLR_COMM_ERROR_READING_COMM;
+    }
+    *readBytes = bytesNumber;
 
     return FLR_OK;
 }
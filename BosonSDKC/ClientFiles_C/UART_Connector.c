@@ -13,14 +13,12 @@
 /*                                                                            */
 /******************************************************************************/
 
+#include <stdlib.h>
 #include "UART_Connector.h"
-
-static uint8_t isInitialized = 0;
-static int myPort = 0;
-
-/* Defaults to 1000ms, can be increased by the user for any commands that take
-   longer to respond... */
-static int readTimeout = 1000;
+#include "Client_Context.h"
+#include "Client_API.h"
+#include "Client_FslpLog.h"
+#include "Client_GetterCache.h"
 
 #ifdef _WIN32
 #define FLR_IMPORT __declspec( dllimport )
@@ -30,38 +28,115 @@ static int readTimeout = 1000;
 
 FLR_RESULT Initialize(int32_t port_num, int32_t baud_rate)
 {
-	if (isInitialized) return R_UART_PORT_ALREADY_OPEN;
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	if (ctx->isInitialized) return R_UART_PORT_ALREADY_OPEN;
 
-	myPort = port_num;
+	ctx->port = port_num;
 
 	FLR_IMPORT uint8_t FSLP_open_port(int32_t port_num, int32_t baud_rate);
-	if (FSLP_open_port(myPort, baud_rate)) return R_UART_PORT_FAILURE;
+	if (FSLP_open_port(ctx->port, baud_rate)) return R_UART_PORT_FAILURE;
+
+	ctx->baudRate = baud_rate;
+	ctx->isInitialized = 1;
+	CLIENT_getterCacheFlush(); // may be another camera on the port
 
-	isInitialized = 1;
+	// BOSON_FSLP_LOG=path records the session (Client_FslpLog.h)
+	if (!ctx->fslpLog && getenv("BOSON_FSLP_LOG"))
+		CLIENT_fslpLogOpen(getenv("BOSON_FSLP_LOG"));
 	return FLR_COMM_OK; // 0 == success.
 }
 
+FLR_RESULT BaudRateSet(int32_t baud_rate)
+{
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	if (!ctx->isInitialized) return R_UART_UNSPECIFIED_FAILURE;
+
+	FLR_IMPORT uint8_t FSLP_set_baud_rate(int32_t port_id, int32_t baud_rate);
+	if (FSLP_set_baud_rate(ctx->port, baud_rate)) return R_UART_PORT_FAILURE;
+
+	ctx->baudRate = baud_rate;
+	return FLR_COMM_OK;
+}
+
+/* Rates the Boson can start up at (FLR_UART_STARTUP_BAUDRATE_E), fastest first.
+   The camera's rate only changes at boot, so the host follows the camera. */
+static const int32_t startupRates[] = { 921600, 460800, 230400, 115200, 57600 };
+
+/* A wrong rate only shows as silence or garbage, so don't wait long for it */
+#define PROBE_TIMEOUT_MS (200)
+
+FLR_RESULT InitializeAuto(int32_t port_num, const int32_t *baudRates, uint32_t numRates, int32_t *baud_rate)
+{
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	int32_t savedTimeout = ctx->readTimeout;
+	FLR_RESULT res;
+	uint32_t serial;
+	uint32_t i;
+
+	if (!baudRates || !numRates) {
+		baudRates = startupRates;
+		numRates = sizeof(startupRates) / sizeof(startupRates[0]);
+	}
+
+	res = Initialize(port_num, baudRates[0]);
+	if (res != FLR_COMM_OK) return res;
+
+	ctx->readTimeout = PROBE_TIMEOUT_MS;
+	res = R_UART_PORT_FAILURE;
+	for (i = 0; i < numRates; i++) {
+		if (i && BaudRateSet(baudRates[i]) != FLR_COMM_OK)
+			continue; // host can't do this rate
+		res = bosonGetCameraSN(&serial);
+		if (res == R_SUCCESS)
+			break;
+	}
+	ctx->readTimeout = savedTimeout;
+
+	if (res != R_SUCCESS) {
+		Close();
+		return res;
+	}
+	if (baud_rate) *baud_rate = ctx->baudRate;
+	ThroughputReset();
+	return R_SUCCESS;
+}
+
 void Close()
 {
+	boson_ctx_t *ctx = bosonCtxCurrent();
 	FLR_IMPORT void FSLP_close_port(int32_t port_num);
-	FSLP_close_port((int32_t) myPort);
-	isInitialized = 0;
-	myPort = 0;
+	FSLP_close_port(ctx->port);
+	CLIENT_getterCacheFlush();
+	ctx->isInitialized = 0;
+	ctx->port = 0;
+	ctx->baudRate = 0;
 }
 
 void SendToCamera( uint8_t channelID,  uint32_t sendBytes, uint8_t *sendData)
 {
-	if (!isInitialized) return;
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	if (!ctx->isInitialized) return;
 
 	FLR_IMPORT void FSLP_send_to_camera(int32_t port_num, uint8_t channel_ID, uint32_t sendBytes, uint8_t *sendPayload);
-	FSLP_send_to_camera( (int32_t) myPort, channelID, sendBytes, sendData);
+	FSLP_send_to_camera( ctx->port, channelID, sendBytes, sendData);
+}
+
+void SendToCameraV( uint8_t channelID, const CLIENT_SEGMENT *segments, uint32_t numSegments)
+{
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	if (!ctx->isInitialized) return;
+
+	// CLIENT_SEGMENT has the layout of the library's FSLP_SEGMENT
+	FLR_IMPORT void FSLP_send_to_camera_v(int32_t port_num, uint8_t channel_ID, const CLIENT_SEGMENT *segments, uint32_t num_segments);
+	FSLP_send_to_camera_v( ctx->port, channelID, segments, numSegments);
 }
 
 
 void ReadFrame(uint8_t channelID, uint32_t *receiveBytes, uint8_t *receiveData)
 {
+	boson_ctx_t *ctx = bosonCtxCurrent();
 	FLR_IMPORT void FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte_ms,uint32_t *receiveBytes, uint8_t *receiveBuffer);
-	FSLP_read_frame((int32_t) myPort, channelID, readTimeout, receiveBytes, receiveData);
+	FSLP_read_frame(ctx->port, channelID, ctx->readTimeout, receiveBytes, receiveData);
 }
 
 
@@ -69,16 +144,60 @@ void ReadUnframed(uint32_t *receiveBytes, uint8_t *receiveData)
 {
 	FLR_IMPORT void FSLP_read_unframed(int32_t port_num, uint16_t start_byte_ms,uint32_t *receiveBytes, uint8_t *receiveBuffer);
 	// hardcoded 25ms polling delay for now
-	FSLP_read_unframed((int32_t)myPort, 25, receiveBytes,receiveData);
+	FSLP_read_unframed(bosonCtxCurrent()->port, 25, receiveBytes,receiveData);
 }
 
 void ReadTimeoutSet(unsigned int timeout)
 {
-	readTimeout = timeout;
+	bosonCtxCurrent()->readTimeout = timeout;
 }
 
 int32_t CheckDataReady(uint8_t *channel_ID, uint32_t *receiveBytes, const uint8_t **receiveData)
 {
         FLR_IMPORT int32_t FSLP_check_data_ready(int32_t port_num, uint8_t *channel_ID, uint16_t start_byte_ms, uint32_t *receiveBytes, const uint8_t **receiveBuffer);
-        return FSLP_check_data_ready((int32_t) myPort, channel_ID, readTimeout, receiveBytes, receiveData);
+        boson_ctx_t *ctx = bosonCtxCurrent();
+        return FSLP_check_data_ready(ctx->port, channel_ID, ctx->readTimeout, receiveBytes, receiveData);
+}
+
+int64_t StartByteNs(void)
+{
+	FLR_IMPORT int64_t FSLP_get_start_byte_ns(int32_t port_num);
+	return FSLP_get_start_byte_ns(bosonCtxCurrent()->port);
+}
+
+void ThroughputGet(uint64_t *bytes, double *bytesPerSec)
+{
+	uint64_t tx = 0, rx = 0;
+	double seconds = 0;
+
+	FLR_IMPORT void FSLP_get_port_stats(int32_t port_id, uint64_t *tx_bytes, uint64_t *rx_bytes, double *seconds);
+	if (bosonCtxCurrent()->isInitialized)
+		FSLP_get_port_stats(bosonCtxCurrent()->port, &tx, &rx, &seconds);
+
+	if (bytes) *bytes = tx + rx;
+	if (bytesPerSec) *bytesPerSec = (seconds > 0) ? (tx + rx) / seconds : 0;
+}
+
+void ThroughputReset(void)
+{
+	FLR_IMPORT void FSLP_reset_port_stats(int32_t port_id);
+	if (bosonCtxCurrent()->isInitialized)
+		FSLP_reset_port_stats(bosonCtxCurrent()->port);
+}
+
+int32_t PortFdGet(void)
+{
+	FLR_IMPORT int32_t FSLP_get_port_fd(int32_t port_id);
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	if (!ctx->isInitialized) return -1;
+	return FSLP_get_port_fd(ctx->port);
+}
+
+int32_t PumpFrames(CLIENT_frameCallback_t *callback, void *context)
+{
+	// CLIENT_frameCallback_t has the signature of the library's FSLP_frame_callback_t
+	FLR_IMPORT int32_t FSLP_pump(int32_t port_num, CLIENT_frameCallback_t *callback, void *context);
+	boson_ctx_t *ctx = bosonCtxCurrent();
+	if (!ctx->isInitialized) return -1;
+	return FSLP_pump(ctx->port, callback, context);
 }
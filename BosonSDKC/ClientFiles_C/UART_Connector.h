@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include "ReturnCodes.h"
+#include "Client_Interface.h"
 
 #ifdef _WIN32
 #define FLR_EXPORT __declspec(dllexport)
@@ -26,11 +27,34 @@
 
 FLR_EXPORT void ReadTimeoutSet(unsigned int timeout);
 FLR_EXPORT void SendToCamera( uint8_t channelID,  uint32_t sendBytes, uint8_t *sendData);
+FLR_EXPORT void SendToCameraV( uint8_t channelID, const CLIENT_SEGMENT *segments, uint32_t numSegments);
 FLR_EXPORT void ReadFrame( uint8_t channelID, uint32_t *receiveBytes, uint8_t *receiveData);
 FLR_EXPORT void ReadUnframed(uint32_t *receiveBytes, uint8_t *receiveData);
 FLR_EXPORT FLR_RESULT Initialize(int32_t port_num, int32_t baud_rate);
 FLR_EXPORT void Close(void);
 
+// Open port_num at the fastest of baudRates (highest first) the camera answers on,
+// NULL/0 for the Boson startup rates. baud_rate (optional) receives the rate found.
+FLR_EXPORT FLR_RESULT InitializeAuto(int32_t port_num, const int32_t *baudRates, uint32_t numRates, int32_t *baud_rate);
+// Change the host side rate of the open port; the camera must already run at baud_rate
+FLR_EXPORT FLR_RESULT BaudRateSet(int32_t baud_rate);
+
+// Bytes sent plus received and their rate since Initialize() or ThroughputReset()
+FLR_EXPORT void ThroughputGet(uint64_t *bytes, double *bytesPerSec);
+FLR_EXPORT void ThroughputReset(void);
+
 FLR_EXPORT int32_t CheckDataReady(uint8_t *channel_ID, uint32_t *receiveBytes, const uint8_t **receiveData);
 
+// Monotonic ns at which the last ReadFrame() saw its frame start, 0 if it had been buffered
+FLR_EXPORT int64_t StartByteNs(void);
+
+// Called from PumpFrames() for each complete frame received
+typedef void CLIENT_frameCallback_t(void *context, uint8_t channelID, const uint8_t *payload, uint32_t bytes);
+
+// Descriptor of the open port to wait on in an event loop, -1 if there is none
+FLR_EXPORT int32_t PortFdGet(void);
+// Parse what the port has received without waiting, callback per complete frame.
+// Returns the frames delivered, -1 on a port error.
+FLR_EXPORT int32_t PumpFrames(CLIENT_frameCallback_t *callback, void *context);
+
 #endif //UART_CONNECTOR_H
@@ -0,0 +1,291 @@
+//
+//  FSLP transport benchmark
+//      Drives a camera, or boson_emu, through the UART connector of the SDK
+//      or through I2C_Connector and reports commands/sec, p50/p99 command
+//      latency and bulk bytes/sec.
+//
+//      make bench_fslp
+//      ./bench_fslp uart /dev/pts/N [-n commands] [-d depth] [-b baud]
+//      ./bench_fslp i2c /tmp/boson_i2c [-n commands]
+//
+//      For i2c the path is the socket boson_emu -i serves; to run against a
+//      camera replace I2C_read() / I2C_write() below with the bus driver.
+//
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "Client_API.h"
+#include "Client_Pipeline.h"
+#include "Client_Transfer.h"
+#include "I2C_Connector.h"
+#include "Serializer_BuiltIn.h"
+#include "UART_Connector.h"
+
+#define BULK_BYTES      (640 * 512 * 2)
+#define HEADER_BYTES    12
+
+extern int32_t FSLP_set_port_name(int32_t port_id, const char *port_name);
+
+static double *latencies;
+static uint8_t bulk[BULK_BYTES];
+
+static double now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int cmp_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+static void report_latency(const char *name, int n, double elapsed)
+{
+    qsort(latencies, n, sizeof(double), cmp_double);
+    printf("%-24s %9.0f cmd/s   p50 %8.1f us   p99 %8.1f us\n", name, n / elapsed,
+           latencies[n / 2] * 1e6, latencies[(n * 99) / 100] * 1e6);
+}
+
+static void report_bulk(const char *name, uint32_t bytes, double elapsed, uint64_t wire)
+{
+    printf("%-24s %9.0f B/s payload", name, bytes / elapsed);
+    if (wire)
+        printf("   %9.0f B/s on the wire", wire / elapsed);
+    printf("\n");
+}
+
+static int check_bulk(void)
+{
+    uint32_t i;
+
+    // boson_emu's capture is a ramp
+    for (i = 0; i < BULK_BYTES; i++) {
+        if (bulk[i] != (uint8_t) i)
+            return -1;
+    }
+    return 0;
+}
+
+static int bench_uart(const char *port, int n, uint32_t depth, int32_t baud)
+{
+    CLIENT_PIPELINE_FUTURE future;
+    CLIENT_TRANSFER xfer;
+    FLR_RESULT res;
+    uint64_t wire;
+    uint32_t sn;
+    double t0, t;
+    int i;
+
+    if (FSLP_set_port_name(0, port) || Initialize(0, baud)) {
+        fprintf(stderr, "can't open %s\n", port);
+        return 1;
+    }
+
+    // one command at a time
+    t0 = now_sec();
+    for (i = 0; i < n; i++) {
+        t = now_sec();
+        res = bosonGetCameraSN(&sn);
+        latencies[i] = now_sec() - t;
+        if (res) {
+            fprintf(stderr, "bosonGetCameraSN: 0x%x\n", res);
+            return 1;
+        }
+    }
+    report_latency("uart sync", n, now_sec() - t0);
+
+    // pipelined, latency is submit to completion
+    CLIENT_pipelineSetDepth(depth);
+    t0 = now_sec();
+    for (i = 0; i < n; i++) {
+        memset(&future, 0, sizeof(future));
+        t = now_sec();
+        res = CLIENT_pipelineSubmit(BOSON_GETCAMERASN, NULL, 0, CLIENT_pipelineFutureCallback, &future, NULL);
+        if (res) {
+            fprintf(stderr, "CLIENT_pipelineSubmit: 0x%x\n", res);
+            return 1;
+        }
+        // the submit returns once a slot is free: time per command in a full pipeline
+        latencies[i] = now_sec() - t;
+    }
+    CLIENT_pipelineFlush();
+    report_latency("uart pipelined", n, now_sec() - t0);
+
+    // bulk download
+    memset(&xfer, 0, sizeof(xfer));
+    xfer.buf = bulk;
+    ThroughputReset();
+    t0 = now_sec();
+    res = CLIENT_transferCapture(&xfer, 0, 0, BULK_BYTES);
+    t = now_sec() - t0;
+    ThroughputGet(&wire, NULL);
+    if (res || check_bulk()) {
+        fprintf(stderr, "CLIENT_transferCapture: 0x%x after %u bytes\n", res, xfer.done);
+        return 1;
+    }
+    report_bulk("uart capture download", BULK_BYTES, t, wire);
+
+    Close();
+    return 0;
+}
+
+static int i2c_fd = -1;
+static uint64_t i2c_bytes, i2c_transactions;
+
+static int i2c_io(uint8_t op, uint8_t *data, uint32_t bytes)
+{
+    uint8_t hdr[3] = { op, (uint8_t) (bytes >> 8), (uint8_t) bytes };
+    uint32_t done = 0;
+
+    if (write(i2c_fd, hdr, 3) != 3)
+        return -1;
+    if (op == 'W')
+        return write(i2c_fd, data, bytes) == (ssize_t) bytes ? 0 : -1;
+    while (done < bytes) {
+        ssize_t n = read(i2c_fd, data + done, bytes - done);
+        if (n <= 0)
+            return -1;
+        done += (uint32_t) n;
+    }
+    return 0;
+}
+
+FLR_RESULT I2C_read(uint8_t* readData, uint32_t readBytes)
+{
+    i2c_transactions++;
+    i2c_bytes += readBytes;
+    return i2c_io('R', readData, readBytes) ? FLR_COMM_ERROR_READING_COMM : FLR_OK;
+}
+
+FLR_RESULT I2C_write(uint8_t* writeData, uint32_t writeBytes)
+{
+    i2c_transactions++;
+    i2c_bytes += writeBytes;
+    return i2c_io('W', writeData, writeBytes) ? FLR_COMM_ERROR_WRITING_COMM : FLR_OK;
+}
+
+static FLR_RESULT i2c_command(uint32_t seq, uint32_t fn, const uint8_t *args, uint32_t argBytes, uint8_t *reply, uint32_t *replyBytes)
+{
+    uint8_t frame[HEADER_BYTES + 518] = { 0 };
+    uint32_t len, status;
+
+    UINT_32ToByte(seq, frame);
+    UINT_32ToByte(fn, frame + 4);
+    UINT_32ToByte(0xFFFFFFFF, frame + 8);
+    if (argBytes)
+        memcpy(frame + HEADER_BYTES, args, argBytes);
+    if (I2C_writeFrame(frame, HEADER_BYTES + argBytes) != FLR_OK)
+        return FLR_COMM_ERROR_WRITING_COMM;
+    if (I2C_readFrame(frame, &len) != FLR_OK || len < HEADER_BYTES)
+        return FLR_COMM_ERROR_READING_COMM;
+
+    byteToUINT_32(frame + 8, &status);
+    if (status)
+        return (FLR_RESULT) status;
+    *replyBytes = len - HEADER_BYTES;
+    memcpy(reply, frame + HEADER_BYTES, *replyBytes);
+    return R_SUCCESS;
+}
+
+static int bench_i2c(const char *path, int n)
+{
+    struct sockaddr_un addr;
+    uint8_t args[7], reply[518];
+    uint32_t replyBytes, offset, seq = 0;
+    FLR_RESULT res;
+    double t0, t;
+    int i;
+
+    i2c_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    if (i2c_fd < 0 || connect(i2c_fd, (struct sockaddr *) &addr, sizeof(addr))) {
+        fprintf(stderr, "can't connect to %s\n", path);
+        return 1;
+    }
+
+    i2c_transactions = 0;
+    t0 = now_sec();
+    for (i = 0; i < n; i++) {
+        t = now_sec();
+        res = i2c_command(seq++, BOSON_GETCAMERASN, NULL, 0, reply, &replyBytes);
+        latencies[i] = now_sec() - t;
+        if (res) {
+            fprintf(stderr, "BOSON_GETCAMERASN: 0x%x\n", res);
+            return 1;
+        }
+    }
+    report_latency("i2c sync", n, now_sec() - t0);
+    printf("%-24s %9.1f bus transactions per command\n", "", (double) i2c_transactions / n);
+
+    i2c_bytes = 0;
+    t0 = now_sec();
+    for (offset = 0; offset < BULK_BYTES; offset += CLIENT_TRANSFER_MEM_CHUNK) {
+        args[0] = 0;
+        UINT_32ToByte(offset, args + 1);
+        UINT_16ToByte(CLIENT_TRANSFER_MEM_CHUNK, args + 5);
+        res = i2c_command(seq++, MEM_READCAPTURE, args, sizeof(args), reply, &replyBytes);
+        if (res || replyBytes != CLIENT_TRANSFER_MEM_CHUNK) {
+            fprintf(stderr, "MEM_READCAPTURE: 0x%x at %u\n", res, offset);
+            return 1;
+        }
+        memcpy(bulk + offset, reply, CLIENT_TRANSFER_MEM_CHUNK);
+    }
+    t = now_sec() - t0;
+    if (check_bulk()) {
+        fprintf(stderr, "capture data mismatch\n");
+        return 1;
+    }
+    report_bulk("i2c capture download", BULK_BYTES, t, i2c_bytes);
+
+    close(i2c_fd);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int n = 2000;
+    uint32_t depth = 8;
+    int32_t baud = 921600;
+    int opt, ret;
+
+    if (argc < 3 || (strcmp(argv[1], "uart") && strcmp(argv[1], "i2c"))) {
+        fprintf(stderr, "usage: %s uart <port> [-n commands] [-d depth] [-b baud]\n"
+                        "       %s i2c <socket> [-n commands]\n", argv[0], argv[0]);
+        return 1;
+    }
+
+    optind = 3;
+    while ((opt = getopt(argc, argv, "n:d:b:")) != -1) {
+        switch (opt) {
+        case 'n': n = atoi(optarg); break;
+        case 'd': depth = (uint32_t) atoi(optarg); break;
+        case 'b': baud = atoi(optarg); break;
+        default: return 1;
+        }
+    }
+    if (n < 1)
+        n = 1;
+
+    latencies = (double *) malloc(n * sizeof(double));
+    if (!latencies)
+        return 1;
+
+    if (!strcmp(argv[1], "uart"))
+        ret = bench_uart(argv[2], n, depth, baud);
+    else
+        ret = bench_i2c(argv[2], n);
+
+    free(latencies);
+    return ret;
+}
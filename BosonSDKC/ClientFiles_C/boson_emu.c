@@ -0,0 +1,540 @@
+//
+//  Virtual Boson
+//      Answers FSLP commands over a pseudo-terminal (UART framing) and over
+//      a Unix socket carrying I2C transactions, so the SDK transports can be
+//      benchmarked without a camera (see bench_fslp.c).
+//
+//      make boson_emu && ./boson_emu [-l us] [-r baud] [-f fn[=us],...] [-i socket]
+//
+//      -l us      processing time of every command
+//      -r baud    pace UART responses like a real line at this rate
+//      -f list    answer only these function codes (hex or decimal), each
+//                 optionally with its own processing time
+//      -i socket  also serve the I2C side on this socket path
+//
+//      The pty name is printed on stdout. I2C transactions on the socket:
+//          'W' len16 bytes     master write
+//          'R' len16           master read, answered with len bytes; an
+//                              idle TX buffer reads back as 0xFF
+//
+#define _GNU_SOURCE     // posix_openpt, cfmakeraw
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include "FunctionCodes.h"
+#include "ReturnCodes.h"
+#include "flirCRC.h"
+
+#define START_FRAME_BYTE    0x8E
+#define ESCAPE_BYTE         0x9E
+#define END_FRAME_BYTE      0xAE
+#define I2C_MAGIC_0         0x8E
+#define I2C_MAGIC_1         0xA1
+
+#define COMMAND_CHANNEL     0x00
+#define HEADER_BYTES        12
+#define MAX_PAYLOAD         (HEADER_BYTES + 518)
+#define MAX_PENDING         64
+#define MAX_ENABLED         64
+#define I2C_BUF_SIZ         8192
+
+#define CAPTURE_ROWS        512
+#define CAPTURE_COLUMNS     640
+#define CAPTURE_BYTES       (CAPTURE_ROWS * CAPTURE_COLUMNS * 2)
+
+enum { VIA_UART, VIA_I2C };
+
+// Settings the emulator keeps: get replies with what the last set stored
+typedef struct {
+    FLR_FUNCTION getFn;
+    FLR_FUNCTION setFn;         // 0: read-only
+    uint32_t bytes;
+    uint8_t value[20];
+} EMU_SETTING;
+
+static EMU_SETTING settings[] = {
+    { BOSON_GETCAMERASN, 0, 4, { 0x00, 0x01, 0xE2, 0x40 } },
+    { BOSON_GETCAMERAPN, 0, 20, "20640A050-6PAAX" },
+    { BOSON_GETSOFTWAREREV, 0, 12, { 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 1 } },
+    { BOSON_GETFFCMODE, BOSON_SETFFCMODE, 4, { 0 } },
+    { AGC_GETMODE, AGC_SETMODE, 4, { 0 } },
+    { AGC_GETBRIGHTNESS, AGC_SETBRIGHTNESS, 4, { 0 } },
+    { TELEMETRY_GETSTATE, 0, 4, { 0 } },
+};
+#define NUM_SETTINGS (sizeof(settings) / sizeof(settings[0]))
+
+typedef struct {
+    uint32_t fn;
+    long latency_us;            // < 0: use the global one
+} EMU_ENABLED;
+
+typedef struct {
+    double ready;
+    int via;
+    uint32_t len;
+    uint8_t payload[MAX_PAYLOAD];
+} EMU_RESPONSE;
+
+static long latency_us = 0;
+static long line_baud = 0;
+static EMU_ENABLED enabled[MAX_ENABLED];
+static int num_enabled = 0;             // 0: everything the emulator knows
+
+static EMU_RESPONSE pending[MAX_PENDING];
+static int pending_head = 0, pending_count = 0;
+static double busy_until = 0;           // commands are processed one at a time
+
+static uint8_t i2c_tx[I2C_BUF_SIZ];
+static uint32_t i2c_tx_len = 0;
+
+static double now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static uint32_t get_be32(const uint8_t *p)
+{
+    return ((uint32_t) p[0] << 24) | ((uint32_t) p[1] << 16) | ((uint32_t) p[2] << 8) | p[3];
+}
+
+static void put_be32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t) (v >> 24);
+    p[1] = (uint8_t) (v >> 16);
+    p[2] = (uint8_t) (v >> 8);
+    p[3] = (uint8_t) v;
+}
+
+static int write_all(int fd, const uint8_t *buf, size_t len)
+{
+    while (len) {
+        ssize_t n = write(fd, buf, len);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return -1;
+        buf += n;
+        len -= (size_t) n;
+    }
+    return 0;
+}
+
+// Processing time of fn, -1 if it is not in the enabled subset
+static long command_latency(uint32_t fn)
+{
+    int i;
+
+    if (!num_enabled)
+        return latency_us;
+    for (i = 0; i < num_enabled; i++) {
+        if (enabled[i].fn == fn)
+            return enabled[i].latency_us < 0 ? latency_us : enabled[i].latency_us;
+    }
+    return -1;
+}
+
+// Build the reply data for one command, returns its status
+static FLR_RESULT execute(uint32_t fn, const uint8_t *data, uint32_t bytes, uint8_t *reply, uint32_t *replyBytes)
+{
+    uint32_t i;
+
+    *replyBytes = 0;
+    switch (fn) {
+    case MEM_GETCAPTURESIZE:
+        put_be32(reply, CAPTURE_BYTES);
+        reply[4] = CAPTURE_ROWS >> 8;
+        reply[5] = CAPTURE_ROWS & 0xFF;
+        reply[6] = CAPTURE_COLUMNS >> 8;
+        reply[7] = CAPTURE_COLUMNS & 0xFF;
+        *replyBytes = 8;
+        return R_SUCCESS;
+
+    case MEM_READCAPTURE: {
+        uint32_t offset, size;
+
+        if (bytes < 7)
+            return R_CAM_PKG_INSUFFICIENT_BYTES;
+        offset = get_be32(data + 1);
+        size = ((uint32_t) data[5] << 8) | data[6];
+        if (size > MAX_PAYLOAD - HEADER_BYTES || offset + size > CAPTURE_BYTES)
+            return R_CAM_API_INVALID_INPUT;
+        // the capture is a ramp, each byte its offset
+        for (i = 0; i < size; i++)
+            reply[i] = (uint8_t) (offset + i);
+        *replyBytes = size;
+        return R_SUCCESS;
+    }
+
+    case CAPTURE_SINGLEFRAME:
+    case BOSON_RUNFFC:
+        return R_SUCCESS;
+    }
+
+    for (i = 0; i < NUM_SETTINGS; i++) {
+        EMU_SETTING *s = &settings[i];
+
+        if (fn == (uint32_t) s->getFn) {
+            memcpy(reply, s->value, s->bytes);
+            *replyBytes = s->bytes;
+            return R_SUCCESS;
+        }
+        if (s->setFn && fn == (uint32_t) s->setFn) {
+            if (bytes < s->bytes)
+                return R_CAM_PKG_INSUFFICIENT_BYTES;
+            memcpy(s->value, data, s->bytes);
+            return R_SUCCESS;
+        }
+    }
+    return R_CAM_DSPCH_BAD_CMD_ID;
+}
+
+static void handle_command(int via, const uint8_t *payload, uint32_t len)
+{
+    EMU_RESPONSE *rsp;
+    uint32_t fn, replyBytes;
+    FLR_RESULT status;
+    long lat;
+    double now;
+
+    if (len < HEADER_BYTES || pending_count == MAX_PENDING)
+        return;
+
+    fn = get_be32(payload + 4);
+    rsp = &pending[(pending_head + pending_count) % MAX_PENDING];
+    memcpy(rsp->payload, payload, 8);
+
+    lat = command_latency(fn);
+    if (lat < 0) {
+        status = R_CAM_DSPCH_BAD_CMD_ID;
+        replyBytes = 0;
+        lat = latency_us;
+    } else {
+        status = execute(fn, payload + HEADER_BYTES, len - HEADER_BYTES, rsp->payload + HEADER_BYTES, &replyBytes);
+    }
+    put_be32(rsp->payload + 8, (uint32_t) status);
+    rsp->len = HEADER_BYTES + (status == R_SUCCESS ? replyBytes : 0);
+    rsp->via = via;
+
+    now = now_sec();
+    if (busy_until < now)
+        busy_until = now;
+    busy_until += lat * 1e-6;
+    // then the line takes 10 bit times per byte: start, channel, crc, end
+    if (line_baud > 0 && via == VIA_UART)
+        busy_until += (rsp->len + 5) * 10.0 / line_baud;
+    rsp->ready = busy_until;
+
+    pending_count++;
+}
+
+static int send_uart_frame(int fd, const uint8_t *payload, uint32_t len)
+{
+    uint8_t frame[2 * (MAX_PAYLOAD + 3) + 2];
+    uint8_t raw[MAX_PAYLOAD + 3];
+    uint32_t out = 0, i;
+    uint16_t crc;
+
+    raw[0] = COMMAND_CHANNEL;
+    memcpy(raw + 1, payload, len);
+    crc = calcFlirCRC16Bytes(len + 1, raw);
+    raw[len + 1] = (uint8_t) (crc >> 8);
+    raw[len + 2] = (uint8_t) crc;
+
+    frame[out++] = START_FRAME_BYTE;
+    for (i = 0; i < len + 3; i++) {
+        uint8_t c = raw[i];
+        if (c == START_FRAME_BYTE || c == ESCAPE_BYTE || c == END_FRAME_BYTE) {
+            frame[out++] = ESCAPE_BYTE;
+            c = (uint8_t) (c - 0x0D);   // 0x8E->0x81, 0x9E->0x91, 0xAE->0xA1
+        }
+        frame[out++] = c;
+    }
+    frame[out++] = END_FRAME_BYTE;
+
+    return write_all(fd, frame, out);
+}
+
+static void queue_i2c_frame(const uint8_t *payload, uint32_t len)
+{
+    if (i2c_tx_len + len + 4 > I2C_BUF_SIZ)
+        return;
+    i2c_tx[i2c_tx_len++] = I2C_MAGIC_0;
+    i2c_tx[i2c_tx_len++] = I2C_MAGIC_1;
+    i2c_tx[i2c_tx_len++] = (uint8_t) (len >> 8);
+    i2c_tx[i2c_tx_len++] = (uint8_t) len;
+    memcpy(i2c_tx + i2c_tx_len, payload, len);
+    i2c_tx_len += len;
+}
+
+// Hand out responses whose processing time is over, in order
+static void release_ready(int uart_fd)
+{
+    double now = now_sec();
+
+    while (pending_count && pending[pending_head].ready <= now) {
+        EMU_RESPONSE *rsp = &pending[pending_head];
+
+        if (rsp->via == VIA_UART)
+            send_uart_frame(uart_fd, rsp->payload, rsp->len);
+        else
+            queue_i2c_frame(rsp->payload, rsp->len);
+        pending_head = (pending_head + 1) % MAX_PENDING;
+        pending_count--;
+    }
+}
+
+// UART receive: START channel payload crc16 END, with escapes
+static void uart_receive(const uint8_t *buf, ssize_t n)
+{
+    static uint8_t frame[MAX_PAYLOAD + 3];
+    static uint32_t len = 0;
+    static int in_frame = 0, in_escape = 0;
+    ssize_t i;
+
+    for (i = 0; i < n; i++) {
+        uint8_t c = buf[i];
+
+        if (c == START_FRAME_BYTE) {
+            in_frame = 1;
+            in_escape = 0;
+            len = 0;
+            continue;
+        }
+        if (!in_frame)
+            continue;
+        if (c == END_FRAME_BYTE) {
+            in_frame = 0;
+            if (len >= 3 && frame[0] == COMMAND_CHANNEL &&
+                calcFlirCRC16Bytes(len - 2, frame) == (((uint16_t) frame[len - 2] << 8) | frame[len - 1]))
+                handle_command(VIA_UART, frame + 1, len - 3);
+            continue;
+        }
+        if (c == ESCAPE_BYTE) {
+            in_escape = 1;
+            continue;
+        }
+        if (in_escape) {
+            c = (uint8_t) (c + 0x0D);
+            in_escape = 0;
+        }
+        if (len == sizeof(frame)) {
+            in_frame = 0;
+            continue;
+        }
+        frame[len++] = c;
+    }
+}
+
+// I2C master writes: magic, length16, payload
+static void i2c_receive(const uint8_t *buf, uint32_t n)
+{
+    static uint8_t frame[4 + MAX_PAYLOAD];
+    static uint32_t len = 0;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        if (len == 0 && buf[i] != I2C_MAGIC_0)
+            continue;
+        if (len == 1 && buf[i] != I2C_MAGIC_1) {
+            len = (buf[i] == I2C_MAGIC_0);
+            continue;
+        }
+        frame[len++] = buf[i];
+        if (len >= 4) {
+            uint32_t want = ((uint32_t) frame[2] << 8) | frame[3];
+            if (want > MAX_PAYLOAD) {
+                len = 0;
+                continue;
+            }
+            if (len == 4 + want) {
+                handle_command(VIA_I2C, frame + 4, want);
+                len = 0;
+            }
+        }
+    }
+}
+
+// Socket side: split the byte stream into 'W'/'R' transactions.
+// Returns -1 when the client should be dropped.
+static int i2c_transactions(int fd, int uart_fd, uint8_t *buf, uint32_t *have)
+{
+    uint32_t pos = 0;
+
+    while (*have - pos >= 3) {
+        uint32_t n = ((uint32_t) buf[pos + 1] << 8) | buf[pos + 2];
+
+        if (buf[pos] == 'W') {
+            if (*have - pos < 3 + n)
+                break;
+            i2c_receive(buf + pos + 3, n);
+            pos += 3 + n;
+        } else if (buf[pos] == 'R') {
+            uint8_t out[I2C_BUF_SIZ];
+            uint32_t take;
+
+            if (n > sizeof(out))
+                return -1;
+            release_ready(uart_fd);
+            take = n < i2c_tx_len ? n : i2c_tx_len;
+            memcpy(out, i2c_tx, take);
+            memmove(i2c_tx, i2c_tx + take, i2c_tx_len - take);
+            i2c_tx_len -= take;
+            memset(out + take, 0xFF, n - take);
+            if (write_all(fd, out, n))
+                return -1;
+            pos += 3;
+        } else {
+            return -1;
+        }
+    }
+
+    memmove(buf, buf + pos, *have - pos);
+    *have -= pos;
+    return 0;
+}
+
+static int parse_enabled(char *list)
+{
+    char *tok;
+
+    for (tok = strtok(list, ","); tok; tok = strtok(NULL, ",")) {
+        char *eq = strchr(tok, '=');
+
+        if (num_enabled == MAX_ENABLED)
+            return -1;
+        enabled[num_enabled].fn = (uint32_t) strtoul(tok, NULL, 0);
+        enabled[num_enabled].latency_us = eq ? strtol(eq + 1, NULL, 0) : -1;
+        num_enabled++;
+    }
+    return 0;
+}
+
+static int open_i2c_socket(const char *path)
+{
+    struct sockaddr_un addr;
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (fd < 0)
+        return -1;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+    unlink(path);
+    if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) || listen(fd, 1)) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t i2c_buf[I2C_BUF_SIZ + 3];
+    uint32_t i2c_have = 0;
+    const char *i2c_path = NULL;
+    struct termios tio;
+    int master, slave, listen_fd = -1, client_fd = -1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "l:r:f:i:")) != -1) {
+        switch (opt) {
+        case 'l': latency_us = strtol(optarg, NULL, 0); break;
+        case 'r': line_baud = strtol(optarg, NULL, 0); break;
+        case 'f':
+            if (parse_enabled(optarg)) {
+                fprintf(stderr, "too many function codes\n");
+                return 1;
+            }
+            break;
+        case 'i': i2c_path = optarg; break;
+        default:
+            fprintf(stderr, "usage: %s [-l us] [-r baud] [-f fn[=us],...] [-i socket]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) || unlockpt(master)) {
+        perror("pty");
+        return 1;
+    }
+    // keep the slave open so the master never sees EIO between clients
+    slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0 || tcgetattr(slave, &tio)) {
+        perror("pty slave");
+        return 1;
+    }
+    cfmakeraw(&tio);
+    tcsetattr(slave, TCSANOW, &tio);
+
+    if (i2c_path) {
+        listen_fd = open_i2c_socket(i2c_path);
+        if (listen_fd < 0) {
+            perror("i2c socket");
+            return 1;
+        }
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    printf("uart %s\n", ptsname(master));
+    if (i2c_path)
+        printf("i2c %s\n", i2c_path);
+    fflush(stdout);
+
+    for (;;) {
+        struct pollfd fds[3];
+        int nfds = 0, timeout = -1;
+        uint8_t buf[4096];
+        ssize_t n;
+
+        if (pending_count) {
+            double wait = pending[pending_head].ready - now_sec();
+            timeout = wait > 0 ? (int) (wait * 1000) + 1 : 0;
+        }
+
+        fds[nfds].fd = master;
+        fds[nfds++].events = POLLIN;
+        fds[nfds].fd = client_fd >= 0 ? client_fd : listen_fd;
+        fds[nfds++].events = POLLIN;
+        poll(fds, (fds[1].fd >= 0) ? 2 : 1, timeout);
+
+        if (fds[0].revents & POLLIN) {
+            n = read(master, buf, sizeof(buf));
+            if (n > 0)
+                uart_receive(buf, n);
+        }
+
+        if (fds[1].fd >= 0 && (fds[1].revents & (POLLIN | POLLHUP))) {
+            if (client_fd < 0) {
+                client_fd = accept(listen_fd, NULL, NULL);
+                i2c_have = 0;
+            } else {
+                n = read(client_fd, i2c_buf + i2c_have, sizeof(i2c_buf) - i2c_have);
+                if (n > 0) {
+                    i2c_have += (uint32_t) n;
+                    if (i2c_transactions(client_fd, master, i2c_buf, &i2c_have) || i2c_have == sizeof(i2c_buf))
+                        n = -1;
+                }
+                if (n <= 0) {
+                    close(client_fd);
+                    client_fd = -1;
+                    i2c_tx_len = 0;
+                }
+            }
+        }
+
+        release_ready(master);
+    }
+}
@@ -25,6 +25,7 @@
 /******************************************************************************/
 #include <string.h>
 #include <stdio.h>
+#include <unistd.h>
 
 #include "UART_Connector.h"
 #include "dataServiceClient.h"
@@ -33,18 +34,22 @@
 /******************************************************************************/
 /** EXPORTED DEFINES                                                         **/
 /******************************************************************************/
-#define DO_TRACE(s, ...)                //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DO_INIT_TRACE(s, ...)           //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DO_DATA_SERVICE_TRACE(s, ...)   //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DEBUG_ERR(s, ...)               printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DEBUG_WARN(s, ...)              //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
+#define DO_TRACE(s, ...)                //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DO_INIT_TRACE(s, ...)           //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DO_DATA_SERVICE_TRACE(s, ...)   //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DEBUG_ERR(s, ...)               printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DEBUG_WARN(s, ...)              //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+
 
 /******************************************************************************/
 /** LOCAL DATA                                                               **/
 /******************************************************************************/
 static dataServiceController_t controller;
 static dataServiceFrame_t sendFrame;
+static dataServiceFrame_t ackFrame;
 static dataServiceFrame_t receiveFrame;
+static dataServiceWindowSlot_t sendWindow[DATA_WINDOW_MAX];
+static dataServiceWindowSlot_t receiveWindow[DATA_WINDOW_MAX];
 static fifo_p receiveBuffer;
 
 /******************************************************************************/
@@ -84,25 +89,33 @@ static FLR_RESULT sendData(uint8_t* data, uint32_t data_len)
 /**
  * @brief Reset Data Service Client controller
 
- * Set default value in controller structure
+ * Set default value in controller structure and drop all frames
+ * held in send and receive window
  * @return none
  */
 static void resetController(void)
 {
     controller.send_counter = 0;
+    controller.send_head = 0;
+    controller.send_pending = 0;
     controller.receive_counter = 0;
+    controller.receive_head = 0;
     controller.state = CONTROLLER_READY;
+
+    memset(sendWindow, 0, sizeof(sendWindow));
+    memset(receiveWindow, 0, sizeof(receiveWindow));
 }
 
 /**
  * @brief Initialization Data Service Client controller
 
- * Reset controller and callback function
+ * Reset controller, window size and callback function
  * @return none
  */
 static void initController(void)
 {
     resetController();
+    controller.window = DATA_WINDOW_DEFAULT;
     controller.callback = NULL;
 }
 
@@ -110,27 +123,30 @@ static void initController(void)
  * @brief Prepare Data Service Client frame
 
  * Prepare frame by set command, counter and data
+ * @param [out] frame - frame to fill
  * @param [in] cmd - command code
  * @param [in] counter - frame counter
  * @param [in] data - data buffer
  * @param [in] data_len - data size in bytes
  * @return none
  */
-static void prepareFrame(dataServiceFrameCommand_t cmd, uint16_t counter, uint8_t* data, uint32_t data_len)
+static void prepareFrame(dataServiceFrame_t *frame, dataServiceFrameCommand_t cmd, uint16_t counter, uint8_t* data, uint32_t data_len)
 {
     uint8_t counter_lsb, counter_msb;
 
     counter_msb = (uint8_t)(counter >> 8);
     counter_lsb = (uint8_t)(counter);
 
-    sendFrame.buffer[0] = (cmd << 6) | (counter_msb & COUNTER_MASK);
-    sendFrame.buffer[1] = counter_lsb;
+    frame->cmd = cmd;
+    frame->counter = counter;
+    frame->buffer[0] = (cmd << 6) | (counter_msb & COUNTER_MASK);
+    frame->buffer[1] = counter_lsb;
 
     if(data_len > 0 && data != NULL)
     {
-        memcpy(&sendFrame.buffer[2], data, data_len);
+        memcpy(&frame->buffer[2], data, data_len);
     }
-    sendFrame.size = data_len + 2;
+    frame->size = data_len + 2;
 }
 
 /**
@@ -142,23 +158,115 @@ static void prepareFrame(dataServiceFrameCommand_t cmd, uint16_t counter, uint8_
  */
 static FLR_RESULT sendAck(uint16_t counter)
 {
-    prepareFrame(DATA_ACK, counter, NULL, 0);
+    prepareFrame(&ackFrame, DATA_ACK, counter, NULL, 0);
 
-    return sendData(sendFrame.buffer, sendFrame.size);
+    return sendData(ackFrame.buffer, ackFrame.size);
 }
 
 /**
  * @brief Calculate counter distance
 
+ * Signed distance between two counters, correct across counter wrap
  * @param [in] sender - counter value from sender
- * @param [in] sender - counter value from recipient
+ * @param [in] recipient - counter value from recipient
  * @return distance value
  */
 static int calculateDistance(uint16_t sender, uint16_t recipient)
 {
-    sender-= (sender>(MAX_COUNTER_VALUE/2) ? (MAX_COUNTER_VALUE/2) : 0); \
-    recipient-= (recipient>(MAX_COUNTER_VALUE/2) ? (MAX_COUNTER_VALUE/2) : 0); \
-    return (int)sender-(int)recipient;
+    int distance = ((int)sender - (int)recipient) % MAX_COUNTER_VALUE;
+
+    if(distance > MAX_COUNTER_VALUE/2)
+    {
+        distance -= MAX_COUNTER_VALUE;
+    }
+    else if(distance < -(MAX_COUNTER_VALUE/2))
+    {
+        distance += MAX_COUNTER_VALUE;
+    }
+    return distance;
+}
+
+/**
+ * @brief Next counter value
+
+ * @param [in] counter - counter value
+ * @return counter value following counter
+ */
+static uint16_t nextCounter(uint16_t counter)
+{
+    return (uint16_t)((counter+1)%MAX_COUNTER_VALUE);
+}
+
+/**
+ * @brief Store received frame data
+
+ * Write frame data to receive buffer and run callback
+ * @param [in] data - frame data
+ * @param [in] data_len - frame data size in bytes
+ * @return FLR_OK if successful else return error
+ */
+static FLR_RESULT deliverData(uint8_t *data, uint32_t data_len)
+{
+    uint32_t data_len_out;
+
+    if(fifoWrite(receiveBuffer, data, data_len, &data_len_out) != FLR_OK)
+    {
+        DEBUG_ERR("Write to receive buffer error occurred\n");
+        return FLR_ERROR;
+    }
+
+    if(controller.callback != NULL)
+    {
+        controller.callback(data_len_out);
+    }
+
+    return FLR_OK;
+}
+
+/**
+ * @brief Mark ACK in send window
+
+ * Called from receive path. Only flags of frames in flight are touched,
+ * the send window itself is moved by dataServiceClientSend().
+ * ACK received past unacknowledged frames means that those frames or their
+ * ACKs were lost - they are marked for immediate retransmission.
+ * @param [in] counter - acknowledged frame counter
+ * @return FLR_OK if successful else return error
+ */
+static FLR_RESULT markAck(uint16_t counter)
+{
+    dataServiceWindowSlot_t *slot;
+    int found = 0;
+    int i;
+
+    for(i = 0; i < DATA_WINDOW_MAX; i++)
+    {
+        slot = &sendWindow[i];
+        if(slot->in_flight && slot->frame.counter == counter)
+        {
+            slot->acked = 1;
+            found = 1;
+        }
+    }
+
+    if(!found)
+    {
+        /** duplicate ACK of retransmitted frame */
+        DEBUG_WARN("ACK for frame not in flight [%d]\n", counter);
+        return FLR_OK;
+    }
+
+    for(i = 0; i < DATA_WINDOW_MAX; i++)
+    {
+        slot = &sendWindow[i];
+        if(slot->in_flight && !slot->acked && !slot->resent &&
+           calculateDistance(slot->frame.counter, counter) < 0)
+        {
+            slot->resend = 1;
+        }
+    }
+
+    return FLR_OK;
 }
 
 /**
@@ -172,7 +280,7 @@ static int calculateDistance(uint16_t sender, uint16_t recipient)
  */
 static FLR_RESULT parseData(uint8_t *data, uint32_t data_len)
 {
-    uint32_t data_len_out;
+    dataServiceWindowSlot_t *slot;
     int counter_distance;
 
     if(!data || (data_len < 2))
@@ -184,10 +292,7 @@ static FLR_RESULT parseData(uint8_t *data, uint32_t data_len)
     /** parse received data */
     receiveFrame.cmd = (data[0] & CMD_MASK)>>6;
     receiveFrame.counter = ((uint16_t)(data[0] & COUNTER_MASK)) << 8 | (uint16_t) (data[1]);
-    if(data_len > 2)
-    {
-        receiveFrame.size = data_len - 2;
-    }
+    receiveFrame.size = data_len - 2;
 
     switch(receiveFrame.cmd)
     {
@@ -206,12 +311,12 @@ static FLR_RESULT parseData(uint8_t *data, uint32_t data_len)
 
                 return FLR_OK;
             }
-            /** received next frame: save data in buffer, send ACK, increment counter, run callback  */
+            /** received next frame: save data in buffer, send ACK, increment counter, run callback,
+                then deliver frames received ahead of it */
             else if(counter_distance == 0)
             {
-                if(fifoWrite(receiveBuffer, &data[2], receiveFrame.size, &data_len_out) != FLR_OK)
+                if(deliverData(&data[2], receiveFrame.size) != FLR_OK)
                 {
-                    DEBUG_ERR("Write to receive buffer error occurred\n");
                     return FLR_ERROR;
                 }
 
@@ -221,38 +326,54 @@ static FLR_RESULT parseData(uint8_t *data, uint32_t data_len)
                     return FLR_ERROR;
                 }
 
-                controller.receive_counter = (controller.receive_counter+1)%MAX_COUNTER_VALUE;
+                controller.receive_counter = nextCounter(controller.receive_counter);
+                controller.receive_head = (controller.receive_head+1)%DATA_WINDOW_MAX;
 
-                if(controller.callback != NULL)
+                slot = &receiveWindow[controller.receive_head];
+                while(slot->in_flight)
                 {
-                    controller.callback(data_len_out);
+                    slot->in_flight = 0;
+                    if(deliverData(&slot->frame.buffer[2], slot->frame.size - 2) != FLR_OK)
+                    {
+                        return FLR_ERROR;
+                    }
+
+                    controller.receive_counter = nextCounter(controller.receive_counter);
+                    controller.receive_head = (controller.receive_head+1)%DATA_WINDOW_MAX;
+                    slot = &receiveWindow[controller.receive_head];
                 }
 
                 return FLR_OK;
             }
-            /* synchronization error */
-            else
+            /** received frame ahead of a gap: hold it until the gap is filled, send ACK */
+            else if(counter_distance < DATA_WINDOW_MAX)
             {
-                DEBUG_ERR("Synchronization error - incorrect counter distance [%d]\n", counter_distance);
-                return FLR_ERROR;
-            }
+                slot = &receiveWindow[(controller.receive_head+counter_distance)%DATA_WINDOW_MAX];
+                if(!slot->in_flight)
+                {
+                    memcpy(slot->frame.buffer, data, data_len);
+                    slot->frame.size = data_len;
+                    slot->in_flight = 1;
+                }
 
-        case DATA_ACK:
-            /** compare received counter with send counter if the same increment send counter */
-            if(receiveFrame.counter == controller.send_counter)
-            {
-                controller.send_counter = (controller.send_counter+1)%MAX_COUNTER_VALUE;
-                controller.state = CONTROLLER_READY;
+                if(sendAck(receiveFrame.counter) != FLR_OK)
+                {
+                    DEBUG_ERR("Send ACK error occurred\n");
+                    return FLR_ERROR;
+                }
 
                 return FLR_OK;
             }
             /* synchronization error */
             else
             {
-                DEBUG_ERR("Synchronization error\n");
+                DEBUG_ERR("Synchronization error - incorrect counter distance [%d]\n", counter_distance);
                 return FLR_ERROR;
             }
 
+        case DATA_ACK:
+            return markAck(receiveFrame.counter);
+
         case COMMUNICATION_RESET_ACK:
             controller.state = CONTROLLER_READY;
             return FLR_OK;
@@ -295,10 +416,34 @@ FLR_RESULT dataServiceClientRegisterCallback(receive_callback callback)
     return FLR_OK;
 }
 
+/******************************************************************************/
+FLR_RESULT dataServiceClientSetWindow(uint16_t window)
+{
+    if(!window || window > DATA_WINDOW_MAX)
+    {
+        DEBUG_ERR("Incorrect arguments - window size %d\n", window);
+        return FLR_RANGE_ERROR;
+    }
+    if(controller.send_pending)
+    {
+        DEBUG_ERR("Send in progress\n");
+        return FLR_ERROR;
+    }
+    controller.window = window;
+
+    return FLR_OK;
+}
+
 /******************************************************************************/
 FLR_RESULT dataServiceClientSend(uint8_t* data, uint32_t data_len, uint32_t* data_len_out)
 {
+    dataServiceWindowSlot_t *slot;
+    uint32_t queued = 0;
     uint32_t timeout = 0;
+    uint32_t frame_len;
+    uint32_t released = 0;
+    uint32_t acked, acked_prev = 0;
+    uint16_t i;
 
     if(!data || !data_len || !data_len_out)
     {
@@ -308,41 +453,116 @@ FLR_RESULT dataServiceClientSend(uint8_t* data, uint32_t data_len, uint32_t* dat
 
     *data_len_out = 0;
 
-    if(data_len > MAX_PAYLOAD_BYTES - 3)
+    while(1)
     {
-       data_len = MAX_PAYLOAD_BYTES - 3;
-    }
+        /** slide window over acknowledged frames */
+        while(controller.send_pending && sendWindow[controller.send_head].acked)
+        {
+            slot = &sendWindow[controller.send_head];
+            slot->in_flight = 0;
+            *data_len_out += slot->frame.size - 2;
+
+            controller.send_head = (controller.send_head+1)%DATA_WINDOW_MAX;
+            controller.send_pending--;
+            released++;
+        }
+
+        if(queued == data_len && !controller.send_pending)
+        {
+            break;
+        }
+
+        /** fill window with new frames */
+        while(queued < data_len && controller.send_pending < controller.window)
+        {
+            frame_len = data_len - queued;
+            if(frame_len > MAX_PAYLOAD_BYTES - 3)
+            {
+                frame_len = MAX_PAYLOAD_BYTES - 3;
+            }
 
-    prepareFrame(DATA_SEND, controller.send_counter, data, data_len);
+            slot = &sendWindow[(controller.send_head+controller.send_pending)%DATA_WINDOW_MAX];
+            prepareFrame(&slot->frame, DATA_SEND, controller.send_counter, &data[queued], frame_len);
+            slot->acked = 0;
+            slot->resend = 0;
+            slot->resent = 0;
+            slot->in_flight = 1;
 
-    if(sendData(sendFrame.buffer, sendFrame.size) != FLR_OK)
-    {
-        DEBUG_ERR("Send data error occurred\n");
-        return FLR_ERROR;
-    }
+            controller.state = CONTROLLER_ACK_WAIT;
+            controller.send_counter = nextCounter(controller.send_counter);
+            controller.send_pending++;
+            queued += frame_len;
 
-    controller.state = CONTROLLER_ACK_WAIT;
+            if(sendData(slot->frame.buffer, slot->frame.size) != FLR_OK)
+            {
+                DEBUG_ERR("Send data error occurred\n");
+                return FLR_ERROR;
+            }
+        }
+
+        /** any new ACK is progress: restart timeout */
+        acked = released;
+        for(i = 0; i < controller.send_pending; i++)
+        {
+            acked += sendWindow[(controller.send_head+i)%DATA_WINDOW_MAX].acked;
+        }
+        if(acked != acked_prev)
+        {
+            acked_prev = acked;
+            timeout = 0;
+        }
+
+        /** selective retransmission: frames left behind by a later ACK right away,
+            every unacknowledged frame once no ACK came for DATA_RETRANSMIT_TIMEOUT_MS */
+        for(i = 0; i < controller.send_pending; i++)
+        {
+            slot = &sendWindow[(controller.send_head+i)%DATA_WINDOW_MAX];
+            if(slot->acked)
+            {
+                continue;
+            }
+            if(slot->resend)
+            {
+                slot->resend = 0;
+                slot->resent = 1;
+            }
+            else if(timeout && !(timeout % DATA_RETRANSMIT_TIMEOUT_MS))
+            {
+                slot->resent = 0;
+            }
+            else
+            {
+                continue;
+            }
+
+            DO_DATA_SERVICE_TRACE("Retransmit frame [%d]\n", slot->frame.counter);
+            if(sendData(slot->frame.buffer, slot->frame.size) != FLR_OK)
+            {
+                DEBUG_ERR("Send data error occurred\n");
+                return FLR_ERROR;
+            }
+        }
+
+        /** timeout: rewind to first unacknowledged frame, next call sends from there */
+        if(timeout >= DATA_SEND_TIMEOUT_MS)
+        {
+            for(i = 0; i < DATA_WINDOW_MAX; i++)
+            {
+                sendWindow[i].in_flight = 0;
+            }
+            controller.send_counter = (uint16_t)((controller.send_counter + MAX_COUNTER_VALUE -
+                                                 controller.send_pending) % MAX_COUNTER_VALUE);
+            controller.send_pending = 0;
+            controller.state = CONTROLLER_READY;
+            DO_TRACE("Send data timeout\n");
+            return FLR_COMM_TIMEOUT_ERROR;
+        }
 
-    /** wait for ACK */
-    while ((controller.state == CONTROLLER_ACK_WAIT) && (timeout < DATA_SEND_TIMEOUT_MS))
-    {
         timeout++;
         usleep(1000);
     }
 
-    /** ACK received */
-    if(controller.state == CONTROLLER_READY)
-    {
-        *data_len_out = data_len;
-    }
-    /** timeout */
-    else
-    {
-       controller.state = CONTROLLER_READY;
-       DO_TRACE("Send data timeout\n");
-       return FLR_COMM_TIMEOUT_ERROR;
-    }
-
+    controller.state = CONTROLLER_READY;
     return FLR_OK;
 }
 
@@ -369,7 +589,7 @@ FLR_RESULT dataServiceClientReset(void)
 {
     uint32_t timeout = 0;
 
-    prepareFrame(COMMUNICATION_RESET, 0, NULL, 0);
+    prepareFrame(&sendFrame, COMMUNICATION_RESET, 0, NULL, 0);
 
     if(sendData(sendFrame.buffer, sendFrame.size) != FLR_OK)
     {
@@ -27,9 +27,16 @@
  * 3. register receive HostBinaryProtcol callback by set dataServiceClientReceive()
  *    function as an argument in RegisterServiceDataCallback() call
  * 3. send your data by dataServiceClientSend() function
+ *    (optionally set number of frames in flight by dataServiceClientSetWindow())
  * 4. on data receive: callback function with number of receive bytes
  *    will be called. Read receive data buffer by dataServiceClientRead() function
  * 5. reset communication by call dataServiceClientReset()
+ *
+ * Send keeps up to window frames in flight instead of waiting for ACK of each.
+ * Every frame is confirmed by its own ACK, so only lost frames are sent again:
+ * at once when a later frame is confirmed, otherwise after
+ * DATA_RETRANSMIT_TIMEOUT_MS without any ACK. Window 1 is plain stop-and-wait.
+ * Frames received ahead of a lost one are held and delivered in order.
  */
 
 #ifndef _DATA_SERVICE_H
@@ -51,6 +58,9 @@
 #define COUNTER_MASK                    0x3F
 #define MAX_COUNTER_VALUE               0x3FFF
 #define DATA_SEND_TIMEOUT_MS            3000
+#define DATA_RETRANSMIT_TIMEOUT_MS      250
+#define DATA_WINDOW_MAX                 16
+#define DATA_WINDOW_DEFAULT             8
 #define DATA_BUFFER_SIZE                UINT16_MAX
 
 /******************************************************************************/
@@ -85,7 +95,11 @@ typedef enum {
 */
 typedef struct {
     uint16_t send_counter;          ///< Send data counter
+    uint16_t send_head;             ///< Send window slot of oldest frame in flight
+    uint16_t send_pending;          ///< Frames in flight
+    uint16_t window;                ///< Maximum frames in flight
     uint16_t receive_counter;       ///< Received data counter
+    uint16_t receive_head;          ///< Receive window slot of next expected frame
     dataServiceControllerState_t state;     /**< Controller state */
     receive_callback callback;              /**< Received data callback */
 } dataServiceController_t, *dataServiceController_p;
@@ -100,6 +114,17 @@ typedef struct {
     uint32_t size;                          /**< Frame buffer size */
 } dataServiceFrame_t, *dataServiceFrame_p;
 
+/**
+ * @brief Send / receive window slot structure
+*/
+typedef struct {
+    dataServiceFrame_t frame;               /**< Frame as sent / received */
+    volatile uint8_t in_flight;             /**< Slot holds a frame */
+    volatile uint8_t acked;                 /**< ACK received for frame */
+    volatile uint8_t resend;                /**< Frame left behind by later ACK */
+    uint8_t resent;                         /**< Frame already resent for a later ACK */
+} dataServiceWindowSlot_t, *dataServiceWindowSlot_p;
+
 /******************************************************************************/
 /** EXPORTED PUBLIC FUNCTIONS                                                **/
 /******************************************************************************/
@@ -124,13 +149,25 @@ FLR_RESULT dataServiceClientRegisterCallback(receive_callback callback);
 /**
  * @brief Data send
 
+ * Split data in frames and send them in window, return when all frames
+ * are confirmed or on timeout
  * @param [in] data - send data buffer
  * @param [in] data_len - send data size in bytes
- * @param [out] data_len_out - pointer to number of bytes which are properly sent
+ * @param [out] data_len_out - pointer to number of bytes which are properly sent,
+ *                              on timeout the confirmed part of data
  * @return FLR_OK if successful else return error
  */
 FLR_RESULT dataServiceClientSend(uint8_t* data, uint32_t data_len, uint32_t* data_len_out);
 
+/**
+ * @brief Set send window
+
+ * Number of frames dataServiceClientSend() keeps in flight
+ * @param [in] window - 1 to DATA_WINDOW_MAX, DATA_WINDOW_DEFAULT after init
+ * @return FLR_OK if successful else return error
+ */
+FLR_RESULT dataServiceClientSetWindow(uint16_t window);
+
 /**
  * @brief Data read
 
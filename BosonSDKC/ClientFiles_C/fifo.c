@@ -32,14 +32,28 @@
 /******************************************************************************/
 /** EXPORTED DEFINES                                                         **/
 /******************************************************************************/
-#define DO_TRACE(s, ...)                //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DO_INIT_TRACE(s, ...)           //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DO_DATA_SERVICE_TRACE(s, ...)   //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DEBUG_ERR(s, ...)               printf("%s: " s, __FUNCTION__, __VA_ARGS__)
-#define DEBUG_WARN(s, ...)              //printf("%s: " s, __FUNCTION__, __VA_ARGS__)
+#define DO_TRACE(s, ...)                //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DO_INIT_TRACE(s, ...)           //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DO_DATA_SERVICE_TRACE(s, ...)   //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DEBUG_ERR(s, ...)               printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
+#define DEBUG_WARN(s, ...)              //printf("%s: " s, __FUNCTION__, ##__VA_ARGS__)
 
 #define MIN(a,b) ((a) < (b) ? (a) : (b))
 
+/*
+ * Index publication. The producer stores head after the data and the
+ * consumer loads it before the data, and the reverse for tail. Compilers
+ * without the GCC builtins (tcc) target x86 only, where plain volatile
+ * accesses already have acquire/release ordering.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define LOAD_ACQUIRE(p)         __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, v)     __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define LOAD_ACQUIRE(p)         (*(volatile uint32_t *)(p))
+#define STORE_RELEASE(p, v)     (*(volatile uint32_t *)(p) = (v))
+#endif
+
 /******************************************************************************/
 /** EXPORTED PUBLIC FUNCTIONS                                                **/
 /******************************************************************************/
@@ -48,13 +62,19 @@
 fifo_p fifoCreate(uint32_t size)
 {
     fifo_p fifo;
+    uint32_t capacity = 1;
 
-    if(size < 1)
+    if(size < 1 || size > 0x80000000u)
     {
-       DEBUG_ERR("Incorrect argument - buffer size smaller than 1\n");
+       DEBUG_ERR("Incorrect argument - buffer size [%u] out of range\n", size);
         return NULL;
     }
 
+    while(capacity < size)
+    {
+        capacity <<= 1;
+    }
+
     fifo = malloc(sizeof(fifo_t));
     if(!fifo)
     {
@@ -62,24 +82,16 @@ fifo_p fifoCreate(uint32_t size)
         return NULL;
     }
 
-    fifo->head = fifo->tail =  fifo->length = 0;
-    fifo->buffer = malloc(size * sizeof(uint8_t));
+    fifo->head = fifo->tail = 0;
+    fifo->buffer = calloc(capacity, sizeof(uint8_t));
     if(!fifo->buffer)
     {
         free(fifo);
         DEBUG_ERR("Fifo buffer memory allocation error occurred\n");
         return NULL;
     }
-    fifo->size = size;
-    memset(fifo->buffer, 0, sizeof(fifo->buffer));
-
-    if(pthread_mutex_init(&fifo->buffer_mutex, NULL) != 0)
-    {
-        free(fifo->buffer);
-        free(fifo);
-        DEBUG_ERR("Mutex initalization error occurred\n");
-        return NULL;
-    }
+    fifo->size = capacity;
+    fifo->mask = capacity - 1;
 
     return fifo;
 }
@@ -87,7 +99,7 @@ fifo_p fifoCreate(uint32_t size)
 /******************************************************************************/
 void fifoDestroy(fifo_p fifo)
 {
-    if(!fifo)
+    if(fifo)
     {
         free(fifo->buffer);
         free(fifo);
@@ -95,70 +107,81 @@ void fifoDestroy(fifo_p fifo)
 }
 
 /******************************************************************************/
-FLR_RESULT fifoWrite(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* data_len_out)
+uint32_t fifoWriteSpans(fifo_p fifo, uint8_t **span1, uint32_t *len1, uint8_t **span2, uint32_t *len2)
 {
-    uint32_t part;
-    int ret = 0;
+    /* head is ours, tail is published by the consumer */
+    uint32_t head = fifo->head;
+    uint32_t space = fifo->size - (head - LOAD_ACQUIRE(&fifo->tail));
+    uint32_t offset = head & fifo->mask;
 
-    if(!fifo || !data || !data_len || !data_len_out)
-    {
-       DEBUG_ERR("Incorrect arguments\n");
-        return FLR_ERROR;
-    }
+    *span1 = &fifo->buffer[offset];
+    *len1 = MIN(space, fifo->size - offset);
+    *span2 = fifo->buffer;
+    *len2 = space - *len1;
 
-    /** check buffer is full */
-    if(fifo->length == fifo->size)
-    {
-        *data_len_out = 0;
-        return FLR_OK;
-    }
+    return space;
+}
 
-    ret = pthread_mutex_lock(&fifo->buffer_mutex);
-    if(ret != 0)
-    {
-        DEBUG_ERR("Lock FIFO mutex error occurred [%d]\n", ret);
-        return FLR_ERROR;
-    }
+/******************************************************************************/
+void fifoWriteCommit(fifo_p fifo, uint32_t data_len)
+{
+    STORE_RELEASE(&fifo->head, fifo->head + data_len);
+}
 
-    /* set possible data length to write */
-    data_len = MIN(data_len, (fifo->size - fifo->length));
-    *data_len_out = data_len;
+/******************************************************************************/
+uint32_t fifoReadSpans(fifo_p fifo, const uint8_t **span1, uint32_t *len1, const uint8_t **span2, uint32_t *len2)
+{
+    /* tail is ours, head is published by the producer */
+    uint32_t tail = fifo->tail;
+    uint32_t length = LOAD_ACQUIRE(&fifo->head) - tail;
+    uint32_t offset = tail & fifo->mask;
 
-    /* set data from head to buffer end or tail */
-    part = MIN(data_len, fifo->size - fifo->head);
-    memcpy(&fifo->buffer[fifo->head], data, part);
-    fifo->head += part;
+    *span1 = &fifo->buffer[offset];
+    *len1 = MIN(length, fifo->size - offset);
+    *span2 = fifo->buffer;
+    *len2 = length - *len1;
 
-    /* set data from buffer beginning if it is necessary */
-    if(part < data_len)
-    {
-        memcpy(fifo->buffer, data + part, data_len - part);
-        fifo->head = data_len - part;
-    }
+    return length;
+}
 
-    if(fifo->head == fifo->size)
-    {
-        fifo->head = 0;
-    }
+/******************************************************************************/
+void fifoReadConsume(fifo_p fifo, uint32_t data_len)
+{
+    STORE_RELEASE(&fifo->tail, fifo->tail + data_len);
+}
 
-    /* update buffer length */
-    fifo->length+=data_len;
+/******************************************************************************/
+FLR_RESULT fifoWrite(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* data_len_out)
+{
+    uint8_t *span1, *span2;
+    uint32_t len1, len2, part, space;
 
-    ret = pthread_mutex_unlock(&fifo->buffer_mutex);
-    if(ret != 0)
+    if(!fifo || !data || !data_len || !data_len_out)
     {
-        DEBUG_ERR("Unlock FIFO mutex error occurred [%d]\n", ret);
+       DEBUG_ERR("Incorrect arguments\n");
         return FLR_ERROR;
     }
 
+    /* set possible data length to write */
+    space = fifoWriteSpans(fifo, &span1, &len1, &span2, &len2);
+    data_len = MIN(data_len, space);
+    *data_len_out = data_len;
+
+    /* set data from head to buffer end, then from buffer beginning */
+    part = MIN(data_len, len1);
+    memcpy(span1, data, part);
+    memcpy(span2, data + part, data_len - part);
+
+    fifoWriteCommit(fifo, data_len);
+
     return FLR_OK;
 }
 
 /******************************************************************************/
 FLR_RESULT fifoRead(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* data_len_out)
 {
-    uint32_t part;
-    int ret = 0;
+    const uint8_t *span1, *span2;
+    uint32_t len1, len2, part, length;
 
     if(!fifo || !data || !data_len || !data_len_out)
     {
@@ -166,50 +189,17 @@ FLR_RESULT fifoRead(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* dat
         return FLR_ERROR;
     }
 
-    /** check buffer is empty */
-    if(fifo->length == 0)
-    {
-        *data_len_out = 0;
-        return FLR_OK;
-    }
-
-    ret = pthread_mutex_lock(&fifo->buffer_mutex);
-    if(ret != 0)
-    {
-        DEBUG_ERR("Lock FIFO mutex error occurred [%d]\n", ret);
-        return FLR_ERROR;
-    }
-
     /* set possible data length to read */
-    data_len = MIN(data_len, fifo->length);
+    length = fifoReadSpans(fifo, &span1, &len1, &span2, &len2);
+    data_len = MIN(data_len, length);
     *data_len_out = data_len;
 
-    /* get data from tail to buffer end or head */
-    part = MIN(data_len, fifo->size - fifo->tail);
-    memcpy(data, &fifo->buffer[fifo->tail], part);
-    fifo->tail += part;
-
-    /* get data from buffer beginning if it is necessary */
-    if(part < data_len)
-    {
-        memcpy(&data[part], fifo->buffer, data_len - part);
-        fifo->tail = data_len - part;
-    }
-
-    if(fifo->tail == fifo->size)
-    {
-        fifo->tail = 0;
-    }
-
-    /* update buffer length */
-    fifo->length-=data_len;
+    /* get data from tail to buffer end, then from buffer beginning */
+    part = MIN(data_len, len1);
+    memcpy(data, span1, part);
+    memcpy(&data[part], span2, data_len - part);
 
-    ret = pthread_mutex_unlock(&fifo->buffer_mutex);
-    if(ret != 0)
-    {
-        DEBUG_ERR("Unlock FIFO mutex error occurred [%d]\n", ret);
-        return FLR_ERROR;
-    }
+    fifoReadConsume(fifo, data_len);
 
     return FLR_OK;
 }
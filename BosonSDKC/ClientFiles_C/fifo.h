@@ -18,8 +18,9 @@
  * @date   May, 2017
  * @brief  FIFO implementation header file
  *
- * Simple FIFO implementation with the ability to create a buffer of any size
- * and thread safe operation on it.
+ * Single-producer/single-consumer FIFO. One thread may write while another
+ * reads without locking: each side owns one index and publishes it with
+ * release ordering. Several writers or several readers need their own lock.
  */
 
 #ifndef _FIFO_H_
@@ -29,7 +30,6 @@
 /** INCLUDE FILES                                                            **/
 /******************************************************************************/
 #include <stdint.h>
-#include <pthread.h>
 #include "ReturnCodes.h"
 
 /******************************************************************************/
@@ -40,12 +40,11 @@
  * @brief FIFO data structure
 */
 typedef struct {
-    uint32_t head;                                   /**< Buffer head index */
-    uint32_t tail;                                   /**< Buffer tail index */
-    uint32_t size;                                   /**< Buffer size */
-    uint32_t length;                                 /**< Buffer data length */
+    uint32_t head;                                   /**< Bytes ever written, producer owned */
+    uint32_t tail;                                   /**< Bytes ever read, consumer owned */
+    uint32_t size;                                   /**< Buffer size, power of two */
+    uint32_t mask;                                   /**< size - 1, wraps the indexes */
     uint8_t *buffer;                                 /**< Data buffer */
-    pthread_mutex_t buffer_mutex;                    /**< Buffer control mutex */
 } fifo_t, *fifo_p;
 
 /******************************************************************************/
@@ -56,7 +55,7 @@ typedef struct {
  * @brief FIFO Create
 
  * Initialization FIFO structure, allocate memeory, set default parameters value
- * @param [in] size - FIFO buffer size
+ * @param [in] size - FIFO buffer size, rounded up to a power of two
  * @return pointer to initialized fifo structure
  */
 fifo_p fifoCreate(uint32_t size);
@@ -73,7 +72,7 @@ void fifoDestroy(fifo_p fifo);
 /**
  * @brief Write data to FIFO
 
- * Write data to FIFO buffer, thread safe
+ * Write data to FIFO buffer, producer side, never blocks
  * @param [out] fifo - pointer to fifo structure
  * @param [in] data - write data pointer
  * @param [in] data_len - write data size in bytes
@@ -85,7 +84,7 @@ FLR_RESULT fifoWrite(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* da
 /**
  * @brief Read data from fifo
 
- * Read data from FIFO buffer, thread safe
+ * Read data from FIFO buffer, consumer side, never blocks
  * @param [out] fifo - pointer to fifo structure
  * @param [in] data - read data pointer
  * @param [in] data_len - read data size in bytes
@@ -94,4 +93,50 @@ FLR_RESULT fifoWrite(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* da
  */
 FLR_RESULT fifoRead(fifo_p fifo, uint8_t* data, uint32_t data_len, uint32_t* data_len_out);
 
+/**
+ * @brief Free space of FIFO as contiguous spans
+
+ * Producer side. Free space wraps at most once, so it is returned as up to
+ * two spans; fill them in order and publish the bytes with fifoWriteCommit
+ * @param [in] fifo - pointer to fifo structure
+ * @param [out] span1 - first free byte
+ * @param [out] len1 - length of the first span
+ * @param [out] span2 - buffer start, continues the first span
+ * @param [out] len2 - length of the second span, 0 if the space does not wrap
+ * @return total free space in bytes
+ */
+uint32_t fifoWriteSpans(fifo_p fifo, uint8_t **span1, uint32_t *len1, uint8_t **span2, uint32_t *len2);
+
+/**
+ * @brief Publish bytes written into the free spans
+
+ * @param [out] fifo - pointer to fifo structure
+ * @param [in] data_len - bytes written, at most the fifoWriteSpans total
+ * @return none
+ */
+void fifoWriteCommit(fifo_p fifo, uint32_t data_len);
+
+/**
+ * @brief Stored data of FIFO as contiguous spans
+
+ * Consumer side, the counterpart of fifoWriteSpans; release the bytes with
+ * fifoReadConsume once they have been used
+ * @param [in] fifo - pointer to fifo structure
+ * @param [out] span1 - oldest stored byte
+ * @param [out] len1 - length of the first span
+ * @param [out] span2 - buffer start, continues the first span
+ * @param [out] len2 - length of the second span, 0 if the data does not wrap
+ * @return total stored data in bytes
+ */
+uint32_t fifoReadSpans(fifo_p fifo, const uint8_t **span1, uint32_t *len1, const uint8_t **span2, uint32_t *len2);
+
+/**
+ * @brief Release bytes read from the data spans
+
+ * @param [out] fifo - pointer to fifo structure
+ * @param [in] data_len - bytes used, at most the fifoReadSpans total
+ * @return none
+ */
+void fifoReadConsume(fifo_p fifo, uint32_t data_len);
+
 #endif // _FIFO_H_
@@ -1,4 +1,6 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #include "FSLP.h"
 #include "flirCRC.h"
@@ -23,14 +25,10 @@
 #define FRAME_START_IDX 1
 #define CRC_START_IDX 0
 
-#define FRAME_BUF_SIZ      2048
+#define FRAME_BUF_SIZ      FSLP_FRAME_BUF_SIZ
 
-#define FRAME_TIMEOUT_SEC   2.000
-#define POLL_TIMEOUT_SEC   0.025
-#define BYTE_TIMEOUT_SEC    0.005
-
-static uint8_t in_frame_buf[FRAME_BUF_SIZ];
-static uint8_t out_frame_buf[FRAME_BUF_SIZ];
+#define FRAME_TIMEOUT_MS    2000
+#define POLL_TIMEOUT_MS     25
 
 enum frame_state_e {
     UNFRAMED = 0,
@@ -39,11 +37,50 @@ enum frame_state_e {
 };
 typedef enum frame_state_e frame_state;
 
-static uint8_t other_frame_ID;
+/*
+ * Everything a port reads or frames through, so different ports can be
+ * driven from different threads. Allocated on first use of the port; one
+ * port is still driven by one thread at a time.
+ */
+typedef struct {
+    uint8_t in_frame_buf[FRAME_BUF_SIZ];
+    uint8_t out_frame_buf[FRAME_BUF_SIZ];
+    uint8_t other_frame_ID;
+    CHANNEL_T channels[NUM_CHANNELS];
+    // FSLP_pump() parser, kept between calls
+    uint8_t pump_buf[FRAME_BUF_SIZ];
+    uint32_t pump_len;
+    uint8_t pump_in_frame;
+    uint8_t pump_escape;
+    // monotonic_ns() when FSLP_read_frame() saw the last start byte, 0 if
+    // the frame was already buffered
+    int64_t start_byte_ns;
+} PORT_STATE;
+
+static PORT_STATE *port_states[FSLP_MAX_PORTS];
+
+static PORT_STATE *get_port_state(int32_t port_num)
+{
+    if ((port_num < 0) || (port_num >= FSLP_MAX_PORTS))
+        return NULL;
+    if (!port_states[port_num]) {
+        port_states[port_num] = calloc(1, sizeof(PORT_STATE));
+        if (port_states[port_num])
+            initialize_channels(port_states[port_num]->channels);
+    }
+    return port_states[port_num];
+}
 
-static int16_t read_single_byte(int32_t port_num)
+// Bytes that must be escaped inside a frame
+static const uint8_t needs_escape_tbl[256] = {
+    [START_FRAME_BYTE] = ESCAPED_START_FRAME_BYTE,
+    [END_FRAME_BYTE]   = ESCAPED_END_FRAME_BYTE,
+    [ESCAPE_BYTE]      = ESCAPED_ESCAPE_BYTE,
+};
+
+static int16_t read_single_byte(int32_t port_num, int64_t deadline)
 {
-    return FSLP_read_byte_with_timeout(port_num, BYTE_TIMEOUT_SEC);
+    return FSLP_read_byte_by_deadline(port_num, deadline);
 }
 
 // defined by serialPortAdapter
@@ -51,13 +88,9 @@ static int16_t read_single_byte(int32_t port_num)
 
 static void extract_payload(uint8_t* raw_payload_buf, uint32_t raw_payload_len, uint8_t* payload_buf, uint32_t* payload_len)
 {
-    uint32_t i;
-
-    for(*payload_len=0, i=0; i < raw_payload_len; i++)
-    {
-        // if (raw_payload_buf[i] == ESCAPE_BYTE) i++;
-        payload_buf[(*payload_len)++] = raw_payload_buf[i];
-    }
+    // already unescaped by the read state machine
+    memcpy(payload_buf, raw_payload_buf, raw_payload_len);
+    *payload_len = raw_payload_len;
 }
 
 int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte_ms,uint32_t *receiveBytes, uint8_t *receiveBuffer)
@@ -69,15 +102,24 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
     uint8_t c;
     // uint8_t failedcrc = 0;
     uint16_t calc_crc;
+    PORT_STATE *port = get_port_state(port_num);
+    CHANNEL_T *chan_ptr, *unframed_ptr;
+    uint8_t *in_frame_buf;
+
+    *receiveBytes =  0;
+    if (!port)
+        return -1;
+    in_frame_buf = port->in_frame_buf;
+    port->start_byte_ns = 0;
 
-    if (get_channel(channel_ID, &chan_ptr))
+    if (get_channel(port->channels, channel_ID, &chan_ptr))
         DO_ERROR_TRACE("Channel not found for channel_ID [0x%02x]\n", channel_ID);
-    get_unframed(&unframed_ptr);
+    get_unframed(port->channels, &unframed_ptr);
 
-    struct timespec start_t,current_t;
-    double elapsed_sec;
-    clock_gettime(CLOCK_MONOTONIC, &start_t);
-    double timeout = (double)start_byte_ms/1000.0;
+    // one absolute deadline, moved on at a start byte or a bad frame; the
+    // per-byte path never reads the clock
+    uint32_t timeout_ms = start_byte_ms;
+    int64_t deadline;
     *receiveBytes =  0;
 
     if (chan_ptr && (chan_ptr->len > 0)) {
@@ -86,7 +128,7 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
         DO_DEBUG_TRACE("POLL buffer start = %d, len = %d \n", chan_ptr->start, chan_ptr->len);
         DO_DEBUG_TRACE("current buffer[20] : ");
         for (j = 0; j < 20; j++){
-            i = ( (chan_ptr->start + j ) % CHANNEL_BUF_SIZ);
+            i = ( (chan_ptr->start + j ) & CHANNEL_BUF_MASK);
             DO_DEBUG_TRACE(" %02X", chan_ptr->buff[i]);
         }
         DO_DEBUG_TRACE("\n");
@@ -108,8 +150,8 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
             {
                 DO_DEBUG_TRACE("     POLL_RX_BUF StartByte \n ");
 
-                timeout = FRAME_TIMEOUT_SEC;
-                DO_VERBOSE_TRACE("Setting timeout to FRAME_TIMEOUT_SEC\n");
+                timeout_ms = FRAME_TIMEOUT_MS;
+                DO_VERBOSE_TRACE("Setting timeout to FRAME_TIMEOUT_MS\n");
                 byte_idx = 0;
                 am_in_frame = CORRECT_FRAME;
                 DO_VERBOSE_TRACE("Am in CORRECT_FRAME\n");
@@ -175,8 +217,8 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
                         // failedcrc = 1;
                         byte_idx = 0;
 
-                        timeout = POLL_TIMEOUT_SEC;
-                        DO_VERBOSE_TRACE("Setting timeout to POLL_TIMEOUT_SEC\n");
+                        timeout_ms = POLL_TIMEOUT_MS;
+                        DO_VERBOSE_TRACE("Setting timeout to POLL_TIMEOUT_MS\n");
                         DO_VERBOSE_TRACE("Continuing (to get_byte stage)\n");
                         continue;
                     } else {
@@ -210,7 +252,7 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
 
     DO_DEBUG_TRACE("Entering serial loop...\n");
 
-    clock_gettime(CLOCK_MONOTONIC, &start_t);
+    deadline = deadline_after_ms(timeout_ms);
     while(1)
     {
         // if (failedcrc){
@@ -223,17 +265,27 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
             return -1;
         }
 
-        clock_gettime(CLOCK_MONOTONIC, &current_t);
-        elapsed_sec = diff_timespec(&current_t, &start_t);
+        if (in_escape && (am_in_frame == CORRECT_FRAME)) {
+            //carryover escape character from buffer
+            tempval = ESCAPE_BYTE;
+        } else {
+            //normal operations
+            tempval = read_single_byte(port_num, deadline);
+        }
+
+        if (tempval<0) {
+            if (deadline_remaining_ns(deadline) > 0) {
+                DO_VERBOSE_TRACE("read_byte woke before the deadline\n");
+                DO_VERBOSE_TRACE("Continuing...\n");
+                continue;
+            }
 
-        // The whole thing has been taking too long
-        if (elapsed_sec >= timeout){
-            DO_DEBUG_TRACE("Frame reading has been taking too long [%f]\n", elapsed_sec);
-            DO_ERROR_TRACE("Timeout: %f s\n", elapsed_sec);
+            // The whole thing has been taking too long
+            DO_ERROR_TRACE("Timeout: %u ms\n", timeout_ms);
 
             if (am_in_frame == CORRECT_FRAME) {
                 int i;
-                DO_VERBOSE_TRACE("Timeout while in CORRECT_FRAME: %f s\n", elapsed_sec);
+                DO_VERBOSE_TRACE("Timeout while in CORRECT_FRAME\n");
 
                 DO_ERROR_TRACE("Received frame fragment - len:[%d] : ", byte_idx);
                 for (i = 0; i < byte_idx; i++){
@@ -241,28 +293,12 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
                 }
                 DO_ERROR_TRACE("\n");
             } else {
-                DO_VERBOSE_TRACE("Timeout while in %s: %f s\n", (am_in_frame) ? "OTHER_FRAME" : "UNFRAMED", elapsed_sec);
+                DO_VERBOSE_TRACE("Timeout while in %s\n", (am_in_frame) ? "OTHER_FRAME" : "UNFRAMED");
             }
 
             *receiveBytes =  0;
             am_in_frame = UNFRAMED;
             return -1;
-        }
-
-        if (in_escape && (am_in_frame == CORRECT_FRAME)) {
-            //carryover escape character from buffer
-            tempval = ESCAPE_BYTE;
-        } else {
-            //normal operations
-            tempval = read_single_byte(port_num);
-        }
-
-        if (tempval<0) {
-            clock_gettime(CLOCK_MONOTONIC, &current_t);
-            elapsed_sec = diff_timespec(&current_t, &start_t);
-            DO_VERBOSE_TRACE("Timeout in read_byte; current frame read time %f\n", elapsed_sec);
-            DO_VERBOSE_TRACE("Continuing...\n");
-            continue; //byte read timeout.
         } else {
             c = (uint8_t) tempval;
             DO_VERBOSE_TRACE("Next byte: [0x%02x]\n", c);
@@ -270,28 +306,22 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
 
         if ((c & 0xFF) == (START_FRAME_BYTE & 0xFF))
         {
-            DO_DEBUG_TRACE("     StartByte time %f:\n     ",elapsed_sec);
+            DO_DEBUG_TRACE("     StartByte\n     ");
 
-            DO_VERBOSE_TRACE("Setting timeout to FRAME_TIMEOUT_SEC=%f\n",FRAME_TIMEOUT_SEC);
-            timeout = FRAME_TIMEOUT_SEC;
-            DO_VERBOSE_TRACE("Resetting start time from %f to %f\n",start_t,current_t);
-            start_t = current_t;
+            DO_VERBOSE_TRACE("Setting timeout to FRAME_TIMEOUT_MS=%d\n",FRAME_TIMEOUT_MS);
+            timeout_ms = FRAME_TIMEOUT_MS;
+            port->start_byte_ns = monotonic_ns();
+            deadline = port->start_byte_ns + (int64_t) timeout_ms * 1000000;
             
             byte_idx = 0;
             do {
-                clock_gettime(CLOCK_MONOTONIC, &current_t);
-                elapsed_sec = diff_timespec(&current_t, &start_t);
-                if (elapsed_sec > timeout) {
-                    DO_DEBUG_TRACE("Abort waiting for channel ID at %f of %f seconds\n",elapsed_sec,timeout);
-                    break;
-                }
-                tempval = read_single_byte(port_num);
+                tempval = read_single_byte(port_num, deadline);
                 if ( (tempval & 0xFF) == (START_FRAME_BYTE & 0xFF) )
                 {
                     DO_DEBUG_TRACE("Weird Byte 0x%X\n",tempval);
                     tempval = -1;
                 }
-            } while (tempval < 0);
+            } while ((tempval < 0) && (deadline_remaining_ns(deadline) > 0));
             if (tempval < 0) {
                 DO_VERBOSE_TRACE("Timeout in read_byte\n");
                 DO_VERBOSE_TRACE("Continuing...\n");
@@ -304,19 +334,13 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
                 DO_DEBUG_TRACE("ESCAPE char before channel byte\n");
                 needs_escape = 1;
                 do {
-                    clock_gettime(CLOCK_MONOTONIC, &current_t);
-                    elapsed_sec = diff_timespec(&current_t, &start_t);
-                    if (elapsed_sec > timeout) {
-                        DO_DEBUG_TRACE("Abort waiting for escaped channel ID at %f of %f seconds\n",elapsed_sec,timeout);
-                        break;
-                    }
-                    tempval = read_single_byte(port_num);
+                    tempval = read_single_byte(port_num, deadline);
                     if ( (tempval & 0xFF) == (START_FRAME_BYTE & 0xFF) )
                         {
                             DO_DEBUG_TRACE("Escaped channel Byte 0x%X\n",tempval);
                             tempval = -1;
                         }
-                } while (tempval < 0);
+                } while ((tempval < 0) && (deadline_remaining_ns(deadline) > 0));
                 if (tempval < 0) {
                     DO_VERBOSE_TRACE("Timeout in read_byte\n");
                     DO_VERBOSE_TRACE("Continuing...\n");
@@ -334,10 +358,10 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
             } else {
                 DO_VERBOSE_TRACE("Am in OTHER_FRAME (0x%02x)\n", c);
                 am_in_frame = OTHER_FRAME;
-                other_frame_ID = c;
-                get_channel(other_frame_ID, &chan_ptr);
+                port->other_frame_ID = c;
+                get_channel(port->channels, port->other_frame_ID, &chan_ptr);
                 if (!chan_ptr){
-                    DO_ERROR_TRACE("Incoming frame's channel (0x%02x) not found\n", other_frame_ID);
+                    DO_ERROR_TRACE("Incoming frame's channel (0x%02x) not found\n", port->other_frame_ID);
                     chan_ptr = unframed_ptr;
                     am_in_frame = UNFRAMED;
                     DO_VERBOSE_TRACE("Am in UNFRAMED\n");
@@ -360,14 +384,8 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
                 in_escape = 1;
 
                 do {
-                    clock_gettime(CLOCK_MONOTONIC, &current_t);
-                    elapsed_sec = diff_timespec(&current_t, &start_t);
-                    if (elapsed_sec>timeout) {
-                        DO_DEBUG_TRACE("Abort waiting for escaped normal byte at %f of %f seconds\n",elapsed_sec,timeout);
-                        break;
-                    }
-                    tempval = read_single_byte(port_num);
-                } while (tempval < 0);
+                    tempval = read_single_byte(port_num, deadline);
+                } while ((tempval < 0) && (deadline_remaining_ns(deadline) > 0));
                 if (tempval < 0) {
                     DO_VERBOSE_TRACE("Timeout in read_byte\n");
                     DO_VERBOSE_TRACE("Continuing...\n");
@@ -430,9 +448,9 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
                     // DO_ERROR_TRACE("     Failed time %f:\n",elapsed_sec);
                     // failedcrc = 1;
                     byte_idx = 0;
-                    clock_gettime(CLOCK_MONOTONIC, &start_t);
-                    timeout= (double)start_byte_ms/1000.0;
-                    DO_VERBOSE_TRACE("Setting timeout to [%f]\n", timeout);
+                    timeout_ms = start_byte_ms;
+                    deadline = deadline_after_ms(timeout_ms);
+                    DO_VERBOSE_TRACE("Setting timeout to [%u]\n", timeout_ms);
                     DO_VERBOSE_TRACE("Continuing...\n");
                     continue;
                 } else {
@@ -456,13 +474,8 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
                 add_byte(c,chan_ptr);
                 DO_VERBOSE_TRACE("Add [0x%02x]\n", c);
                 do {
-                    clock_gettime(CLOCK_MONOTONIC, &current_t);
-                    elapsed_sec = diff_timespec(&current_t, &start_t);
-                    if (elapsed_sec>timeout) {
-                        break;
-                    }
-                    tempval = read_single_byte(port_num);
-                } while (tempval < 0);
+                    tempval = read_single_byte(port_num, deadline);
+                } while ((tempval < 0) && (deadline_remaining_ns(deadline) > 0));
                 if (tempval < 0) {
                     DO_VERBOSE_TRACE("Timeout in read_byte\n");
                     DO_VERBOSE_TRACE("Continuing...\n");
@@ -506,7 +519,7 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
     if (found_complete_frame) {
 
         if (channel_ID == 0xff) {
-            *receiveBuffer = other_frame_ID;
+            *receiveBuffer = port->other_frame_ID;
             *receiveBytes = chan_ptr->len;
             DO_VERBOSE_TRACE("Frame completed in 0xff mode\n");
         } else {
@@ -522,39 +535,73 @@ int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte
 
 
 void FSLP_read_unframed(int32_t port_num, uint16_t start_byte_ms, uint32_t *receiveBytes, uint8_t *receiveBuffer){
-    int tempval = 0;
-    // frame_state am_in_frame = UNFRAMED;
-    uint8_t c;
-    // uint8_t failedcrc = 0;
-
-    get_unframed(&unframed_ptr);
-
-//    clock_t start_t,elapsed_t;
-//  float elapsed_sec;
-//  float timeout = (float)start_byte_ms/1000.0;
-    *receiveBytes =  0;
+    const uint8_t *span1, *span2;
+    uint32_t len1, len2;
+    PORT_STATE *port = get_port_state(port_num);
+    CHANNEL_T *unframed_ptr;
+
+    *receiveBytes = 0;
+    if (!port)
+        return;
+    get_unframed(port->channels, &unframed_ptr);
+
+    // copy at most one frame buffer worth, in up to two runs
+    channel_read_spans(unframed_ptr, &span1, &len1, &span2, &len2);
+    if (len1 > FRAME_BUF_SIZ)
+        len1 = FRAME_BUF_SIZ;
+    if (len2 > FRAME_BUF_SIZ - len1)
+        len2 = FRAME_BUF_SIZ - len1;
+
+    memcpy(receiveBuffer, span1, len1);
+    memcpy(receiveBuffer + len1, span2, len2);
+    channel_consume(unframed_ptr, len1 + len2);
+    *receiveBytes = len1 + len2;
+}
 
-    while(unframed_ptr->len > 0){
+/*
+ * Append len bytes to frame_buf at out_len, escaping framing bytes.
+ * Runs without framing bytes are copied in one go; only the escapes are
+ * handled a byte at a time. Returns the new length, or -2 if the bytes
+ * plus the end byte would not fit.
+ */
+static int32_t append_escaped(uint8_t *frame_buf, int32_t out_len, const uint8_t *src, uint32_t len)
+{
+    while (len > 0)
+    {
+        uint32_t run = 0;
+        while ((run < len) && !needs_escape_tbl[src[run]])
+            run++;
 
-        if (*receiveBytes == FRAME_BUF_SIZ) return;
+        if ((out_len + run + 1) > FRAME_BUF_SIZ)
+            return (-2);
+        memcpy(&frame_buf[out_len], src, run);
+        out_len += run;
+        src += run;
+        len -= run;
 
-        tempval = get_byte(&c,unframed_ptr);
-        if (tempval < 0){
-            break;
+        if (len > 0)
+        {
+            if ((out_len + 2 + 1) > FRAME_BUF_SIZ)
+                return (-2);
+            frame_buf[out_len++] = ESCAPE_BYTE;
+            frame_buf[out_len++] = needs_escape_tbl[*src++];
+            len--;
         }
-
-        receiveBuffer[(*receiveBytes)++] = c;
-
-        DO_DEBUG_TRACE(" %02X",c);
-
     }
+    return out_len;
 }
 
-static int32_t create_frame(uint8_t *frame_buf, uint8_t channel_ID, uint8_t *payload, uint32_t payload_len)
+/*
+ * Frame the concatenation of the segments. Each byte is copied once,
+ * from the caller's buffers straight into frame_buf.
+ */
+static int32_t create_frame_v(uint8_t *frame_buf, uint8_t channel_ID, const FSLP_SEGMENT *segments, uint32_t num_segments)
 {
-    uint32_t i;
     int32_t out_len = 0;
+    uint32_t payload_len = 0;
+    uint32_t i;
     uint16_t crc_out = FLIR_CRC_INITIAL_VALUE;
+    uint8_t crc_bytes[2];
     frame_buf[out_len++] = (uint8_t) START_FRAME_BYTE;
     frame_buf[out_len++] = (uint8_t) channel_ID;
     crc_out = ByteCRC16(channel_ID, (int) crc_out);
@@ -563,91 +610,28 @@ static int32_t create_frame(uint8_t *frame_buf, uint8_t channel_ID, uint8_t *pay
     // frame_buf[out_len++] = (uint8_t) 0x00;  // Removed Frame status byte[1]
     // crc_out = ByteCRC16(0x00, (int) crc_out);
 
+    for (i = 0; i < num_segments; i++)
+        payload_len += segments[i].len;
+
     if ((payload_len + 5) > FRAME_BUF_SIZ) // start + channel_ID + payload + crc_bytes[2] + end
         return (-1);
 
-    for(i=0; i < payload_len; i++)
+    for (i = 0; i < num_segments; i++)
     {
-        if ((payload[i] == START_FRAME_BYTE) || (payload[i] == END_FRAME_BYTE) || (payload[i] == ESCAPE_BYTE)){
-            frame_buf[out_len++] = ESCAPE_BYTE;
-            uint8_t c = payload[i];
-            crc_out = ByteCRC16((int) c, (int) crc_out);
-            switch (c)
-            {
-                case END_FRAME_BYTE:
-                    c = ESCAPED_END_FRAME_BYTE;
-                    break;
-                case START_FRAME_BYTE:
-                    c = ESCAPED_START_FRAME_BYTE;
-                    break;
-                case ESCAPE_BYTE:
-                    c = ESCAPED_ESCAPE_BYTE;
-                    break;
-                default:
-                    break;
-            }
-            frame_buf[out_len++] = c;
+        // CRC covers the unescaped channel_ID and payload
+        crc_out = updateFlirCRC16Bytes(crc_out, segments[i].len, segments[i].data);
 
-        }
-        else
-        {
-            frame_buf[out_len++] = payload[i];
-            crc_out = ByteCRC16((int) payload[i], (int) crc_out);
-        }
-        if ((out_len + 3) > FRAME_BUF_SIZ)
-            return (-2);
+        out_len = append_escaped(frame_buf, out_len, segments[i].data, segments[i].len);
+        if (out_len < 0)
+            return out_len;
     }
 
-    // crc_out = calcFlirCRC16Bytes(out_len, frame_buf);
-    uint8_t crcbyte = ((crc_out >> 8) & 0xFF);
-    if ((crcbyte == START_FRAME_BYTE) || (crcbyte == END_FRAME_BYTE) || (crcbyte == ESCAPE_BYTE)) {
-        frame_buf[out_len++] = ESCAPE_BYTE;
-        uint8_t c = crcbyte;
-        switch (c)
-        {
-            case END_FRAME_BYTE:
-                c = ESCAPED_END_FRAME_BYTE;
-                break;
-            case START_FRAME_BYTE:
-                c = ESCAPED_START_FRAME_BYTE;
-                break;
-            case ESCAPE_BYTE:
-                c = ESCAPED_ESCAPE_BYTE;
-                break;
-            default:
-                break;
-        }
-        frame_buf[out_len++] = c;
-    }
-    else
-    {
-        frame_buf[out_len++] = crcbyte;
-    }
+    crc_bytes[0] = ((crc_out >> 8) & 0xFF);
+    crc_bytes[1] = (crc_out & 0xFF);
+    out_len = append_escaped(frame_buf, out_len, crc_bytes, sizeof(crc_bytes));
+    if (out_len < 0)
+        return out_len;
 
-    crcbyte = (crc_out & 0xFF);
-    if ((crcbyte == START_FRAME_BYTE) || (crcbyte == END_FRAME_BYTE) || (crcbyte == ESCAPE_BYTE)) {
-        frame_buf[out_len++] = ESCAPE_BYTE;
-        uint8_t c = crcbyte;
-        switch (c)
-        {
-            case END_FRAME_BYTE:
-                c = ESCAPED_END_FRAME_BYTE;
-                break;
-            case START_FRAME_BYTE:
-                c = ESCAPED_START_FRAME_BYTE;
-                break;
-            case ESCAPE_BYTE:
-                c = ESCAPED_ESCAPE_BYTE;
-                break;
-            default:
-                break;
-        }
-        frame_buf[out_len++] = c;
-    }
-    else
-    {
-        frame_buf[out_len++] = crcbyte;
-    }
     frame_buf[out_len++] = END_FRAME_BYTE;
 
     return(out_len);
@@ -676,20 +660,118 @@ static int write_frame(int32_t port_num,uint8_t *frame_buf, uint32_t len)
     }
 }
 
+void FSLP_send_to_camera_v(int32_t port_num, uint8_t channel_ID, const FSLP_SEGMENT *segments, uint32_t num_segments)
+{
+    int success=0;
+    PORT_STATE *port = get_port_state(port_num);
+
+    int32_t out_len;
+    if (!port)
+        return;
+    out_len = create_frame_v(port->out_frame_buf, channel_ID, segments, num_segments);
+
+    DO_DEBUG_TRACE("segments = %u, out_len = %d\n", num_segments, out_len);
+
+    if (out_len < 0) {
+        DO_ERROR_TRACE("Payload does not fit in a frame\n");
+        return;
+    }
+
+    // the whole frame goes out in one write
+    success = write_frame(port_num,port->out_frame_buf, out_len);
+
+    DO_DEBUG_TRACE("frame send status %d.\n",success);
+
+}
+
                                         //, uint32_t *receiveBytes, uint8_t *receivePayload)
 void FSLP_send_to_camera(int32_t port_num, uint8_t channel_ID, uint32_t sendBytes, uint8_t *sendPayload)
 {
-    int success=0;//, i=0;
+    FSLP_SEGMENT segment;
 
-    int32_t out_len;//, in_payload_len, out_payload_len;
-    out_len = create_frame(out_frame_buf,channel_ID, sendPayload, sendBytes);
+    segment.data = sendPayload;
+    segment.len = sendBytes;
+    FSLP_send_to_camera_v(port_num, channel_ID, &segment, 1);
+}
 
-    DO_DEBUG_TRACE("sendBytes = %u, out_len = %d\n",sendBytes, out_len);
+static uint8_t unescape_byte(uint8_t c)
+{
+    switch (c){
+        case ESCAPED_END_FRAME_BYTE:
+            return END_FRAME_BYTE;
+        case ESCAPED_START_FRAME_BYTE:
+            return START_FRAME_BYTE;
+        case ESCAPED_ESCAPE_BYTE:
+            return ESCAPE_BYTE;
+        default:
+            return c;
+    }
+}
 
-    success = write_frame(port_num,out_frame_buf, out_len);
+int32_t FSLP_pump(int32_t port_num, FSLP_frame_callback_t *callback, void *context)
+{
+    PORT_STATE *port = get_port_state(port_num);
+    CHANNEL_T *unframed_ptr;
+    uint8_t rx[256];
+    uint16_t calc_crc;
+    int32_t frames = 0;
+    int32_t n, i;
 
-    DO_DEBUG_TRACE("frame send status %d.\n",success);
+    if (!port)
+        return -1;
+    get_unframed(port->channels, &unframed_ptr);
 
+    while ((n = FSLP_read_available(port_num, rx, sizeof(rx))) > 0) {
+        for (i = 0; i < n; i++) {
+            uint8_t c = rx[i];
+
+            if (c == START_FRAME_BYTE) {
+                port->pump_in_frame = 1;
+                port->pump_escape = 0;
+                port->pump_len = 0;
+                continue;
+            }
+            if (!port->pump_in_frame) {
+                add_byte(c, unframed_ptr);
+                continue;
+            }
+            if (c == END_FRAME_BYTE) {
+                uint8_t *buf = port->pump_buf;
+                uint32_t len = port->pump_len;
+
+                port->pump_in_frame = 0;
+                if (len < NUM_FRAMING_BYTES) {
+                    DO_ERROR_TRACE("Short frame (%u bytes)\n", len);
+                    continue;
+                }
+                calc_crc = calcFlirCRC16Bytes(len - 2, &(buf[CRC_START_IDX]));
+                if ((((calc_crc >> 8) & 0xFF) != buf[len - 2]) || ((calc_crc & 0xFF) != buf[len - 1])) {
+                    DO_ERROR_TRACE("Failed pump packet integrity check (calc) %02X%02X !=  (recd) %02X%02X\n",((calc_crc >> 8) &0xFF),(calc_crc&0xFF),buf[len - 2],buf[len - 1]);
+                    continue;
+                }
+                frames++;
+                if (callback)
+                    callback(context, buf[0], &(buf[FRAME_START_IDX]), len - NUM_FRAMING_BYTES);
+                continue;
+            }
+            if (c == ESCAPE_BYTE) {
+                port->pump_escape = 1;
+                continue;
+            }
+            if (port->pump_escape) {
+                c = unescape_byte(c);
+                port->pump_escape = 0;
+            }
+            if (port->pump_len == FRAME_BUF_SIZ) {
+                DO_ERROR_TRACE("Buffer overrun - dropping frame\n");
+                port->pump_in_frame = 0;
+                continue;
+            }
+            port->pump_buf[port->pump_len++] = c;
+        }
+    }
+
+    return (n < 0) ? -1 : frames;
 }
 
 int32_t FSLP_check_data_ready(int32_t port_num, uint8_t *channel_ID, uint16_t start_byte_ms, uint32_t *receiveBytes, const uint8_t **receiveBuffer)
@@ -710,7 +792,7 @@ int32_t FSLP_check_data_ready(int32_t port_num, uint8_t *channel_ID, uint16_t st
 
     if (length) {
         CHANNEL_T *chan_ptr = 0;
-        if (get_channel(*channel_ID, &chan_ptr) || !chan_ptr) {
+        if (get_channel(get_port_state(port_num)->channels, *channel_ID, &chan_ptr) || !chan_ptr) {
             DO_ERROR_TRACE("Failed to find channel for data ready for service [0x%02x]\n", *channel_ID);
             return -1;
         }
@@ -721,8 +803,15 @@ int32_t FSLP_check_data_ready(int32_t port_num, uint8_t *channel_ID, uint16_t st
          * get copied to the output buffer) and offset by the FRAME_START_IDX
          */
         *receiveBytes = length;
-        *receiveBuffer = &chan_ptr->buff[chan_ptr->start + 1/* START_FRAME_BYTE */ + FRAME_START_IDX];
+        *receiveBuffer = channel_linearize(chan_ptr) + 1/* START_FRAME_BYTE */ + FRAME_START_IDX;
     }
 
     return 0;
 }
+
+int64_t FSLP_get_start_byte_ns(int32_t port_num)
+{
+    PORT_STATE *port = get_port_state(port_num);
+
+    return port ? port->start_byte_ns : 0;
+}
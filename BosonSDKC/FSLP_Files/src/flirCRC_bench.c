@@ -0,0 +1,75 @@
+//
+//  flirCRC micro-benchmark
+//      Checks calcFlirCRC16Bytes() against the byte-at-a-time reference
+//      for every length up to 4 KiB and every start alignment, then times
+//      both over typical FSLP frame sizes.
+//
+//      make crc_bench && ./crc_bench
+//
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "flirCRC.h"
+
+#define MAX_LEN    4096
+#define BENCH_MB   64
+
+static uint8_t data[MAX_LEN + 8];
+
+static uint16_t reference_crc(unsigned int count, uint8_t *buffer)
+{
+   int crc = FLIR_CRC_INITIAL_VALUE;
+   while ( count-- )
+      crc = ByteCRC16(*buffer++, crc);
+   return (uint16_t) crc;
+}
+
+static double now_sec(void)
+{
+   struct timespec t;
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+int main(void)
+{
+   static const unsigned int sizes[] = { 16, 64, 256, 768, 2048, 4096 };
+   unsigned int len, off, i;
+   volatile uint16_t sink = 0;
+   int failures = 0;
+
+   srand(1);
+   for ( i = 0; i < sizeof(data); i++ )
+      data[i] = (uint8_t) rand();
+
+   for ( off = 0; off < 8; off++ )
+      for ( len = 0; len <= MAX_LEN; len++ )
+         if ( calcFlirCRC16Bytes(len, data + off) != reference_crc(len, data + off) )
+         {
+            if ( failures++ < 10 )
+               printf("MISMATCH len=%u off=%u\n", len, off);
+         }
+   printf("bit-identity: %s\n", failures ? "FAILED" : "ok");
+
+   printf("%8s %14s %14s %8s\n", "bytes", "reference MB/s", "sliced MB/s", "speedup");
+   for ( i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++ )
+   {
+      unsigned int iters = (BENCH_MB << 20) / sizes[i], n;
+      double t0, t_ref, t_new;
+
+      t0 = now_sec();
+      for ( n = 0; n < iters; n++ )
+         sink ^= reference_crc(sizes[i], data);
+      t_ref = now_sec() - t0;
+
+      t0 = now_sec();
+      for ( n = 0; n < iters; n++ )
+         sink ^= calcFlirCRC16Bytes(sizes[i], data);
+      t_new = now_sec() - t0;
+
+      printf("%8u %14.1f %14.1f %7.2fx\n", sizes[i], BENCH_MB / t_ref, BENCH_MB / t_new, t_ref / t_new);
+   }
+
+   return failures ? 1 : 0;
+}
@@ -1,8 +1,8 @@
-#include "flirChannels.h"
+#include <string.h>
 
-static uint8_t is_initialized = 0;
+#include "flirChannels.h"
 
-int32_t get_channel(uint8_t channel_ID, CHANNEL_T **return_channel){
+int32_t get_channel(CHANNEL_T *channel_list, uint8_t channel_ID, CHANNEL_T **return_channel){
 	int i;
 	for (i = 1; i < NUM_CHANNELS; i++){
 		if (channel_ID == channel_list[i].channel) {
@@ -14,21 +14,19 @@ int32_t get_channel(uint8_t channel_ID, CHANNEL_T **return_channel){
 	return -1;
 }
 
-void get_unframed(CHANNEL_T **return_channel){
+void get_unframed(CHANNEL_T *channel_list, CHANNEL_T **return_channel){
 	*return_channel = &(channel_list[0]);
 	return;
 }
 
 void add_byte(uint8_t inbyte,CHANNEL_T *channel_ptr){
-	uint32_t index;
 	uint16_t start = (channel_ptr->start);
 	if (channel_ptr->len != CHANNEL_BUF_SIZ){
-		index = start + (channel_ptr->len);
-		(channel_ptr->buff)[index] = inbyte;
+		(channel_ptr->buff)[(start + channel_ptr->len) & CHANNEL_BUF_MASK] = inbyte;
 		(channel_ptr->len)++;
 	} else {
 		(channel_ptr->buff)[start] = inbyte;
-		(channel_ptr->start) = (start + 1)%CHANNEL_BUF_SIZ;
+		(channel_ptr->start) = (start + 1) & CHANNEL_BUF_MASK;
 	}
 }
 
@@ -38,24 +36,111 @@ int32_t get_byte(uint8_t *outbyte,CHANNEL_T *channel_ptr){
 		return -1;
 	} else {
 		*outbyte = (channel_ptr->buff)[(channel_ptr->start)];
-		(channel_ptr->start)++;
-		return --(channel_ptr->len);
+		channel_consume(channel_ptr, 1);
+		return channel_ptr->len;
 	}
 }
 
-void initialize_channels(){
-	if (is_initialized==0) {
-                CHANNEL_INIT(0, 0x00); // unframed "channel" always slot 0
-                CHANNEL_INIT(1, 0x00); // command channel
-                CHANNEL_INIT(2, 0x99); // "0x99" debug channel
-                CHANNEL_INIT(3, 0x63); // "99" alt debug channel
-                CHANNEL_INIT(4, 0xaa); // "0xaa" Uart Pass Through channel
-                CHANNEL_INIT(5, 0x01); // "1" Data channel
-
-                CHANNEL_INIT(6, SERVICE_UNRELATED_CHANNEL_ID); /*
-                                                                * all-in - allows for framed reads of whatever has
-                                                                * collected in the port (unrelated to any service)
-                                                                */
-		is_initialized = 1;
+uint32_t channel_read_spans(CHANNEL_T *channel_ptr, const uint8_t **span1, uint32_t *len1, const uint8_t **span2, uint32_t *len2){
+	uint32_t len = channel_ptr->len;
+	uint32_t to_end = CHANNEL_BUF_SIZ - channel_ptr->start;
+
+	*span1 = &(channel_ptr->buff)[channel_ptr->start];
+	*len1 = (len < to_end) ? len : to_end;
+	*span2 = channel_ptr->buff;
+	*len2 = len - *len1;
+	return len;
+}
+
+void channel_consume(CHANNEL_T *channel_ptr, uint32_t count){
+	if (count >= channel_ptr->len) {
+		// restart at 0 when empty, so data usually stays contiguous
+		channel_ptr->len = 0;
+		channel_ptr->start = 0;
+		return;
 	}
+	channel_ptr->start = (channel_ptr->start + count) & CHANNEL_BUF_MASK;
+	channel_ptr->len -= count;
+}
+
+uint32_t channel_write_spans(CHANNEL_T *channel_ptr, uint8_t **span1, uint32_t *len1, uint8_t **span2, uint32_t *len2){
+	uint32_t space = CHANNEL_BUF_SIZ - channel_ptr->len;
+	uint32_t tail = (channel_ptr->start + channel_ptr->len) & CHANNEL_BUF_MASK;
+	uint32_t to_end = CHANNEL_BUF_SIZ - tail;
+
+	*span1 = &(channel_ptr->buff)[tail];
+	*len1 = (space < to_end) ? space : to_end;
+	*span2 = channel_ptr->buff;
+	*len2 = space - *len1;
+	return space;
+}
+
+void channel_commit(CHANNEL_T *channel_ptr, uint32_t count){
+	uint32_t space = CHANNEL_BUF_SIZ - channel_ptr->len;
+	channel_ptr->len += (count < space) ? count : space;
+}
+
+void add_bytes(const uint8_t *inbytes, uint32_t count, CHANNEL_T *channel_ptr){
+	uint8_t *span1, *span2;
+	uint32_t len1, len2;
+
+	if (count > CHANNEL_BUF_SIZ) {
+		// only the newest CHANNEL_BUF_SIZ bytes survive
+		inbytes += count - CHANNEL_BUF_SIZ;
+		count = CHANNEL_BUF_SIZ;
+	}
+	if (channel_ptr->len + count > CHANNEL_BUF_SIZ)
+		channel_consume(channel_ptr, channel_ptr->len + count - CHANNEL_BUF_SIZ);
+
+	channel_write_spans(channel_ptr, &span1, &len1, &span2, &len2);
+	if (count < len1)
+		len1 = count;
+	memcpy(span1, inbytes, len1);
+	memcpy(span2, inbytes + len1, count - len1);
+	channel_commit(channel_ptr, count);
+}
+
+static void reverse_bytes(uint8_t *p, uint32_t n){
+	uint32_t i;
+	for (i = 0; i < n / 2; i++) {
+		uint8_t t = p[i];
+		p[i] = p[n - 1 - i];
+		p[n - 1 - i] = t;
+	}
+}
+
+const uint8_t *channel_linearize(CHANNEL_T *channel_ptr){
+	uint32_t start = channel_ptr->start;
+
+	if (start + channel_ptr->len > CHANNEL_BUF_SIZ) {
+		// rotate left by start in place: rare, only after a wrap
+		reverse_bytes(channel_ptr->buff, start);
+		reverse_bytes(&(channel_ptr->buff)[start], CHANNEL_BUF_SIZ - start);
+		reverse_bytes(channel_ptr->buff, CHANNEL_BUF_SIZ);
+		channel_ptr->start = 0;
+	}
+	return &(channel_ptr->buff)[channel_ptr->start];
+}
+
+void initialize_channels(CHANNEL_T *channel_list){
+	int i = 0;
+	CHANNEL_INIT(channel_list, i++, 0x00); // unframed "channel" always slot 0
+	CHANNEL_INIT(channel_list, i++, 0x00); // command channel
+#if FSLP_WITH_DEBUG_CHANNELS
+	CHANNEL_INIT(channel_list, i++, 0x99); // "0x99" debug channel
+	CHANNEL_INIT(channel_list, i++, 0x63); // "99" alt debug channel
+#endif
+#if FSLP_WITH_UPT
+	CHANNEL_INIT(channel_list, i++, 0xaa); // "0xaa" Uart Pass Through channel
+#endif
+#if FSLP_WITH_DATA_SERVICE
+	CHANNEL_INIT(channel_list, i++, 0x01); // "1" Data channel
+#endif
+
+#if FSLP_WITH_DATA_READY
+	CHANNEL_INIT(channel_list, i++, SERVICE_UNRELATED_CHANNEL_ID); /*
+	                                                                * all-in - allows for framed reads of whatever has
+	                                                                * collected in the port (unrelated to any service)
+	                                                                */
+#endif
 }
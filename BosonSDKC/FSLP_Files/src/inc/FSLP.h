@@ -12,10 +12,30 @@
 #define FLR_EXPORT
 #endif
 
+// One piece of a payload sent with FSLP_send_to_camera_v
+typedef struct {
+    const uint8_t *data;
+    uint32_t len;
+} FSLP_SEGMENT;
+
 FLR_EXPORT void FSLP_send_to_camera(int32_t port_num, uint8_t channel_ID, uint32_t sendBytes, uint8_t *sendPayload);//, uint32_t *receiveBytes, uint8_t *receivePayload);
+// Send the concatenation of the segments as one frame, without staging it first
+FLR_EXPORT void FSLP_send_to_camera_v(int32_t port_num, uint8_t channel_ID, const FSLP_SEGMENT *segments, uint32_t num_segments);
 // FLR_EXPORT void read_command(int32_t port_num, uint8_t channel_ID, uint32_t sendBytes, uint8_t *sendPayload, uint32_t *receiveBytes, uint8_t *receivePayload);
 FLR_EXPORT int32_t FSLP_read_frame(int32_t port_num,uint8_t channel_ID, uint16_t start_byte_ms,uint32_t *receiveBytes, uint8_t *receiveBuffer);
 FLR_EXPORT void FSLP_read_unframed(int32_t port_num, uint16_t start_byte_ms,uint32_t *receiveBytes, uint8_t *receiveBuffer);
+// Called from FSLP_pump() for each complete frame, with its unescaped payload
+typedef void FSLP_frame_callback_t(void *context, uint8_t channel_ID, const uint8_t *payload, uint32_t len);
+
+// Parse whatever the port has received, without waiting, and call callback
+// for every complete frame; a partial frame is kept for the next call, and
+// bytes outside frames go to the unframed buffer. Returns the number of
+// frames delivered, -1 on a port error. Drive a port either with FSLP_pump()
+// or with the blocking reads above, not both.
+FLR_EXPORT int32_t FSLP_pump(int32_t port_num, FSLP_frame_callback_t *callback, void *context);
 FLR_EXPORT int32_t FSLP_check_data_ready(int32_t port_num, uint8_t *channel_ID, uint16_t start_byte_ms, uint32_t *receiveBytes, const uint8_t **receiveBuffer);
+// monotonic ns at which the last FSLP_read_frame() saw its frame's start
+// byte, 0 when the frame had been buffered before the call
+FLR_EXPORT int64_t FSLP_get_start_byte_ns(int32_t port_num);
 
 #endif //_FSLP_H
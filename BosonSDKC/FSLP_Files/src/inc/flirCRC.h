@@ -7,5 +7,6 @@
 
 uint16_t calcFlirCRC16Words(unsigned int count, short *buffer);
 uint16_t calcFlirCRC16Bytes(unsigned int count, uint8_t *buffer);
+uint16_t updateFlirCRC16Bytes(uint16_t crc, unsigned int count, const uint8_t *buffer);
 int ByteCRC16(int value, int crcin);
 #endif // _FLIR_CRC_H_
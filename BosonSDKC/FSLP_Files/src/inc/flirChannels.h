@@ -2,7 +2,11 @@
 #define FLIR_CHANNELS_H
 
 #include <stdint.h>
-#define CHANNEL_BUF_SIZ       32000
+#include "fslpConfig.h"
+
+// A power of two: positions wrap with CHANNEL_BUF_MASK
+#define CHANNEL_BUF_SIZ       FSLP_CHANNEL_BUF_SIZ
+#define CHANNEL_BUF_MASK      (CHANNEL_BUF_SIZ - 1)
 
 #define SERVICE_UNRELATED_CHANNEL_ID    (0xff)
 
@@ -14,27 +18,42 @@ struct t_CHANNEL_T {
 };
 typedef struct t_CHANNEL_T CHANNEL_T;
 
-#define CHANNEL_INIT(_channel_list_index, _channel_id)    \
-    do {                                                  \
-        chan_ptr = &(channel_list[_channel_list_index]);  \
-        chan_ptr->channel = (_channel_id);                \
-        chan_ptr->len = 0;                                \
-        chan_ptr->start = 0;                              \
+#define CHANNEL_INIT(_channel_list, _channel_list_index, _channel_id)    \
+    do {                                                                 \
+        CHANNEL_T *chan_ptr = &((_channel_list)[_channel_list_index]);   \
+        chan_ptr->channel = (_channel_id);                               \
+        chan_ptr->len = 0;                                               \
+        chan_ptr->start = 0;                                             \
     } while (0)
 
 
-#define NUM_CHANNELS 7
-
-static CHANNEL_T *chan_ptr;
-static CHANNEL_T *unframed_ptr;
-static CHANNEL_T channel_list[NUM_CHANNELS];
+#define NUM_CHANNELS FSLP_NUM_CHANNELS
 
-extern void initialize_channels();
-extern int32_t get_channel(uint8_t channel_ID, CHANNEL_T **return_channel);
-extern void get_unframed(CHANNEL_T **return_channel);
+// Each port owns a table of NUM_CHANNELS channels, slot 0 is the unframed data
+extern void initialize_channels(CHANNEL_T *channel_list);
+extern int32_t get_channel(CHANNEL_T *channel_list, uint8_t channel_ID, CHANNEL_T **return_channel);
+extern void get_unframed(CHANNEL_T *channel_list, CHANNEL_T **return_channel);
 extern void add_byte(uint8_t inbyte,CHANNEL_T *channel_ptr);
 extern int32_t get_byte(uint8_t *outbyte,CHANNEL_T *channel_ptr);
 
+/*
+ * Bulk access. The readable data and the free space are each at most two
+ * contiguous spans, the second one starting at buff[0] after the wrap.
+ * Spans stay valid until the channel is next modified.
+ */
+// readable data, returns total length
+extern uint32_t channel_read_spans(CHANNEL_T *channel_ptr, const uint8_t **span1, uint32_t *len1, const uint8_t **span2, uint32_t *len2);
+// drop count bytes from the front
+extern void channel_consume(CHANNEL_T *channel_ptr, uint32_t count);
+// free space, returns total length
+extern uint32_t channel_write_spans(CHANNEL_T *channel_ptr, uint8_t **span1, uint32_t *len1, uint8_t **span2, uint32_t *len2);
+// append count bytes written into the free spans
+extern void channel_commit(CHANNEL_T *channel_ptr, uint32_t count);
+// append count bytes, dropping the oldest data when full like add_byte
+extern void add_bytes(const uint8_t *inbytes, uint32_t count, CHANNEL_T *channel_ptr);
+// rotate the data to one contiguous span if it wraps, returns its start
+extern const uint8_t *channel_linearize(CHANNEL_T *channel_ptr);
+
 /* Maybe later if number of channels becomes large.
 int16_t channel_nums[256] = {
 	-1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //0x00->0x09
@@ -0,0 +1,62 @@
+#ifndef FSLP_CONFIG_H
+#define FSLP_CONFIG_H
+
+/*
+ * Build-time footprint of the library. Every size below can be overridden
+ * with -D; the defaults are the desktop sizes, "make small" builds the
+ * command-channel-only profile for microcontroller ports.
+ *
+ * Per open port the library holds FSLP_NUM_CHANNELS channel buffers plus
+ * three frame buffers, allocated when the port is first used.
+ */
+
+// Bytes buffered per channel; a power of two, at most 32768
+#ifndef FSLP_CHANNEL_BUF_SIZ
+#define FSLP_CHANNEL_BUF_SIZ        32768
+#endif
+
+// Largest frame read or written; 1088 still fits a full 530-byte command
+// payload with every byte escaped
+#ifndef FSLP_FRAME_BUF_SIZ
+#define FSLP_FRAME_BUF_SIZ          2048
+#endif
+
+// Port ids the library keeps state for
+#ifndef FSLP_MAX_PORTS
+#define FSLP_MAX_PORTS              48
+#endif
+
+// Read-ahead per port in the Linux adapter
+#ifndef FSLP_RX_BUF_SIZ
+#define FSLP_RX_BUF_SIZ             1024
+#endif
+
+// Buses the Linux I2C adapter can have open at once
+#ifndef FSLP_MAX_I2C_PORTS
+#define FSLP_MAX_I2C_PORTS          4
+#endif
+
+// Optional channels (1 = buffered, 0 = not built); frames on a channel that
+// isn't built go to the unframed buffer
+#ifndef FSLP_WITH_DEBUG_CHANNELS
+#define FSLP_WITH_DEBUG_CHANNELS    1   // 0x99 and 0x63 debug output
+#endif
+#ifndef FSLP_WITH_UPT
+#define FSLP_WITH_UPT               1   // 0xaa UART pass-through
+#endif
+#ifndef FSLP_WITH_DATA_SERVICE
+#define FSLP_WITH_DATA_SERVICE      1   // 0x01 data service
+#endif
+#ifndef FSLP_WITH_DATA_READY
+#define FSLP_WITH_DATA_READY        1   // 0xff catch-all for FSLP_check_data_ready()
+#endif
+
+// the unframed slot and the command channel are always there
+#define FSLP_NUM_CHANNELS   (2 + 2 * FSLP_WITH_DEBUG_CHANNELS + FSLP_WITH_UPT + \
+                             FSLP_WITH_DATA_SERVICE + FSLP_WITH_DATA_READY)
+
+#if (FSLP_CHANNEL_BUF_SIZ & (FSLP_CHANNEL_BUF_SIZ - 1)) || (FSLP_CHANNEL_BUF_SIZ > 32768)
+#error "FSLP_CHANNEL_BUF_SIZ must be a power of two, at most 32768"
+#endif
+
+#endif //FSLP_CONFIG_H
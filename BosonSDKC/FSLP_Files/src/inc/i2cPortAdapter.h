@@ -0,0 +1,40 @@
+#ifndef _I2C_PORT_ADAPTER_H
+#define _I2C_PORT_ADAPTER_H
+
+#include <stdint.h>
+
+#ifdef _WIN32
+#define FLR_EXPORT __declspec(dllexport)
+#else
+#define FLR_EXPORT
+#endif
+
+/*
+ * FSLP over a Linux I2C bus (/dev/i2c-N), for hosts that talk to the
+ * camera's I2C target port. Frames are the I2C form of FSLP: 0x8E 0xA1,
+ * big-endian 16-bit payload length, payload; no escaping and no CRC.
+ * Every call is one I2C_RDWR transaction unless noted.
+ *
+ * Linux only; handles are small integers, not file descriptors.
+ */
+
+// Open bus (e.g. "/dev/i2c-1") for the camera at the 7-bit address.
+// Returns a handle, -1 if the bus can't be opened or all handles are in use.
+FLR_EXPORT int32_t FSLP_i2c_open(const char *bus, uint8_t address);
+FLR_EXPORT void FSLP_i2c_close(int32_t handle);
+
+// Raw transfers, 0 on success and -1 on a bus error
+FLR_EXPORT int32_t FSLP_i2c_write(int32_t handle, const uint8_t *data, uint16_t len);
+FLR_EXPORT int32_t FSLP_i2c_read(int32_t handle, uint8_t *data, uint16_t len);
+
+// Header and payload in a single transaction. 0 on success, -1 on a bus error.
+FLR_EXPORT int32_t FSLP_i2c_write_frame(int32_t handle, const uint8_t *payload, uint16_t len);
+
+// Read one frame into payload: the header in one transaction, the payload
+// in the next. Bytes ahead of a frame head (0xFF while the camera has
+// nothing to send) are skipped until timeout_ms. Returns the payload
+// length, -1 on a bus error, -2 on timeout, -3 if the payload is longer
+// than max_len (it is read and dropped, the bus stays in sync).
+FLR_EXPORT int32_t FSLP_i2c_read_frame(int32_t handle, uint8_t *payload, uint16_t max_len, uint16_t timeout_ms);
+
+#endif //_I2C_PORT_ADAPTER_H
@@ -16,6 +16,10 @@
 // -1 is only expected error return.
 FLR_EXPORT int32_t FSLP_lookup_port_id( char *port_name, int32_t len );
 
+// point port_id at another device name, e.g. a pty or a COM port past
+// the built-in table. -1 if the name doesn't fit, 0 on success.
+FLR_EXPORT int32_t FSLP_set_port_name(int32_t port_id, const char *port_name);
+
 // open port by id, using specified baud_rate.
 // passes library errors up, 0 on success.
 FLR_EXPORT uint8_t FSLP_open_port(int32_t port_id, int32_t baud_rate);
@@ -23,9 +27,26 @@ FLR_EXPORT uint8_t FSLP_open_port(int32_t port_id, int32_t baud_rate);
 // close port via id
 FLR_EXPORT void FSLP_close_port(int32_t port_id);
 
-// read single byte with timeout.
-// -1 on timeout, 0-255 for valid byte value
-int16_t FSLP_read_byte_with_timeout(int32_t port_id, double timeout);
+// change the baud rate of an open port, any rate the host driver supports.
+// passes library errors up, 0 on success.
+FLR_EXPORT uint8_t FSLP_set_baud_rate(int32_t port_id, int32_t baud_rate);
+
+// bytes moved on the port and seconds elapsed since it was opened or the
+// stats were last reset. Any output pointer may be NULL.
+FLR_EXPORT void FSLP_get_port_stats(int32_t port_id, uint64_t *tx_bytes, uint64_t *rx_bytes, double *seconds);
+FLR_EXPORT void FSLP_reset_port_stats(int32_t port_id);
+
+// descriptor of the open port, for poll()/epoll/libuv to wait on before
+// FSLP_pump(). -1 if the port isn't open or the platform has none (Win32).
+FLR_EXPORT int32_t FSLP_get_port_fd(int32_t port_id);
+
+// copy up to max_bytes already received into buf, without waiting.
+// number of bytes copied, 0 if none, -1 on a port error
+int32_t FSLP_read_available(int32_t port_id, uint8_t *buf, int32_t max_bytes);
+
+// read single byte, waiting no later than deadline (monotonic ns, see
+// timeoutLogic.h). -1 on timeout, 0-255 for valid byte value
+int16_t FSLP_read_byte_by_deadline(int32_t port_id, int64_t deadline);
 
 // flush tx buffer
 void FSLP_flush_write_queue(int32_t port_id);
@@ -16,6 +16,15 @@ double difftime(long current, long reference);
 
 #endif
 
+#include <stdint.h>
+
 double diff_timespec(struct timespec *current, struct timespec *reference);
 
+// Deadlines are absolute monotonic times in integer nanoseconds, so frame
+// reading needs no floating point and reads the clock only when it waits.
+int64_t monotonic_ns(void);
+int64_t deadline_after_ms(uint32_t ms);
+// nanoseconds left before deadline, <= 0 once it has passed
+int64_t deadline_remaining_ns(int64_t deadline);
+
 #endif //_TIMEOUT_LOGIC_H
\ No newline at end of file
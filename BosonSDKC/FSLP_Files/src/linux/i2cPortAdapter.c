@@ -0,0 +1,174 @@
+#include "i2cPortAdapter.h"
+#include "fslpConfig.h"
+#include "timeoutLogic.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#define HEAD_SIZ    2
+#define HEADER_SIZ  4   // head plus length
+
+static const uint8_t frame_head[HEAD_SIZ] = { 0x8E, 0xA1 };
+
+typedef struct {
+    int fd;       // -1 when free
+    uint16_t address;
+} I2C_PORT_T;
+
+static I2C_PORT_T i2c_ports[FSLP_MAX_I2C_PORTS];
+static int i2c_ports_ready = 0;
+
+static I2C_PORT_T *get_i2c_port(int32_t handle)
+{
+    if (!i2c_ports_ready || handle < 0 || handle >= FSLP_MAX_I2C_PORTS || i2c_ports[handle].fd < 0)
+        return NULL;
+    return &i2c_ports[handle];
+}
+
+static int32_t transfer(I2C_PORT_T *port, uint16_t flags, uint8_t *data, uint16_t len)
+{
+    struct i2c_msg msg;
+    struct i2c_rdwr_ioctl_data xfer;
+
+    msg.addr = port->address;
+    msg.flags = flags;
+    msg.len = len;
+    msg.buf = data;
+    xfer.msgs = &msg;
+    xfer.nmsgs = 1;
+
+    while (ioctl(port->fd, I2C_RDWR, &xfer) < 0) {
+        if (errno != EINTR)
+            return -1;
+    }
+    return 0;
+}
+
+// Offset of the first byte that can start a frame head: a full head, or
+// its first byte at the very end of buf
+static uint32_t find_frame_head(const uint8_t *buf, uint32_t len)
+{
+    uint32_t i;
+
+    for (i = 0; i < len; i++) {
+        if (buf[i] == frame_head[0] && (i + 1 == len || buf[i + 1] == frame_head[1]))
+            break;
+    }
+    return i;
+}
+
+int32_t FSLP_i2c_open(const char *bus, uint8_t address)
+{
+    int32_t handle;
+    int fd;
+
+    if (!i2c_ports_ready) {
+        for (handle = 0; handle < FSLP_MAX_I2C_PORTS; handle++)
+            i2c_ports[handle].fd = -1;
+        i2c_ports_ready = 1;
+    }
+    for (handle = 0; handle < FSLP_MAX_I2C_PORTS; handle++) {
+        if (i2c_ports[handle].fd < 0)
+            break;
+    }
+    if (handle == FSLP_MAX_I2C_PORTS || !bus)
+        return -1;
+
+    fd = open(bus, O_RDWR | O_CLOEXEC);
+    if (fd < 0)
+        return -1;
+    i2c_ports[handle].fd = fd;
+    i2c_ports[handle].address = address;
+    return handle;
+}
+
+void FSLP_i2c_close(int32_t handle)
+{
+    I2C_PORT_T *port = get_i2c_port(handle);
+
+    if (port) {
+        close(port->fd);
+        port->fd = -1;
+    }
+}
+
+int32_t FSLP_i2c_write(int32_t handle, const uint8_t *data, uint16_t len)
+{
+    I2C_PORT_T *port = get_i2c_port(handle);
+
+    if (!port || (len && !data))
+        return -1;
+    return transfer(port, 0, (uint8_t *) data, len);
+}
+
+int32_t FSLP_i2c_read(int32_t handle, uint8_t *data, uint16_t len)
+{
+    I2C_PORT_T *port = get_i2c_port(handle);
+
+    if (!port || (len && !data))
+        return -1;
+    return transfer(port, I2C_M_RD, data, len);
+}
+
+int32_t FSLP_i2c_write_frame(int32_t handle, const uint8_t *payload, uint16_t len)
+{
+    I2C_PORT_T *port = get_i2c_port(handle);
+    uint8_t frame[HEADER_SIZ + len];
+
+    if (!port || (len && !payload))
+        return -1;
+
+    memcpy(frame, frame_head, HEAD_SIZ);
+    frame[2] = (uint8_t) (len >> 8);
+    frame[3] = (uint8_t) len;
+    if (len)
+        memcpy(frame + HEADER_SIZ, payload, len);
+    return transfer(port, 0, frame, sizeof(frame));
+}
+
+int32_t FSLP_i2c_read_frame(int32_t handle, uint8_t *payload, uint16_t max_len, uint16_t timeout_ms)
+{
+    I2C_PORT_T *port = get_i2c_port(handle);
+    int64_t deadline = deadline_after_ms(timeout_ms);
+    uint8_t header[HEADER_SIZ];
+    uint8_t drop[256];
+    uint32_t have = 0, offset;
+    uint16_t len, left;
+
+    if (!port || (max_len && !payload))
+        return -1;
+
+    // whole header in one read; after idle or stray bytes keep what may
+    // start a frame head and read only what is missing
+    for (;;) {
+        if (transfer(port, I2C_M_RD, header + have, HEADER_SIZ - have))
+            return -1;
+        offset = find_frame_head(header, HEADER_SIZ);
+        if (offset == 0)
+            break;
+        have = HEADER_SIZ - offset;
+        memmove(header, header + offset, have);
+        if (deadline_remaining_ns(deadline) <= 0)
+            return -2;
+    }
+
+    len = (uint16_t) ((header[2] << 8) | header[3]);
+    if (len <= max_len) {
+        if (len && transfer(port, I2C_M_RD, payload, len))
+            return -1;
+        return len;
+    }
+
+    // too long for the caller: drain it so the next frame still lines up
+    for (left = len; left; ) {
+        uint16_t n = (left < sizeof(drop)) ? left : sizeof(drop);
+        if (transfer(port, I2C_M_RD, drop, n))
+            return -1;
+        left -= n;
+    }
+    return -3;
+}
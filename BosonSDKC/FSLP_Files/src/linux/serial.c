@@ -60,8 +60,24 @@ int close_port(HANDLE handle) {
 // Returns 0 on success
 // Returns -1 on error
 int send_buffer(HANDLE fd, unsigned char *tx_array, short bytes_to_send) {
-	if ( write(fd, tx_array,bytes_to_send)==-1) {
-		return -1;   // Error
+	// the port is O_NONBLOCK: a full TX queue takes part of the buffer, or
+	// none of it, so wait in poll() for room and send the rest
+	while (bytes_to_send > 0) {
+		ssize_t n = write(fd, tx_array, bytes_to_send);
+		if (n < 0) {
+			struct pollfd pfd;
+			if (errno == EINTR)
+				continue;
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+				return -1;   // Error
+			pfd.fd = fd;
+			pfd.events = POLLOUT;
+			if (poll(&pfd, 1, 1000) <= 0)
+				return -1;   // TX queue never drains
+			continue;
+		}
+		tx_array += n;
+		bytes_to_send -= (short) n;
 	}
 	return 0;  // Success
 }
@@ -71,10 +87,7 @@ int send_buffer(HANDLE fd, unsigned char *tx_array, short bytes_to_send) {
 // Returns 0 on success
 // Returns -1 on error
 int send_byte(HANDLE fd, unsigned char car) {
-	if ( write(fd, &car, 1)==-1) {
-		return -1;
-	}
-	return 0;
+	return send_buffer(fd, &car, 1);
 }
 
 // Check if there is a byte or not waiting to be read (RX)
@@ -99,40 +112,74 @@ int txbyte_waiting(HANDLE fd) {
   return 0;
 }
 
+// Wait until a byte is waiting to be read (RX), sleeping in poll()
+// plazo in microseconds, -1 waits forever
+// Returns 1 if data is waiting
+// Returns 0 if timeout happened
+// Returns -1 on error
+static int wait_rx(HANDLE fd, int plazo) {
+  struct pollfd pfd;
+  int n;
+
+  pfd.fd=fd;
+  pfd.events=POLLIN;
+
+  do {
+    // round up, so a short timeout still waits instead of spinning
+    n=poll(&pfd,1,(plazo<0) ? -1 : (plazo+999)/1000);
+  } while (n<0 && errno==EINTR);
+
+  if (n<0 || (pfd.revents & (POLLERR|POLLNVAL))) {
+    return -1;
+  }
+  return (n>0) ? 1 : 0;
+}
+
 // Read a byte within a period of time
 // Returns byte read
 // Returns -1 if timeout happened.
 // timeout = 0 if no timeout, timeout = 1 if timeout
 unsigned char read_byte_time(HANDLE fd,int plazo, int *timeout) {
-  fd_set leer;
-  struct timeval tout;
-  int n;
   unsigned char c;
 
-  tout.tv_sec=0;
-  tout.tv_usec=plazo;
-
-  FD_ZERO(&leer);
-  FD_SET(fd,&leer);
-
-  n=select(fd+2,&leer,NULL,NULL,&tout);
-  if (n==0) {
+  if (wait_rx(fd,plazo)<=0 || read(fd,&c,1)!=1) {
     *timeout=1;
     return -1;
   }
   *timeout=0;
-
-  read(fd,&c,1);
   return c;
 }
 
+// Read whatever is waiting, up to max_bytes, within a period of time
+// Returns number of bytes read, at least 1
+// Returns 0 if timeout happened
+// Returns -1 on error
+int read_buffer_time(HANDLE fd, unsigned char *rx_array, int max_bytes, int plazo) {
+  int n;
+
+  n=wait_rx(fd,plazo);
+  if (n<=0) {
+    return n;
+  }
+
+  // Non-blocking port: returns what the driver holds without waiting for more
+  n=read(fd,rx_array,max_bytes);
+  if (n<0) {
+    return (errno==EAGAIN || errno==EINTR) ? 0 : -1;
+  }
+  return n;
+}
+
 // Read a byte. Blocking call. waits until byte is received
 // Returns byte read
 unsigned char read_byte(HANDLE fd) {
-	unsigned char c;
+	unsigned char c = 0;
 
-	while (!rxbyte_waiting(fd));
-	read(fd,&c,1);
+	// sleeps in poll() instead of spinning on TIOCINQ; gives up on a dead port
+	while (wait_rx(fd,-1)>=0) {
+		if (read(fd,&c,1)==1)
+			break;
+	}
 	return c;
 }
 
@@ -224,8 +271,10 @@ PortSettingsType str2ps (char *str1, char*str2) {
 // Returns -5 if parity selection failed
 // Returns -6 if stopbits selection failed
 // Returns -7 if cannot update new options
+// Rates without a B* constant go through termios2/BOTHER, see set_custom_baud()
 int setup_serial(int fdes,int baud,int databits,int stopbits,int parity) {
 	int n;
+	int custom = 0;
 	struct termios options;
 
 	// Get the current options
@@ -236,6 +285,22 @@ int setup_serial(int fdes,int baud,int databits,int stopbits,int parity) {
 
 	// Set the baud rate
 	switch (baud) {
+	case 110:
+		n =  cfsetospeed(&options,B110);
+		n += cfsetispeed(&options,B110);
+		break;
+	case 300:
+		n =  cfsetospeed(&options,B300);
+		n += cfsetispeed(&options,B300);
+		break;
+	case 600:
+		n =  cfsetospeed(&options,B600);
+		n += cfsetispeed(&options,B600);
+		break;
+	case 1200:
+		n =  cfsetospeed(&options,B1200);
+		n += cfsetispeed(&options,B1200);
+		break;
 	case 2400:
 		n =  cfsetospeed(&options,B2400);
 		n += cfsetispeed(&options,B2400);
@@ -268,14 +333,40 @@ int setup_serial(int fdes,int baud,int databits,int stopbits,int parity) {
 		n =  cfsetospeed(&options,B230400);
 		n += cfsetispeed(&options,B230400);
 		break;
+	case 460800:
+		n =  cfsetospeed(&options,B460800);
+		n += cfsetispeed(&options,B460800);
+		break;
 	case 921600:
 		n =  cfsetospeed(&options,B921600);
 		n += cfsetispeed(&options,B921600);
 		break;
+	case 1000000:
+		n =  cfsetospeed(&options,B1000000);
+		n += cfsetispeed(&options,B1000000);
+		break;
+	case 1500000:
+		n =  cfsetospeed(&options,B1500000);
+		n += cfsetispeed(&options,B1500000);
+		break;
+	case 2000000:
+		n =  cfsetospeed(&options,B2000000);
+		n += cfsetispeed(&options,B2000000);
+		break;
+	case 3000000:
+		n =  cfsetospeed(&options,B3000000);
+		n += cfsetispeed(&options,B3000000);
+		break;
 
 	default:
-		// not supported baudrate
-		return -2;
+		// non-standard rate (e.g. 14400): set after tcsetattr() through termios2
+		if (baud <= 0) {
+			return -2;
+		}
+		n =  cfsetospeed(&options,B38400);
+		n += cfsetispeed(&options,B38400);
+		custom = 1;
+		break;
 	}
 	// If n != 0 then Baud Rate selection didn't work
 	if (n != 0) {
@@ -356,9 +447,10 @@ int setup_serial(int fdes,int baud,int databits,int stopbits,int parity) {
 	options.c_lflag = 0;  // no local flags
 	options.c_cflag |= HUPCL; // Drop DTR on close
 
-	// Setup non blocking, return on 1 character
+	// Fully non-blocking reads: the port is opened O_NONBLOCK and every
+	// read waits in poll(), so read() must never wait on its own
 	options.c_cc[VMIN] = 0;
-	options.c_cc[VTIME] = 1;
+	options.c_cc[VTIME] = 0;
 
 	// Clear the line
 	tcflush(fdes,TCIFLUSH);
@@ -368,5 +460,9 @@ int setup_serial(int fdes,int baud,int databits,int stopbits,int parity) {
 		return -7;
 	}
 
+	if (custom) {
+		return set_custom_baud(fdes, baud);
+	}
+
 	return 0;   // Serial port configured correctly
 }
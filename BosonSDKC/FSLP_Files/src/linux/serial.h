@@ -24,10 +24,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 #include <termios.h>
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/ioctl.h>
+#include <poll.h>
 
 #define BYTES_READ	1
 #define COLARX		100
@@ -71,8 +73,15 @@ int open_port(PortSettingsType ps,HANDLE *handle);
 // Returns -5 if parity selection failed
 // Returns -6 if stopbits selection failed
 // Returns -7 if cannot update new options
+// Rates without a B* constant go through termios2/BOTHER, see set_custom_baud()
 int setup_serial(int, int, int, int, int);
 
+// Set input and output speed of an already configured port to any rate
+// Returns 0 on success
+// Returns -2 if the driver has no BOTHER support
+// Returns -3 if the driver can't get within 3% of baud
+int set_custom_baud(int fd, int baud);
+
 // Close the serial port handle
 // Returns 0 on success
 // Returns -1 on error , and errno is updated.
@@ -112,6 +121,12 @@ int txbyte_waiting(HANDLE fd);
 // timeout = 0 if no timeout, timeout = 1 if timeout
 unsigned char read_byte_time(HANDLE fd, int plazo, int *timeout);
 
+// Read whatever is waiting, up to max_bytes, within a period of time
+// Returns number of bytes read, at least 1
+// Returns 0 if timeout happened
+// Returns -1 on error
+int read_buffer_time(HANDLE fd, unsigned char *rx_array, int max_bytes, int plazo);
+
 // Read a byte. Blocking call. waits until byte is received
 // Returns byte read
 unsigned char read_byte(HANDLE fd);
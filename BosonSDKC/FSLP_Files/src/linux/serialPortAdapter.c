@@ -1,15 +1,46 @@
 #include "serialPortAdapter.h"
+#include "fslpConfig.h"
 //specific implementation of serial port
 #include "serial.h"
-//platform agnostic timeout
-// #include "timeoutLogic.h" not needed for current serial library.
+//platform agnostic timeout: read deadlines and the port stats
+#include "timeoutLogic.h"
 #include <stdio.h>
 
 #define DO_DEBUG_TRACE(...)    //printf(__VA_ARGS__)
 
 #define KNOWN_PORTS 48
 
+#define RX_BUF_SIZ FSLP_RX_BUF_SIZ
+
 static HANDLE port_handles[KNOWN_PORTS] = {0};
+
+// Bytes read from the port ahead of the frame parser, so a response
+// costs one select()+read() per burst instead of per byte. Allocated on
+// the first open, so ports never opened cost only a pointer.
+typedef struct {
+    uint8_t buff[RX_BUF_SIZ];
+    int32_t start;
+    int32_t len;
+} RX_BUF_T;
+
+static RX_BUF_T *rx_bufs[KNOWN_PORTS];
+
+static void reset_rx_buf(int32_t port_id)
+{
+    if (rx_bufs[port_id]) {
+        rx_bufs[port_id]->start = 0;
+        rx_bufs[port_id]->len = 0;
+    }
+}
+
+// Traffic since open or the last FSLP_reset_port_stats()
+typedef struct {
+    uint64_t tx_bytes;
+    uint64_t rx_bytes;
+    struct timespec since;
+} PORT_STATS_T;
+
+static PORT_STATS_T port_stats[KNOWN_PORTS];
 static char port_names[KNOWN_PORTS][16] = {
     "/dev/ttyUSB0", "/dev/ttyUSB1","/dev/ttyUSB2","/dev/ttyUSB3",
     "/dev/ttyUSB4","/dev/ttyUSB5","/dev/ttyUSB6", "/dev/ttyUSB7",
@@ -43,11 +74,27 @@ int32_t FSLP_lookup_port_id( char *port_name, int32_t len ){
     return -1;
 }
 
+int32_t FSLP_set_port_name(int32_t port_id, const char *port_name){
+    if (port_id < 0 || port_id >= KNOWN_PORTS || !port_name)
+        return -1;
+    if (strlen(port_name) >= sizeof(port_names[port_id]))
+        return -1;
+
+    strcpy(port_names[port_id], port_name);
+    return 0;
+}
+
 uint8_t FSLP_open_port(int32_t port_id, int32_t baud_rate){
     char settings_buff[16];
+    if (!rx_bufs[port_id])
+        rx_bufs[port_id] = calloc(1, sizeof(RX_BUF_T));
+    if (!rx_bufs[port_id])
+        return (uint8_t) -1;
     sprintf(settings_buff,"%d,8,n,1",baud_rate);
     PortSettingsType port_settings = str2ps(port_names[port_id], settings_buff);
     int32_t success = open_port(port_settings, &(port_handles[port_id]) );
+    reset_rx_buf(port_id);
+    FSLP_reset_port_stats(port_id);
     if (0 != success)
     {
         port_handles[port_id] = 0;
@@ -58,23 +105,94 @@ uint8_t FSLP_open_port(int32_t port_id, int32_t baud_rate){
 void FSLP_close_port(int32_t port_id){
     int32_t ignore = close_port(port_handles[port_id]);
     port_handles[port_id] = 0;
+    reset_rx_buf(port_id);
+}
+
+uint8_t FSLP_set_baud_rate(int32_t port_id, int32_t baud_rate){
+    int32_t success = setup_serial(port_handles[port_id], baud_rate, 8, ONESTOPBIT, NOPARITY);
+    // anything buffered was sampled at the old rate
+    reset_rx_buf(port_id);
+    return (uint8_t) success; // 0 == success.
 }
 
 //Return type is int16_t, so that the full uint8_t value can be represented
 // without overlapping with negative error codes.
-int16_t FSLP_read_byte_with_timeout(int32_t port_id, double timeout)
+int16_t FSLP_read_byte_by_deadline(int32_t port_id, int64_t deadline)
+{
+    RX_BUF_T *rx = rx_bufs[port_id];
+
+    if (!rx) {
+        return -1;
+    }
+    if (0 == rx->len) {
+        // the deadline only applies when nothing is buffered, so the clock
+        // is read once per burst, not per byte
+        int64_t left_ns = deadline_remaining_ns(deadline);
+        int32_t got;
+
+        if (left_ns <= 0) {
+            return -1;
+        }
+        got = read_buffer_time(port_handles[port_id], rx->buff, RX_BUF_SIZ, (int32_t) ((left_ns + 999) / 1000));
+        if (got <= 0) {
+            return -1;
+        }
+        DO_DEBUG_TRACE("rx burst %d bytes\n", got);
+        rx->start = 0;
+        rx->len = got;
+        port_stats[port_id].rx_bytes += got;
+    }
+
+    rx->len--;
+    return (int16_t) rx->buff[rx->start++];
+}
+
+int32_t FSLP_read_available(int32_t port_id, uint8_t *buf, int32_t max_bytes)
 {
-    uint8_t in_byte = 0x00;
-    int32_t timeout_us = (int32_t) (timeout*1e6); //seconds * 1e6
-    int32_t timeout_occurred = 0; 
+    RX_BUF_T *rx = rx_bufs[port_id];
+    int32_t got;
 
-    in_byte = read_byte_time( port_handles[port_id] , timeout_us, &timeout_occurred);
+    if (!rx)
+        return -1;
+    if (rx->len) {
+        // bytes read ahead go first
+        got = (rx->len < max_bytes) ? rx->len : max_bytes;
+        memcpy(buf, &rx->buff[rx->start], got);
+        rx->start += got;
+        rx->len -= got;
+        return got;
+    }
 
-    if (0 != timeout_occurred) {
+    got = read_buffer_time(port_handles[port_id], buf, max_bytes, 0);
+    if (got > 0)
+        port_stats[port_id].rx_bytes += got;
+    return got;
+}
+
+int32_t FSLP_get_port_fd(int32_t port_id){
+    if (port_id < 0 || port_id >= KNOWN_PORTS || !port_handles[port_id])
         return -1;
+    return port_handles[port_id];
+}
+
+void FSLP_get_port_stats(int32_t port_id, uint64_t *tx_bytes, uint64_t *rx_bytes, double *seconds){
+    PORT_STATS_T *st = &port_stats[port_id];
+    struct timespec now;
+
+    if (tx_bytes) *tx_bytes = st->tx_bytes;
+    if (rx_bytes) *rx_bytes = st->rx_bytes;
+    if (seconds) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        *seconds = diff_timespec(&now, &st->since);
     }
+}
+
+void FSLP_reset_port_stats(int32_t port_id){
+    PORT_STATS_T *st = &port_stats[port_id];
 
-    return (int16_t) in_byte;
+    st->tx_bytes = 0;
+    st->rx_bytes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &st->since);
 }
 
 void FSLP_flush_write_buffer(int32_t port_id)
@@ -90,13 +208,15 @@ void FSLP_flush_write_buffer(int32_t port_id)
     int32_t FSLP_write_buffer(int32_t port_id, uint8_t *frame_buf, int32_t len)
     {
         int32_t result;
-        FSLP_flush_write_buffer(port_id);
+        // no tcflush() here: it would throw away a pipelined frame still in
+        // the TX queue
         result = send_buffer(port_handles[port_id], frame_buf, (uint16_t) len); 
         if (0==result)
         {
             // per serialPortAdapter.h, return num bytes sent
             // send_buffer returns 0 for success, -1 for failure.
             // Need to translate error space.
+            port_stats[port_id].tx_bytes += len;
             return len;
         }
         else
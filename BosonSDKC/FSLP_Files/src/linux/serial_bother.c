@@ -0,0 +1,44 @@
+// Arbitrary baud rates through termios2/BOTHER
+//
+// <asm/termbits.h> redefines struct termios, so this can't share a file
+// (or serial.h) with serial.c, which needs the libc <termios.h>.
+
+#include <asm/termbits.h>
+#include <sys/ioctl.h>
+
+// Largest mismatch between requested and actual rate the UART still decodes
+#define BAUD_TOLERANCE_PCT	3
+
+// Set input and output speed of an already configured port to baud
+// Returns 0 on success
+// Returns -2 if the driver has no BOTHER support
+// Returns -3 if the driver can't get close enough to baud
+int set_custom_baud(int fd, int baud) {
+	struct termios2 tio;
+	int err;
+
+	if (ioctl(fd, TCGETS2, &tio) != 0) {
+		return -2;
+	}
+
+	tio.c_cflag &= ~(CBAUD | (CBAUD << IBSHIFT));
+	tio.c_cflag |= BOTHER | (BOTHER << IBSHIFT);
+	tio.c_ospeed = baud;
+	tio.c_ispeed = baud;
+	if (ioctl(fd, TCSETS2, &tio) != 0) {
+		return -2;
+	}
+
+	// drivers round to the nearest divisor, read back what they chose
+	if (ioctl(fd, TCGETS2, &tio) != 0) {
+		return -3;
+	}
+	err = (int) tio.c_ospeed - baud;
+	if (err < 0) {
+		err = -err;
+	}
+	if ((long long) err * 100 > (long long) baud * BAUD_TOLERANCE_PCT) {
+		return -3;
+	}
+	return 0;
+}
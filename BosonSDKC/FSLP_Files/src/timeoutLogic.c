@@ -25,3 +25,32 @@ double diff_timespec(struct timespec *current, struct timespec *reference)
     elapsed_sec += (((double)current->tv_nsec) - ((double)reference->tv_nsec))/1000000000;
     return elapsed_sec;
 }
+
+#if defined(__linux__) || defined(__FreeBSD__)
+int64_t monotonic_ns(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (int64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+#else //windows
+int64_t monotonic_ns(void)
+{
+    LARGE_INTEGER count, freq;
+    QueryPerformanceCounter(&count);
+    QueryPerformanceFrequency(&freq);
+    // split, so count * 1e9 can't overflow
+    return (count.QuadPart / freq.QuadPart) * 1000000000 +
+           ((count.QuadPart % freq.QuadPart) * 1000000000) / freq.QuadPart;
+}
+#endif
+
+int64_t deadline_after_ms(uint32_t ms)
+{
+    return monotonic_ns() + (int64_t)ms * 1000000;
+}
+
+int64_t deadline_remaining_ns(int64_t deadline)
+{
+    return deadline - monotonic_ns();
+}
@@ -48,6 +48,28 @@ int32_t open_port(char *port_name, uint32_t baudrate, HANDLE *comm_handle)
 
 }
 
+// Change the baudrate of an open port, any rate the driver accepts
+// Returns 0 on success
+// Returns -1 if cannot read the port config
+// Returns -3 if failed to apply port config settings
+int32_t set_baud_rate(HANDLE comm_handle, uint32_t baudrate)
+{
+    DCB port_settings = {0};
+    port_settings.DCBlength = sizeof(port_settings);
+
+    if (0 == GetCommState(comm_handle, &port_settings))
+    {
+        return -1;
+    }
+
+    port_settings.BaudRate = (DWORD) baudrate;
+    if (0 == SetCommState(comm_handle, &port_settings))
+    {
+        return -3;
+    }
+    return 0;
+}
+
 // Close the serial port
 // Returns 0 on success
 // Returns -1 on error
@@ -25,6 +25,12 @@
 // Returns -3 if failed to apply port config settings
 int32_t open_port(char *port_name, uint32_t baudrate, HANDLE *comm_handle);
 
+// Change the baudrate of an open port, any rate the driver accepts
+// Returns 0 on success
+// Returns -1 if cannot read the port config
+// Returns -3 if failed to apply port config settings
+int32_t set_baud_rate(HANDLE comm_handle, uint32_t baudrate);
+
 
 // Close the serial port handle
 // Returns 0 on success
@@ -1,14 +1,23 @@
 #include "serialPortAdapter.h"
 //specific implementation of serial port
 #include "FLIR_Win32_Serial.h"
-//platform agnostic timeout
-// #include "timeoutLogic.h" not needed for current serial library.
+//platform agnostic timeout: read deadlines and the port stats
+#include "timeoutLogic.h"
 
 #define DO_DEBUG_TRACE(...)    //printf(__VA_ARGS__)
 
 #define KNOWN_PORTS 48
 
 static HANDLE port_handles[KNOWN_PORTS] = {0};
+
+// Traffic since open or the last FSLP_reset_port_stats()
+typedef struct {
+    uint64_t tx_bytes;
+    uint64_t rx_bytes;
+    struct timespec since;
+} PORT_STATS_T;
+
+static PORT_STATS_T port_stats[KNOWN_PORTS];
 static char port_names[KNOWN_PORTS][6] = {
     "COM1", "COM2","COM3","COM4",
     "COM5", "COM6","COM7","COM8",
@@ -43,10 +52,21 @@ int32_t FSLP_lookup_port_id( char *port_name, int32_t len ){
     return -1;
 }
 
+int32_t FSLP_set_port_name(int32_t port_id, const char *port_name){
+    if (port_id < 0 || port_id >= KNOWN_PORTS || !port_name)
+        return -1;
+    if (strlen(port_name) >= sizeof(port_names[port_id]))
+        return -1;
+
+    strcpy(port_names[port_id], port_name);
+    return 0;
+}
+
 uint8_t FSLP_open_port(int32_t port_id, int32_t baud_rate){
     char full_port_name[16];
     sprintf(full_port_name, "\\\\.\\%s",port_names[port_id]);
     int32_t success = open_port( full_port_name, baud_rate, &(port_handles[port_id]));
+    FSLP_reset_port_stats(port_id);
     if (0 != success)
     {
         port_handles[port_id] = 0;
@@ -59,23 +79,74 @@ void FSLP_close_port(int32_t port_id){
     port_handles[port_id] = 0;
 }
 
+uint8_t FSLP_set_baud_rate(int32_t port_id, int32_t baud_rate){
+    int32_t success = set_baud_rate(port_handles[port_id], baud_rate);
+    return (uint8_t) success; // 0 == success.
+}
+
 //Return type is int16_t, so that the full uint8_t value can be represented
 // without overlapping with negative error codes.
-int16_t FSLP_read_byte_with_timeout(int32_t port_id, double timeout)
+int16_t FSLP_read_byte_by_deadline(int32_t port_id, int64_t deadline)
 {
     uint8_t in_byte = 0x00;
-    int32_t timeout_ms = (int32_t) (timeout*1e3); //seconds * 1e3
+    int64_t left_ns = deadline_remaining_ns(deadline);
+    int32_t timeout_ms;
     int32_t timeout_occurred; 
 
+    if (left_ns <= 0) {
+        return (int16_t)-1;
+    }
+    timeout_ms = (int32_t) ((left_ns + 999999) / 1000000);
     timeout_occurred = read_byte_with_timeout(port_handles[port_id], timeout_ms, &in_byte);
 
     if (0 != timeout_occurred) {
         return (int16_t)-1;
     }
+    port_stats[port_id].rx_bytes++;
 
     return (int16_t) in_byte;
 }
 
+int32_t FSLP_read_available(int32_t port_id, uint8_t *buf, int32_t max_bytes)
+{
+    int32_t got = 0;
+
+    // no read-ahead here: take bytes one at a time (1 ms limit each) until
+    // the driver has none
+    while (got < max_bytes) {
+        if (0 != read_byte_with_timeout(port_handles[port_id], 0, &buf[got]))
+            break;
+        got++;
+    }
+    port_stats[port_id].rx_bytes += got;
+    return got;
+}
+
+int32_t FSLP_get_port_fd(int32_t port_id){
+    // a COM handle can't go into poll(); call FSLP_pump() from a timer
+    return -1;
+}
+
+void FSLP_get_port_stats(int32_t port_id, uint64_t *tx_bytes, uint64_t *rx_bytes, double *seconds){
+    PORT_STATS_T *st = &port_stats[port_id];
+    struct timespec now;
+
+    if (tx_bytes) *tx_bytes = st->tx_bytes;
+    if (rx_bytes) *rx_bytes = st->rx_bytes;
+    if (seconds) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        *seconds = diff_timespec(&now, &st->since);
+    }
+}
+
+void FSLP_reset_port_stats(int32_t port_id){
+    PORT_STATS_T *st = &port_stats[port_id];
+
+    st->tx_bytes = 0;
+    st->rx_bytes = 0;
+    clock_gettime(CLOCK_MONOTONIC, &st->since);
+}
+
 void FSLP_flush_write_buffer(int32_t port_id)
 {
     flush_tx_buffer(port_handles[port_id]);
@@ -91,6 +162,8 @@ void FSLP_flush_write_buffer(int32_t port_id)
         int32_t result;
         FSLP_flush_write_buffer(port_id);
         result = write_buffer(port_handles[port_id], frame_buf, len);
+        if (0 == result)
+            port_stats[port_id].tx_bytes += len;
         return (len + result); //returns len if successful, len-1 or len-2 according to FLIR_Win32_Serial interface.
     }
 #endif// WRITE_BUFFER_AS_SINGLE_BYTES vs frame writes
@@ -9,10 +9,13 @@
  *	2026.0417.	Cleaned up supported video formats by different Boson sensors - 320 and 640.
  */
 
+#include <linux/compat.h>
 #include <linux/delay.h>
 #include <linux/device.h>
+#include <linux/gcd.h>
 #include <linux/i2c.h>
 #include <linux/init.h>
+#include <linux/ktime.h>
 #include <linux/module.h>
 #include <linux/of_device.h>
 #include <linux/of_gpio.h>
@@ -20,10 +23,12 @@
 #include <linux/random.h>
 #include <linux/slab.h>
 #include <linux/types.h>
+#include <linux/uaccess.h>
 
 #include <linux/videodev2.h>
 
 #include <linux/version.h>
+#include <media/mipi-csi2.h>
 #include <media/v4l2-async.h>
 #include <media/v4l2-ctrls.h>
 #include <media/v4l2-device.h>
@@ -35,11 +40,66 @@
 #include "FunctionCodes.h"
 #include "flir-boson.h"
 
-static int SENSOR_WIDTH = 0;
 static int enable_radiometry = 1;
 module_param(enable_radiometry, int, 0644);
 MODULE_PARM_DESC(enable_radiometry, "enable_radiometry");
 
+static bool telemetry_embedded;
+module_param(telemetry_embedded, bool, 0644);
+MODULE_PARM_DESC(telemetry_embedded, "Send telemetry as a CSI-2 embedded-data stream instead of extra image rows");
+
+static bool persist_config;
+module_param(persist_config, bool, 0444);
+MODULE_PARM_DESC(persist_config, "Keep the boot configuration in camera flash and verify it at probe instead of re-sending it");
+
+static unsigned int status_interval_ms = 2000;
+
+/* Bound sensors, so a new status_interval_ms restarts their health work */
+static LIST_HEAD(flir_boson_devices);
+static DEFINE_MUTEX(flir_boson_devices_lock);
+
+static int flir_boson_set_status_interval(const char *val, const struct kernel_param *kp)
+{
+	struct flir_boson_dev *sensor;
+	int ret;
+
+	ret = param_set_uint(val, kp);
+	if (ret || !READ_ONCE(status_interval_ms))
+		return ret;
+
+	mutex_lock(&flir_boson_devices_lock);
+	list_for_each_entry(sensor, &flir_boson_devices, list)
+		mod_delayed_work(system_wq, &sensor->health_work, 0);
+	mutex_unlock(&flir_boson_devices_lock);
+
+	return 0;
+}
+
+static const struct kernel_param_ops flir_boson_status_interval_ops = {
+	.set = flir_boson_set_status_interval,
+	.get = param_get_uint,
+};
+module_param_cb(status_interval_ms, &flir_boson_status_interval_ops, &status_interval_ms, 0644);
+MODULE_PARM_DESC(status_interval_ms, "Refresh period of the FLIR_BOSON_IOCTL_GET_STATUS snapshot in ms, 0 to stop refreshing");
+
+/* Boot readiness polling after reset: the spec allows up to 2.5 s */
+#define FLIR_BOSON_BOOT_TIMEOUT_MS  5000
+#define FLIR_BOSON_BOOT_POLL_MIN_MS 10
+#define FLIR_BOSON_BOOT_POLL_MAX_MS 250
+
+/* MIPI output comes up within a few frames of DVO_SETMIPISTATE ACTIVE */
+#define FLIR_BOSON_MIPI_ACTIVE_TIMEOUT_MS 500
+#define FLIR_BOSON_MIPI_POLL_MIN_US       1000
+#define FLIR_BOSON_MIPI_POLL_MAX_US       20000
+
+/* I2C Fast-mode Plus, which the Boson supports */
+#define FLIR_BOSON_I2C_FMP_HZ 1000000
+
+/* Idle time before runtime suspend puts the camera in low-power standby */
+#define FLIR_BOSON_AUTOSUSPEND_MS   2000
+
+static int flir_set_agc_paramaters(struct flir_boson_dev *sensor);
+
 /**
  * flr_result_to_errno - Convert FLR_RESULT to Linux error code
  * @result: FLR_RESULT code from SDK
@@ -85,31 +145,38 @@ static const struct flir_boson_format flir_boson_formats[] = {
         .flir_type     = FLR_DVO_TYPE_COLOR,
 		.flir_mux_type = FLR_DVOMUX_TYPE_COLOR,
         .name          = "UYVY",
+        .csi2_dt       = MIPI_CSI2_DT_YUV422_8B,
+        .bpp           = 16,
     },
     {
         .code          = MEDIA_BUS_FMT_Y14_1X14,
         .flir_type     = FLR_DVO_TYPE_MONO14,
         .flir_mux_type = FLR_DVOMUX_TYPE_MONO16,
         .name          = "RAW14",
+        .csi2_dt       = MIPI_CSI2_DT_RAW14,
+        .bpp           = 14,
     },
     {
         .code          = MEDIA_BUS_FMT_Y8_1X8,
         .flir_type     = FLR_DVO_TYPE_MONO8,
         .flir_mux_type = FLR_DVOMUX_TYPE_MONO8,
         .name          = "RAW8",
+        .csi2_dt       = MIPI_CSI2_DT_RAW8,
+        .bpp           = 8,
 	},
 };
 
 /* Supported frame sizes */
 // Use reverse order of dimensions to make 640 color formats pass.
 static const struct flir_boson_framesize flir_boson_framesizes[] = {
-    {.width = 640, .height = 514, .max_fps = 60}, // add telementry Line
+    {.width = 640, .height = 514, .max_fps = 60, .telemetry_rows = FLIR_BOSON_TELEMETRY_LINES}, // add telementry Line
     {.width = 640, .height = 512, .max_fps = 60},
     {.width = 320, .height = 256, .max_fps = 60},
 };
 
 #define FLIR_BOSON_NUM_FORMATS ARRAY_SIZE(flir_boson_formats)
 #define FLIR_BOSON_NUM_FRAMESIZES ARRAY_SIZE(flir_boson_framesizes)
+static_assert(ARRAY_SIZE(flir_boson_formats) <= FLIR_BOSON_MAX_FORMATS);
 
 static const struct flir_boson_format *flir_boson_find_format(struct flir_boson_dev *sensor, u32 code) {
 	int i;
@@ -150,108 +217,474 @@ static const struct flir_boson_framesize *flir_boson_find_framesize(u32 width, u
 	}
 
 	// Default to 320 x 256 or 640 x 512
-    return NULL; // (SENSOR_WIDTH==320)? &flir_boson_framesizes[0] : &flir_boson_framesizes[1];
+    return NULL;
+}
+
+/* Boson cores are 5:4, 640x512 or 320x256 */
+static u32 flir_boson_sensor_height(const struct flir_boson_dev *sensor)
+{
+	return sensor->sensor_width * 4 / 5;
+}
+
+/*
+ * Point the camera scaler at sensor->crop: the window is magnified to the
+ * full output, so the MIPI format never changes with the zoom level.
+ * Called with sensor->lock held.
+ */
+static FLR_RESULT flir_boson_apply_zoom(struct flir_boson_dev *sensor)
+{
+	const struct v4l2_rect *r = &sensor->crop;
+	u32 div = gcd(sensor->sensor_width, r->width);
+	FLR_RESULT ret;
+
+	ret = flir_boson_set_fractional_zoom(sensor, sensor->sensor_width / div, r->width / div, r->left + r->width / 2, r->top + r->height / 2);
+	sensor->zoom_dirty = ret != R_SUCCESS;
+	return ret;
+}
+
+/*
+ * Write the isotherm thresholds to both gain tables, so they hold whichever
+ * gain the camera switches to. Called with sensor->lock held.
+ */
+static FLR_RESULT flir_boson_apply_isotherm_temps(struct flir_boson_dev *sensor, const s32 temps[FLIR_ISOTHERM_TEMPS])
+{
+	FLR_RESULT ret;
+
+	ret = flir_boson_set_isotherm_temps(sensor, FLR_ISOTHERM_GAIN_LOW, temps);
+	if (ret == R_SUCCESS)
+		ret = flir_boson_set_isotherm_temps(sensor, FLR_ISOTHERM_GAIN_HIGH, temps);
+	sensor->isotherm_dirty = ret != R_SUCCESS;
+	return ret;
+}
+
+/*
+ * Bring the camera's symbology overlays in line with the overlay cluster.
+ * Only what changed is sent, in one batch: a crosshair that moves costs two
+ * MOVESPRITEs and their shows, static overlays cost no bus traffic at all.
+ * s_ctrl applies the new values; @replay draws the current ones at
+ * power-on. After a failed batch or a camera reboot (overlay_dirty) every
+ * enabled symbol is drawn again. Called with sensor->lock held.
+ */
+static FLR_RESULT flir_boson_apply_overlays(struct flir_boson_dev *sensor, bool replay)
+{
+	bool redraw = replay || sensor->overlay_dirty;
+	struct flir_boson_batch_entry *b = sensor->overlay_batch;
+	u8 (*buf)[FLIR_SYMBOL_MAX_BYTES] = sensor->overlay_data;
+	struct v4l2_ctrl *text_ctrl = sensor->overlay_text_ctrl;
+	bool crosshair = replay ? sensor->crosshair_ctrl->cur.val : sensor->crosshair_ctrl->val;
+	s16 x = replay ? sensor->crosshair_x_ctrl->cur.val : sensor->crosshair_x_ctrl->val;
+	s16 y = replay ? sensor->crosshair_y_ctrl->cur.val : sensor->crosshair_y_ctrl->val;
+	s32 rgb = replay ? sensor->overlay_color_ctrl->cur.val : sensor->overlay_color_ctrl->val;
+	const char *text = replay ? text_ctrl->p_cur.p_char : text_ctrl->p_new.p_char;
+	bool recolor = !redraw && rgb != sensor->overlay_color_ctrl->cur.val;
+	u32 color = 0xff000000 | rgb; /* ARGB, opaque */
+	unsigned int first = 1, n = 1; /* b[0] is kept for SYMBOLOGY_SETENABLE */
+	bool create = false;
+	FLR_RESULT ret;
+
+	if (!crosshair && sensor->crosshair_shown) {
+		flir_boson_batch_symbol_show(&b[n], buf[n], FLIR_OVERLAY_ID_HLINE, false);
+		n++;
+		flir_boson_batch_symbol_show(&b[n], buf[n], FLIR_OVERLAY_ID_VLINE, false);
+		n++;
+	} else if (crosshair && (redraw || recolor || !sensor->crosshair_shown)) {
+		flir_boson_batch_symbol_line(&b[n], buf[n], FLIR_OVERLAY_ID_HLINE, x - FLIR_OVERLAY_CROSSHAIR_ARM, y,
+					     x + FLIR_OVERLAY_CROSSHAIR_ARM, y, color);
+		n++;
+		flir_boson_batch_symbol_line(&b[n], buf[n], FLIR_OVERLAY_ID_VLINE, x, y - FLIR_OVERLAY_CROSSHAIR_ARM, x,
+					     y + FLIR_OVERLAY_CROSSHAIR_ARM, color);
+		n++;
+		create = true;
+	} else if (crosshair && (x != sensor->crosshair_x_ctrl->cur.val || y != sensor->crosshair_y_ctrl->cur.val)) {
+		flir_boson_batch_symbol_move(&b[n], buf[n], FLIR_OVERLAY_ID_HLINE, x - FLIR_OVERLAY_CROSSHAIR_ARM, y);
+		n++;
+		flir_boson_batch_symbol_move(&b[n], buf[n], FLIR_OVERLAY_ID_VLINE, x, y - FLIR_OVERLAY_CROSSHAIR_ARM);
+		n++;
+	}
+	/* Created and moved symbols are drawn by their UPDATEANDSHOW */
+	if (crosshair && n > first) {
+		flir_boson_batch_symbol_show(&b[n], buf[n], FLIR_OVERLAY_ID_HLINE, true);
+		n++;
+		flir_boson_batch_symbol_show(&b[n], buf[n], FLIR_OVERLAY_ID_VLINE, true);
+		n++;
+	}
+
+	if (!*text && sensor->text_shown) {
+		flir_boson_batch_symbol_show(&b[n], buf[n], FLIR_OVERLAY_ID_TEXT, false);
+		n++;
+	} else if (*text && (redraw || recolor || !sensor->text_shown || strcmp(text, text_ctrl->p_cur.p_char))) {
+		flir_boson_batch_symbol_text(&b[n], buf[n], FLIR_OVERLAY_ID_TEXT, 4, 4, sensor->sensor_width - 8,
+					     FLIR_OVERLAY_TEXT_SIZE + 4, FLIR_OVERLAY_TEXT_SIZE, color, text);
+		n++;
+		flir_boson_batch_symbol_show(&b[n], buf[n], FLIR_OVERLAY_ID_TEXT, true);
+		n++;
+		create = true;
+	}
+
+	if (create) {
+		flir_boson_batch_symbol_enable(&b[0], buf[0], true);
+		first = 0;
+	}
+	if (n == first) {
+		sensor->overlay_dirty = false;
+		return R_SUCCESS;
+	}
+	ret = flir_boson_send_batch(sensor, b + first, n - first);
+	sensor->overlay_dirty = ret != R_SUCCESS;
+	if (ret == R_SUCCESS) {
+		sensor->crosshair_shown = crosshair;
+		sensor->text_shown      = *text;
+	}
+	return ret;
+}
+
+/*
+ * Leave low-power standby and bring the DVO/MIPI pipeline up for the
+ * current format. Everything goes through the shadow cache, so only
+ * settings the camera lost are replayed. Called with sensor->lock held.
+ */
+static FLR_RESULT flir_boson_power_on(struct flir_boson_dev *sensor)
+{
+	FLR_RESULT ret;
+
+	ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_OPERATING_MODE, SYSCTRL_SETOPERATINGMODE, FLR_SYSCTRL_MODE_NORMAL_IMAGING, 100);
+
+	/* Initialize MIPI interface */
+	dev_dbg(sensor->dev, "POWER: Setting output interface to MIPI");
+	if (ret == R_SUCCESS) ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_MIPI_STATE, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
+	if (ret == R_SUCCESS) ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_DVO_TYPE, DVO_SETTYPE, sensor->current_format->flir_type, 100);
+	if (ret == R_SUCCESS)
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_DVO_OUTPUT_FORMAT, DVO_SETOUTPUTFORMAT,
+					     sensor->current_format->flir_type == FLR_DVO_TYPE_COLOR ? FLR_DVO_YCBCR : FLR_DVO_IR16, 1);
+	if (ret == R_SUCCESS) ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_DVO_OUTPUT_IF, DVO_SETOUTPUTINTERFACE, FLR_DVO_MIPI, 100);
+	if (ret == R_SUCCESS) ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_FRAME_SKIP, ROIC_SETFRAMESKIP, sensor->frame_skip, 1);
+	if (ret == R_SUCCESS && sensor->ffc_mode_ctrl)
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_FFC_MODE, BOSON_SETFFCMODE, sensor->ffc_mode_ctrl->cur.val, 1);
+	if (ret == R_SUCCESS && sensor->low_latency_ctrl)
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_LOW_LATENCY, LATENCYCTRL_SETLOWLATENCYSTATE,
+					     sensor->low_latency_ctrl->cur.val ? FLR_ENABLE : FLR_DISABLE, 1);
+	if (ret == R_SUCCESS && sensor->jitter_dirty) {
+		ret = flir_boson_set_jitter_reduction(sensor, sensor->jitter_ctrl->cur.val ? FLR_ENABLE : FLR_DISABLE,
+						      sensor->jitter_line_ctrl->cur.val);
+		sensor->jitter_dirty = ret != R_SUCCESS;
+	}
+	if (ret == R_SUCCESS && sensor->zoom_dirty)
+		ret = flir_boson_apply_zoom(sensor);
+	if (ret == R_SUCCESS && sensor->color_lut_ctrl) {
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_COLOR_LUT, COLORLUT_SETID, sensor->color_lut_ctrl->cur.val, 0);
+		if (ret == R_SUCCESS)
+			ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_COLOR_LUT_STATE, COLORLUT_SETCONTROL,
+						     sensor->color_lut_enable_ctrl->cur.val ? FLR_ENABLE : FLR_DISABLE, 0);
+	}
+	if (ret == R_SUCCESS && sensor->isotherm_ctrl) {
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_ISOTHERM_UNIT, ISOTHERM_SETUNIT, sensor->isotherm_unit_ctrl->cur.val, 0);
+		if (ret == R_SUCCESS)
+			ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_ISOTHERM_STATE, ISOTHERM_SETENABLE,
+						     sensor->isotherm_ctrl->cur.val ? FLR_ENABLE : FLR_DISABLE, 0);
+	}
+	if (ret == R_SUCCESS && sensor->isotherm_dirty) {
+		s32 temps[FLIR_ISOTHERM_TEMPS];
+		int i;
+
+		for (i = 0; i < FLIR_ISOTHERM_TEMPS; i++)
+			temps[i] = sensor->isotherm_temp_ctrls[i]->cur.val;
+		ret = flir_boson_apply_isotherm_temps(sensor, temps);
+	}
+	if (ret == R_SUCCESS && sensor->overlay_dirty)
+		ret = flir_boson_apply_overlays(sensor, true);
+
+	if (ret != R_SUCCESS) {
+		dev_err(sensor->dev, "Failed to set MIPI interface: %s\n", flr_result_to_string(ret));
+		return ret;
+	}
+	dev_dbg(sensor->dev, "POWER: Output interface set to MIPI successfully");
+	flir_boson_event(sensor, FLIR_EVENT_STATE, "power on, dvo type %u", sensor->current_format->flir_type);
+	sensor->powered    = true;
+	sensor->mipi_state = FLR_DVO_MIPI_STATE_OFF;
+
+	return R_SUCCESS;
+}
+
+/*
+ * Enter low-power standby: MIPI off, clock lane non-continuous so the
+ * D-PHY can drop to LP-11, camera core in FLR_SYSCTRL_MODE_LOW_POWER.
+ * Called with sensor->lock held.
+ */
+static FLR_RESULT flir_boson_power_off(struct flir_boson_dev *sensor)
+{
+    FLR_RESULT ret;
+
+	ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_MIPI_STATE, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
+	if (ret == R_SUCCESS)
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_CLOCK_LANE, DVO_SETMIPICLOCKLANEMODE, FLR_DVO_MIPI_CLOCK_LANE_MODE_NON_CONTINUOUS, 1);
+	if (ret == R_SUCCESS)
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_OPERATING_MODE, SYSCTRL_SETOPERATINGMODE, FLR_SYSCTRL_MODE_LOW_POWER, 100);
+	if (ret != R_SUCCESS) {
+		dev_warn(sensor->dev, "Failed to enter low-power mode: %s\n", flr_result_to_string(ret));
+		return ret;
+	}
+
+	flir_boson_event(sensor, FLIR_EVENT_STATE, "standby");
+	sensor->streaming  = false;
+	sensor->powered    = false;
+	sensor->mipi_state = FLR_DVO_MIPI_STATE_OFF;
+
+	return R_SUCCESS;
+}
+
+static int __maybe_unused flir_boson_runtime_suspend(struct device *dev)
+{
+	struct v4l2_subdev    *sd     = dev_get_drvdata(dev);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+	FLR_RESULT             ret;
+
+	/* Don't let queued setters wake the camera back up behind our back */
+	flir_boson_cmd_queue_flush(sensor);
+
+	mutex_lock(&sensor->lock);
+	ret = flir_boson_power_off(sensor);
+	mutex_unlock(&sensor->lock);
+
+	return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+}
+
+static int __maybe_unused flir_boson_runtime_resume(struct device *dev)
+{
+	struct v4l2_subdev    *sd     = dev_get_drvdata(dev);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+	FLR_RESULT             ret;
+
+	mutex_lock(&sensor->lock);
+	ret = flir_boson_power_on(sensor);
+	mutex_unlock(&sensor->lock);
+
+	return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
 }
 
 /* V4L2 Subdev Core Operations */
 static int flir_boson_s_power(struct v4l2_subdev *sd, int on) {
 	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
     FLR_RESULT             ret    = R_SUCCESS;
+    int                    err;
 
 	dev_dbg(sensor->dev, "%s: power %s\n", __func__, on ? "on" : "off");
 
-	mutex_lock(&sensor->lock);
+	if (on) {
+		err = pm_runtime_resume_and_get(sensor->dev);
+		if (err)
+			return err;
 
-	if (on && !sensor->powered) {
-		// if (sensor->reset_gpio) {
-		// 	gpiod_set_value_cansleep(sensor->reset_gpio, 0);
-		// 	msleep(10);
-		// 	gpiod_set_value_cansleep(sensor->reset_gpio, 1);
-		// 	msleep(100);
-		// }
-
-		// /* Wait for camera boot (2.5 seconds as per spec) */
-		// msleep(2500);
-
-		/* Initialize MIPI interface */
-		dev_dbg(sensor->dev, "POWER: Setting output interface to MIPI");
-        if (ret == R_SUCCESS) ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
-        if (ret == R_SUCCESS) ret = flir_boson_send_int_cmd(sensor, DVO_SETTYPE, sensor->current_format->flir_type, 100);
-		if (ret == R_SUCCESS)
-            ret =
-                flir_boson_send_int_cmd(sensor, DVO_SETOUTPUTFORMAT, sensor->current_format->flir_type == FLR_DVO_TYPE_COLOR ? FLR_DVO_YCBCR : FLR_DVO_IR16, 1);
-        if (ret == R_SUCCESS) ret = flir_boson_send_int_cmd(sensor, DVO_SETOUTPUTINTERFACE, FLR_DVO_MIPI, 100);
+		/* Without CONFIG_PM the runtime callbacks never run */
+		mutex_lock(&sensor->lock);
+		if (!sensor->powered)
+			ret = flir_boson_power_on(sensor);
+		mutex_unlock(&sensor->lock);
 
 		if (ret != R_SUCCESS) {
-			dev_err(sensor->dev, "Failed to set MIPI interface: %s\n", flr_result_to_string(ret));
-			ret = flr_result_to_errno(ret);
-            goto unlock;
-		}
-		dev_dbg(sensor->dev, "POWER: Output interface set to MIPI successfully");
-		sensor->powered = 1;
-        ret             = flir_boson_get_int_val(sensor, DVO_GETMIPISTATE, &sensor->mipi_state);
-        if (ret != R_SUCCESS) dev_warn(sensor->dev, "Failed to get MIPI state: %s", flr_result_to_string(ret));
-	} else if (!on && sensor->powered) {
-		/* Stop streaming if active */
-		if (sensor->streaming) {
-			dev_dbg(sensor->dev, "POWER: Stopping streaming during power down");
-			ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
-            if (ret != R_SUCCESS) dev_warn(sensor->dev, "Failed to stop MIPI during power down: %s", flr_result_to_string(ret));
-			sensor->streaming = 0;
-			dev_dbg(sensor->dev, "POWER: Streaming stopped");
+			pm_runtime_put(sensor->dev);
+			return flr_result_to_errno(ret);
 		}
+		return 0;
+	}
+
+	/* Stop streaming if active */
+	mutex_lock(&sensor->lock);
+	if (sensor->streaming) {
+		dev_dbg(sensor->dev, "POWER: Stopping streaming during power down");
+		ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
+        flir_boson_shadow_store(sensor, FLIR_SHADOW_MIPI_STATE, FLR_DVO_MIPI_STATE_OFF, ret);
+        if (ret != R_SUCCESS) dev_warn(sensor->dev, "Failed to stop MIPI during power down: %s", flr_result_to_string(ret));
+		sensor->streaming = 0;
+		/* s_stream(0) now sees no stream, drop the reference s_stream(1) took */
+		pm_runtime_put_noidle(sensor->dev);
+		dev_dbg(sensor->dev, "POWER: Streaming stopped");
+	}
+	mutex_unlock(&sensor->lock);
+	cancel_delayed_work_sync(&sensor->ffc_work);
+	cancel_delayed_work_sync(&sensor->stats_work);
+
+	/* Standby is entered from runtime suspend once the autosuspend delay expires */
+	pm_runtime_mark_last_busy(sensor->dev);
+	pm_runtime_put_autosuspend(sensor->dev);
 
-		// if (sensor->reset_gpio)
-		// 	gpiod_set_value_cansleep(sensor->reset_gpio, 0);
+	return 0;
+}
 
-		// sensor->powered = false;
+/*
+ * Poll DVO_GETMIPISTATE until the output is active instead of sleeping
+ * the worst case after the setter. Called with sensor->lock held.
+ */
+static FLR_RESULT flir_boson_wait_mipi_active(struct flir_boson_dev *sensor)
+{
+	ktime_t deadline = ktime_add_ms(ktime_get(), FLIR_BOSON_MIPI_ACTIVE_TIMEOUT_MS);
+	unsigned long delay_us = FLIR_BOSON_MIPI_POLL_MIN_US;
+	FLR_RESULT ret;
+	u32 state;
+
+	for (;;) {
+		ret = flir_boson_get_int_val(sensor, DVO_GETMIPISTATE, &state);
+		if (ret != R_SUCCESS)
+			return ret;
+		if (state == FLR_DVO_MIPI_STATE_ACTIVE)
+			return R_SUCCESS;
+		if (ktime_after(ktime_get(), deadline))
+			return FLR_COMM_TIMEOUT_ERROR;
+
+		usleep_range(delay_us, delay_us * 2);
+		delay_us = min_t(unsigned long, delay_us * 2, FLIR_BOSON_MIPI_POLL_MAX_US);
 	}
+}
 
-unlock:
-	mutex_unlock(&sensor->lock);
-	return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+static void flir_boson_stream_stats_record(struct flir_stream_stats *st, ktime_t start)
+{
+	u32 us = (u32)ktime_us_delta(ktime_get(), start);
+
+	if (!st->count || us < st->min_us)
+		st->min_us = us;
+	if (us > st->max_us)
+		st->max_us = us;
+	st->last_us = us;
+	st->sum_us += us;
+	st->count++;
+}
+
+/* Filter states of each enum flir_boson_processing_profile, in flir_profile_slots order */
+static const u8 flir_profile_slots[] = {
+	FLIR_SHADOW_SPNR_STATE, FLIR_SHADOW_SCNR_STATE, FLIR_SHADOW_SRNR_STATE, FLIR_SHADOW_TF_STATE, FLIR_SHADOW_AVERAGER_STATE,
+};
+
+static const u32 flir_profile_states[FLIR_BOSON_PROFILE_COUNT][ARRAY_SIZE(flir_profile_slots)] = {
+	[FLIR_BOSON_PROFILE_LOW_LATENCY] = { FLR_DISABLE, FLR_DISABLE, FLR_DISABLE, FLR_DISABLE, FLR_DISABLE },
+	[FLIR_BOSON_PROFILE_BALANCED]    = { FLR_DISABLE, FLR_ENABLE, FLR_ENABLE, FLR_DISABLE, FLR_DISABLE },
+	[FLIR_BOSON_PROFILE_LOW_NOISE]   = { FLR_ENABLE, FLR_ENABLE, FLR_ENABLE, FLR_ENABLE, FLR_ENABLE },
+};
+
+/*
+ * Send the filter states of the selected processing profile as one
+ * batch; states the camera already has are skipped. Called with
+ * sensor->lock held, the camera powered.
+ */
+static FLR_RESULT flir_boson_apply_profile(struct flir_boson_dev *sensor)
+{
+	s32 profile = sensor->profile_ctrl->cur.val;
+
+	if (profile == FLIR_BOSON_PROFILE_CAMERA)
+		return R_SUCCESS;
+	return flir_boson_shadow_send_batch(sensor, flir_profile_slots, flir_profile_states[profile], ARRAY_SIZE(flir_profile_slots));
+}
+
+/*
+ * Send what is applied at stream-on and bring MIPI active, from stream-on
+ * and system resume. Called with sensor->lock held, the camera powered.
+ */
+static FLR_RESULT flir_boson_start_mipi(struct flir_boson_dev *sensor)
+{
+	u32 clock_lane;
+	FLR_RESULT ret;
+
+	/* Clock lane mode follows the endpoint; standby always uses non-continuous */
+	clock_lane = (sensor->ep.bus.mipi_csi2.flags & V4L2_MBUS_CSI2_NONCONTINUOUS_CLOCK) ? FLR_DVO_MIPI_CLOCK_LANE_MODE_NON_CONTINUOUS
+											  : FLR_DVO_MIPI_CLOCK_LANE_MODE_CONTINUOUS;
+	/* AGC tuning changed while idle goes out in one batch */
+	if (flir_set_agc_paramaters(sensor))
+		dev_warn(sensor->dev, "STREAM: Some AGC parameters were not applied");
+	if (flir_boson_apply_profile(sensor) != R_SUCCESS)
+		dev_warn(sensor->dev, "STREAM: Some processing profile filters were not applied");
+
+	/* Sync role is fixed for the whole stream, a slave waits for the master's pulses */
+	ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_EXT_SYNC, BOSON_SETEXTSYNCMODE, sensor->ext_sync_ctrl->cur.val, 1);
+	if (ret == R_SUCCESS)
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_CLOCK_LANE, DVO_SETMIPICLOCKLANEMODE, clock_lane, 1);
+	/* Start streaming */
+	dev_dbg(sensor->dev, "STREAM: Starting streaming - setting MIPI to ACTIVE");
+	if (ret == R_SUCCESS) {
+		ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_ACTIVE, 1);
+		flir_boson_shadow_store(sensor, FLIR_SHADOW_MIPI_STATE, FLR_DVO_MIPI_STATE_ACTIVE, ret);
+	}
+	if (ret == R_SUCCESS)
+		ret = flir_boson_wait_mipi_active(sensor);
+	if (ret != R_SUCCESS)
+		return ret;
+
+	sensor->streaming  = true;
+	sensor->mipi_state = FLR_DVO_MIPI_STATE_ACTIVE;
+	return R_SUCCESS;
 }
 
 /* V4L2 Subdev Video Operations */
 static int flir_boson_s_stream_priv(struct flir_boson_dev *sensor, int enable) {
     FLR_RESULT ret = R_SUCCESS;
-    u32        state;
+    ktime_t    start = ktime_get();
+    bool       was_streaming;
+    int        err;
 
     dev_dbg(sensor->dev, "%s: stream %s\n", __func__, enable ? "on" : "off");
     dev_dbg(sensor->dev, "STREAM: Current state - powered=%d, streaming=%d, mipi_state=%d, en=%d", sensor->powered, sensor->streaming, sensor->mipi_state,
             enable);
 
+    /* Settings queued by set_fmt must reach the camera before MIPI goes active */
+    if (enable) {
+        flir_boson_cmd_queue_flush(sensor);
+
+        /* Balanced by the put below on failure, or on stream-off */
+        err = pm_runtime_resume_and_get(sensor->dev);
+        if (err)
+            return err;
+    }
+
     mutex_lock(&sensor->lock);
+    was_streaming = sensor->streaming;
+
+    /* Without CONFIG_PM the runtime callbacks never run */
+    if (enable && !sensor->powered)
+        ret = flir_boson_power_on(sensor);
 
-    if (enable && !sensor->streaming) {
-        dev_dbg(sensor->dev, "STREAM: Starting streaming - setting MIPI to ACTIVE");
-        ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPICLOCKLANEMODE, FLR_DVO_MIPI_CLOCK_LANE_MODE_CONTINUOUS, 1);
-        /* Start streaming */
-        dev_dbg(sensor->dev, "STREAM: Starting streaming - setting MIPI to ACTIVE");
-        ret |= flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_ACTIVE, 400);
+    if (ret == R_SUCCESS && enable && !sensor->streaming) {
+        ret = flir_boson_start_mipi(sensor);
         if (ret != R_SUCCESS) {
             dev_err(sensor->dev, "Failed to start MIPI: %s\n", flr_result_to_string(ret));
             goto unlock;
-        } else {
-            sensor->streaming = true;
-            dev_dbg(sensor->dev, "STREAM: Streaming started successfully");
-            ret = flir_boson_get_int_val(sensor, DVO_GETMIPISTATE, &state);
-            dev_dbg(sensor->dev, "mipi State: %d", state);
         }
+        flir_boson_stream_stats_record(&sensor->stream_on_stats, start);
+        flir_boson_event(sensor, FLIR_EVENT_STATE, "stream on in %u us", READ_ONCE(sensor->stream_on_stats.last_us));
+        dev_dbg(sensor->dev, "STREAM: Streaming started successfully");
     } else if (!enable && sensor->streaming) {
         /* Stop streaming */
         dev_dbg(sensor->dev, "STREAM: Stopping streaming - setting MIPI to OFF");
         ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
+        flir_boson_shadow_store(sensor, FLIR_SHADOW_MIPI_STATE, FLR_DVO_MIPI_STATE_OFF, ret);
         if (ret != R_SUCCESS) {
             dev_err(sensor->dev, "Failed to stop MIPI: %s\n", flr_result_to_string(ret));
             goto unlock;
         }
-        sensor->streaming = false;
+        sensor->streaming  = false;
+        sensor->mipi_state = FLR_DVO_MIPI_STATE_OFF;
+        flir_boson_stream_stats_record(&sensor->stream_off_stats, start);
+        flir_boson_event(sensor, FLIR_EVENT_STATE, "stream off in %u us", READ_ONCE(sensor->stream_off_stats.last_us));
         dev_dbg(sensor->dev, "STREAM: Streaming stopped successfully");
     }
 
 unlock:
     mutex_unlock(&sensor->lock);
+
+    /* FFC polling and stats sampling take the lock, so they are started and stopped outside it */
+    if (!enable) {
+        cancel_delayed_work_sync(&sensor->ffc_work);
+        cancel_delayed_work_sync(&sensor->stats_work);
+    } else if (ret == R_SUCCESS && !was_streaming) {
+        if (atomic_read(&sensor->ffc_subscribers)) {
+            sensor->ffc_status = FLR_BOSON_FFCSTATUS_END;
+            schedule_delayed_work(&sensor->ffc_work, 0);
+        }
+        schedule_delayed_work(&sensor->stats_work, 0);
+    }
+
+    /* Drop the reference taken at stream-on, or the one that failed to start */
+    if ((enable && (was_streaming || ret != R_SUCCESS)) || (!enable && was_streaming && ret == R_SUCCESS)) {
+        pm_runtime_mark_last_busy(sensor->dev);
+        pm_runtime_put_autosuspend(sensor->dev);
+    }
+
     return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
 }
 
@@ -279,7 +712,8 @@ static int flir_boson_enum_mbus_code(struct v4l2_subdev *sd, struct v4l2_subdev_
 static int flir_boson_enum_frame_size(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_frame_size_enum *fse) {
     if (fse->pad != 0 || fse->index >= FLIR_BOSON_NUM_FRAMESIZES) return -EINVAL;
 
-	const struct flir_boson_format *cformat = flir_boson_find_format(to_flir_boson_dev(sd), fse->code);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+	const struct flir_boson_format *cformat = flir_boson_find_format(sensor, fse->code);
     if (!cformat) return -EINVAL;
 
 	int w = flir_boson_framesizes[fse->index].width;
@@ -288,14 +722,14 @@ static int flir_boson_enum_frame_size(struct v4l2_subdev *sd, struct v4l2_subdev
 	// Treat sensor width 320 and 640 separately specially.
 	// Gray16 format:  format width should match sensor width.
 	// Must return 0 now for sensor width==320 to avoid early break of 640.
-	if ((strcmp(cformat->name, "RAW14")==0) && (w != SENSOR_WIDTH))  {
-		return (SENSOR_WIDTH==640)? -EINVAL : 0 ;
+	if ((strcmp(cformat->name, "RAW14")==0) && (w != sensor->sensor_width))  {
+		return (sensor->sensor_width==640)? -EINVAL : 0 ;
 	}
 
 	// Gray8 format:  format width should match sensor width.
 	// Must return 0 now for sensor width==320 to avoid early break of 640.
-	if ((strcmp(cformat->name, "RAW8")==0) && (w != SENSOR_WIDTH))  {
-		return (SENSOR_WIDTH==640)? -EINVAL : 0;
+	if ((strcmp(cformat->name, "RAW8")==0) && (w != sensor->sensor_width))  {
+		return (sensor->sensor_width==640)? -EINVAL : 0;
 	}
 
 	// Color formats: only support 640 x 512 and 640 x 514 for both sensor==320 and 640.
@@ -303,7 +737,7 @@ static int flir_boson_enum_frame_size(struct v4l2_subdev *sd, struct v4l2_subdev
 		return -EINVAL;
 	}
 
-	dev_dbg(to_flir_boson_dev(sd)->dev, "ENUM_FRAME_SIZE: index=%u", fse->index);
+	dev_dbg(sensor->dev, "ENUM_FRAME_SIZE: index=%u", fse->index);
 	fse->min_width = fse->max_width = flir_boson_framesizes[fse->index].width;
 	fse->min_height = fse->max_height = flir_boson_framesizes[fse->index].height;
 
@@ -311,29 +745,189 @@ static int flir_boson_enum_frame_size(struct v4l2_subdev *sd, struct v4l2_subdev
 }
 
 // Iterates over supported FPS.
+/* Camera output rate in mHz: GetClockInfo when known, else the table maximum */
+static u32 flir_boson_native_fps_milli(struct flir_boson_dev *sensor, const struct flir_boson_framesize *framesize)
+{
+	return sensor->fps_milli ?: framesize->max_fps * 1000;
+}
+
+/* Frame interval of @fps_milli output with every (skip + 1)th frame kept, reduced */
+static void flir_boson_skip_to_interval(u32 fps_milli, u32 skip, struct v4l2_fract *interval)
+{
+	u32 num = (skip + 1) * 1000;
+	u32 div = gcd(num, fps_milli);
+
+	interval->numerator   = num / div;
+	interval->denominator = fps_milli / div;
+}
+
+// Intervals reachable with ROIC frame skipping, fastest first.
 static int flir_boson_enum_frame_interval(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_frame_interval_enum *fie) {
+	struct flir_boson_dev             *sensor = to_flir_boson_dev(sd);
 	const struct flir_boson_framesize *framesize;
 
-    if (fie->pad != 0 || fie->index > 0) return -EINVAL;
+    if (fie->pad != 0 || fie->index > FLIR_BOSON_MAX_FRAME_SKIP) return -EINVAL;
 
-    if (!flir_boson_find_format(to_flir_boson_dev(sd), fie->code)) return -EINVAL;
+    if (!flir_boson_find_format(sensor, fie->code)) return -EINVAL;
 
 	framesize = flir_boson_find_framesize(fie->width, fie->height);
     if (!framesize) return -EINVAL;
 
 	// pr_info("ENUM_FRAME_INTERVAL: width=%u, height=%u", fie->width, fie->height);
-    fie->interval.numerator   = 1;
-	fie->interval.denominator = framesize->max_fps;
+	flir_boson_skip_to_interval(flir_boson_native_fps_milli(sensor, framesize), fie->index, &fie->interval);
+
+	return 0;
+}
+
+static int flir_boson_get_frame_interval_priv(struct flir_boson_dev *sensor, struct v4l2_subdev_frame_interval *fi)
+{
+	if (fi->pad != 0)
+		return -EINVAL;
+
+	spin_lock(&sensor->state_lock);
+	flir_boson_skip_to_interval(flir_boson_native_fps_milli(sensor, sensor->current_framesize), sensor->frame_skip, &fi->interval);
+	spin_unlock(&sensor->state_lock);
 
 	return 0;
 }
 
+static int flir_boson_set_frame_interval_priv(struct flir_boson_dev *sensor, struct v4l2_subdev_frame_interval *fi)
+{
+	u32 fps_milli, skip;
+	u64 div;
+	FLR_RESULT ret = R_SUCCESS;
+	int err = 0;
+
+	if (fi->pad != 0)
+		return -EINVAL;
+
+	mutex_lock(&sensor->lock);
+
+	if (sensor->streaming) {
+		err = -EBUSY;
+		goto unlock;
+	}
+
+	/* skip + 1 = native rate x requested interval, rounded to the nearest divider */
+	fps_milli = flir_boson_native_fps_milli(sensor, sensor->current_framesize);
+	if (fi->interval.numerator && fi->interval.denominator) {
+		div  = (u64)fi->interval.denominator * 1000;
+		skip = div64_u64((u64)fps_milli * fi->interval.numerator + div / 2, div);
+	} else {
+		skip = 1;
+	}
+	skip = clamp_t(u32, skip, 1, FLIR_BOSON_MAX_FRAME_SKIP + 1) - 1;
+
+	ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_FRAME_SKIP, ROIC_SETFRAMESKIP, skip, 1);
+	if (ret != R_SUCCESS) {
+		dev_err(sensor->dev, "Failed to set frame skip %u: %s\n", skip, flr_result_to_string(ret));
+		err = flr_result_to_errno(ret);
+		goto unlock;
+	}
+
+	spin_lock(&sensor->state_lock);
+	sensor->frame_skip = skip;
+	spin_unlock(&sensor->state_lock);
+	flir_boson_skip_to_interval(fps_milli, skip, &fi->interval);
+
+unlock:
+	mutex_unlock(&sensor->lock);
+	return err;
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 8, 0)
+static int flir_boson_get_frame_interval(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_frame_interval *fi) {
+	if (fi->which == V4L2_SUBDEV_FORMAT_TRY)
+		return -EINVAL;
+	return flir_boson_get_frame_interval_priv(to_flir_boson_dev(sd), fi);
+}
+
+static int flir_boson_set_frame_interval(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_frame_interval *fi) {
+	if (fi->which == V4L2_SUBDEV_FORMAT_TRY)
+		return -EINVAL;
+	return flir_boson_set_frame_interval_priv(to_flir_boson_dev(sd), fi);
+}
+#else
+static int flir_boson_g_frame_interval(struct v4l2_subdev *sd, struct v4l2_subdev_frame_interval *fi) {
+	return flir_boson_get_frame_interval_priv(to_flir_boson_dev(sd), fi);
+}
+
+static int flir_boson_s_frame_interval(struct v4l2_subdev *sd, struct v4l2_subdev_frame_interval *fi) {
+	return flir_boson_set_frame_interval_priv(to_flir_boson_dev(sd), fi);
+}
+#endif
+
+/* Crop rectangle: the scaler zoom window on the sensor, always sensor aspect ratio */
+static int flir_boson_get_selection(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_selection *sel) {
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+
+	if (sel->pad != 0 || sel->which == V4L2_SUBDEV_FORMAT_TRY)
+		return -EINVAL;
+
+	switch (sel->target) {
+	case V4L2_SEL_TGT_CROP:
+		spin_lock(&sensor->state_lock);
+		sel->r = sensor->crop;
+		spin_unlock(&sensor->state_lock);
+		return 0;
+	case V4L2_SEL_TGT_CROP_DEFAULT:
+	case V4L2_SEL_TGT_CROP_BOUNDS:
+	case V4L2_SEL_TGT_NATIVE_SIZE:
+		sel->r.left   = 0;
+		sel->r.top    = 0;
+		sel->r.width  = sensor->sensor_width;
+		sel->r.height = flir_boson_sensor_height(sensor);
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/*
+ * The camera zooms in up to SCALER_GETMAXZOOM and keeps the aspect ratio,
+ * so the width is clamped to that range, the height follows from it and
+ * the window is moved inside the sensor. Applied immediately when powered,
+ * also while streaming, otherwise at the next power-on.
+ */
+static int flir_boson_set_selection(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_selection *sel) {
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+	u32 full_w = sensor->sensor_width;
+	u32 full_h = flir_boson_sensor_height(sensor);
+	struct v4l2_rect r;
+	FLR_RESULT ret = R_SUCCESS;
+
+	if (sel->pad != 0 || sel->which == V4L2_SUBDEV_FORMAT_TRY || sel->target != V4L2_SEL_TGT_CROP)
+		return -EINVAL;
+
+	r.width  = clamp_t(u32, ALIGN(sel->r.width, 2), DIV_ROUND_UP(full_w, sensor->max_zoom), full_w);
+	r.height = r.width * 4 / 5;
+	r.left   = clamp_t(s32, sel->r.left, 0, full_w - r.width);
+	r.top    = clamp_t(s32, sel->r.top, 0, full_h - r.height);
+
+	mutex_lock(&sensor->lock);
+	if (memcmp(&r, &sensor->crop, sizeof(r))) {
+		spin_lock(&sensor->state_lock);
+		sensor->crop = r;
+		spin_unlock(&sensor->state_lock);
+		sensor->zoom_dirty = true;
+		if (sensor->powered)
+			ret = flir_boson_apply_zoom(sensor);
+	}
+	sel->r = sensor->crop;
+	mutex_unlock(&sensor->lock);
+
+	return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+}
+
 static int flir_boson_get_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *sd_state, struct v4l2_subdev_format *format) {
 	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
 
     if (format->pad != 0) return -EINVAL;
 
+	/* Never waits for a format change in progress */
+	spin_lock(&sensor->state_lock);
     format->format = sensor->fmt;
+	spin_unlock(&sensor->state_lock);
 
 	dev_dbg(sensor->dev, "FORMAT: Getting current format - powered=%d, streaming=%d", sensor->powered, sensor->streaming);
     // dev_info(sensor->dev, "FORMAT: Getting format - code=0x%08X, width=%u, height=%u, color=%d", format->format.code, format->format.width,
@@ -342,133 +936,1265 @@ static int flir_boson_get_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
 	return 0;
 }
 
-static int flir_set_agc_paramaters(struct flir_boson_dev * sensor)
+/* AGC knobs: float parameters are exposed in milli-units */
+static const struct {
+	u32 set_fn;
+	u32 get_fn;
+	bool is_float;
+} flir_agc_params[FLIR_AGC_NUM] = {
+	[FLIR_AGC_PLATEAU]        = { AGC_SETPERCENTPERBIN, AGC_GETPERCENTPERBIN, true },
+	[FLIR_AGC_LINEAR_PERCENT] = { AGC_SETLINEARPERCENT, AGC_GETLINEARPERCENT, true },
+	[FLIR_AGC_MAX_GAIN]       = { AGC_SETMAXGAIN, AGC_GETMAXGAIN, true },
+	[FLIR_AGC_GAMMA]          = { AGC_SETGAMMA, AGC_GETGAMMA, true },
+	[FLIR_AGC_OUTLIER_CUT]    = { AGC_SETOUTLIERCUT, AGC_GETOUTLIERCUT, true },
+	[FLIR_AGC_D2BR]           = { AGC_SETD2BR, AGC_GETD2BR, true },
+	[FLIR_AGC_USE_ENTROPY]    = { AGC_SETUSEENTROPY, AGC_GETUSEENTROPY, false },
+	[FLIR_AGC_BRIGHTNESS]     = { AGC_SETBRIGHTNESS, AGC_GETBRIGHTNESS, false },
+};
+
+/*
+ * Send every AGC control changed since the last apply as one batch.
+ * Called with sensor->lock held, from stream-on and the apply button.
+ */
+static int flir_set_agc_paramaters(struct flir_boson_dev * sensor)
+{
+	struct flir_boson_batch_entry batch[FLIR_AGC_NUM];
+	u8 param[FLIR_AGC_NUM];
+	FLR_RESULT ret = R_SUCCESS;
+	unsigned int i, n = 0;
+	u32 wire;
+	s32 val;
+
+	lockdep_assert_held(&sensor->lock);
+
+	for_each_set_bit(i, &sensor->agc_dirty, FLIR_AGC_NUM) {
+		val  = sensor->agc_ctrls[i]->cur.val;
+		wire = flir_agc_params[i].is_float ? flir_boson_scaled_to_float(val, 1000) : (u32)val;
+		flir_boson_batch_set_int(&batch[n], flir_agc_params[i].set_fn, wire);
+		param[n++] = i;
+	}
+	if (!n)
+		return 0;
+
+	ret = flir_boson_send_batch(sensor, batch, n);
+
+	for (i = 0; i < n; i++) {
+		if (batch[i].result == R_SUCCESS)
+			clear_bit(param[i], &sensor->agc_dirty);
+		else
+			dev_err(sensor->dev, "Failed to set AGC parameter 0x%08X: %s", batch[i].fn_id, flr_result_to_string(batch[i].result));
+	}
+
+	return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+}
+
+// return width
+static int flir_get_clockinfo(struct flir_boson_dev * sensor, struct boson_clockinfo *info)
+{
+    FLR_RESULT ret = R_SUCCESS;
+
+	memset(info, 0, sizeof(*info));
+	ret = flir_boson_get_clockinfo(sensor, info);
+
+	if (ret != R_SUCCESS) {
+        dev_err(sensor->dev, "GetClockInfo error: %s", flr_result_to_string(ret));
+        return 640;
+    }
+
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "clockinfo %ux%u, %u bits", info->videoColumns, info->videoRows, info->dataWidthInBits);
+
+	return info->videoColumns;
+}
+
+/* Derive pixel rate and CSI-2 link frequency from a GetClockInfo reply */
+static void flir_boson_calc_rates(struct flir_boson_dev *sensor, const struct boson_clockinfo *info, struct flir_boson_mode_rates *rates)
+{
+	unsigned int lanes = sensor->ep.bus.mipi_csi2.num_data_lanes ?: 2;
+	u32 bpp = info->dataWidthInBits ?: 16;
+
+	/* DVO pixel clock, blanking included; fall back to clocks per frame x frame rate */
+	rates->pixel_rate = flir_boson_float_to_scaled(info->clockRateInMHz, 1000000);
+	if (!rates->pixel_rate)
+		rates->pixel_rate = div_u64((u64)info->clocksPerFrame * flir_boson_float_to_scaled(info->frameRateInHz, 1000), 1000);
+
+	rates->fps_milli = flir_boson_float_to_scaled(info->frameRateInHz, 1000);
+
+	/* D-PHY is DDR: each link clock cycle carries two bits per lane */
+	rates->link_freq = div_u64(rates->pixel_rate * bpp, 2 * lanes);
+	rates->valid = rates->pixel_rate != 0;
+}
+
+/* Publish @rates through PIXEL_RATE/LINK_FREQ. Called with sensor->lock held. */
+static void flir_boson_apply_rates(struct flir_boson_dev *sensor, const struct flir_boson_mode_rates *rates, unsigned int fmt_idx)
+{
+	const u64 *dt_freqs = sensor->ep.link_frequencies;
+	unsigned int n = sensor->ep.nr_of_link_frequencies;
+	unsigned int i, idx;
+
+	if (!rates->valid)
+		return;
+
+	sensor->pixel_rate = rates->pixel_rate;
+	sensor->link_freq  = rates->link_freq;
+	if (rates->fps_milli) {
+		spin_lock(&sensor->state_lock);
+		sensor->fps_milli = rates->fps_milli;
+		spin_unlock(&sensor->state_lock);
+	}
+
+	if (!sensor->pixel_rate_ctrl || !sensor->link_freq_ctrl)
+		return;
+
+	__v4l2_ctrl_s_ctrl_int64(sensor->pixel_rate_ctrl, rates->pixel_rate);
+
+	if (n) {
+		/* Lowest DT link frequency that still carries the mode, else the fastest one */
+		idx = 0;
+		for (i = 1; i < n; i++) {
+			bool fits = dt_freqs[i] >= rates->link_freq;
+			bool cur_fits = dt_freqs[idx] >= rates->link_freq;
+
+			if ((fits && (!cur_fits || dt_freqs[i] < dt_freqs[idx])) || (!fits && !cur_fits && dt_freqs[i] > dt_freqs[idx]))
+				idx = i;
+		}
+		if (dt_freqs[idx] < rates->link_freq)
+			dev_warn(sensor->dev, "Mode needs %llu Hz link, above all DT link-frequencies\n", rates->link_freq);
+	} else {
+		sensor->link_freq_menu[fmt_idx] = rates->link_freq;
+		idx = fmt_idx;
+	}
+
+	__v4l2_ctrl_s_ctrl(sensor->link_freq_ctrl, idx);
+}
+
+/*
+ * Read GetClockInfo for the format just applied to the camera, once per
+ * format: the result only depends on the DVO configuration.
+ */
+static void flir_boson_update_rates(struct flir_boson_dev *sensor)
+{
+	unsigned int idx = sensor->current_format - flir_boson_formats;
+	struct flir_boson_mode_rates *rates = &sensor->rates[idx];
+	struct boson_clockinfo info;
+
+	if (!rates->valid) {
+		memset(&info, 0, sizeof(info));
+		if (flir_boson_get_clockinfo(sensor, &info) != R_SUCCESS) {
+			dev_warn(sensor->dev, "GetClockInfo failed, keeping previous pixel rate\n");
+			return;
+		}
+		flir_boson_calc_rates(sensor, &info, rates);
+	}
+
+	flir_boson_apply_rates(sensor, rates, idx);
+}
+
+static int flir_boson_s_ctrl(struct v4l2_ctrl *ctrl)
+{
+	struct flir_boson_dev *sensor = container_of(ctrl->handler, struct flir_boson_dev, ctrls);
+	FLR_RESULT ret;
+	unsigned int i;
+
+	/* AGC values are only cached here; the camera sees them on apply or stream-on */
+	for (i = 0; i < FLIR_AGC_NUM; i++) {
+		if (sensor->agc_ctrls[i] == ctrl) {
+			set_bit(i, &sensor->agc_dirty);
+			return 0;
+		}
+	}
+
+	switch (ctrl->id) {
+	case V4L2_CID_FLIR_AGC_APPLY:
+		/* A suspended camera gets the values at the next stream-on */
+		return sensor->powered ? flir_set_agc_paramaters(sensor) : 0;
+	case V4L2_CID_FLIR_FFC_MODE:
+		/* Replayed from power_on when the camera is in standby */
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_FFC_MODE, BOSON_SETFFCMODE, ctrl->val, 1);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_FFC_RUN:
+		if (!sensor->powered)
+			return -EBUSY;
+		/* Freezes the image for several hundred ms; progress is reported by FFC events */
+		flir_boson_event(sensor, FLIR_EVENT_FFC, "run requested");
+		return flir_boson_queue_void_cmd(sensor, BOSON_RUNFFC, 1);
+	case V4L2_CID_FLIR_LOW_LATENCY:
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_LOW_LATENCY, LATENCYCTRL_SETLOWLATENCYSTATE, ctrl->val ? FLR_ENABLE : FLR_DISABLE, 1);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_JITTER_REDUCTION:
+		/* Cluster master: the line is sent along with the enable */
+		sensor->jitter_dirty = true;
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_set_jitter_reduction(sensor, ctrl->val ? FLR_ENABLE : FLR_DISABLE, sensor->jitter_line_ctrl->val);
+		if (ret != R_SUCCESS)
+			return flr_result_to_errno(ret);
+		sensor->jitter_dirty = false;
+		return 0;
+	case V4L2_CID_FLIR_EXT_SYNC_MODE:
+		/* Cached, sent at the next stream-on */
+		return sensor->streaming ? -EBUSY : 0;
+	case V4L2_CID_FLIR_PROCESSING_PROFILE:
+		/* Sent at the next stream-on, or now to a running stream */
+		if (!sensor->streaming)
+			return 0;
+		ret = flir_boson_apply_profile(sensor);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_SNAPSHOT:
+		/* The camera copies one frame into capture buffer 0, the stream keeps its format */
+		if (!sensor->powered)
+			return -EBUSY;
+		if (sensor->snapshot_start)
+			return -EBUSY;
+		ret = flir_boson_send_int_cmd(sensor, CAPTURE_SINGLEFRAMEWITHSRC, sensor->snapshot_src_ctrl->val, 0);
+		if (ret != R_SUCCESS)
+			return flr_result_to_errno(ret);
+		sensor->snapshot_start = ktime_get();
+		flir_boson_event(sensor, FLIR_EVENT_STATE, "snapshot from source %u", sensor->snapshot_src_ctrl->val);
+		schedule_delayed_work(&sensor->snapshot_work, msecs_to_jiffies(FLIR_BOSON_SNAPSHOT_POLL_MS));
+		return 0;
+	case V4L2_CID_FLIR_OVERLAY_CROSSHAIR:
+		/* Cluster master for the crosshair, its color and the text; drawn at power-on in standby */
+		if (!sensor->powered) {
+			sensor->overlay_dirty = true;
+			return 0;
+		}
+		ret = flir_boson_apply_overlays(sensor, false);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_STATS_INTERVAL:
+		/* Sampling stops by itself at 0; a running sampler picks up the new period */
+		if (ctrl->val && sensor->streaming)
+			mod_delayed_work(system_wq, &sensor->stats_work, 0);
+		return 0;
+	case V4L2_CID_FLIR_LATENCY_RESET:
+		if (!sensor->powered)
+			return -EBUSY;
+		ret = flir_boson_send_void_cmd(sensor, LATENCYCTRL_LATENCYRESETSTATS, 1);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_COLOR_LUT:
+		/* Palette switches take effect on the next frame, no settle delay */
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_COLOR_LUT, COLORLUT_SETID, ctrl->val, 0);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_COLOR_LUT_ENABLE:
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_COLOR_LUT_STATE, COLORLUT_SETCONTROL, ctrl->val ? FLR_ENABLE : FLR_DISABLE, 0);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_ISOTHERM_ENABLE:
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_ISOTHERM_STATE, ISOTHERM_SETENABLE, ctrl->val ? FLR_ENABLE : FLR_DISABLE, 0);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_ISOTHERM_UNIT:
+		/* The thresholds are read in the new unit, resend them with it */
+		sensor->isotherm_dirty = true;
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_ISOTHERM_UNIT, ISOTHERM_SETUNIT, ctrl->val, 0);
+		if (ret == R_SUCCESS) {
+			s32 temps[FLIR_ISOTHERM_TEMPS];
+
+			for (i = 0; i < FLIR_ISOTHERM_TEMPS; i++)
+				temps[i] = sensor->isotherm_temp_ctrls[i]->cur.val;
+			ret = flir_boson_apply_isotherm_temps(sensor, temps);
+		}
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	case V4L2_CID_FLIR_ISOTHERM_T1: {
+		/* Cluster master: all five thresholds go out in one command */
+		s32 temps[FLIR_ISOTHERM_TEMPS];
+
+		sensor->isotherm_dirty = true;
+		if (!sensor->powered)
+			return 0;
+		for (i = 0; i < FLIR_ISOTHERM_TEMPS; i++)
+			temps[i] = sensor->isotherm_temp_ctrls[i]->val;
+		ret = flir_boson_apply_isotherm_temps(sensor, temps);
+		return ret == R_SUCCESS ? 0 : flr_result_to_errno(ret);
+	}
+	default:
+		return -EINVAL;
+	}
+}
+
+/* Latency statistics cluster and sync status, read from the camera on every access */
+static int flir_boson_g_volatile_ctrl(struct v4l2_ctrl *ctrl)
+{
+	struct flir_boson_dev *sensor = container_of(ctrl->handler, struct flir_boson_dev, ctrls);
+	FLR_RESULT ret;
+	u32 raw[4];
+	int i;
+
+	if (ctrl->id == V4L2_CID_FLIR_EXT_SYNC_STATUS) {
+		if (!sensor->powered)
+			return 0;
+		ret = flir_boson_get_int_val(sensor, BOSON_GETEXTSYNCMODE, &raw[0]);
+		if (ret != R_SUCCESS)
+			return flr_result_to_errno(ret);
+		if (raw[0] >= FLR_BOSON_EXT_SYNC_END)
+			return -EIO;
+		ctrl->val = raw[0];
+		return 0;
+	}
+
+	if (ctrl->id != V4L2_CID_FLIR_LATENCY_MIN)
+		return -EINVAL;
+
+	/* The camera only measures a running pipeline; standby reads the defaults */
+	if (!sensor->powered)
+		return 0;
+
+	ret = flir_boson_get_int_pair(sensor, LATENCYCTRL_GETLATENCY, &raw[0], &raw[1]);
+	if (ret == R_SUCCESS)
+		ret = flir_boson_get_int_pair(sensor, LATENCYCTRL_GETJITTER, &raw[2], &raw[3]);
+	if (ret != R_SUCCESS)
+		return flr_result_to_errno(ret);
+
+	for (i = 0; i < ARRAY_SIZE(raw); i++)
+		sensor->latency_ctrls[i]->val = min_t(u64, flir_boson_float_to_scaled(raw[i], 1000), S32_MAX);
+
+	return 0;
+}
+
+static const struct v4l2_ctrl_ops flir_boson_ctrl_ops = {
+	.g_volatile_ctrl = flir_boson_g_volatile_ctrl,
+	.s_ctrl          = flir_boson_s_ctrl,
+};
+
+/* min/max/def in milli-units for float parameters; def is replaced by the camera's value */
+static const struct v4l2_ctrl_config flir_agc_ctrl_cfg[FLIR_AGC_NUM] = {
+	[FLIR_AGC_PLATEAU] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_PLATEAU, .name = "AGC Plateau (milli-%)",
+		.type = V4L2_CTRL_TYPE_INTEGER, .min = 1000, .max = 100000, .step = 1, .def = 7000,
+	},
+	[FLIR_AGC_LINEAR_PERCENT] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_LINEAR_PERCENT, .name = "AGC Linear Percent (milli-%)",
+		.type = V4L2_CTRL_TYPE_INTEGER, .min = 1000, .max = 100000, .step = 1, .def = 20000,
+	},
+	[FLIR_AGC_MAX_GAIN] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_MAX_GAIN, .name = "AGC Max Gain (milli)",
+		.type = V4L2_CTRL_TYPE_INTEGER, .min = 250, .max = 8000, .step = 1, .def = 1250,
+	},
+	[FLIR_AGC_GAMMA] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_GAMMA, .name = "AGC ACE Gamma (milli)",
+		.type = V4L2_CTRL_TYPE_INTEGER, .min = 500, .max = 4000, .step = 1, .def = 900,
+	},
+	[FLIR_AGC_OUTLIER_CUT] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_OUTLIER_CUT, .name = "AGC Outlier Cut (milli-%)",
+		.type = V4L2_CTRL_TYPE_INTEGER, .min = 0, .max = 49000, .step = 1, .def = 0,
+	},
+	[FLIR_AGC_D2BR] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_D2BR, .name = "AGC DDE Detail/Background (milli)",
+		.type = V4L2_CTRL_TYPE_INTEGER, .min = 0, .max = 6000, .step = 1, .def = 1300,
+	},
+	[FLIR_AGC_USE_ENTROPY] = {
+		.ops = &flir_boson_ctrl_ops, .id = V4L2_CID_FLIR_AGC_USE_ENTROPY, .name = "AGC Use Entropy",
+		.type = V4L2_CTRL_TYPE_BOOLEAN, .min = 0, .max = 1, .step = 1, .def = 1,
+	},
+};
+
+static const struct v4l2_ctrl_config flir_agc_apply_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_AGC_APPLY,
+	.name = "AGC Apply",
+	.type = V4L2_CTRL_TYPE_BUTTON,
+};
+
+/* Indexed by FLR_BOSON_FFCMODE_E; the shutter test mode is not exposed */
+static const char * const flir_ffc_mode_menu[] = {
+	[FLR_BOSON_MANUAL_FFC]   = "Manual",
+	[FLR_BOSON_AUTO_FFC]     = "Auto",
+	[FLR_BOSON_EXTERNAL_FFC] = "External",
+};
+
+static const struct v4l2_ctrl_config flir_ffc_mode_cfg = {
+	.ops   = &flir_boson_ctrl_ops,
+	.id    = V4L2_CID_FLIR_FFC_MODE,
+	.name  = "FFC Mode",
+	.type  = V4L2_CTRL_TYPE_MENU,
+	.max   = FLR_BOSON_EXTERNAL_FFC,
+	.def   = FLR_BOSON_AUTO_FFC,
+	.qmenu = flir_ffc_mode_menu,
+};
+
+static const struct v4l2_ctrl_config flir_ffc_run_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_FFC_RUN,
+	.name = "FFC Run",
+	.type = V4L2_CTRL_TYPE_BUTTON,
+};
+
+/* FFC mode control starts from the camera's current mode */
+static void flir_boson_init_ffc_controls(struct flir_boson_dev *sensor)
+{
+	struct v4l2_ctrl_config cfg = flir_ffc_mode_cfg;
+	FLR_RESULT ret;
+	u32 mode;
+
+	mutex_lock(&sensor->lock);
+	ret = flir_boson_get_int_val(sensor, BOSON_GETFFCMODE, &mode);
+	if (ret == R_SUCCESS && mode <= FLR_BOSON_EXTERNAL_FFC) {
+		cfg.def = mode;
+		flir_boson_shadow_store(sensor, FLIR_SHADOW_FFC_MODE, mode, ret);
+	}
+	mutex_unlock(&sensor->lock);
+
+	sensor->ffc_mode_ctrl = v4l2_ctrl_new_custom(&sensor->ctrls, &cfg, NULL);
+	v4l2_ctrl_new_custom(&sensor->ctrls, &flir_ffc_run_cfg, NULL);
+}
+
+static const struct v4l2_ctrl_config flir_low_latency_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_LOW_LATENCY,
+	.name = "Low Latency",
+	.type = V4L2_CTRL_TYPE_BOOLEAN,
+	.min  = 0, .max = 1, .step = 1,
+};
+
+static const struct v4l2_ctrl_config flir_jitter_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_JITTER_REDUCTION,
+	.name = "Jitter Reduction",
+	.type = V4L2_CTRL_TYPE_BOOLEAN,
+	.min  = 0, .max = 1, .step = 1,
+};
+
+/* max is set from the sensor height at probe */
+static const struct v4l2_ctrl_config flir_jitter_line_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_JITTER_LINE,
+	.name = "Jitter Reduction Line",
+	.type = V4L2_CTRL_TYPE_INTEGER,
+	.min  = 0, .step = 1,
+};
+
+static const struct v4l2_ctrl_config flir_latency_reset_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_LATENCY_RESET,
+	.name = "Latency Stats Reset",
+	.type = V4L2_CTRL_TYPE_BUTTON,
+};
+
+/* Indexed by enum flir_boson_processing_profile */
+static const char * const flir_profile_menu[] = {
+	[FLIR_BOSON_PROFILE_CAMERA]      = "Camera Settings",
+	[FLIR_BOSON_PROFILE_LOW_LATENCY] = "Low Latency",
+	[FLIR_BOSON_PROFILE_BALANCED]    = "Balanced",
+	[FLIR_BOSON_PROFILE_LOW_NOISE]   = "Low Noise",
+};
+
+static const struct v4l2_ctrl_config flir_profile_cfg = {
+	.ops   = &flir_boson_ctrl_ops,
+	.id    = V4L2_CID_FLIR_PROCESSING_PROFILE,
+	.name  = "Processing Profile",
+	.type  = V4L2_CTRL_TYPE_MENU,
+	.max   = FLIR_BOSON_PROFILE_COUNT - 1,
+	.def   = FLIR_BOSON_PROFILE_CAMERA,
+	.qmenu = flir_profile_menu,
+};
+
+/* Camera-reported floats in milli-units, in flir_boson_dev.latency_ctrls order */
+static const struct {
+	u32 id;
+	const char *name;
+} flir_latency_stats[] = {
+	{ V4L2_CID_FLIR_LATENCY_MIN, "Latency Min (milli)" },
+	{ V4L2_CID_FLIR_LATENCY_MAX, "Latency Max (milli)" },
+	{ V4L2_CID_FLIR_JITTER_MIN,  "Jitter Min (milli)" },
+	{ V4L2_CID_FLIR_JITTER_MAX,  "Jitter Max (milli)" },
+};
+
+/* Latency controls start from the camera's current configuration */
+static void flir_boson_init_latency_controls(struct flir_boson_dev *sensor)
+{
+	struct v4l2_ctrl_handler *hdl = &sensor->ctrls;
+	struct v4l2_ctrl_config cfg;
+	u32 low_latency, jitter, line;
+	FLR_RESULT ret;
+	unsigned int i;
+
+	mutex_lock(&sensor->lock);
+	ret = flir_boson_get_int_val(sensor, LATENCYCTRL_GETLOWLATENCYSTATE, &low_latency);
+	flir_boson_shadow_store(sensor, FLIR_SHADOW_LOW_LATENCY, low_latency, ret);
+	if (ret != R_SUCCESS)
+		low_latency = FLR_DISABLE;
+	if (flir_boson_get_int_pair(sensor, LATENCYCTRL_GETJITTERREDUCTION, &jitter, &line) != R_SUCCESS)
+		jitter = line = 0;
+	mutex_unlock(&sensor->lock);
+
+	cfg = flir_low_latency_cfg;
+	cfg.def = low_latency == FLR_ENABLE;
+	sensor->low_latency_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	cfg = flir_jitter_line_cfg;
+	cfg.max = flir_boson_sensor_height(sensor) - 1;
+	cfg.def = min_t(u32, line, cfg.max);
+	sensor->jitter_line_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+	cfg = flir_jitter_cfg;
+	cfg.def = jitter == FLR_ENABLE;
+	sensor->jitter_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	v4l2_ctrl_new_custom(hdl, &flir_latency_reset_cfg, NULL);
+	sensor->profile_ctrl = v4l2_ctrl_new_custom(hdl, &flir_profile_cfg, NULL);
+
+	for (i = 0; i < ARRAY_SIZE(flir_latency_stats); i++) {
+		memset(&cfg, 0, sizeof(cfg));
+		cfg.ops   = &flir_boson_ctrl_ops;
+		cfg.id    = flir_latency_stats[i].id;
+		cfg.name  = flir_latency_stats[i].name;
+		cfg.type  = V4L2_CTRL_TYPE_INTEGER;
+		cfg.max   = S32_MAX;
+		cfg.step  = 1;
+		cfg.flags = V4L2_CTRL_FLAG_READ_ONLY | V4L2_CTRL_FLAG_VOLATILE;
+		sensor->latency_ctrls[i] = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+	}
+
+	if (hdl->error)
+		return;
+	v4l2_ctrl_cluster(2, &sensor->jitter_ctrl);
+	v4l2_ctrl_cluster(ARRAY_SIZE(sensor->latency_ctrls), sensor->latency_ctrls);
+}
+
+/* Indexed by FLR_BOSON_EXT_SYNC_MODE_E */
+static const char * const flir_ext_sync_menu[] = {
+	[FLR_BOSON_EXT_SYNC_DISABLE_MODE] = "Disabled",
+	[FLR_BOSON_EXT_SYNC_MASTER_MODE]  = "Master",
+	[FLR_BOSON_EXT_SYNC_SLAVE_MODE]   = "Slave",
+};
+
+static const struct v4l2_ctrl_config flir_ext_sync_cfg = {
+	.ops   = &flir_boson_ctrl_ops,
+	.id    = V4L2_CID_FLIR_EXT_SYNC_MODE,
+	.name  = "External Sync Mode",
+	.type  = V4L2_CTRL_TYPE_MENU,
+	.max   = FLR_BOSON_EXT_SYNC_SLAVE_MODE,
+	.qmenu = flir_ext_sync_menu,
+};
+
+static const struct v4l2_ctrl_config flir_ext_sync_status_cfg = {
+	.ops   = &flir_boson_ctrl_ops,
+	.id    = V4L2_CID_FLIR_EXT_SYNC_STATUS,
+	.name  = "External Sync Status",
+	.type  = V4L2_CTRL_TYPE_MENU,
+	.max   = FLR_BOSON_EXT_SYNC_SLAVE_MODE,
+	.qmenu = flir_ext_sync_menu,
+	.flags = V4L2_CTRL_FLAG_READ_ONLY | V4L2_CTRL_FLAG_VOLATILE,
+};
+
+/*
+ * "flir,ext-sync" = "master" | "slave" | "disabled" gives the camera its
+ * role in a synchronized rig. Without it the camera's current mode, e.g.
+ * from its flash defaults, is kept.
+ */
+static void flir_boson_init_sync_controls(struct flir_boson_dev *sensor)
+{
+	static const char * const roles[] = {
+		[FLR_BOSON_EXT_SYNC_DISABLE_MODE] = "disabled",
+		[FLR_BOSON_EXT_SYNC_MASTER_MODE]  = "master",
+		[FLR_BOSON_EXT_SYNC_SLAVE_MODE]   = "slave",
+	};
+	struct v4l2_ctrl_config cfg = flir_ext_sync_cfg;
+	int dt_mode = -1;
+	const char *role;
+	FLR_RESULT ret;
+	u32 mode;
+
+	if (!device_property_read_string(sensor->dev, "flir,ext-sync", &role)) {
+		dt_mode = match_string(roles, ARRAY_SIZE(roles), role);
+		if (dt_mode < 0)
+			dev_warn(sensor->dev, "Unknown flir,ext-sync \"%s\", keeping the camera's mode\n", role);
+	}
+
+	mutex_lock(&sensor->lock);
+	ret = flir_boson_get_int_val(sensor, BOSON_GETEXTSYNCMODE, &mode);
+	flir_boson_shadow_store(sensor, FLIR_SHADOW_EXT_SYNC, mode, ret);
+	mutex_unlock(&sensor->lock);
+
+	if (dt_mode >= 0)
+		cfg.def = dt_mode;
+	else if (ret == R_SUCCESS && mode < FLR_BOSON_EXT_SYNC_END)
+		cfg.def = mode;
+
+	sensor->ext_sync_ctrl = v4l2_ctrl_new_custom(&sensor->ctrls, &cfg, NULL);
+	sensor->ext_sync_status_ctrl = v4l2_ctrl_new_custom(&sensor->ctrls, &flir_ext_sync_status_cfg, NULL);
+}
+
+/* Indexed by FLR_COLORLUT_ID_E; White Hot and Black Hot set the polarity */
+static const char * const flir_color_lut_menu[] = {
+	[FLR_COLORLUT_WHITEHOT]   = "White Hot",
+	[FLR_COLORLUT_BLACKHOT]   = "Black Hot",
+	[FLR_COLORLUT_RAINBOW]    = "Rainbow",
+	[FLR_COLORLUT_RAINBOW_HC] = "Rainbow High Contrast",
+	[FLR_COLORLUT_IRONBOW]    = "Ironbow",
+	[FLR_COLORLUT_LAVA]       = "Lava",
+	[FLR_COLORLUT_ARCTIC]     = "Arctic",
+	[FLR_COLORLUT_GLOBOW]     = "Globow",
+	[FLR_COLORLUT_GRADEDFIRE] = "Graded Fire",
+	[FLR_COLORLUT_HOTTEST]    = "Hottest",
+	[FLR_COLORLUT_EMBERGLOW]  = "Ember Glow",
+	[FLR_COLORLUT_AURORA]     = "Aurora",
+};
+
+static const struct v4l2_ctrl_config flir_color_lut_cfg = {
+	.ops   = &flir_boson_ctrl_ops,
+	.id    = V4L2_CID_FLIR_COLOR_LUT,
+	.name  = "Color LUT",
+	.type  = V4L2_CTRL_TYPE_MENU,
+	.max   = FLR_COLORLUT_ID_END - 1,
+	.qmenu = flir_color_lut_menu,
+};
+
+static const struct v4l2_ctrl_config flir_color_lut_enable_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_COLOR_LUT_ENABLE,
+	.name = "Color LUT Enable",
+	.type = V4L2_CTRL_TYPE_BOOLEAN,
+	.min  = 0, .max = 1, .step = 1, .def = 1,
+};
+
+static const struct v4l2_ctrl_config flir_isotherm_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_ISOTHERM_ENABLE,
+	.name = "Isotherm Enable",
+	.type = V4L2_CTRL_TYPE_BOOLEAN,
+	.min  = 0, .max = 1, .step = 1,
+};
+
+/* Indexed by FLR_ISOTHERM_UNIT_E, values 2 and 3 are unused */
+static const char * const flir_isotherm_unit_menu[] = {
+	[FLR_ISOTHERM_UNIT_KELVIN]     = "Kelvin",
+	[FLR_ISOTHERM_UNIT_CELSIUS]    = "Celsius",
+	[FLR_ISOTHERM_UNIT_FAHRENHEIT] = "Fahrenheit",
+	[FLR_ISOTHERM_UNIT_PERCENT]    = "Percent",
+	[FLR_ISOTHERM_UNIT_RAW]        = "Raw",
+};
+
+static const struct v4l2_ctrl_config flir_isotherm_unit_cfg = {
+	.ops            = &flir_boson_ctrl_ops,
+	.id             = V4L2_CID_FLIR_ISOTHERM_UNIT,
+	.name           = "Isotherm Unit",
+	.type           = V4L2_CTRL_TYPE_MENU,
+	.max            = FLR_ISOTHERM_UNIT_RAW,
+	.def            = FLR_ISOTHERM_UNIT_CELSIUS,
+	.menu_skip_mask = BIT(2) | BIT(3),
+	.qmenu          = flir_isotherm_unit_menu,
+};
+
+static const char * const flir_isotherm_temp_names[FLIR_ISOTHERM_TEMPS] = {
+	"Isotherm Threshold 1", "Isotherm Threshold 2", "Isotherm Threshold 3", "Isotherm Threshold 4", "Isotherm Threshold 5",
+};
+
+/*
+ * Color and isotherm controls start from the camera's current settings:
+ * the shadow cache when persist_config loaded it, the camera otherwise.
+ * Isotherm controls are left out on firmware that cannot report them.
+ */
+static void flir_boson_init_color_controls(struct flir_boson_dev *sensor)
+{
+	static const struct {
+		enum flir_shadow_id id;
+		u32 get_fn;
+	} slots[] = {
+		{ FLIR_SHADOW_COLOR_LUT, COLORLUT_GETID },
+		{ FLIR_SHADOW_COLOR_LUT_STATE, COLORLUT_GETCONTROL },
+		{ FLIR_SHADOW_ISOTHERM_STATE, ISOTHERM_GETENABLE },
+		{ FLIR_SHADOW_ISOTHERM_UNIT, ISOTHERM_GETUNIT },
+	};
+	struct v4l2_ctrl_handler *hdl = &sensor->ctrls;
+	struct flir_boson_batch_entry batch[ARRAY_SIZE(slots)];
+	s32 temps[FLIR_ISOTHERM_TEMPS] = { 0 };
+	u32 val[ARRAY_SIZE(slots)];
+	struct v4l2_ctrl_config cfg;
+	unsigned int i, n = 0;
+	u8 slot[ARRAY_SIZE(slots)];
+	bool has_isotherm;
+
+	mutex_lock(&sensor->lock);
+	for (i = 0; i < ARRAY_SIZE(slots); i++) {
+		if (test_bit(slots[i].id, &sensor->shadow_valid))
+			continue;
+		flir_boson_batch_get_int(&batch[n], slots[i].get_fn, &val[n]);
+		slot[n++] = slots[i].id;
+	}
+	if (n)
+		flir_boson_send_batch(sensor, batch, n);
+	for (i = 0; i < n; i++)
+		flir_boson_shadow_store(sensor, slot[i], val[i], batch[i].result);
+	has_isotherm = test_bit(FLIR_SHADOW_ISOTHERM_STATE, &sensor->shadow_valid) &&
+		       flir_boson_get_isotherm_temps(sensor, FLR_ISOTHERM_GAIN_LOW, temps) == R_SUCCESS;
+	mutex_unlock(&sensor->lock);
+
+	cfg = flir_color_lut_cfg;
+	if (test_bit(FLIR_SHADOW_COLOR_LUT, &sensor->shadow_valid) && sensor->shadow[FLIR_SHADOW_COLOR_LUT] <= cfg.max)
+		cfg.def = sensor->shadow[FLIR_SHADOW_COLOR_LUT];
+	sensor->color_lut_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	cfg = flir_color_lut_enable_cfg;
+	if (test_bit(FLIR_SHADOW_COLOR_LUT_STATE, &sensor->shadow_valid))
+		cfg.def = sensor->shadow[FLIR_SHADOW_COLOR_LUT_STATE] == FLR_ENABLE;
+	sensor->color_lut_enable_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	if (!has_isotherm) {
+		flir_boson_event(sensor, FLIR_EVENT_CONFIG, "isotherms not supported");
+		return;
+	}
+
+	cfg = flir_isotherm_cfg;
+	cfg.def = flir_boson_shadow_match(sensor, FLIR_SHADOW_ISOTHERM_STATE, FLR_ENABLE);
+	sensor->isotherm_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	cfg = flir_isotherm_unit_cfg;
+	if (test_bit(FLIR_SHADOW_ISOTHERM_UNIT, &sensor->shadow_valid) && sensor->shadow[FLIR_SHADOW_ISOTHERM_UNIT] <= cfg.max &&
+	    !(cfg.menu_skip_mask & BIT(sensor->shadow[FLIR_SHADOW_ISOTHERM_UNIT])))
+		cfg.def = sensor->shadow[FLIR_SHADOW_ISOTHERM_UNIT];
+	sensor->isotherm_unit_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	for (i = 0; i < FLIR_ISOTHERM_TEMPS; i++) {
+		memset(&cfg, 0, sizeof(cfg));
+		cfg.ops  = &flir_boson_ctrl_ops;
+		cfg.id   = V4L2_CID_FLIR_ISOTHERM_T1 + i;
+		cfg.name = flir_isotherm_temp_names[i];
+		cfg.type = V4L2_CTRL_TYPE_INTEGER;
+		cfg.min  = -1000; /* raw counts reach U16_MAX */
+		cfg.max  = U16_MAX;
+		cfg.step = 1;
+		cfg.def  = clamp_t(s32, temps[i], cfg.min, cfg.max);
+		sensor->isotherm_temp_ctrls[i] = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+	}
+
+	if (hdl->error)
+		return;
+	v4l2_ctrl_cluster(FLIR_ISOTHERM_TEMPS, sensor->isotherm_temp_ctrls);
+}
+
+/* FFC Event Reporting */
+
+static void flir_boson_ffc_notify(struct flir_boson_dev *sensor, u32 status)
+{
+	struct v4l2_event ev = { .type = V4L2_EVENT_FLIR_BOSON_FFC };
+
+	ev.u.data[0] = status;
+	v4l2_subdev_notify_event(&sensor->sd, &ev);
+	flir_boson_event(sensor, FLIR_EVENT_FFC, "status %u", status);
+}
+
+/*
+ * Poll BOSON_GETFFCSTATUS and report transitions. The camera keeps
+ * reporting COMPLETE after an FFC, so only changes are events, and an FFC
+ * shorter than the poll period still yields a start/done pair.
+ */
+static void flir_boson_ffc_work(struct work_struct *work)
+{
+	struct flir_boson_dev *sensor = container_of(to_delayed_work(work), struct flir_boson_dev, ffc_work);
+	FLR_RESULT ret;
+	u32 status;
+
+	mutex_lock(&sensor->lock);
+	if (!sensor->streaming) {
+		mutex_unlock(&sensor->lock);
+		return;
+	}
+	ret = flir_boson_get_int_val(sensor, BOSON_GETFFCSTATUS, &status);
+	mutex_unlock(&sensor->lock);
+
+	if (ret == R_SUCCESS && status != sensor->ffc_status && status < FLR_BOSON_FFCSTATUS_END) {
+		/* First reading after stream-on only sets the baseline */
+		if (sensor->ffc_status != FLR_BOSON_FFCSTATUS_END && status != FLR_BOSON_NO_FFC_PERFORMED) {
+			if (status == FLR_BOSON_FFC_COMPLETE && sensor->ffc_status != FLR_BOSON_FFC_IN_PROGRESS)
+				flir_boson_ffc_notify(sensor, FLR_BOSON_FFC_IN_PROGRESS);
+			flir_boson_ffc_notify(sensor, status);
+		}
+		sensor->ffc_status = status;
+	}
+
+	if (atomic_read(&sensor->ffc_subscribers))
+		schedule_delayed_work(&sensor->ffc_work, msecs_to_jiffies(FLIR_BOSON_FFC_POLL_MS));
+}
+
+static int flir_boson_ffc_sub_add(struct v4l2_subscribed_event *sev, unsigned int elems)
+{
+	struct v4l2_subdev    *sd     = vdev_to_v4l2_subdev(sev->fh->vdev);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+
+	if (atomic_inc_return(&sensor->ffc_subscribers) == 1) {
+		cancel_delayed_work_sync(&sensor->ffc_work);
+		sensor->ffc_status = FLR_BOSON_FFCSTATUS_END;
+		if (READ_ONCE(sensor->streaming))
+			schedule_delayed_work(&sensor->ffc_work, 0);
+	}
+
+	return 0;
+}
+
+/* The poller stops by itself once the count drops to zero */
+static void flir_boson_ffc_sub_del(struct v4l2_subscribed_event *sev)
+{
+	struct v4l2_subdev    *sd     = vdev_to_v4l2_subdev(sev->fh->vdev);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+
+	atomic_dec(&sensor->ffc_subscribers);
+}
+
+static const struct v4l2_subscribed_event_ops flir_boson_ffc_sub_ops = {
+	.add = flir_boson_ffc_sub_add,
+	.del = flir_boson_ffc_sub_del,
+};
+
+static int flir_boson_subscribe_event(struct v4l2_subdev *sd, struct v4l2_fh *fh, struct v4l2_event_subscription *sub)
+{
+	switch (sub->type) {
+	case V4L2_EVENT_FLIR_BOSON_FFC:
+		return v4l2_event_subscribe(fh, sub, 4, &flir_boson_ffc_sub_ops);
+	case V4L2_EVENT_FLIR_BOSON_STATUS:
+		return v4l2_event_subscribe(fh, sub, 2, NULL);
+	case V4L2_EVENT_FLIR_BOSON_SNAPSHOT:
+		return v4l2_event_subscribe(fh, sub, 2, NULL);
+	default:
+		return v4l2_ctrl_subdev_subscribe_event(sd, fh, sub);
+	}
+}
+
+/* Radiometric Snapshot */
+
+/* Indexed by FLR_CAPTURE_SRC_E; the sources after AGC are skipped */
+static const char * const flir_snapshot_src_menu[] = {
+	[FLR_CAPTURE_SRC_NUC]     = "Post-NUC",
+	[FLR_CAPTURE_SRC_TNF]     = "Post-TNF",
+	[FLR_CAPTURE_SRC_RAW]     = "Raw",
+	[FLR_CAPTURE_SRC_TLINEAR] = "T-Linear",
+};
+
+static const struct v4l2_ctrl_config flir_snapshot_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_SNAPSHOT,
+	.name = "Radiometric Snapshot",
+	.type = V4L2_CTRL_TYPE_BUTTON,
+};
+
+static const struct v4l2_ctrl_config flir_snapshot_src_cfg = {
+	.ops   = &flir_boson_ctrl_ops,
+	.id    = V4L2_CID_FLIR_SNAPSHOT_SOURCE,
+	.name  = "Radiometric Snapshot Source",
+	.type  = V4L2_CTRL_TYPE_MENU,
+	.min   = FLR_CAPTURE_SRC_NUC,
+	.max   = FLR_CAPTURE_SRC_TLINEAR,
+	.def   = FLR_CAPTURE_SRC_NUC,
+	.menu_skip_mask = BIT(FLR_CAPTURE_SRC_RESERVED) | BIT(FLR_CAPTURE_SRC_BLEND) | BIT(FLR_CAPTURE_SRC_VIS) |
+			  BIT(FLR_CAPTURE_SRC_MSX),
+	.qmenu = flir_snapshot_src_menu,
+};
+
+static void flir_boson_init_snapshot_controls(struct flir_boson_dev *sensor)
+{
+	v4l2_ctrl_new_custom(&sensor->ctrls, &flir_snapshot_cfg, NULL);
+	sensor->snapshot_src_ctrl = v4l2_ctrl_new_custom(&sensor->ctrls, &flir_snapshot_src_cfg, NULL);
+}
+
+/*
+ * Poll CAPTURE_GETSTATUS until the capture requested by the snapshot
+ * control is done, then report its size. Each poll takes the lock only for
+ * one command, so streaming and other controls carry on in between.
+ */
+static void flir_boson_snapshot_work(struct work_struct *work)
+{
+	struct flir_boson_dev *sensor = container_of(to_delayed_work(work), struct flir_boson_dev, snapshot_work);
+	struct v4l2_event ev = { .type = V4L2_EVENT_FLIR_BOSON_SNAPSHOT };
+	struct flir_boson_snapshot snap = {};
+	u32 state, result;
+	FLR_RESULT ret;
+
+	static_assert(sizeof(snap) <= sizeof(ev.u.data));
+
+	mutex_lock(&sensor->lock);
+	if (!sensor->snapshot_start) {
+		mutex_unlock(&sensor->lock);
+		return;
+	}
+	snap.elapsed_ms = ktime_ms_delta(ktime_get(), sensor->snapshot_start);
+	ret = flir_boson_get_capture_status(sensor, &state, &result);
+	if (ret == R_SUCCESS && state == FLR_CAPTURE_IN_PROGRESS) {
+		if (snap.elapsed_ms < FLIR_BOSON_SNAPSHOT_TIMEOUT_MS) {
+			mutex_unlock(&sensor->lock);
+			schedule_delayed_work(&sensor->snapshot_work, msecs_to_jiffies(FLIR_BOSON_SNAPSHOT_POLL_MS));
+			return;
+		}
+		ret = FLR_COMM_TIMEOUT_ERROR;
+	}
+	if (ret == R_SUCCESS)
+		ret = result;
+	if (ret == R_SUCCESS)
+		ret = flir_boson_get_capture_size(sensor, &snap.bytes, &snap.rows, &snap.columns);
+	sensor->snapshot_start = 0;
+	mutex_unlock(&sensor->lock);
+
+	snap.result = ret;
+	memcpy(ev.u.data, &snap, sizeof(snap));
+	v4l2_subdev_notify_event(&sensor->sd, &ev);
+	if (ret == R_SUCCESS)
+		flir_boson_event(sensor, FLIR_EVENT_STATE, "snapshot %ux%u ready in %u ms", snap.columns, snap.rows, snap.elapsed_ms);
+	else
+		flir_boson_event(sensor, FLIR_EVENT_ERROR, "snapshot failed: %#x after %u ms", ret, snap.elapsed_ms);
+}
+
+/* Symbology Overlays */
+
+static const struct v4l2_ctrl_config flir_crosshair_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_OVERLAY_CROSSHAIR,
+	.name = "Crosshair Overlay",
+	.type = V4L2_CTRL_TYPE_BOOLEAN,
+	.min  = 0, .max = 1, .step = 1, .def = 0,
+};
+
+static const struct v4l2_ctrl_config flir_overlay_color_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_OVERLAY_COLOR,
+	.name = "Overlay Color",
+	.type = V4L2_CTRL_TYPE_INTEGER,
+	.min  = 0, .max = 0xffffff, .step = 1, .def = 0xffffff,
+};
+
+static const struct v4l2_ctrl_config flir_overlay_text_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_OVERLAY_TEXT,
+	.name = "Overlay Text",
+	.type = V4L2_CTRL_TYPE_STRING,
+	.min  = 0, .max = FLIR_OVERLAY_TEXT_MAX, .step = 1,
+};
+
+/*
+ * Crosshair and a line of text drawn into the video by the camera, so they
+ * cost the host nothing per frame. One cluster: a change to any of them
+ * goes out as a single batch of the symbols it affects.
+ */
+static void flir_boson_init_overlay_controls(struct flir_boson_dev *sensor)
+{
+	struct v4l2_ctrl_handler *hdl = &sensor->ctrls;
+	u32 height = flir_boson_sensor_height(sensor);
+	struct v4l2_ctrl_config cfg;
+
+	sensor->crosshair_ctrl = v4l2_ctrl_new_custom(hdl, &flir_crosshair_cfg, NULL);
+
+	memset(&cfg, 0, sizeof(cfg));
+	cfg.ops  = &flir_boson_ctrl_ops;
+	cfg.id   = V4L2_CID_FLIR_OVERLAY_CROSSHAIR_X;
+	cfg.name = "Crosshair X";
+	cfg.type = V4L2_CTRL_TYPE_INTEGER;
+	cfg.max  = sensor->sensor_width - 1;
+	cfg.step = 1;
+	cfg.def  = sensor->sensor_width / 2;
+	sensor->crosshair_x_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	cfg.id   = V4L2_CID_FLIR_OVERLAY_CROSSHAIR_Y;
+	cfg.name = "Crosshair Y";
+	cfg.max  = height - 1;
+	cfg.def  = height / 2;
+	sensor->crosshair_y_ctrl = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+
+	sensor->overlay_color_ctrl = v4l2_ctrl_new_custom(hdl, &flir_overlay_color_cfg, NULL);
+	sensor->overlay_text_ctrl  = v4l2_ctrl_new_custom(hdl, &flir_overlay_text_cfg, NULL);
+
+	if (hdl->error)
+		return;
+	v4l2_ctrl_cluster(5, &sensor->crosshair_ctrl);
+}
+
+/* Scene Statistics */
+
+static const struct v4l2_ctrl_config flir_stats_interval_cfg = {
+	.ops  = &flir_boson_ctrl_ops,
+	.id   = V4L2_CID_FLIR_STATS_INTERVAL,
+	.name = "Image Stats Interval (ms)",
+	.type = V4L2_CTRL_TYPE_INTEGER,
+	.min  = 0, .max = 60000, .step = 1, .def = 0,
+};
+
+/* Indexed by enum flir_image_stat, values in camera counts */
+static const struct {
+	u32 id;
+	const char *name;
+} flir_image_stats[FLIR_STAT_NUM] = {
+	[FLIR_STAT_MEAN]          = { V4L2_CID_FLIR_STATS_MEAN, "Image Stats Mean" },
+	[FLIR_STAT_PEAK]          = { V4L2_CID_FLIR_STATS_PEAK, "Image Stats Peak" },
+	[FLIR_STAT_BASE]          = { V4L2_CID_FLIR_STATS_BASE, "Image Stats Base" },
+	[FLIR_STAT_ROI_MEAN]      = { V4L2_CID_FLIR_STATS_ROI_MEAN, "Image Stats ROI Mean" },
+	[FLIR_STAT_ROI_FIRST_BIN] = { V4L2_CID_FLIR_STATS_ROI_FIRST_BIN, "Image Stats ROI First Bin" },
+	[FLIR_STAT_ROI_LAST_BIN]  = { V4L2_CID_FLIR_STATS_ROI_LAST_BIN, "Image Stats ROI Last Bin" },
+};
+
+/*
+ * The readings are plain read-only controls without ops: the sampler
+ * updates them, userspace gets the cached value and, if subscribed, a
+ * V4L2_EVENT_CTRL on every change.
+ */
+static void flir_boson_init_stats_controls(struct flir_boson_dev *sensor)
+{
+	struct v4l2_ctrl_config cfg;
+	unsigned int i;
+
+	sensor->stats_interval_ctrl = v4l2_ctrl_new_custom(&sensor->ctrls, &flir_stats_interval_cfg, NULL);
+
+	for (i = 0; i < FLIR_STAT_NUM; i++) {
+		memset(&cfg, 0, sizeof(cfg));
+		cfg.id    = flir_image_stats[i].id;
+		cfg.name  = flir_image_stats[i].name;
+		cfg.type  = V4L2_CTRL_TYPE_INTEGER;
+		cfg.max   = U16_MAX;
+		cfg.step  = 1;
+		cfg.flags = V4L2_CTRL_FLAG_READ_ONLY;
+		sensor->stats_ctrls[i] = v4l2_ctrl_new_custom(&sensor->ctrls, &cfg, NULL);
+	}
+}
+
+/* Sample IMAGESTATS every Image Stats Interval ms while streaming */
+static void flir_boson_stats_work(struct work_struct *work)
+{
+	struct flir_boson_dev *sensor = container_of(to_delayed_work(work), struct flir_boson_dev, stats_work);
+	u16 stats[FLIR_STAT_NUM];
+	FLR_RESULT ret;
+	s32 interval;
+	int i;
+
+	mutex_lock(&sensor->lock);
+	interval = sensor->stats_interval_ctrl->cur.val;
+	if (!sensor->streaming || !interval) {
+		mutex_unlock(&sensor->lock);
+		return;
+	}
+
+	ret = flir_boson_get_image_stats(sensor, stats);
+	if (ret == R_SUCCESS) {
+		for (i = 0; i < FLIR_STAT_NUM; i++)
+			__v4l2_ctrl_s_ctrl(sensor->stats_ctrls[i], stats[i]);
+	} else {
+		dev_dbg(sensor->dev, "IMAGESTATS read failed: %s\n", flr_result_to_string(ret));
+	}
+	mutex_unlock(&sensor->lock);
+
+	schedule_delayed_work(&sensor->stats_work, msecs_to_jiffies(interval));
+}
+
+/* Health Snapshot */
+
+/* Driver fields are read live, camera fields come from the last refresh */
+static void flir_boson_fill_status(struct flir_boson_dev *sensor, struct flir_boson_status *st)
+{
+	unsigned int i;
+
+	memset(st, 0, sizeof(*st));
+	spin_lock(&sensor->state_lock);
+	st->ffc_status   = sensor->health.ffc_status;
+	st->ffc_frame    = sensor->health.ffc_frame;
+	st->fpa_temp_dc  = sensor->health.fpa_temp_dc;
+	st->latency_min  = sensor->health.latency_min;
+	st->latency_max  = sensor->health.latency_max;
+	st->timestamp_ns = sensor->health.timestamp_ns;
+	if (sensor->telemetry_embedded)
+		st->flags |= FLIR_BOSON_STATUS_TELEMETRY_EMBEDDED;
+	spin_unlock(&sensor->state_lock);
+
+	if (st->timestamp_ns)
+		st->flags |= FLIR_BOSON_STATUS_CAMERA_VALID;
+	if (READ_ONCE(sensor->powered))
+		st->flags |= FLIR_BOSON_STATUS_POWERED;
+	if (READ_ONCE(sensor->streaming))
+		st->flags |= FLIR_BOSON_STATUS_STREAMING;
+	st->mipi_state  = READ_ONCE(sensor->mipi_state);
+	st->interval_ms = READ_ONCE(status_interval_ms);
+
+	/* Same torn-snapshot tolerance as the debugfs statistics */
+	for (i = 0; i < FLIR_STATS_SLOTS; i++) {
+		st->commands += READ_ONCE(sensor->cmd_stats[i].calls);
+		st->failures += READ_ONCE(sensor->cmd_stats[i].failures);
+	}
+	st->resyncs   = READ_ONCE(sensor->fslp_recovery.resyncs);
+	st->replays   = READ_ONCE(sensor->fslp_recovery.replays);
+	st->recovered = READ_ONCE(sensor->fslp_recovery.recovered);
+	st->profile   = READ_ONCE(sensor->profile_ctrl->cur.val);
+}
+
+/*
+ * Refresh the camera side of the snapshot every status_interval_ms while
+ * the camera is powered, and raise V4L2_EVENT_FLIR_BOSON_STATUS when
+ * anything but the temperature and the counters of successful traffic
+ * changed. Standby is never interrupted for a refresh.
+ */
+static void flir_boson_health_work(struct work_struct *work)
 {
-	// set agc parameters.
-	union fdata { float f; u32 u; };
-	union fdata plateau; 
-	plateau.f = 3.0f;
+	struct flir_boson_dev *sensor = container_of(to_delayed_work(work), struct flir_boson_dev, health_work);
+	struct v4l2_event ev = { .type = V4L2_EVENT_FLIR_BOSON_STATUS };
+	unsigned int interval = READ_ONCE(status_interval_ms);
+	struct flir_boson_health health;
+	struct flir_boson_status st;
+	FLR_RESULT ret = FLR_COMM_NO_DEV;
+
+	if (interval) {
+		mutex_lock(&sensor->lock);
+		if (sensor->powered)
+			ret = flir_boson_get_health(sensor, &health);
+		mutex_unlock(&sensor->lock);
+
+		if (ret == R_SUCCESS) {
+			health.timestamp_ns = ktime_get_ns();
+			spin_lock(&sensor->state_lock);
+			sensor->health = health;
+			spin_unlock(&sensor->state_lock);
+		}
+	}
 
-	union fdata linear_percent;
-	linear_percent.f = 10.0f;
+	flir_boson_fill_status(sensor, &st);
+	if (st.flags != sensor->status_last.flags || st.mipi_state != sensor->status_last.mipi_state ||
+	    st.ffc_status != sensor->status_last.ffc_status || st.ffc_frame != sensor->status_last.ffc_frame ||
+	    st.failures != sensor->status_last.failures)
+		v4l2_subdev_notify_event(&sensor->sd, &ev);
+	sensor->status_last = st;
 
-	union fdata gain;
-	gain.f = 8.0f;
+	/* Stopped while off; writing a new period through sysfs restarts it */
+	if (interval)
+		schedule_delayed_work(&sensor->health_work, msecs_to_jiffies(interval));
+}
 
-	union fdata gamma;
-	gamma.f = 0.5f;
+/* Create the AGC controls with the camera's current values as defaults */
+static void flir_boson_init_agc_controls(struct flir_boson_dev *sensor)
+{
+	struct v4l2_ctrl_handler *hdl = &sensor->ctrls;
+	struct flir_boson_batch_entry batch[FLIR_AGC_NUM];
+	struct v4l2_ctrl_config cfg;
+	u32 raw[FLIR_AGC_NUM];
+	s64 def;
+	unsigned int i;
 
-	union fdata outlier;
-	outlier.f = 0.01f;
+	for (i = 0; i < FLIR_AGC_NUM; i++)
+		flir_boson_batch_get_int(&batch[i], flir_agc_params[i].get_fn, &raw[i]);
 
-	union fdata dde;
-	dde.f = 3.0f;
+	mutex_lock(&sensor->lock);
+	flir_boson_send_batch(sensor, batch, FLIR_AGC_NUM);
+	mutex_unlock(&sensor->lock);
 
-    FLR_RESULT ret = R_SUCCESS;
+	for (i = 0; i < FLIR_AGC_NUM; i++) {
+		def = batch[i].result != R_SUCCESS ? -1 : flir_agc_params[i].is_float ? (s64)flir_boson_float_to_scaled(raw[i], 1000) : raw[i];
 
-	ret = flir_boson_send_int_cmd(sensor, AGC_SETPERCENTPERBIN, plateau.u, 1) &		// plateau value [1, 100, 7]
-		flir_boson_send_int_cmd(sensor, AGC_SETLINEARPERCENT, linear_percent.u, 1) &		// linear percent [1, 100, 20]
-		flir_boson_send_int_cmd(sensor, AGC_SETMAXGAIN, gain.u, 1) &		// max gain [0.25, 8.00, 1.25]
-		flir_boson_send_int_cmd(sensor, AGC_SETGAMMA, gamma.u, 1) &		// ace = gamma [0.5, 4.00, 0.9]
-		flir_boson_send_int_cmd(sensor, AGC_SETOUTLIERCUT, outlier.u, 1) &	// tail = outlier [0.0, 49.0, 0.0]
-		flir_boson_send_int_cmd(sensor, AGC_SETD2BR, dde.u, 1) &		// dde = details to background ratio [0.0, 6.00, 1.3]
-		flir_boson_send_int_cmd(sensor, AGC_SETUSEENTROPY, FLR_ENABLE, 1) &		// use entropy = FLR_ENABLE, use platueau = FLR_DISABLE
-		flir_boson_send_int_cmd(sensor, AGC_SETBRIGHTNESS, 128, 1);		// brightness [0, 255], default = 128
+		if (i == FLIR_AGC_BRIGHTNESS) {
+			sensor->agc_ctrls[i] = v4l2_ctrl_new_std(hdl, &flir_boson_ctrl_ops, V4L2_CID_BRIGHTNESS, 0, 255, 1, def < 0 ? 128 : clamp_t(s64, def, 0, 255));
+			continue;
+		}
 
-	if (ret != R_SUCCESS) {
-        dev_err(sensor->dev, "FORMAT: Failed to set AGC parameters: %s", flr_result_to_string(ret));
-        ret = flr_result_to_errno(ret);
-    }
+		cfg = flir_agc_ctrl_cfg[i];
+		if (def >= 0)
+			cfg.def = clamp_t(s64, def, cfg.min, cfg.max);
+		sensor->agc_ctrls[i] = v4l2_ctrl_new_custom(hdl, &cfg, NULL);
+	}
 
-	return ret;
+	v4l2_ctrl_new_custom(hdl, &flir_agc_apply_cfg, NULL);
 }
 
-// return width
-static int flir_get_clockinfo(struct flir_boson_dev * sensor)
+static int flir_boson_init_controls(struct flir_boson_dev *sensor, const struct boson_clockinfo *info)
 {
-    FLR_RESULT ret = R_SUCCESS;
-	struct boson_clockinfo info;
-	
-	ret = flir_boson_get_clockinfo(sensor, &info);
+	struct v4l2_ctrl_handler *hdl = &sensor->ctrls;
+	struct flir_boson_mode_rates rates;
+	const s64 *menu;
+	unsigned int i, n;
+
+	flir_boson_calc_rates(sensor, info, &rates);
+
+	v4l2_ctrl_handler_init(hdl, 26 + FLIR_AGC_NUM + FLIR_STAT_NUM + FLIR_ISOTHERM_TEMPS);
+	hdl->lock = &sensor->lock;
+
+	flir_boson_init_agc_controls(sensor);
+	flir_boson_init_ffc_controls(sensor);
+	flir_boson_init_latency_controls(sensor);
+	flir_boson_init_stats_controls(sensor);
+	flir_boson_init_color_controls(sensor);
+	flir_boson_init_sync_controls(sensor);
+	flir_boson_init_snapshot_controls(sensor);
+	flir_boson_init_overlay_controls(sensor);
+
+	sensor->pixel_rate_ctrl = v4l2_ctrl_new_std(hdl, NULL, V4L2_CID_PIXEL_RATE, 1, S64_MAX, 1, rates.pixel_rate ?: 1);
+
+	if (sensor->ep.nr_of_link_frequencies) {
+		menu = (const s64 *)sensor->ep.link_frequencies;
+		n    = sensor->ep.nr_of_link_frequencies;
+	} else {
+		for (i = 0; i < FLIR_BOSON_MAX_FORMATS; i++)
+			sensor->link_freq_menu[i] = rates.link_freq;
+		menu = sensor->link_freq_menu;
+		n    = FLIR_BOSON_NUM_FORMATS;
+	}
+	sensor->link_freq_ctrl = v4l2_ctrl_new_int_menu(hdl, NULL, V4L2_CID_LINK_FREQ, n - 1, 0, menu);
 
-	if (ret != R_SUCCESS) {
-        dev_err(sensor->dev, "GetClockInfo error: %s", flr_result_to_string(ret));
-        return 640;
-    }
+	if (hdl->error) {
+		dev_err(sensor->dev, "Could not init controls: %d\n", hdl->error);
+		return hdl->error;
+	}
+
+	sensor->pixel_rate_ctrl->flags |= V4L2_CTRL_FLAG_READ_ONLY;
+	sensor->link_freq_ctrl->flags  |= V4L2_CTRL_FLAG_READ_ONLY;
+	sensor->sd.ctrl_handler = hdl;
 
-	pr_info("(videoColumns, videoRows)	= (%d, %d)\n", info.videoColumns, info.videoRows);
-	pr_info("(frameRate, dataWidth)     = (%#08X, %d) \n", info.frameRateInHz, info.dataWidthInBits);
+	/* Camera DVO setup at probe is unknown, so the probe reading is not cached */
+	mutex_lock(&sensor->lock);
+	flir_boson_apply_rates(sensor, &rates, sensor->current_format - flir_boson_formats);
+	mutex_unlock(&sensor->lock);
 
-	return info.videoColumns;
+	return 0;
 }
 
 static int flir_get_agc_paramaters(struct flir_boson_dev * sensor)
 {
     FLR_RESULT ret = R_SUCCESS;
-	union fdata { float f; u32 u; };
-
-	union fdata perc_per_bin, lin_perc, outlier, drout, maxgain, damping, gamma, 
+	/* Float parameters are kept as raw IEEE-754 bits and printed in hex */
+	u32 perc_per_bin, lin_perc, outlier, drout, maxgain, damping, gamma,
 		detailhead, d2br, gmax, gmin;
 	u32 bin_first, bin_last, entropy, agc_mode, brightness, radius;
+	union word_data { u16 th[2]; u32 u;};
+	union word_data tf_thresholds;
+	struct flir_boson_batch_entry batch[18];
+	unsigned int n = 0;
 
-	ret = flir_boson_get_int_val(sensor, AGC_GETMODE, &agc_mode);	// AGC mode
-	ret &= flir_boson_get_int_val(sensor, AGC_GETUSEENTROPY, &entropy);	// 1 = use entropy, 1 = use plateau
+	flir_boson_batch_get_int(&batch[n++], AGC_GETMODE, &agc_mode);	// AGC mode
+	flir_boson_batch_get_int(&batch[n++], AGC_GETUSEENTROPY, &entropy);	// 1 = use entropy, 1 = use plateau
 
-	ret &= flir_boson_get_int_val(sensor, AGC_GETOUTLIERCUT, &outlier.u);	// outlier cut = tail rejection in percentage
-	ret &= flir_boson_get_int_val(sensor, AGC_GETMAXGAIN, &maxgain.u);	// max gain (gain limit per bin)
-	ret &= flir_boson_get_int_val(sensor, AGC_GETDF, &damping.u);	// damping factor
-	ret &= flir_boson_get_int_val(sensor, AGC_GETGAMMA, &gamma.u);	// gamma = ace
-	ret &= flir_boson_get_int_val(sensor, AGC_GETPERCENTPERBIN, &perc_per_bin.u);	// percent per bin = plateau value
-	ret &= flir_boson_get_int_val(sensor, AGC_GETLINEARPERCENT, &lin_perc.u);	// linear percent
+	flir_boson_batch_get_int(&batch[n++], AGC_GETOUTLIERCUT, &outlier);	// outlier cut = tail rejection in percentage
+	flir_boson_batch_get_int(&batch[n++], AGC_GETMAXGAIN, &maxgain);	// max gain (gain limit per bin)
+	flir_boson_batch_get_int(&batch[n++], AGC_GETDF, &damping);	// damping factor
+	flir_boson_batch_get_int(&batch[n++], AGC_GETGAMMA, &gamma);	// gamma = ace
+	flir_boson_batch_get_int(&batch[n++], AGC_GETPERCENTPERBIN, &perc_per_bin);	// percent per bin = plateau value
+	flir_boson_batch_get_int(&batch[n++], AGC_GETLINEARPERCENT, &lin_perc);	// linear percent
 
-	ret &= flir_boson_get_int_val(sensor, AGC_GETDETAILHEADROOM, &detailhead.u);	// DDE detail head room
-	ret &= flir_boson_get_int_val(sensor, AGC_GETD2BR, &d2br.u);	// DDE detail to background ratio
+	flir_boson_batch_get_int(&batch[n++], AGC_GETDETAILHEADROOM, &detailhead);	// DDE detail head room
+	flir_boson_batch_get_int(&batch[n++], AGC_GETD2BR, &d2br);	// DDE detail to background ratio
 
-	ret &= flir_boson_get_int_val(sensor, AGC_GETDROUT, &drout.u);	// output dynamic range
-	ret &= flir_boson_get_int_val(sensor, AGC_GETFIRSTBIN, &bin_first);	// first bin
-	ret &= flir_boson_get_int_val(sensor, AGC_GETLASTBIN, &bin_last);	// last bin
+	flir_boson_batch_get_int(&batch[n++], AGC_GETDROUT, &drout);	// output dynamic range
+	flir_boson_batch_get_int(&batch[n++], AGC_GETFIRSTBIN, &bin_first);	// first bin
+	flir_boson_batch_get_int(&batch[n++], AGC_GETLASTBIN, &bin_last);	// last bin
 
-	union word_data { u16 th[2]; u32 u;};
-	union word_data tf_thresholds;
+	flir_boson_batch_get_int(&batch[n++], AGC_GETTFTHRESHOLDS, &tf_thresholds.u);	// thresholds in threshold mode.
+	flir_boson_batch_get_int(&batch[n++], AGC_GETBRIGHTNESS, &brightness);	// brightness
 
-	ret &= flir_boson_get_int_val(sensor, AGC_GETTFTHRESHOLDS, &tf_thresholds.u);	// thresholds in threshold mode.
-	ret &= flir_boson_get_int_val(sensor, AGC_GETBRIGHTNESS, &brightness);	// brightness
+	flir_boson_batch_get_int(&batch[n++], AGC_GETRADIUS, &radius);	// DDE sharpening radius
+	flir_boson_batch_get_int(&batch[n++], AGC_GETGMAX, &gmax);	// DDE sharpening excluding noise
+	flir_boson_batch_get_int(&batch[n++], AGC_GETGMIN, &gmin);	// DDE noise supression
 
-	ret &= flir_boson_get_int_val(sensor, AGC_GETRADIUS, &radius);	// DDE sharpening radius
-	ret &= flir_boson_get_int_val(sensor, AGC_GETGMAX, &gmax.u);	// DDE sharpening excluding noise
-	ret &= flir_boson_get_int_val(sensor, AGC_GETGMIN, &gmin.u);	// DDE noise supression
+	mutex_lock(&sensor->lock);
+	ret = flir_boson_send_batch(sensor, batch, n);
+	mutex_unlock(&sensor->lock);
 
 	if (ret != R_SUCCESS) {
         dev_err(sensor->dev, "FORMAT: Failed to get AGC parameters: %s", flr_result_to_string(ret));
         return flr_result_to_errno(ret);
     }
 
-	char *message[] = {"normal", "hold", "threshold", "auto bright", "auto linear", "manual"};
-	pr_info("AGC mode    = %s \n", message[agc_mode]);
-	pr_info("Use Entropy = %d \n", entropy);
-
-	// Same order as AGC Presets panel of the Boson Windows GUI ;-) 6 + 2 attributes or parameters
-	pr_info("Tail Outlier Percent     = %#08X \n", outlier.u);
-	pr_info("Max Gain                 = %#08X \n", maxgain.u);
-	pr_info("Damping Factor           = %#08X \n", damping.u);
-	pr_info("ACE Gamma                = %#08X \n", gamma.u);
-	pr_info("Plateau Percent          = %#08X \n", perc_per_bin.u);
-	pr_info("Linear Percent           = %#08X \n", lin_perc.u);
-
-	pr_info("DDE Detail Head Room     = %#08X \n", detailhead.u);
-	pr_info("DDE detail to background = %#08X \n", d2br.u);
-
-	// Other important parameters.
-	pr_info("Output Dynamic Range     = %#08X \n", drout.u);
-	pr_info("(first bin, last bin)    = (%d, %d)\n", bin_first, bin_last);
-	pr_info("Tf Thresholds            = (%d, %d)\n", tf_thresholds.th[0], tf_thresholds.th[1]);
-
-	pr_info("Brightness               = %d \n", brightness);
-
-	// Other DDE parameters (sharpening and noise suppression etc.)
-	pr_info("DDE Object Radius        = %d \n", radius);
-	pr_info("DDE details sharpening   = %#08X \n", gmax.u);
-	pr_info("DDE noise suppresion     = %#08X \n", gmin.u);
+	/* Same order as the AGC Presets panel of the Boson Windows GUI, floats as raw bits */
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "agc mode %u, entropy %u, brightness %u", agc_mode, entropy, brightness);
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "agc outlier %#010x, max gain %#010x, damping %#010x", outlier, maxgain, damping);
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "agc gamma %#010x, plateau %#010x, linear %#010x", gamma, perc_per_bin, lin_perc);
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "agc dde headroom %#010x, d2br %#010x, drout %#010x", detailhead, d2br, drout);
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "agc bins %u..%u, tf thresholds %#010x", bin_first, bin_last, tf_thresholds.u);
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "agc dde radius %u, gmax %#010x, gmin %#010x", radius, gmax, gmin);
 
 	return ret;
 }
@@ -479,6 +2205,9 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
     const struct flir_boson_format    *new_format;
 	const struct flir_boson_framesize *new_framesize;
     FLR_RESULT                         ret = R_SUCCESS;
+    bool                               run_ffc;
+    bool                               embedded;
+    int                                err;
 
     if (format->pad != 0) return -EINVAL;
 	if (format->format.width==0 || format->format.height==0)  return -EINVAL;
@@ -510,32 +2239,58 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
 		goto unlock;
 	}
 
-	/* Apply format if necessary and different from current */
-	if (true) { // sensor->powered && (new_format != sensor->current_format || new_framesize != sensor->current_framesize)) {
+	/*
+	 * Apply the format through the shadow register cache: settings the
+	 * camera already has are skipped, so re-setting the same format costs
+	 * no I2C traffic and no FFC shutter event.
+	 */
+	if (new_format != sensor->current_format || new_framesize != sensor->current_framesize ||
+	    sensor->shadow_valid != GENMASK(FLIR_SHADOW_COUNT - 1, 0)) {
 
 		dev_dbg(sensor->dev, "FORMAT: Format change required - applying new settings");
+		run_ffc = new_format != sensor->current_format;
 
 		/* Set MIPI state to OFF before changing format */
 		dev_dbg(sensor->dev, "FORMAT: Setting MIPI to OFF before format change");
-		ret = flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_MIPI_STATE, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
 		if (ret != R_SUCCESS) {
 			dev_err(sensor->dev, "FORMAT: Failed to set MIPI OFF: %s", flr_result_to_string(ret));
 			ret = flr_result_to_errno(ret);
 			goto unlock;
 		}
-        /* Add telemetry line */
-        if (format->format.height >= 512) {
+        /* Add telemetry line - queued, applied before the next stream-on */
+        embedded = telemetry_embedded && !new_framesize->telemetry_rows;
+        if (embedded) {
+            /* Image stays at the requested size, telemetry goes out tagged as embedded data */
+            dev_dbg(sensor->dev, "FORMAT: Sending telemetry as embedded data");
+            err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_STATE, TELEMETRY_SETSTATE, FLR_ENABLE, 1);
+            if (!err)
+                err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_LOCATION, TELEMETRY_SETLOCATION, FLR_TELEMETRY_LOC_BOTTOM, 1);
+            if (!err)
+                err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_TAG, TELEMETRY_SETMIPIEMBEDDEDDATATAG, FLR_ENABLE, 1);
+        } else if (format->format.height >= 512) {
             dev_dbg(sensor->dev, "FORMAT: Adding telemetry line");
-            ret = flir_boson_send_int_cmd(sensor, TELEMETRY_SETSTATE, FLR_ENABLE, 1);
-            ret = flir_boson_send_int_cmd(sensor, TELEMETRY_SETLOCATION, FLR_TELEMETRY_LOC_BOTTOM, 1);
-            ret = flir_boson_send_int_cmd(sensor, TELEMETRY_SETMIPIEMBEDDEDDATATAG, FLR_DISABLE, 1);
+            err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_STATE, TELEMETRY_SETSTATE, FLR_ENABLE, 1);
+            if (!err)
+                err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_LOCATION, TELEMETRY_SETLOCATION, FLR_TELEMETRY_LOC_BOTTOM, 1);
+            if (!err)
+                err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_TAG, TELEMETRY_SETMIPIEMBEDDEDDATATAG, FLR_DISABLE, 1);
         } else {
             dev_dbg(sensor->dev, "FORMAT: Removing telemetry line");
-            ret = flir_boson_send_int_cmd(sensor, TELEMETRY_SETSTATE, FLR_DISABLE, 1);
+            err = flir_boson_shadow_queue(sensor, FLIR_SHADOW_TELEMETRY_STATE, TELEMETRY_SETSTATE, FLR_DISABLE, 1);
         }
+        if (err) {
+            /* get_frame_desc keeps describing what the camera was last told */
+            dev_err(sensor->dev, "FORMAT: Failed to queue telemetry settings: %d", err);
+            mutex_unlock(&sensor->lock);
+            return err;
+        }
+        spin_lock(&sensor->state_lock);
+        sensor->telemetry_embedded = embedded;
+        spin_unlock(&sensor->state_lock);
 		/* Set new DVO type */
 		dev_dbg(sensor->dev, "FORMAT: Setting DVO type to mipi");
-		ret = flir_boson_send_int_cmd(sensor, DVO_SETTYPE, new_format->flir_type, 100);
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_DVO_TYPE, DVO_SETTYPE, new_format->flir_type, 100);
 		if (ret != R_SUCCESS) {
 			dev_err(sensor->dev, "FORMAT: Failed to set DVO type: %s", flr_result_to_string(ret));
 			ret = flr_result_to_errno(ret);
@@ -546,7 +2301,7 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
 		u32 outformat = FLR_DVO_DEFAULT_FORMAT;
         outformat     = (new_format->flir_type == FLR_DVO_TYPE_COLOR) ? FLR_DVO_YCBCR : FLR_DVO_IR16;
 		dev_dbg(sensor->dev, "FORMAT: Setting DVO output-format to %d", outformat);
-		ret = flir_boson_send_int_cmd(sensor, DVO_SETOUTPUTFORMAT, outformat, 1);
+		ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_DVO_OUTPUT_FORMAT, DVO_SETOUTPUTFORMAT, outformat, 1);
 		if (ret != R_SUCCESS) {
 			dev_err(sensor->dev, "FORMAT: Failed to set DVO output-format: %s", flr_result_to_string(ret));
             ret = flr_result_to_errno(ret);
@@ -557,7 +2312,11 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
         /* from https://flir.custhelp.com/app/answers/detail/a_id/3387/~/flir-oem---boson-video-and-image-capture-using-opencv-16-bit-y16 */
         if ((new_format->code == MEDIA_BUS_FMT_Y14_1X14) && (enable_radiometry)) {
 
-			ret = flir_boson_send_int_cmd(sensor, BOSON_SETGAINMODE, FLR_BOSON_AUTO_GAIN, 1); //  FLR_BOSON_HIGH_GAIN
+			if (!flir_boson_shadow_match(sensor, FLIR_SHADOW_GAIN_MODE, FLR_BOSON_AUTO_GAIN) ||
+			    !flir_boson_shadow_match(sensor, FLIR_SHADOW_AGC_MODE, FLR_AGC_MODE_NORMAL))
+				run_ffc = true;
+
+			ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_GAIN_MODE, BOSON_SETGAINMODE, FLR_BOSON_AUTO_GAIN, 1); //  FLR_BOSON_HIGH_GAIN
             if (ret != R_SUCCESS) {
                 dev_err(sensor->dev, "FORMAT: Failed to set gain mode: %s", flr_result_to_string(ret));
                 ret = flr_result_to_errno(ret);
@@ -565,7 +2324,7 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
             }
 
 			// newly added set AGC mode: auto bright or auto linear
-			ret = flir_boson_send_int_cmd(sensor, AGC_SETMODE, FLR_AGC_MODE_NORMAL, 1); // FLR_AGC_MODE_AUTO_BRIGHT // FLR_AGC_MODE_AUTO_LINEAR
+			ret = flir_boson_shadow_send(sensor, FLIR_SHADOW_AGC_MODE, AGC_SETMODE, FLR_AGC_MODE_NORMAL, 1); // FLR_AGC_MODE_AUTO_BRIGHT // FLR_AGC_MODE_AUTO_LINEAR
 
 			if (ret != R_SUCCESS) {
                 dev_err(sensor->dev, "FORMAT: Failed to set AGC mode: %s", flr_result_to_string(ret));
@@ -573,34 +2332,42 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
                 // goto unlock;
             }
 
-            u32 dummy;
-            ret = flir_boson_get_int_val(sensor, BOSON_RUNFFC, &dummy);
-            if (ret != R_SUCCESS) {
-                dev_err(sensor->dev, "FORMAT: Failed to run FFC: %s", flr_result_to_string(ret));
-			ret = flr_result_to_errno(ret);
-			// goto unlock;
-            }
+            /* FFC takes up to a second; run it from the command queue, only when the pipeline changed */
+            /* Manual and external modes leave FFC scheduling to the application */
+            if (sensor->ffc_mode_ctrl->cur.val != FLR_BOSON_AUTO_FFC)
+                run_ffc = false;
+            if (run_ffc && flir_boson_queue_void_cmd(sensor, BOSON_RUNFFC, 1))
+                dev_err(sensor->dev, "FORMAT: Failed to queue FFC");
+            else if (run_ffc)
+                flir_boson_event(sensor, FLIR_EVENT_FFC, "run after format change");
+            ret = R_SUCCESS;
 		}
 
-		flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
+		flir_boson_shadow_send(sensor, FLIR_SHADOW_MIPI_STATE, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1);
 
 		/* Set new DVO muxtype */
 		dev_dbg(sensor->dev, "FORMAT: Setting DVO muxtype to mipi and %d", new_format->flir_mux_type);
-		ret = flir_boson_set_dvo_muxtype(sensor, FLR_DVOMUX_OUTPUT_IF_MIPITX, FLR_DVOMUX_SRC_IR, (FLR_DVOMUX_TYPE_E)new_format->flir_mux_type);
+		ret = flir_boson_shadow_set_dvo_muxtype(sensor, (FLR_DVOMUX_TYPE_E)new_format->flir_mux_type);
 		if (ret != R_SUCCESS) {
 			dev_err(sensor->dev, "FORMAT: Failed to set DVO muxtype: %s", flr_result_to_string(ret));
 			ret = flr_result_to_errno(ret);
             goto unlock;
 		}
 
+        spin_lock(&sensor->state_lock);
         sensor->current_format    = new_format;
 		sensor->current_framesize = new_framesize;
+        spin_unlock(&sensor->state_lock);
+		flir_boson_update_rates(sensor);
+		flir_boson_event(sensor, FLIR_EVENT_CONFIG, "format %ux%u, code %#06x", new_framesize->width, new_framesize->height,
+				 new_format->code);
 		dev_dbg(sensor->dev, "FORMAT: Format change completed successfully");
 	} else {
 		dev_dbg(sensor->dev, "FORMAT: No format change needed");
 	}
 
 	/* Update format structure */
+	spin_lock(&sensor->state_lock);
     sensor->fmt.code       = new_format->code;
     sensor->fmt.width      = new_framesize->width;
     sensor->fmt.height     = new_framesize->height;
@@ -608,19 +2375,238 @@ static int flir_boson_set_fmt(struct v4l2_subdev *sd, struct v4l2_subdev_state *
 	sensor->fmt.colorspace = new_format->flir_type == FLR_DVO_TYPE_COLOR ? V4L2_COLORSPACE_SRGB : V4L2_COLORSPACE_RAW;
 
 	format->format = sensor->fmt;
+	spin_unlock(&sensor->state_lock);
 
 unlock:
 	mutex_unlock(&sensor->lock);
     return ret == R_SUCCESS ? 0 : (ret > 0 ? ret : flr_result_to_errno(ret));
 }
 
+/*
+ * Stream 0 carries the image; with telemetry_embedded the telemetry lines
+ * follow on stream 1 as CSI-2 embedded data on the same virtual channel,
+ * so receivers can route them to a separate metadata buffer.
+ */
+static int flir_boson_get_frame_desc(struct v4l2_subdev *sd, unsigned int pad, struct v4l2_mbus_frame_desc *fd)
+{
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+	struct v4l2_mbus_frame_desc_entry *entry;
+	const struct flir_boson_format *fmt;
+	u32 width, height;
+
+	if (pad != 0)
+		return -EINVAL;
+
+	spin_lock(&sensor->state_lock);
+	fmt    = sensor->current_format;
+	width  = sensor->current_framesize->width;
+	height = sensor->current_framesize->height;
+
+	memset(fd, 0, sizeof(*fd));
+	fd->type = V4L2_MBUS_FRAME_DESC_TYPE_CSI2;
+
+	entry = &fd->entry[fd->num_entries++];
+	entry->stream      = FLIR_BOSON_STREAM_IMAGE;
+	entry->flags       = V4L2_MBUS_FRAME_DESC_FL_LEN_MAX;
+	entry->pixelcode   = fmt->code;
+	entry->length      = width * height * DIV_ROUND_UP(fmt->bpp, 8);
+	entry->bus.csi2.vc = 0;
+	entry->bus.csi2.dt = fmt->csi2_dt;
+
+	if (sensor->telemetry_embedded) {
+		entry = &fd->entry[fd->num_entries++];
+		entry->stream      = FLIR_BOSON_STREAM_TELEMETRY;
+		entry->flags       = V4L2_MBUS_FRAME_DESC_FL_LEN_MAX;
+		entry->pixelcode   = MEDIA_BUS_FMT_METADATA_FIXED;
+		entry->length      = width * 2 * FLIR_BOSON_TELEMETRY_LINES;
+		entry->bus.csi2.vc = 0;
+		entry->bus.csi2.dt = MIPI_CSI2_DT_EMBEDDED_8B;
+	}
+	spin_unlock(&sensor->state_lock);
+
+	return 0;
+}
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 18, 0)
+/*
+ * Bus setup for the receiver, from the endpoint the driver programs the
+ * camera with: the lane count is fixed in hardware, the clock-lane mode is
+ * sent at stream-on. Data type and virtual channel per format come from
+ * get_frame_desc, the link rate from V4L2_CID_LINK_FREQ.
+ */
+static int flir_boson_get_mbus_config(struct v4l2_subdev *sd, unsigned int pad, struct v4l2_mbus_config *cfg)
+{
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+
+	if (pad != 0)
+		return -EINVAL;
+
+	memset(cfg, 0, sizeof(*cfg));
+	cfg->type          = V4L2_MBUS_CSI2_DPHY;
+	cfg->bus.mipi_csi2 = sensor->ep.bus.mipi_csi2;
+	if (!cfg->bus.mipi_csi2.num_data_lanes)
+		cfg->bus.mipi_csi2.num_data_lanes = 2;
+
+	return 0;
+}
+#endif
+
+static_assert(FLIR_BOSON_FSLP_MAX_PAYLOAD == FLIR_FSLP_MAX_DATA - 12);
+
+/*
+ * FLIR_BOSON_IOCTL_FSLP_FRAME: run a vector of SDK commands for userspace
+ * as one batch, so the SDK never has to open the I2C bus itself.
+ */
+static long flir_boson_ioctl_fslp(struct flir_boson_dev *sensor, struct flir_boson_ioctl_fslp *req)
+{
+	struct flir_boson_batch_entry *batch;
+	struct flir_boson_fslp_cmd *cmds;
+	FLR_RESULT result = R_SUCCESS;
+	unsigned int i;
+	u8 *bufs, *tx, *rx;
+	long ret = 0;
+
+	if (!req->count || req->count > FLIR_BOSON_FSLP_MAX_CMDS || req->flags)
+		return -EINVAL;
+
+	cmds = memdup_user(u64_to_user_ptr(req->cmds), req->count * sizeof(*cmds));
+	if (IS_ERR(cmds))
+		return PTR_ERR(cmds);
+
+	batch = kcalloc(req->count, sizeof(*batch), GFP_KERNEL);
+	bufs  = kvmalloc_array(req->count, 2 * FLIR_BOSON_FSLP_MAX_PAYLOAD, GFP_KERNEL);
+	if (!batch || !bufs) {
+		ret = -ENOMEM;
+		goto out_free;
+	}
+
+	for (i = 0; i < req->count; i++) {
+		tx = bufs + i * 2 * FLIR_BOSON_FSLP_MAX_PAYLOAD;
+		rx = tx + FLIR_BOSON_FSLP_MAX_PAYLOAD;
+
+		if (cmds[i].tx_bytes > FLIR_BOSON_FSLP_MAX_PAYLOAD || cmds[i].rx_bytes > FLIR_BOSON_FSLP_MAX_PAYLOAD || cmds[i].reserved ||
+		    cmds[i].timeout_ms > FLIR_BOSON_FSLP_MAX_TIMEOUT_MS) {
+			ret = -EINVAL;
+			goto out_free;
+		}
+		if (cmds[i].tx_bytes && copy_from_user(tx, u64_to_user_ptr(cmds[i].tx_data), cmds[i].tx_bytes)) {
+			ret = -EFAULT;
+			goto out_free;
+		}
+
+		batch[i].fn_id      = cmds[i].fn_id;
+		batch[i].send_data  = tx;
+		batch[i].send_bytes = cmds[i].tx_bytes;
+		batch[i].recv_data  = rx;
+		batch[i].recv_bytes = cmds[i].rx_bytes;
+		batch[i].delay_ms   = cmds[i].timeout_ms;
+	}
+
+	/* A standby camera only answers a subset of commands */
+	ret = pm_runtime_resume_and_get(sensor->dev);
+	if (ret)
+		goto out_free;
+
+	mutex_lock(&sensor->lock);
+	if (!sensor->powered)
+		result = flir_boson_power_on(sensor);
+	if (result == R_SUCCESS) {
+		flir_boson_send_batch(sensor, batch, req->count);
+		/* The driver cannot tell what a setter changed until it is sent again */
+		for (i = 0; i < req->count; i++)
+			flir_boson_shadow_forget(sensor, batch[i].fn_id);
+	}
+	mutex_unlock(&sensor->lock);
+
+	pm_runtime_mark_last_busy(sensor->dev);
+	pm_runtime_put_autosuspend(sensor->dev);
+
+	if (result != R_SUCCESS) {
+		ret = flr_result_to_errno(result);
+		goto out_free;
+	}
+
+	for (i = 0; i < req->count; i++) {
+		cmds[i].result = batch[i].result;
+		if (batch[i].result != R_SUCCESS)
+			continue;
+		/* Only what the camera answered, the rest of the buffer was never written */
+		cmds[i].rx_bytes = batch[i].recv_bytes;
+		if (cmds[i].rx_bytes && copy_to_user(u64_to_user_ptr(cmds[i].rx_data), batch[i].recv_data, cmds[i].rx_bytes)) {
+			ret = -EFAULT;
+			goto out_free;
+		}
+	}
+
+	if (copy_to_user(u64_to_user_ptr(req->cmds), cmds, req->count * sizeof(*cmds)))
+		ret = -EFAULT;
+
+out_free:
+	kvfree(bufs);
+	kfree(batch);
+	kfree(cmds);
+	return ret;
+}
+
+/* Private ioctls on the subdev node, see flir-boson-ioctl.h */
+static long flir_boson_ioctl(struct v4l2_subdev *sd, unsigned int cmd, void *arg)
+{
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+
+	switch (cmd) {
+	case FLIR_BOSON_IOCTL_FSLP_FRAME:
+		return flir_boson_ioctl_fslp(sensor, arg);
+	case FLIR_BOSON_IOCTL_GET_STATUS:
+		/* No lock and no bus traffic, safe to poll at any rate */
+		flir_boson_fill_status(sensor, arg);
+		return 0;
+	default:
+		return -ENOIOCTLCMD;
+	}
+}
+
+#ifdef CONFIG_COMPAT
+/* The structures have the same layout for 32-bit userspace; only the argument needs copying */
+static long flir_boson_compat_ioctl32(struct v4l2_subdev *sd, unsigned int cmd, unsigned long arg)
+{
+	struct flir_boson_ioctl_fslp req;
+	struct flir_boson_status st;
+	long ret;
+
+	switch (cmd) {
+	case FLIR_BOSON_IOCTL_GET_STATUS:
+		flir_boson_ioctl(sd, cmd, &st);
+		return copy_to_user(compat_ptr(arg), &st, sizeof(st)) ? -EFAULT : 0;
+	case FLIR_BOSON_IOCTL_FSLP_FRAME:
+		if (copy_from_user(&req, compat_ptr(arg), sizeof(req)))
+			return -EFAULT;
+		ret = flir_boson_ioctl(sd, cmd, &req);
+		if (!ret && copy_to_user(compat_ptr(arg), &req, sizeof(req)))
+			ret = -EFAULT;
+		return ret;
+	default:
+		return -ENOIOCTLCMD;
+	}
+}
+#endif
+
 /* V4L2 Subdev Operations */
 static const struct v4l2_subdev_core_ops flir_boson_core_ops = {
-	.s_power = flir_boson_s_power,
+	.s_power           = flir_boson_s_power,
+	.subscribe_event   = flir_boson_subscribe_event,
+	.unsubscribe_event = v4l2_event_subdev_unsubscribe,
+	.ioctl             = flir_boson_ioctl,
+#ifdef CONFIG_COMPAT
+	.compat_ioctl32    = flir_boson_compat_ioctl32,
+#endif
 };
 
 static const struct v4l2_subdev_video_ops flir_boson_video_ops = {
 	.s_stream = flir_boson_s_stream,
+#if LINUX_VERSION_CODE < KERNEL_VERSION(6, 8, 0)
+	.g_frame_interval = flir_boson_g_frame_interval,
+	.s_frame_interval = flir_boson_s_frame_interval,
+#endif
 };
 
 static const struct v4l2_subdev_pad_ops flir_boson_pad_ops = {
@@ -629,6 +2615,16 @@ static const struct v4l2_subdev_pad_ops flir_boson_pad_ops = {
     .set_fmt             = flir_boson_set_fmt,
     .enum_frame_size     = flir_boson_enum_frame_size,
 	.enum_frame_interval = flir_boson_enum_frame_interval,
+	.get_frame_desc      = flir_boson_get_frame_desc,
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(5, 18, 0)
+	.get_mbus_config     = flir_boson_get_mbus_config,
+#endif
+	.get_selection       = flir_boson_get_selection,
+	.set_selection       = flir_boson_set_selection,
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 8, 0)
+	.get_frame_interval  = flir_boson_get_frame_interval,
+	.set_frame_interval  = flir_boson_set_frame_interval,
+#endif
 };
 
 static const struct v4l2_subdev_ops flir_boson_subdev_ops = {
@@ -644,6 +2640,113 @@ static const struct media_entity_operations flir_boson_media_ops = {
 	.link_setup = flir_boson_link_setup,
 };
 
+/**
+ * flir_boson_wait_ready - Poll the camera until it answers BOSON_GETCAMERASN
+ * @sensor: FLIR sensor device
+ *
+ * Replaces a fixed boot delay: the poll interval starts short and doubles
+ * up to FLIR_BOSON_BOOT_POLL_MAX_MS, so an already running camera is
+ * detected on the first try.
+ *
+ * Return: 0 once the camera answered, -ETIMEDOUT otherwise.
+ */
+static int flir_boson_wait_ready(struct flir_boson_dev *sensor)
+{
+	ktime_t deadline = ktime_add_ms(ktime_get(), FLIR_BOSON_BOOT_TIMEOUT_MS);
+	unsigned int poll_ms = FLIR_BOSON_BOOT_POLL_MIN_MS;
+	FLR_RESULT ret;
+
+	sensor->booting = true;
+	for (;;) {
+		sensor->rx_dirty = true;
+		ret = flir_boson_get_int_val(sensor, BOSON_GETCAMERASN, &sensor->camera_sn);
+		if (ret == R_SUCCESS || ktime_after(ktime_get(), deadline))
+			break;
+
+		msleep(poll_ms);
+		poll_ms = min_t(unsigned int, poll_ms * 2, FLIR_BOSON_BOOT_POLL_MAX_MS);
+	}
+	sensor->booting = false;
+
+	return ret == R_SUCCESS ? 0 : -ETIMEDOUT;
+}
+
+/*
+ * persist_config: read the camera's settings back into the shadow cache
+ * and only send what differs from the probe configuration. A camera
+ * that needed changes gets them saved as its power-on defaults, so the
+ * next boot verifies with getters only. Called with sensor->lock held.
+ */
+static void flir_boson_sync_boot_config(struct flir_boson_dev *sensor)
+{
+	const struct flir_boson_format *fmt = sensor->current_format;
+	const struct {
+		enum flir_shadow_id id;
+		u32 cmd;
+		u32 val;
+		u32 delay_ms;
+	} boot[] = {
+		{ FLIR_SHADOW_MIPI_STATE, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1 },
+		{ FLIR_SHADOW_DVO_TYPE, DVO_SETTYPE, fmt->flir_type, 100 },
+		{ FLIR_SHADOW_DVO_OUTPUT_FORMAT, DVO_SETOUTPUTFORMAT, fmt->flir_type == FLR_DVO_TYPE_COLOR ? FLR_DVO_YCBCR : FLR_DVO_IR16, 1 },
+		{ FLIR_SHADOW_DVO_OUTPUT_IF, DVO_SETOUTPUTINTERFACE, FLR_DVO_MIPI, 100 },
+		{ FLIR_SHADOW_FRAME_SKIP, ROIC_SETFRAMESKIP, 0, 1 },
+	};
+	FLR_RESULT ret = R_SUCCESS;
+	unsigned int i, changed = 0;
+	int loaded;
+
+	loaded = flir_boson_shadow_load(sensor);
+
+	for (i = 0; i < ARRAY_SIZE(boot) && ret == R_SUCCESS; i++) {
+		if (flir_boson_shadow_match(sensor, boot[i].id, boot[i].val))
+			continue;
+		ret = flir_boson_shadow_send(sensor, boot[i].id, boot[i].cmd, boot[i].val, boot[i].delay_ms);
+		changed++;
+	}
+	if (ret == R_SUCCESS && !flir_boson_shadow_match(sensor, FLIR_SHADOW_DVO_MUXTYPE, fmt->flir_mux_type)) {
+		ret = flir_boson_shadow_set_dvo_muxtype(sensor, (FLR_DVOMUX_TYPE_E)fmt->flir_mux_type);
+		changed++;
+	}
+
+	if (ret != R_SUCCESS) {
+		dev_warn(sensor->dev, "Could not apply boot configuration: %s\n", flr_result_to_string(ret));
+		return;
+	}
+	if (!changed) {
+		flir_boson_event(sensor, FLIR_EVENT_CONFIG, "boot configuration verified, %d settings cached", loaded);
+		return;
+	}
+
+	ret = flir_boson_send_void_cmd(sensor, BOSON_WRITEDYNAMICHEADERTOFLASH, 1000);
+	if (ret != R_SUCCESS)
+		dev_warn(sensor->dev, "Could not save boot configuration to flash: %s\n", flr_result_to_string(ret));
+	else
+		flir_boson_event(sensor, FLIR_EVENT_CONFIG, "boot configuration saved to flash, %u settings changed", changed);
+}
+
+/*
+ * Pick up the adapter's transfer limits and bus clock. The clock is a
+ * property of the adapter node; "flir,fast-mode-plus" on the camera node
+ * only checks that the board raised it.
+ */
+static void flir_boson_setup_bus(struct flir_boson_dev *sensor)
+{
+	struct i2c_adapter *adap = sensor->i2c_client->adapter;
+
+	if (adap->quirks) {
+		sensor->i2c_max_read  = adap->quirks->max_read_len;
+		sensor->i2c_max_write = adap->quirks->max_write_len;
+	}
+	device_property_read_u32(&adap->dev, "clock-frequency", &sensor->i2c_bus_hz);
+
+	if (device_property_read_bool(sensor->dev, "flir,fast-mode-plus") && sensor->i2c_bus_hz < FLIR_BOSON_I2C_FMP_HZ)
+		dev_warn(sensor->dev, "Fast-mode Plus requested but %s runs at %u Hz, set clock-frequency = <%u> on the adapter\n", adap->name,
+			 sensor->i2c_bus_hz, FLIR_BOSON_I2C_FMP_HZ);
+
+	dev_dbg(sensor->dev, "I2C: bus %u Hz, max read %u, max write %u\n", sensor->i2c_bus_hz, sensor->i2c_max_read, sensor->i2c_max_write);
+}
+
 /* I2C Driver Functions */
 #if LINUX_VERSION_CODE >= KERNEL_VERSION(6, 3, 0)
 static int flir_boson_probe(struct i2c_client *client)
@@ -654,11 +2757,10 @@ static int flir_boson_probe(struct i2c_client *client, const struct i2c_device_i
     struct device         *dev = &client->dev;
     struct fwnode_handle  *endpoint;
 	struct flir_boson_dev *sensor;
+    struct boson_clockinfo info;
+    ktime_t                start = ktime_get();
     int                    ret;
 
-	pr_info("***** AB2219 Boson Flir Probe starts *****\n");
-
-	dev_info(dev, "FLIR Boson+ MIPI camera driver probing\n");
 	dev_dbg(dev, "PROBE: I2C address=0x%02x", client->addr);
 
 	sensor = devm_kzalloc(dev, sizeof(*sensor), GFP_KERNEL);
@@ -667,27 +2769,15 @@ static int flir_boson_probe(struct i2c_client *client, const struct i2c_device_i
     sensor->dev           = dev;
     sensor->i2c_client    = client;
 	sensor->command_count = get_random_u32() >> 23;
+	sensor->rx_dirty      = true;
 	mutex_init(&sensor->lock);
+	spin_lock_init(&sensor->state_lock);
+	INIT_DELAYED_WORK(&sensor->ffc_work, flir_boson_ffc_work);
+	INIT_DELAYED_WORK(&sensor->stats_work, flir_boson_stats_work);
+	INIT_DELAYED_WORK(&sensor->health_work, flir_boson_health_work);
+	INIT_DELAYED_WORK(&sensor->snapshot_work, flir_boson_snapshot_work);
 	dev_dbg(dev, "PROBE: Device structure initialized");
 
-	SENSOR_WIDTH = flir_get_clockinfo(sensor);
-
-	/* Initialize default format */
-	// RAW8 or UYVY ;-)
-    sensor->current_format    = (SENSOR_WIDTH==320)? &flir_boson_formats[2] : &flir_boson_formats[0];
-	// 320 x 256 or 640 x 512 ;-)
-	sensor->current_framesize = (SENSOR_WIDTH==320)? &flir_boson_framesizes[0] : &flir_boson_framesizes[1]; 
-
-	sensor->fmt.code          = sensor->current_format->code;
-    sensor->fmt.width         = sensor->current_framesize->width;
-    sensor->fmt.height        = sensor->current_framesize->height;
-    sensor->fmt.field         = V4L2_FIELD_NONE;
-    sensor->fmt.colorspace    = V4L2_COLORSPACE_DEFAULT;
-    sensor->fmt.ycbcr_enc     = V4L2_MAP_YCBCR_ENC_DEFAULT(sensor->fmt.colorspace);
-    sensor->fmt.quantization  = V4L2_QUANTIZATION_FULL_RANGE;
-    sensor->fmt.xfer_func     = V4L2_MAP_XFER_FUNC_DEFAULT(sensor->fmt.colorspace);
-    dev_info(dev, "PROBE: Default format initialized - %ux%u, code=0x%08x", sensor->fmt.width, sensor->fmt.height, sensor->fmt.code);
-
 	/* Get reset GPIO */
 	sensor->reset_gpio = devm_gpiod_get_optional(dev, "reset", GPIOD_OUT_LOW);
 	if (IS_ERR(sensor->reset_gpio)) {
@@ -704,7 +2794,9 @@ static int flir_boson_probe(struct i2c_client *client, const struct i2c_device_i
 		return -EINVAL;
 	}
 
-	ret = v4l2_fwnode_endpoint_parse(endpoint, &sensor->ep);
+	/* alloc_parse also fetches the optional link-frequencies list */
+	sensor->ep.bus_type = V4L2_MBUS_CSI2_DPHY;
+	ret = v4l2_fwnode_endpoint_alloc_parse(endpoint, &sensor->ep);
 	fwnode_handle_put(endpoint);
 	if (ret) {
 		dev_err(dev, "Could not parse endpoint\n");
@@ -713,15 +2805,72 @@ static int flir_boson_probe(struct i2c_client *client, const struct i2c_device_i
 
 	if (sensor->ep.bus_type != V4L2_MBUS_CSI2_DPHY) {
 		dev_err(dev, "Unsupported bus type %d\n", sensor->ep.bus_type);
-		return -EINVAL;
+		ret = -EINVAL;
+		goto cleanup_endpoint;
 	}
 
     ret = of_property_read_u32(dev->of_node, "csi_id", &(sensor->csi_id));
     if (ret) {
         dev_err(dev, "csi id missing or invalid\n");
-        return ret;
+        goto cleanup_endpoint;
     }
 
+	ret = flir_boson_cmd_queue_init(sensor);
+	if (ret) {
+		dev_err(dev, "Could not allocate command queue\n");
+		goto cleanup_endpoint;
+	}
+
+	flir_boson_setup_bus(sensor);
+
+	if (sensor->reset_gpio) {
+		gpiod_set_value_cansleep(sensor->reset_gpio, 1);
+		msleep(4);
+		gpiod_set_value_cansleep(sensor->reset_gpio, 0);
+		flir_boson_shadow_invalidate(sensor);
+	}
+
+	/* Wait for camera boot, reading the serial number as the readiness probe */
+	ret = flir_boson_wait_ready(sensor);
+	if (ret) {
+		dev_err(dev, "Camera did not answer within %d ms\n", FLIR_BOSON_BOOT_TIMEOUT_MS);
+		goto cleanup_queue;
+	}
+	flir_boson_event(sensor, FLIR_EVENT_STATE, "camera SN %u (%#010x)", sensor->camera_sn, sensor->camera_sn);
+
+	/* Sensor dimension is only reliable once the camera has booted */
+	sensor->sensor_width = flir_get_clockinfo(sensor, &info);
+
+	/* Initialize default format */
+	// RAW8 or UYVY ;-)
+    sensor->current_format    = (sensor->sensor_width==320)? &flir_boson_formats[2] : &flir_boson_formats[0];
+	// 320 x 256 or 640 x 512 ;-)
+	sensor->current_framesize = (sensor->sensor_width==320)? &flir_boson_framesizes[0] : &flir_boson_framesizes[1];
+
+	/* No zoom until userspace sets a crop; a camera without a scaler only allows the full frame */
+	sensor->crop.width  = sensor->sensor_width;
+	sensor->crop.height = flir_boson_sensor_height(sensor);
+	mutex_lock(&sensor->lock);
+	if (flir_boson_get_int_val(sensor, SCALER_GETMAXZOOM, &sensor->max_zoom) != R_SUCCESS || !sensor->max_zoom)
+		sensor->max_zoom = 1;
+	mutex_unlock(&sensor->lock);
+
+	sensor->fmt.code          = sensor->current_format->code;
+    sensor->fmt.width         = sensor->current_framesize->width;
+    sensor->fmt.height        = sensor->current_framesize->height;
+    sensor->fmt.field         = V4L2_FIELD_NONE;
+    sensor->fmt.colorspace    = V4L2_COLORSPACE_DEFAULT;
+    sensor->fmt.ycbcr_enc     = V4L2_MAP_YCBCR_ENC_DEFAULT(sensor->fmt.colorspace);
+    sensor->fmt.quantization  = V4L2_QUANTIZATION_FULL_RANGE;
+    sensor->fmt.xfer_func     = V4L2_MAP_XFER_FUNC_DEFAULT(sensor->fmt.colorspace);
+	flir_boson_event(sensor, FLIR_EVENT_CONFIG, "default format %ux%u, code %#06x", sensor->fmt.width, sensor->fmt.height, sensor->fmt.code);
+
+	if (persist_config) {
+		mutex_lock(&sensor->lock);
+		flir_boson_sync_boot_config(sensor);
+		mutex_unlock(&sensor->lock);
+	}
+
 	/* Initialize V4L2 subdev */
 	v4l2_i2c_subdev_init(&sensor->sd, client, &flir_boson_subdev_ops);
 	sensor->sd.flags |= V4L2_SUBDEV_FL_HAS_EVENTS | V4L2_SUBDEV_FL_HAS_DEVNODE;
@@ -730,50 +2879,68 @@ static int flir_boson_probe(struct i2c_client *client, const struct i2c_device_i
     strscpy(sensor->sd.name, "flir_boson", sizeof(sensor->sd.name));
 	dev_dbg(dev, "PROBE: V4L2 subdev initialized");
 
+	ret = flir_boson_init_controls(sensor, &info);
+	if (ret)
+		goto cleanup_ctrls;
+
 	/* Initialize media pad */
 	sensor->pad.flags = MEDIA_PAD_FL_SOURCE;
 	ret = media_entity_pads_init(&sensor->sd.entity, 1, &sensor->pad);
 	if (ret) {
 		dev_err(dev, "Could not init media entity\n");
-		goto cleanup_mutex;
+		goto cleanup_ctrls;
 	}
 	dev_dbg(dev, "PROBE: Media pad initialized");
 
-	/* Register V4L2 subdev */
+	mutex_lock(&sensor->lock);
+	if (flir_boson_shadow_send(sensor, FLIR_SHADOW_MIPI_STATE, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1) != R_SUCCESS)
+        dev_warn(dev, "Could not set MIPI state to OFF");
+	mutex_unlock(&sensor->lock);
+	sensor->mipi_state = FLR_DVO_MIPI_STATE_OFF;
+	sensor->powered    = true;
+
+	flir_boson_debugfs_init(sensor);
+
+	/* The camera just booted and is awake; hold it active until registered */
+	pm_runtime_set_active(dev);
+	pm_runtime_get_noresume(dev);
+	pm_runtime_enable(dev);
+
+	/* Register V4L2 subdev last, once the camera is ready to be configured */
 	dev_dbg(dev, "PROBE: Registering V4L2 async subdev");
 	ret = v4l2_async_register_subdev_sensor(&sensor->sd);
 	if (ret) {
 		dev_err(dev, "Could not register v4l2 device: %d\n", ret);
-		goto cleanup_entity;
+		goto cleanup_pm;
 	}
 	dev_dbg(dev, "PROBE: V4L2 subdev registered successfully");
 
-	if (sensor->reset_gpio) {
-		gpiod_set_value_cansleep(sensor->reset_gpio, 1);
-		msleep(4);
-		gpiod_set_value_cansleep(sensor->reset_gpio, 0);
-
-	    /* Wait for camera boot (2.5 seconds as per spec) */
-		msleep(2700);
-	}
-
-	/* Get camera serial number */
-	if (flir_boson_get_int_val(sensor, BOSON_GETCAMERASN, &sensor->camera_sn) == R_SUCCESS)
-		dev_info(dev, "Camera SN: 0x%08X", sensor->camera_sn);
-	else
-        dev_warn(dev, "Could not read camera serial number");
+	pm_runtime_set_autosuspend_delay(dev, FLIR_BOSON_AUTOSUSPEND_MS);
+	pm_runtime_use_autosuspend(dev);
+	pm_runtime_mark_last_busy(dev);
+	pm_runtime_put_autosuspend(dev);
 
-	if (flir_boson_send_int_cmd(sensor, DVO_SETMIPISTATE, FLR_DVO_MIPI_STATE_OFF, 1) != R_SUCCESS)
-        dev_warn(dev, "Could not set MIPI state to OFF");
-	sensor->mipi_state = FLR_DVO_MIPI_STATE_OFF;
+	mutex_lock(&flir_boson_devices_lock);
+	list_add_tail(&sensor->list, &flir_boson_devices);
+	mutex_unlock(&flir_boson_devices_lock);
+	schedule_delayed_work(&sensor->health_work, 0);
 
-	dev_info(dev, "FLIR Boson+ MIPI camera driver loaded\n");
+	flir_boson_event(sensor, FLIR_EVENT_STATE, "camera ready in %u ms", (u32)ktime_ms_delta(ktime_get(), start));
 	dev_dbg(dev, "PROBE: Complete - device ready for operation");
 	return 0;
 
-cleanup_entity:
+cleanup_pm:
+	pm_runtime_disable(dev);
+	pm_runtime_set_suspended(dev);
+	pm_runtime_put_noidle(dev);
+	flir_boson_debugfs_cleanup(sensor);
 	media_entity_cleanup(&sensor->sd.entity);
-cleanup_mutex:
+cleanup_ctrls:
+	v4l2_ctrl_handler_free(&sensor->ctrls);
+cleanup_queue:
+	flir_boson_cmd_queue_destroy(sensor);
+cleanup_endpoint:
+	v4l2_fwnode_endpoint_free(&sensor->ep);
 	mutex_destroy(&sensor->lock);
 	return ret;
 }
@@ -787,8 +2954,22 @@ static void flir_boson_remove(struct i2c_client *client)
     struct v4l2_subdev    *sd     = i2c_get_clientdata(client);
 	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
 
+	flir_boson_debugfs_cleanup(sensor);
 	v4l2_async_unregister_subdev(&sensor->sd);
+	pm_runtime_disable(sensor->dev);
+	pm_runtime_dont_use_autosuspend(sensor->dev);
+	pm_runtime_set_suspended(sensor->dev);
+	cancel_delayed_work_sync(&sensor->ffc_work);
+	cancel_delayed_work_sync(&sensor->stats_work);
+	mutex_lock(&flir_boson_devices_lock);
+	list_del(&sensor->list);
+	mutex_unlock(&flir_boson_devices_lock);
+	cancel_delayed_work_sync(&sensor->health_work);
+	cancel_delayed_work_sync(&sensor->snapshot_work);
+	flir_boson_cmd_queue_destroy(sensor);
 	media_entity_cleanup(&sensor->sd.entity);
+	v4l2_ctrl_handler_free(&sensor->ctrls);
+	v4l2_fwnode_endpoint_free(&sensor->ep);
 	mutex_destroy(&sensor->lock);
 
 #if LINUX_VERSION_CODE < KERNEL_VERSION(6, 0, 0)
@@ -808,12 +2989,132 @@ static const struct of_device_id flir_boson_dt_ids[] = {
 };
 MODULE_DEVICE_TABLE(of, flir_boson_dt_ids);
 
+/*
+ * System sleep: the stream is stopped and the camera goes to standby
+ * through the runtime PM callbacks. The shadow cache is the journal of
+ * what the driver applied; resume reads the camera's uptime to tell a
+ * camera that kept power from one that rebooted, and only the latter gets
+ * its settings read back and the lost ones replayed. No S_FMT, no FFC.
+ */
+static int __maybe_unused flir_boson_system_suspend(struct device *dev)
+{
+	struct v4l2_subdev    *sd     = dev_get_drvdata(dev);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+
+	flir_boson_cmd_queue_flush(sensor);
+	cancel_delayed_work_sync(&sensor->ffc_work);
+	cancel_delayed_work_sync(&sensor->stats_work);
+	cancel_delayed_work_sync(&sensor->health_work);
+	cancel_delayed_work_sync(&sensor->snapshot_work);
+
+	mutex_lock(&sensor->lock);
+	/* A snapshot still in the camera is lost, the application asks again */
+	sensor->snapshot_start = 0;
+	sensor->resume_streaming = sensor->streaming;
+	sensor->resume_standby   = pm_runtime_suspended(dev);
+	/* Unknown uptime makes resume check every setting */
+	if (flir_boson_get_int_val(sensor, SYSCTRL_GETUPTIMESECS, &sensor->suspend_uptime) != R_SUCCESS)
+		sensor->suspend_uptime = U32_MAX;
+	mutex_unlock(&sensor->lock);
+	flir_boson_event(sensor, FLIR_EVENT_STATE, "system suspend, streaming %u, standby %u", sensor->resume_streaming,
+			 sensor->resume_standby);
+
+	return pm_runtime_force_suspend(dev);
+}
+
+/* Called with sensor->lock held, before the runtime resume powers the camera back on */
+static void __maybe_unused flir_boson_resume_restore(struct flir_boson_dev *sensor)
+{
+	ktime_t start = ktime_get();
+	unsigned int sent;
+	FLR_RESULT ret;
+	u32 uptime;
+
+	/* A camera that lost power is still booting, one that kept it answers at once */
+	if (flir_boson_wait_ready(sensor)) {
+		dev_err(sensor->dev, "Camera did not answer after resume within %d ms\n", FLIR_BOSON_BOOT_TIMEOUT_MS);
+		return;
+	}
+	if (flir_boson_get_int_val(sensor, SYSCTRL_GETUPTIMESECS, &uptime) == R_SUCCESS && uptime >= sensor->suspend_uptime) {
+		flir_boson_event(sensor, FLIR_EVENT_STATE, "camera kept its state during suspend, up %u s", uptime);
+		return;
+	}
+
+	/* Power-on and stream-on set the operating mode and MIPI state themselves */
+	ret = flir_boson_shadow_restore(sensor, BIT(FLIR_SHADOW_MIPI_STATE) | BIT(FLIR_SHADOW_OPERATING_MODE), &sent);
+	sensor->agc_dirty      = GENMASK(FLIR_AGC_NUM - 1, 0);
+	sensor->jitter_dirty   = sensor->jitter_ctrl != NULL;
+	sensor->isotherm_dirty = sensor->isotherm_ctrl != NULL;
+	sensor->zoom_dirty     = sensor->crop.width != sensor->sensor_width;
+	/* A rebooted camera draws no symbols, redraw the enabled ones */
+	sensor->crosshair_shown = false;
+	sensor->text_shown      = false;
+	sensor->overlay_dirty   = sensor->crosshair_ctrl != NULL;
+	if (ret != R_SUCCESS) {
+		dev_warn(sensor->dev, "Could not restore the configuration after resume: %s\n", flr_result_to_string(ret));
+		return;
+	}
+	/* It booted in normal imaging; a camera that stays in standby goes back to low power */
+	if (sensor->resume_standby)
+		flir_boson_power_off(sensor);
+
+	flir_boson_event(sensor, FLIR_EVENT_STATE, "camera restarted during suspend, %u settings replayed in %u ms", sent,
+			 (u32)ktime_ms_delta(ktime_get(), start));
+}
+
+static int __maybe_unused flir_boson_system_resume(struct device *dev)
+{
+	struct v4l2_subdev    *sd     = dev_get_drvdata(dev);
+	struct flir_boson_dev *sensor = to_flir_boson_dev(sd);
+	FLR_RESULT             ret    = R_SUCCESS;
+	int                    err;
+
+	/* A failed restore still resumes, power-on then reports what the camera refuses */
+	mutex_lock(&sensor->lock);
+	flir_boson_resume_restore(sensor);
+	mutex_unlock(&sensor->lock);
+
+	err = pm_runtime_force_resume(dev);
+	if (err)
+		return err;
+
+	/* The stream-on runtime PM reference is still held, only MIPI needs restarting */
+	if (sensor->resume_streaming) {
+		mutex_lock(&sensor->lock);
+		if (!sensor->powered)
+			ret = flir_boson_power_on(sensor);
+		if (ret == R_SUCCESS && !sensor->streaming)
+			ret = flir_boson_start_mipi(sensor);
+		mutex_unlock(&sensor->lock);
+		if (ret != R_SUCCESS) {
+			dev_err(sensor->dev, "Failed to restart streaming after resume: %s\n", flr_result_to_string(ret));
+			return flr_result_to_errno(ret);
+		}
+		if (atomic_read(&sensor->ffc_subscribers)) {
+			sensor->ffc_status = FLR_BOSON_FFCSTATUS_END;
+			schedule_delayed_work(&sensor->ffc_work, 0);
+		}
+		schedule_delayed_work(&sensor->stats_work, 0);
+	}
+	schedule_delayed_work(&sensor->health_work, 0);
+
+	return 0;
+}
+
+static const struct dev_pm_ops flir_boson_pm_ops = {
+	SET_SYSTEM_SLEEP_PM_OPS(flir_boson_system_suspend, flir_boson_system_resume)
+	SET_RUNTIME_PM_OPS(flir_boson_runtime_suspend, flir_boson_runtime_resume, NULL)
+};
+
 /* Hardware Mode: I2C Driver */
 static struct i2c_driver flir_boson_i2c_driver = {
     .driver =
         {
             .name           = "flir_boson",
 		.of_match_table = flir_boson_dt_ids,
+		/* Boson boot takes seconds; don't serialize it with other devices */
+		.probe_type     = PROBE_PREFER_ASYNCHRONOUS,
+		.pm             = &flir_boson_pm_ops,
 	},
 	.id_table = flir_boson_id,
     .probe    = flir_boson_probe,
@@ -822,12 +3123,20 @@ static struct i2c_driver flir_boson_i2c_driver = {
 
 static int __init flir_boson_driver_init(void) {
 
-	pr_info("FLIR Boson+ Driver: Starting in HARDWARE MODE\n");
-	return i2c_add_driver(&flir_boson_i2c_driver);
+	int ret;
+
+	flir_boson_debugfs_register();
+	ret = i2c_add_driver(&flir_boson_i2c_driver);
+	if (ret)
+		flir_boson_debugfs_unregister();
+	return ret;
 }
 module_init(flir_boson_driver_init);
 
-static void __exit flir_boson_driver_exit(void) { i2c_del_driver(&flir_boson_i2c_driver); }
+static void __exit flir_boson_driver_exit(void) {
+	i2c_del_driver(&flir_boson_i2c_driver);
+	flir_boson_debugfs_unregister();
+}
 module_exit(flir_boson_driver_exit);
 
 MODULE_DESCRIPTION("FLIR Boson+ MIPI Camera V4L2 Driver");
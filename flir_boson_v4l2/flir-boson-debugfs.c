@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: MIT
+/*
+ * FLIR Boson+ debugfs interface
+ * Copyright (C) 2026, VideologyInc
+ *
+ * Layout:
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/commands   per function code stats
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/i2c_xfers  I2C transactions issued
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/shadow_hits  setters skipped by the shadow cache
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/async_failures  queued commands that failed
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/stream_latency  s_stream on/off latency
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/i2c_throughput  bus clock, limits and measured throughput
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/fslp_recovery  transport resyncs, drained responses and replays
+ *   /sys/kernel/debug/flir-boson/<i2c-dev>/events  last FLIR_EVENT_RING driver events, oldest first
+ */
+
+#include <linux/atomic.h>
+#include <linux/debugfs.h>
+#include <linux/ktime.h>
+#include <linux/seq_file.h>
+#include <linux/types.h>
+#include "flir-boson.h"
+
+static struct dentry *flir_boson_debugfs_root;
+
+/* Upper bound in microseconds of the latency bucket holding the 99th percentile */
+static u32 flir_stats_p99_us(const struct flir_cmd_stats *st, u64 calls)
+{
+	u64 target = calls - calls / 100;
+	u64 seen = 0;
+	int i;
+
+	for (i = 0; i < FLIR_STATS_LAT_BUCKETS; i++) {
+		seen += READ_ONCE(st->lat_hist[i]);
+		if (seen >= target)
+			break;
+	}
+
+	if (i >= FLIR_STATS_LAT_BUCKETS - 1)
+		return READ_ONCE(st->lat_max_us);
+
+	return min_t(u32, i ? (1U << i) - 1 : 0, READ_ONCE(st->lat_max_us));
+}
+
+static int flir_boson_commands_show(struct seq_file *m, void *unused)
+{
+	struct flir_boson_dev *sensor = m->private;
+	const struct flir_cmd_stats *st;
+	u64 calls;
+	int i;
+
+	seq_printf(m, "%-10s %10s %8s %8s %8s %10s %10s %10s %10s\n", "fn_id", "calls", "failed", "retries", "mismatch", "min_us", "avg_us",
+		   "max_us", "p99_us");
+
+	for (i = 0; i < FLIR_STATS_SLOTS; i++) {
+		st = &sensor->cmd_stats[i];
+		calls = READ_ONCE(st->calls);
+		if (!READ_ONCE(st->fn_id) || !calls)
+			continue;
+
+		seq_printf(m, "0x%08X %10llu %8llu %8llu %8llu %10u %10llu %10u %10u\n", st->fn_id, calls, READ_ONCE(st->failures),
+			   READ_ONCE(st->retries), READ_ONCE(st->mismatches), READ_ONCE(st->lat_min_us), div64_u64(READ_ONCE(st->lat_sum_us), calls),
+			   READ_ONCE(st->lat_max_us), flir_stats_p99_us(st, calls));
+	}
+
+	if (sensor->cmd_stats_dropped)
+		seq_printf(m, "dropped: %u (no free slot)\n", sensor->cmd_stats_dropped);
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(flir_boson_commands);
+
+static void flir_stream_stats_show(struct seq_file *m, const char *name, const struct flir_stream_stats *st)
+{
+	u64 count = READ_ONCE(st->count);
+
+	seq_printf(m, "%-4s %10llu %10u %10u %10llu %10u\n", name, count, READ_ONCE(st->last_us), READ_ONCE(st->min_us),
+		   count ? div64_u64(READ_ONCE(st->sum_us), count) : 0, READ_ONCE(st->max_us));
+}
+
+static int flir_boson_stream_latency_show(struct seq_file *m, void *unused)
+{
+	struct flir_boson_dev *sensor = m->private;
+
+	seq_printf(m, "%-4s %10s %10s %10s %10s %10s\n", "", "count", "last_us", "min_us", "avg_us", "max_us");
+	flir_stream_stats_show(m, "on", &sensor->stream_on_stats);
+	flir_stream_stats_show(m, "off", &sensor->stream_off_stats);
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(flir_boson_stream_latency);
+
+static int flir_boson_i2c_throughput_show(struct seq_file *m, void *unused)
+{
+	struct flir_boson_dev *sensor = m->private;
+	u64 bytes = READ_ONCE(sensor->i2c_bytes);
+	u64 busy_us = div_u64(READ_ONCE(sensor->i2c_busy_ns), NSEC_PER_USEC);
+
+	seq_printf(m, "bus_clock_hz:   %u\n", sensor->i2c_bus_hz);
+	seq_printf(m, "max_read_len:   %u\n", sensor->i2c_max_read);
+	seq_printf(m, "max_write_len:  %u\n", sensor->i2c_max_write);
+	seq_printf(m, "bytes:          %llu\n", bytes);
+	seq_printf(m, "busy_us:        %llu\n", busy_us);
+	/* Payload rate while the bus is in use, includes addressing and ACK overhead */
+	seq_printf(m, "throughput_Bps: %llu\n", busy_us ? div64_u64(bytes * USEC_PER_SEC, busy_us) : 0);
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(flir_boson_i2c_throughput);
+
+static int flir_boson_fslp_recovery_show(struct seq_file *m, void *unused)
+{
+	const struct flir_fslp_recovery *rec = &((struct flir_boson_dev *)m->private)->fslp_recovery;
+
+	seq_printf(m, "resyncs:        %u\n", READ_ONCE(rec->resyncs));
+	seq_printf(m, "stale_drops:    %u\n", READ_ONCE(rec->stale_drops));
+	seq_printf(m, "replays:        %u\n", READ_ONCE(rec->replays));
+	seq_printf(m, "recovered:      %u\n", READ_ONCE(rec->recovered));
+	seq_printf(m, "flush_failures: %u\n", READ_ONCE(rec->flush_failures));
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(flir_boson_fslp_recovery);
+
+/**
+ * __flir_boson_event - Record a driver event, use flir_boson_event()
+ * @sensor: FLIR sensor device
+ * @type: event class
+ * @fmt: format string literal, kept by pointer
+ * @args: FLIR_EVENT_ARGS arguments of @fmt
+ *
+ * Lock-free: each writer claims its own slot by sequence number. A slot
+ * carries seq 0 while it is filled, so a reader copying it concurrently
+ * discards it rather than printing a torn event.
+ */
+void __flir_boson_event(struct flir_boson_dev *sensor, enum flir_event_type type, const char *fmt, const u32 *args)
+{
+	u32 seq = atomic_inc_return(&sensor->event_head);
+	struct flir_event *ev = &sensor->events[seq & (FLIR_EVENT_RING - 1)];
+	int i;
+
+	WRITE_ONCE(ev->seq, 0);
+	smp_wmb();
+	ev->ts_ns = ktime_get_ns();
+	ev->fmt = fmt;
+	ev->type = type;
+	for (i = 0; i < FLIR_EVENT_ARGS; i++)
+		ev->args[i] = args[i];
+	smp_wmb();
+	WRITE_ONCE(ev->seq, seq);
+}
+
+static const char *const flir_event_names[] = {
+	[FLIR_EVENT_CONFIG] = "config",
+	[FLIR_EVENT_FFC] = "ffc",
+	[FLIR_EVENT_ERROR] = "error",
+	[FLIR_EVENT_STATE] = "state",
+};
+
+static int flir_boson_events_show(struct seq_file *m, void *unused)
+{
+	struct flir_boson_dev *sensor = m->private;
+	u32 head = atomic_read(&sensor->event_head);
+	u32 seq = head > FLIR_EVENT_RING ? head - FLIR_EVENT_RING + 1 : 1;
+	struct flir_event ev;
+	u64 secs;
+	u32 rem_ns;
+
+	if (seq > 1)
+		seq_printf(m, "(%u older events overwritten)\n", seq - 1);
+
+	for (; seq && seq <= head; seq++) {
+		const struct flir_event *slot = &sensor->events[seq & (FLIR_EVENT_RING - 1)];
+
+		if (READ_ONCE(slot->seq) != seq)
+			continue;
+		smp_rmb();
+		ev = *slot;
+		smp_rmb();
+		if (READ_ONCE(slot->seq) != seq || ev.type >= ARRAY_SIZE(flir_event_names))
+			continue;
+
+		secs = div_u64_rem(ev.ts_ns, NSEC_PER_SEC, &rem_ns);
+		seq_printf(m, "%5llu.%06u %-6s ", secs, rem_ns / NSEC_PER_USEC, flir_event_names[ev.type]);
+		seq_printf(m, ev.fmt, ev.args[0], ev.args[1], ev.args[2]);
+		seq_putc(m, '\n');
+	}
+
+	return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(flir_boson_events);
+
+/**
+ * flir_boson_debugfs_init - Create the per-sensor debugfs directory
+ * @sensor: FLIR sensor device
+ *
+ * Failures are not fatal; debugfs helpers accept error pointers.
+ */
+void flir_boson_debugfs_init(struct flir_boson_dev *sensor)
+{
+	sensor->debugfs = debugfs_create_dir(dev_name(sensor->dev), flir_boson_debugfs_root);
+
+	debugfs_create_file("commands", 0444, sensor->debugfs, sensor, &flir_boson_commands_fops);
+	debugfs_create_u32("i2c_xfers", 0444, sensor->debugfs, &sensor->i2c_xfer_count);
+	debugfs_create_u32("shadow_hits", 0444, sensor->debugfs, &sensor->shadow_hits);
+	debugfs_create_u32("async_failures", 0444, sensor->debugfs, &sensor->async_failures);
+	debugfs_create_file("stream_latency", 0444, sensor->debugfs, sensor, &flir_boson_stream_latency_fops);
+	debugfs_create_file("i2c_throughput", 0444, sensor->debugfs, sensor, &flir_boson_i2c_throughput_fops);
+	debugfs_create_file("fslp_recovery", 0444, sensor->debugfs, sensor, &flir_boson_fslp_recovery_fops);
+	debugfs_create_file("events", 0444, sensor->debugfs, sensor, &flir_boson_events_fops);
+}
+
+void flir_boson_debugfs_cleanup(struct flir_boson_dev *sensor)
+{
+	debugfs_remove_recursive(sensor->debugfs);
+	sensor->debugfs = NULL;
+}
+
+/* Module-wide root directory, created from module init */
+void flir_boson_debugfs_register(void)
+{
+	flir_boson_debugfs_root = debugfs_create_dir("flir-boson", NULL);
+}
+
+void flir_boson_debugfs_unregister(void)
+{
+	debugfs_remove_recursive(flir_boson_debugfs_root);
+	flir_boson_debugfs_root = NULL;
+}
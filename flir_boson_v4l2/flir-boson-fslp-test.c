@@ -0,0 +1,446 @@
+// SPDX-License-Identifier: MIT
+/*
+ * KUnit tests and microbenchmark for the FLIR Boson FSLP transport
+ * Copyright (C) 2026, VideologyInc
+ *
+ * Included at the end of flir-boson-fslp.c so the static framing and
+ * dispatcher helpers are reachable. A fake I2C adapter plays the camera:
+ * it answers every command frame with an FSLP response and can be told to
+ * delay it, prefix garbage, queue a stale or short response, answer a
+ * getter without data, or answer with a wrong sequence number.
+ *
+ * Build with CONFIG_FLIR_BOSON_KUNIT_TEST=y, or out of tree with
+ * "make FLIR_BOSON_KUNIT=1", which defines FLIR_BOSON_KUNIT; the suite runs when the module is loaded.
+ */
+
+#include <kunit/test.h>
+
+#if LINUX_VERSION_CODE < KERNEL_VERSION(6, 1, 0)
+#error "The FSLP KUnit suite needs Linux 6.1 or later (KUNIT_EXPECT_MEMEQ)"
+#endif
+
+#define FAKE_TX_SIZE     (4 * (FLIR_FSLP_HEADER_SIZE + FLIR_FSLP_MAX_DATA))
+#define FAKE_GARBAGE     0x5A
+#define FSLP_BENCH_CMDS  1000
+
+/* Camera side of the bus, plus the faults to inject into the next response */
+struct flir_fake_boson {
+	struct i2c_adapter adap;
+	u8 tx[FAKE_TX_SIZE]; /* bytes the camera will stream out */
+	u32 tx_len;
+	u32 tx_pos;
+	u8 last_write[FLIR_FSLP_HEADER_SIZE + FLIR_FSLP_MAX_DATA];
+	u32 last_write_len;
+	u32 value; /* returned by every getter */
+
+	/* Fault injection, consumed by the next command */
+	unsigned int not_ready; /* reads answered idle before the response shows up */
+	unsigned int garbage;   /* stray bytes in front of the response */
+	bool stale;             /* a late response to the previous sequence first */
+	bool short_frame;       /* a truncated frame first */
+	bool wrong_seq;         /* answer with a sequence number from the future */
+	bool no_data;           /* a getter answers with the status only */
+
+	unsigned int writes;
+	unsigned int reads;
+	unsigned int commands;
+};
+
+static void fake_put_frame(struct flir_fake_boson *fake, u32 seq, u32 fn_id, const u8 *data, u32 len)
+{
+	u8 *p = &fake->tx[fake->tx_len];
+
+	*p++ = FLIR_MAGIC_TOKEN_0;
+	*p++ = FLIR_MAGIC_TOKEN_1;
+	*p++ = (12 + len) >> 8;
+	*p++ = (12 + len) & 0xff;
+	UINT32_ToBytes(seq, p);
+	UINT32_ToBytes(fn_id, p + 4);
+	UINT32_ToBytes(R_SUCCESS, p + 8);
+	memcpy(p + 12, data, len);
+	fake->tx_len += FLIR_FSLP_HEADER_SIZE + 12 + len;
+}
+
+/* Getters (no command data) answer with fake->value, setters with no data */
+static void fake_handle_command(struct flir_fake_boson *fake, const u8 *frame, u32 len)
+{
+	u32 seq = byteToUINT32(frame + FLIR_FSLP_HEADER_SIZE);
+	u32 fn_id = byteToUINT32(frame + FLIR_FSLP_HEADER_SIZE + 4);
+	bool is_get = len == FLIR_FSLP_HEADER_SIZE + 12;
+	u8 val[4];
+
+	fake->commands++;
+	UINT32_ToBytes(fake->value, val);
+
+	/* A new command replaces whatever was still queued */
+	memset(fake->tx, FAKE_GARBAGE, fake->garbage);
+	fake->tx_len = fake->garbage;
+	fake->tx_pos = 0;
+	fake->garbage = 0;
+
+	if (fake->stale) {
+		fake_put_frame(fake, seq - 1, fn_id, val, is_get ? 4 : 0);
+		fake->stale = false;
+	}
+	if (fake->short_frame) {
+		/* Sequence and function only, zero-padded to the host's read-ahead */
+		u8 *p = &fake->tx[fake->tx_len];
+		u32 pad = FLIR_FSLP_HEADER_SIZE + 12 + (is_get ? 4 : 0);
+
+		memset(p, 0, pad);
+		p[0] = FLIR_MAGIC_TOKEN_0;
+		p[1] = FLIR_MAGIC_TOKEN_1;
+		p[3] = 8;
+		UINT32_ToBytes(seq, p + 4);
+		UINT32_ToBytes(fn_id, p + 8);
+		fake->tx_len += pad;
+		fake->short_frame = false;
+	}
+	if (fake->wrong_seq) {
+		seq += 0x1000;
+		fake->wrong_seq = false;
+	}
+	fake_put_frame(fake, seq, fn_id, val, is_get && !fake->no_data ? 4 : 0);
+	fake->no_data = false;
+}
+
+static int fake_xfer(struct i2c_adapter *adap, struct i2c_msg *msgs, int num)
+{
+	struct flir_fake_boson *fake = container_of(adap, struct flir_fake_boson, adap);
+	int i;
+	u32 n;
+
+	for (i = 0; i < num; i++) {
+		struct i2c_msg *msg = &msgs[i];
+
+		if (!(msg->flags & I2C_M_RD)) {
+			fake->writes++;
+			fake->last_write_len = min_t(u32, msg->len, sizeof(fake->last_write));
+			memcpy(fake->last_write, msg->buf, fake->last_write_len);
+			if (msg->len >= FLIR_FSLP_HEADER_SIZE + 12 && msg->buf[0] == FLIR_MAGIC_TOKEN_0 && msg->buf[1] == FLIR_MAGIC_TOKEN_1)
+				fake_handle_command(fake, msg->buf, msg->len);
+			continue;
+		}
+
+		fake->reads++;
+		if (fake->not_ready) {
+			fake->not_ready--;
+			memset(msg->buf, 0xFF, msg->len);
+			continue;
+		}
+		/* The TX buffer streams across reads and reads back 0xFF once drained */
+		n = min_t(u32, msg->len, fake->tx_len - fake->tx_pos);
+		memcpy(msg->buf, &fake->tx[fake->tx_pos], n);
+		memset(msg->buf + n, 0xFF, msg->len - n);
+		fake->tx_pos += n;
+	}
+
+	return num;
+}
+
+static u32 fake_functionality(struct i2c_adapter *adap)
+{
+	return I2C_FUNC_I2C;
+}
+
+static const struct i2c_algorithm fake_algo = {
+	.master_xfer   = fake_xfer,
+	.functionality = fake_functionality,
+};
+
+struct flir_fslp_test_ctx {
+	struct flir_fake_boson *fake;
+	struct flir_boson_dev *sensor;
+	struct i2c_client *client;
+};
+
+static int flir_fslp_test_init(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx;
+
+	ctx = kunit_kzalloc(test, sizeof(*ctx), GFP_KERNEL);
+	KUNIT_ASSERT_NOT_NULL(test, ctx);
+	ctx->fake = kunit_kzalloc(test, sizeof(*ctx->fake), GFP_KERNEL);
+	ctx->sensor = kunit_kzalloc(test, sizeof(*ctx->sensor), GFP_KERNEL);
+	ctx->client = kunit_kzalloc(test, sizeof(*ctx->client), GFP_KERNEL);
+	KUNIT_ASSERT_NOT_NULL(test, ctx->fake);
+	KUNIT_ASSERT_NOT_NULL(test, ctx->sensor);
+	KUNIT_ASSERT_NOT_NULL(test, ctx->client);
+
+	ctx->fake->adap.owner = THIS_MODULE;
+	ctx->fake->adap.algo  = &fake_algo;
+	strscpy(ctx->fake->adap.name, "flir-boson-fake", sizeof(ctx->fake->adap.name));
+	KUNIT_ASSERT_EQ(test, i2c_add_adapter(&ctx->fake->adap), 0);
+
+	/* Never registered, so no driver can bind to it */
+	ctx->client->adapter = &ctx->fake->adap;
+	ctx->client->addr    = 0x6a;
+
+	ctx->sensor->i2c_client = ctx->client;
+	ctx->sensor->dev        = &ctx->fake->adap.dev;
+	mutex_init(&ctx->sensor->lock);
+	ctx->fake->value = 0x12345678;
+
+	test->priv = ctx;
+	return 0;
+}
+
+static void flir_fslp_test_exit(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+
+	i2c_del_adapter(&ctx->fake->adap);
+	mutex_destroy(&ctx->sensor->lock);
+}
+
+static void flir_fslp_test_send_frame(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	static const u8 payload[] = { 0xde, 0xad, 0xbe, 0xef, 0x01 };
+
+	KUNIT_ASSERT_EQ(test, flir_fslp_send_frame(ctx->sensor, payload, sizeof(payload)), 0);
+	KUNIT_EXPECT_EQ(test, ctx->fake->writes, 1U);
+	KUNIT_ASSERT_EQ(test, ctx->fake->last_write_len, (u32)(FLIR_FSLP_HEADER_SIZE + sizeof(payload)));
+	KUNIT_EXPECT_EQ(test, ctx->fake->last_write[0], FLIR_MAGIC_TOKEN_0);
+	KUNIT_EXPECT_EQ(test, ctx->fake->last_write[1], FLIR_MAGIC_TOKEN_1);
+	KUNIT_EXPECT_EQ(test, ctx->fake->last_write[2], 0);
+	KUNIT_EXPECT_EQ(test, ctx->fake->last_write[3], (u8)sizeof(payload));
+	KUNIT_EXPECT_MEMEQ(test, &ctx->fake->last_write[FLIR_FSLP_HEADER_SIZE], payload, sizeof(payload));
+
+	KUNIT_EXPECT_EQ(test, flir_fslp_send_frame(ctx->sensor, payload, FLIR_FSLP_MAX_DATA + 1), -EINVAL);
+}
+
+static void flir_fslp_test_read_frame(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u8 *payload = ctx->sensor->fslp_resp_buf;
+
+	fake_put_frame(ctx->fake, 7, BOSON_GETCAMERASN, (const u8 *)"\x00\x00\x00\x2a", 4);
+
+	/* Header and expected payload arrive in a single transaction */
+	KUNIT_EXPECT_EQ(test, flir_fslp_read_frame(ctx->sensor, payload, 16), 16);
+	KUNIT_EXPECT_EQ(test, ctx->fake->reads, 1U);
+	KUNIT_EXPECT_EQ(test, byteToUINT32(payload), 7U);
+	KUNIT_EXPECT_EQ(test, byteToUINT32(payload + 12), 42U);
+
+	/* Drained buffer reads back idle */
+	KUNIT_EXPECT_EQ(test, flir_fslp_read_frame(ctx->sensor, payload, 16), -EAGAIN);
+}
+
+static void flir_fslp_test_read_frame_overflow(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+
+	fake_put_frame(ctx->fake, 1, BOSON_GETCAMERASN, (const u8 *)"\x00\x00\x00\x2a", 4);
+
+	/* Read-ahead too small: a second read fetches the rest */
+	KUNIT_EXPECT_EQ(test, flir_fslp_read_frame(ctx->sensor, ctx->sensor->fslp_resp_buf, 12), 16);
+	KUNIT_EXPECT_EQ(test, ctx->fake->reads, 2U);
+	KUNIT_EXPECT_EQ(test, byteToUINT32(ctx->sensor->fslp_resp_buf + 12), 42U);
+}
+
+static void flir_fslp_test_get_int(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val = 0;
+
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, val, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->writes, 1U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->reads, 1U);
+	KUNIT_EXPECT_FALSE(test, ctx->sensor->rx_dirty);
+}
+
+static void flir_fslp_test_set_int(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+
+	KUNIT_EXPECT_EQ(test, flir_boson_send_int_cmd(ctx->sensor, BOSON_SETFFCMODE, FLR_BOSON_MANUAL_FFC, 0), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, ctx->fake->last_write_len, (u32)(FLIR_FSLP_HEADER_SIZE + 16));
+	KUNIT_EXPECT_EQ(test, byteToUINT32(&ctx->fake->last_write[FLIR_FSLP_HEADER_SIZE + 4]), (u32)BOSON_SETFFCMODE);
+	KUNIT_EXPECT_EQ(test, byteToUINT32(&ctx->fake->last_write[FLIR_FSLP_HEADER_SIZE + 12]), (u32)FLR_BOSON_MANUAL_FFC);
+}
+
+static void flir_fslp_test_delayed_response(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val = 0;
+
+	ctx->fake->not_ready = 3;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, val, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->reads, 4U);
+}
+
+static void flir_fslp_test_timeout(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val;
+
+	ctx->fake->not_ready = UINT_MAX;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), FLR_COMM_TIMEOUT_ERROR);
+	/* A busy camera is not asked again */
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.replays, 0U);
+	KUNIT_EXPECT_TRUE(test, ctx->sensor->rx_dirty);
+}
+
+static void flir_fslp_test_garbage_resync(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val = 0;
+
+	ctx->fake->garbage = 5;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, val, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.resyncs, 1U);
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.replays, 0U);
+}
+
+static void flir_fslp_test_stale_drain(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val = 0;
+
+	ctx->fake->stale = true;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.stale_drops, 1U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->commands, 1U);
+}
+
+static void flir_fslp_test_short_response(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val = 0;
+
+	ctx->fake->short_frame = true;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, val, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->commands, 1U);
+}
+
+static void flir_fslp_test_no_data(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	struct flir_boson_batch_entry e;
+	u8 buf[4] = { 0 };
+	u32 val = 0;
+
+	/* Leave a full answer in the response buffer first */
+	KUNIT_ASSERT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+
+	ctx->fake->value = 0x0badf00d;
+	ctx->fake->no_data = true;
+	val = 0;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SDK_DSPCH_MALFORMED_STATUS);
+	KUNIT_EXPECT_EQ(test, val, 0U);
+
+	/* The raw length reaches the caller, nothing of the earlier reply is copied */
+	memset(&e, 0, sizeof(e));
+	e.fn_id      = BOSON_GETCAMERASN;
+	e.recv_data  = buf;
+	e.recv_bytes = sizeof(buf);
+	ctx->fake->no_data = true;
+	mutex_lock(&ctx->sensor->lock);
+	KUNIT_EXPECT_EQ(test, flir_boson_send_batch(ctx->sensor, &e, 1), R_SUCCESS);
+	mutex_unlock(&ctx->sensor->lock);
+	KUNIT_EXPECT_EQ(test, e.recv_bytes, 0U);
+	KUNIT_EXPECT_EQ(test, byteToUINT32(buf), 0U);
+}
+
+static void flir_fslp_test_mismatch_replay(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 val = 0;
+
+	ctx->fake->wrong_seq = true;
+	KUNIT_EXPECT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	KUNIT_EXPECT_EQ(test, val, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->commands, 2U);
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.replays, 1U);
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.recovered, 1U);
+}
+
+static void flir_fslp_test_no_replay(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+
+	/* FFC may already have run; it must not run twice */
+	ctx->fake->wrong_seq = true;
+	KUNIT_EXPECT_EQ(test, flir_boson_send_void_cmd(ctx->sensor, BOSON_RUNFFC, 0), R_SDK_DSPCH_SEQUENCE_MISMATCH);
+	KUNIT_EXPECT_EQ(test, ctx->fake->commands, 1U);
+	KUNIT_EXPECT_EQ(test, ctx->sensor->fslp_recovery.replays, 0U);
+}
+
+static void flir_fslp_test_batch(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	struct flir_boson_batch_entry batch[3];
+	u32 a = 0, b = 0;
+
+	flir_boson_batch_get_int(&batch[0], BOSON_GETCAMERASN, &a);
+	flir_boson_batch_set_int(&batch[1], BOSON_SETFFCMODE, FLR_BOSON_AUTO_FFC);
+	flir_boson_batch_get_int(&batch[2], BOSON_GETFFCMODE, &b);
+
+	mutex_lock(&ctx->sensor->lock);
+	KUNIT_EXPECT_EQ(test, flir_boson_send_batch(ctx->sensor, batch, ARRAY_SIZE(batch)), R_SUCCESS);
+	mutex_unlock(&ctx->sensor->lock);
+
+	KUNIT_EXPECT_EQ(test, a, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, b, 0x12345678U);
+	KUNIT_EXPECT_EQ(test, ctx->fake->commands, 3U);
+	/* One write and one read per command, no RX flush in between */
+	KUNIT_EXPECT_EQ(test, ctx->fake->reads, 3U);
+}
+
+/* Reports commands/sec and I2C transactions per command for a clean bus */
+static void flir_fslp_test_bench(struct kunit *test)
+{
+	struct flir_fslp_test_ctx *ctx = test->priv;
+	u32 xfers = ctx->sensor->i2c_xfer_count;
+	u64 bytes = ctx->sensor->i2c_bytes;
+	ktime_t start;
+	s64 ns;
+	u32 val;
+	int i;
+
+	start = ktime_get();
+	for (i = 0; i < FSLP_BENCH_CMDS; i++)
+		KUNIT_ASSERT_EQ(test, flir_boson_get_int_val(ctx->sensor, BOSON_GETCAMERASN, &val), R_SUCCESS);
+	ns = ktime_to_ns(ktime_sub(ktime_get(), start));
+
+	xfers = ctx->sensor->i2c_xfer_count - xfers;
+	bytes = ctx->sensor->i2c_bytes - bytes;
+	kunit_info(test, "%d commands in %lld us: %llu cmd/s, %u.%02u I2C transactions/cmd, %llu bytes/cmd\n", FSLP_BENCH_CMDS,
+		   div_s64(ns, NSEC_PER_USEC), ns ? div64_u64((u64)FSLP_BENCH_CMDS * NSEC_PER_SEC, ns) : 0, xfers / FSLP_BENCH_CMDS,
+		   (xfers % FSLP_BENCH_CMDS) * 100 / FSLP_BENCH_CMDS, div_u64(bytes, FSLP_BENCH_CMDS));
+
+	/* Regression guard: the clean path is one write and one read-ahead */
+	KUNIT_EXPECT_EQ(test, xfers, 2U * FSLP_BENCH_CMDS);
+}
+
+static struct kunit_case flir_fslp_test_cases[] = {
+	KUNIT_CASE(flir_fslp_test_send_frame),
+	KUNIT_CASE(flir_fslp_test_read_frame),
+	KUNIT_CASE(flir_fslp_test_read_frame_overflow),
+	KUNIT_CASE(flir_fslp_test_get_int),
+	KUNIT_CASE(flir_fslp_test_set_int),
+	KUNIT_CASE(flir_fslp_test_delayed_response),
+	KUNIT_CASE(flir_fslp_test_timeout),
+	KUNIT_CASE(flir_fslp_test_garbage_resync),
+	KUNIT_CASE(flir_fslp_test_stale_drain),
+	KUNIT_CASE(flir_fslp_test_short_response),
+	KUNIT_CASE(flir_fslp_test_no_data),
+	KUNIT_CASE(flir_fslp_test_mismatch_replay),
+	KUNIT_CASE(flir_fslp_test_no_replay),
+	KUNIT_CASE(flir_fslp_test_batch),
+	KUNIT_CASE(flir_fslp_test_bench),
+	{}
+};
+
+static struct kunit_suite flir_fslp_test_suite = {
+	.name       = "flir-boson-fslp",
+	.init       = flir_fslp_test_init,
+	.exit       = flir_fslp_test_exit,
+	.test_cases = flir_fslp_test_cases,
+};
+kunit_test_suite(flir_fslp_test_suite);
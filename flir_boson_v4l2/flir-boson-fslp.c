@@ -13,10 +13,66 @@
 #include <linux/types.h>
 #include <linux/byteorder/generic.h>
 #include <linux/delay.h>
+#include <linux/ktime.h>
+#include <linux/moduleparam.h>
+#include <linux/slab.h>
+#include <linux/workqueue.h>
 #include "flir-boson.h"
 #include "ReturnCodes.h"
 #include "FunctionCodes.h"
 
+#define CREATE_TRACE_POINTS
+#include "flir-boson-trace.h"
+
+static bool fslp_poll = true;
+module_param(fslp_poll, bool, 0644);
+MODULE_PARM_DESC(fslp_poll, "Poll for command responses instead of sleeping a fixed delay");
+
+/* Readiness polling: backoff bounds and per-command upper limits */
+#define FLIR_FSLP_POLL_MIN_US     200
+#define FLIR_FSLP_POLL_MAX_US     10000
+#define FLIR_FSLP_POLL_DEFAULT_MS 100
+
+static const struct {
+	u32 fn_id;
+	u32 timeout_ms;
+} flir_fslp_poll_limits[] = {
+	{ DVO_SETTYPE,            500 },
+	{ DVO_SETOUTPUTINTERFACE, 500 },
+	{ DVO_SETMIPISTATE,       1000 },
+	{ DVO_GETCLOCKINFO,       1000 },
+	{ BOSON_RUNFFC,           1000 },
+	{ SYSCTRL_SETOPERATINGMODE, 1000 },
+	{ BOSON_WRITEDYNAMICHEADERTOFLASH, 2000 },
+};
+
+/* Late responses drained before a sequence mismatch fails the command */
+#define FLIR_FSLP_MAX_STALE 4
+
+/*
+ * Commands that must not run twice: the camera may have executed the
+ * first attempt even though its response was lost. The fileOps and
+ * symbology modules are excluded as a whole, they move camera-side
+ * cursors.
+ */
+static const u32 flir_fslp_no_replay[] = {
+	BOSON_RUNFFC,
+	BOSON_REBOOT,
+	BOSON_WRITEDYNAMICHEADERTOFLASH,
+	BOSON_RESTOREFACTORYDEFAULTSFROMFLASH,
+	BOSON_RESTOREFACTORYBADPIXELSFROMFLASH,
+	LATENCYCTRL_LATENCYRESETSTATS,
+	CAPTURE_SINGLEFRAMEWITHSRC,
+};
+
+/* Transport errors are expected while the camera boots; keep them out of dmesg */
+#define flir_comm_err(sensor, fmt, ...)                                 \
+	do {                                                            \
+		if ((sensor)->booting)                                  \
+			dev_dbg((sensor)->dev, fmt, ##__VA_ARGS__);     \
+		else                                                    \
+			dev_err((sensor)->dev, fmt, ##__VA_ARGS__);     \
+	} while (0)
 
 /* ========================================================================
  * Layer 0: Raw I2C Transport
@@ -25,18 +81,39 @@
 /* Hardware Mode: Real I2C Communication */
 static int flir_boson_i2c_write(struct flir_boson_dev *sensor, const u8 *data, size_t len) {
 	struct i2c_msg msg = { .addr=sensor->i2c_client->addr, .flags=0, .len=len, .buf=(u8 *)data};
+	ktime_t start = ktime_get();
 	int ret = 0;
 
+	/* A frame must arrive in one transaction, it cannot be split */
+	if (sensor->i2c_max_write && len > sensor->i2c_max_write) {
+		dev_err(sensor->dev, "Frame of %zu bytes exceeds adapter write limit %u\n", len, sensor->i2c_max_write);
+		return -EMSGSIZE;
+	}
+
 	ret = i2c_transfer(sensor->i2c_client->adapter, &msg, 1);
+	sensor->i2c_xfer_count++;
+	sensor->i2c_bytes   += len;
+	sensor->i2c_busy_ns += ktime_to_ns(ktime_sub(ktime_get(), start));
 
 	return ret == 1 ? 0 : -EIO;
 }
 
+/* The camera streams its TX buffer across reads, so reads split at the adapter limit */
 static int flir_boson_i2c_read(struct flir_boson_dev *sensor, u8 *data, size_t len) {
-	struct i2c_msg msg = {.addr=sensor->i2c_client->addr, .flags=I2C_M_RD, .len=len, .buf=data};
-	int ret = 0;
-
-	ret = i2c_transfer(sensor->i2c_client->adapter, &msg, 1);
+	struct i2c_msg msg = {.addr=sensor->i2c_client->addr, .flags=I2C_M_RD};
+	ktime_t start = ktime_get();
+	size_t done = 0;
+	int ret = 1;
+
+	while (done < len && ret == 1) {
+		msg.buf = data + done;
+		msg.len = sensor->i2c_max_read ? min_t(size_t, len - done, sensor->i2c_max_read) : len - done;
+		ret = i2c_transfer(sensor->i2c_client->adapter, &msg, 1);
+		sensor->i2c_xfer_count++;
+		done += msg.len;
+	}
+	sensor->i2c_bytes   += done;
+	sensor->i2c_busy_ns += ktime_to_ns(ktime_sub(ktime_get(), start));
 
 	return ret == 1 ? 0 : -EIO;
 }
@@ -50,12 +127,24 @@ static void UINT32_ToBytes(u32 inVal, u8 *outBuff)
 	*outPtr = (u8)(inVal & 0xff);
 }
 
+static void UINT16_ToBytes(u16 inVal, u8 *outBuff)
+{
+	outBuff[0] = (u8)(inVal >> 8 & 0xff);
+	outBuff[1] = (u8)(inVal & 0xff);
+}
+
 /* byteToUINT32 - extract big-endian uint32 from buffer */
 static u32 byteToUINT32(const u8 *inBuff)
 {
 	return (inBuff[0] << 24) | (inBuff[1] << 16) | (inBuff[2] << 8) | inBuff[3];
 }
 
+/* byteToUINT16 - extract big-endian uint16 from buffer */
+static u16 byteToUINT16(const u8 *inBuff)
+{
+	return (inBuff[0] << 8) | inBuff[1];
+}
+
 /* ========================================================================
  * Layer 1: I2C FSLP Framing Layer (matches I2CFslp.py exactly)
  * ======================================================================== */
@@ -67,6 +156,9 @@ static u32 byteToUINT32(const u8 *inBuff)
  * @payload: Command payload data (from dispatcher layer)
  * @payload_len: Length of payload data
  *
+ * The frame is assembled in sensor->fslp_tx_buf; @payload may already
+ * point at its payload area.
+ *
  * Implements exact I2CFslp.sendFrame() protocol:
  * - Magic tokens: [0x8E, 0xA1]
  * - Big-endian u16 length (payload only, not including I2C header)
@@ -74,8 +166,9 @@ static u32 byteToUINT32(const u8 *inBuff)
  */
 int flir_fslp_send_frame(struct flir_boson_dev *sensor, const u8 *payload, u32 payload_len)
 {
-	u8 frame_buffer[FLIR_FSLP_MAX_DATA + 4];
+	u8 *frame_buffer = sensor->fslp_tx_buf;
 	u8 *ptr = frame_buffer;
+	int ret;
 
 	if (payload_len > FLIR_FSLP_MAX_DATA) {
 		dev_err(sensor->dev, "Payload too large: %u bytes\n", payload_len);
@@ -88,66 +181,177 @@ int flir_fslp_send_frame(struct flir_boson_dev *sensor, const u8 *payload, u32 p
 	*ptr++ = (u8)(payload_len >> 8);    /* Length high byte (payload only!) */
 	*ptr++ = (u8)(payload_len & 0xff);  /* Length low byte */
 
-	/* Copy payload (command dispatcher data) */
-	memcpy(ptr, payload, payload_len);
+	/* Copy payload (command dispatcher data); the dispatcher builds it in place */
+	memmove(ptr, payload, payload_len);
+
+	ret = flir_boson_i2c_write(sensor, frame_buffer, 4 + payload_len);
+	trace_flir_fslp_send_frame(sensor, payload, payload_len, ret);
+
+	return ret;
+}
+
+/**
+ * flir_fslp_resync - Realign a read that did not start on a frame header
+ * @sensor: FLIR sensor device
+ * @frame: Bytes just read, at least @len
+ * @len: Number of bytes read
+ *
+ * Bytes were lost on the bus, or stray bytes of an earlier response were
+ * still queued. Scan for the magic pair, move the frame to the start of
+ * @frame and read the bytes the shift cut off. The camera streams its TX
+ * buffer across reads, so they simply follow.
+ *
+ * Return: 0 with a header at @frame, -EPROTO if no header was found.
+ */
+static int flir_fslp_resync(struct flir_boson_dev *sensor, u8 *frame, u32 len)
+{
+	u32 off;
+	int ret;
+
+	for (off = 1; off + 1 < len; off++) {
+		if (frame[off] == FLIR_MAGIC_TOKEN_0 && frame[off + 1] == FLIR_MAGIC_TOKEN_1)
+			break;
+	}
+	if (off + 1 >= len) {
+		flir_comm_err(sensor, "Bad FSLP header: %02x %02x\n", frame[0], frame[1]);
+		return -EPROTO;
+	}
+
+	memmove(frame, frame + off, len - off);
+	ret = flir_boson_i2c_read(sensor, frame + len - off, off);
+	if (ret)
+		return ret;
+
+	sensor->fslp_recovery.resyncs++;
+	dev_dbg(sensor->dev, "FSLP resynced, skipped %u bytes\n", off);
+	return 0;
+}
+
+/*
+ * Read the camera's TX buffer until it is idle (0xFFFFFFFF). Bounded by two
+ * frames: a late response may sit behind the remains of a partial one.
+ */
+static int flir_fslp_flush_rx(struct flir_boson_dev *sensor)
+{
+	u32 word;
+	int i, ret;
 
-	// dev_dbg(sensor->dev, "FSLP send: channel=0x%02X, payload_len=%u\n", channel_id, payload_len);
-	// print_hex_dump_debug("FSLP_FRAME: ", DUMP_PREFIX_OFFSET, 16, 1, frame_buffer, 4 + payload_len, true);
+	for (i = 0; i < 2 * (FLIR_FSLP_HEADER_SIZE + FLIR_FSLP_MAX_DATA) / 4; i++) {
+		ret = flir_boson_i2c_read(sensor, (u8 *)&word, sizeof(word));
+		if (ret)
+			return ret;
+		if (word == 0xFFFFFFFF)
+			return 0;
+	}
 
-	return flir_boson_i2c_write(sensor, frame_buffer, 4 + payload_len);
+	return -EPROTO;
 }
 
 /**
  * flir_fslp_read_frame - Read FSLP frame from I2C (matches I2CFslp.readFrame)
  * @sensor: FLIR sensor device
- * @channel_id: Channel ID (0x00 for commands)
- * @payload: Buffer for payload data
+ * @payload: Buffer for payload data (at least FLIR_FSLP_MAX_DATA bytes)
  * @expected_len: Expected payload length
  *
- * Implements exact I2CFslp.readFrame() protocol:
- * - Read 4-byte I2C header (magic + length)
- * - Validate magic tokens
- * - Read payload data based on length
+ * Same wire protocol as I2CFslp.readFrame(), but the 4-byte header
+ * (magic + length) and the expected payload are fetched in a single
+ * read-ahead transaction. The camera streams its TX buffer across reads,
+ * so a second transaction is only issued when the declared length is
+ * larger than what was read ahead.
+ *
+ * Return: declared payload length on success, negative errno on failure.
  */
 int flir_fslp_read_frame(struct flir_boson_dev *sensor, u8 *payload, u32 expected_len) {
-	u8 header[4];
+	u8 *frame = sensor->fslp_rx_buf;
+	u32 readahead = min_t(u32, expected_len, FLIR_FSLP_MAX_DATA);
 	u16 payload_len;
 	int ret = 0;
 
-	/* Read I2C FSLP header (4 bytes) */
-	// dev_dbg(sensor->dev, "FSLP read: reading header (4 bytes)");
-	ret = flir_boson_i2c_read(sensor, &header[0], 1);
-	ret = flir_boson_i2c_read(sensor, &header[1], 1);
-	if (ret || header[1] != FLIR_MAGIC_TOKEN_1) {
-		dev_err(sensor->dev, "Failed to read FSLP header\n");
-		return ret;
-	}
-	ret = flir_boson_i2c_read(sensor, &header[2], 2);
+	/* Header and expected payload in one transaction */
+	ret = flir_boson_i2c_read(sensor, frame, FLIR_FSLP_HEADER_SIZE + readahead);
+	trace_flir_fslp_read_header(sensor, frame, readahead, ret);
 	if (ret) {
-		dev_err(sensor->dev, "Failed to read RX-LEN\n");
+		flir_comm_err(sensor, "Failed to read FSLP frame: %d\n", ret);
 		return ret;
 	}
 
+	/* An idle TX buffer reads back as 0xFF: response not ready yet */
+	if (frame[0] == 0xFF && frame[1] == 0xFF)
+		return -EAGAIN;
+
+	/* Only the second magic byte is checked, as in the original reader */
+	if (frame[1] != FLIR_MAGIC_TOKEN_1) {
+		ret = flir_fslp_resync(sensor, frame, FLIR_FSLP_HEADER_SIZE + readahead);
+		if (ret)
+			return ret;
+	}
+
 	/* get payload length (big-endian) */
-	payload_len = (header[2] << 8) | header[3];
+	payload_len = (frame[2] << 8) | frame[3];
 
-	if (payload_len != expected_len) {
-		// dev_warn(sensor->dev, "Length mismatch: declared %u, expected %u\n", payload_len, expected_len);
+	if (payload_len > FLIR_FSLP_MAX_DATA) {
+		dev_err(sensor->dev, "FSLP payload too large: %u bytes\n", payload_len);
+		return -EMSGSIZE;
 	}
 
-	/* Read payload data */
-	if (payload_len > 0) {
-		// dev_dbg(sensor->dev, "FSLP read: reading payload (%u bytes)", payload_len);
-		ret = flir_boson_i2c_read(sensor, payload, payload_len);
+	/* Overflow: fetch what the read-ahead did not cover */
+	if (payload_len > readahead) {
+		ret = flir_boson_i2c_read(sensor, &frame[FLIR_FSLP_HEADER_SIZE + readahead], payload_len - readahead);
 		if (ret) {
 			dev_err(sensor->dev, "Failed to read FSLP payload: %d\n", ret);
 			return ret;
 		}
-		// print_hex_dump_debug("FSLP_PAYLOAD: ", DUMP_PREFIX_OFFSET, 16, 1, payload, payload_len, true);
 	}
 
-	// dev_dbg(sensor->dev, "FSLP recv: channel=0x%02X, payload_len=%u\n", channel_id, payload_len);
-	return 0;
+	memcpy(payload, &frame[FLIR_FSLP_HEADER_SIZE], payload_len);
+	trace_flir_fslp_read_payload(sensor, payload, payload_len);
+
+	return payload_len;
+}
+
+/**
+ * flir_fslp_wait_frame - Wait for a command response and read it
+ * @sensor: FLIR sensor device
+ * @fn_id: Function ID of the outstanding command
+ * @payload: Buffer for payload data (at least FLIR_FSLP_MAX_DATA bytes)
+ * @expected_len: Expected payload length
+ * @sleep_ms: Caller's worst-case processing delay for this command
+ *
+ * With fslp_poll disabled the caller has already slept @sleep_ms and the
+ * frame is read once. Otherwise the RX buffer is polled with exponential
+ * usleep_range() backoff until a frame shows up, bounded by the larger of
+ * @sleep_ms and the per-command limit in flir_fslp_poll_limits[].
+ *
+ * Return: declared payload length on success, negative errno on failure.
+ */
+static int flir_fslp_wait_frame(struct flir_boson_dev *sensor, u32 fn_id, u8 *payload, u32 expected_len, u32 sleep_ms)
+{
+	u32 limit_ms = FLIR_FSLP_POLL_DEFAULT_MS;
+	unsigned long delay_us = FLIR_FSLP_POLL_MIN_US;
+	ktime_t deadline;
+	int i, ret;
+
+	if (!fslp_poll)
+		return flir_fslp_read_frame(sensor, payload, expected_len);
+
+	for (i = 0; i < ARRAY_SIZE(flir_fslp_poll_limits); i++) {
+		if (flir_fslp_poll_limits[i].fn_id == fn_id) {
+			limit_ms = flir_fslp_poll_limits[i].timeout_ms;
+			break;
+		}
+	}
+	deadline = ktime_add_ms(ktime_get(), max(limit_ms, sleep_ms));
+
+	for (;;) {
+		ret = flir_fslp_read_frame(sensor, payload, expected_len);
+		if (ret != -EAGAIN)
+			return ret;
+		if (ktime_after(ktime_get(), deadline))
+			return -ETIMEDOUT;
+
+		usleep_range(delay_us, delay_us * 2);
+		delay_us = min_t(unsigned long, delay_us * 2, FLIR_FSLP_POLL_MAX_US);
+	}
 }
 
 /* ========================================================================
@@ -155,35 +359,99 @@ int flir_fslp_read_frame(struct flir_boson_dev *sensor, u8 *payload, u32 expecte
  * ======================================================================== */
 
 /**
- * flir_command_dispatcher - Dispatch FLIR SDK command (matches CLIENT_dispatch)
+ * flir_stats_record - Account one dispatched command in the debugfs statistics
+ * @sensor: FLIR sensor device
+ * @fn_id: Function ID of the command
+ * @result: Dispatcher result
+ * @retries: Response reads retried for this command
+ * @mismatches: Sequence/ID mismatches seen for this command
+ * @lat_us: Round-trip latency in microseconds
+ *
+ * Slots are claimed by open addressing on fn_id. The dispatcher is the only
+ * writer (callers serialize commands), so plain stores are sufficient and
+ * debugfs readers tolerate a torn snapshot.
+ */
+static void flir_stats_record(struct flir_boson_dev *sensor, u32 fn_id, FLR_RESULT result, u32 retries, u32 mismatches, u32 lat_us)
+{
+	struct flir_cmd_stats *st = NULL;
+	u32 slot = (fn_id ^ (fn_id >> 16)) % FLIR_STATS_SLOTS;
+	int i;
+
+	if (result != R_SUCCESS)
+		flir_boson_event(sensor, FLIR_EVENT_ERROR, "command %#010x failed: %#x after %u us", fn_id, result, lat_us);
+
+	for (i = 0; i < FLIR_STATS_SLOTS; i++, slot = (slot + 1) % FLIR_STATS_SLOTS) {
+		if (sensor->cmd_stats[slot].fn_id == fn_id || sensor->cmd_stats[slot].fn_id == 0) {
+			st = &sensor->cmd_stats[slot];
+			break;
+		}
+	}
+	if (!st) {
+		WRITE_ONCE(sensor->cmd_stats_dropped, sensor->cmd_stats_dropped + 1);
+		return;
+	}
+
+	if (st->fn_id == 0) {
+		st->lat_min_us = lat_us;
+		WRITE_ONCE(st->fn_id, fn_id);
+	}
+
+	WRITE_ONCE(st->calls, st->calls + 1);
+	if (result != R_SUCCESS)
+		WRITE_ONCE(st->failures, st->failures + 1);
+	WRITE_ONCE(st->retries, st->retries + retries);
+	WRITE_ONCE(st->mismatches, st->mismatches + mismatches);
+	WRITE_ONCE(st->lat_sum_us, st->lat_sum_us + lat_us);
+	if (lat_us < st->lat_min_us)
+		WRITE_ONCE(st->lat_min_us, lat_us);
+	if (lat_us > st->lat_max_us)
+		WRITE_ONCE(st->lat_max_us, lat_us);
+	i = min_t(int, fls(lat_us), FLIR_STATS_LAT_BUCKETS - 1);
+	WRITE_ONCE(st->lat_hist[i], st->lat_hist[i] + 1);
+}
+
+/**
+ * __flir_command_dispatcher - Single command round trip
  * @sensor: FLIR sensor device
  * @seq_num: Sequence number for command tracking
  * @fn_id: Function ID (SDK command code)
  * @send_data: Command-specific data to send
  * @send_bytes: Length of send_data
  * @receive_data: Buffer for response data (without headers)
- * @receive_bytes: Expected response data length (updated with actual)
+ * @receive_bytes: Expected response data length, on success updated with the
+ *                 bytes the reply carried (never more than expected)
+ * @sleep_ms: Worst-case processing delay; slept as-is when fslp_poll is off,
+ *            otherwise only used as a lower bound for the polling deadline
+ *
+ * @retries: Incremented for every response read that had to be retried
+ * @mismatches: Incremented for every sequence or ID mismatch
  *
  * Implements exact CLIENT_dispatch() protocol from Client_Dispatcher.py:11-93
  */
-FLR_RESULT flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u32 fn_id, const u8 *send_data, u32 send_bytes, u8 *receive_data, u32 *receive_bytes, u32 sleep_ms)
+static FLR_RESULT __flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u32 fn_id, const u8 *send_data, u32 send_bytes, u8 *receive_data,
+					    u32 *receive_bytes, u32 sleep_ms, u32 *retries, u32 *mismatches)
 {
-	u8 command_payload[FLIR_FSLP_MAX_DATA];
-	u8 response_payload[FLIR_FSLP_MAX_DATA];
+	u8 *command_payload = &sensor->fslp_tx_buf[FLIR_FSLP_HEADER_SIZE];
+	u8 *response_payload = sensor->fslp_resp_buf;
 	u8 *ptr = command_payload;
 	const u8 *resp_ptr;
 	u32 return_seq, cmd_id, status;
 	u32 expected_resp_len = 0;
-	int ret, retry;
+	int ret, retry, resp_len = 0;
 
-	/* Keep reading until RX buffer is empty */
-	do {
-	    ret = flir_boson_i2c_read(sensor, (u8*)&status, 4);
-	} while (ret == 0 && status != 0xFFFFFFFF);
-	if (ret) {
-        dev_err(sensor->dev, "Failed to flush RX buffer\n");
-        return FLR_COMM_ERROR_READING_COMM;
-    }
+	/* Both directions carry the 12-byte header inside one FSLP payload */
+	if (send_bytes > FLIR_FSLP_MAX_DATA - 12 || *receive_bytes > FLIR_FSLP_MAX_DATA - 12)
+		return R_SDK_PKG_BUFFER_OVERFLOW;
+
+	/* Keep reading until RX buffer is empty, unless the last response was consumed cleanly */
+	if (sensor->rx_dirty && flir_fslp_flush_rx(sensor)) {
+		sensor->fslp_recovery.flush_failures++;
+		flir_comm_err(sensor, "Failed to flush RX buffer\n");
+		return FLR_COMM_ERROR_READING_COMM;
+	}
+
+	/* Any early return below leaves the transport in an unknown state */
+	sensor->rx_dirty = true;
 
 	/* Build 12-byte command header */
 	UINT32_ToBytes(seq_num, ptr); ptr += 4;      /* Sequence number */
@@ -195,38 +463,45 @@ FLR_RESULT flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u
 		memcpy(ptr, send_data, send_bytes);
 	}
 
-	/* Send command via I2C FSLP framing layer */
-	// dev_dbg(sensor->dev, "Dispatching command: seq=0x%08X, fn_id=0x%08X, send_bytes=%u", seq_num, fn_id, send_bytes);
-	// print_hex_dump_debug("CMD_PAYLOAD: ", DUMP_PREFIX_OFFSET, 16, 1, command_payload, 12 + send_bytes, true);
+	/* Send command via I2C FSLP framing layer, traced by flir_fslp_send_frame */
 
 	ret = flir_fslp_send_frame(sensor, command_payload, 12 + send_bytes);
+	if (ret == -EMSGSIZE)
+		return R_SDK_PKG_BUFFER_OVERFLOW; /* adapter limit, resending cannot help */
 	if (ret) {
-		dev_err(sensor->dev, "Failed to send command 0x%08X: %d\n", fn_id, ret);
+		flir_comm_err(sensor, "Failed to send command 0x%08X: %d\n", fn_id, ret);
 		return FLR_COMM_ERROR_WRITING_COMM;
 	}
 
-	msleep(sleep_ms); /* Allow time for command processing */
+	if (!fslp_poll)
+		msleep(sleep_ms); /* Allow time for command processing */
 
 	/* Read response if expected */
 	expected_resp_len = *receive_bytes + 12; /* Add header length */
 
-	/* Retry logic for sequence mismatch */
-	for (retry = 0; retry < 2; retry++) {
-		// dev_dbg(sensor->dev, "Reading response: expected_len=%u, retry=%d", expected_resp_len, retry);
-		ret = flir_fslp_read_frame(sensor, response_payload, expected_resp_len);
-		if (ret) {
-			dev_err(sensor->dev, "Failed to read response: %d\n", ret);
+	/* Retry a short read once, drain late responses to earlier commands */
+	for (retry = 0; retry <= FLIR_FSLP_MAX_STALE; retry++) {
+		ret = flir_fslp_wait_frame(sensor, fn_id, response_payload, expected_resp_len, sleep_ms);
+		if (ret == -ETIMEDOUT) {
+			flir_comm_err(sensor, "Timeout waiting for response to 0x%08X\n", fn_id);
+			return FLR_COMM_TIMEOUT_ERROR;
+		}
+		if (ret < 0) {
+			flir_comm_err(sensor, "Failed to read response: %d\n", ret);
 			return FLR_COMM_ERROR_READING_COMM;
 		}
-		// print_hex_dump_debug("RESP_PAYLOAD: ", DUMP_PREFIX_OFFSET, 16, 1, response_payload, expected_resp_len, true);
+
+		resp_len = ret;
 
 		/* Validate response length */
-		if (expected_resp_len < 12) {
+		if (ret < 12) {
 			if (retry == 0) {
 				dev_warn(sensor->dev, "Short response, retrying...\n");
+				trace_flir_fslp_retry(sensor, seq_num, fn_id, 0, ret);
+				(*retries)++;
 				continue;
 			}
-			dev_err(sensor->dev, "Response too short: %u bytes\n", expected_resp_len);
+			dev_err(sensor->dev, "Response too short: %d bytes\n", ret);
 			return FLR_COMM_ERROR_READING_COMM;
 		}
 
@@ -236,16 +511,20 @@ FLR_RESULT flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u
 		return_seq = byteToUINT32(resp_ptr);
 		resp_ptr += 4;
 
-		if (return_seq != seq_num) {
-			dev_warn(sensor->dev, "Sequence mismatch: exp 0x%08X, got 0x%08X\n", seq_num, return_seq);
-			if (retry == 0) {
-				dev_warn(sensor->dev, "Retrying read...\n");
-				continue;
-			}
-			return R_SDK_DSPCH_SEQUENCE_MISMATCH;
-		} else {
+		if (return_seq == seq_num)
 			break; /* Sequence OK */
+
+		(*mismatches)++;
+		/* Answer to an earlier command that timed out: drop it and read ours */
+		if ((s32)(seq_num - return_seq) > 0 && retry < FLIR_FSLP_MAX_STALE) {
+			dev_dbg(sensor->dev, "Dropping stale response 0x%08X, waiting for 0x%08X\n", return_seq, seq_num);
+			trace_flir_fslp_retry(sensor, seq_num, fn_id, return_seq, resp_len);
+			sensor->fslp_recovery.stale_drops++;
+			(*retries)++;
+			continue;
 		}
+		dev_warn(sensor->dev, "Sequence mismatch: exp 0x%08X, got 0x%08X\n", seq_num, return_seq);
+		return R_SDK_DSPCH_SEQUENCE_MISMATCH;
 	}
 
 	/* Validate command ID */
@@ -255,6 +534,7 @@ FLR_RESULT flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u
 	if (cmd_id != fn_id) {
 		dev_err(sensor->dev, "Command ID mismatch: exp 0x%08X, got 0x%08X\n",
 			fn_id, cmd_id);
+		(*mismatches)++;
 		return R_SDK_DSPCH_ID_MISMATCH;
 	}
 
@@ -262,21 +542,232 @@ FLR_RESULT flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u
 	status = byteToUINT32(resp_ptr);
 	resp_ptr += 4;
 
+	/* Whole response consumed, next command can skip the flush. A frame
+	 * shorter than the read-ahead means bytes past it were swallowed. */
+	sensor->rx_dirty = resp_len < expected_resp_len;
+
 	if (status != R_SUCCESS) {
 		dev_err(sensor->dev, "Command 0x%08X failed with status 0x%08X (%s)\n",
 			fn_id, status, flr_result_to_string((FLR_RESULT)status));
 		return (FLR_RESULT)status;
 	}
 
-	/* Copy response data */
+	/* Copy response data: only what this reply carried, the buffer still holds older ones */
+	*receive_bytes = min_t(u32, resp_len - 12, *receive_bytes);
 	if (receive_data && *receive_bytes > 0) {
 		memcpy(receive_data, resp_ptr, *receive_bytes);
 	}
 
-	// dev_dbg(sensor->dev, "Command 0x%08X completed successfully\n", fn_id);
 	return R_SUCCESS;
 }
 
+/* Lost or garbled traffic only; a timed-out camera is busy or gone and would only time out again */
+static bool flir_fslp_can_replay(u32 fn_id, FLR_RESULT ret)
+{
+	int i;
+
+	if (ret != FLR_COMM_ERROR_READING_COMM && ret != FLR_COMM_ERROR_WRITING_COMM && ret != R_SDK_DSPCH_SEQUENCE_MISMATCH &&
+	    ret != R_SDK_DSPCH_ID_MISMATCH)
+		return false;
+
+	if ((fn_id >> 16) == (FILEOPS_DIR >> 16) || (fn_id >> 16) == (SYMBOLOGY_SETENABLE >> 16))
+		return false;
+
+	for (i = 0; i < ARRAY_SIZE(flir_fslp_no_replay); i++) {
+		if (flir_fslp_no_replay[i] == fn_id)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * flir_command_dispatcher - Dispatch FLIR SDK command (matches CLIENT_dispatch)
+ * @sensor: FLIR sensor device
+ * @seq_num: Sequence number for command tracking
+ * @fn_id: Function ID (SDK command code)
+ * @send_data: Command-specific data to send
+ * @send_bytes: Length of send_data
+ * @receive_data: Buffer for response data (without headers)
+ * @receive_bytes: Expected response data length (updated with actual)
+ * @sleep_ms: Worst-case processing delay, see __flir_command_dispatcher()
+ *
+ * Runs one command round trip and records its latency, retries and
+ * mismatches in the per-function statistics exposed through debugfs.
+ * After a transport error an idempotent command is replayed once under a
+ * new sequence number, behind a flush of whatever the camera still had
+ * queued, so a bus glitch costs a round trip instead of the operation.
+ */
+FLR_RESULT flir_command_dispatcher(struct flir_boson_dev *sensor, u32 seq_num, u32 fn_id, const u8 *send_data, u32 send_bytes, u8 *receive_data, u32 *receive_bytes, u32 sleep_ms)
+{
+	ktime_t start = ktime_get();
+	u32 retries = 0, mismatches = 0;
+	FLR_RESULT ret;
+	u32 lat_us;
+
+	ret = __flir_command_dispatcher(sensor, seq_num, fn_id, send_data, send_bytes, receive_data, receive_bytes, sleep_ms, &retries, &mismatches);
+	/* During boot the readiness poll is the retry */
+	if (!sensor->booting && flir_fslp_can_replay(fn_id, ret)) {
+		/* rx_dirty is still set, so the replay starts with a flush */
+		dev_dbg(sensor->dev, "Replaying command 0x%08X after %s\n", fn_id, flr_result_to_string(ret));
+		sensor->fslp_recovery.replays++;
+		retries++;
+		seq_num = ++sensor->command_count;
+		ret = __flir_command_dispatcher(sensor, seq_num, fn_id, send_data, send_bytes, receive_data, receive_bytes, sleep_ms, &retries,
+						&mismatches);
+		if (ret == R_SUCCESS)
+			sensor->fslp_recovery.recovered++;
+	}
+	lat_us = (u32)ktime_us_delta(ktime_get(), start);
+	flir_stats_record(sensor, fn_id, ret, retries, mismatches, lat_us);
+	trace_flir_fslp_cmd_done(sensor, seq_num, fn_id, send_bytes, *receive_bytes, ret, lat_us, retries);
+
+	return ret;
+}
+
+/* Transport failures: the camera is not answering, later entries would only time out */
+static bool flir_result_is_comm_error(FLR_RESULT ret)
+{
+	return ret >= FLR_COMM_PORT_NOT_OPEN && ret <= FLR_COMM_COUNT_ERROR;
+}
+
+/**
+ * flir_boson_send_batch - Run several commands back to back under one lock hold
+ * @sensor: FLIR sensor device, sensor->lock held
+ * @entries: Commands to run, in order; results are stored per entry
+ * @count: Number of entries
+ *
+ * The Boson I2C slave buffers a single command, so each entry still gets
+ * its own write/read, but the batch pays the RX flush at most once and
+ * never drops the lock in between. After a transport error the remaining
+ * entries are not sent and inherit that error.
+ *
+ * Return: R_SUCCESS, or the result of the first failing entry.
+ */
+FLR_RESULT flir_boson_send_batch(struct flir_boson_dev *sensor, struct flir_boson_batch_entry *entries, unsigned int count)
+{
+	FLR_RESULT first = R_SUCCESS;
+	FLR_RESULT comm = R_SUCCESS;
+	struct flir_boson_batch_entry *e;
+	unsigned int i;
+
+	lockdep_assert_held(&sensor->lock);
+
+	for (i = 0; i < count; i++) {
+		e = &entries[i];
+
+		if (comm != R_SUCCESS) {
+			e->result = comm;
+			continue;
+		}
+
+		e->result = flir_command_dispatcher(sensor, ++sensor->command_count, e->fn_id, e->send_data, e->send_bytes,
+						    e->recv_data, &e->recv_bytes, e->delay_ms);
+		if (e->result == R_SUCCESS && e->val_out) {
+			if (e->recv_bytes >= 4)
+				*e->val_out = byteToUINT32(e->recv_data);
+			else
+				e->result = R_SDK_DSPCH_MALFORMED_STATUS;
+		}
+
+		if (e->result != R_SUCCESS && first == R_SUCCESS)
+			first = e->result;
+		if (flir_result_is_comm_error(e->result))
+			comm = e->result;
+	}
+
+	return first;
+}
+
+/* Fill @e with a single-u32 setter, payload kept in the entry itself */
+void flir_boson_batch_set_int(struct flir_boson_batch_entry *e, u32 cmd, u32 val)
+{
+	memset(e, 0, sizeof(*e));
+	e->fn_id      = cmd;
+	UINT32_ToBytes(val, e->val_buf);
+	e->send_data  = e->val_buf;
+	e->send_bytes = sizeof(e->val_buf);
+	e->recv_data  = e->val_buf; /* setters answer with no data */
+}
+
+/* Fill @e with a single-u32 getter, decoded into @val on success */
+void flir_boson_batch_get_int(struct flir_boson_batch_entry *e, u32 cmd, u32 *val)
+{
+	memset(e, 0, sizeof(*e));
+	e->fn_id      = cmd;
+	e->recv_data  = e->val_buf;
+	e->recv_bytes = sizeof(e->val_buf);
+	e->val_out    = val;
+}
+
+/* Symbology commands of the overlay controls, payload in @buf of FLIR_SYMBOL_MAX_BYTES */
+void flir_boson_batch_symbol_enable(struct flir_boson_batch_entry *e, u8 *buf, bool enable)
+{
+	memset(e, 0, sizeof(*e));
+	e->fn_id      = SYMBOLOGY_SETENABLE;
+	UINT32_ToBytes(enable ? FLR_ENABLE : FLR_DISABLE, buf);
+	e->send_data  = buf;
+	e->send_bytes = 4;
+}
+
+/* SYMBOLOGY_CREATELINE, and the same layout for the rectangles and the ellipse */
+void flir_boson_batch_symbol_line(struct flir_boson_batch_entry *e, u8 *buf, u8 id, s16 x, s16 y, s16 x2, s16 y2, u32 color)
+{
+	memset(e, 0, sizeof(*e));
+	e->fn_id = SYMBOLOGY_CREATELINE;
+	buf[0]   = id;
+	UINT16_ToBytes(x, buf + 1);
+	UINT16_ToBytes(y, buf + 3);
+	UINT16_ToBytes(x2, buf + 5);
+	UINT16_ToBytes(y2, buf + 7);
+	UINT32_ToBytes(color, buf + 9);
+	e->send_data  = buf;
+	e->send_bytes = 13;
+}
+
+void flir_boson_batch_symbol_text(struct flir_boson_batch_entry *e, u8 *buf, u8 id, s16 x, s16 y, s16 width, s16 height,
+				  s16 size, u32 color, const char *text)
+{
+	memset(e, 0, sizeof(*e));
+	memset(buf, 0, FLIR_SYMBOL_MAX_BYTES);
+	e->fn_id = SYMBOLOGY_CREATETEXT;
+	buf[0]   = id;
+	UINT16_ToBytes(x, buf + 1);
+	UINT16_ToBytes(y, buf + 3);
+	UINT16_ToBytes(width, buf + 5);
+	UINT16_ToBytes(height, buf + 7);
+	buf[9] = 0; /* font */
+	UINT16_ToBytes(size, buf + 10);
+	UINT16_ToBytes(FLR_SYMBOLOGY_LEFT_TOP, buf + 12);
+	UINT32_ToBytes(color, buf + 14);
+	strscpy((char *)buf + 18, text, FLIR_SYMBOL_MAX_BYTES - 18);
+	e->send_data  = buf;
+	e->send_bytes = FLIR_SYMBOL_MAX_BYTES;
+}
+
+/* SYMBOLOGY_MOVESPRITE: new position of the symbol's origin */
+void flir_boson_batch_symbol_move(struct flir_boson_batch_entry *e, u8 *buf, u8 id, s16 x, s16 y)
+{
+	memset(e, 0, sizeof(*e));
+	e->fn_id = SYMBOLOGY_MOVESPRITE;
+	buf[0]   = id;
+	UINT16_ToBytes(x, buf + 1);
+	UINT16_ToBytes(y, buf + 3);
+	e->send_data  = buf;
+	e->send_bytes = 5;
+}
+
+/* SYMBOLOGY_UPDATEANDSHOW: draws the symbol's pending changes, or hides it */
+void flir_boson_batch_symbol_show(struct flir_boson_batch_entry *e, u8 *buf, u8 id, bool visible)
+{
+	memset(e, 0, sizeof(*e));
+	e->fn_id = SYMBOLOGY_UPDATEANDSHOW;
+	buf[0]   = id;
+	buf[1]   = visible;
+	e->send_data  = buf;
+	e->send_bytes = 2;
+}
+
 /* ========================================================================
  * Layer 3: Command Packagers (matches Client_Packager.py/c patterns)
  * ======================================================================== */
@@ -289,17 +780,21 @@ FLR_RESULT flir_boson_send_int_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 v
 	u32 seq_num = ++sensor->command_count;
 	FLR_RESULT ret;
 
-	// dev_dbg(sensor->dev, "CMD: flir_boson_set_output_interface(interface=%d)", interface);
-	// dev_dbg(sensor->dev, "CMD: seq_num=0x%08X, fn_id=0x%08X", seq_num, DVO_SET_OUTPUT_INTERFACE);
 	UINT32_ToBytes(val, send_data);
-	// print_hex_dump_debug("CMD_DATA: ", DUMP_PREFIX_OFFSET, 16, 1, send_data, sizeof(send_data), true);
 
 	ret = flir_command_dispatcher(sensor, seq_num, cmd, send_data, sizeof(send_data), receive_data, &receive_bytes, delay_ms);
-
-	// dev_dbg(sensor->dev, "CMD: flir_boson_set_output_interface result=%d", ret);
 	return ret;
 }
 
+/* Commands without arguments or response data, e.g. flash writes */
+FLR_RESULT flir_boson_send_void_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 delay_ms)
+{
+	u32 receive_bytes = 0;
+	u32 seq_num = ++sensor->command_count;
+
+	return flir_command_dispatcher(sensor, seq_num, cmd, NULL, 0, NULL, &receive_bytes, delay_ms);
+}
+
 FLR_RESULT flir_boson_get_int_val(struct flir_boson_dev *sensor, u32 cmd, u32 *val)
 {
 	u8 receive_data[4];
@@ -308,15 +803,223 @@ FLR_RESULT flir_boson_get_int_val(struct flir_boson_dev *sensor, u32 cmd, u32 *v
 	FLR_RESULT ret;
 
 	ret = flir_command_dispatcher(sensor, seq_num, cmd, NULL, 0, receive_data, &receive_bytes, 0);
-	if (ret == R_SUCCESS && receive_bytes >= 4) {
+	if (ret == R_SUCCESS && receive_bytes < sizeof(receive_data))
+		return R_SDK_DSPCH_MALFORMED_STATUS;
+	if (ret == R_SUCCESS)
 		*val = byteToUINT32(receive_data);
-		// dev_dbg(sensor->dev, "CMD: Got MIPI state: %d", *state);
-		// print_hex_dump_debug("CMD_RESP: ", DUMP_PREFIX_OFFSET, 16, 1, receive_data, receive_bytes, true);
+
+	return ret;
+}
+
+/* Getters answering with two u32s, e.g. LATENCYCTRL_GETLATENCY (min, max) */
+FLR_RESULT flir_boson_get_int_pair(struct flir_boson_dev *sensor, u32 cmd, u32 *val0, u32 *val1)
+{
+	u8 receive_data[8];
+	u32 receive_bytes = sizeof(receive_data);
+	u32 seq_num = ++sensor->command_count;
+	FLR_RESULT ret;
+
+	ret = flir_command_dispatcher(sensor, seq_num, cmd, NULL, 0, receive_data, &receive_bytes, 0);
+	if (ret == R_SUCCESS && receive_bytes < sizeof(receive_data))
+		return R_SDK_DSPCH_MALFORMED_STATUS;
+	if (ret == R_SUCCESS) {
+		*val0 = byteToUINT32(receive_data);
+		*val1 = byteToUINT32(receive_data + 4);
+	}
+
+	return ret;
+}
+
+FLR_RESULT flir_boson_set_jitter_reduction(struct flir_boson_dev *sensor, FLR_ENABLE_E enable, u32 line)
+{
+	u8 send_data[8];
+	u32 receive_bytes = 0;
+	u32 seq_num = ++sensor->command_count;
+
+	UINT32_ToBytes((u32)enable, send_data);
+	UINT32_ToBytes(line, send_data + 4);
+
+	return flir_command_dispatcher(sensor, seq_num, LATENCYCTRL_SETJITTERREDUCTION, send_data, sizeof(send_data), NULL, &receive_bytes, 1);
+}
+
+/**
+ * flir_boson_get_image_stats - Read the camera's scene statistics in one batch
+ * @sensor: FLIR sensor device, sensor->lock held
+ * @stats: Filled in enum flir_image_stat order on success
+ *
+ * Whole-frame mean/peak/base from IMAGESTATS_GETIMAGESTATS plus the mean and
+ * histogram first/last bins of the IMAGESTATS ROI.
+ */
+FLR_RESULT flir_boson_get_image_stats(struct flir_boson_dev *sensor, u16 stats[FLIR_STAT_NUM])
+{
+	static const u32 roi_fn[] = { IMAGESTATS_GETMEANINROI, IMAGESTATS_GETFIRSTBININROI, IMAGESTATS_GETLASTBININROI };
+	struct flir_boson_batch_entry batch[1 + ARRAY_SIZE(roi_fn)];
+	u8 frame[6], roi[ARRAY_SIZE(roi_fn)][2];
+	FLR_RESULT ret;
+	unsigned int i;
+
+	memset(batch, 0, sizeof(batch));
+	batch[0].fn_id      = IMAGESTATS_GETIMAGESTATS;
+	batch[0].recv_data  = frame;
+	batch[0].recv_bytes = sizeof(frame);
+	for (i = 0; i < ARRAY_SIZE(roi_fn); i++) {
+		batch[i + 1].fn_id      = roi_fn[i];
+		batch[i + 1].recv_data  = roi[i];
+		batch[i + 1].recv_bytes = sizeof(roi[i]);
+	}
+
+	ret = flir_boson_send_batch(sensor, batch, ARRAY_SIZE(batch));
+	if (ret != R_SUCCESS)
+		return ret;
+	for (i = 0; i < ARRAY_SIZE(batch); i++) {
+		if (batch[i].recv_bytes < (i ? sizeof(roi[0]) : sizeof(frame)))
+			return R_SDK_DSPCH_MALFORMED_STATUS;
+	}
+
+	stats[FLIR_STAT_MEAN] = byteToUINT16(frame);
+	stats[FLIR_STAT_PEAK] = byteToUINT16(frame + 2);
+	stats[FLIR_STAT_BASE] = byteToUINT16(frame + 4);
+	for (i = 0; i < ARRAY_SIZE(roi_fn); i++)
+		stats[FLIR_STAT_ROI_MEAN + i] = byteToUINT16(roi[i]);
+
+	return R_SUCCESS;
+}
+
+/* CAPTURE_GETSTATUS state (FLR_CAPTURE_STATE_E) and result of the last capture */
+FLR_RESULT flir_boson_get_capture_status(struct flir_boson_dev *sensor, u32 *state, u32 *result)
+{
+	u8 receive_data[24]; /* FLR_CAPTURE_STATUS_T: state, result and four frame counters */
+	u32 receive_bytes = sizeof(receive_data);
+	u32 seq_num = ++sensor->command_count;
+	FLR_RESULT ret;
+
+	ret = flir_command_dispatcher(sensor, seq_num, CAPTURE_GETSTATUS, NULL, 0, receive_data, &receive_bytes, 0);
+	if (ret == R_SUCCESS && receive_bytes < 8)
+		return R_SDK_DSPCH_MALFORMED_STATUS;
+	if (ret == R_SUCCESS) {
+		*state  = byteToUINT32(receive_data);
+		*result = byteToUINT32(receive_data + 4);
+	}
+
+	return ret;
+}
+
+/* MEM_GETCAPTURESIZE: bytes, rows and columns held by capture buffer 0 */
+FLR_RESULT flir_boson_get_capture_size(struct flir_boson_dev *sensor, u32 *bytes, u16 *rows, u16 *columns)
+{
+	u8 receive_data[8];
+	u32 receive_bytes = sizeof(receive_data);
+	u32 seq_num = ++sensor->command_count;
+	FLR_RESULT ret;
+
+	ret = flir_command_dispatcher(sensor, seq_num, MEM_GETCAPTURESIZE, NULL, 0, receive_data, &receive_bytes, 0);
+	if (ret == R_SUCCESS && receive_bytes < sizeof(receive_data))
+		return R_SDK_DSPCH_MALFORMED_STATUS;
+	if (ret == R_SUCCESS) {
+		*bytes   = byteToUINT32(receive_data);
+		*rows    = byteToUINT16(receive_data + 4);
+		*columns = byteToUINT16(receive_data + 6);
 	}
 
 	return ret;
 }
 
+/* FFC status, last FFC frame, FPA temperature and latency for the GET_STATUS snapshot, one batch */
+FLR_RESULT flir_boson_get_health(struct flir_boson_dev *sensor, struct flir_boson_health *health)
+{
+	struct flir_boson_batch_entry batch[4];
+	u32 ffc_status, ffc_frame;
+	u8 temp[2], latency[8];
+	unsigned int i;
+
+	flir_boson_batch_get_int(&batch[0], BOSON_GETFFCSTATUS, &ffc_status);
+	flir_boson_batch_get_int(&batch[1], BOSON_GETLASTFFCFRAMECOUNT, &ffc_frame);
+	memset(&batch[2], 0, sizeof(batch[2]));
+	batch[2].fn_id      = BOSON_LOOKUPFPATEMPDEGCX10;
+	batch[2].recv_data  = temp;
+	batch[2].recv_bytes = sizeof(temp);
+	/* Latency is optional, cameras without LATENCYCTRL still report the rest */
+	memset(&batch[3], 0, sizeof(batch[3]));
+	batch[3].fn_id      = LATENCYCTRL_GETLATENCY;
+	batch[3].recv_data  = latency;
+	batch[3].recv_bytes = sizeof(latency);
+
+	flir_boson_send_batch(sensor, batch, ARRAY_SIZE(batch));
+	for (i = 0; i < 3; i++) {
+		if (batch[i].result != R_SUCCESS)
+			return batch[i].result;
+	}
+	if (batch[2].recv_bytes < sizeof(temp))
+		return R_SDK_DSPCH_MALFORMED_STATUS;
+
+	health->ffc_status  = ffc_status;
+	health->ffc_frame   = ffc_frame;
+	health->fpa_temp_dc = (s16)byteToUINT16(temp);
+	health->latency_min = health->latency_max = 0;
+	if (batch[3].result == R_SUCCESS && batch[3].recv_bytes == sizeof(latency)) {
+		health->latency_min = min_t(u64, flir_boson_float_to_scaled(byteToUINT32(latency), 1000), U32_MAX);
+		health->latency_max = min_t(u64, flir_boson_float_to_scaled(byteToUINT32(latency + 4), 1000), U32_MAX);
+	}
+
+	return R_SUCCESS;
+}
+
+/* Zoom by @num / @den around the input pixel (@x_center, @y_center), output kept centred */
+FLR_RESULT flir_boson_set_fractional_zoom(struct flir_boson_dev *sensor, u32 num, u32 den, u32 x_center, u32 y_center)
+{
+	u8 send_data[32];
+	u32 receive_bytes = 0;
+	u32 seq_num = ++sensor->command_count;
+
+	UINT32_ToBytes(num, send_data);
+	UINT32_ToBytes(den, send_data + 4);
+	UINT32_ToBytes(x_center, send_data + 8);
+	UINT32_ToBytes(y_center, send_data + 12);
+	UINT32_ToBytes(FLR_ENABLE, send_data + 16);  /* inChangeEnable */
+	UINT32_ToBytes(0, send_data + 20);           /* zoomOutXCenter */
+	UINT32_ToBytes(0, send_data + 24);           /* zoomOutYCenter */
+	UINT32_ToBytes(FLR_DISABLE, send_data + 28); /* outChangeEnable */
+
+	return flir_command_dispatcher(sensor, seq_num, SCALER_SETFRACTIONALZOOM, send_data, sizeof(send_data), NULL, &receive_bytes, 1);
+}
+
+/* Isotherm thresholds of one gain table, in the unit selected by ISOTHERM_SETUNIT */
+FLR_RESULT flir_boson_set_isotherm_temps(struct flir_boson_dev *sensor, FLR_ISOTHERM_GAIN_E table, const s32 temps[FLIR_ISOTHERM_TEMPS])
+{
+	u8 send_data[4 + 4 * FLIR_ISOTHERM_TEMPS];
+	u32 receive_bytes = 0;
+	u32 seq_num = ++sensor->command_count;
+	int i;
+
+	UINT32_ToBytes(table, send_data);
+	for (i = 0; i < FLIR_ISOTHERM_TEMPS; i++)
+		UINT32_ToBytes((u32)temps[i], send_data + 4 + 4 * i);
+
+	return flir_command_dispatcher(sensor, seq_num, ISOTHERM_SETTEMPS, send_data, sizeof(send_data), NULL, &receive_bytes, 0);
+}
+
+FLR_RESULT flir_boson_get_isotherm_temps(struct flir_boson_dev *sensor, FLR_ISOTHERM_GAIN_E table, s32 temps[FLIR_ISOTHERM_TEMPS])
+{
+	u8 send_data[4];
+	u8 receive_data[4 * FLIR_ISOTHERM_TEMPS];
+	u32 receive_bytes = sizeof(receive_data);
+	u32 seq_num = ++sensor->command_count;
+	FLR_RESULT ret;
+	int i;
+
+	UINT32_ToBytes(table, send_data);
+	ret = flir_command_dispatcher(sensor, seq_num, ISOTHERM_GETTEMPS, send_data, sizeof(send_data), receive_data, &receive_bytes, 0);
+	if (ret != R_SUCCESS)
+		return ret;
+	if (receive_bytes < sizeof(receive_data))
+		return R_SDK_DSPCH_MALFORMED_STATUS;
+
+	for (i = 0; i < FLIR_ISOTHERM_TEMPS; i++)
+		temps[i] = (s32)byteToUINT32(receive_data + 4 * i);
+
+	return R_SUCCESS;
+}
+
 // Newly added GetClockInfo with 80 bytes return data = 20 values.
 // Make sure info is created before calling this function.
 FLR_RESULT flir_boson_get_clockinfo(struct flir_boson_dev *sensor, struct boson_clockinfo *info)
@@ -332,8 +1035,6 @@ FLR_RESULT flir_boson_get_clockinfo(struct flir_boson_dev *sensor, struct boson_
 
 	ret = flir_command_dispatcher(sensor, seq_num, DVO_GETCLOCKINFO, sendData, sendBytes, receiveData, &receiveBytes, 300);
 
-	pr_info("Get ClockInfo received bytes	= %d \n", receiveBytes);
-
 	union PackU32 {
 		u8 bytes[4];
 		u32 val;
@@ -348,11 +1049,65 @@ FLR_RESULT flir_boson_get_clockinfo(struct flir_boson_dev *sensor, struct boson_
 			memcpy(ptr, data_u32.bytes, 4);
 		}
 		memcpy(info, receiveData, 80);
+	} else if (ret == R_SUCCESS) {
+		ret = R_SDK_DSPCH_MALFORMED_STATUS;
 	}
 
 	return ret;
 }
 
+/**
+ * flir_boson_float_to_scaled - Convert an IEEE-754 single from the camera to an integer
+ * @bits: Raw float bits, e.g. boson_clockinfo.clockRateInMHz
+ * @scale: Multiplier applied before truncation (1000000 turns MHz into Hz)
+ *
+ * The kernel cannot use the FPU here, so the mantissa is shifted by hand.
+ *
+ * Return: round(value * @scale), 0 for negative, NaN or infinite values.
+ */
+u64 flir_boson_float_to_scaled(u32 bits, u32 scale)
+{
+	int exp = (bits >> 23) & 0xff;
+	u64 mant = (bits & 0x7fffff) | 0x800000;
+	int shift;
+
+	if ((bits & 0x80000000) || exp == 0 || exp == 0xff)
+		return 0;
+
+	/* value = mant * 2^(exp - 150) */
+	shift = exp - 150;
+	mant *= scale; /* < 2^56 */
+	if (shift >= 0)
+		return shift < 8 ? mant << shift : U64_MAX;
+
+	/* Round to nearest so values written by flir_boson_scaled_to_float() read back unchanged */
+	return shift > -64 ? (mant + (1ULL << (-shift - 1))) >> -shift : 0;
+}
+/**
+ * flir_boson_scaled_to_float - Encode @val / @scale as IEEE-754 single bits
+ * @val: Fixed-point value, e.g. a control in milli-units
+ * @scale: Divisor turning @val into the real value
+ *
+ * Inverse of flir_boson_float_to_scaled(); the mantissa is truncated.
+ */
+u32 flir_boson_scaled_to_float(u64 val, u32 scale)
+{
+	u64 q;
+	int msb;
+
+	if (!val || !scale || val >= BIT_ULL(31))
+		return 0;
+
+	/* 32.32 fixed point quotient */
+	q = div64_u64(val << 32, scale);
+	if (!q)
+		return 0;
+
+	msb = fls64(q) - 1;
+	q = msb >= 23 ? q >> (msb - 23) : q << (23 - msb);
+
+	return ((u32)(msb - 32 + 127) << 23) | ((u32)q & 0x7fffff);
+}
 
 FLR_RESULT flir_boson_set_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_OUTPUT_IF_E output, FLR_DVOMUX_SOURCE_E source, FLR_DVOMUX_TYPE_E type) {
     // Allocate buffers with space for marshalled data
@@ -390,6 +1145,8 @@ FLR_RESULT flir_boson_get_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_
     FLR_RESULT returncode = flir_command_dispatcher(sensor, seq_num, DVOMUX_GETTYPE, sendData, sendBytes, receiveData, &receiveBytes, 0);
     if(returncode != R_SUCCESS)
         return returncode;
+    if(receiveBytes < sizeof(receiveData))
+        return R_SDK_DSPCH_MALFORMED_STATUS;
 
     u8 *inPtr = (u8 *)receiveData;
 
@@ -401,3 +1158,458 @@ FLR_RESULT flir_boson_get_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_
     return R_SUCCESS;
 
 }// End of CLIENT_pkgDvomuxGetType()
+
+/* ========================================================================
+ * Shadow Register Cache
+ *
+ * Mirrors the last value successfully applied for each enum flir_shadow_id
+ * so repeated S_FMT/s_power calls only send settings that actually change.
+ * The camera keeps its state across s_power, so the cache is only dropped
+ * when the camera is reset or a command fails.
+ * After a system suspend that cut its power, flir_boson_shadow_restore()
+ * replays the cache as a journal.
+ * ======================================================================== */
+
+void flir_boson_shadow_store(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 val, FLR_RESULT result)
+{
+	if (result == R_SUCCESS) {
+		sensor->shadow[id] = val;
+		set_bit(id, &sensor->shadow_valid);
+	} else {
+		/* A failed or timed out set leaves the camera state unknown */
+		clear_bit(id, &sensor->shadow_valid);
+	}
+}
+
+void flir_boson_shadow_invalidate(struct flir_boson_dev *sensor)
+{
+	sensor->shadow_valid = 0;
+}
+
+/* Setter mirrored by each shadow slot, the getter that reads it back and the setter's delay */
+static const struct {
+	u32 set_fn;
+	u32 get_fn;
+	u32 delay_ms;
+} flir_shadow_fn[FLIR_SHADOW_COUNT] = {
+	[FLIR_SHADOW_MIPI_STATE]         = { DVO_SETMIPISTATE, DVO_GETMIPISTATE, 1 },
+	[FLIR_SHADOW_CLOCK_LANE]         = { DVO_SETMIPICLOCKLANEMODE, DVO_GETMIPICLOCKLANEMODE, 1 },
+	[FLIR_SHADOW_OPERATING_MODE]     = { SYSCTRL_SETOPERATINGMODE, SYSCTRL_GETOPERATINGMODE, 100 },
+	[FLIR_SHADOW_DVO_TYPE]           = { DVO_SETTYPE, DVO_GETTYPE, 100 },
+	[FLIR_SHADOW_DVO_OUTPUT_FORMAT]  = { DVO_SETOUTPUTFORMAT, DVO_GETOUTPUTFORMAT, 1 },
+	[FLIR_SHADOW_DVO_OUTPUT_IF]      = { DVO_SETOUTPUTINTERFACE, DVO_GETOUTPUTINTERFACE, 100 },
+	[FLIR_SHADOW_DVO_MUXTYPE]        = { DVOMUX_SETTYPE, 0, 1 }, /* two-value getter, see flir_boson_shadow_load() */
+	[FLIR_SHADOW_TELEMETRY_STATE]    = { TELEMETRY_SETSTATE, TELEMETRY_GETSTATE, 1 },
+	[FLIR_SHADOW_TELEMETRY_LOCATION] = { TELEMETRY_SETLOCATION, TELEMETRY_GETLOCATION, 1 },
+	[FLIR_SHADOW_TELEMETRY_TAG]      = { TELEMETRY_SETMIPIEMBEDDEDDATATAG, TELEMETRY_GETMIPIEMBEDDEDDATATAG, 1 },
+	[FLIR_SHADOW_GAIN_MODE]          = { BOSON_SETGAINMODE, BOSON_GETGAINMODE, 1 },
+	[FLIR_SHADOW_AGC_MODE]           = { AGC_SETMODE, AGC_GETMODE, 1 },
+	[FLIR_SHADOW_FRAME_SKIP]         = { ROIC_SETFRAMESKIP, ROIC_GETFRAMESKIP, 1 },
+	[FLIR_SHADOW_FFC_MODE]           = { BOSON_SETFFCMODE, BOSON_GETFFCMODE, 1 },
+	[FLIR_SHADOW_LOW_LATENCY]        = { LATENCYCTRL_SETLOWLATENCYSTATE, LATENCYCTRL_GETLOWLATENCYSTATE, 1 },
+	[FLIR_SHADOW_COLOR_LUT]          = { COLORLUT_SETID, COLORLUT_GETID, 0 },
+	[FLIR_SHADOW_COLOR_LUT_STATE]    = { COLORLUT_SETCONTROL, COLORLUT_GETCONTROL, 0 },
+	[FLIR_SHADOW_ISOTHERM_STATE]     = { ISOTHERM_SETENABLE, ISOTHERM_GETENABLE, 0 },
+	[FLIR_SHADOW_ISOTHERM_UNIT]      = { ISOTHERM_SETUNIT, ISOTHERM_GETUNIT, 0 },
+	[FLIR_SHADOW_EXT_SYNC]           = { BOSON_SETEXTSYNCMODE, BOSON_GETEXTSYNCMODE, 1 },
+	[FLIR_SHADOW_SPNR_STATE]         = { SPNR_SETENABLESTATE, SPNR_GETENABLESTATE, 1 },
+	[FLIR_SHADOW_SCNR_STATE]         = { SCNR_SETENABLESTATE, SCNR_GETENABLESTATE, 1 },
+	[FLIR_SHADOW_SRNR_STATE]         = { SRNR_SETENABLESTATE, SRNR_GETENABLESTATE, 1 },
+	[FLIR_SHADOW_TF_STATE]           = { TF_SETENABLESTATE, TF_GETENABLESTATE, 1 },
+	[FLIR_SHADOW_AVERAGER_STATE]     = { GAO_SETAVERAGERSTATE, GAO_GETAVERAGERSTATE, 1 },
+};
+
+/**
+ * flir_boson_shadow_load - Seed the cache with the camera's current settings
+ * @sensor: FLIR sensor device
+ *
+ * One batch of getters, so settings the camera already has (e.g. restored
+ * from its flash defaults) are never sent again. Slots that cannot be read
+ * stay invalid. Called with sensor->lock held.
+ *
+ * Return: number of slots loaded.
+ */
+int flir_boson_shadow_load(struct flir_boson_dev *sensor)
+{
+	struct flir_boson_batch_entry *batch = sensor->shadow_batch;
+	u32 val[FLIR_SHADOW_COUNT];
+	u8 slot[FLIR_SHADOW_COUNT];
+	FLR_DVOMUX_SOURCE_E source;
+	FLR_DVOMUX_TYPE_E type;
+	unsigned int i, n = 0;
+	int loaded = 0;
+
+	lockdep_assert_held(&sensor->lock);
+
+	for (i = 0; i < FLIR_SHADOW_COUNT; i++) {
+		if (!flir_shadow_fn[i].get_fn)
+			continue;
+		flir_boson_batch_get_int(&batch[n], flir_shadow_fn[i].get_fn, &val[n]);
+		slot[n++] = i;
+	}
+
+	flir_boson_send_batch(sensor, batch, n);
+
+	for (i = 0; i < n; i++) {
+		if (batch[i].result != R_SUCCESS)
+			continue;
+		flir_boson_shadow_store(sensor, slot[i], val[i], R_SUCCESS);
+		loaded++;
+	}
+
+	/* The driver only ever routes the IR source to MIPI */
+	if (flir_boson_get_dvo_muxtype(sensor, FLR_DVOMUX_OUTPUT_IF_MIPITX, &source, &type) == R_SUCCESS && source == FLR_DVOMUX_SRC_IR) {
+		flir_boson_shadow_store(sensor, FLIR_SHADOW_DVO_MUXTYPE, type, R_SUCCESS);
+		loaded++;
+	}
+
+	return loaded;
+}
+
+/**
+ * flir_boson_shadow_restore - Send a camera the cached settings it lost
+ * @sensor: FLIR sensor device
+ * @skip: Slots the caller applies itself, one bit per enum flir_shadow_id
+ * @sent: Number of settings sent
+ *
+ * The cache is the journal of what the driver last applied. It is read
+ * back with flir_boson_shadow_load() and only the settings that now differ
+ * are sent again, in slot order and in one batch, so a camera that booted
+ * from its flash defaults gets back what it lost and nothing more. Slots
+ * that fail stay invalid. Called with sensor->lock held.
+ *
+ * Return: R_SUCCESS, or the result of the first failing setter.
+ */
+FLR_RESULT flir_boson_shadow_restore(struct flir_boson_dev *sensor, unsigned long skip, unsigned int *sent)
+{
+	/* Shared with flir_boson_shadow_load(), which is done with it before the loop */
+	struct flir_boson_batch_entry *batch = sensor->shadow_batch;
+	unsigned long journal_valid = sensor->shadow_valid & ~skip;
+	u32 journal[FLIR_SHADOW_COUNT];
+	u8 slot[FLIR_SHADOW_COUNT];
+	unsigned int i, n = 0;
+	FLR_RESULT ret, mux = R_SUCCESS;
+
+	lockdep_assert_held(&sensor->lock);
+
+	memcpy(journal, sensor->shadow, sizeof(journal));
+	flir_boson_shadow_invalidate(sensor);
+	flir_boson_shadow_load(sensor);
+
+	for_each_set_bit(i, &journal_valid, FLIR_SHADOW_COUNT) {
+		if (i == FLIR_SHADOW_DVO_MUXTYPE || flir_boson_shadow_match(sensor, i, journal[i]))
+			continue;
+		flir_boson_batch_set_int(&batch[n], flir_shadow_fn[i].set_fn, journal[i]);
+		batch[n].delay_ms = flir_shadow_fn[i].delay_ms;
+		slot[n++] = i;
+	}
+
+	ret = flir_boson_send_batch(sensor, batch, n);
+	for (i = 0; i < n; i++)
+		flir_boson_shadow_store(sensor, slot[i], journal[slot[i]], batch[i].result);
+
+	/* Two-value setter, outside the batch */
+	if (test_bit(FLIR_SHADOW_DVO_MUXTYPE, &journal_valid) &&
+	    !flir_boson_shadow_match(sensor, FLIR_SHADOW_DVO_MUXTYPE, journal[FLIR_SHADOW_DVO_MUXTYPE])) {
+		mux = flir_boson_shadow_set_dvo_muxtype(sensor, (FLR_DVOMUX_TYPE_E)journal[FLIR_SHADOW_DVO_MUXTYPE]);
+		n++;
+	}
+
+	*sent = n;
+	return ret != R_SUCCESS ? ret : mux;
+}
+
+/**
+ * flir_boson_shadow_forget - Drop cached state a foreign command may have changed
+ * @sensor: FLIR sensor device
+ * @fn_id: Function code sent behind the driver's back (ioctl passthrough)
+ *
+ * Reboot and factory restore reset everything; any other setter only
+ * invalidates the slot it maps to.
+ */
+void flir_boson_shadow_forget(struct flir_boson_dev *sensor, u32 fn_id)
+{
+	int i;
+
+	if (fn_id == BOSON_REBOOT || fn_id == BOSON_RESTOREFACTORYDEFAULTSFROMFLASH) {
+		flir_boson_shadow_invalidate(sensor);
+		return;
+	}
+
+	for (i = 0; i < FLIR_SHADOW_COUNT; i++) {
+		if (flir_shadow_fn[i].set_fn == fn_id)
+			clear_bit(i, &sensor->shadow_valid);
+	}
+}
+
+/**
+ * flir_boson_shadow_send - Send a single-u32 setter unless the camera already has @val
+ * @sensor: FLIR sensor device
+ * @id: Shadow slot mirroring this setting
+ * @cmd: Function ID of the setter
+ * @val: Value to apply
+ * @delay_ms: Worst-case processing delay passed to the dispatcher
+ *
+ * Return: R_SUCCESS when cached or applied, otherwise the command's result.
+ */
+FLR_RESULT flir_boson_shadow_send(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 cmd, u32 val, u32 delay_ms)
+{
+	FLR_RESULT ret;
+
+	lockdep_assert_held(&sensor->lock);
+
+	if (flir_boson_shadow_match(sensor, id, val)) {
+		sensor->shadow_hits++;
+		return R_SUCCESS;
+	}
+
+	ret = flir_boson_send_int_cmd(sensor, cmd, val, delay_ms);
+	flir_boson_shadow_store(sensor, id, val, ret);
+
+	return ret;
+}
+
+/**
+ * flir_boson_shadow_send_batch - Send several single-u32 setters in one batch
+ * @sensor: FLIR sensor device
+ * @ids: Shadow slots (enum flir_shadow_id), each sent with its own setter
+ * @vals: Value to apply to each slot
+ * @count: Number of slots, at most FLIR_SHADOW_COUNT
+ *
+ * Slots the camera already has are skipped, the rest go out back to back
+ * under one lock hold. Called with sensor->lock held.
+ *
+ * Return: R_SUCCESS, or the result of the first failing setter.
+ */
+FLR_RESULT flir_boson_shadow_send_batch(struct flir_boson_dev *sensor, const u8 *ids, const u32 *vals, unsigned int count)
+{
+	struct flir_boson_batch_entry *batch = sensor->shadow_batch;
+	u8 slot[FLIR_SHADOW_COUNT];
+	u32 val[FLIR_SHADOW_COUNT];
+	unsigned int i, n = 0;
+	FLR_RESULT ret;
+
+	lockdep_assert_held(&sensor->lock);
+
+	for (i = 0; i < count && n < FLIR_SHADOW_COUNT; i++) {
+		if (flir_boson_shadow_match(sensor, ids[i], vals[i])) {
+			sensor->shadow_hits++;
+			continue;
+		}
+		flir_boson_batch_set_int(&batch[n], flir_shadow_fn[ids[i]].set_fn, vals[i]);
+		batch[n].delay_ms = flir_shadow_fn[ids[i]].delay_ms;
+		slot[n] = ids[i];
+		val[n++] = vals[i];
+	}
+
+	ret = flir_boson_send_batch(sensor, batch, n);
+	for (i = 0; i < n; i++)
+		flir_boson_shadow_store(sensor, slot[i], val[i], batch[i].result);
+
+	return ret;
+}
+
+FLR_RESULT flir_boson_shadow_set_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_TYPE_E type)
+{
+	FLR_RESULT ret;
+
+	lockdep_assert_held(&sensor->lock);
+
+	if (flir_boson_shadow_match(sensor, FLIR_SHADOW_DVO_MUXTYPE, type)) {
+		sensor->shadow_hits++;
+		return R_SUCCESS;
+	}
+
+	ret = flir_boson_set_dvo_muxtype(sensor, FLR_DVOMUX_OUTPUT_IF_MIPITX, FLR_DVOMUX_SRC_IR, type);
+	flir_boson_shadow_store(sensor, FLIR_SHADOW_DVO_MUXTYPE, type, ret);
+
+	return ret;
+}
+
+/* ========================================================================
+ * Layer 4: Asynchronous Command Queue
+ * ======================================================================== */
+
+static void flir_boson_async_work(struct work_struct *work)
+{
+	struct flir_boson_async_cmd *cmd = container_of(work, struct flir_boson_async_cmd, work);
+	struct flir_boson_dev *sensor = cmd->sensor;
+
+	mutex_lock(&sensor->lock);
+	if (cmd->is_void)
+		cmd->result = flir_boson_send_void_cmd(sensor, cmd->fn_id, cmd->delay_ms);
+	else if (cmd->is_get)
+		cmd->result = flir_boson_get_int_val(sensor, cmd->fn_id, &cmd->val);
+	else
+		cmd->result = flir_boson_send_int_cmd(sensor, cmd->fn_id, cmd->val, cmd->delay_ms);
+	mutex_unlock(&sensor->lock);
+
+	if (cmd->waited) {
+		complete(&cmd->done);
+		return;
+	}
+
+	if (cmd->result != R_SUCCESS && cmd->shadow_id != FLIR_SHADOW_NONE) {
+		mutex_lock(&sensor->lock);
+		clear_bit(cmd->shadow_id, &sensor->shadow_valid);
+		mutex_unlock(&sensor->lock);
+	}
+
+	/* Fire-and-forget: nobody else will see the result */
+	if (cmd->result != R_SUCCESS) {
+		dev_err(sensor->dev, "Queued command 0x%08X failed: %s\n", cmd->fn_id, flr_result_to_string(cmd->result));
+		sensor->async_failures++;
+	}
+	kfree(cmd);
+}
+
+static struct flir_boson_async_cmd *flir_boson_async_alloc(struct flir_boson_dev *sensor, u32 cmd, u32 val, u32 delay_ms)
+{
+	struct flir_boson_async_cmd *c;
+
+	c = kzalloc(sizeof(*c), GFP_KERNEL);
+	if (!c)
+		return NULL;
+
+	INIT_WORK(&c->work, flir_boson_async_work);
+	init_completion(&c->done);
+	c->sensor    = sensor;
+	c->fn_id     = cmd;
+	c->val       = val;
+	c->delay_ms  = delay_ms;
+	c->shadow_id = FLIR_SHADOW_NONE;
+
+	return c;
+}
+
+/**
+ * flir_boson_submit_int_cmd - Queue a single-u32 command on the ordered command queue
+ * @sensor: FLIR sensor device
+ * @cmd: Function ID
+ * @val: Value to send (setters) - ignored for getters
+ * @delay_ms: Worst-case processing delay passed to the dispatcher
+ * @is_get: Command is a getter returning one u32
+ * @wait: Caller will collect the result with flir_boson_async_wait()
+ *
+ * Commands run in submission order from a per-device ordered workqueue,
+ * each one under sensor->lock, so V4L2 callers never block on them. Must
+ * not be called from the command queue itself when @wait is set.
+ *
+ * Return: the queued command when @wait is set, NULL for fire-and-forget
+ * submissions, or an ERR_PTR() on allocation failure.
+ */
+struct flir_boson_async_cmd *flir_boson_submit_int_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 val, u32 delay_ms, bool is_get, bool wait)
+{
+	struct flir_boson_async_cmd *c;
+
+	c = flir_boson_async_alloc(sensor, cmd, val, delay_ms);
+	if (!c)
+		return ERR_PTR(-ENOMEM);
+
+	c->is_get = is_get;
+	c->waited = wait;
+
+	queue_work(sensor->cmd_wq, &c->work);
+
+	return wait ? c : NULL;
+}
+
+/**
+ * flir_boson_async_wait - Wait for a queued command and release it
+ * @c: Command returned by flir_boson_submit_int_cmd() with @wait set
+ * @val: Optional, receives the getter result
+ *
+ * Return: the command's FLR_RESULT.
+ */
+FLR_RESULT flir_boson_async_wait(struct flir_boson_async_cmd *c, u32 *val)
+{
+	FLR_RESULT ret;
+
+	wait_for_completion(&c->done);
+	ret = c->result;
+	if (val && ret == R_SUCCESS)
+		*val = c->val;
+	kfree(c);
+
+	return ret;
+}
+
+/* Fire-and-forget setter; failures are logged and counted by the worker */
+int flir_boson_queue_int_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 val, u32 delay_ms)
+{
+	return PTR_ERR_OR_ZERO(flir_boson_submit_int_cmd(sensor, cmd, val, delay_ms, false, false));
+}
+
+/* Fire-and-forget command without argument or response, like flir_boson_send_void_cmd() */
+int flir_boson_queue_void_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 delay_ms)
+{
+	struct flir_boson_async_cmd *c;
+
+	c = flir_boson_async_alloc(sensor, cmd, 0, delay_ms);
+	if (!c)
+		return -ENOMEM;
+
+	c->is_void = true;
+	queue_work(sensor->cmd_wq, &c->work);
+
+	return 0;
+}
+
+/**
+ * flir_boson_shadow_queue - Queue a setter unless the camera already has @val
+ * @sensor: FLIR sensor device, sensor->lock held
+ * @id: Shadow slot mirroring this setting
+ * @cmd: Function ID of the setter
+ * @val: Value to apply
+ * @delay_ms: Worst-case processing delay passed to the dispatcher
+ *
+ * The shadow is updated at queue time so later requests for the same value
+ * are skipped while the command is still pending; the worker invalidates
+ * the slot if the command fails.
+ */
+int flir_boson_shadow_queue(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 cmd, u32 val, u32 delay_ms)
+{
+	struct flir_boson_async_cmd *c;
+
+	lockdep_assert_held(&sensor->lock);
+
+	if (flir_boson_shadow_match(sensor, id, val)) {
+		sensor->shadow_hits++;
+		return 0;
+	}
+
+	c = flir_boson_async_alloc(sensor, cmd, val, delay_ms);
+	if (!c)
+		return -ENOMEM;
+
+	c->shadow_id = id;
+
+	flir_boson_shadow_store(sensor, id, val, R_SUCCESS);
+	queue_work(sensor->cmd_wq, &c->work);
+
+	return 0;
+}
+
+/* Wait until every queued command has run. Must be called without sensor->lock. */
+void flir_boson_cmd_queue_flush(struct flir_boson_dev *sensor)
+{
+	flush_workqueue(sensor->cmd_wq);
+}
+
+int flir_boson_cmd_queue_init(struct flir_boson_dev *sensor)
+{
+	sensor->cmd_wq = alloc_ordered_workqueue("flir-boson-%s", 0, dev_name(sensor->dev));
+
+	return sensor->cmd_wq ? 0 : -ENOMEM;
+}
+
+void flir_boson_cmd_queue_destroy(struct flir_boson_dev *sensor)
+{
+	if (sensor->cmd_wq)
+		destroy_workqueue(sensor->cmd_wq); /* drains pending commands */
+	sensor->cmd_wq = NULL;
+}
+
+#if IS_ENABLED(CONFIG_FLIR_BOSON_KUNIT_TEST) || defined(FLIR_BOSON_KUNIT)
+#include "flir-boson-fslp-test.c"
+#endif
@@ -0,0 +1,195 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * FLIR Boson+ MIPI Camera V4L2 Driver - userspace interface
+ * Copyright (C) 2026, VideologyInc
+ *
+ * Private ioctls on the sensor's v4l-subdev node. Shared with userspace,
+ * so only fixed-width types and no kernel headers beyond linux/types.h.
+ */
+
+#ifndef FLIR_BOSON_IOCTL_H
+#define FLIR_BOSON_IOCTL_H
+
+#include <linux/ioctl.h>
+#include <linux/types.h>
+#include <linux/v4l2-controls.h>
+
+/* FSLP frame data minus the 12-byte sequence/function/status header */
+#define FLIR_BOSON_FSLP_MAX_PAYLOAD 756
+#define FLIR_BOSON_FSLP_MAX_CMDS    64
+/* Longest @timeout_ms accepted; the wait holds the driver's lock */
+#define FLIR_BOSON_FSLP_MAX_TIMEOUT_MS 5000
+
+/**
+ * struct flir_boson_fslp_cmd - One SDK command of a passthrough request
+ * @fn_id: Function code from FunctionCodes.h
+ * @result: FLR_RESULT returned by the camera or the transport (out)
+ * @tx_bytes: Length of the command data at @tx_data
+ * @rx_bytes: Length of the response data expected at @rx_data (in); on
+ *            R_SUCCESS the length the camera answered with, never more (out)
+ * @timeout_ms: Worst-case processing time, 0 for the driver default, up to
+ *              FLIR_BOSON_FSLP_MAX_TIMEOUT_MS
+ * @reserved: Must be zero
+ * @tx_data: Userspace pointer to the command data
+ * @rx_data: Userspace pointer to the response buffer, the first @rx_bytes
+ *           (out) filled on R_SUCCESS
+ */
+struct flir_boson_fslp_cmd {
+	__u32 fn_id;
+	__u32 result;
+	__u32 tx_bytes;
+	__u32 rx_bytes;
+	__u32 timeout_ms;
+	__u32 reserved;
+	__u64 tx_data;
+	__u64 rx_data;
+};
+
+/**
+ * struct flir_boson_ioctl_fslp - Vector of SDK commands run back to back
+ * @count: Number of entries at @cmds, 1..FLIR_BOSON_FSLP_MAX_CMDS
+ * @flags: Must be zero
+ * @cmds: Userspace pointer to an array of struct flir_boson_fslp_cmd
+ *
+ * All commands run in order under the driver's lock, so no driver
+ * transaction can interleave. A transport failure fails the remaining
+ * entries with the same result without sending them. The ioctl itself
+ * succeeds once the vector was run; check each entry's @result.
+ */
+struct flir_boson_ioctl_fslp {
+	__u32 count;
+	__u32 flags;
+	__u64 cmds;
+};
+
+#define FLIR_BOSON_STATUS_POWERED            (1U << 0) /* camera out of low-power standby */
+#define FLIR_BOSON_STATUS_STREAMING          (1U << 1)
+#define FLIR_BOSON_STATUS_CAMERA_VALID       (1U << 2) /* camera fields were read at least once */
+#define FLIR_BOSON_STATUS_TELEMETRY_EMBEDDED (1U << 3)
+
+/**
+ * struct flir_boson_status - Health snapshot kept by the driver
+ * @flags: FLIR_BOSON_STATUS_* bits, current
+ * @mipi_state: FLR_DVO_MIPI_STATE_E last applied, current
+ * @ffc_status: FLR_BOSON_FFCSTATUS_E at the last refresh
+ * @ffc_frame: Frame counter of the last FFC at the last refresh
+ * @fpa_temp_dc: FPA temperature in 0.1 degrees Celsius at the last refresh
+ * @interval_ms: Refresh period, 0 if refreshing is off
+ * @timestamp_ns: CLOCK_MONOTONIC time of the last refresh, 0 if never
+ * @commands: SDK commands dispatched by the driver, current
+ * @failures: Commands that failed, current
+ * @resyncs: FSLP frames recovered by resynchronizing, current
+ * @replays: Commands resent after a transport error, current
+ * @recovered: Replays that succeeded, current
+ * @profile: enum flir_boson_processing_profile selected, current
+ * @latency_min: LATENCYCTRL_GETLATENCY minimum in milli-units at the last refresh
+ * @latency_max: LATENCYCTRL_GETLATENCY maximum in milli-units at the last refresh
+ * @reserved: Zero
+ *
+ * Camera fields are refreshed by the driver in the background while the
+ * camera is powered; reading the snapshot never touches the bus.
+ */
+struct flir_boson_status {
+	__u32 flags;
+	__u32 mipi_state;
+	__u32 ffc_status;
+	__u32 ffc_frame;
+	__s32 fpa_temp_dc;
+	__u32 interval_ms;
+	__u64 timestamp_ns;
+	__u64 commands;
+	__u64 failures;
+	__u32 resyncs;
+	__u32 replays;
+	__u32 recovered;
+	__u32 profile;
+	__u32 latency_min;
+	__u32 latency_max;
+	__u32 reserved[2];
+};
+
+/*
+ * V4L2_CID_FLIR_PROCESSING_PROFILE menu: filter states applied as one
+ * batch at stream-on. Temporal filtering and frame averaging smear motion,
+ * the spatial filters each add processing delay.
+ */
+enum flir_boson_processing_profile {
+	FLIR_BOSON_PROFILE_CAMERA,      /* filters left as the camera has them */
+	FLIR_BOSON_PROFILE_LOW_LATENCY, /* SPNR, SCNR, SRNR, TF and averager off */
+	FLIR_BOSON_PROFILE_BALANCED,    /* SCNR and SRNR on */
+	FLIR_BOSON_PROFILE_LOW_NOISE,   /* all on */
+	FLIR_BOSON_PROFILE_COUNT,
+};
+
+/**
+ * struct flir_boson_snapshot - Payload of V4L2_EVENT_FLIR_BOSON_SNAPSHOT
+ * @result: FLR_RESULT of the capture, R_SUCCESS (0) when the frame is ready
+ * @bytes: Size of the frame in capture buffer 0, MEM_GETCAPTURESIZE
+ * @rows: Frame height
+ * @columns: Frame width
+ * @elapsed_ms: Time from the V4L2_CID_FLIR_SNAPSHOT request to the event
+ *
+ * Laid over v4l2_event.u.data in host byte order. The frame is read with
+ * MEM_READCAPTURE on buffer 0 through FLIR_BOSON_IOCTL_FSLP_FRAME, which
+ * leaves the video stream alone.
+ */
+struct flir_boson_snapshot {
+	__u32 result;
+	__u32 bytes;
+	__u16 rows;
+	__u16 columns;
+	__u32 elapsed_ms;
+};
+
+/*
+ * Driver-private V4L2 controls of the sensor subdev. 64 IDs are kept at
+ * +0x1f00, clear of the bases drivers reserve in <linux/v4l2-controls.h>
+ * (0x1000..0x11ff today; +0x10f0 is V4L2_CID_USER_CCS_BASE).
+ */
+#define V4L2_CID_USER_FLIR_BOSON_BASE      (V4L2_CID_USER_BASE + 0x1f00)
+#define V4L2_CID_FLIR_AGC_PLATEAU          (V4L2_CID_USER_FLIR_BOSON_BASE + 0)
+#define V4L2_CID_FLIR_AGC_LINEAR_PERCENT   (V4L2_CID_USER_FLIR_BOSON_BASE + 1)
+#define V4L2_CID_FLIR_AGC_MAX_GAIN         (V4L2_CID_USER_FLIR_BOSON_BASE + 2)
+#define V4L2_CID_FLIR_AGC_GAMMA            (V4L2_CID_USER_FLIR_BOSON_BASE + 3)
+#define V4L2_CID_FLIR_AGC_OUTLIER_CUT      (V4L2_CID_USER_FLIR_BOSON_BASE + 4)
+#define V4L2_CID_FLIR_AGC_D2BR             (V4L2_CID_USER_FLIR_BOSON_BASE + 5)
+#define V4L2_CID_FLIR_AGC_USE_ENTROPY      (V4L2_CID_USER_FLIR_BOSON_BASE + 6)
+#define V4L2_CID_FLIR_AGC_APPLY            (V4L2_CID_USER_FLIR_BOSON_BASE + 7)
+#define V4L2_CID_FLIR_FFC_MODE             (V4L2_CID_USER_FLIR_BOSON_BASE + 8)
+#define V4L2_CID_FLIR_FFC_RUN              (V4L2_CID_USER_FLIR_BOSON_BASE + 9)
+#define V4L2_CID_FLIR_LOW_LATENCY          (V4L2_CID_USER_FLIR_BOSON_BASE + 10)
+#define V4L2_CID_FLIR_JITTER_REDUCTION     (V4L2_CID_USER_FLIR_BOSON_BASE + 11)
+#define V4L2_CID_FLIR_JITTER_LINE          (V4L2_CID_USER_FLIR_BOSON_BASE + 12)
+#define V4L2_CID_FLIR_LATENCY_RESET        (V4L2_CID_USER_FLIR_BOSON_BASE + 13)
+#define V4L2_CID_FLIR_LATENCY_MIN          (V4L2_CID_USER_FLIR_BOSON_BASE + 14)
+#define V4L2_CID_FLIR_LATENCY_MAX          (V4L2_CID_USER_FLIR_BOSON_BASE + 15)
+#define V4L2_CID_FLIR_JITTER_MIN           (V4L2_CID_USER_FLIR_BOSON_BASE + 16)
+#define V4L2_CID_FLIR_JITTER_MAX           (V4L2_CID_USER_FLIR_BOSON_BASE + 17)
+#define V4L2_CID_FLIR_STATS_INTERVAL       (V4L2_CID_USER_FLIR_BOSON_BASE + 18)
+#define V4L2_CID_FLIR_STATS_MEAN           (V4L2_CID_USER_FLIR_BOSON_BASE + 19)
+#define V4L2_CID_FLIR_STATS_PEAK           (V4L2_CID_USER_FLIR_BOSON_BASE + 20)
+#define V4L2_CID_FLIR_STATS_BASE           (V4L2_CID_USER_FLIR_BOSON_BASE + 21)
+#define V4L2_CID_FLIR_STATS_ROI_MEAN       (V4L2_CID_USER_FLIR_BOSON_BASE + 22)
+#define V4L2_CID_FLIR_STATS_ROI_FIRST_BIN  (V4L2_CID_USER_FLIR_BOSON_BASE + 23)
+#define V4L2_CID_FLIR_STATS_ROI_LAST_BIN   (V4L2_CID_USER_FLIR_BOSON_BASE + 24)
+#define V4L2_CID_FLIR_COLOR_LUT           (V4L2_CID_USER_FLIR_BOSON_BASE + 25)
+#define V4L2_CID_FLIR_COLOR_LUT_ENABLE    (V4L2_CID_USER_FLIR_BOSON_BASE + 26)
+#define V4L2_CID_FLIR_ISOTHERM_ENABLE     (V4L2_CID_USER_FLIR_BOSON_BASE + 27)
+#define V4L2_CID_FLIR_ISOTHERM_UNIT       (V4L2_CID_USER_FLIR_BOSON_BASE + 28)
+#define V4L2_CID_FLIR_ISOTHERM_T1         (V4L2_CID_USER_FLIR_BOSON_BASE + 29) /* T1..T5 are consecutive */
+#define V4L2_CID_FLIR_EXT_SYNC_MODE       (V4L2_CID_USER_FLIR_BOSON_BASE + 34)
+#define V4L2_CID_FLIR_EXT_SYNC_STATUS     (V4L2_CID_USER_FLIR_BOSON_BASE + 35)
+#define V4L2_CID_FLIR_PROCESSING_PROFILE  (V4L2_CID_USER_FLIR_BOSON_BASE + 36)
+#define V4L2_CID_FLIR_SNAPSHOT            (V4L2_CID_USER_FLIR_BOSON_BASE + 37)
+#define V4L2_CID_FLIR_SNAPSHOT_SOURCE     (V4L2_CID_USER_FLIR_BOSON_BASE + 38) /* FLR_CAPTURE_SRC_E */
+#define V4L2_CID_FLIR_OVERLAY_CROSSHAIR   (V4L2_CID_USER_FLIR_BOSON_BASE + 39)
+#define V4L2_CID_FLIR_OVERLAY_CROSSHAIR_X (V4L2_CID_USER_FLIR_BOSON_BASE + 40) /* sensor pixels */
+#define V4L2_CID_FLIR_OVERLAY_CROSSHAIR_Y (V4L2_CID_USER_FLIR_BOSON_BASE + 41)
+#define V4L2_CID_FLIR_OVERLAY_COLOR       (V4L2_CID_USER_FLIR_BOSON_BASE + 42) /* 0xRRGGBB */
+#define V4L2_CID_FLIR_OVERLAY_TEXT        (V4L2_CID_USER_FLIR_BOSON_BASE + 43) /* empty hides it */
+#define FLIR_ISOTHERM_TEMPS               5
+
+#define FLIR_BOSON_IOCTL_FSLP_FRAME   _IOWR('F', 0x01, struct flir_boson_ioctl_fslp)
+#define FLIR_BOSON_IOCTL_GET_STATUS   _IOR('F', 0x03, struct flir_boson_status)
+
+#endif /* FLIR_BOSON_IOCTL_H */
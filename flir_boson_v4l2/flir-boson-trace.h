@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * FLIR Boson+ FSLP transport tracepoints
+ * Copyright (C) 2026, VideologyInc
+ *
+ * Enable with: echo 1 > /sys/kernel/tracing/events/flir_boson/enable
+ * Each event carries the I2C adapter number and address so several
+ * cameras can be told apart.
+ */
+
+#undef TRACE_SYSTEM
+#define TRACE_SYSTEM flir_boson
+
+#if !defined(_FLIR_BOSON_TRACE_H) || defined(TRACE_HEADER_MULTI_READ)
+#define _FLIR_BOSON_TRACE_H
+
+#include <linux/i2c.h>
+#include <linux/tracepoint.h>
+#include "flir-boson.h"
+
+TRACE_EVENT(flir_fslp_send_frame,
+	TP_PROTO(const struct flir_boson_dev *sensor, const u8 *payload, u32 len, int ret),
+	TP_ARGS(sensor, payload, len, ret),
+	TP_STRUCT__entry(
+		__field(int, adapter)
+		__field(u16, addr)
+		__field(u32, len)
+		__field(int, ret)
+		__dynamic_array(u8, data, len)
+	),
+	TP_fast_assign(
+		__entry->adapter = i2c_adapter_id(sensor->i2c_client->adapter);
+		__entry->addr    = sensor->i2c_client->addr;
+		__entry->len     = len;
+		__entry->ret     = ret;
+		memcpy(__get_dynamic_array(data), payload, len);
+	),
+	TP_printk("i2c-%d-%04x len=%u ret=%d payload=%s", __entry->adapter, __entry->addr, __entry->len, __entry->ret,
+		  __print_hex(__get_dynamic_array(data), __get_dynamic_array_len(data)))
+);
+
+/* One per read attempt, including polls that find the TX buffer idle (0xFFFF) */
+TRACE_EVENT(flir_fslp_read_header,
+	TP_PROTO(const struct flir_boson_dev *sensor, const u8 *hdr, u32 readahead, int ret),
+	TP_ARGS(sensor, hdr, readahead, ret),
+	TP_STRUCT__entry(
+		__field(int, adapter)
+		__field(u16, addr)
+		__field(u16, magic)
+		__field(u16, len)
+		__field(u32, readahead)
+		__field(int, ret)
+	),
+	TP_fast_assign(
+		__entry->adapter   = i2c_adapter_id(sensor->i2c_client->adapter);
+		__entry->addr      = sensor->i2c_client->addr;
+		__entry->magic     = (hdr[0] << 8) | hdr[1];
+		__entry->len       = (hdr[2] << 8) | hdr[3];
+		__entry->readahead = readahead;
+		__entry->ret       = ret;
+	),
+	TP_printk("i2c-%d-%04x magic=0x%04x len=%u readahead=%u ret=%d", __entry->adapter, __entry->addr, __entry->magic, __entry->len,
+		  __entry->readahead, __entry->ret)
+);
+
+TRACE_EVENT(flir_fslp_read_payload,
+	TP_PROTO(const struct flir_boson_dev *sensor, const u8 *payload, u32 len),
+	TP_ARGS(sensor, payload, len),
+	TP_STRUCT__entry(
+		__field(int, adapter)
+		__field(u16, addr)
+		__field(u32, len)
+		__dynamic_array(u8, data, len)
+	),
+	TP_fast_assign(
+		__entry->adapter = i2c_adapter_id(sensor->i2c_client->adapter);
+		__entry->addr    = sensor->i2c_client->addr;
+		__entry->len     = len;
+		memcpy(__get_dynamic_array(data), payload, len);
+	),
+	TP_printk("i2c-%d-%04x len=%u payload=%s", __entry->adapter, __entry->addr, __entry->len,
+		  __print_hex(__get_dynamic_array(data), __get_dynamic_array_len(data)))
+);
+
+TRACE_EVENT(flir_fslp_retry,
+	TP_PROTO(const struct flir_boson_dev *sensor, u32 seq, u32 fn_id, u32 got_seq, int resp_len),
+	TP_ARGS(sensor, seq, fn_id, got_seq, resp_len),
+	TP_STRUCT__entry(
+		__field(int, adapter)
+		__field(u16, addr)
+		__field(u32, seq)
+		__field(u32, fn_id)
+		__field(u32, got_seq)
+		__field(int, resp_len)
+	),
+	TP_fast_assign(
+		__entry->adapter  = i2c_adapter_id(sensor->i2c_client->adapter);
+		__entry->addr     = sensor->i2c_client->addr;
+		__entry->seq      = seq;
+		__entry->fn_id    = fn_id;
+		__entry->got_seq  = got_seq;
+		__entry->resp_len = resp_len;
+	),
+	TP_printk("i2c-%d-%04x fn_id=0x%08x seq=0x%08x got_seq=0x%08x resp_len=%d", __entry->adapter, __entry->addr, __entry->fn_id,
+		  __entry->seq, __entry->got_seq, __entry->resp_len)
+);
+
+TRACE_EVENT(flir_fslp_cmd_done,
+	TP_PROTO(const struct flir_boson_dev *sensor, u32 seq, u32 fn_id, u32 send_bytes, u32 recv_bytes, u32 status, u32 lat_us, u32 retries),
+	TP_ARGS(sensor, seq, fn_id, send_bytes, recv_bytes, status, lat_us, retries),
+	TP_STRUCT__entry(
+		__field(int, adapter)
+		__field(u16, addr)
+		__field(u32, seq)
+		__field(u32, fn_id)
+		__field(u32, send_bytes)
+		__field(u32, recv_bytes)
+		__field(u32, status)
+		__field(u32, lat_us)
+		__field(u32, retries)
+	),
+	TP_fast_assign(
+		__entry->adapter    = i2c_adapter_id(sensor->i2c_client->adapter);
+		__entry->addr       = sensor->i2c_client->addr;
+		__entry->seq        = seq;
+		__entry->fn_id      = fn_id;
+		__entry->send_bytes = send_bytes;
+		__entry->recv_bytes = recv_bytes;
+		__entry->status     = status;
+		__entry->lat_us     = lat_us;
+		__entry->retries    = retries;
+	),
+	TP_printk("i2c-%d-%04x fn_id=0x%08x seq=0x%08x tx=%u rx=%u status=%u lat_us=%u retries=%u", __entry->adapter, __entry->addr,
+		  __entry->fn_id, __entry->seq, __entry->send_bytes, __entry->recv_bytes, __entry->status, __entry->lat_us, __entry->retries)
+);
+
+#endif /* _FLIR_BOSON_TRACE_H */
+
+/* This part must be outside protection */
+#undef TRACE_INCLUDE_PATH
+#define TRACE_INCLUDE_PATH .
+#undef TRACE_INCLUDE_FILE
+#define TRACE_INCLUDE_FILE flir-boson-trace
+#include <trace/define_trace.h>
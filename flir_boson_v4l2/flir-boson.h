@@ -10,6 +10,9 @@
 #include <linux/i2c.h>
 #include <linux/types.h>
 #include <linux/gpio/consumer.h>
+#include <linux/atomic.h>
+#include <linux/completion.h>
+#include <linux/workqueue.h>
 #include <media/v4l2-async.h>
 #include <media/v4l2-ctrls.h>
 #include <media/v4l2-device.h>
@@ -18,6 +21,7 @@
 #include <media/v4l2-subdev.h>
 
 #include "EnumTypes.h"
+#include "flir-boson-ioctl.h"
 #include "ReturnCodes.h"
 /* Forward declarations to avoid circular includes */
 
@@ -27,7 +31,7 @@
 #define FLIR_MAGIC_TOKEN_0    0x8E
 #define FLIR_MAGIC_TOKEN_1    0xA1
 #define FLIR_FSLP_HEADER_SIZE 4
-#define FLIR_FSLP_MAX_DATA    256
+#define FLIR_FSLP_MAX_DATA    768 /* Boson maximum FSLP payload, as MAX_PAYLOAD_BYTES in the C SDK */
 
 /* Supported Formats */
 struct flir_boson_format {
@@ -35,15 +39,89 @@ struct flir_boson_format {
 	u32 flir_type;
 	u32 flir_mux_type;
 	const char *name;
+	u8 csi2_dt; /* CSI-2 data type on the wire */
+	u8 bpp;
 };
 
+/*
+ * FFC progress, polled from BOSON_GETFFCSTATUS while streaming.
+ * u.data[0] holds the FLR_BOSON_FFCSTATUS_E the camera moved to:
+ * FLR_BOSON_FFC_IMMINENT, FLR_BOSON_FFC_IN_PROGRESS or FLR_BOSON_FFC_COMPLETE.
+ */
+#define V4L2_EVENT_FLIR_BOSON_FFC          (V4L2_EVENT_PRIVATE_START + 0x10f0)
+#define FLIR_BOSON_FFC_POLL_MS             100
+
+/*
+ * The GET_STATUS snapshot changed: flags, MIPI state, FFC status or count,
+ * or the failure counter. No payload, read the snapshot with the ioctl.
+ */
+#define V4L2_EVENT_FLIR_BOSON_STATUS       (V4L2_EVENT_PRIVATE_START + 0x10f1)
+
+/*
+ * A V4L2_CID_FLIR_SNAPSHOT capture finished or failed, u.data holds a
+ * struct flir_boson_snapshot. CAPTURE_GETSTATUS is polled until then.
+ */
+#define V4L2_EVENT_FLIR_BOSON_SNAPSHOT     (V4L2_EVENT_PRIVATE_START + 0x10f2)
+#define FLIR_BOSON_SNAPSHOT_POLL_MS        20
+#define FLIR_BOSON_SNAPSHOT_TIMEOUT_MS     2000
+
+/* AGC parameters cached in controls and applied in one batch */
+enum flir_agc_param {
+	FLIR_AGC_PLATEAU,
+	FLIR_AGC_LINEAR_PERCENT,
+	FLIR_AGC_MAX_GAIN,
+	FLIR_AGC_GAMMA,
+	FLIR_AGC_OUTLIER_CUT,
+	FLIR_AGC_D2BR,
+	FLIR_AGC_USE_ENTROPY,
+	FLIR_AGC_BRIGHTNESS,
+	FLIR_AGC_NUM,
+};
+
+/*
+ * Overlays drawn by the camera's symbology engine. The driver owns the
+ * top symbol IDs; applications using SYMBOLOGY_* through the SDK keep
+ * below FLIR_OVERLAY_FIRST_ID.
+ */
+#define FLIR_OVERLAY_FIRST_ID        125
+#define FLIR_OVERLAY_ID_HLINE        125 /* crosshair arms */
+#define FLIR_OVERLAY_ID_VLINE        126
+#define FLIR_OVERLAY_ID_TEXT         127
+#define FLIR_OVERLAY_CROSSHAIR_ARM   16  /* pixels from the center to each end */
+#define FLIR_OVERLAY_TEXT_MAX        31
+#define FLIR_OVERLAY_TEXT_SIZE       16
+#define FLIR_OVERLAY_CMDS            7   /* largest batch: enable, two lines and the text, three shows */
+#define FLIR_SYMBOL_MAX_BYTES        146 /* SYMBOLOGY_CREATETEXT, with its 128-byte text */
+
+/* Size of per-format caches, must cover flir_boson_formats[] */
+#define FLIR_BOSON_MAX_FORMATS 3
+
+/* Pixel rate and link frequency derived from GetClockInfo for one format */
+struct flir_boson_mode_rates {
+	u64 pixel_rate;
+	u64 link_freq;
+	u32 fps_milli; /* camera output rate before frame skipping */
+	bool valid;
+};
+
+/* ROIC_SETFRAMESKIP: output every (skip + 1)th frame */
+#define FLIR_BOSON_MAX_FRAME_SKIP 7
+
 /* Supported Frame Sizes */
 struct flir_boson_framesize {
 	u32 width;
 	u32 height;
 	u32 max_fps;
+	u32 telemetry_rows; /* rows of in-band telemetry included in height */
 };
 
+/* Telemetry is two 16-bit lines at sensor width */
+#define FLIR_BOSON_TELEMETRY_LINES 2
+
+/* Frame descriptor streams */
+#define FLIR_BOSON_STREAM_IMAGE     0
+#define FLIR_BOSON_STREAM_TELEMETRY 1
+
 /* FSLP Command Structure */
 struct flir_fslp_cmd {
 	u8 magic[2];
@@ -51,6 +129,144 @@ struct flir_fslp_cmd {
 	u8 data[];
 } __packed;
 
+/* Per-command dispatcher statistics (debugfs) */
+#define FLIR_STATS_SLOTS       64
+#define FLIR_STATS_LAT_BUCKETS 24 /* log2 microsecond buckets, last one open-ended */
+
+struct flir_cmd_stats {
+	u32 fn_id; /* 0 = free slot, no Boson command uses it */
+	u64 calls;
+	u64 failures;
+	u64 retries;
+	u64 mismatches;
+	u64 lat_sum_us;
+	u32 lat_min_us;
+	u32 lat_max_us;
+	u32 lat_hist[FLIR_STATS_LAT_BUCKETS];
+};
+
+/* Stream-on/off latency as seen by the s_stream caller (debugfs) */
+struct flir_stream_stats {
+	u64 count;
+	u64 sum_us;
+	u32 last_us;
+	u32 min_us;
+	u32 max_us;
+};
+
+/*
+ * Driver event ring (debugfs "events"): configuration, FFC, errors and
+ * state transitions, in place of console output. Writers never block or
+ * take a lock; a slot holds its event's sequence number once complete, so
+ * readers skip slots being rewritten.
+ */
+#define FLIR_EVENT_RING 256 /* power of two */
+#define FLIR_EVENT_ARGS 3
+
+enum flir_event_type {
+	FLIR_EVENT_CONFIG,
+	FLIR_EVENT_FFC,
+	FLIR_EVENT_ERROR,
+	FLIR_EVENT_STATE,
+};
+
+struct flir_event {
+	u64 ts_ns;       /* ktime_get_ns() */
+	const char *fmt; /* string literal, printed with args by the reader */
+	u32 args[FLIR_EVENT_ARGS];
+	u32 seq;         /* 0 while written */
+	u8 type;
+};
+
+/* FSLP transport recovery counters (debugfs) */
+struct flir_fslp_recovery {
+	u32 resyncs;        /* frames found behind stray bytes by the magic scan */
+	u32 stale_drops;    /* late responses to earlier commands drained by sequence */
+	u32 replays;        /* commands resent after a transport error */
+	u32 recovered;      /* replays that succeeded */
+	u32 flush_failures; /* RX buffer never read back idle */
+};
+
+/* IMAGESTATS readings, one read-only control each */
+enum flir_image_stat {
+	FLIR_STAT_MEAN,
+	FLIR_STAT_PEAK,
+	FLIR_STAT_BASE,
+	FLIR_STAT_ROI_MEAN,
+	FLIR_STAT_ROI_FIRST_BIN,
+	FLIR_STAT_ROI_LAST_BIN,
+	FLIR_STAT_NUM,
+};
+
+/* Camera side of the GET_STATUS snapshot, refreshed by health_work */
+struct flir_boson_health {
+	u64 timestamp_ns; /* ktime_get_ns() of the last refresh, 0 if never */
+	u32 ffc_status;
+	u32 ffc_frame;
+	s32 fpa_temp_dc;
+	u32 latency_min; /* milli-units, 0 if the camera did not report it */
+	u32 latency_max;
+};
+
+/* Camera settings mirrored in the shadow register cache */
+enum flir_shadow_id {
+	FLIR_SHADOW_MIPI_STATE,
+	FLIR_SHADOW_CLOCK_LANE,
+	FLIR_SHADOW_OPERATING_MODE,
+	FLIR_SHADOW_DVO_TYPE,
+	FLIR_SHADOW_DVO_OUTPUT_FORMAT,
+	FLIR_SHADOW_DVO_OUTPUT_IF,
+	FLIR_SHADOW_DVO_MUXTYPE,
+	FLIR_SHADOW_TELEMETRY_STATE,
+	FLIR_SHADOW_TELEMETRY_LOCATION,
+	FLIR_SHADOW_TELEMETRY_TAG,
+	FLIR_SHADOW_GAIN_MODE,
+	FLIR_SHADOW_AGC_MODE,
+	FLIR_SHADOW_FRAME_SKIP,
+	FLIR_SHADOW_FFC_MODE,
+	FLIR_SHADOW_LOW_LATENCY,
+	FLIR_SHADOW_COLOR_LUT,
+	FLIR_SHADOW_COLOR_LUT_STATE,
+	FLIR_SHADOW_ISOTHERM_STATE,
+	FLIR_SHADOW_ISOTHERM_UNIT,
+	FLIR_SHADOW_EXT_SYNC,
+	FLIR_SHADOW_SPNR_STATE,
+	FLIR_SHADOW_SCNR_STATE,
+	FLIR_SHADOW_SRNR_STATE,
+	FLIR_SHADOW_TF_STATE,
+	FLIR_SHADOW_AVERAGER_STATE,
+	FLIR_SHADOW_COUNT,
+	FLIR_SHADOW_NONE = -1,
+};
+
+/* Command queued on the per-device ordered workqueue */
+struct flir_boson_async_cmd {
+	struct work_struct work;
+	struct flir_boson_dev *sensor;
+	struct completion done;
+	u32 fn_id;
+	u32 val; /* value sent, or value received for getters */
+	u32 delay_ms;
+	FLR_RESULT result;
+	bool is_get;
+	bool is_void; /* no argument or response data, e.g. BOSON_RUNFFC */
+	bool waited; /* submitter frees it after flir_boson_async_wait() */
+	int shadow_id; /* enum flir_shadow_id to invalidate on failure */
+};
+
+/* One command of a flir_boson_send_batch() call */
+struct flir_boson_batch_entry {
+	u32 fn_id;
+	const u8 *send_data;
+	u32 send_bytes;
+	u8 *recv_data;
+	u32 recv_bytes; /* in: expected, out: received */
+	u32 delay_ms;
+	u32 *val_out; /* u32 getters: decoded response */
+	u8 val_buf[4]; /* payload storage for the u32 helpers */
+	FLR_RESULT result;
+};
+
 /* Device State */
 
 struct flir_boson_dev {
@@ -60,7 +276,15 @@ struct flir_boson_dev {
 	struct media_pad pad;
 	struct v4l2_fwnode_endpoint ep;
 	struct gpio_desc *reset_gpio;
+	/*
+	 * lock serializes configuration and every FSLP transaction, and may be
+	 * held across camera sleeps. state_lock only guards the published view
+	 * (fmt, current_format/framesize, frame_skip, fps_milli, crop,
+	 * telemetry_embedded) so queries never wait for the camera. Writers
+	 * hold both.
+	 */
 	struct mutex lock;
+	spinlock_t state_lock;
 
 	/* Format management */
 	struct v4l2_mbus_framefmt fmt;
@@ -71,17 +295,116 @@ struct flir_boson_dev {
 	u32 mipi_state;
 	bool streaming;
 	bool powered;
+	bool telemetry_embedded; /* telemetry sent as CSI-2 embedded data, not image rows */
 	u64 pixel_rate;
 	u64 link_freq;
+	u32 fps_milli; /* from GetClockInfo for the current format */
+	u32 frame_skip;
+	struct v4l2_rect crop; /* scaler zoom window, in sensor pixels */
+	u32 max_zoom; /* SCALER_GETMAXZOOM, 1 if the camera cannot zoom */
+	bool zoom_dirty; /* crop changed in standby, sent at power-on */
+
+	/* V4L2 controls, protected by lock */
+	struct v4l2_ctrl_handler ctrls;
+	struct v4l2_ctrl *pixel_rate_ctrl;
+	struct v4l2_ctrl *link_freq_ctrl;
+	s64 link_freq_menu[FLIR_BOSON_MAX_FORMATS]; /* used without DT link-frequencies */
+	struct flir_boson_mode_rates rates[FLIR_BOSON_MAX_FORMATS];
+	struct v4l2_ctrl *agc_ctrls[FLIR_AGC_NUM];
+	unsigned long agc_dirty; /* changed since last apply, one bit per enum flir_agc_param */
+	struct v4l2_ctrl *ffc_mode_ctrl;
+	struct v4l2_ctrl *low_latency_ctrl;
+	/* Cluster: LATENCYCTRL_SETJITTERREDUCTION takes both values */
+	struct v4l2_ctrl *jitter_ctrl;
+	struct v4l2_ctrl *jitter_line_ctrl;
+	bool jitter_dirty; /* changed in standby, sent at power-on */
+	/* Volatile cluster: latency min/max, jitter min/max */
+	struct v4l2_ctrl *latency_ctrls[4];
+	struct v4l2_ctrl *stats_interval_ctrl;
+	struct v4l2_ctrl *stats_ctrls[FLIR_STAT_NUM];
+	struct v4l2_ctrl *color_lut_ctrl;
+	struct v4l2_ctrl *color_lut_enable_ctrl;
+	struct v4l2_ctrl *isotherm_ctrl;
+	struct v4l2_ctrl *isotherm_unit_ctrl;
+	/* Cluster: ISOTHERM_SETTEMPS takes all five thresholds */
+	struct v4l2_ctrl *isotherm_temp_ctrls[FLIR_ISOTHERM_TEMPS];
+	bool isotherm_dirty; /* changed in standby, sent at power-on */
+	struct v4l2_ctrl *ext_sync_ctrl; /* FLR_BOSON_EXT_SYNC_MODE_E, applied at stream-on */
+	struct v4l2_ctrl *ext_sync_status_ctrl;
+	struct v4l2_ctrl *profile_ctrl; /* enum flir_boson_processing_profile, applied at stream-on */
+	struct v4l2_ctrl *snapshot_src_ctrl; /* FLR_CAPTURE_SRC_E of the next snapshot */
+	/* Cluster: crosshair enable, x, y, color and the text, drawn by the camera */
+	struct v4l2_ctrl *crosshair_ctrl;
+	struct v4l2_ctrl *crosshair_x_ctrl;
+	struct v4l2_ctrl *crosshair_y_ctrl;
+	struct v4l2_ctrl *overlay_color_ctrl;
+	struct v4l2_ctrl *overlay_text_ctrl;
+	bool overlay_dirty; /* overlays changed in standby or lost by the camera, drawn at power-on */
+	bool crosshair_shown; /* what the camera displays now */
+	bool text_shown;
+	struct flir_boson_batch_entry overlay_batch[FLIR_OVERLAY_CMDS];
+	u8 overlay_data[FLIR_OVERLAY_CMDS][FLIR_SYMBOL_MAX_BYTES];
+
+	/* IMAGESTATS sampling, runs while streaming with a non-zero interval */
+	struct delayed_work stats_work;
+
+	/* Health snapshot refresh; health is guarded by state_lock */
+	struct delayed_work health_work;
+	struct list_head list; /* in flir_boson_devices, for status_interval_ms writes */
+	struct flir_boson_health health;
+	struct flir_boson_status status_last; /* last snapshot, to detect changes */
+
+	/* FFC event polling, runs while streaming with at least one subscriber */
+	struct delayed_work ffc_work;
+	atomic_t ffc_subscribers;
+	u32 ffc_status; /* last polled FLR_BOSON_FFCSTATUS_E, FFCSTATUS_END if unknown */
+
+	/* Snapshot capture polling, one capture at a time */
+	struct delayed_work snapshot_work;
+	ktime_t snapshot_start; /* request time, 0 when none is running; guarded by lock */
 
 	/* Camera information */
 	u32 camera_sn;
+	u32 sensor_width; /* 320 or 640 core, from GetClockInfo at probe */
 	unsigned int csi_id;
 
-/* FSLP communication */
-u8 fslp_tx_buf[FLIR_FSLP_MAX_DATA];
-u8 fslp_rx_buf[FLIR_FSLP_MAX_DATA];
+/* FSLP communication, buffers protected by lock */
+u8 fslp_tx_buf[FLIR_FSLP_HEADER_SIZE + FLIR_FSLP_MAX_DATA]; /* frame being sent */
+u8 fslp_rx_buf[FLIR_FSLP_HEADER_SIZE + FLIR_FSLP_MAX_DATA]; /* frame being read */
+u8 fslp_resp_buf[FLIR_FSLP_MAX_DATA]; /* response payload for the dispatcher */
 u32 command_count; /* Sequence number for commands */
+u32 i2c_xfer_count; /* I2C transactions issued */
+u16 i2c_max_read; /* adapter read length limit, 0 if none */
+u16 i2c_max_write; /* adapter write length limit, 0 if none */
+u32 i2c_bus_hz; /* adapter clock-frequency, 0 if unknown */
+u64 i2c_bytes; /* bytes moved by I2C transactions */
+u64 i2c_busy_ns; /* time spent in i2c_transfer() */
+bool rx_dirty; /* RX buffer may hold stale bytes, flush before next command */
+bool booting; /* Camera not answering yet, transport errors are expected */
+
+	/* Last value applied to the camera, valid while bit set in shadow_valid */
+	u32 shadow[FLIR_SHADOW_COUNT];
+	unsigned long shadow_valid;
+	u32 shadow_hits;
+	/* Scratch for the cache's batches, too large for the stack; under lock */
+	struct flir_boson_batch_entry shadow_batch[FLIR_SHADOW_COUNT];
+	u32 suspend_uptime; /* SYSCTRL_GETUPTIMESECS at system suspend */
+	bool resume_streaming; /* streaming when the system suspended */
+	bool resume_standby; /* runtime suspended when the system suspended */
+
+	/* Asynchronous command queue */
+	struct workqueue_struct *cmd_wq;
+	u32 async_failures;
+
+	/* Debug statistics */
+	struct dentry *debugfs;
+	struct flir_cmd_stats cmd_stats[FLIR_STATS_SLOTS];
+	u32 cmd_stats_dropped;
+	struct flir_stream_stats stream_on_stats;
+	struct flir_stream_stats stream_off_stats;
+	struct flir_fslp_recovery fslp_recovery;
+	struct flir_event events[FLIR_EVENT_RING];
+	atomic_t event_head; /* sequence number of the last event claimed */
 };
 
 // Results of 80 bytes data = 20 values of uint32 and float from GetClockInfo command.
@@ -101,24 +424,88 @@ struct boson_clockinfo {
 };
 
 
-/* IOCTL Commands */
-#define FLIR_BOSON_IOCTL_FSLP_FRAME   _IOWR('F', 0x01, struct flir_boson_ioctl_fslp)
-#define FLIR_BOSON_IOCTL_GET_STATUS   _IOR('F', 0x03, u32)
-
 /* Function prototypes - I2C Layer */
 FLR_RESULT I2C_readFrame(struct flir_boson_dev *sensor, u8* readData, u32* readBytes);
 FLR_RESULT I2C_writeFrame(struct flir_boson_dev *sensor, u8* writeData, u32 writeBytes);
 
+/* Layer 2: Batched dispatch, callers hold sensor->lock */
+FLR_RESULT flir_boson_send_batch(struct flir_boson_dev *sensor, struct flir_boson_batch_entry *entries, unsigned int count);
+void flir_boson_batch_set_int(struct flir_boson_batch_entry *e, u32 cmd, u32 val);
+void flir_boson_batch_get_int(struct flir_boson_batch_entry *e, u32 cmd, u32 *val);
+void flir_boson_batch_symbol_enable(struct flir_boson_batch_entry *e, u8 *buf, bool enable);
+void flir_boson_batch_symbol_line(struct flir_boson_batch_entry *e, u8 *buf, u8 id, s16 x, s16 y, s16 x2, s16 y2, u32 color);
+void flir_boson_batch_symbol_text(struct flir_boson_batch_entry *e, u8 *buf, u8 id, s16 x, s16 y, s16 width, s16 height,
+				  s16 size, u32 color, const char *text);
+void flir_boson_batch_symbol_move(struct flir_boson_batch_entry *e, u8 *buf, u8 id, s16 x, s16 y);
+void flir_boson_batch_symbol_show(struct flir_boson_batch_entry *e, u8 *buf, u8 id, bool visible);
+
 /* Layer 3: Command Packagers (SDK-compatible API) */
 FLR_RESULT flir_boson_send_int_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 val, u32 delay_ms);
+FLR_RESULT flir_boson_send_void_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 delay_ms);
 FLR_RESULT flir_boson_get_int_val(struct flir_boson_dev *sensor, u32 cmd, u32 *val);
+FLR_RESULT flir_boson_get_int_pair(struct flir_boson_dev *sensor, u32 cmd, u32 *val0, u32 *val1);
+FLR_RESULT flir_boson_set_jitter_reduction(struct flir_boson_dev *sensor, FLR_ENABLE_E enable, u32 line);
+FLR_RESULT flir_boson_get_image_stats(struct flir_boson_dev *sensor, u16 stats[FLIR_STAT_NUM]);
+FLR_RESULT flir_boson_get_health(struct flir_boson_dev *sensor, struct flir_boson_health *health);
+FLR_RESULT flir_boson_get_capture_status(struct flir_boson_dev *sensor, u32 *state, u32 *result);
+FLR_RESULT flir_boson_get_capture_size(struct flir_boson_dev *sensor, u32 *bytes, u16 *rows, u16 *columns);
+FLR_RESULT flir_boson_set_fractional_zoom(struct flir_boson_dev *sensor, u32 num, u32 den, u32 x_center, u32 y_center);
+FLR_RESULT flir_boson_set_isotherm_temps(struct flir_boson_dev *sensor, FLR_ISOTHERM_GAIN_E table, const s32 temps[FLIR_ISOTHERM_TEMPS]);
+FLR_RESULT flir_boson_get_isotherm_temps(struct flir_boson_dev *sensor, FLR_ISOTHERM_GAIN_E table, s32 temps[FLIR_ISOTHERM_TEMPS]);
 
 // Newly added GetClockInfo with 80 bytes return data = 20 values.
 FLR_RESULT flir_boson_get_clockinfo(struct flir_boson_dev *sensor, struct boson_clockinfo *info);
+u64 flir_boson_float_to_scaled(u32 bits, u32 scale);
+u32 flir_boson_scaled_to_float(u64 val, u32 scale);
 
 FLR_RESULT flir_boson_get_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_OUTPUT_IF_E output, FLR_DVOMUX_SOURCE_E *source, FLR_DVOMUX_TYPE_E *type);
 FLR_RESULT flir_boson_set_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_OUTPUT_IF_E output, FLR_DVOMUX_SOURCE_E source, FLR_DVOMUX_TYPE_E type);
 
+/* Shadow register cache, callers hold sensor->lock */
+FLR_RESULT flir_boson_shadow_send(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 cmd, u32 val, u32 delay_ms);
+FLR_RESULT flir_boson_shadow_send_batch(struct flir_boson_dev *sensor, const u8 *ids, const u32 *vals, unsigned int count);
+int flir_boson_shadow_queue(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 cmd, u32 val, u32 delay_ms);
+FLR_RESULT flir_boson_shadow_set_dvo_muxtype(struct flir_boson_dev *sensor, FLR_DVOMUX_TYPE_E type);
+void flir_boson_shadow_store(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 val, FLR_RESULT result);
+void flir_boson_shadow_invalidate(struct flir_boson_dev *sensor);
+void flir_boson_shadow_forget(struct flir_boson_dev *sensor, u32 fn_id);
+int flir_boson_shadow_load(struct flir_boson_dev *sensor);
+FLR_RESULT flir_boson_shadow_restore(struct flir_boson_dev *sensor, unsigned long skip, unsigned int *sent);
+
+static inline bool flir_boson_shadow_match(struct flir_boson_dev *sensor, enum flir_shadow_id id, u32 val)
+{
+	return test_bit(id, &sensor->shadow_valid) && sensor->shadow[id] == val;
+}
+
+/* Layer 4: Asynchronous command queue */
+int flir_boson_cmd_queue_init(struct flir_boson_dev *sensor);
+void flir_boson_cmd_queue_destroy(struct flir_boson_dev *sensor);
+void flir_boson_cmd_queue_flush(struct flir_boson_dev *sensor);
+int flir_boson_queue_int_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 val, u32 delay_ms);
+int flir_boson_queue_void_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 delay_ms);
+struct flir_boson_async_cmd *flir_boson_submit_int_cmd(struct flir_boson_dev *sensor, u32 cmd, u32 val, u32 delay_ms, bool is_get, bool wait);
+FLR_RESULT flir_boson_async_wait(struct flir_boson_async_cmd *c, u32 *val);
+
+/* Event ring */
+void __flir_boson_event(struct flir_boson_dev *sensor, enum flir_event_type type, const char *fmt, const u32 *args);
+
+/*
+ * Record an event: fmt must be a string literal with up to FLIR_EVENT_ARGS
+ * 32-bit conversions, checked like a printk format. Safe from any context.
+ */
+#define flir_boson_event(sensor, type, fmt, ...)						\
+	do {											\
+		if (0)										\
+			no_printk(fmt, ##__VA_ARGS__);						\
+		__flir_boson_event((sensor), (type), (fmt), (const u32[FLIR_EVENT_ARGS]){ __VA_ARGS__ }); \
+	} while (0)
+
+/* debugfs */
+void flir_boson_debugfs_register(void);
+void flir_boson_debugfs_unregister(void);
+void flir_boson_debugfs_init(struct flir_boson_dev *sensor);
+void flir_boson_debugfs_cleanup(struct flir_boson_dev *sensor);
+
 /* Legacy compatibility */
 // int flir_boson_fslp_send_frame(struct flir_boson_dev *sensor, const u8 *tx_data, u32 tx_len, u8 *rx_data, u32 rx_len);
 
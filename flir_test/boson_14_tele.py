@@ -16,16 +16,14 @@ import numpy as np
 from glob import glob
 from PIL import Image
 
-import struct
+from BosonSDK.telemetry import TelemetryLines
 
 
 def show_telemetry(tel_line):
-    tel_line = tel_line.astype(
-        np.uint8
-    ).tobytes()  # telemetry line seems to be bytes packed into the 14-bit values...
-    cam_temp = struct.unpack_from("<H", tel_line, 96)[0]
-    cam_temp = (cam_temp / 10.0) - 273.15
-    print(f"Cam temp: {cam_temp}")
+    # one telemetry byte in the low byte of each pixel, see BosonSDK/telemetry.py
+    tel = TelemetryLines(tel_line)
+    print(f"Frame: {tel.frameCounter}, FFC state: {tel.ffcState}")
+    print(f"Cam temp: {tel.fpaTempC}")
 
 
 def calculate_psnr(src, tgt):
@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+
+"""
+
+Time the Boson's format transitions on a V4L2 video node.
+
+For every pair of {RAW8, RAW14, UYVY} x {320x256, 640x512, 640x514} (the
+same configuration twice included, which the driver's shadow cache should
+make cheap), stream the first configuration, then switch to the second and
+measure:
+
+    stop_ms         STREAMOFF, unmap and free the old buffers
+    s_fmt_ms        VIDIOC_S_FMT
+    buffers_ms      REQBUFS, mmap and QBUF of the new buffers
+    streamon_ms     VIDIOC_STREAMON (the camera is configured here)
+    first_frame_ms  STREAMON until the first frame without V4L2_BUF_FLAG_ERROR
+    total_ms        s_fmt until the first valid frame
+    invalid         error frames dequeued before the first valid one
+    dropped         sequence numbers missing over the next --frames frames
+
+One JSON object per measurement goes to stdout (--csv for CSV), progress to
+stderr, e.g.
+
+    PYTHONPATH=.. python3 boson_format_bench.py /dev/video1 -r 5 > before.jsonl
+
+Runs against the driver as it is; compare two runs to see what a driver
+change costs or saves.
+
+"""
+
+import argparse
+import csv
+import ctypes
+import fcntl
+import itertools
+import json
+import mmap
+import os
+import select
+import sys
+import time
+
+from BosonSDK.v4l2_capture import (V4L2_BUF_TYPE_VIDEO_CAPTURE, V4L2_FIELD_NONE, V4L2_MEMORY_MMAP,
+                                   VIDIOC_DQBUF, VIDIOC_QBUF, VIDIOC_QUERYBUF, VIDIOC_REQBUFS,
+                                   VIDIOC_S_FMT, VIDIOC_STREAMOFF, VIDIOC_STREAMON, fourccCode,
+                                   v4l2_buffer, v4l2_format, v4l2_requestbuffers)
+
+V4L2_BUF_FLAG_ERROR = 0x00000040
+
+FORMATS = {"RAW8": "GREY", "RAW14": "Y16 ", "UYVY": "UYVY"}
+SIZES = [(320, 256), (640, 512), (640, 514)]
+
+FIELDS = ["from", "to", "run", "stop_ms", "s_fmt_ms", "buffers_ms", "streamon_ms", "first_frame_ms",
+          "total_ms", "invalid", "dropped", "error"]
+
+
+def ms(start, end):
+    return round((end - start) * 1e3, 3)
+
+
+class Device:
+    '''The bare ioctl sequence of a capture, each step on its own so it can
+    be timed.'''
+
+    def __init__(self, path, buffers):
+        self.fd = os.open(path, os.O_RDWR | os.O_NONBLOCK)
+        self.buffers = buffers
+        self.maps = []
+        self.streaming = False
+
+    def setFormat(self, fourcc, width, height):
+        fmt = v4l2_format(type=V4L2_BUF_TYPE_VIDEO_CAPTURE)
+        fmt.fmt.pix.width, fmt.fmt.pix.height = width, height
+        fmt.fmt.pix.pixelformat = fourccCode(fourcc)
+        fmt.fmt.pix.field = V4L2_FIELD_NONE
+        fcntl.ioctl(self.fd, VIDIOC_S_FMT, fmt)
+        pix = fmt.fmt.pix
+        if (pix.width, pix.height, pix.pixelformat) != (width, height, fourccCode(fourcc)):
+            raise ValueError("driver chose {:d}x{:d}".format(pix.width, pix.height))
+
+    def allocate(self):
+        req = v4l2_requestbuffers(count=self.buffers, type=V4L2_BUF_TYPE_VIDEO_CAPTURE, memory=V4L2_MEMORY_MMAP)
+        fcntl.ioctl(self.fd, VIDIOC_REQBUFS, req)
+        for index in range(req.count):
+            buf = v4l2_buffer(index=index, type=V4L2_BUF_TYPE_VIDEO_CAPTURE, memory=V4L2_MEMORY_MMAP)
+            fcntl.ioctl(self.fd, VIDIOC_QUERYBUF, buf)
+            self.maps.append(mmap.mmap(self.fd, buf.length, mmap.MAP_SHARED, mmap.PROT_READ, offset=buf.m.offset))
+            self.queue(index)
+
+    def release(self):
+        if self.streaming:
+            fcntl.ioctl(self.fd, VIDIOC_STREAMOFF, ctypes.c_int(V4L2_BUF_TYPE_VIDEO_CAPTURE))
+            self.streaming = False
+        for m in self.maps:
+            m.close()
+        self.maps = []
+        fcntl.ioctl(self.fd, VIDIOC_REQBUFS, v4l2_requestbuffers(count=0, type=V4L2_BUF_TYPE_VIDEO_CAPTURE,
+                                                                 memory=V4L2_MEMORY_MMAP))
+
+    def queue(self, index):
+        fcntl.ioctl(self.fd, VIDIOC_QBUF, v4l2_buffer(index=index, type=V4L2_BUF_TYPE_VIDEO_CAPTURE,
+                                                      memory=V4L2_MEMORY_MMAP))
+
+    def streamOn(self):
+        fcntl.ioctl(self.fd, VIDIOC_STREAMON, ctypes.c_int(V4L2_BUF_TYPE_VIDEO_CAPTURE))
+        self.streaming = True
+
+    def dequeue(self, deadline):
+        '''(sequence, flags) of the next buffer, requeued at once; None at
+        the deadline.'''
+        buf = v4l2_buffer(type=V4L2_BUF_TYPE_VIDEO_CAPTURE, memory=V4L2_MEMORY_MMAP)
+        while True:
+            try:
+                fcntl.ioctl(self.fd, VIDIOC_DQBUF, buf)
+                break
+            except BlockingIOError:
+                left = deadline - time.monotonic()
+                if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                    return None
+        self.queue(buf.index)
+        return buf.sequence, buf.flags
+
+    def close(self):
+        try:
+            self.release()
+        finally:
+            os.close(self.fd)
+
+
+def configure(dev, config):
+    fourcc, width, height = config
+    dev.setFormat(fourcc, width, height)
+    dev.allocate()
+    dev.streamOn()
+
+
+def transition(dev, src, dst, frames, timeout):
+    '''Stream src, switch to dst; the timings of the switch.'''
+    result = {}
+    configure(dev, src)
+    if dev.dequeue(time.monotonic() + timeout) is None:
+        raise TimeoutError("no frames in the source configuration")
+
+    t0 = time.monotonic()
+    dev.release()
+    t1 = time.monotonic()
+    dev.setFormat(*dst)
+    t2 = time.monotonic()
+    dev.allocate()
+    t3 = time.monotonic()
+    dev.streamOn()
+    t4 = time.monotonic()
+    result.update(stop_ms=ms(t0, t1), s_fmt_ms=ms(t1, t2), buffers_ms=ms(t2, t3), streamon_ms=ms(t3, t4))
+
+    invalid = 0
+    while True:
+        got = dev.dequeue(t4 + timeout)
+        if got is None:
+            raise TimeoutError("no valid frame {:.1f} s after STREAMON".format(timeout))
+        sequence, flags = got
+        if not flags & V4L2_BUF_FLAG_ERROR:
+            break
+        invalid += 1
+    t5 = time.monotonic()
+    result.update(first_frame_ms=ms(t4, t5), total_ms=ms(t1, t5), invalid=invalid)
+
+    first, last, received = sequence, sequence, 0
+    for _ in range(frames):
+        got = dev.dequeue(time.monotonic() + timeout)
+        if got is None:
+            break
+        last, received = got[0], received + 1
+    result["dropped"] = max(0, last - first - received)
+    dev.release()
+    return result
+
+
+def label(config):
+    fourcc, width, height = config
+    name = next(k for k, v in FORMATS.items() if v == fourcc)
+    return "{}_{:d}x{:d}".format(name, width, height)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Time Boson format transitions on a V4L2 video node")
+    parser.add_argument("device", nargs="?", default="/dev/video1")
+    parser.add_argument("-r", "--repeat", type=int, default=3, help="measurements per transition")
+    parser.add_argument("-n", "--frames", type=int, default=60, help="frames after the first, for drops")
+    parser.add_argument("-b", "--buffers", type=int, default=4)
+    parser.add_argument("-t", "--timeout", type=float, default=5.0, help="seconds to wait for a frame")
+    parser.add_argument("-f", "--formats", default=",".join(FORMATS), help="subset, e.g. RAW8,RAW14")
+    parser.add_argument("--csv", action="store_true", help="CSV instead of JSON lines")
+    args = parser.parse_args()
+
+    configs = [(FORMATS[name], w, h) for name in args.formats.split(",") for w, h in SIZES]
+    writer = None
+    if args.csv:
+        writer = csv.DictWriter(sys.stdout, FIELDS)
+        writer.writeheader()
+
+    dev = Device(args.device, args.buffers)
+    try:
+        for src, dst in itertools.product(configs, repeat=2):
+            for run in range(args.repeat):
+                record = dict.fromkeys(FIELDS)
+                record.update({"from": label(src), "to": label(dst), "run": run})
+                try:
+                    record.update(transition(dev, src, dst, args.frames, args.timeout))
+                except (OSError, ValueError) as e:
+                    record["error"] = str(e)
+                    try:
+                        dev.release()
+                    except OSError:
+                        pass
+                print("{from} -> {to} #{run}: {total_ms} ms{0}".format(
+                    "" if record["error"] is None else " (" + record["error"] + ")", **record), file=sys.stderr)
+                if writer:
+                    writer.writerow(record)
+                else:
+                    print(json.dumps(record))
+                sys.stdout.flush()
+    finally:
+        dev.close()
+
+
+if __name__ == "__main__":
+    main()
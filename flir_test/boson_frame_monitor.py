@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+
+"""
+
+Watch a Boson stream for lost, repeated and late frames.
+
+Captures the 640x514 framesize, whose two extra rows carry the telemetry
+line, and feeds every frame's camera frame counter and timestamp with its
+V4L2 sequence and timestamp to BosonSDK.frame_monitor. A summary goes to
+stderr every --interval seconds; --json writes each interval's counters and
+histograms to stdout as one JSON line instead, e.g.
+
+    PYTHONPATH=.. python3 boson_frame_monitor.py /dev/video1 --json > stream.jsonl
+
+Counters are per interval unless --cumulative is given. Stop with Ctrl-C.
+
+"""
+
+import argparse
+import json
+import sys
+import time
+
+from BosonSDK.frame_monitor import FrameMonitor
+from BosonSDK.telemetry import TelemetryLines
+from BosonSDK.v4l2_capture import Capture
+
+FORMATS = {"RAW14": "Y16 ", "RAW8": "GREY"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Boson frame drop and latency monitor")
+    parser.add_argument("device", nargs="?", default="/dev/video1")
+    parser.add_argument("-f", "--format", choices=FORMATS, default="RAW14")
+    parser.add_argument("-i", "--interval", type=float, default=1.0, help="seconds between reports")
+    parser.add_argument("-d", "--duration", type=float, default=0.0, help="seconds to run, 0 until Ctrl-C")
+    parser.add_argument("-s", "--counter-step", type=int, default=1, help="frameCounter increment per frame")
+    parser.add_argument("-b", "--buffers", type=int, default=4)
+    parser.add_argument("--cumulative", action="store_true", help="never reset the counters")
+    parser.add_argument("--json", action="store_true", help="JSON lines on stdout")
+    args = parser.parse_args()
+
+    monitor = FrameMonitor(counterStep=args.counter_step)
+    end = time.monotonic() + args.duration if args.duration > 0 else None
+    try:
+        with Capture(args.device, 640, 514, FORMATS[args.format], buffers=args.buffers) as cap:
+            for frame in cap:
+                tel = TelemetryLines(frame.telemetry[0])
+                monitor.update(frame.sequence, frame.timestamp, int(tel.frameCounter), int(tel.frameTimestamp))
+                if monitor.due(args.interval):
+                    if args.json:
+                        print(json.dumps(dict(monitor.snapshot(), time=round(time.time(), 3))), flush=True)
+                    else:
+                        print(monitor.report(), file=sys.stderr)
+                    if not args.cumulative:
+                        monitor.reset()
+                if end is not None and time.monotonic() >= end:
+                    break
+            else:
+                print("No frame for 1 s, stopping", file=sys.stderr)
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+
+"""
+
+Performance checks of the Boson driver and SDK, run on the target.
+
+Each check measures something and passes or fails against a limit:
+
+    capture_<FORMAT>    --minutes of 640x514 capture: no frame lost (camera
+                        frame counter and V4L2 sequence) and at least --min-fps
+    commands_ioctl      GetCameraSN per second, as bare FLIR_BOSON_IOCTL_FSLP_FRAME
+    commands_batch      the same, --batch commands per ioctl
+    commands_sdk        the same through pyClient on the subdev (the whole SDK)
+    probe_ready         "camera ready in N ms" of the last driver probe, from the
+                        debugfs event ring (the kernel log for older drivers)
+    format_switch       RAW14 -> RAW8 -> UYVY -> RAW14 switches, worst total_ms
+
+The results are one JSON object on stdout and, with --history FILE, appended
+to FILE as one line. Each metric is then also compared with the median of
+the last --window runs in FILE, and fails if it got more than --tolerance
+percent worse, so a driver or SDK upgrade can be gated on its numbers:
+
+    PYTHONPATH=.. python3 boson_perf_suite.py --history perf.jsonl
+    PYTHONPATH=.. python3 boson_perf_suite.py --history perf.jsonl --minutes 0.2 --only commands,probe
+
+The exit status is 1 when any check failed. Checks that cannot run (no
+frames, no probe record) are reported as skipped with the reason.
+
+"""
+
+import argparse
+import glob
+import json
+import re
+import statistics
+import subprocess
+import sys
+import time
+
+from BosonSDK.frame_monitor import FrameMonitor
+
+FORMATS = {"RAW14": "Y16 ", "RAW8": "GREY", "UYVY": "UYVY"}
+GET_CAMERA_SN = 0x00050002      # FunctionCodes: BOSON_GETCAMERASN
+GET_CAMERA_SN_CMD = (GET_CAMERA_SN, b"", 4, 0)      # (fnID, sendData, receiveBytes, timeout_ms)
+
+# metric -> True when larger is better, for the history comparison
+METRICS = {"fps": True, "commandsPerSec": True, "readyMs": False, "worstMs": False, "meanMs": False}
+
+
+def captureCheck(args, name):
+    from BosonSDK.telemetry import TelemetryLines
+    from BosonSDK.v4l2_capture import Capture
+
+    monitor = FrameMonitor(counterStep=args.counter_step)
+    end = time.monotonic() + args.minutes * 60.0
+    with Capture(args.device, 640, 514, FORMATS[name], buffers=args.buffers) as cap:
+        first = cap.read(timeout=5.0)
+        if first is None:
+            return {"skipped": "no frames"}
+        first.release()
+        monitor.reset()
+        for frame in cap:
+            tel = TelemetryLines(frame.telemetry[0])
+            monitor.update(frame.sequence, frame.timestamp, int(tel.frameCounter), int(tel.frameTimestamp))
+            if time.monotonic() >= end:
+                break
+    result = {"frames": monitor.frames, "fps": round(monitor.fps, 2), "cameraDrops": monitor.cameraDrops,
+              "pipelineDrops": monitor.pipelineDrops, "duplicates": monitor.duplicates,
+              "latencyP99Ms": monitor.latency.percentile(99)}
+    failures = []
+    if monitor.cameraDrops or monitor.pipelineDrops:
+        failures.append("{:d} camera and {:d} pipeline drops".format(monitor.cameraDrops, monitor.pipelineDrops))
+    if monitor.fps < args.min_fps:
+        failures.append("{:.2f} fps < {:.2f}".format(monitor.fps, args.min_fps))
+    result["failed"] = "; ".join(failures) or None
+    return result
+
+
+def rate(call, seconds):
+    '''Calls per second of call() (which returns how many commands it ran).'''
+    count, start = 0, time.monotonic()
+    end = start + seconds
+    while time.monotonic() < end:
+        count += call()
+    return count / (time.monotonic() - start)
+
+
+def ioctlCheck(args, batch):
+    from BosonSDK.CommunicationFiles.KernelFslp import KernelPort
+
+    port = KernelPort(args.subdev)
+    port.open()
+    try:
+        commands = [GET_CAMERA_SN_CMD] * batch
+
+        def call():
+            results = port.transfer(commands)
+            if any(result for result, _ in results):
+                raise IOError("GetCameraSN failed: 0x{:04X}".format(next(r for r, _ in results if r)))
+            return len(results)
+        return {"commandsPerSec": round(rate(call, args.seconds), 1), "batch": batch, "failed": None}
+    finally:
+        port.close()
+
+
+def sdkCheck(args):
+    from BosonSDK.boson_ctl import openDirect
+
+    cam = openDirect(1, args.subdev, False, 0x6a, "smbus")
+    try:
+        def call():
+            result, _ = cam.bosonGetCameraSN()
+            if result.value:
+                raise IOError("GetCameraSN failed: {}".format(result))
+            return 1
+        return {"commandsPerSec": round(rate(call, args.seconds), 1), "failed": None}
+    finally:
+        cam.Close()
+
+
+def kernelLog():
+    for command in (["dmesg"], ["journalctl", "-k", "-b", "--no-pager", "-o", "cat"]):
+        try:
+            return subprocess.run(command, capture_output=True, text=True, check=True).stdout
+        except (OSError, subprocess.CalledProcessError):
+            continue
+    return ""
+
+
+EVENT_FILES = "/sys/kernel/debug/flir-boson/*/events"
+
+
+def driverEvents():
+    '''The debugfs event rings of every camera, one text; empty without
+    debugfs access or with a driver that logs to the kernel log instead.'''
+    text = ""
+    for path in sorted(glob.glob(EVENT_FILES)):
+        try:
+            with open(path) as f:
+                text += f.read()
+        except OSError:
+            continue
+    return text
+
+
+def probeCheck(args):
+    pattern = r"camera ready in (\d+) ms"
+    ready = [int(ms) for ms in re.findall(pattern, driverEvents()) or re.findall(pattern, kernelLog())]
+    if not ready:
+        return {"skipped": "no 'camera ready' event or kernel log line"}
+    result = {"readyMs": ready[-1], "failed": None}
+    if args.max_ready_ms and ready[-1] > args.max_ready_ms:
+        result["failed"] = "{:d} ms > {:d}".format(ready[-1], args.max_ready_ms)
+    return result
+
+
+def switchCheck(args):
+    from boson_format_bench import Device, transition
+
+    chain = [(FORMATS[name], 640, 512) for name in ("RAW14", "RAW8", "UYVY", "RAW14")]
+    dev = Device(args.device, args.buffers)
+    totals = []
+    try:
+        for _ in range(args.repeat):
+            for src, dst in zip(chain, chain[1:]):
+                measured = transition(dev, src, dst, 0, 5.0)
+                totals.append(measured["total_ms"])
+    finally:
+        dev.close()
+    result = {"worstMs": max(totals), "meanMs": round(statistics.mean(totals), 3), "switches": len(totals),
+              "failed": None}
+    if args.max_switch_ms and max(totals) > args.max_switch_ms:
+        result["failed"] = "{:.1f} ms > {:d}".format(max(totals), args.max_switch_ms)
+    return result
+
+
+def checks(args):
+    '''name -> function, in running order.'''
+    found = {}
+    for name in FORMATS:
+        found["capture_" + name] = lambda name=name: captureCheck(args, name)
+    found["commands_ioctl"] = lambda: ioctlCheck(args, 1)
+    found["commands_batch"] = lambda: ioctlCheck(args, args.batch)
+    found["commands_sdk"] = lambda: sdkCheck(args)
+    found["probe_ready"] = lambda: probeCheck(args)
+    found["format_switch"] = lambda: switchCheck(args)
+    return found
+
+
+def loadHistory(path, window):
+    try:
+        with open(path) as f:
+            runs = [json.loads(line) for line in f if line.strip()]
+    except FileNotFoundError:
+        return []
+    return runs[-window:]
+
+
+def compare(name, result, history, tolerance):
+    '''Regressions of result against the median of the same check in history.'''
+    regressions = []
+    for metric, higherBetter in METRICS.items():
+        if metric not in result:
+            continue
+        past = [run["checks"][name][metric] for run in history
+                if metric in run.get("checks", {}).get(name, {})]
+        if not past:
+            continue
+        baseline = statistics.median(past)
+        result.setdefault("baseline", {})[metric] = baseline
+        limit = baseline * (1 - tolerance / 100.0) if higherBetter else baseline * (1 + tolerance / 100.0)
+        if (result[metric] < limit) if higherBetter else (result[metric] > limit):
+            regressions.append("{} {} vs median {} of {:d} runs".format(metric, result[metric], baseline, len(past)))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Boson driver and SDK performance checks")
+    parser.add_argument("device", nargs="?", default="/dev/video1")
+    parser.add_argument("-s", "--subdev", default=None, help="v4l-subdev of the camera (found if not given)")
+    parser.add_argument("-m", "--minutes", type=float, default=5.0, help="capture minutes per format")
+    parser.add_argument("--min-fps", type=float, default=59.0)
+    parser.add_argument("--counter-step", type=int, default=1, help="frameCounter increment per frame")
+    parser.add_argument("--seconds", type=float, default=5.0, help="seconds per command rate")
+    parser.add_argument("--batch", type=int, default=16, help="commands per ioctl for commands_batch")
+    parser.add_argument("--repeat", type=int, default=3, help="format switch chains")
+    parser.add_argument("--max-ready-ms", type=int, default=0, help="probe_ready limit, 0 for none")
+    parser.add_argument("--max-switch-ms", type=int, default=0, help="format_switch limit, 0 for none")
+    parser.add_argument("-b", "--buffers", type=int, default=4)
+    parser.add_argument("--only", help="comma-separated checks or prefixes, e.g. capture_RAW14,commands")
+    parser.add_argument("--history", help="JSON lines file of earlier runs; this run is appended")
+    parser.add_argument("--window", type=int, default=5, help="earlier runs the median is taken over")
+    parser.add_argument("--tolerance", type=float, default=10.0, help="percent worse than the median that fails")
+    args = parser.parse_args()
+
+    if args.subdev is None:
+        from BosonSDK.media_topology import findBosons
+        nodes = [node for node in findBosons(readFormat=False) if node.video == args.device] or findBosons(
+            readFormat=False)
+        args.subdev = nodes[0].subdev if nodes else "/dev/v4l-subdev0"
+
+    history = loadHistory(args.history, args.window) if args.history else []
+    wanted = args.only.split(",") if args.only else None
+    run = {"time": round(time.time(), 3), "device": args.device, "subdev": args.subdev, "checks": {}}
+    failed = False
+    for name, check in checks(args).items():
+        if wanted and not any(name.startswith(prefix) for prefix in wanted):
+            continue
+        try:
+            result = check()
+        except (OSError, ValueError, TimeoutError) as e:
+            result = {"failed": "{}: {}".format(type(e).__name__, e)}
+        if "skipped" not in result:
+            regressions = compare(name, result, history, args.tolerance)
+            if regressions:
+                result["failed"] = "; ".join(filter(None, [result.get("failed")] + regressions))
+        run["checks"][name] = result
+        status = "SKIP " + result["skipped"] if "skipped" in result else (
+            "FAIL " + result["failed"] if result.get("failed") else "ok")
+        print("{:<16} {}".format(name, status), file=sys.stderr)
+        failed |= bool(result.get("failed"))
+
+    run["passed"] = not failed
+    print(json.dumps(run))
+    if args.history:
+        with open(args.history, "a") as f:
+            f.write(json.dumps(run) + "\n")
+    sys.exit(1 if failed else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+"""
+
+Record the Boson's RAW14 stream, packed, with telemetry and timestamps.
+
+Captures 640x514 Y16 (640x512 with --no-telemetry) and appends each frame to
+a BosonSDK.recording file: 14 bits per pixel, the telemetry row's bytes and
+the V4L2 sequence and timestamp. Recording into an existing file of the same
+layout continues it.
+
+    PYTHONPATH=.. python3 boson_record14.py /dev/video1 flight.b14 -d 3600
+    PYTHONPATH=.. python3 boson_record14.py --info flight.b14
+
+Stop with Ctrl-C; at most the frame being written is lost.
+
+"""
+
+import argparse
+import sys
+import time
+
+from BosonSDK.recording import Playback, Recorder
+
+
+def info(path):
+    with Playback(path) as play:
+        print("{}: {:d} frames of {:d}x{:d}, {:d} telemetry bytes".format(
+            path, len(play), play.width, play.height, play.telemetryBytes))
+        if len(play):
+            span = play.timestamps[-1] - play.timestamps[0]
+            gaps = int((play.sequences[1:] - play.sequences[:-1] > 1).sum()) if len(play) > 1 else 0
+            print("{:.1f} s, {:.2f} fps, {:d} sequence gaps".format(
+                span, (len(play) - 1) / span if span > 0 else 0.0, gaps))
+
+
+def record(args):
+    from BosonSDK.v4l2_capture import Capture
+
+    height = 512 if args.no_telemetry else 514
+    end = time.monotonic() + args.duration if args.duration > 0 else None
+    with Capture(args.device, 640, height, "Y16 ", buffers=args.buffers) as cap, \
+            Recorder(args.output, 640, 512, 0 if args.no_telemetry else 640) as rec:
+        start = rec.frames
+        try:
+            for frame in cap:
+                rec.write(frame.image, None if args.no_telemetry else frame.telemetry[0],
+                          frame.sequence, frame.timestamp)
+                if end is not None and time.monotonic() >= end:
+                    break
+        except KeyboardInterrupt:
+            pass
+        print("{:d} frames recorded, {:d} in {}".format(rec.frames - start, rec.frames, args.output),
+              file=sys.stderr)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Packed 14-bit Boson recorder")
+    parser.add_argument("device", nargs="?", default="/dev/video1")
+    parser.add_argument("output", nargs="?", default="boson.b14")
+    parser.add_argument("-d", "--duration", type=float, default=0.0, help="seconds, 0 until Ctrl-C")
+    parser.add_argument("-b", "--buffers", type=int, default=8)
+    parser.add_argument("--no-telemetry", action="store_true", help="capture 640x512, no telemetry")
+    parser.add_argument("--info", metavar="FILE", help="summarise a recording instead")
+    args = parser.parse_args()
+
+    if args.info:
+        info(args.info)
+    else:
+        record(args)
+
+
+if __name__ == "__main__":
+    main()
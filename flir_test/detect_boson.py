@@ -10,11 +10,20 @@ By:			jye@videologyinc.com
 
 """
 
-from vdlg_lvds.detect_cameras_live import detect_cameras
+from BosonSDK.media_topology import findBosons
 
 # Main program to get current cameras and detect Boson path.
+# The media controller topology names the Boson's nodes without opening any
+# video device; probing every camera is only the fallback.
 
 def detect_boson_path():
+	bosons = findBosons()
+	for boson in bosons:
+		print("Boson is at ", boson.video, boson.subdev, "i2c-{}".format(boson.i2cBus), boson.format)
+	if bosons:
+		return True
+
+	from vdlg_lvds.detect_cameras_live import detect_cameras
 	camera_status = detect_cameras()
 
 	for key, val in camera_status.items():
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+"""
+
+Replay a recorded FSLP session (BosonSDK/fslp_log.py) against a transport.
+
+Every command of the log is framed again by the Python SDK's transport and
+sent at its recorded time (scaled by --speed, 0 for back to back). Its
+latency, command sent to response read as in the log, and its status are
+compared with the recording, per function code:
+
+    PYTHONPATH=.. python3 fslp_replay.py field.fslog --uart /dev/pts/3            # boson_emu
+    PYTHONPATH=.. python3 fslp_replay.py field.fslog --subdev /dev/v4l-subdev2 --speed 0
+    PYTHONPATH=.. python3 fslp_replay.py field.fslog --i2c 2 --reads-only --json
+
+Sessions recorded from the driver's tracepoints ("python3 -m BosonSDK.fslp_log
+from-trace") replay the same way. Setting BOSON_FSLP_LOG logs the replay
+itself, for a frame-by-frame comparison. Setters change the camera: use
+--reads-only (commands without data) against a camera in use.
+
+"""
+
+import argparse
+import collections
+import json
+import sys
+import time
+
+from BosonSDK.fslp_log import COMMAND_CHANNEL, FRAME_HEADER, NO_STATUS, exchanges, readLog
+
+
+def percentile(values, p):
+    if not values:
+        return None
+    ordered = sorted(values)
+    return round(ordered[min(len(ordered) - 1, int(p / 100.0 * len(ordered)))], 3)
+
+
+def openTransport(args):
+    from BosonSDK.CommunicationFiles.CommonFslp import CommonFslp, FSLP_TYPE_E
+
+    if args.uart:
+        fslp = CommonFslp.getFslp(args.uart, args.baud, FSLP_TYPE_E.FSLP_PY_SERIAL)
+    elif args.subdev:
+        fslp = CommonFslp.getFslp(args.subdev, None, FSLP_TYPE_E.FSLP_KERNEL)
+    else:
+        fslp = CommonFslp.getFslp(args.i2c, None, FSLP_TYPE_E.FSLP_I2C)
+    fslp.port.open()
+    return fslp
+
+
+def replay(session, fslp, speed):
+    '''[(command, response, replayed status, replayed latency ms), ...];
+    the status is None when no response came.'''
+    results = []
+    start, first = time.monotonic(), session[0][0].timestampNs if session else 0
+    for command, response in session:
+        if speed > 0:
+            due = start + (command.timestampNs - first) / 1e9 / speed
+            wait = due - time.monotonic()
+            if wait > 0:
+                time.sleep(wait)
+        expected = len(response.data) if response is not None else 0
+        payload = FRAME_HEADER.pack(command.sequence, command.fnId, NO_STATUS) + command.data
+        sent = time.monotonic()
+        fslp.sendFrame(COMMAND_CHANNEL, payload, len(payload))
+        answer = fslp.readFrame(COMMAND_CHANNEL, FRAME_HEADER.size + expected)
+        latency = (time.monotonic() - sent) * 1e3
+        status = FRAME_HEADER.unpack_from(answer)[2] if len(answer) >= FRAME_HEADER.size else None
+        results.append((command, response, status, latency))
+    return results
+
+
+def summarise(results):
+    byFn = collections.OrderedDict()
+    for command, response, status, latency in results:
+        entry = byFn.setdefault(command.fnId, {"recorded": [], "replayed": [], "statusChanged": 0})
+        if response is not None:
+            entry["recorded"].append((response.timestampNs - command.timestampNs) / 1e6)
+            entry["statusChanged"] += status != response.status
+        entry["replayed"].append(latency)
+    summary = []
+    for fnId, entry in byFn.items():
+        summary.append({"fnId": "0x{:08X}".format(fnId), "commands": len(entry["replayed"]),
+                        "recordedP50Ms": percentile(entry["recorded"], 50),
+                        "recordedP99Ms": percentile(entry["recorded"], 99),
+                        "replayedP50Ms": percentile(entry["replayed"], 50),
+                        "replayedP99Ms": percentile(entry["replayed"], 99),
+                        "statusChanged": entry["statusChanged"]})
+    return summary
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Replay a recorded FSLP session")
+    parser.add_argument("log")
+    target = parser.add_mutually_exclusive_group(required=True)
+    target.add_argument("--uart", help="serial port or pty, e.g. boson_emu's")
+    target.add_argument("--subdev", help="flir_boson v4l-subdev, through the driver's ioctl")
+    target.add_argument("--i2c", type=int, help="I2C bus number")
+    parser.add_argument("--baud", type=int, default=921600)
+    parser.add_argument("--speed", type=float, default=1.0, help="time scale, 0 sends back to back")
+    parser.add_argument("--reads-only", action="store_true", help="skip commands that carry data")
+    parser.add_argument("--json", action="store_true", help="JSON summary on stdout")
+    args = parser.parse_args()
+
+    session = [(command, response) for command, response in exchanges(readLog(args.log))
+               if not (args.reads_only and command.data)]
+    if not session:
+        sys.exit("{}: no commands to replay".format(args.log))
+
+    fslp = openTransport(args)
+    started = time.monotonic()
+    try:
+        results = replay(session, fslp, args.speed)
+    finally:
+        fslp.port.close()
+    elapsed = time.monotonic() - started
+
+    recordedSpan = (session[-1][0].timestampNs - session[0][0].timestampNs) / 1e9
+    summary = {"commands": len(results), "recordedSeconds": round(recordedSpan, 3),
+               "replayedSeconds": round(elapsed, 3), "commandsPerSec": round(len(results) / elapsed, 1),
+               "functions": summarise(results)}
+    if args.json:
+        print(json.dumps(summary))
+        return
+    print("{commands:d} commands: {recordedSeconds} s recorded, {replayedSeconds} s replayed, "
+          "{commandsPerSec} commands/s".format(**summary))
+    print("{:<12} {:>6} {:>15} {:>15} {:>8}".format("fn_id", "count", "recorded p50/99", "replayed p50/99",
+                                                   "status"))
+    for fn in summary["functions"]:
+        print("{fnId:<12} {commands:>6d} {0:>15} {1:>15} {statusChanged:>8d}".format(
+            "{}/{}".format(fn["recordedP50Ms"], fn["recordedP99Ms"]),
+            "{}/{}".format(fn["replayedP50Ms"], fn["replayedP99Ms"]), **fn))
+
+
+if __name__ == "__main__":
+    main()
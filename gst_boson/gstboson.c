@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: MIT
+/*
+ * FLIR Boson GStreamer plugin
+ * Copyright (C) 2026, VideologyInc
+ */
+
+#include <gst/gst.h>
+
+#include "gstbosonpalette.h"
+#include "gstbosontelemetry.h"
+
+static gboolean
+plugin_init (GstPlugin * plugin)
+{
+  return gst_element_register (plugin, "bosontelemetry", GST_RANK_NONE, GST_TYPE_BOSON_TELEMETRY)
+      && gst_element_register (plugin, "bosonpalette", GST_RANK_NONE, GST_TYPE_BOSON_PALETTE);
+}
+
+GST_PLUGIN_DEFINE (GST_VERSION_MAJOR, GST_VERSION_MINOR, boson, "FLIR Boson camera elements", plugin_init,
+    VERSION, "MIT/X11", PACKAGE, "https://www.videologyinc.com")
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+/*
+ * FLIR Boson telemetry as GstMeta
+ * Copyright (C) 2026, VideologyInc
+ */
+
+#include <string.h>
+
+#include "gstbosonmeta.h"
+
+GType
+gst_boson_telemetry_meta_api_get_type (void)
+{
+  static gsize type = 0;
+  static const gchar *tags[] = { NULL };
+
+  if (g_once_init_enter (&type)) {
+    GType _type = gst_meta_api_type_register ("GstBosonTelemetryMetaAPI", tags);
+    g_once_init_leave (&type, _type);
+  }
+  return (GType) type;
+}
+
+static gboolean
+gst_boson_telemetry_meta_init (GstMeta * meta, gpointer params, GstBuffer * buffer)
+{
+  GstBosonTelemetryMeta *tmeta = (GstBosonTelemetryMeta *) meta;
+
+  memset ((guint8 *) tmeta + sizeof (GstMeta), 0, sizeof (*tmeta) - sizeof (GstMeta));
+  return TRUE;
+}
+
+static gboolean
+gst_boson_telemetry_meta_transform (GstBuffer * dest, GstMeta * meta, GstBuffer * buffer,
+    GQuark type, gpointer data)
+{
+  GstBosonTelemetryMeta *smeta = (GstBosonTelemetryMeta *) meta, *dmeta;
+
+  /* telemetry describes the whole frame; it survives copies and scaling alike */
+  dmeta = (GstBosonTelemetryMeta *) gst_buffer_add_meta (dest, GST_BOSON_TELEMETRY_META_INFO, NULL);
+  if (!dmeta)
+    return FALSE;
+  memcpy ((guint8 *) dmeta + sizeof (GstMeta), (guint8 *) smeta + sizeof (GstMeta),
+      sizeof (*dmeta) - sizeof (GstMeta));
+  return TRUE;
+}
+
+const GstMetaInfo *
+gst_boson_telemetry_meta_get_info (void)
+{
+  static const GstMetaInfo *info = NULL;
+
+  if (g_once_init_enter ((GstMetaInfo **) & info)) {
+    const GstMetaInfo *mi = gst_meta_register (GST_BOSON_TELEMETRY_META_API_TYPE,
+        "GstBosonTelemetryMeta", sizeof (GstBosonTelemetryMeta),
+        gst_boson_telemetry_meta_init, NULL, gst_boson_telemetry_meta_transform);
+    g_once_init_leave ((GstMetaInfo **) & info, (GstMetaInfo *) mi);
+  }
+  return info;
+}
+
+static guint32
+tel_field (const guint8 * row, guint pixel_stride, guint width, guint offset, guint bytes)
+{
+  guint32 value = 0;
+  guint i;
+
+  if (offset + bytes > width)
+    return 0;
+  for (i = 0; i < bytes; i++)
+    value |= (guint32) row[(offset + i) * pixel_stride] << (8 * i);
+  return value;
+}
+
+GstBosonTelemetryMeta *
+gst_buffer_add_boson_telemetry_meta (GstBuffer * buffer, const guint8 * row, guint pixel_stride,
+    guint width)
+{
+  GstBosonTelemetryMeta *meta;
+
+  meta = (GstBosonTelemetryMeta *) gst_buffer_add_meta (buffer, GST_BOSON_TELEMETRY_META_INFO, NULL);
+  if (!meta)
+    return NULL;
+
+  meta->revision = tel_field (row, pixel_stride, width, BOSON_TEL_REVISION, 2);
+  meta->camera_serial = tel_field (row, pixel_stride, width, BOSON_TEL_CAMERA_SERIAL, 4);
+  meta->frame_counter = tel_field (row, pixel_stride, width, BOSON_TEL_FRAME_COUNTER, 4);
+  meta->frame_timestamp_ms = tel_field (row, pixel_stride, width, BOSON_TEL_FRAME_TIMESTAMP, 4);
+  meta->ffc_frame_counter = tel_field (row, pixel_stride, width, BOSON_TEL_FFC_FRAME, 4);
+  meta->ffc_timestamp_ms = tel_field (row, pixel_stride, width, BOSON_TEL_FFC_TIMESTAMP, 4);
+  meta->ffc_state = tel_field (row, pixel_stride, width, BOSON_TEL_FFC_STATE, 2);
+  meta->fpa_temp_dk = tel_field (row, pixel_stride, width, BOSON_TEL_FPA_TEMP, 2);
+  return meta;
+}
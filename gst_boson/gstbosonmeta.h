@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * FLIR Boson telemetry as GstMeta
+ * Copyright (C) 2026, VideologyInc
+ */
+
+#ifndef GST_BOSON_META_H
+#define GST_BOSON_META_H
+
+#include <gst/gst.h>
+
+G_BEGIN_DECLS
+
+/*
+ * Telemetry byte offsets, the same table as TELEMETRY_FIELDS in
+ * BosonSDK/telemetry.py. Each pixel of the telemetry row carries one byte
+ * in its low byte; multi-byte fields are little-endian.
+ */
+#define BOSON_TEL_REVISION          0   /* 2 bytes */
+#define BOSON_TEL_CAMERA_SERIAL     2   /* 4 */
+#define BOSON_TEL_FRAME_COUNTER    42   /* 4 */
+#define BOSON_TEL_FRAME_TIMESTAMP  46   /* 4, ms since power-up */
+#define BOSON_TEL_FFC_FRAME        50   /* 4 */
+#define BOSON_TEL_FFC_TIMESTAMP    54   /* 4 */
+#define BOSON_TEL_FFC_STATE        88   /* 2, FLR_BOSON_FFCSTATUS_E */
+#define BOSON_TEL_FPA_TEMP         96   /* 2, Kelvin x10 */
+#define BOSON_TEL_BYTES            98   /* telemetry bytes decoded */
+
+typedef struct _GstBosonTelemetryMeta GstBosonTelemetryMeta;
+
+/**
+ * GstBosonTelemetryMeta:
+ * @meta: parent #GstMeta
+ * @revision: telemetry revision
+ * @camera_serial: camera serial number
+ * @frame_counter: frame counter
+ * @frame_timestamp_ms: camera time of the frame, ms since power-up
+ * @ffc_frame_counter: @frame_counter at the last FFC
+ * @ffc_timestamp_ms: @frame_timestamp_ms at the last FFC
+ * @ffc_state: FLR_BOSON_FFCSTATUS_E
+ * @fpa_temp_dk: FPA temperature in Kelvin x10
+ *
+ * Decoded telemetry line of the frame it is attached to.
+ */
+struct _GstBosonTelemetryMeta {
+  GstMeta meta;
+
+  guint16 revision;
+  guint32 camera_serial;
+  guint32 frame_counter;
+  guint32 frame_timestamp_ms;
+  guint32 ffc_frame_counter;
+  guint32 ffc_timestamp_ms;
+  guint16 ffc_state;
+  guint16 fpa_temp_dk;
+};
+
+GType gst_boson_telemetry_meta_api_get_type (void);
+#define GST_BOSON_TELEMETRY_META_API_TYPE (gst_boson_telemetry_meta_api_get_type ())
+
+const GstMetaInfo *gst_boson_telemetry_meta_get_info (void);
+#define GST_BOSON_TELEMETRY_META_INFO (gst_boson_telemetry_meta_get_info ())
+
+#define gst_buffer_get_boson_telemetry_meta(b) \
+  ((GstBosonTelemetryMeta *) gst_buffer_get_meta ((b), GST_BOSON_TELEMETRY_META_API_TYPE))
+
+/* Decode the first @width pixels of a telemetry row, @pixel_stride bytes each */
+GstBosonTelemetryMeta *gst_buffer_add_boson_telemetry_meta (GstBuffer * buffer, const guint8 * row,
+    guint pixel_stride, guint width);
+
+G_END_DECLS
+
+#endif /* GST_BOSON_META_H */
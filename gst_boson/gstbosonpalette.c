@@ -0,0 +1,267 @@
+// SPDX-License-Identifier: MIT
+/*
+ * bosonpalette - FLIR Boson color palettes applied to the RAW8 stream
+ * Copyright (C) 2026, VideologyInc
+ *
+ *   gst-launch-1.0 v4l2src ! video/x-raw,format=GRAY8,width=640,height=512 \
+ *       ! bosonpalette subdev=/dev/v4l-subdev2 ! video/x-raw,format=NV12 ! ...
+ *
+ * The camera's COLOR output (UYVY) takes two bytes per pixel over MIPI to
+ * deliver its palette; RAW8 colored here takes one. The palette is an
+ * FLR_COLORLUT_ID_E; by default it is the one the camera is set to
+ * (V4L2_CID_FLIR_COLOR_LUT on the sensor subdev), read at start. The tables
+ * are Client_Palette.c's, close to the camera's rather than identical.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/videodev2.h>
+
+#include <gst/video/video.h>
+
+#include "Client_Palette.h"
+#include "flir-boson-ioctl.h"
+#include "gstbosonpalette.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_boson_palette_debug);
+#define GST_CAT_DEFAULT gst_boson_palette_debug
+
+#define PALETTE_CAMERA  (-1)    /* the camera's, white hot without a subdev */
+#define PALETTE_LAST    (11)    /* FLR_COLORLUT_AURORA */
+
+enum {
+  PROP_0,
+  PROP_PALETTE,
+  PROP_SUBDEV,
+};
+
+struct _GstBosonPalette {
+  GstVideoFilter parent;
+
+  gint palette;
+  gchar *subdev;
+
+  GMutex lock;              /* table and the properties */
+  CLIENT_PALETTE table;
+  gint active;              /* the ID in table */
+};
+
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE ("GRAY8")));
+
+#define SRC_FORMATS "{ NV12, RGBA, RGBx, RGB }"
+
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (SRC_FORMATS)));
+
+#define gst_boson_palette_parent_class parent_class
+G_DEFINE_TYPE (GstBosonPalette, gst_boson_palette, GST_TYPE_VIDEO_FILTER);
+
+/* Call with lock held */
+static void
+gst_boson_palette_load (GstBosonPalette * self, gint id)
+{
+  if (id == self->active)
+    return;
+  if (CLIENT_paletteBuild ((guint32) id, &self->table) < 0) {
+    GST_WARNING_OBJECT (self, "No palette %d, using white hot", id);
+    id = 0;
+    CLIENT_paletteBuild (0, &self->table);
+  }
+  self->active = id;
+  GST_DEBUG_OBJECT (self, "Palette %d", id);
+}
+
+static void
+gst_boson_palette_set_property (GObject * object, guint prop_id, const GValue * value, GParamSpec * pspec)
+{
+  GstBosonPalette *self = GST_BOSON_PALETTE (object);
+
+  g_mutex_lock (&self->lock);
+  switch (prop_id) {
+    case PROP_PALETTE:
+      self->palette = g_value_get_int (value);
+      if (self->palette != PALETTE_CAMERA)
+        gst_boson_palette_load (self, self->palette);
+      break;
+    case PROP_SUBDEV:
+      g_free (self->subdev);
+      self->subdev = g_value_dup_string (value);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  g_mutex_unlock (&self->lock);
+}
+
+static void
+gst_boson_palette_get_property (GObject * object, guint prop_id, GValue * value, GParamSpec * pspec)
+{
+  GstBosonPalette *self = GST_BOSON_PALETTE (object);
+
+  g_mutex_lock (&self->lock);
+  switch (prop_id) {
+    case PROP_PALETTE:
+      g_value_set_int (value, self->palette);
+      break;
+    case PROP_SUBDEV:
+      g_value_set_string (value, self->subdev);
+      break;
+    default:
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+  g_mutex_unlock (&self->lock);
+}
+
+static gboolean
+gst_boson_palette_start (GstBaseTransform * trans)
+{
+  GstBosonPalette *self = GST_BOSON_PALETTE (trans);
+  struct v4l2_control ctrl = { .id = V4L2_CID_FLIR_COLOR_LUT };
+  gint id = 0;
+  gint fd;
+
+  g_mutex_lock (&self->lock);
+  if (self->palette != PALETTE_CAMERA) {
+    g_mutex_unlock (&self->lock);
+    return TRUE;
+  }
+  if (self->subdev) {
+    fd = open (self->subdev, O_RDWR | O_CLOEXEC);
+    if (fd < 0) {
+      g_mutex_unlock (&self->lock);
+      GST_ELEMENT_ERROR (self, RESOURCE, OPEN_READ_WRITE, ("Could not open %s", self->subdev),
+          ("%s", g_strerror (errno)));
+      return FALSE;
+    }
+    if (ioctl (fd, VIDIOC_G_CTRL, &ctrl) == 0)
+      id = ctrl.value;
+    else
+      GST_WARNING_OBJECT (self, "Reading the camera's color LUT failed: %s", g_strerror (errno));
+    close (fd);
+  }
+  gst_boson_palette_load (self, id);
+  g_mutex_unlock (&self->lock);
+  return TRUE;
+}
+
+static GstCaps *
+gst_boson_palette_transform_caps (GstBaseTransform * trans, GstPadDirection direction,
+    GstCaps * caps, GstCaps * filter)
+{
+  GstBosonPalette *self = GST_BOSON_PALETTE (trans);
+  GstPadTemplate *other = gst_element_class_get_pad_template (GST_ELEMENT_GET_CLASS (trans),
+      direction == GST_PAD_SINK ? "src" : "sink");
+  GstCaps *formats = gst_pad_template_get_caps (other);
+  GstCaps *ret = gst_caps_new_empty ();
+  guint i;
+
+  /* same size and rate, the other pad's formats */
+  for (i = 0; i < gst_caps_get_size (caps); i++) {
+    GstStructure *s = gst_structure_copy (gst_caps_get_structure (caps, i));
+
+    gst_structure_set_value (s, "format",
+        gst_structure_get_value (gst_caps_get_structure (formats, 0), "format"));
+    gst_structure_remove_fields (s, "colorimetry", "chroma-site", NULL);
+    ret = gst_caps_merge_structure (ret, s);
+  }
+  gst_caps_unref (formats);
+
+  if (filter) {
+    GstCaps *tmp = gst_caps_intersect_full (filter, ret, GST_CAPS_INTERSECT_FIRST);
+
+    gst_caps_unref (ret);
+    ret = tmp;
+  }
+  GST_DEBUG_OBJECT (self, "%s caps %" GST_PTR_FORMAT " -> %" GST_PTR_FORMAT,
+      direction == GST_PAD_SINK ? "sink" : "src", caps, ret);
+  return ret;
+}
+
+static GstFlowReturn
+gst_boson_palette_transform_frame (GstVideoFilter * filter, GstVideoFrame * in, GstVideoFrame * out)
+{
+  GstBosonPalette *self = GST_BOSON_PALETTE (filter);
+  const guint8 *y8 = GST_VIDEO_FRAME_PLANE_DATA (in, 0);
+  guint stride = GST_VIDEO_FRAME_PLANE_STRIDE (in, 0);
+  guint width = GST_VIDEO_FRAME_WIDTH (in);
+  guint height = GST_VIDEO_FRAME_HEIGHT (in);
+
+  g_mutex_lock (&self->lock);
+  switch (GST_VIDEO_FRAME_FORMAT (out)) {
+    case GST_VIDEO_FORMAT_NV12:
+      CLIENT_paletteToNv12 (&self->table, y8, stride, width, height,
+          GST_VIDEO_FRAME_PLANE_DATA (out, 0), GST_VIDEO_FRAME_PLANE_STRIDE (out, 0),
+          GST_VIDEO_FRAME_PLANE_DATA (out, 1), GST_VIDEO_FRAME_PLANE_STRIDE (out, 1));
+      break;
+    case GST_VIDEO_FORMAT_RGBA:
+    case GST_VIDEO_FORMAT_RGBx:
+      CLIENT_paletteToRgba (&self->table, y8, stride, width, height,
+          GST_VIDEO_FRAME_PLANE_DATA (out, 0), GST_VIDEO_FRAME_PLANE_STRIDE (out, 0));
+      break;
+    case GST_VIDEO_FORMAT_RGB:
+      CLIENT_paletteToRgb (&self->table, y8, stride, width, height,
+          GST_VIDEO_FRAME_PLANE_DATA (out, 0), GST_VIDEO_FRAME_PLANE_STRIDE (out, 0));
+      break;
+    default:
+      g_mutex_unlock (&self->lock);
+      return GST_FLOW_NOT_NEGOTIATED;
+  }
+  g_mutex_unlock (&self->lock);
+  return GST_FLOW_OK;
+}
+
+static void
+gst_boson_palette_finalize (GObject * object)
+{
+  GstBosonPalette *self = GST_BOSON_PALETTE (object);
+
+  g_free (self->subdev);
+  g_mutex_clear (&self->lock);
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+gst_boson_palette_class_init (GstBosonPaletteClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstBaseTransformClass *trans_class = GST_BASE_TRANSFORM_CLASS (klass);
+  GstVideoFilterClass *filter_class = GST_VIDEO_FILTER_CLASS (klass);
+
+  gobject_class->set_property = gst_boson_palette_set_property;
+  gobject_class->get_property = gst_boson_palette_get_property;
+  gobject_class->finalize = gst_boson_palette_finalize;
+
+  g_object_class_install_property (gobject_class, PROP_PALETTE,
+      g_param_spec_int ("palette", "Palette", "FLR_COLORLUT_ID_E, -1 for the camera's",
+          PALETTE_CAMERA, PALETTE_LAST, PALETTE_CAMERA,
+          G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_PLAYING));
+  g_object_class_install_property (gobject_class, PROP_SUBDEV,
+      g_param_spec_string ("subdev", "Sensor subdev", "v4l-subdev node of the camera, for its palette",
+          NULL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
+
+  gst_element_class_set_static_metadata (element_class, "FLIR Boson palette", "Filter/Effect/Video",
+      "Colors the Boson's 8-bit stream with its palettes, to NV12 or RGB", "VideologyInc");
+  gst_element_class_add_static_pad_template (element_class, &sink_template);
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+
+  trans_class->start = gst_boson_palette_start;
+  trans_class->transform_caps = gst_boson_palette_transform_caps;
+  filter_class->transform_frame = gst_boson_palette_transform_frame;
+
+  GST_DEBUG_CATEGORY_INIT (gst_boson_palette_debug, "bosonpalette", 0, "FLIR Boson palette");
+}
+
+static void
+gst_boson_palette_init (GstBosonPalette * self)
+{
+  self->palette = PALETTE_CAMERA;
+  self->active = -1;
+  g_mutex_init (&self->lock);
+  gst_boson_palette_load (self, 0);
+}
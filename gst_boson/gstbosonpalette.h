@@ -0,0 +1,19 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * bosonpalette - FLIR Boson color palettes applied to the RAW8 stream
+ * Copyright (C) 2026, VideologyInc
+ */
+
+#ifndef GST_BOSON_PALETTE_H
+#define GST_BOSON_PALETTE_H
+
+#include <gst/video/gstvideofilter.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_BOSON_PALETTE (gst_boson_palette_get_type ())
+G_DECLARE_FINAL_TYPE (GstBosonPalette, gst_boson_palette, GST, BOSON_PALETTE, GstVideoFilter)
+
+G_END_DECLS
+
+#endif /* GST_BOSON_PALETTE_H */
@@ -0,0 +1,406 @@
+// SPDX-License-Identifier: MIT
+/*
+ * bosontelemetry - v4l2src companion for the FLIR Boson telemetry framesizes
+ * Copyright (C) 2026, VideologyInc
+ *
+ *   gst-launch-1.0 v4l2src io-mode=dmabuf ! video/x-raw,format=GRAY16_LE,width=640,height=514 \
+ *       ! bosontelemetry subdev=/dev/v4l-subdev2 ffc-mode=1 ! ...
+ *
+ * The element never touches the image. It decodes the telemetry row into a
+ * GstBosonTelemetryMeta and hides the telemetry rows by shrinking the
+ * buffer's GstVideoMeta (height, and offset when the rows are on top);
+ * the memory, DMABUF or not, is passed on as it came. Rows at the bottom
+ * also work for elements that ignore GstVideoMeta; rows on top need one
+ * that honours it. Camera controls are properties, set through the
+ * driver's V4L2 controls on the sensor subdev.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/videodev2.h>
+
+#include <gst/video/video.h>
+
+#include "flir-boson-ioctl.h"
+#include "gstbosonmeta.h"
+#include "gstbosontelemetry.h"
+
+GST_DEBUG_CATEGORY_STATIC (gst_boson_telemetry_debug);
+#define GST_CAT_DEFAULT gst_boson_telemetry_debug
+
+#define DEFAULT_ROWS  2     /* FLIR_BOSON_TELEMETRY_LINES, the 640x514 framesize */
+
+typedef struct {
+  const gchar *name;
+  const gchar *blurb;
+  guint32 cid;
+  gint min, max, def;
+} BosonControl;
+
+/* Defaults are the driver's; only properties that were set are sent */
+static const BosonControl boson_controls[] = {
+  { "ffc-mode", "FFC mode: 0 manual, 1 auto, 2 external", V4L2_CID_FLIR_FFC_MODE, 0, 2, 1 },
+  { "color-lut", "Color LUT, FLR_COLORLUT_ID_E", V4L2_CID_FLIR_COLOR_LUT, 0, G_MAXINT, 0 },
+  { "color-lut-enable", "Color LUT enable", V4L2_CID_FLIR_COLOR_LUT_ENABLE, 0, 1, 1 },
+  { "low-latency", "Low latency", V4L2_CID_FLIR_LOW_LATENCY, 0, 1, 0 },
+  { "agc-plateau", "AGC plateau in milli-%", V4L2_CID_FLIR_AGC_PLATEAU, 1000, 100000, 7000 },
+};
+#define N_CONTROLS G_N_ELEMENTS (boson_controls)
+
+enum {
+  PROP_0,
+  PROP_ROWS,
+  PROP_TOP,
+  PROP_SUBDEV,
+  PROP_CONTROL_FIRST,
+};
+
+struct _GstBosonTelemetry {
+  GstBaseTransform parent;
+
+  guint rows;
+  gboolean top;
+  gchar *subdev;
+  gint fd;
+
+  GstVideoInfo in_info;
+  GstVideoInfo out_info;
+
+  GMutex lock;              /* fd and controls */
+  gint controls[N_CONTROLS];
+  gboolean control_set[N_CONTROLS];
+};
+
+#define FORMATS "{ GRAY16_LE, GRAY8 }"
+
+static GstStaticPadTemplate sink_template = GST_STATIC_PAD_TEMPLATE ("sink",
+    GST_PAD_SINK, GST_PAD_ALWAYS, GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (FORMATS)));
+
+static GstStaticPadTemplate src_template = GST_STATIC_PAD_TEMPLATE ("src",
+    GST_PAD_SRC, GST_PAD_ALWAYS, GST_STATIC_CAPS (GST_VIDEO_CAPS_MAKE (FORMATS)));
+
+#define gst_boson_telemetry_parent_class parent_class
+G_DEFINE_TYPE (GstBosonTelemetry, gst_boson_telemetry, GST_TYPE_BASE_TRANSFORM);
+
+/* Call with lock held */
+static gboolean
+gst_boson_telemetry_send_control (GstBosonTelemetry * self, guint32 cid, gint value)
+{
+  struct v4l2_control ctrl = { .id = cid, .value = value };
+
+  if (self->fd < 0)
+    return TRUE;            /* applied at start */
+  if (ioctl (self->fd, VIDIOC_S_CTRL, &ctrl) < 0) {
+    GST_WARNING_OBJECT (self, "Setting control 0x%08x to %d failed: %s", cid, value, g_strerror (errno));
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static gboolean
+gst_boson_telemetry_run_ffc (GstBosonTelemetry * self)
+{
+  gboolean ret;
+
+  g_mutex_lock (&self->lock);
+  ret = self->fd >= 0 && gst_boson_telemetry_send_control (self, V4L2_CID_FLIR_FFC_RUN, 1);
+  g_mutex_unlock (&self->lock);
+  return ret;
+}
+
+static void
+gst_boson_telemetry_set_property (GObject * object, guint prop_id, const GValue * value, GParamSpec * pspec)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (object);
+
+  switch (prop_id) {
+    case PROP_ROWS:
+      self->rows = g_value_get_uint (value);
+      gst_base_transform_reconfigure_src (GST_BASE_TRANSFORM (self));
+      break;
+    case PROP_TOP:
+      self->top = g_value_get_boolean (value);
+      break;
+    case PROP_SUBDEV:
+      g_mutex_lock (&self->lock);
+      g_free (self->subdev);
+      self->subdev = g_value_dup_string (value);
+      g_mutex_unlock (&self->lock);
+      break;
+    default:
+      if (prop_id >= PROP_CONTROL_FIRST && prop_id < PROP_CONTROL_FIRST + N_CONTROLS) {
+        guint i = prop_id - PROP_CONTROL_FIRST;
+
+        g_mutex_lock (&self->lock);
+        self->controls[i] = g_value_get_int (value);
+        self->control_set[i] = TRUE;
+        gst_boson_telemetry_send_control (self, boson_controls[i].cid, self->controls[i]);
+        g_mutex_unlock (&self->lock);
+        break;
+      }
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static void
+gst_boson_telemetry_get_property (GObject * object, guint prop_id, GValue * value, GParamSpec * pspec)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (object);
+
+  switch (prop_id) {
+    case PROP_ROWS:
+      g_value_set_uint (value, self->rows);
+      break;
+    case PROP_TOP:
+      g_value_set_boolean (value, self->top);
+      break;
+    case PROP_SUBDEV:
+      g_mutex_lock (&self->lock);
+      g_value_set_string (value, self->subdev);
+      g_mutex_unlock (&self->lock);
+      break;
+    default:
+      if (prop_id >= PROP_CONTROL_FIRST && prop_id < PROP_CONTROL_FIRST + N_CONTROLS) {
+        guint i = prop_id - PROP_CONTROL_FIRST;
+        struct v4l2_control ctrl = { .id = boson_controls[i].cid };
+
+        g_mutex_lock (&self->lock);
+        /* the camera's value while running, what was set otherwise */
+        if (self->fd >= 0 && ioctl (self->fd, VIDIOC_G_CTRL, &ctrl) == 0)
+          self->controls[i] = ctrl.value;
+        g_value_set_int (value, self->controls[i]);
+        g_mutex_unlock (&self->lock);
+        break;
+      }
+      G_OBJECT_WARN_INVALID_PROPERTY_ID (object, prop_id, pspec);
+      break;
+  }
+}
+
+static gboolean
+gst_boson_telemetry_start (GstBaseTransform * trans)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (trans);
+  guint i;
+
+  g_mutex_lock (&self->lock);
+  if (self->subdev) {
+    self->fd = open (self->subdev, O_RDWR | O_CLOEXEC);
+    if (self->fd < 0) {
+      g_mutex_unlock (&self->lock);
+      GST_ELEMENT_ERROR (self, RESOURCE, OPEN_READ_WRITE, ("Could not open %s", self->subdev),
+          ("%s", g_strerror (errno)));
+      return FALSE;
+    }
+    for (i = 0; i < N_CONTROLS; i++)
+      if (self->control_set[i])
+        gst_boson_telemetry_send_control (self, boson_controls[i].cid, self->controls[i]);
+  }
+  g_mutex_unlock (&self->lock);
+  return TRUE;
+}
+
+static gboolean
+gst_boson_telemetry_stop (GstBaseTransform * trans)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (trans);
+
+  g_mutex_lock (&self->lock);
+  if (self->fd >= 0) {
+    close (self->fd);
+    self->fd = -1;
+  }
+  g_mutex_unlock (&self->lock);
+  return TRUE;
+}
+
+static GstCaps *
+gst_boson_telemetry_transform_caps (GstBaseTransform * trans, GstPadDirection direction,
+    GstCaps * caps, GstCaps * filter)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (trans);
+  gint delta = direction == GST_PAD_SINK ? -(gint) self->rows : (gint) self->rows;
+  GstCaps *ret = gst_caps_new_empty ();
+  guint i;
+
+  for (i = 0; i < gst_caps_get_size (caps); i++) {
+    GstStructure *s = gst_structure_copy (gst_caps_get_structure (caps, i));
+    const GValue *height = gst_structure_get_value (s, "height");
+
+    if (height && G_VALUE_HOLDS_INT (height)) {
+      gint h = g_value_get_int (height) + delta;
+
+      if (h <= 0) {
+        gst_structure_free (s);
+        continue;
+      }
+      gst_structure_set (s, "height", G_TYPE_INT, h, NULL);
+    } else if (height && GST_VALUE_HOLDS_INT_RANGE (height)) {
+      gint64 min = (gint64) gst_value_get_int_range_min (height) + delta;
+      gint64 max = (gint64) gst_value_get_int_range_max (height) + delta;
+
+      min = CLAMP (min, 1, G_MAXINT);
+      max = CLAMP (max, 1, G_MAXINT);
+      if (max < min) {
+        gst_structure_free (s);
+        continue;
+      }
+      if (max > min)
+        gst_structure_set (s, "height", GST_TYPE_INT_RANGE, (gint) min, (gint) max, NULL);
+      else
+        gst_structure_set (s, "height", G_TYPE_INT, (gint) min, NULL);
+    }
+    ret = gst_caps_merge_structure (ret, s);
+  }
+
+  if (filter) {
+    GstCaps *tmp = gst_caps_intersect_full (filter, ret, GST_CAPS_INTERSECT_FIRST);
+
+    gst_caps_unref (ret);
+    ret = tmp;
+  }
+  GST_DEBUG_OBJECT (self, "%s caps %" GST_PTR_FORMAT " -> %" GST_PTR_FORMAT,
+      direction == GST_PAD_SINK ? "sink" : "src", caps, ret);
+  return ret;
+}
+
+static gboolean
+gst_boson_telemetry_set_caps (GstBaseTransform * trans, GstCaps * incaps, GstCaps * outcaps)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (trans);
+
+  if (!gst_video_info_from_caps (&self->in_info, incaps) || !gst_video_info_from_caps (&self->out_info, outcaps))
+    return FALSE;
+  if (GST_VIDEO_INFO_HEIGHT (&self->in_info) != GST_VIDEO_INFO_HEIGHT (&self->out_info) + (gint) self->rows) {
+    GST_ERROR_OBJECT (self, "%d rows in, %d out, with %u telemetry rows", GST_VIDEO_INFO_HEIGHT (&self->in_info),
+        GST_VIDEO_INFO_HEIGHT (&self->out_info), self->rows);
+    return FALSE;
+  }
+  return TRUE;
+}
+
+static gboolean
+gst_boson_telemetry_propose_allocation (GstBaseTransform * trans, GstQuery * decide_query, GstQuery * query)
+{
+  if (!GST_BASE_TRANSFORM_CLASS (parent_class)->propose_allocation (trans, decide_query, query))
+    return FALSE;
+  /* stride and offset of the incoming rows are read from it */
+  gst_query_add_allocation_meta (query, GST_VIDEO_META_API_TYPE, NULL);
+  return TRUE;
+}
+
+static GstFlowReturn
+gst_boson_telemetry_transform_ip (GstBaseTransform * trans, GstBuffer * buf)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (trans);
+  GstVideoMeta *vmeta = gst_buffer_get_video_meta (buf);
+  guint pixel = GST_VIDEO_INFO_COMP_PSTRIDE (&self->in_info, 0);
+  guint width = MIN ((guint) GST_VIDEO_INFO_WIDTH (&self->in_info), BOSON_TEL_BYTES);
+  guint height = GST_VIDEO_INFO_HEIGHT (&self->out_info);
+  gsize offset = GST_VIDEO_INFO_PLANE_OFFSET (&self->in_info, 0);
+  gint stride = GST_VIDEO_INFO_PLANE_STRIDE (&self->in_info, 0);
+  guint8 row[BOSON_TEL_BYTES * 2];
+
+  if (self->rows == 0)
+    return GST_FLOW_OK;
+  if (vmeta) {
+    offset = vmeta->offset[0];
+    stride = vmeta->stride[0];
+  }
+
+  /* the decoded fields only, a few hundred bytes; the image stays where it is */
+  if (gst_buffer_extract (buf, offset + (gsize) (self->top ? 0 : height) * stride, row, width * pixel)
+      == width * pixel)
+    gst_buffer_add_boson_telemetry_meta (buf, row, pixel, width);
+  else
+    GST_WARNING_OBJECT (self, "Buffer too small for its telemetry rows");
+
+  if (self->top)
+    offset += (gsize) self->rows * stride;
+  if (vmeta) {
+    vmeta->height = height;
+    vmeta->offset[0] = offset;
+  } else {
+    gsize offsets[GST_VIDEO_MAX_PLANES] = { offset };
+    gint strides[GST_VIDEO_MAX_PLANES] = { stride };
+
+    gst_buffer_add_video_meta_full (buf, GST_VIDEO_FRAME_FLAG_NONE, GST_VIDEO_INFO_FORMAT (&self->out_info),
+        GST_VIDEO_INFO_WIDTH (&self->out_info), height, 1, offsets, strides);
+  }
+  return GST_FLOW_OK;
+}
+
+static void
+gst_boson_telemetry_finalize (GObject * object)
+{
+  GstBosonTelemetry *self = GST_BOSON_TELEMETRY (object);
+
+  g_free (self->subdev);
+  g_mutex_clear (&self->lock);
+  G_OBJECT_CLASS (parent_class)->finalize (object);
+}
+
+static void
+gst_boson_telemetry_class_init (GstBosonTelemetryClass * klass)
+{
+  GObjectClass *gobject_class = G_OBJECT_CLASS (klass);
+  GstElementClass *element_class = GST_ELEMENT_CLASS (klass);
+  GstBaseTransformClass *trans_class = GST_BASE_TRANSFORM_CLASS (klass);
+  guint i;
+
+  gobject_class->set_property = gst_boson_telemetry_set_property;
+  gobject_class->get_property = gst_boson_telemetry_get_property;
+  gobject_class->finalize = gst_boson_telemetry_finalize;
+
+  g_object_class_install_property (gobject_class, PROP_ROWS,
+      g_param_spec_uint ("telemetry-rows", "Telemetry rows", "Telemetry rows in the incoming frames",
+          0, 16, DEFAULT_ROWS, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
+  g_object_class_install_property (gobject_class, PROP_TOP,
+      g_param_spec_boolean ("telemetry-top", "Telemetry on top", "Telemetry rows precede the image",
+          FALSE, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
+  g_object_class_install_property (gobject_class, PROP_SUBDEV,
+      g_param_spec_string ("subdev", "Sensor subdev", "v4l-subdev node of the camera, for the controls",
+          NULL, G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_READY));
+  for (i = 0; i < N_CONTROLS; i++)
+    g_object_class_install_property (gobject_class, PROP_CONTROL_FIRST + i,
+        g_param_spec_int (boson_controls[i].name, boson_controls[i].name, boson_controls[i].blurb,
+            boson_controls[i].min, boson_controls[i].max, boson_controls[i].def,
+            G_PARAM_READWRITE | G_PARAM_STATIC_STRINGS | GST_PARAM_MUTABLE_PLAYING));
+
+  /* g_signal_emit_by_name (element, "run-ffc", &ok) */
+  g_signal_new_class_handler ("run-ffc", G_TYPE_FROM_CLASS (klass), G_SIGNAL_RUN_LAST | G_SIGNAL_ACTION,
+      G_CALLBACK (gst_boson_telemetry_run_ffc), NULL, NULL, NULL, G_TYPE_BOOLEAN, 0);
+
+  gst_element_class_set_static_metadata (element_class, "FLIR Boson telemetry", "Filter/Video",
+      "Splits the Boson telemetry rows off into GstBosonTelemetryMeta, without copying",
+      "VideologyInc");
+  gst_element_class_add_static_pad_template (element_class, &sink_template);
+  gst_element_class_add_static_pad_template (element_class, &src_template);
+
+  trans_class->start = gst_boson_telemetry_start;
+  trans_class->stop = gst_boson_telemetry_stop;
+  trans_class->transform_caps = gst_boson_telemetry_transform_caps;
+  trans_class->set_caps = gst_boson_telemetry_set_caps;
+  trans_class->propose_allocation = gst_boson_telemetry_propose_allocation;
+  trans_class->transform_ip = gst_boson_telemetry_transform_ip;
+
+  GST_DEBUG_CATEGORY_INIT (gst_boson_telemetry_debug, "bosontelemetry", 0, "FLIR Boson telemetry");
+}
+
+static void
+gst_boson_telemetry_init (GstBosonTelemetry * self)
+{
+  guint i;
+
+  self->rows = DEFAULT_ROWS;
+  self->fd = -1;
+  g_mutex_init (&self->lock);
+  for (i = 0; i < N_CONTROLS; i++)
+    self->controls[i] = boson_controls[i].def;
+  /* in place, so buffers are at most shallow-copied to add the metas */
+  gst_base_transform_set_in_place (GST_BASE_TRANSFORM (self), TRUE);
+}
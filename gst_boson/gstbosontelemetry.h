@@ -0,0 +1,19 @@
+/* SPDX-License-Identifier: MIT */
+/*
+ * bosontelemetry - v4l2src companion for the FLIR Boson telemetry framesizes
+ * Copyright (C) 2026, VideologyInc
+ */
+
+#ifndef GST_BOSON_TELEMETRY_H
+#define GST_BOSON_TELEMETRY_H
+
+#include <gst/base/gstbasetransform.h>
+
+G_BEGIN_DECLS
+
+#define GST_TYPE_BOSON_TELEMETRY (gst_boson_telemetry_get_type ())
+G_DECLARE_FINAL_TYPE (GstBosonTelemetry, gst_boson_telemetry, GST, BOSON_TELEMETRY, GstBaseTransform)
+
+G_END_DECLS
+
+#endif /* GST_BOSON_TELEMETRY_H */